@@ -0,0 +1,357 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * byte_search.c : vectorized substring search and comparison of byte strings
+ *
+ *   The kernels use SSE2, which every x86-64 processor has, or AVX2 when the processor supports it; the choice is
+ *   made at run time, on first use. Other platforms use the scalar versions.
+ *
+ *   Substring search compares the first and the last byte of the needle with a whole block of the haystack at once;
+ *   only the positions where both match are compared with memcmp.
+ */
+
+#ident "$Id$"
+
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "byte_search.h"
+
+#if defined (__x86_64__) || defined (_M_X64)
+#define BYTE_SEARCH_X86_64
+#include <immintrin.h>
+#if defined (_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+#if defined (BYTE_SEARCH_X86_64) && !defined (_MSC_VER)
+#define BYTE_SEARCH_TARGET_AVX2 __attribute__ ((target ("avx2")))
+#else
+#define BYTE_SEARCH_TARGET_AVX2
+#endif
+
+typedef const char *(*BYTE_SEARCH_FIND_FUNC) (const char *, size_t, const char *, size_t);
+typedef size_t (*BYTE_SEARCH_MISMATCH_FUNC) (const char *, const char *, size_t);
+
+static const char *byte_search_find_scalar (const char *haystack, size_t haystack_size, const char *needle,
+					    size_t needle_size);
+static size_t byte_search_mismatch_scalar (const char *str1, const char *str2, size_t size);
+#if defined (BYTE_SEARCH_X86_64)
+static int byte_search_ctz (unsigned int mask);
+static bool byte_search_has_avx2 (void);
+static const char *byte_search_find_sse2 (const char *haystack, size_t haystack_size, const char *needle,
+					  size_t needle_size);
+static size_t byte_search_mismatch_sse2 (const char *str1, const char *str2, size_t size);
+static const char *byte_search_find_avx2 (const char *haystack, size_t haystack_size, const char *needle,
+					  size_t needle_size) BYTE_SEARCH_TARGET_AVX2;
+static size_t byte_search_mismatch_avx2 (const char *str1, const char *str2, size_t size) BYTE_SEARCH_TARGET_AVX2;
+#endif /* BYTE_SEARCH_X86_64 */
+static void byte_search_init_kernels (void);
+
+/* chosen on first use; concurrent initialization writes the same values */
+static volatile BYTE_SEARCH_FIND_FUNC byte_Search_find_func = NULL;
+static volatile BYTE_SEARCH_MISMATCH_FUNC byte_Search_mismatch_func = NULL;
+
+/*
+ * byte_search_find () - find the first occurrence of needle in haystack
+ *   return: pointer to the occurrence in haystack, NULL if not found
+ *   haystack(in):
+ *   haystack_size(in):
+ *   needle(in):
+ *   needle_size(in):
+ */
+const char *
+byte_search_find (const char *haystack, size_t haystack_size, const char *needle, size_t needle_size)
+{
+  if (needle_size == 0)
+    {
+      return haystack;
+    }
+  if (needle_size > haystack_size)
+    {
+      return NULL;
+    }
+  if (needle_size == 1)
+    {
+      return (const char *) memchr (haystack, (unsigned char) needle[0], haystack_size);
+    }
+
+  if (byte_Search_find_func == NULL)
+    {
+      byte_search_init_kernels ();
+    }
+  return byte_Search_find_func (haystack, haystack_size, needle, needle_size);
+}
+
+/*
+ * byte_search_mismatch () - find the first position where two strings differ
+ *   return: offset of the first different byte, size if the strings are equal
+ *   str1(in):
+ *   str2(in):
+ *   size(in): size to compare
+ */
+size_t
+byte_search_mismatch (const char *str1, const char *str2, size_t size)
+{
+  if (byte_Search_mismatch_func == NULL)
+    {
+      byte_search_init_kernels ();
+    }
+  return byte_Search_mismatch_func (str1, str2, size);
+}
+
+/*
+ * byte_search_init_kernels () - choose the kernels for this processor
+ *   return: void
+ */
+static void
+byte_search_init_kernels (void)
+{
+#if defined (BYTE_SEARCH_X86_64)
+  if (byte_search_has_avx2 ())
+    {
+      byte_Search_mismatch_func = byte_search_mismatch_avx2;
+      byte_Search_find_func = byte_search_find_avx2;
+    }
+  else
+    {
+      byte_Search_mismatch_func = byte_search_mismatch_sse2;
+      byte_Search_find_func = byte_search_find_sse2;
+    }
+#else
+  byte_Search_mismatch_func = byte_search_mismatch_scalar;
+  byte_Search_find_func = byte_search_find_scalar;
+#endif
+}
+
+/*
+ * byte_search_find_scalar () - substring search; memchr on the first byte, memcmp on the rest
+ */
+static const char *
+byte_search_find_scalar (const char *haystack, size_t haystack_size, const char *needle, size_t needle_size)
+{
+  const char *p = haystack;
+  const char *last = haystack + haystack_size - needle_size;
+
+  assert (needle_size >= 1 && needle_size <= haystack_size);
+
+  while (p <= last)
+    {
+      p = (const char *) memchr (p, (unsigned char) needle[0], last - p + 1);
+      if (p == NULL)
+	{
+	  return NULL;
+	}
+      if (memcmp (p + 1, needle + 1, needle_size - 1) == 0)
+	{
+	  return p;
+	}
+      p++;
+    }
+  return NULL;
+}
+
+/*
+ * byte_search_mismatch_scalar () - compare a machine word at a time
+ */
+static size_t
+byte_search_mismatch_scalar (const char *str1, const char *str2, size_t size)
+{
+  size_t i = 0;
+  uint64_t w1, w2;
+
+  for (; i + sizeof (uint64_t) <= size; i += sizeof (uint64_t))
+    {
+      memcpy (&w1, str1 + i, sizeof (w1));
+      memcpy (&w2, str2 + i, sizeof (w2));
+      if (w1 != w2)
+	{
+	  break;
+	}
+    }
+  for (; i < size; i++)
+    {
+      if (str1[i] != str2[i])
+	{
+	  return i;
+	}
+    }
+  return size;
+}
+
+#if defined (BYTE_SEARCH_X86_64)
+static int
+byte_search_ctz (unsigned int mask)
+{
+  assert (mask != 0);
+#if defined (_MSC_VER)
+  unsigned long index;
+
+  _BitScanForward (&index, mask);
+  return (int) index;
+#else
+  return __builtin_ctz (mask);
+#endif
+}
+
+/*
+ * byte_search_has_avx2 () - true if both the processor and the operating system support AVX2
+ */
+static bool
+byte_search_has_avx2 (void)
+{
+#if defined (_MSC_VER)
+  int info[4];
+
+  __cpuid (info, 0);
+  if (info[0] < 7)
+    {
+      return false;
+    }
+
+  /* OSXSAVE and AVX, and the OS saves YMM registers */
+  __cpuid (info, 1);
+  if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0 || (_xgetbv (0) & 0x6) != 0x6)
+    {
+      return false;
+    }
+
+  __cpuidex (info, 7, 0);
+  return (info[1] & (1 << 5)) != 0;
+#else
+  __builtin_cpu_init ();
+  return __builtin_cpu_supports ("avx2") != 0;
+#endif
+}
+
+static const char *
+byte_search_find_sse2 (const char *haystack, size_t haystack_size, const char *needle, size_t needle_size)
+{
+  const __m128i first = _mm_set1_epi8 (needle[0]);
+  const __m128i last = _mm_set1_epi8 (needle[needle_size - 1]);
+  size_t i = 0;
+
+  assert (needle_size >= 2 && needle_size <= haystack_size);
+
+  for (; i + needle_size - 1 + sizeof (__m128i) <= haystack_size; i += sizeof (__m128i))
+    {
+      __m128i block_first = _mm_loadu_si128 ((const __m128i *) (haystack + i));
+      __m128i block_last = _mm_loadu_si128 ((const __m128i *) (haystack + i + needle_size - 1));
+      unsigned int mask = (unsigned int) _mm_movemask_epi8 (_mm_and_si128 (_mm_cmpeq_epi8 (first, block_first),
+							     _mm_cmpeq_epi8 (last, block_last)));
+
+      while (mask != 0)
+	{
+	  int bit = byte_search_ctz (mask);
+
+	  if (memcmp (haystack + i + bit + 1, needle + 1, needle_size - 2) == 0)
+	    {
+	      return haystack + i + bit;
+	    }
+	  mask &= mask - 1;
+	}
+    }
+
+  /* the rest is shorter than a block */
+  if (i + needle_size <= haystack_size)
+    {
+      return byte_search_find_scalar (haystack + i, haystack_size - i, needle, needle_size);
+    }
+  return NULL;
+}
+
+static size_t
+byte_search_mismatch_sse2 (const char *str1, const char *str2, size_t size)
+{
+  size_t i = 0;
+
+  for (; i + sizeof (__m128i) <= size; i += sizeof (__m128i))
+    {
+      __m128i block1 = _mm_loadu_si128 ((const __m128i *) (str1 + i));
+      __m128i block2 = _mm_loadu_si128 ((const __m128i *) (str2 + i));
+      unsigned int mask = (unsigned int) _mm_movemask_epi8 (_mm_cmpeq_epi8 (block1, block2));
+
+      if (mask != 0xFFFF)
+	{
+	  return i + byte_search_ctz (~mask & 0xFFFF);
+	}
+    }
+
+  return i + byte_search_mismatch_scalar (str1 + i, str2 + i, size - i);
+}
+
+static const char *
+byte_search_find_avx2 (const char *haystack, size_t haystack_size, const char *needle, size_t needle_size)
+{
+  const __m256i first = _mm256_set1_epi8 (needle[0]);
+  const __m256i last = _mm256_set1_epi8 (needle[needle_size - 1]);
+  size_t i = 0;
+
+  assert (needle_size >= 2 && needle_size <= haystack_size);
+
+  for (; i + needle_size - 1 + sizeof (__m256i) <= haystack_size; i += sizeof (__m256i))
+    {
+      __m256i block_first = _mm256_loadu_si256 ((const __m256i *) (haystack + i));
+      __m256i block_last = _mm256_loadu_si256 ((const __m256i *) (haystack + i + needle_size - 1));
+      unsigned int mask =
+	(unsigned int) _mm256_movemask_epi8 (_mm256_and_si256 (_mm256_cmpeq_epi8 (first, block_first),
+							       _mm256_cmpeq_epi8 (last, block_last)));
+
+      while (mask != 0)
+	{
+	  int bit = byte_search_ctz (mask);
+
+	  if (memcmp (haystack + i + bit + 1, needle + 1, needle_size - 2) == 0)
+	    {
+	      return haystack + i + bit;
+	    }
+	  mask &= mask - 1;
+	}
+    }
+
+  /* finish with 16 byte blocks */
+  if (i + needle_size <= haystack_size)
+    {
+      return byte_search_find_sse2 (haystack + i, haystack_size - i, needle, needle_size);
+    }
+  return NULL;
+}
+
+static size_t
+byte_search_mismatch_avx2 (const char *str1, const char *str2, size_t size)
+{
+  size_t i = 0;
+
+  for (; i + sizeof (__m256i) <= size; i += sizeof (__m256i))
+    {
+      __m256i block1 = _mm256_loadu_si256 ((const __m256i *) (str1 + i));
+      __m256i block2 = _mm256_loadu_si256 ((const __m256i *) (str2 + i));
+      unsigned int mask = (unsigned int) _mm256_movemask_epi8 (_mm256_cmpeq_epi8 (block1, block2));
+
+      if (mask != 0xFFFFFFFF)
+	{
+	  return i + byte_search_ctz (~mask);
+	}
+    }
+
+  return i + byte_search_mismatch_sse2 (str1 + i, str2 + i, size - i);
+}
+#endif /* BYTE_SEARCH_X86_64 */
@@ -0,0 +1,44 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * byte_search.h : vectorized substring search and comparison of byte strings
+ *
+ */
+
+#ifndef _BYTE_SEARCH_H_
+#define _BYTE_SEARCH_H_
+
+#ident "$Id$"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+  extern const char *byte_search_find (const char *haystack, size_t haystack_size, const char *needle,
+				       size_t needle_size);
+  extern size_t byte_search_mismatch (const char *str1, const char *str2, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif				/* _BYTE_SEARCH_H_ */
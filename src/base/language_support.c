@@ -33,6 +33,7 @@
 
 #include "language_support.h"
 
+#include "byte_search.h"
 #include "chartype.h"
 #include "environment_variable.h"
 #include "memory_hash.h"
@@ -5502,7 +5503,13 @@ lang_fastcmp_byte (const LANG_COLLATION * lang_coll, const unsigned char *string
 
 
   n = size1 < size2 ? size1 : size2;
-  for (i = 0, cmp = 0; i < n && cmp == 0; i++)
+
+  /* equal bytes have equal weights; skip the common prefix at once */
+  i = (int) byte_search_mismatch ((const char *) string1, (const char *) string2, n);
+  string1 += i;
+  string2 += i;
+
+  for (cmp = 0; i < n && cmp == 0; i++)
     {
       c1 = *string1++;
       if (c1 == SPACE)
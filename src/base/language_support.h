@@ -59,6 +59,13 @@
     ((c) == LANG_COLL_ISO_BINARY || (c) == LANG_COLL_UTF8_BINARY  \
      || (c) == LANG_COLL_EUCKR_BINARY)
 
+/* collations where a character matches only itself, so that LIKE can compare bytes (but space also matches NUL,
+ * except in binary collation) */
+#define LANG_IS_BYTE_MATCH_COLL(c)      \
+    ((c) == LANG_COLL_ISO_BINARY || (c) == LANG_COLL_UTF8_BINARY  \
+     || (c) == LANG_COLL_ISO_EN_CS || (c) == LANG_COLL_UTF8_EN_CS \
+     || (c) == LANG_COLL_BINARY)
+
 /* common collation to be used at runtime */
 #define LANG_RT_COMMON_COLL(c1, c2, coll)     \
   do {                                        \
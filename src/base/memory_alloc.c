@@ -57,6 +57,7 @@ HL_HEAPID private_heap_id = 0;
 
 #if defined (SERVER_MODE)
 static HL_HEAPID db_private_get_heapid_from_thread (REFPTR (THREAD_ENTRY, thread_p));
+static void *db_private_realloc_from_arena (THREAD_ENTRY * thread_p, HL_HEAPID heap_id, void *ptr, size_t size);
 #endif // SERVER_MODE
 
 /*
@@ -456,6 +457,16 @@ db_private_alloc_release (THREAD_ENTRY * thrd, size_t size, bool rc_track)
 
   heap_id = db_private_get_heapid_from_thread (thrd);
 
+  if (heap_id && thrd->private_arena.has_frame ())
+    {
+      /* released at once with the frame; not tracked */
+      ptr = thrd->private_arena.allocate (size);
+      if (ptr != NULL)
+	{
+	  return ptr;
+	}
+    }
+
   if (heap_id)
     {
       ptr = hl_lea_alloc (heap_id, size);
@@ -577,6 +588,26 @@ db_private_realloc_release (THREAD_ENTRY * thrd, void *ptr, size_t size, bool rc
 
   heap_id = db_private_get_heapid_from_thread (thrd);
 
+  if (ptr == NULL && heap_id && thrd->private_arena.has_frame ())
+    {
+      new_ptr = thrd->private_arena.allocate (size);
+      if (new_ptr != NULL)
+	{
+	  return new_ptr;
+	}
+    }
+  else if (ptr != NULL && thrd->private_arena.contains (ptr))
+    {
+      new_ptr = db_private_realloc_from_arena (thrd, heap_id, ptr, size);
+#if !defined (NDEBUG)
+      if (rc_track && heap_id != 0 && new_ptr != NULL && !thrd->private_arena.contains (new_ptr))
+	{
+	  thrd->get_alloc_tracker ().increment (caller_file, caller_line, new_ptr);
+	}
+#endif /* !NDEBUG */
+      return new_ptr;
+    }
+
   if (heap_id)
     {
       new_ptr = hl_lea_realloc (heap_id, ptr, size);
@@ -741,6 +772,13 @@ db_private_free_release (THREAD_ENTRY * thrd, void *ptr, bool rc_track)
 #elif defined (SERVER_MODE)
   heap_id = db_private_get_heapid_from_thread (thrd);
 
+  if (thrd->private_arena.contains (ptr))
+    {
+      /* the memory is given back when the frame is popped */
+      thrd->private_arena.deallocate (ptr);
+      return;
+    }
+
   if (heap_id)
     {
       hl_lea_free (heap_id, ptr);
@@ -973,6 +1011,91 @@ db_private_set_heapid_to_thread (THREAD_ENTRY * thread_p, HL_HEAPID heap_id)
 
   return old_heap_id;
 }
+
+/*
+ * db_private_arena_push () - start serving private allocations of the thread from its arena
+ *   return: true if a frame was pushed and db_private_arena_pop must be called
+ *   thread_p(in):
+ *   arena_size(in): most memory the arena may hold; 0 disables the arena
+ *
+ * Note: Allocations that do not fit in the arena (large ones, or after the arena is full) and allocations made while
+ *       the private heap is switched to malloc still come from the private heap. Freeing memory of the arena only
+ *       gives it back if it is the most recent allocation; everything else is given back by db_private_arena_pop.
+ *       Memory that must live after the frame is popped has to be allocated with malloc or with the private heap
+ *       switched to 0 (see db_change_private_heap).
+ */
+bool
+db_private_arena_push (THREAD_ENTRY * thread_p, size_t arena_size)
+{
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+  assert (thread_p != NULL);
+
+  if (arena_size == 0 || thread_p->private_heap_id == 0)
+    {
+      return false;
+    }
+
+  thread_p->private_arena.push_frame (arena_size);
+  return true;
+}
+
+/*
+ * db_private_arena_pop () - free everything that was allocated from the arena since the matching push
+ *   return:
+ *   thread_p(in):
+ */
+void
+db_private_arena_pop (THREAD_ENTRY * thread_p)
+{
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+  assert (thread_p != NULL);
+
+  thread_p->private_arena.pop_frame ();
+}
+
+/*
+ * db_private_realloc_from_arena () - reallocate memory of the thread arena
+ *   return: new memory pointer or NULL
+ *   thread_p(in):
+ *   heap_id(in): current private heap of the thread
+ *   ptr(in): memory of the arena
+ *   size(in): new size
+ *
+ * Note: The memory moves to the private heap when it does not fit in the arena anymore.
+ */
+static void *
+db_private_realloc_from_arena (THREAD_ENTRY * thread_p, HL_HEAPID heap_id, void *ptr, size_t size)
+{
+  cubmem::arena *arena = &thread_p->private_arena;
+  void *new_ptr = NULL;
+
+  if (heap_id && arena->has_frame ())
+    {
+      new_ptr = arena->reallocate (ptr, size);
+      if (new_ptr != NULL)
+	{
+	  return new_ptr;
+	}
+    }
+
+  new_ptr = heap_id ? hl_lea_alloc (heap_id, size) : malloc (size);
+  if (new_ptr == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, size);
+      return NULL;
+    }
+
+  memcpy (new_ptr, ptr, MIN (size, arena->get_max_size (ptr)));
+  arena->deallocate (ptr);
+
+  return new_ptr;
+}
 #endif // SERVER_MODE
 
 #endif
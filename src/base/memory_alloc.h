@@ -282,6 +282,8 @@ extern void *db_private_realloc_external (THREAD_ENTRY * thrd, void *ptr, size_t
 
 #if defined (SERVER_MODE)
 extern HL_HEAPID db_private_set_heapid_to_thread (THREAD_ENTRY * thread_p, HL_HEAPID heap_id);
+extern bool db_private_arena_push (THREAD_ENTRY * thread_p, size_t arena_size);
+extern void db_private_arena_pop (THREAD_ENTRY * thread_p);
 #endif // SERVER_MODE
 
 extern HL_HEAPID db_create_fixed_heap (int req_size, int recs_per_chunk);
@@ -0,0 +1,272 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+//
+// memory_arena.cpp - bump pointer allocator whose memory is released all at once
+//
+
+#include "memory_arena.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+
+namespace cubmem
+{
+  struct arena::chunk
+  {
+    chunk *m_prev;
+    std::size_t m_size;		// usable bytes after the header
+
+    char *begin ()
+    {
+      return reinterpret_cast<char *> (this) + HEADER_SIZE;
+    }
+
+    char *end ()
+    {
+      return begin () + m_size;
+    }
+
+    static const std::size_t HEADER_SIZE;
+  };
+
+  const std::size_t arena::chunk::HEADER_SIZE = (sizeof (arena::chunk) + ALIGNMENT - 1) & ~ (ALIGNMENT - 1);
+
+  static inline std::size_t
+  arena_align (std::size_t size)
+  {
+    return (size + arena::ALIGNMENT - 1) & ~ (arena::ALIGNMENT - 1);
+  }
+
+  arena::arena ()
+    : m_first (NULL)
+    , m_current (NULL)
+    , m_top (NULL)
+    , m_last_alloc (NULL)
+    , m_limit (0)
+    , m_reserved (0)
+    , m_frames ()
+  {
+  }
+
+  arena::~arena ()
+  {
+    assert (m_frames.empty ());
+    free_chunks_after (NULL);
+  }
+
+  void
+  arena::push_frame (std::size_t limit)
+  {
+    if (m_frames.empty () && limit != m_limit)
+      {
+	// the first chunk was sized for another limit
+	free_chunks_after (NULL);
+	m_limit = limit;
+      }
+
+    m_frames.push_back ({ m_current, m_top });
+
+    // memory given back by the new frame must not reach into the outer frame
+    m_last_alloc = NULL;
+  }
+
+  void
+  arena::pop_frame ()
+  {
+    assert (!m_frames.empty ());
+
+    position pos = m_frames.back ();
+    m_frames.pop_back ();
+
+    if (pos.m_chunk == NULL)
+      {
+	// nothing was allocated when the frame was pushed; keep the first chunk for the next frame
+	free_chunks_after (m_first);
+	m_top = m_first != NULL ? m_first->begin () : NULL;
+      }
+    else
+      {
+	free_chunks_after (pos.m_chunk);
+	m_top = pos.m_top;
+      }
+    m_last_alloc = NULL;
+  }
+
+  void *
+  arena::allocate (std::size_t size)
+  {
+    assert (!m_frames.empty ());
+
+    if (size == 0 || size > MAX_ALLOCATION_SIZE)
+      {
+	return NULL;
+      }
+
+    size = arena_align (size);
+    if (m_current == NULL || m_top + size > m_current->end ())
+      {
+	if (!add_chunk (size))
+	  {
+	    return NULL;
+	  }
+      }
+
+    m_last_alloc = m_top;
+    m_top += size;
+
+    return m_last_alloc;
+  }
+
+  void *
+  arena::reallocate (void *ptr, std::size_t size)
+  {
+    char *new_ptr;
+    std::size_t old_max_size;
+
+    if (ptr == NULL)
+      {
+	return allocate (size);
+      }
+
+    assert (contains (ptr));
+
+    if (ptr == m_last_alloc && size != 0 && size <= MAX_ALLOCATION_SIZE
+	&& m_last_alloc + arena_align (size) <= m_current->end ())
+      {
+	// grow or shrink the most recent allocation in place
+	m_top = m_last_alloc + arena_align (size);
+	return ptr;
+      }
+
+    old_max_size = get_max_size (ptr);
+    new_ptr = (char *) allocate (size);
+    if (new_ptr == NULL)
+      {
+	return NULL;
+      }
+
+    std::memcpy (new_ptr, ptr, std::min (size, old_max_size));
+    return new_ptr;
+  }
+
+  void
+  arena::deallocate (void *ptr)
+  {
+    assert (contains (ptr));
+
+    if (ptr == m_last_alloc)
+      {
+	m_top = m_last_alloc;
+	m_last_alloc = NULL;
+      }
+  }
+
+  bool
+  arena::contains (const void *ptr) const
+  {
+    return find_chunk (ptr) != NULL;
+  }
+
+  std::size_t
+  arena::get_max_size (const void *ptr) const
+  {
+    chunk *c = find_chunk (ptr);
+
+    if (c == NULL)
+      {
+	assert (false);
+	return 0;
+      }
+
+    return (c == m_current ? m_top : c->end ()) - (const char *) ptr;
+  }
+
+  arena::chunk *
+  arena::find_chunk (const void *ptr) const
+  {
+    const char *p = (const char *) ptr;
+
+    // chunks only go back to the first one, and there are few of them since each one is twice the previous one
+    for (chunk *c = m_current; c != NULL; c = c->m_prev)
+      {
+	if (p >= c->begin () && p < c->end ())
+	  {
+	    return c;
+	  }
+      }
+    return NULL;
+  }
+
+  bool
+  arena::add_chunk (std::size_t min_size)
+  {
+    std::size_t size;
+    chunk *c;
+
+    size = m_current == NULL ? FIRST_CHUNK_SIZE : 2 * m_current->m_size;
+    size = std::max (size, min_size);
+    if (m_reserved + size > m_limit)
+      {
+	if (m_reserved + min_size > m_limit)
+	  {
+	    return false;
+	  }
+	size = m_limit - m_reserved;
+      }
+
+    c = (chunk *) std::malloc (chunk::HEADER_SIZE + size);
+    if (c == NULL)
+      {
+	return false;
+      }
+
+    c->m_prev = m_current;
+    c->m_size = size;
+    if (m_first == NULL)
+      {
+	m_first = c;
+      }
+    m_current = c;
+    m_top = c->begin ();
+    m_reserved += size;
+
+    return true;
+  }
+
+  void
+  arena::free_chunks_after (chunk *keep)
+  {
+    while (m_current != NULL && m_current != keep)
+      {
+	chunk *prev = m_current->m_prev;
+
+	m_reserved -= m_current->m_size;
+	std::free (m_current);
+	m_current = prev;
+      }
+
+    if (keep == NULL)
+      {
+	m_first = NULL;
+	m_top = NULL;
+      }
+  }
+} // namespace cubmem
@@ -0,0 +1,111 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+//
+// memory_arena.hpp - bump pointer allocator whose memory is released all at once
+//
+
+#ifndef _MEMORY_ARENA_HPP_
+#define _MEMORY_ARENA_HPP_
+
+#include <cstddef>
+#include <vector>
+
+namespace cubmem
+{
+  // arena - bump pointer allocator with frames
+  //
+  //  how it works:
+  //    memory is cut from chunks, one allocation after the other. push_frame remembers the current position and
+  //    pop_frame gives back everything that was allocated since, in one step.
+  //
+  //    deallocate only gives back the most recent allocation; any other pointer stays allocated until its frame is
+  //    popped. reallocate grows the most recent allocation in place.
+  //
+  //    the arena never holds more than the limit given to the outermost frame. allocate returns NULL when the request
+  //    is larger than MAX_ALLOCATION_SIZE or when the limit is reached; the caller has to use another allocator.
+  //
+  //    the first chunk is kept when the outermost frame is popped, so the next frame can start without a malloc.
+  //
+  //  how to use:
+  //    arena.push_frame (limit);
+  //    ptr = arena.allocate (size);      // NULL => allocate elsewhere
+  //    ...
+  //    if (arena.contains (ptr))
+  //      {
+  //        arena.deallocate (ptr);
+  //      }
+  //    arena.pop_frame ();               // everything allocated since push_frame is released
+  //
+  //  an arena is not thread safe.
+  //
+  class arena
+  {
+    public:
+      static const std::size_t ALIGNMENT = 16;
+      static const std::size_t MAX_ALLOCATION_SIZE = 8 * 1024;
+      static const std::size_t FIRST_CHUNK_SIZE = 32 * 1024;
+
+      arena ();
+      ~arena ();
+
+      arena (const arena &) = delete;
+      arena &operator= (const arena &) = delete;
+
+      void push_frame (std::size_t limit);	// the limit of a nested frame is ignored
+      void pop_frame ();
+      bool has_frame () const
+      {
+	return !m_frames.empty ();
+      }
+
+      void *allocate (std::size_t size);
+      void *reallocate (void *ptr, std::size_t size);	// NULL if it does not fit; ptr is left unchanged then
+      void deallocate (void *ptr);
+
+      bool contains (const void *ptr) const;
+      // upper bound of the size of an allocation; bytes from ptr up to the end of the used part of its chunk
+      std::size_t get_max_size (const void *ptr) const;
+      std::size_t get_reserved_size () const
+      {
+	return m_reserved;
+      }
+
+    private:
+      struct chunk;
+      struct position
+      {
+	chunk *m_chunk;
+	char *m_top;
+      };
+
+      chunk *find_chunk (const void *ptr) const;
+      bool add_chunk (std::size_t min_size);
+      void free_chunks_after (chunk *keep);
+
+      chunk *m_first;
+      chunk *m_current;
+      char *m_top;			// first free byte of m_current
+      char *m_last_alloc;		// most recent allocation; NULL if it was given back or belongs to an outer frame
+      std::size_t m_limit;
+      std::size_t m_reserved;		// usable size of all chunks
+      std::vector<position> m_frames;
+  };
+} // namespace cubmem
+
+#endif // _MEMORY_ARENA_HPP_
@@ -278,6 +278,12 @@ orc_diskrep_from_record (THREAD_ENTRY * thread_p, RECDES * record)
       or_att->default_value.value = NULL;
       att->classoid = or_att->classoid;
 
+      /* column statistics are gathered by update statistics */
+      att->col_stats.ndv = 0;
+      att->col_stats.null_frac = 0;
+      att->col_stats.n_bounds = 0;
+      att->col_stats.bounds = NULL;
+
       /* initialize B+tree statistics information */
 
       n_btstats = att->n_btstats = or_att->n_btids;
@@ -448,6 +454,12 @@ orc_free_diskrep (DISK_REPR * rep)
 		  free_and_init (rep->fixed[i].bt_stats);
 		  rep->fixed[i].bt_stats = NULL;
 		}
+
+	      if (rep->fixed[i].col_stats.bounds != NULL)
+		{
+		  /* copied from the previous representation by catalog_copy_disk_attributes () */
+		  db_private_free_and_init (NULL, rep->fixed[i].col_stats.bounds);
+		}
 	    }
 
 	  free_and_init (rep->fixed);
@@ -475,6 +487,12 @@ orc_free_diskrep (DISK_REPR * rep)
 		  free_and_init (rep->variable[i].bt_stats);
 		  rep->variable[i].bt_stats = NULL;
 		}
+
+	      if (rep->variable[i].col_stats.bounds != NULL)
+		{
+		  /* copied from the previous representation by catalog_copy_disk_attributes () */
+		  db_private_free_and_init (NULL, rep->variable[i].col_stats.bounds);
+		}
 	    }
 
 	  free_and_init (rep->variable);
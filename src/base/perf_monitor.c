@@ -48,6 +48,7 @@
 #endif // SERVER_MODE or SA_MODE
 
 #include <cstring>
+#include <thread>
 
 #if defined(SERVER_MODE)
 #include <string.h>
@@ -80,6 +81,11 @@
 #include "vacuum.h"
 #include "xasl_cache.h"
 #include "load_worker_manager.hpp"
+#include "monitor_histogram.hpp"
+#include "monitor_registration.hpp"
+#include "network.h"
+#include "show_scan.h"
+#include "dbtype.h"
 
 #if defined (SERVER_MODE)
 #include "connection_error.h"
@@ -112,6 +118,34 @@ static int rv;
 
 #define PERFMON_VALUES_MEMSIZE (pstat_Global.n_stat_values * sizeof (UINT64))
 
+#define PERFMON_MAX_SHARDS 64
+#define PERFMON_CACHE_LINE_SIZE 64
+
+/* values of each latency histogram in statistics */
+typedef enum
+{
+  PERFMON_LATENCY_VALUE_COUNT,
+  PERFMON_LATENCY_VALUE_P50,
+  PERFMON_LATENCY_VALUE_P90,
+  PERFMON_LATENCY_VALUE_P99,
+  PERFMON_LATENCY_VALUE_P999,
+  PERFMON_LATENCY_VALUE_MAX,
+
+  PERFMON_LATENCY_VALUE_CNT
+} PERFMON_LATENCY_VALUE;
+
+static const char *perfmon_Latency_names[PERFMON_LATENCY_CNT] = {
+  "All_requests",
+  "Page_fix_wait",
+  "Lock_wait"
+};
+
+#if defined (SERVER_MODE) || defined (SA_MODE)
+/* histograms of PERFMON_LATENCY_TYPE, followed by histograms of each server request */
+#define PERFMON_LATENCY_HISTOGRAM_CNT (PERFMON_LATENCY_CNT + NET_SERVER_REQUEST_END)
+static cubmonitor::histogram_atomic_statistic *perfmon_Latency_histograms = NULL;
+#endif /* SERVER_MODE || SA_MODE */
+
 static int f_load_Num_data_page_fix_ext (void);
 static int f_load_Num_data_page_promote_ext (void);
 static int f_load_Num_data_page_promote_time_ext (void);
@@ -129,6 +163,7 @@ static int f_load_Time_get_oldest_mvcc_acquire_time (void);
 static int f_load_Count_get_oldest_mvcc_retry (void);
 static int f_load_thread_stats (void);
 static int f_load_thread_daemon_stats (void);
+static int f_load_Latency_histograms (void);
 
 static void f_dump_in_file_Num_data_page_fix_ext (FILE *, const UINT64 * stat_vals);
 static void f_dump_in_file_Num_data_page_promote_ext (FILE *, const UINT64 * stat_vals);
@@ -142,6 +177,7 @@ static void f_dump_in_file_Time_obj_lock_acquire_time (FILE *, const UINT64 * st
 static void f_dump_in_file_thread_stats (FILE * f, const UINT64 * stat_vals);
 static void f_dump_in_file_thread_daemon_stats (FILE * f, const UINT64 * stat_vals);
 static void f_dump_in_file_Num_dwb_flushed_block_volumes (FILE *, const UINT64 * stat_vals);
+static void f_dump_in_file_Latency_histograms (FILE *, const UINT64 * stat_vals);
 
 static void f_dump_in_buffer_Num_data_page_fix_ext (char **, const UINT64 * stat_vals, int *remaining_size);
 static void f_dump_in_buffer_Num_data_page_promote_ext (char **, const UINT64 * stat_vals, int *remaining_size);
@@ -155,6 +191,7 @@ static void f_dump_in_buffer_Time_obj_lock_acquire_time (char **, const UINT64 *
 static void f_dump_in_buffer_thread_stats (char **s, const UINT64 * stat_vals, int *remaining_size);
 static void f_dump_in_buffer_thread_daemon_stats (char **s, const UINT64 * stat_vals, int *remaining_size);
 static void f_dump_in_buffer_Num_dwb_flushed_block_volumes (char **s, const UINT64 * stat_vals, int *remaining_size);
+static void f_dump_in_buffer_Latency_histograms (char **s, const UINT64 * stat_vals, int *remaining_size);
 
 static void perfmon_stat_dump_in_file_fix_page_array_stat (FILE *, const UINT64 * stats_ptr);
 static void perfmon_stat_dump_in_file_promote_page_array_stat (FILE *, const UINT64 * stats_ptr);
@@ -191,6 +228,10 @@ static void perfmon_peek_thread_daemon_stats (UINT64 * stats);
 
 PSTAT_GLOBAL pstat_Global;
 
+#if defined (SERVER_MODE)
+thread_local int perfmon_Shard_index = -1;
+#endif /* SERVER_MODE */
+
 PSTAT_METADATA pstat_Metadata[] = {
   /* Execution statistics for the file io */
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_FILE_NUM_CREATES, "Num_file_creates"),
@@ -458,6 +499,8 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_UNFIX_VOID_TO_PRIVATE_TOP, "Num_unfix_void_to_private_top"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_UNFIX_VOID_TO_PRIVATE_MID, "Num_unfix_void_to_private_mid"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_UNFIX_VOID_TO_SHARED_MID, "Num_unfix_void_to_shared_mid"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_UNFIX_VOID_TO_PRIVATE_LRU3, "Num_unfix_void_to_private_lru3"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_UNFIX_VOID_TO_SHARED_LRU3, "Num_unfix_void_to_shared_lru3"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_UNFIX_LRU_ONE_PRV_TO_SHR_MID, "Num_unfix_lru1_private_to_shared_mid"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_UNFIX_LRU_TWO_PRV_TO_SHR_MID, "Num_unfix_lru2_private_to_shared_mid"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_UNFIX_LRU_THREE_PRV_TO_SHR_MID, "Num_unfix_lru3_private_to_shared_mid"),
@@ -467,6 +510,7 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_UNFIX_LRU_TWO_SHR_TO_TOP, "Num_unfix_lru2_shared_to_top"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_UNFIX_LRU_THREE_PRV_TO_TOP, "Num_unfix_lru3_private_to_top"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_UNFIX_LRU_THREE_SHR_TO_TOP, "Num_unfix_lru3_shared_to_top"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_UNFIX_LRU_THREE_KEEP, "Num_unfix_lru3_keep"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_UNFIX_LRU_ONE_PRV_KEEP, "Num_unfix_lru1_private_keep"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_UNFIX_LRU_ONE_SHR_KEEP, "Num_unfix_lru1_shared_keep"),
   /* vacuum */
@@ -482,6 +526,10 @@ PSTAT_METADATA pstat_Metadata[] = {
   /* hash anchor */
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_NUM_HASH_ANCHOR_WAITS, "Num_data_page_hash_anchor_waits"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_TIME_HASH_ANCHOR_WAIT, "Time_data_page_hash_anchor_wait"),
+  /* read-ahead */
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_READ_AHEAD_PAGES, "Num_data_page_read_ahead"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_READ_AHEAD_HITS, "Num_data_page_read_ahead_hits"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_READ_AHEAD_MISSES, "Num_data_page_read_ahead_misses"),
   /* flushing */
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_PB_FLUSH_COLLECT, "flush_collect"),
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_PB_FLUSH_FLUSH, "flush_flush"),
@@ -604,13 +652,24 @@ PSTAT_METADATA pstat_Metadata[] = {
 			       &f_dump_in_buffer_Num_dwb_flushed_block_volumes,
 			       &f_load_Num_dwb_flushed_block_volumes),
   PSTAT_METADATA_INIT_COMPLEX (PSTAT_LOAD_THREAD_STATS, "Thread_loaddb_stats_counters_timers",
-			       &f_dump_in_file_thread_stats, &f_dump_in_buffer_thread_stats, &f_load_thread_stats)
+			       &f_dump_in_file_thread_stats, &f_dump_in_buffer_thread_stats, &f_load_thread_stats),
+  PSTAT_METADATA_INIT_COMPLEX (PSTAT_LATENCY_HISTOGRAMS, "Latency_histograms", &f_dump_in_file_Latency_histograms,
+			       &f_dump_in_buffer_Latency_histograms, &f_load_Latency_histograms)
 };
 
 STATIC_INLINE void perfmon_add_stat_at_offset (THREAD_ENTRY * thread_p, PERF_STAT_ID psid, const int offset,
 					       UINT64 amount) __attribute__ ((ALWAYS_INLINE));
 
 static void perfmon_server_calc_stats (UINT64 * stats);
+#if defined (SERVER_MODE)
+static int perfmon_initialize_shards (void);
+static void perfmon_add_shard_stats (UINT64 * stats);
+#endif /* SERVER_MODE */
+#if defined (SERVER_MODE) || defined (SA_MODE)
+static int perfmon_initialize_latency_histograms (void);
+static void perfmon_get_latency_values (int histogram, UINT64 * values);
+static void perfmon_get_latency_stats (UINT64 * stats);
+#endif /* SERVER_MODE || SA_MODE */
 
 STATIC_INLINE const char *perfmon_stat_module_name (const int module) __attribute__ ((ALWAYS_INLINE));
 #if defined (SERVER_MODE) || defined (SA_MODE)
@@ -1014,6 +1073,10 @@ xperfmon_server_copy_global_stats (UINT64 * to_stats)
     {
       perfmon_get_peek_stats (pstat_Global.global_stats);
       perfmon_copy_values (to_stats, pstat_Global.global_stats);
+#if defined (SERVER_MODE)
+      perfmon_add_shard_stats (to_stats);
+#endif /* SERVER_MODE */
+      perfmon_get_latency_stats (to_stats);
       perfmon_server_calc_stats (to_stats);
     }
 }
@@ -1325,6 +1388,16 @@ perfmon_calc_diff_stats (UINT64 * stats_diff, UINT64 * new_stats, UINT64 * old_s
 
   for (i = 0; i < PSTAT_COUNT; i++)
     {
+      if (i == PSTAT_LATENCY_HISTOGRAMS)
+	{
+	  /* percentiles cannot be subtracted; keep the values since server start */
+	  for (j = pstat_Metadata[i].start_offset; j < pstat_Metadata[i].start_offset + pstat_Metadata[i].n_vals; j++)
+	    {
+	      stats_diff[j] = new_stats[j];
+	    }
+	  continue;
+	}
+
       switch (pstat_Metadata[i].valtype)
 	{
 	case PSTAT_ACCUMULATE_SINGLE_VALUE:
@@ -2996,6 +3069,11 @@ perfmon_initialize (int num_trans)
 
   pstat_Global.n_stat_values = 0;
   pstat_Global.global_stats = NULL;
+  pstat_Global.n_shards = 0;
+  pstat_Global.shard_n_values = 0;
+  pstat_Global.shard_stats = NULL;
+  pstat_Global.shard_stats_alloc = NULL;
+  pstat_Global.next_shard = 0;
   pstat_Global.n_trans = 0;
   pstat_Global.tran_stats = NULL;
   pstat_Global.is_watching = NULL;
@@ -3067,6 +3145,18 @@ perfmon_initialize (int num_trans)
     }
   memset (pstat_Global.global_stats, 0, PERFMON_VALUES_MEMSIZE);
 
+#if defined (SERVER_MODE)
+  if (perfmon_initialize_shards () != NO_ERROR)
+    {
+      goto error;
+    }
+#endif /* SERVER_MODE */
+
+  if (perfmon_initialize_latency_histograms () != NO_ERROR)
+    {
+      goto error;
+    }
+
   assert (num_trans > 0);
 
   pstat_Global.n_trans = num_trans + 1;	/* 1 more for easier indexing with tran_index */
@@ -3113,6 +3203,93 @@ error:
 #endif /* SERVER_MODE || SA_MODE */
 }
 
+#if defined (SERVER_MODE)
+/*
+ * perfmon_initialize_shards () - Allocate the shards of accumulated global statistics.
+ *
+ * return : NO_ERROR or ER_OUT_OF_VIRTUAL_MEMORY.
+ *
+ * NOTE: There is one shard for each core (up to PERFMON_MAX_SHARDS). Each shard starts on its own cache line.
+ */
+static int
+perfmon_initialize_shards (void)
+{
+  size_t memsize;
+  int n_shards;
+
+  n_shards = (int) std::thread::hardware_concurrency ();
+  if (n_shards > PERFMON_MAX_SHARDS)
+    {
+      n_shards = PERFMON_MAX_SHARDS;
+    }
+  if (n_shards <= 1)
+    {
+      /* keep accumulating to global values */
+      return NO_ERROR;
+    }
+
+  pstat_Global.shard_n_values = DB_ALIGN (pstat_Global.n_stat_values, PERFMON_CACHE_LINE_SIZE / sizeof (UINT64));
+  memsize = (size_t) n_shards * pstat_Global.shard_n_values * sizeof (UINT64);
+
+  pstat_Global.shard_stats_alloc = malloc (memsize + PERFMON_CACHE_LINE_SIZE);
+  if (pstat_Global.shard_stats_alloc == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, memsize + PERFMON_CACHE_LINE_SIZE);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+  pstat_Global.shard_stats = (UINT64 *) PTR_ALIGN (pstat_Global.shard_stats_alloc, PERFMON_CACHE_LINE_SIZE);
+  memset (pstat_Global.shard_stats, 0, memsize);
+
+  pstat_Global.n_shards = n_shards;
+  pstat_Global.next_shard = 0;
+
+  return NO_ERROR;
+}
+
+/*
+ * perfmon_assign_shard () - Assign a shard to current thread.
+ *
+ * return : Shard index.
+ *
+ * NOTE: Shards are assigned round robin. A thread keeps its shard for its lifetime; threads of worker pools and daemons
+ *       are long lived, so they end up spread evenly over shards.
+ */
+int
+perfmon_assign_shard (void)
+{
+  INT32 next;
+
+  assert (pstat_Global.n_shards > 0);
+
+  next = ATOMIC_INC_32 (&pstat_Global.next_shard, 1);
+  return (int) ((UINT32) next % (UINT32) pstat_Global.n_shards);
+}
+
+/*
+ * perfmon_add_shard_stats () - Add accumulated values of all shards to statistics.
+ *
+ * return      : Void.
+ * stats (in/out) : Statistics array, a copy of global values.
+ *
+ * NOTE: Shards have non-zero values only for accumulated values, that are never changed in global values.
+ */
+static void
+perfmon_add_shard_stats (UINT64 * stats)
+{
+  UINT64 *shard_values;
+  int shard, i;
+
+  for (shard = 0; shard < pstat_Global.n_shards; shard++)
+    {
+      shard_values = pstat_Global.shard_stats + (size_t) shard * pstat_Global.shard_n_values;
+      for (i = 0; i < pstat_Global.n_stat_values; i++)
+	{
+	  stats[i] += ATOMIC_LOAD_64 (&shard_values[i]);
+	}
+    }
+}
+#endif /* SERVER_MODE */
+
 /*
  * perfmon_finalize () - Frees all the allocated memory for performance monitor data structures
  *
@@ -3138,6 +3315,12 @@ perfmon_finalize (void)
     {
       free_and_init (pstat_Global.global_stats);
     }
+  if (pstat_Global.shard_stats_alloc != NULL)
+    {
+      free_and_init (pstat_Global.shard_stats_alloc);
+      pstat_Global.shard_stats = NULL;
+      pstat_Global.n_shards = 0;
+    }
 #if defined (SERVER_MODE) || defined (SA_MODE)
 #if !defined (HAVE_ATOMIC_BUILTINS)
   pthread_mutex_destroy (&pstat_Global.watch_lock);
@@ -3337,6 +3520,16 @@ f_load_Num_dwb_flushed_block_volumes (void)
   return PERF_DWB_FLUSHED_BLOCK_VOLUMES_CNT;
 }
 
+/*
+ * f_load_Latency_histograms () - Get the number of values for Latency_histograms statistic
+ *
+ */
+static int
+f_load_Latency_histograms (void)
+{
+  return PERFMON_LATENCY_CNT * PERFMON_LATENCY_VALUE_CNT;
+}
+
 /*
  * f_load_Time_get_snapshot_acquire_time () - Get the number of values for Time_get_snapshot_acquire_time statistic
  *
@@ -3525,6 +3718,36 @@ f_dump_in_file_Num_dwb_flushed_block_volumes (FILE * f, const UINT64 * stat_vals
     }
 }
 
+/*
+ * f_dump_in_file_Latency_histograms () - Write in file the values for Latency_histograms statistic
+ * f (out): File handle
+ * stat_vals (in): statistics buffer
+ *
+ */
+static void
+f_dump_in_file_Latency_histograms (FILE * f, const UINT64 * stat_vals)
+{
+  const UINT64 *values;
+  int type;
+
+  for (type = 0; type < PERFMON_LATENCY_CNT; type++)
+    {
+      values = stat_vals + type * PERFMON_LATENCY_VALUE_CNT;
+      if (values[PERFMON_LATENCY_VALUE_COUNT] == 0)
+	{
+	  continue;
+	}
+
+      fprintf (f, "%-14s count = %10llu, p50 = %8llu, p90 = %8llu, p99 = %8llu, p99.9 = %8llu, max = %8llu (usec)\n",
+	       perfmon_Latency_names[type], (unsigned long long) values[PERFMON_LATENCY_VALUE_COUNT],
+	       (unsigned long long) values[PERFMON_LATENCY_VALUE_P50],
+	       (unsigned long long) values[PERFMON_LATENCY_VALUE_P90],
+	       (unsigned long long) values[PERFMON_LATENCY_VALUE_P99],
+	       (unsigned long long) values[PERFMON_LATENCY_VALUE_P999],
+	       (unsigned long long) values[PERFMON_LATENCY_VALUE_MAX]);
+    }
+}
+
 /*
  * f_dump_in_buffer_Num_data_page_fix_ext () - Write to a buffer the values for Num_data_page_fix_ext
  *					       statistic
@@ -3677,6 +3900,53 @@ f_dump_in_buffer_Num_dwb_flushed_block_volumes (char **s, const UINT64 * stat_va
     }
 }
 
+/*
+ * f_dump_in_buffer_Latency_histograms () - Write to a buffer the values for Latency_histograms statistic
+ * s (out): Buffer to write to
+ * stat_vals (in): statistics buffer
+ * remaining_size (in): size of input buffer
+ *
+ */
+static void
+f_dump_in_buffer_Latency_histograms (char **s, const UINT64 * stat_vals, int *remaining_size)
+{
+  const UINT64 *values;
+  int type;
+  int ret;
+
+  assert (remaining_size != NULL);
+  assert (s != NULL);
+
+  if (*s == NULL)
+    {
+      return;
+    }
+
+  for (type = 0; type < PERFMON_LATENCY_CNT; type++)
+    {
+      values = stat_vals + type * PERFMON_LATENCY_VALUE_CNT;
+      if (values[PERFMON_LATENCY_VALUE_COUNT] == 0)
+	{
+	  continue;
+	}
+
+      ret = snprintf (*s, *remaining_size,
+		      "%-14s count = %10llu, p50 = %8llu, p90 = %8llu, p99 = %8llu, p99.9 = %8llu, max = %8llu (usec)\n",
+		      perfmon_Latency_names[type], (unsigned long long) values[PERFMON_LATENCY_VALUE_COUNT],
+		      (unsigned long long) values[PERFMON_LATENCY_VALUE_P50],
+		      (unsigned long long) values[PERFMON_LATENCY_VALUE_P90],
+		      (unsigned long long) values[PERFMON_LATENCY_VALUE_P99],
+		      (unsigned long long) values[PERFMON_LATENCY_VALUE_P999],
+		      (unsigned long long) values[PERFMON_LATENCY_VALUE_MAX]);
+      *remaining_size -= ret;
+      *s += ret;
+      if (*remaining_size <= 0)
+	{
+	  return;
+	}
+    }
+}
+
 /*
  * perfmon_get_number_of_statistic_values () - Get the number of entries in the statistic array
  *
@@ -4267,5 +4537,212 @@ perfmon_er_log_current_stats (THREAD_ENTRY * thread_p)
 
   delete strbuf;
 }
+
+/*
+ * perfmon_initialize_latency_histograms () - Create latency histograms and register them to global monitor.
+ *
+ * return : NO_ERROR or ER_OUT_OF_VIRTUAL_MEMORY.
+ *
+ * NOTE: Histograms are created once and kept for process lifetime, since global monitor keeps references to them.
+ */
+static int
+perfmon_initialize_latency_histograms (void)
+{
+  using histogram_type = cubmonitor::histogram_atomic_statistic;
+
+  if (perfmon_Latency_histograms != NULL)
+    {
+      return NO_ERROR;
+    }
+
+  perfmon_Latency_histograms = new (std::nothrow) histogram_type[PERFMON_LATENCY_HISTOGRAM_CNT];
+  if (perfmon_Latency_histograms == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+	      (size_t) PERFMON_LATENCY_HISTOGRAM_CNT * sizeof (histogram_type));
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  for (int type = 0; type < PERFMON_LATENCY_CNT; type++)
+    {
+      std::vector<std::string> names;
+
+      names.reserve (histogram_type::BUCKET_COUNT);
+      for (std::size_t bucket = 0; bucket < histogram_type::BUCKET_COUNT; bucket++)
+	{
+	  names.push_back (std::string ("Latency_") + perfmon_Latency_names[type] + "_le_"
+			   + std::to_string (histogram_type::get_bucket_value (bucket)));
+	}
+      cubmonitor::get_global_monitor ().register_statistics (perfmon_Latency_histograms[type], names);
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * perfmon_add_latency () - Collect a latency to its histogram.
+ *
+ * return	     : Void.
+ * type (in)	     : Latency type.
+ * elapsed_usec (in) : Latency in microseconds.
+ */
+void
+perfmon_add_latency (PERFMON_LATENCY_TYPE type, UINT64 elapsed_usec)
+{
+  assert (type >= 0 && type < PERFMON_LATENCY_CNT);
+
+  if (perfmon_Latency_histograms == NULL)
+    {
+      return;
+    }
+  perfmon_Latency_histograms[type].collect (elapsed_usec);
+}
+
+/*
+ * perfmon_add_request_latency () - Collect execution time of a server request to its histogram and to the histogram
+ *				    of all requests.
+ *
+ * return	     : Void.
+ * request (in)	     : Server request.
+ * elapsed_usec (in) : Execution time in microseconds.
+ */
+void
+perfmon_add_request_latency (int request, UINT64 elapsed_usec)
+{
+  assert (request > NET_SERVER_REQUEST_START && request < NET_SERVER_REQUEST_END);
+
+  if (perfmon_Latency_histograms == NULL)
+    {
+      return;
+    }
+  perfmon_Latency_histograms[PERFMON_LATENCY_REQUESTS].collect (elapsed_usec);
+  perfmon_Latency_histograms[PERFMON_LATENCY_CNT + request].collect (elapsed_usec);
+}
+
+/*
+ * perfmon_get_latency_values () - Compute count, percentiles and maximum of a latency histogram.
+ *
+ * return	  : Void.
+ * histogram (in) : Histogram index.
+ * values (out)	  : PERFMON_LATENCY_VALUE_CNT values.
+ */
+static void
+perfmon_get_latency_values (int histogram, UINT64 * values)
+{
+  using histogram_type = cubmonitor::histogram_atomic_statistic;
+  cubmonitor::statistic_value buckets[histogram_type::BUCKET_COUNT];
+
+  assert (histogram >= 0 && histogram < PERFMON_LATENCY_HISTOGRAM_CNT);
+
+  perfmon_Latency_histograms[histogram].fetch (buckets);
+
+  values[PERFMON_LATENCY_VALUE_COUNT] = histogram_type::get_total_count (buckets);
+  values[PERFMON_LATENCY_VALUE_P50] = histogram_type::get_percentile (buckets, 50.0);
+  values[PERFMON_LATENCY_VALUE_P90] = histogram_type::get_percentile (buckets, 90.0);
+  values[PERFMON_LATENCY_VALUE_P99] = histogram_type::get_percentile (buckets, 99.0);
+  values[PERFMON_LATENCY_VALUE_P999] = histogram_type::get_percentile (buckets, 99.9);
+  values[PERFMON_LATENCY_VALUE_MAX] = perfmon_Latency_histograms[histogram].get_max ();
+}
+
+/*
+ * perfmon_get_latency_stats () - Set latency histograms values in statistics.
+ *
+ * return	  : Void.
+ * stats (in/out) : Statistics array.
+ */
+static void
+perfmon_get_latency_stats (UINT64 * stats)
+{
+  UINT64 *values = stats + pstat_Metadata[PSTAT_LATENCY_HISTOGRAMS].start_offset;
+
+  if (perfmon_Latency_histograms == NULL)
+    {
+      return;
+    }
+
+  for (int type = 0; type < PERFMON_LATENCY_CNT; type++)
+    {
+      perfmon_get_latency_values (type, values + type * PERFMON_LATENCY_VALUE_CNT);
+    }
+}
+
+/*
+ * perfmon_latency_start_scan () - start scan function for show latency histograms
+ *   return: NO_ERROR, or ER_code
+ *
+ *   thread_p(in):
+ *   type (in):
+ *   arg_values(in):
+ *   arg_cnt(in):
+ *   ptr(in/out):
+ */
+int
+perfmon_latency_start_scan (THREAD_ENTRY * thread_p, int type, DB_VALUE ** arg_values, int arg_cnt, void **ptr)
+{
+  SHOWSTMT_ARRAY_CONTEXT *ctx = NULL;
+  const int num_cols = 7;
+  UINT64 values[PERFMON_LATENCY_VALUE_CNT];
+  DB_VALUE *vals = NULL;
+  const char *name;
+  int histogram, idx;
+  int error = NO_ERROR;
+
+  *ptr = NULL;
+
+  ctx = showstmt_alloc_array_context (thread_p, PERFMON_LATENCY_HISTOGRAM_CNT, num_cols);
+  if (ctx == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error);
+      return error;
+    }
+
+  for (histogram = 0; histogram < PERFMON_LATENCY_HISTOGRAM_CNT && perfmon_Latency_histograms != NULL; histogram++)
+    {
+      if (histogram < PERFMON_LATENCY_CNT)
+	{
+	  name = perfmon_Latency_names[histogram];
+	}
+      else if (histogram - PERFMON_LATENCY_CNT > NET_SERVER_REQUEST_START)
+	{
+#if defined (SERVER_MODE)
+	  name = net_server_request_name (histogram - PERFMON_LATENCY_CNT);
+#else
+	  // no requests in stand-alone mode
+	  break;
+#endif
+	}
+      else
+	{
+	  continue;
+	}
+
+      perfmon_get_latency_values (histogram, values);
+      if (values[PERFMON_LATENCY_VALUE_COUNT] == 0)
+	{
+	  continue;
+	}
+
+      vals = showstmt_alloc_tuple_in_context (thread_p, ctx);
+      if (vals == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error);
+	  showstmt_free_array_context (thread_p, ctx);
+	  return error;
+	}
+
+      idx = 0;
+      db_make_string (&vals[idx], name);
+      idx++;
+      for (int value = PERFMON_LATENCY_VALUE_COUNT; value < PERFMON_LATENCY_VALUE_CNT; value++)
+	{
+	  db_make_bigint (&vals[idx], (DB_BIGINT) values[value]);
+	  idx++;
+	}
+      assert (idx == num_cols);
+    }
+
+  *ptr = ctx;
+  return NO_ERROR;
+}
 #endif // SERVER_MODE || SA_MODE
 // *INDENT-ON*
@@ -532,6 +532,8 @@ typedef enum
   PSTAT_PB_UNFIX_VOID_TO_PRIVATE_TOP,
   PSTAT_PB_UNFIX_VOID_TO_PRIVATE_MID,
   PSTAT_PB_UNFIX_VOID_TO_SHARED_MID,
+  PSTAT_PB_UNFIX_VOID_TO_PRIVATE_LRU3,
+  PSTAT_PB_UNFIX_VOID_TO_SHARED_LRU3,
   PSTAT_PB_UNFIX_LRU_ONE_PRV_TO_SHR_MID,
   PSTAT_PB_UNFIX_LRU_TWO_PRV_TO_SHR_MID,
   PSTAT_PB_UNFIX_LRU_THREE_PRV_TO_SHR_MID,
@@ -541,6 +543,7 @@ typedef enum
   PSTAT_PB_UNFIX_LRU_TWO_SHR_TO_TOP,
   PSTAT_PB_UNFIX_LRU_THREE_PRV_TO_TOP,
   PSTAT_PB_UNFIX_LRU_THREE_SHR_TO_TOP,
+  PSTAT_PB_UNFIX_LRU_THREE_KEEP,
   PSTAT_PB_UNFIX_LRU_ONE_PRV_KEEP,
   PSTAT_PB_UNFIX_LRU_ONE_SHR_KEEP,
   /* vacuum */
@@ -556,6 +559,10 @@ typedef enum
   /* hash anchor */
   PSTAT_PB_NUM_HASH_ANCHOR_WAITS,
   PSTAT_PB_TIME_HASH_ANCHOR_WAIT,
+  /* read-ahead */
+  PSTAT_PB_READ_AHEAD_PAGES,
+  PSTAT_PB_READ_AHEAD_HITS,
+  PSTAT_PB_READ_AHEAD_MISSES,
   /* flushing */
   PSTAT_PB_FLUSH_COLLECT,
   PSTAT_PB_FLUSH_FLUSH,
@@ -648,10 +655,21 @@ typedef enum
   PSTAT_THREAD_DAEMON_STATS,
   PSTAT_DWB_FLUSHED_BLOCK_NUM_VOLUMES,
   PSTAT_LOAD_THREAD_STATS,
+  PSTAT_LATENCY_HISTOGRAMS,
 
   PSTAT_COUNT
 } PERF_STAT_ID;
 
+/* Latency histograms, besides the histograms of each server request */
+typedef enum
+{
+  PERFMON_LATENCY_REQUESTS,	/* execution of all server requests */
+  PERFMON_LATENCY_PGBUF_FIX_WAIT,	/* page fixes that had to wait for latch or for page read */
+  PERFMON_LATENCY_LOCK_WAIT,	/* object lock waits */
+
+  PERFMON_LATENCY_CNT
+} PERFMON_LATENCY_TYPE;
+
 /* All globals on statistics will be here. */
 typedef struct pstat_global PSTAT_GLOBAL;
 struct pstat_global
@@ -660,6 +678,15 @@ struct pstat_global
 
   UINT64 *global_stats;
 
+  /* accumulated values (accumulators, timer counts and total times) are not added to global_stats, but to one of
+   * n_shards arrays of shard_n_values. each thread is assigned a shard, so concurrent threads do not fight for the
+   * cache lines of global_stats. the shards are added to global values only when these are copied. */
+  int n_shards;
+  int shard_n_values;		/* n_stat_values padded to cache line size */
+  UINT64 *shard_stats;
+  void *shard_stats_alloc;	/* shard_stats before alignment to cache line */
+  INT32 next_shard;
+
   int n_trans;
   UINT64 **tran_stats;
 
@@ -676,6 +703,10 @@ struct pstat_global
 
 extern PSTAT_GLOBAL pstat_Global;
 
+#if defined (SERVER_MODE)
+extern thread_local int perfmon_Shard_index;	/* shard of current thread; -1 if not yet assigned */
+#endif /* SERVER_MODE */
+
 typedef enum
 {
   PSTAT_ACCUMULATE_SINGLE_VALUE,	/* A single accumulator value. */
@@ -821,11 +852,19 @@ extern int perfmon_get_number_of_statistic_values (void);
 extern UINT64 *perfmon_allocate_values (void);
 extern char *perfmon_allocate_packed_values_buffer (void);
 extern void perfmon_copy_values (UINT64 * src, UINT64 * dest);
+#if defined (SERVER_MODE)
+extern int perfmon_assign_shard (void);
+#endif /* SERVER_MODE */
 
 #if defined (SERVER_MODE) || defined (SA_MODE)
 extern void perfmon_start_watch (THREAD_ENTRY * thread_p);
 extern void perfmon_stop_watch (THREAD_ENTRY * thread_p);
 extern void perfmon_er_log_current_stats (THREAD_ENTRY * thread_p);
+
+extern void perfmon_add_latency (PERFMON_LATENCY_TYPE type, UINT64 elapsed_usec);
+extern void perfmon_add_request_latency (int request, UINT64 elapsed_usec);
+extern int perfmon_latency_start_scan (THREAD_ENTRY * thread_p, int type, DB_VALUE ** arg_values, int arg_cnt,
+				       void **ptr);
 #endif /* SERVER_MODE || SA_MODE */
 
 STATIC_INLINE bool perfmon_is_perf_tracking (void) __attribute__ ((ALWAYS_INLINE));
@@ -834,6 +873,7 @@ STATIC_INLINE bool perfmon_is_perf_tracking_force (bool always_collect) __attrib
 STATIC_INLINE void perfmon_add_stat (THREAD_ENTRY * thread_p, PERF_STAT_ID psid, UINT64 amount)
   __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE void perfmon_add_stat_to_global (PERF_STAT_ID psid, UINT64 amount) __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE UINT64 *perfmon_get_shard_values (void) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE void perfmon_add_at_offset (THREAD_ENTRY * thread_p, int offset, UINT64 amount)
   __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE void perfmon_inc_stat (THREAD_ENTRY * thread_p, PERF_STAT_ID psid) __attribute__ ((ALWAYS_INLINE));
@@ -941,6 +981,28 @@ perfmon_inc_stat_to_global (PERF_STAT_ID psid)
   perfmon_add_stat_to_global (psid, 1);
 }
 
+/*
+ * perfmon_get_shard_values () - Get the values where current thread accumulates global statistics.
+ *
+ * return	 : The shard values of current thread or global values if statistics are not sharded.
+ */
+STATIC_INLINE UINT64 *
+perfmon_get_shard_values (void)
+{
+#if defined (SERVER_MODE)
+  if (pstat_Global.shard_stats != NULL)
+    {
+      if (perfmon_Shard_index < 0)
+	{
+	  perfmon_Shard_index = perfmon_assign_shard ();
+	}
+      return pstat_Global.shard_stats + (size_t) perfmon_Shard_index * pstat_Global.shard_n_values;
+    }
+#endif /* SERVER_MODE */
+
+  return pstat_Global.global_stats;
+}
+
 /*
  * perfmon_add_at_offset () - Add amount to statistic in global/local at offset.
  *
@@ -960,7 +1022,7 @@ perfmon_add_at_offset (THREAD_ENTRY * thread_p, int offset, UINT64 amount)
   assert (pstat_Global.initialized);
 
   /* Update global statistic. */
-  ATOMIC_INC_64 (&(pstat_Global.global_stats[offset]), amount);
+  ATOMIC_INC_64 (&(perfmon_get_shard_values ()[offset]), amount);
 
 #if defined (SERVER_MODE) || defined (SA_MODE)
   /* Update local statistic */
@@ -988,7 +1050,7 @@ perfmon_add_at_offset_to_global (int offset, UINT64 amount)
   assert (pstat_Global.initialized);
 
   /* Update global statistic. */
-  ATOMIC_INC_64 (&(pstat_Global.global_stats[offset]), amount);
+  ATOMIC_INC_64 (&(perfmon_get_shard_values ()[offset]), amount);
 }
 
 /*
@@ -1131,10 +1193,11 @@ perfmon_time_at_offset (THREAD_ENTRY * thread_p, int offset, UINT64 timediff)
   assert (offset >= 0 && offset < pstat_Global.n_stat_values);
   assert (pstat_Global.initialized);
 
-  /* Update global statistics. */
-  statvalp = pstat_Global.global_stats + offset;
+  /* Update global statistics. Max time is rarely changed and is kept in global values. */
+  statvalp = perfmon_get_shard_values () + offset;
   ATOMIC_INC_64 (PSTAT_COUNTER_TIMER_COUNT_VALUE (statvalp), 1ULL);
   ATOMIC_INC_64 (PSTAT_COUNTER_TIMER_TOTAL_TIME_VALUE (statvalp), timediff);
+  statvalp = pstat_Global.global_stats + offset;
   do
     {
       max_time = ATOMIC_LOAD_64 (PSTAT_COUNTER_TIMER_MAX_TIME_VALUE (statvalp));
@@ -1219,10 +1282,11 @@ perfmon_time_bulk_at_offset (THREAD_ENTRY * thread_p, int offset, UINT64 timedif
     }
   time_per_unit = timediff / count;
 
-  /* Update global statistics. */
-  statvalp = pstat_Global.global_stats + offset;
+  /* Update global statistics. Max time is rarely changed and is kept in global values. */
+  statvalp = perfmon_get_shard_values () + offset;
   ATOMIC_INC_64 (PSTAT_COUNTER_TIMER_COUNT_VALUE (statvalp), count);
   ATOMIC_INC_64 (PSTAT_COUNTER_TIMER_TOTAL_TIME_VALUE (statvalp), timediff);
+  statvalp = pstat_Global.global_stats + offset;
   do
     {
       max_time = ATOMIC_LOAD_64 (PSTAT_COUNTER_TIMER_MAX_TIME_VALUE (statvalp));
@@ -691,6 +691,20 @@ static const char sysprm_ha_conf_file_name[] = "cubrid_ha.conf";
 
 #define PRM_NAME_DDL_AUDIT_LOG "ddl_audit_log"
 #define PRM_NAME_DDL_AUDIT_LOG_SIZE "ddl_audit_log_size"
+#define PRM_NAME_OPTIMIZER_ENABLE_HASH_JOIN "optimizer_enable_hash_join"
+#define PRM_NAME_RECOVERY_PARALLEL_COUNT "recovery_parallel_count"
+#define PRM_NAME_DATA_BUFFER_READ_AHEAD_PAGES "data_buffer_read_ahead_pages"
+#define PRM_NAME_PARALLEL_HEAP_SCAN_WORKER_COUNT "parallel_heap_scan_worker_count"
+#define PRM_NAME_SORT_PARALLEL_COUNT "sort_parallel_count"
+#define PRM_NAME_INDEX_LOAD_WORKER_COUNT "index_load_worker_count"
+#define PRM_NAME_PB_REPLACEMENT_POLICY "data_buffer_replacement_policy"
+#define PRM_NAME_CSS_EVENT_LOOP_COUNT "connection_event_loop_count"
+#define PRM_NAME_CURSOR_FETCH_PAGES "cursor_fetch_pages"
+#define PRM_NAME_QUERY_MEMORY_POOL_SIZE "query_memory_pool_size"
+#define PRM_NAME_MVCC_CSN_SNAPSHOT "mvcc_csn_snapshot"
+#define PRM_NAME_LK_FAST_PATH_INTENTION_LOCKS "lock_fast_path_intention_locks"
+#define PRM_NAME_QUERY_ARENA_SIZE "query_arena_size"
+#define PRM_NAME_HEAP_SCAN_BATCH_SIZE "heap_scan_batch_size"
 
 #define PRM_VALUE_DEFAULT "DEFAULT"
 #define PRM_VALUE_MAX "MAX"
@@ -2344,6 +2358,84 @@ static UINT64 prm_ddl_audit_log_size_lower = 10485760ULL;	/* 10M */
 static UINT64 prm_ddl_audit_log_size_upper = 2147483648ULL;	/* 2G */
 static unsigned int prm_ddl_audit_log_size_flag = 0;
 
+bool PRM_OPTIMIZER_ENABLE_HASH_JOIN = true;
+static bool prm_optimizer_enable_hash_join_default = true;
+static unsigned int prm_optimizer_enable_hash_join_flag = 0;
+
+int PRM_RECOVERY_PARALLEL_COUNT = 8;
+static int prm_recovery_parallel_count_default = 8;
+static int prm_recovery_parallel_count_lower = 0;
+static int prm_recovery_parallel_count_upper = 64;
+static unsigned int prm_recovery_parallel_count_flag = 0;
+
+int PRM_DATA_BUFFER_READ_AHEAD_PAGES = 32;
+static int prm_data_buffer_read_ahead_pages_default = 32;
+static int prm_data_buffer_read_ahead_pages_lower = 0;
+static int prm_data_buffer_read_ahead_pages_upper = 1024;
+static unsigned int prm_data_buffer_read_ahead_pages_flag = 0;
+
+int PRM_PARALLEL_HEAP_SCAN_WORKER_COUNT = 0;
+static int prm_parallel_heap_scan_worker_count_default = 0;
+static int prm_parallel_heap_scan_worker_count_lower = 0;
+static int prm_parallel_heap_scan_worker_count_upper = 64;
+static unsigned int prm_parallel_heap_scan_worker_count_flag = 0;
+
+int PRM_SORT_PARALLEL_COUNT = 0;
+static int prm_sort_parallel_count_default = 0;
+static int prm_sort_parallel_count_lower = 0;
+static int prm_sort_parallel_count_upper = 64;
+static unsigned int prm_sort_parallel_count_flag = 0;
+
+int PRM_INDEX_LOAD_WORKER_COUNT = 0;
+static int prm_index_load_worker_count_default = 0;
+static int prm_index_load_worker_count_lower = 0;
+static int prm_index_load_worker_count_upper = 64;
+static unsigned int prm_index_load_worker_count_flag = 0;
+
+int PRM_PB_REPLACEMENT_POLICY = 0;
+static int prm_pb_replacement_policy_default = 0;
+static int prm_pb_replacement_policy_lower = 0;
+static int prm_pb_replacement_policy_upper = 1;
+static unsigned int prm_pb_replacement_policy_flag = 0;
+
+int PRM_CSS_EVENT_LOOP_COUNT = 0;
+static int prm_css_event_loop_count_default = 0;
+static int prm_css_event_loop_count_lower = 0;
+static int prm_css_event_loop_count_upper = 16;
+static unsigned int prm_css_event_loop_count_flag = 0;
+
+int PRM_CURSOR_FETCH_PAGES = 8;
+static int prm_cursor_fetch_pages_default = 8;
+static int prm_cursor_fetch_pages_lower = 1;
+static int prm_cursor_fetch_pages_upper = 256;
+static unsigned int prm_cursor_fetch_pages_flag = 0;
+
+UINT64 PRM_QUERY_MEMORY_POOL_SIZE = 0;
+static UINT64 prm_query_memory_pool_size_default = 0;	/* no limit */
+static UINT64 prm_query_memory_pool_size_lower = 0;
+static UINT64 prm_query_memory_pool_size_upper = 64ULL * 1024 * 1024 * 1024;	/* 64 GB */
+static unsigned int prm_query_memory_pool_size_flag = 0;
+
+bool PRM_MVCC_CSN_SNAPSHOT = false;
+static bool prm_mvcc_csn_snapshot_default = false;
+static unsigned int prm_mvcc_csn_snapshot_flag = 0;
+
+bool PRM_LK_FAST_PATH_INTENTION_LOCKS = true;
+static bool prm_lk_fast_path_intention_locks_default = true;
+static unsigned int prm_lk_fast_path_intention_locks_flag = 0;
+
+UINT64 PRM_QUERY_ARENA_SIZE = 0;
+static UINT64 prm_query_arena_size_default = 0;	/* disabled */
+static UINT64 prm_query_arena_size_lower = 0;
+static UINT64 prm_query_arena_size_upper = 64 * 1024 * 1024;	/* 64 MB */
+static unsigned int prm_query_arena_size_flag = 0;
+
+int PRM_HEAP_SCAN_BATCH_SIZE = 0;
+static int prm_heap_scan_batch_size_default = 0;	/* disabled */
+static int prm_heap_scan_batch_size_lower = 0;
+static int prm_heap_scan_batch_size_upper = 4096;
+static unsigned int prm_heap_scan_batch_size_flag = 0;
+
 typedef int (*DUP_PRM_FUNC) (void *, SYSPRM_DATATYPE, void *, SYSPRM_DATATYPE);
 
 static int prm_size_to_io_pages (void *out_val, SYSPRM_DATATYPE out_type, void *in_val, SYSPRM_DATATYPE in_type);
@@ -6036,6 +6128,171 @@ static SYSPRM_PARAM prm_Def[] = {
    (void *) &prm_ddl_audit_log_size_lower,
    (char *) NULL,
    (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_OPTIMIZER_ENABLE_HASH_JOIN,
+   PRM_NAME_OPTIMIZER_ENABLE_HASH_JOIN,
+   (PRM_FOR_CLIENT | PRM_USER_CHANGE),
+   PRM_BOOLEAN,
+   &prm_optimizer_enable_hash_join_flag,
+   (void *) &prm_optimizer_enable_hash_join_default,
+   (void *) &PRM_OPTIMIZER_ENABLE_HASH_JOIN,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_RECOVERY_PARALLEL_COUNT,
+   PRM_NAME_RECOVERY_PARALLEL_COUNT,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_recovery_parallel_count_flag,
+   (void *) &prm_recovery_parallel_count_default,
+   (void *) &PRM_RECOVERY_PARALLEL_COUNT,
+   (void *) &prm_recovery_parallel_count_upper,
+   (void *) &prm_recovery_parallel_count_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_DATA_BUFFER_READ_AHEAD_PAGES,
+   PRM_NAME_DATA_BUFFER_READ_AHEAD_PAGES,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_data_buffer_read_ahead_pages_flag,
+   (void *) &prm_data_buffer_read_ahead_pages_default,
+   (void *) &PRM_DATA_BUFFER_READ_AHEAD_PAGES,
+   (void *) &prm_data_buffer_read_ahead_pages_upper,
+   (void *) &prm_data_buffer_read_ahead_pages_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PARALLEL_HEAP_SCAN_WORKER_COUNT,
+   PRM_NAME_PARALLEL_HEAP_SCAN_WORKER_COUNT,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_parallel_heap_scan_worker_count_flag,
+   (void *) &prm_parallel_heap_scan_worker_count_default,
+   (void *) &PRM_PARALLEL_HEAP_SCAN_WORKER_COUNT,
+   (void *) &prm_parallel_heap_scan_worker_count_upper,
+   (void *) &prm_parallel_heap_scan_worker_count_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_SORT_PARALLEL_COUNT,
+   PRM_NAME_SORT_PARALLEL_COUNT,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_sort_parallel_count_flag,
+   (void *) &prm_sort_parallel_count_default,
+   (void *) &PRM_SORT_PARALLEL_COUNT,
+   (void *) &prm_sort_parallel_count_upper,
+   (void *) &prm_sort_parallel_count_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_INDEX_LOAD_WORKER_COUNT,
+   PRM_NAME_INDEX_LOAD_WORKER_COUNT,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_index_load_worker_count_flag,
+   (void *) &prm_index_load_worker_count_default,
+   (void *) &PRM_INDEX_LOAD_WORKER_COUNT,
+   (void *) &prm_index_load_worker_count_upper,
+   (void *) &prm_index_load_worker_count_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_REPLACEMENT_POLICY,
+   PRM_NAME_PB_REPLACEMENT_POLICY,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_pb_replacement_policy_flag,
+   (void *) &prm_pb_replacement_policy_default,
+   (void *) &PRM_PB_REPLACEMENT_POLICY,
+   (void *) &prm_pb_replacement_policy_upper,
+   (void *) &prm_pb_replacement_policy_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_CSS_EVENT_LOOP_COUNT,
+   PRM_NAME_CSS_EVENT_LOOP_COUNT,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_css_event_loop_count_flag,
+   (void *) &prm_css_event_loop_count_default,
+   (void *) &PRM_CSS_EVENT_LOOP_COUNT,
+   (void *) &prm_css_event_loop_count_upper,
+   (void *) &prm_css_event_loop_count_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_CURSOR_FETCH_PAGES,
+   PRM_NAME_CURSOR_FETCH_PAGES,
+   (PRM_FOR_CLIENT | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_cursor_fetch_pages_flag,
+   (void *) &prm_cursor_fetch_pages_default,
+   (void *) &PRM_CURSOR_FETCH_PAGES,
+   (void *) &prm_cursor_fetch_pages_upper,
+   (void *) &prm_cursor_fetch_pages_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_QUERY_MEMORY_POOL_SIZE,
+   PRM_NAME_QUERY_MEMORY_POOL_SIZE,
+   (PRM_FOR_SERVER | PRM_SIZE_UNIT),
+   PRM_BIGINT,
+   &prm_query_memory_pool_size_flag,
+   (void *) &prm_query_memory_pool_size_default,
+   (void *) &PRM_QUERY_MEMORY_POOL_SIZE,
+   (void *) &prm_query_memory_pool_size_upper,
+   (void *) &prm_query_memory_pool_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_MVCC_CSN_SNAPSHOT,
+   PRM_NAME_MVCC_CSN_SNAPSHOT,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_mvcc_csn_snapshot_flag,
+   (void *) &prm_mvcc_csn_snapshot_default,
+   (void *) &PRM_MVCC_CSN_SNAPSHOT,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_LK_FAST_PATH_INTENTION_LOCKS,
+   PRM_NAME_LK_FAST_PATH_INTENTION_LOCKS,
+   (PRM_FOR_SERVER | PRM_HIDDEN),
+   PRM_BOOLEAN,
+   &prm_lk_fast_path_intention_locks_flag,
+   (void *) &prm_lk_fast_path_intention_locks_default,
+   (void *) &PRM_LK_FAST_PATH_INTENTION_LOCKS,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_QUERY_ARENA_SIZE,
+   PRM_NAME_QUERY_ARENA_SIZE,
+   (PRM_FOR_SERVER | PRM_SIZE_UNIT),
+   PRM_BIGINT,
+   &prm_query_arena_size_flag,
+   (void *) &prm_query_arena_size_default,
+   (void *) &PRM_QUERY_ARENA_SIZE,
+   (void *) &prm_query_arena_size_upper,
+   (void *) &prm_query_arena_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_HEAP_SCAN_BATCH_SIZE,
+   PRM_NAME_HEAP_SCAN_BATCH_SIZE,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_heap_scan_batch_size_flag,
+   (void *) &prm_heap_scan_batch_size_default,
+   (void *) &PRM_HEAP_SCAN_BATCH_SIZE,
+   (void *) &prm_heap_scan_batch_size_upper,
+   (void *) &prm_heap_scan_batch_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
    (DUP_PRM_FUNC) NULL}
 };
 
@@ -452,8 +452,22 @@ enum param_id
   PRM_ID_IGNORE_TRAILING_SPACE,
   PRM_ID_DDL_AUDIT_LOG,
   PRM_ID_DDL_AUDIT_LOG_SIZE,
+  PRM_ID_OPTIMIZER_ENABLE_HASH_JOIN,
+  PRM_ID_RECOVERY_PARALLEL_COUNT,
+  PRM_ID_DATA_BUFFER_READ_AHEAD_PAGES,
+  PRM_ID_PARALLEL_HEAP_SCAN_WORKER_COUNT,
+  PRM_ID_SORT_PARALLEL_COUNT,
+  PRM_ID_INDEX_LOAD_WORKER_COUNT,
+  PRM_ID_PB_REPLACEMENT_POLICY,
+  PRM_ID_CSS_EVENT_LOOP_COUNT,
+  PRM_ID_CURSOR_FETCH_PAGES,
+  PRM_ID_QUERY_MEMORY_POOL_SIZE,
+  PRM_ID_MVCC_CSN_SNAPSHOT,
+  PRM_ID_LK_FAST_PATH_INTENTION_LOCKS,
+  PRM_ID_QUERY_ARENA_SIZE,
+  PRM_ID_HEAP_SCAN_BATCH_SIZE,
   /* change PRM_LAST_ID when adding new system parameters */
-  PRM_LAST_ID = PRM_ID_DDL_AUDIT_LOG_SIZE
+  PRM_LAST_ID = PRM_ID_HEAP_SCAN_BATCH_SIZE
 };
 typedef enum param_id PARAM_ID;
 
@@ -41,6 +41,9 @@
 #include <netinet/tcp.h>
 #include <sys/time.h>
 #include <sys/un.h>
+#if defined(LINUX)
+#include <sys/epoll.h>
+#endif /* LINUX */
 #else
 #include  <io.h>
 #endif
@@ -68,6 +71,10 @@
 #include "broker_filename.h"
 #include "broker_er_html.h"
 #include "broker_send_fd.h"
+#if defined(LINUX)
+#include "broker_recv_fd.h"
+#include "broker_send_recv_msg.h"
+#endif /* LINUX */
 #include "error_manager.h"
 #include "shard_shm.h"
 #include "shard_metadata.h"
@@ -226,9 +233,27 @@ struct t_clt_table
   SOCKET clt_sock_fd;
   char ip_addr[IP_ADDR_STR_LEN];
 };
+
+#if defined(LINUX)
+/* a client parked in the broker between two transactions (TRANSACTION_POOLING) */
+typedef struct t_pooled_client T_POOLED_CLIENT;
+struct t_pooled_client
+{
+  bool in_use;
+  unsigned char ip_addr[4];
+  struct pooled_client_s info;
+};
+#endif /* LINUX */
 static void shard_broker_process (void);
 static void cleanup (int signo);
 static int init_env (void);
+#if defined(LINUX)
+static int init_client_pool_env (void);
+static void client_pool_park_client (void);
+static void client_pool_queue_client (SOCKET clt_sock_fd);
+static int client_pool_send_client (SOCKET srv_sock_fd, SOCKET clt_sock_fd);
+static void client_pool_remove_client (SOCKET clt_sock_fd);
+#endif /* LINUX */
 #if !defined(WINDOWS)
 static int init_proxy_env (void);
 #endif /* !WINDOWS */
@@ -252,6 +277,9 @@ static THREAD_FUNC proxy_monitor_thr_f (void *arg);
 static THREAD_FUNC proxy_listener_thr_f (void *arg);
 #endif /* !WINDOWS */
 static THREAD_FUNC server_monitor_thr_f (void *arg);
+#if defined(LINUX)
+static THREAD_FUNC client_pool_thr_f (void *arg);
+#endif /* LINUX */
 
 static int read_nbytes_from_client (SOCKET sock_fd, char *buf, int size);
 
@@ -344,6 +372,15 @@ static T_MAX_HEAP_NODE *session_request_q;
 
 static int hold_job = 0;
 
+#if defined(LINUX)
+/* parked clients are indexed by their socket, which stays open in the broker while the client is parked */
+static SOCKET client_pool_sock_fd = INVALID_SOCKET;
+static int client_pool_epoll_fd = -1;
+static T_POOLED_CLIENT *pooled_clients = NULL;
+static int pooled_clients_size = 0;
+static pthread_mutex_t pooled_clients_mutex;
+#endif /* LINUX */
+
 static bool
 broker_add_new_cas (void)
 {
@@ -473,6 +510,9 @@ main (int argc, char *argv[])
 #if !defined(WINDOWS)
   pthread_t proxy_listener_thread;
 #endif /* !WINDOWS */
+#if defined(LINUX)
+  pthread_t client_pool_thread;
+#endif /* LINUX */
 
 #if defined(WIN_FW)
   pthread_t service_thread;
@@ -561,6 +601,12 @@ main (int argc, char *argv[])
 	  session_request_q[i].clt_sock_fd = INVALID_SOCKET;
 	}
 #endif
+#if defined(LINUX)
+      if (shm_appl->transaction_pooling == ON && init_client_pool_env () < 0)
+	{
+	  goto error1;
+	}
+#endif /* LINUX */
     }
 
   set_cubrid_file (FID_SQL_LOG_DIR, shm_appl->log_dir);
@@ -580,6 +626,12 @@ main (int argc, char *argv[])
   else
     {
       THREAD_BEGIN (dispatch_thread, dispatch_thr_f, NULL);
+#if defined(LINUX)
+      if (shm_appl->transaction_pooling == ON)
+	{
+	  THREAD_BEGIN (client_pool_thread, client_pool_thr_f, NULL);
+	}
+#endif /* LINUX */
     }
   THREAD_BEGIN (psize_check_thread, psize_check_thr_f, NULL);
   THREAD_BEGIN (cas_monitor_thread, cas_monitor_thr_f, NULL);
@@ -871,6 +923,21 @@ receiver_thr_f (void *arg)
 		      break;
 		    }
 		}
+
+	      if (status == FN_STATUS_NONE && shm_appl->transaction_pooling == ON)
+		{
+		  /* the client is not on the CAS it connected to any more; find its session */
+		  for (i = 0; i < shm_br->br_info[br_index].appl_server_max_num; i++)
+		    {
+		      if (shm_appl->as_info[i].service_flag == SERVICE_ON
+			  && shm_appl->as_info[i].uts_status == UTS_STATUS_BUSY
+			  && shm_appl->as_info[i].session_id == session_id)
+			{
+			  status = shm_appl->as_info[i].fn_status;
+			  break;
+			}
+		    }
+		}
 	    }
 
 	  CAS_SEND_ERROR_CODE (clt_sock_fd, status);
@@ -933,6 +1000,23 @@ receiver_thr_f (void *arg)
 		      break;
 		    }
 		}
+
+	      if (ret_code != 0 && shm_appl->transaction_pooling == ON && cas_req_header[0] == 'Q' && client_port > 0)
+		{
+		  /* the client is not on the CAS it connected to any more; find it by its address */
+		  for (i = 0; i < shm_br->br_info[br_index].appl_server_max_num; i++)
+		    {
+		      if (shm_appl->as_info[i].service_flag == SERVICE_ON
+			  && shm_appl->as_info[i].uts_status == UTS_STATUS_BUSY
+			  && shm_appl->as_info[i].cas_clt_port == client_port
+			  && memcmp (&shm_appl->as_info[i].cas_clt_ip, &clt_sock_addr.sin_addr, 4) == 0)
+			{
+			  ret_code = 0;
+			  kill (shm_appl->as_info[i].pid, SIGUSR1);
+			  break;
+			}
+		    }
+		}
 	    }
 	  else
 	    {
@@ -1037,6 +1121,7 @@ receiver_thr_f (void *arg)
       strcpy (new_job.prg_name, cas_client_type_str[(int) cas_client_type]);
       new_job.clt_version = client_version;
       memcpy (new_job.driver_info, cas_req_header, SRV_CON_CLIENT_INFO_SIZE);
+      new_job.is_pooled_client = false;
 
       while (1)
 	{
@@ -1222,6 +1307,7 @@ dispatch_thr_f (void *arg)
       shm_appl->as_info[as_index].cas_client_type = cur_job.cas_client_type;
       memcpy (shm_appl->as_info[as_index].cas_clt_ip, cur_job.ip_addr, 4);
       shm_appl->as_info[as_index].cas_clt_port = cur_job.port;
+      shm_appl->as_info[as_index].resume_pooled_client = cur_job.is_pooled_client ? TRUE : FALSE;
 #if defined(WINDOWS)
       shm_appl->as_info[as_index].uts_status = UTS_STATUS_BUSY_WAIT;
       CAS_SEND_ERROR_CODE (cur_job.clt_sock_fd, shm_appl->as_info[as_index].as_port);
@@ -1257,6 +1343,12 @@ dispatch_thr_f (void *arg)
 
 	  memcpy (&ip_addr, cur_job.ip_addr, 4);
 	  ret_val = send_fd (srv_sock_fd, cur_job.clt_sock_fd, ip_addr, cur_job.driver_info);
+#if defined(LINUX)
+	  if (ret_val > 0 && cur_job.is_pooled_client)
+	    {
+	      ret_val = client_pool_send_client (srv_sock_fd, cur_job.clt_sock_fd);
+	    }
+#endif /* LINUX */
 	  if (ret_val > 0)
 	    {
 	      ret_val =
@@ -1266,7 +1358,11 @@ dispatch_thr_f (void *arg)
 
 	  if (ret_val < 0)
 	    {
-	      send_error_to_driver (cur_job.clt_sock_fd, CAS_ER_FREE_SERVER, cur_job.driver_info);
+	      /* a pooled client is waiting for the reply to a request, not for a connection */
+	      if (!cur_job.is_pooled_client)
+		{
+		  send_error_to_driver (cur_job.clt_sock_fd, CAS_ER_FREE_SERVER, cur_job.driver_info);
+		}
 	    }
 	  else
 	    {
@@ -1278,6 +1374,12 @@ dispatch_thr_f (void *arg)
 	  goto retry;
 	}
 
+#if defined(LINUX)
+      if (cur_job.is_pooled_client)
+	{
+	  client_pool_remove_client (cur_job.clt_sock_fd);
+	}
+#endif /* LINUX */
       CLOSE_SOCKET (cur_job.clt_sock_fd);
 #endif /* ifdef !WINDOWS */
 #else /* !WIN_FW */
@@ -1292,6 +1394,237 @@ dispatch_thr_f (void *arg)
 #endif
 }
 
+#if defined(LINUX)
+/*
+ * client_pool_thr_f () -
+ *
+ * Note: takes the clients the CASes give back at the end of a transaction and waits for their next request.
+ * a client that sends a request goes to the job queue like a new connection; a client that closes its
+ * connection is dropped. the server session of the client is not touched here: the CAS that takes the
+ * client gets the session id with the client and attaches to the same session.
+ */
+static THREAD_FUNC
+client_pool_thr_f (void *arg)
+{
+#define CLIENT_POOL_MAX_EVENTS 256
+  struct epoll_event events[CLIENT_POOL_MAX_EVENTS];
+  int num_events, i;
+  SOCKET clt_sock_fd;
+  char peek;
+  int n;
+
+  while (process_flag)
+    {
+      num_events = epoll_wait (client_pool_epoll_fd, events, CLIENT_POOL_MAX_EVENTS, 1000);
+
+      for (i = 0; i < num_events; i++)
+	{
+	  clt_sock_fd = events[i].data.fd;
+
+	  if (clt_sock_fd == client_pool_sock_fd)
+	    {
+	      client_pool_park_client ();
+	      continue;
+	    }
+
+	  n = recv (clt_sock_fd, &peek, 1, MSG_PEEK | MSG_DONTWAIT);
+	  if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR))
+	    {
+	      continue;
+	    }
+
+	  epoll_ctl (client_pool_epoll_fd, EPOLL_CTL_DEL, clt_sock_fd, NULL);
+	  if (n > 0)
+	    {
+	      client_pool_queue_client (clt_sock_fd);
+	    }
+	  else
+	    {
+	      client_pool_remove_client (clt_sock_fd);
+	      CLOSE_SOCKET (clt_sock_fd);
+	    }
+	}
+    }
+
+  return NULL;
+#undef CLIENT_POOL_MAX_EVENTS
+}
+
+/*
+ * client_pool_park_client () -
+ *
+ * Note: receive a client from a CAS; the CAS sends the socket of the client, then struct pooled_client_s and
+ * waits for an answer before it forgets the client.
+ */
+static void
+client_pool_park_client (void)
+{
+  SOCKET cas_sock_fd, clt_sock_fd;
+  struct pooled_client_s info;
+  struct epoll_event ev;
+  int ip_addr, read_len, total_read_size, ack;
+
+  cas_sock_fd = accept (client_pool_sock_fd, NULL, NULL);
+  if (IS_INVALID_SOCKET (cas_sock_fd))
+    {
+      return;
+    }
+
+  clt_sock_fd = recv_fd (cas_sock_fd, &ip_addr, NULL);
+  if (clt_sock_fd < 0)
+    {
+      CLOSE_SOCKET (cas_sock_fd);
+      return;
+    }
+
+  for (total_read_size = 0; total_read_size < (int) sizeof (info); total_read_size += read_len)
+    {
+      read_len =
+	read_from_client_with_timeout (cas_sock_fd, (char *) &info + total_read_size,
+				       sizeof (info) - total_read_size, SOCKET_TIMEOUT_SEC);
+      if (read_len <= 0)
+	{
+	  goto error;
+	}
+    }
+
+  pthread_mutex_lock (&pooled_clients_mutex);
+  if (clt_sock_fd >= pooled_clients_size)
+    {
+      T_POOLED_CLIENT *new_clients;
+      int new_size = MAX (clt_sock_fd + 1, pooled_clients_size * 2);
+
+      new_clients = (T_POOLED_CLIENT *) realloc (pooled_clients, sizeof (T_POOLED_CLIENT) * new_size);
+      if (new_clients == NULL)
+	{
+	  pthread_mutex_unlock (&pooled_clients_mutex);
+	  goto error;
+	}
+      memset (new_clients + pooled_clients_size, 0, sizeof (T_POOLED_CLIENT) * (new_size - pooled_clients_size));
+      pooled_clients = new_clients;
+      pooled_clients_size = new_size;
+    }
+  pooled_clients[clt_sock_fd].in_use = true;
+  memcpy (pooled_clients[clt_sock_fd].ip_addr, &ip_addr, 4);
+  pooled_clients[clt_sock_fd].info = info;
+  pthread_mutex_unlock (&pooled_clients_mutex);
+
+  if (max_open_fd < clt_sock_fd)
+    {
+      max_open_fd = clt_sock_fd;
+    }
+
+  ack = htonl (0);
+  if (write_to_client_with_timeout (cas_sock_fd, (char *) &ack, sizeof (ack), SOCKET_TIMEOUT_SEC) != sizeof (ack))
+    {
+      /* the CAS closes the client itself */
+      client_pool_remove_client (clt_sock_fd);
+      goto error;
+    }
+  CLOSE_SOCKET (cas_sock_fd);
+
+  memset (&ev, 0, sizeof (ev));
+  ev.events = EPOLLIN | EPOLLRDHUP;
+  ev.data.fd = clt_sock_fd;
+  if (epoll_ctl (client_pool_epoll_fd, EPOLL_CTL_ADD, clt_sock_fd, &ev) < 0)
+    {
+      client_pool_remove_client (clt_sock_fd);
+      CLOSE_SOCKET (clt_sock_fd);
+    }
+  return;
+
+error:
+  CLOSE_SOCKET (clt_sock_fd);
+  CLOSE_SOCKET (cas_sock_fd);
+}
+
+/*
+ * client_pool_queue_client () -
+ *   clt_sock_fd(in): a parked client that sent a request
+ */
+static void
+client_pool_queue_client (SOCKET clt_sock_fd)
+{
+  static int job_count = 1;
+  T_MAX_HEAP_NODE new_job;
+  T_POOLED_CLIENT *pooled_client;
+
+  memset (&new_job, 0, sizeof (new_job));
+
+  pthread_mutex_lock (&pooled_clients_mutex);
+  pooled_client = &pooled_clients[clt_sock_fd];
+  assert (pooled_client->in_use);
+  new_job.clt_version = pooled_client->info.clt_version;
+  new_job.cas_client_type = pooled_client->info.cas_client_type;
+  memcpy (new_job.driver_info, pooled_client->info.driver_info, SRV_CON_CLIENT_INFO_SIZE);
+  memcpy (new_job.ip_addr, pooled_client->ip_addr, 4);
+  new_job.port = pooled_client->info.port;
+  pthread_mutex_unlock (&pooled_clients_mutex);
+
+  job_count = (job_count >= JOB_COUNT_MAX) ? 1 : job_count + 1;
+  new_job.id = job_count;
+  new_job.clt_sock_fd = clt_sock_fd;
+  new_job.recv_time = time (NULL);
+  new_job.priority = 0;
+  new_job.script[0] = '\0';
+  strcpy (new_job.prg_name, cas_client_type_str[(int) new_job.cas_client_type]);
+  new_job.is_pooled_client = true;
+
+  while (1)
+    {
+      pthread_mutex_lock (&clt_table_mutex);
+      if (max_heap_insert (shm_appl->job_queue, shm_appl->job_queue_size, &new_job) < 0)
+	{
+	  pthread_mutex_unlock (&clt_table_mutex);
+	  SLEEP_MILISEC (0, 100);
+	}
+      else
+	{
+	  pthread_cond_signal (&clt_table_cond);
+	  pthread_mutex_unlock (&clt_table_mutex);
+	  break;
+	}
+    }
+}
+
+/*
+ * client_pool_send_client () -
+ *   return: size sent, -1 on error
+ *   srv_sock_fd(in): the CAS that takes the client
+ *   clt_sock_fd(in): a parked client
+ *
+ * Note: follows send_fd () in the handshake with the CAS.
+ */
+static int
+client_pool_send_client (SOCKET srv_sock_fd, SOCKET clt_sock_fd)
+{
+  struct pooled_client_s info;
+
+  pthread_mutex_lock (&pooled_clients_mutex);
+  assert (clt_sock_fd < pooled_clients_size && pooled_clients[clt_sock_fd].in_use);
+  info = pooled_clients[clt_sock_fd].info;
+  pthread_mutex_unlock (&pooled_clients_mutex);
+
+  if (write_to_client_with_timeout (srv_sock_fd, (char *) &info, sizeof (info), SOCKET_TIMEOUT_SEC) != sizeof (info))
+    {
+      return -1;
+    }
+
+  return sizeof (info);
+}
+
+static void
+client_pool_remove_client (SOCKET clt_sock_fd)
+{
+  pthread_mutex_lock (&pooled_clients_mutex);
+  if (clt_sock_fd < pooled_clients_size)
+    {
+      pooled_clients[clt_sock_fd].in_use = false;
+    }
+  pthread_mutex_unlock (&pooled_clients_mutex);
+}
+#endif /* LINUX */
+
 #if defined(WIN_FW)
 static THREAD_FUNC
 service_thr_f (void *arg)
@@ -1398,6 +1731,70 @@ init_env (void)
   return (0);
 }
 
+#if defined(LINUX)
+/*
+ * init_client_pool_env () -
+ *   return: 0 if success, -1 otherwise
+ *
+ * Note: listen to the unix domain socket on which the CASes give their clients back between transactions.
+ * the port name of the broker is only used by shard proxies otherwise.
+ */
+static int
+init_client_pool_env (void)
+{
+  struct sockaddr_un pool_sock_addr;
+  struct epoll_event ev;
+  int len;
+
+  client_pool_sock_fd = socket (AF_UNIX, SOCK_STREAM, 0);
+  if (IS_INVALID_SOCKET (client_pool_sock_fd))
+    {
+      UW_SET_ERROR_CODE (UW_ER_CANT_CREATE_SOCKET, errno);
+      return (-1);
+    }
+
+  memset (&pool_sock_addr, 0, sizeof (pool_sock_addr));
+  pool_sock_addr.sun_family = AF_UNIX;
+  strncpy_bufsize (pool_sock_addr.sun_path, shm_appl->port_name);
+  len = strlen (pool_sock_addr.sun_path) + sizeof (pool_sock_addr.sun_family) + 1;
+
+  unlink (pool_sock_addr.sun_path);
+
+  if (bind (client_pool_sock_fd, (struct sockaddr *) &pool_sock_addr, len) < 0
+      || listen (client_pool_sock_fd, 127) < 0)
+    {
+      UW_SET_ERROR_CODE (UW_ER_CANT_BIND, errno);
+      CLOSE_SOCKET (client_pool_sock_fd);
+      return (-1);
+    }
+
+  client_pool_epoll_fd = epoll_create (shm_appl->job_queue_size);
+  if (client_pool_epoll_fd < 0)
+    {
+      UW_SET_ERROR_CODE (UW_ER_CANT_CREATE_SOCKET, errno);
+      CLOSE_SOCKET (client_pool_sock_fd);
+      return (-1);
+    }
+
+  memset (&ev, 0, sizeof (ev));
+  ev.events = EPOLLIN;
+  ev.data.fd = client_pool_sock_fd;
+  if (epoll_ctl (client_pool_epoll_fd, EPOLL_CTL_ADD, client_pool_sock_fd, &ev) < 0)
+    {
+      UW_SET_ERROR_CODE (UW_ER_CANT_CREATE_SOCKET, errno);
+      close (client_pool_epoll_fd);
+      CLOSE_SOCKET (client_pool_sock_fd);
+      return (-1);
+    }
+
+  max_open_fd = MAX (max_open_fd, MAX (client_pool_sock_fd, client_pool_epoll_fd));
+
+  pthread_mutex_init (&pooled_clients_mutex, NULL);
+
+  return (0);
+}
+#endif /* LINUX */
+
 static int
 read_from_client (SOCKET sock_fd, char *buf, int size)
 {
@@ -201,6 +201,7 @@ const char *broker_keywords[] = {
   "MAX_QUERY_TIMEOUT",
   "SESSION_TIMEOUT",
   "STATEMENT_POOLING",
+  "TRANSACTION_POOLING",
   "JDBC_CACHE",
   "JDBC_CACHE_HINT_ONLY",
   "JDBC_CACHE_LIFE_TIME",
@@ -780,6 +781,14 @@ broker_config_read_internal (const char *conf_file, T_BROKER_INFO * br_info, int
 	  goto conf_error;
 	}
 
+      br_info[num_brs].transaction_pooling =
+	conf_get_value_table_on_off (ini_getstr (ini, sec_name, "TRANSACTION_POOLING", "OFF", &lineno));
+      if (br_info[num_brs].transaction_pooling < 0)
+	{
+	  errcode = PARAM_BAD_VALUE;
+	  goto conf_error;
+	}
+
       br_info[num_brs].jdbc_cache =
 	conf_get_value_table_on_off (ini_getstr (ini, sec_name, "JDBC_CACHE", "OFF", &lineno));
       if (br_info[num_brs].jdbc_cache < 0)
@@ -1381,6 +1390,11 @@ broker_config_dump (FILE * fp, const T_BROKER_INFO * br_info, int num_broker, in
 	{
 	  fprintf (fp, "STATEMENT_POOLING\t=%s\n", tmp_str);
 	}
+      tmp_str = get_conf_string (br_info[i].transaction_pooling, tbl_on_off);
+      if (tmp_str)
+	{
+	  fprintf (fp, "TRANSACTION_POOLING\t=%s\n", tmp_str);
+	}
       tmp_str = get_conf_string (br_info[i].cci_pconnect, tbl_on_off);
       if (tmp_str)
 	{
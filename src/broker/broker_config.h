@@ -181,6 +181,7 @@ struct t_broker_info
   char cache_user_info;
   char sql_log2;
   char statement_pooling;
+  char transaction_pooling;
   char access_mode;
   char name[BROKER_NAME_LEN];
   int pid;
@@ -32,4 +32,22 @@ struct sendmsg_s
   char driver_info[SRV_CON_CLIENT_INFO_SIZE];
 };
 
+/*
+ * the client a CAS gives back to the broker at the end of a transaction (TRANSACTION_POOLING).
+ * it follows the client socket on the pooling socket of the broker, and it is sent back to the next CAS
+ * after the client socket.
+ */
+struct pooled_client_s
+{
+  T_BROKER_VERSION clt_version;
+  char driver_info[SRV_CON_CLIENT_INFO_SIZE];
+  char cas_client_type;
+  unsigned short port;
+  int isolation_level;
+  int lock_timeout;
+  int handle_epoch;		/* server handle ids given to the client before are stale */
+  int db_info_size;
+  char db_info[SRV_CON_DB_INFO_SIZE];	/* the connect request, with the session id of the server session */
+};
+
 #endif /* _BROKER_SEND_RECV_MSG_H_ */
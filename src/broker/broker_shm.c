@@ -523,6 +523,12 @@ broker_shm_initialize_shm_as (T_BROKER_INFO * br_info_p, T_SHM_PROXY * shm_proxy
   shm_as_p->keep_connection = br_info_p->keep_connection;
   shm_as_p->cache_user_info = br_info_p->cache_user_info;
   shm_as_p->statement_pooling = br_info_p->statement_pooling;
+#if defined(LINUX)
+  shm_as_p->transaction_pooling = (br_info_p->transaction_pooling == ON && br_info_p->keep_connection == KEEP_CON_AUTO
+				   && br_info_p->shard_flag == OFF) ? ON : OFF;
+#else
+  shm_as_p->transaction_pooling = OFF;
+#endif
   shm_as_p->access_mode = br_info_p->access_mode;
   shm_as_p->cci_pconnect = br_info_p->cci_pconnect;
   shm_as_p->access_log = br_info_p->access_log;
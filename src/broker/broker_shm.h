@@ -311,6 +311,7 @@ struct t_appl_server_info
   char cur_sql_log2;
   char cur_slow_log_mode;
   char cur_statement_pooling;
+  char resume_pooled_client;	/* the client being handed over was parked in the broker */
 #if defined(WINDOWS)
   char close_flag;
 #endif
@@ -565,6 +566,7 @@ struct t_shm_appl_server
   char cache_user_info;
   char sql_log2;
   char statement_pooling;
+  char transaction_pooling;	/* give the client back to the broker between transactions */
   char access_mode;
   char jdbc_cache;
   char jdbc_cache_only_hint;
@@ -82,6 +82,14 @@
 #include "error_manager.h"
 #include "ddl_log.h"
 
+/* the client can be given back to the broker between transactions (TRANSACTION_POOLING) */
+#if defined(LINUX) && !defined(LIBCAS_FOR_JSP) && !defined(CAS_FOR_ORACLE) && !defined(CAS_FOR_MYSQL)
+#define CAS_TRANSACTION_POOLING
+#include "broker_send_fd.h"
+#include "broker_send_recv_msg.h"
+#include "cas_handle.h"
+#endif
+
 static const int DEFAULT_CHECK_INTERVAL = 1;
 
 #define FUNC_NEEDS_RESTORING_CON_STATUS(func_code) \
@@ -122,6 +130,11 @@ static int net_read_header_keep_con_on (SOCKET clt_sock_fd, MSG_HEADER * client_
 static void set_db_connection_info (void);
 static void clear_db_connection_info (void);
 static bool need_database_reconnect (void);
+#if defined(CAS_TRANSACTION_POOLING)
+static bool cas_can_park_client (void);
+static int cas_park_client (SOCKET client_sock_fd, int client_ip_addr, unsigned short client_port, char *db_info,
+			    int db_info_size);
+#endif /* CAS_TRANSACTION_POOLING */
 
 extern bool ssl_client;
 extern int cas_init_ssl (int);
@@ -173,6 +186,9 @@ int con_status_before_check_cas;
 bool is_first_request;
 SOCKET new_req_sock_fd = INVALID_SOCKET;
 #endif /* !LIBCAS_FOR_JSP */
+#if defined(CAS_TRANSACTION_POOLING)
+static bool client_left_idle = false;	/* the CAS was taken from the client before a request was read */
+#endif /* CAS_TRANSACTION_POOLING */
 int cas_default_isolation_level = 0;
 int cas_default_lock_timeout = -1;
 bool cas_default_ansi_quotes = true;
@@ -809,6 +825,11 @@ cas_main (void)
   FN_RETURN fn_ret = FN_KEEP_CONN;
   char client_ip_str[16];
   bool is_new_connection;
+  bool is_pooled_client = false;
+#if defined(CAS_TRANSACTION_POOLING)
+  struct pooled_client_s pooled_client;
+  unsigned short client_port;
+#endif /* CAS_TRANSACTION_POOLING */
 
   prev_cas_info[CAS_INFO_STATUS] = CAS_INFO_RESERVED_DEFAULT;
 
@@ -943,6 +964,18 @@ cas_main (void)
 	    CLOSE_SOCKET (br_sock_fd);
 	    goto finish_cas;
 	  }
+#if defined(CAS_TRANSACTION_POOLING)
+	client_port = as_info->cas_clt_port;
+	is_pooled_client = (as_info->resume_pooled_client == TRUE);
+	if (is_pooled_client
+	    && net_read_stream (br_sock_fd, (char *) &pooled_client, sizeof (pooled_client)) < 0)
+	  {
+	    cas_log_write_and_end (0, false, "HANDSHAKE ERROR net_read_stream(pooled_client)");
+	    CLOSE_SOCKET (br_sock_fd);
+	    CLOSE_SOCKET (client_sock_fd);
+	    goto finish_cas;
+	  }
+#endif /* CAS_TRANSACTION_POOLING */
 	if (net_write_int (br_sock_fd, as_info->uts_status) < 0)
 	  {
 	    cas_log_write_and_end (0, false, "HANDSHAKE ERROR net_write_int(uts_status)");
@@ -989,7 +1022,7 @@ cas_main (void)
 	    goto finish_cas;
 	  }
 #if !defined(WINDOWS)
-	else
+	else if (!is_pooled_client)
 	  {
 	    /* send NO_ERROR to client */
 	    if (net_write_int (client_sock_fd, 0) < 0)
@@ -1027,7 +1060,17 @@ cas_main (void)
 	      }
 	  }
 
-	if (net_read_stream (client_sock_fd, read_buf, db_info_size) < 0)
+#if defined(CAS_TRANSACTION_POOLING)
+	if (is_pooled_client)
+	  {
+	    /* the client is connected already; take the connect request it sent to its first CAS */
+	    assert (pooled_client.db_info_size == db_info_size);
+	    memcpy (read_buf, pooled_client.db_info, db_info_size);
+	    cas_log_write_and_end (0, false, "RESUME CLIENT");
+	  }
+#endif /* CAS_TRANSACTION_POOLING */
+
+	if (!is_pooled_client && net_read_stream (client_sock_fd, read_buf, db_info_size) < 0)
 	  {
 	    cas_info[CAS_INFO_STATUS] = CAS_INFO_STATUS_INACTIVE;
 	    net_write_error (client_sock_fd, req_info.client_version, req_info.driver_info, cas_info, cas_info_size,
@@ -1245,6 +1288,19 @@ cas_main (void)
 #if !defined(CAS_FOR_ORACLE) && !defined(CAS_FOR_MYSQL)
 	    ux_set_default_setting ();
 #endif /* !CAS_FOR_ORACLE && !CAS_FOR_MYSQL */
+#if defined(CAS_TRANSACTION_POOLING)
+	    if (is_pooled_client)
+	      {
+		/* what the client set on the CASes it was on before */
+		ux_set_isolation_level (pooled_client.isolation_level, NULL);
+		ux_set_lock_timeout (pooled_client.lock_timeout);
+		hm_set_handle_epoch (pooled_client.handle_epoch + 1);
+	      }
+	    else if (shm_appl->transaction_pooling == ON)
+	      {
+		hm_set_handle_epoch (0);
+	      }
+#endif /* CAS_TRANSACTION_POOLING */
 
 	    as_info->auto_commit_mode = FALSE;
 	    cas_log_write_and_end (0, false, "DEFAULT isolation_level %d, " "lock_timeout %d",
@@ -1263,8 +1319,11 @@ cas_main (void)
 	    cas_bi_set_cci_pconnect (shm_appl->cci_pconnect);
 
 	    cas_info[CAS_INFO_STATUS] = CAS_INFO_STATUS_ACTIVE;
-	    /* todo: casting T_BROKER_VERSION to T_CAS_PROTOCOL */
-	    cas_send_connect_reply_to_driver ((T_CAS_PROTOCOL) req_info.client_version, client_sock_fd, cas_info);
+	    if (!is_pooled_client)
+	      {
+		/* todo: casting T_BROKER_VERSION to T_CAS_PROTOCOL */
+		cas_send_connect_reply_to_driver ((T_CAS_PROTOCOL) req_info.client_version, client_sock_fd, cas_info);
+	      }
 
 	    as_info->cci_default_autocommit = shm_appl->cci_default_autocommit;
 	    req_info.need_rollback = TRUE;
@@ -1305,7 +1364,7 @@ cas_main (void)
 
 	    prev_cas_info[CAS_INFO_STATUS] = CAS_INFO_RESERVED_DEFAULT;
 
-	    if (as_info->cur_statement_pooling)
+	    if (as_info->cur_statement_pooling || fn_ret == FN_PARK_CLIENT)
 	      {
 		hm_srv_handle_free_all (true);
 	      }
@@ -1319,7 +1378,7 @@ cas_main (void)
 	      }
 
 #if !defined(CAS_FOR_ORACLE) && !defined(CAS_FOR_MYSQL)
-	    if (fn_ret != FN_KEEP_SESS)
+	    if (fn_ret != FN_KEEP_SESS && fn_ret != FN_PARK_CLIENT)
 	      {
 		ux_end_session ();
 	      }
@@ -1338,6 +1397,14 @@ cas_main (void)
 		cas_set_db_connect_status (-1);	/* DB_CONNECTION_STATUS_RESET */
 	      }
 
+#if defined(CAS_TRANSACTION_POOLING)
+	    if (fn_ret == FN_PARK_CLIENT
+		&& cas_park_client (client_sock_fd, client_ip_addr, client_port, read_buf, db_info_size) < 0)
+	      {
+		cas_log_write_and_end (0, false, "PARK CLIENT failed; the client is disconnected");
+	      }
+#endif /* CAS_TRANSACTION_POOLING */
+
 #if !defined(CAS_FOR_ORACLE) && !defined(CAS_FOR_MYSQL)
 	    cas_log_error_handler_end ();
 #endif /* !CAS_FOR_ORACLE && !CAS_FOR_MYSQL */
@@ -1832,6 +1899,13 @@ process_request (SOCKET sock_fd, T_NET_BUF * net_buf, T_REQ_INFO * req_info)
 	      cas_log_msg = "CHANGE CLIENT";
 	      fn_ret = FN_KEEP_SESS;
 	    }
+#if defined(CAS_TRANSACTION_POOLING)
+	  if (cas_can_park_client ())
+	    {
+	      cas_log_msg = "PARK CLIENT";
+	      fn_ret = FN_PARK_CLIENT;
+	    }
+#endif /* CAS_TRANSACTION_POOLING */
 #endif /* !LIBCAS_FOR_JSP */
 	  if (cas_log_msg == NULL)
 	    {
@@ -2420,6 +2494,7 @@ static int
 net_read_int_keep_con_auto (SOCKET clt_sock_fd, MSG_HEADER * client_msg_header, T_REQ_INFO * req_info)
 {
   int ret_value = 0;
+  bool is_header_read = false;
 #if defined(CAS_FOR_MYSQL)
   int timeout = 0, remained_timeout = 0;
 #endif /* CAS_FOR_MYSQL */
@@ -2510,6 +2585,7 @@ net_read_int_keep_con_auto (SOCKET clt_sock_fd, MSG_HEADER * client_msg_header,
 	}
       else
 	{
+	  is_header_read = true;
 	  break;
 	}
     }
@@ -2526,9 +2602,15 @@ net_read_int_keep_con_auto (SOCKET clt_sock_fd, MSG_HEADER * client_msg_header,
     }
   logddl_set_start_time (&tran_start_time);
 
+#if defined(CAS_TRANSACTION_POOLING)
+  client_left_idle = false;
+#endif /* CAS_TRANSACTION_POOLING */
   if (as_info->con_status == CON_STATUS_CLOSE || as_info->con_status == CON_STATUS_CLOSE_AND_CONNECT)
     {
       ret_value = -1;
+#if defined(CAS_TRANSACTION_POOLING)
+      client_left_idle = !is_header_read;
+#endif /* CAS_TRANSACTION_POOLING */
     }
   else
     {
@@ -2545,6 +2627,107 @@ net_read_int_keep_con_auto (SOCKET clt_sock_fd, MSG_HEADER * client_msg_header,
   return ret_value;
 }
 
+#if defined(CAS_TRANSACTION_POOLING)
+/*
+ * cas_can_park_client () - true if the client can be given back to the broker instead of being disconnected
+ *   return: bool
+ *
+ * Note: the broker took the CAS from a client that is between two transactions. the client does not notice
+ * when it is parked: the next CAS attaches to the same server session, so nothing the client has may live
+ * only in this CAS.
+ */
+static bool
+cas_can_park_client (void)
+{
+  if (shm_appl->transaction_pooling != ON || !client_left_idle || as_info->reset_flag == TRUE)
+    {
+      return false;
+    }
+
+  if (as_info->con_status != CON_STATUS_CLOSE && as_info->con_status != CON_STATUS_CLOSE_AND_CONNECT)
+    {
+      return false;
+    }
+
+  /* older drivers do not send the session id in the connect request */
+  if (!DOES_CLIENT_UNDERSTAND_THE_PROTOCOL (req_info.client_version, PROTOCOL_V3))
+    {
+      return false;
+    }
+
+  if (ssl_client || as_info->num_holdable_results > 0 || is_xa_prepared ())
+    {
+      return false;
+    }
+
+  /* the next CAS could not make the handle ids of this one stale */
+  if (hm_get_handle_epoch () >= HM_MAX_HANDLE_EPOCH)
+    {
+      return false;
+    }
+
+  return true;
+}
+
+/*
+ * cas_park_client () - give the client back to the broker
+ *   return: 0 if the broker has the client, -1 otherwise
+ *   client_sock_fd(in):
+ *   client_ip_addr(in):
+ *   client_port(in):
+ *   db_info(in): the connect request of the client
+ *   db_info_size(in):
+ *
+ * Note: the server handles are freed and the transaction is over; the session of the server is kept.
+ */
+static int
+cas_park_client (SOCKET client_sock_fd, int client_ip_addr, unsigned short client_port, char *db_info,
+		 int db_info_size)
+{
+  struct pooled_client_s pooled_client;
+  SOCKET broker_sock_fd;
+  int ack;
+
+  if (db_info_size != SRV_CON_DB_INFO_SIZE)
+    {
+      return -1;
+    }
+
+  memset (&pooled_client, 0, sizeof (pooled_client));
+  pooled_client.clt_version = req_info.client_version;
+  memcpy (pooled_client.driver_info, req_info.driver_info, SRV_CON_CLIENT_INFO_SIZE);
+  pooled_client.cas_client_type = cas_client_type;
+  pooled_client.port = client_port;
+  ux_get_tran_setting (&pooled_client.lock_timeout, &pooled_client.isolation_level);
+  pooled_client.handle_epoch = hm_get_handle_epoch ();
+  pooled_client.db_info_size = db_info_size;
+  memcpy (pooled_client.db_info, db_info, db_info_size);
+
+  /* the session id in the request may be empty or older than the session of the server */
+  cas_make_session_for_driver (pooled_client.db_info + SRV_CON_DB_INFO_SIZE - SRV_CON_DBSESS_ID_SIZE);
+
+  broker_sock_fd = net_connect_broker ();
+  if (IS_INVALID_SOCKET (broker_sock_fd))
+    {
+      return -1;
+    }
+
+  net_timeout_set (NET_MIN_TIMEOUT);
+
+  if (send_fd (broker_sock_fd, client_sock_fd, client_ip_addr, pooled_client.driver_info) < 0
+      || net_write_stream (broker_sock_fd, (char *) &pooled_client, sizeof (pooled_client)) < 0
+      || net_read_int (broker_sock_fd, &ack) < 0)
+    {
+      CLOSE_SOCKET (broker_sock_fd);
+      return -1;
+    }
+
+  CLOSE_SOCKET (broker_sock_fd);
+
+  return 0;
+}
+#endif /* CAS_TRANSACTION_POOLING */
+
 static int
 net_read_header_keep_con_on (SOCKET clt_sock_fd, MSG_HEADER * client_msg_header)
 {
@@ -491,6 +491,13 @@ fn_execute_internal (SOCKET sock_fd, int argc, void **argv, T_NET_BUF * net_buf,
   if (srv_handle == NULL || srv_handle->schema_type >= CCI_SCH_FIRST)
 #endif /* CAS_FOR_ORACLE || CAS_FOR_MYSQL */
     {
+      if (srv_handle == NULL && hm_is_stale_srv_handle (srv_h_id))
+	{
+	  /* prepared on the CAS the client was on before; the driver prepares it again */
+	  ERROR_INFO_SET (CAS_ER_STMT_POOLING, CAS_ERROR_INDICATOR);
+	  NET_BUF_ERR_SET (net_buf);
+	  return FN_KEEP_CONN;
+	}
       ERROR_INFO_SET (CAS_ER_SRV_HANDLE, CAS_ERROR_INDICATOR);
       NET_BUF_ERR_SET (net_buf);
       return FN_KEEP_CONN;
@@ -47,6 +47,15 @@
 
 #define SRV_HANDLE_ALLOC_SIZE		256
 
+/*
+ * when the epoch is in use, a handle id is (epoch << HM_HANDLE_INDEX_BITS) | (index + 1).
+ * the client of a CAS may have been on another CAS before (TRANSACTION_POOLING); the handle ids it got there
+ * belong to an older epoch and must not find the handles of this CAS.
+ */
+#define HM_HANDLE_INDEX_BITS		16
+#define HM_HANDLE_INDEX_MASK		((1 << HM_HANDLE_INDEX_BITS) - 1)
+
+static int hm_handle_index (int h_id);
 static void srv_handle_content_free (T_SRV_HANDLE * srv_handle);
 static void col_update_info_free (T_QUERY_RESULT * q_result);
 static void srv_handle_rm_tmp_file (int h_id, T_SRV_HANDLE * srv_handle);
@@ -57,6 +66,8 @@ static int max_handle_id = 0;
 #if !defined(LIBCAS_FOR_JSP)
 static int current_handle_count = 0;
 #endif
+static bool handle_epoch_enabled = false;
+static int handle_epoch = 0;
 
 int
 hm_new_srv_handle (T_SRV_HANDLE ** new_handle, unsigned int seq_num)
@@ -99,6 +110,11 @@ hm_new_srv_handle (T_SRV_HANDLE ** new_handle, unsigned int seq_num)
       srv_handle_table = new_srv_handle_table;
     }
 
+  if (handle_epoch_enabled && new_handle_id > HM_HANDLE_INDEX_MASK)
+    {
+      return ERROR_INFO_SET (CAS_ER_MAX_PREPARED_STMT_COUNT_EXCEEDED, CAS_ERROR_INDICATOR);
+    }
+
   srv_handle = (T_SRV_HANDLE *) MALLOC (sizeof (T_SRV_HANDLE));
   if (srv_handle == NULL)
     {
@@ -106,6 +122,10 @@ hm_new_srv_handle (T_SRV_HANDLE ** new_handle, unsigned int seq_num)
     }
   memset (srv_handle, 0, sizeof (T_SRV_HANDLE));
   srv_handle->id = new_handle_id;
+  if (handle_epoch_enabled)
+    {
+      srv_handle->id |= handle_epoch << HM_HANDLE_INDEX_BITS;
+    }
   srv_handle->query_seq_num = seq_num;
   srv_handle->use_plan_cache = false;
   srv_handle->use_query_cache = false;
@@ -137,31 +157,34 @@ hm_new_srv_handle (T_SRV_HANDLE ** new_handle, unsigned int seq_num)
   current_handle_count++;
 #endif
 
-  return new_handle_id;
+  return srv_handle->id;
 }
 
 T_SRV_HANDLE *
 hm_find_srv_handle (int h_id)
 {
-  if (h_id <= 0 || h_id > max_srv_handle)
+  int index = hm_handle_index (h_id);
+
+  if (index < 0 || index >= max_srv_handle)
     {
       return NULL;
     }
 
-  return (srv_handle_table[h_id - 1]);
+  return (srv_handle_table[index]);
 }
 
 void
 hm_srv_handle_free (int h_id)
 {
   T_SRV_HANDLE *srv_handle;
+  int index = hm_handle_index (h_id);
 
-  if (h_id <= 0 || h_id > max_srv_handle)
+  if (index < 0 || index >= max_srv_handle)
     {
       return;
     }
 
-  srv_handle = srv_handle_table[h_id - 1];
+  srv_handle = srv_handle_table[index];
   if (srv_handle == NULL)
     {
       return;
@@ -176,7 +199,7 @@ hm_srv_handle_free (int h_id)
 #endif /* !CAS_FOR_ORACLE && !CAS_FOR_MYSQL */
 
   FREE_MEM (srv_handle);
-  srv_handle_table[h_id - 1] = NULL;
+  srv_handle_table[index] = NULL;
 #if !defined(LIBCAS_FOR_JSP)
   current_handle_count--;
 #endif
@@ -204,7 +227,7 @@ hm_srv_handle_free_all (bool free_holdable)
 	}
 
       srv_handle_content_free (srv_handle);
-      srv_handle_rm_tmp_file (i + 1, srv_handle);
+      srv_handle_rm_tmp_file (srv_handle->id, srv_handle);
       FREE_MEM (srv_handle);
       srv_handle_table[i] = NULL;
 #if !defined(LIBCAS_FOR_JSP)
@@ -490,6 +513,54 @@ srv_handle_rm_tmp_file (int h_id, T_SRV_HANDLE * srv_handle)
 #endif /* !CAS_FOR_ORACLE && !CAS_FOR_MYSQL */
 }
 
+/*
+ * hm_set_handle_epoch () - put the epoch in the ids of the handles made from now on
+ *   return: void
+ *   epoch(in): 0 .. HM_MAX_HANDLE_EPOCH
+ *
+ * Note: call it when there is no handle.
+ */
+void
+hm_set_handle_epoch (int epoch)
+{
+  assert (epoch >= 0 && epoch <= HM_MAX_HANDLE_EPOCH);
+
+  handle_epoch_enabled = true;
+  handle_epoch = epoch;
+}
+
+int
+hm_get_handle_epoch (void)
+{
+  return handle_epoch;
+}
+
+/*
+ * hm_is_stale_srv_handle () - true if h_id was made in an older epoch, that is, on another CAS
+ *   return: bool
+ *   h_id(in):
+ */
+bool
+hm_is_stale_srv_handle (int h_id)
+{
+  return handle_epoch_enabled && h_id > 0 && (h_id >> HM_HANDLE_INDEX_BITS) < handle_epoch;
+}
+
+static int
+hm_handle_index (int h_id)
+{
+  if (handle_epoch_enabled)
+    {
+      if (h_id <= 0 || (h_id >> HM_HANDLE_INDEX_BITS) != handle_epoch)
+	{
+	  return -1;
+	}
+      h_id &= HM_HANDLE_INDEX_MASK;
+    }
+
+  return h_id - 1;
+}
+
 int
 hm_srv_handle_get_current_count (void)
 {
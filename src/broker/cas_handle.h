@@ -216,4 +216,10 @@ extern void hm_srv_handle_set_pooled (void);
 
 extern int hm_srv_handle_get_current_count (void);
 extern void hm_srv_handle_unset_prepare_flag_all (void);
+
+#define HM_MAX_HANDLE_EPOCH		0x7FFF
+
+extern void hm_set_handle_epoch (int epoch);
+extern int hm_get_handle_epoch (void);
+extern bool hm_is_stale_srv_handle (int h_id);
 #endif /* _CAS_HANDLE_H_ */
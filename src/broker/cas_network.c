@@ -256,6 +256,43 @@ net_connect_proxy (void)
 }
 #endif /* LIBCAS_FOR_JSP */
 
+#if !defined(LIBCAS_FOR_JSP) && !defined(WINDOWS)
+/*
+ * net_connect_broker () - connect to the unix domain socket on which the broker takes the clients back
+ *   return: socket, INVALID_SOCKET on error
+ */
+SOCKET
+net_connect_broker (void)
+{
+  int fd, len;
+  struct sockaddr_un broker_sock_addr;
+
+  if ((fd = socket (AF_UNIX, SOCK_STREAM, 0)) < 0)
+    {
+      return (INVALID_SOCKET);
+    }
+
+  memset (&broker_sock_addr, 0, sizeof (broker_sock_addr));
+  broker_sock_addr.sun_family = AF_UNIX;
+  strncpy_bufsize (broker_sock_addr.sun_path, shm_appl->port_name);
+#ifdef  _SOCKADDR_LEN		/* 4.3BSD Reno and later */
+  len = sizeof (broker_sock_addr.sun_len) + sizeof (broker_sock_addr.sun_family) + strlen (broker_sock_addr.sun_path)
+    + 1;
+  broker_sock_addr.sun_len = len;
+#else /* vanilla 4.3BSD */
+  len = strlen (broker_sock_addr.sun_path) + sizeof (broker_sock_addr.sun_family) + 1;
+#endif
+
+  if (connect (fd, (struct sockaddr *) &broker_sock_addr, len) < 0)
+    {
+      CLOSE_SOCKET (fd);
+      return (INVALID_SOCKET);
+    }
+
+  return (fd);
+}
+#endif /* !LIBCAS_FOR_JSP && !WINDOWS */
+
 SOCKET
 net_connect_client (SOCKET srv_sock_fd)
 {
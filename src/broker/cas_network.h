@@ -276,6 +276,7 @@ typedef struct
 extern SOCKET net_connect_proxy (int proxy_id);
 #else /* WINDOWS */
 extern SOCKET net_connect_proxy (void);
+extern SOCKET net_connect_broker (void);
 #endif /* !WINDOWS */
 extern SOCKET net_connect_client (SOCKET srv_sock_fd);
 
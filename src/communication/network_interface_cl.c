@@ -6326,18 +6326,20 @@ btree_class_test_unique (char *buf, int buf_size)
  *   volid(in):
  *   pageid(in):
  *   buffer(in):
+ *   buffer_area_size(in): size of buffer; the server sends as many of the following pages as fit in it
  *   buffer_size(in):
  *
  * NOTE:
  */
 int
-qfile_get_list_file_page (QUERY_ID query_id, VOLID volid, PAGEID pageid, char *buffer, int *buffer_size)
+qfile_get_list_file_page (QUERY_ID query_id, VOLID volid, PAGEID pageid, char *buffer, int buffer_area_size,
+			  int *buffer_size)
 {
 #if defined(CS_MODE)
   int error = ER_NET_CLIENT_DATA_RECEIVE;
   int req_error;
   char *ptr;
-  OR_ALIGNED_BUF (OR_PTR_SIZE + OR_INT_SIZE + OR_INT_SIZE) a_request;
+  OR_ALIGNED_BUF (OR_PTR_SIZE + OR_INT_SIZE + OR_INT_SIZE + OR_INT_SIZE) a_request;
   char *request;
   OR_ALIGNED_BUF (OR_INT_SIZE * 2) a_reply;
   char *reply;
@@ -6348,6 +6350,7 @@ qfile_get_list_file_page (QUERY_ID query_id, VOLID volid, PAGEID pageid, char *b
   ptr = or_pack_ptr (request, query_id);
   ptr = or_pack_int (ptr, (int) volid);
   ptr = or_pack_int (ptr, (int) pageid);
+  ptr = or_pack_int (ptr, buffer_area_size);
 
   req_error =
     net_client_request2_no_malloc (NET_SERVER_LS_GET_LIST_FILE_PAGE, request, OR_ALIGNED_BUF_SIZE (a_request), reply,
@@ -6364,7 +6367,8 @@ qfile_get_list_file_page (QUERY_ID query_id, VOLID volid, PAGEID pageid, char *b
 
   THREAD_ENTRY *thread_p = enter_server ();
 
-  success = xqfile_get_list_file_page (thread_p, query_id, volid, pageid, buffer, &page_size);
+  success = xqfile_get_list_file_page (thread_p, query_id, volid, pageid, buffer, buffer_area_size, &page_size);
+  *buffer_size = page_size;
 
   exit_server (*thread_p);
 
@@ -4595,11 +4595,12 @@ void
 sqfile_get_list_file_page (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen)
 {
   QUERY_ID query_id;
-  int volid, pageid;
+  int volid, pageid, fetch_size;
   char *ptr;
   OR_ALIGNED_BUF (OR_INT_SIZE * 2) a_reply;
   char *reply = OR_ALIGNED_BUF_START (a_reply);
   char page_buf[IO_MAX_PAGE_SIZE + MAX_ALIGNMENT], *aligned_page_buf;
+  char *fetch_buf = NULL;
   int page_size;
   int error = NO_ERROR;
 
@@ -4608,13 +4609,43 @@ sqfile_get_list_file_page (THREAD_ENTRY * thread_p, unsigned int rid, char *requ
   ptr = or_unpack_ptr (request, &query_id);
   ptr = or_unpack_int (ptr, &volid);
   ptr = or_unpack_int (ptr, &pageid);
+  if (ptr - request + OR_INT_SIZE <= reqlen)
+    {
+      ptr = or_unpack_int (ptr, &fetch_size);
+    }
+  else
+    {
+      /* the client did not send a fetch size; return a single network page */
+      fetch_size = IO_MAX_PAGE_SIZE;
+    }
 
   if (volid == NULL_VOLID && pageid == NULL_PAGEID)
     {
       goto empty_page;
     }
 
-  error = xqfile_get_list_file_page (thread_p, query_id, volid, pageid, aligned_page_buf, &page_size);
+  /* the client asks for a window of pages; a window larger than a network page needs its own buffer */
+  fetch_size = MIN (fetch_size, QFILE_MAX_FETCH_PAGES * DB_PAGESIZE);
+  if (fetch_size > IO_MAX_PAGE_SIZE)
+    {
+      fetch_buf = (char *) db_private_alloc (thread_p, fetch_size + MAX_ALIGNMENT);
+      if (fetch_buf != NULL)
+	{
+	  aligned_page_buf = PTR_ALIGN (fetch_buf, MAX_ALIGNMENT);
+	}
+      else
+	{
+	  /* fall back to one network page */
+	  er_clear ();
+	  fetch_size = IO_MAX_PAGE_SIZE;
+	}
+    }
+  else
+    {
+      fetch_size = IO_MAX_PAGE_SIZE;
+    }
+
+  error = xqfile_get_list_file_page (thread_p, query_id, volid, pageid, aligned_page_buf, fetch_size, &page_size);
   if (error != NO_ERROR)
     {
       (void) return_error_to_client (thread_p, rid);
@@ -4630,6 +4661,10 @@ sqfile_get_list_file_page (THREAD_ENTRY * thread_p, unsigned int rid, char *requ
   ptr = or_pack_int (ptr, error);
   css_send_reply_and_data_to_client (thread_p->conn_entry, rid, reply, OR_ALIGNED_BUF_SIZE (a_reply), aligned_page_buf,
 				     page_size);
+  if (fetch_buf != NULL)
+    {
+      db_private_free_and_init (thread_p, fetch_buf);
+    }
   return;
 
 empty_page:
@@ -4640,6 +4675,10 @@ empty_page:
   ptr = or_pack_int (ptr, error);
   css_send_reply_and_data_to_client (thread_p->conn_entry, rid, reply, OR_ALIGNED_BUF_SIZE (a_reply), aligned_page_buf,
 				     page_size);
+  if (fetch_buf != NULL)
+    {
+      db_private_free_and_init (thread_p, fetch_buf);
+    }
 }
 
 /*
@@ -983,6 +983,8 @@ net_server_request (THREAD_ENTRY * thread_p, unsigned int rid, int request, int
   int status = CSS_NO_ERRORS;
   int error_code;
   CSS_CONN_ENTRY *conn;
+  bool is_perf_tracking;
+  TSC_TICKS start_tick, end_tick;
 
   if (buffer == NULL && size > 0)
     {
@@ -1089,8 +1091,21 @@ net_server_request (THREAD_ENTRY * thread_p, unsigned int rid, int request, int
 	{
 	  logtb_invalidate_snapshot_data (thread_p);
 	}
+
+      is_perf_tracking = perfmon_is_perf_tracking ();
+      if (is_perf_tracking)
+	{
+	  tsc_getticks (&start_tick);
+	}
+
       (*func) (thread_p, rid, buffer, size);
 
+      if (is_perf_tracking)
+	{
+	  tsc_getticks (&end_tick);
+	  perfmon_add_request_latency (request, tsc_elapsed_utime (end_tick, start_tick));
+	}
+
       thread_p->pop_resource_tracks ();
 
       /* defence code: let other threads continue. */
@@ -0,0 +1,124 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * connection_event_loop.hpp - epoll event loop listening to client connections (see server_support.c)
+ */
+
+#ifndef _CONNECTION_EVENT_LOOP_HPP_
+#define _CONNECTION_EVENT_LOOP_HPP_
+
+#if !defined (SERVER_MODE)
+#error Wrong module
+#endif // not SERVER_MODE
+
+#if defined (LINUX)
+
+#include "connection_defs.h"
+#include "thread_entry_task.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <unordered_set>
+
+#include <unistd.h>
+
+// css_event_loop_task - daemon task that listens to many connections with one epoll descriptor, instead of a
+//                       connection thread per connection (see css_connection_handler_thread).
+//
+// each execution waits for socket events for a short while. the event loop itself never reads a packet: once the whole
+// packet header of a connection is in the socket buffer (checked with a non-blocking peek), the connection is handed
+// to a connection worker that reads and queues the packet and pushes a server task for a new command. connections are
+// registered with EPOLLONESHOT, so the socket is not watched while a worker reads from it; the worker arms it again
+// when it is done. a slow client can therefore hold a worker while the rest of its packet arrives, but never the loop.
+//
+// a connection whose packet header arrived only in part is not armed again right away: the peeked bytes stay in the
+// socket buffer, so the level-triggered event would fire again at once. it is armed by the next check of connections
+// instead, and a stalled client wakes the loop once per check at most.
+//
+// connections that are closed or broken are removed and their error handler is run on connection worker pool.
+//
+// note: connections are not checked with css_peer_alive like in css_connection_handler_thread; it may block the loop
+//       for seconds. a dead peer is detected when the socket is closed by TCP.
+//
+class css_event_loop_task : public cubthread::entry_task
+{
+public:
+
+  css_event_loop_task (void) = delete;
+
+  css_event_loop_task (int epoll_fd)
+  : m_epoll_fd (epoll_fd)
+  , m_mutex ()
+  , m_connections ()
+  , m_partial_headers ()
+  , m_last_check_time ()
+  , m_last_ha_check_time ()
+  {
+    //
+  }
+
+  ~css_event_loop_task (void)
+  {
+    // connection workers may still be reading for this loop
+    std::unique_lock<std::mutex> ulock (m_mutex);
+    m_reads_cv.wait (ulock, [this] { return m_reading.empty (); });
+    ulock.unlock ();
+
+    close (m_epoll_fd);
+  }
+
+  int add (CSS_CONN_ENTRY & conn);
+  void read (THREAD_ENTRY & thread_ref, CSS_CONN_ENTRY & conn);
+
+  void execute (context_type & thread_ref) override final;
+
+  // retire not overwritten; task is deleted when daemon is destroyed
+
+  static const int WAIT_MSEC = 100;             // same as css_connection_handler_thread poll timeout
+
+private:
+  using clock_type = std::chrono::steady_clock;
+
+  static const int MAX_EVENTS = 64;
+  static const int HA_CHECK_MSEC = 5000;        // same as css_connection_handler_thread peer alive timeout
+
+  void remove (CSS_CONN_ENTRY & conn);
+  void close_connection (CSS_CONN_ENTRY & conn);
+  void remove_blocked_connection (CSS_CONN_ENTRY & conn);
+  void check_connections (THREAD_ENTRY & thread_ref);
+  bool is_header_ready (CSS_CONN_ENTRY & conn, bool & is_closed);
+  void start_read (CSS_CONN_ENTRY & conn);
+  void end_read (CSS_CONN_ENTRY & conn, bool keep_listening);
+  void arm (CSS_CONN_ENTRY & conn);
+  bool is_listening_idle (CSS_CONN_ENTRY & conn);
+
+  int m_epoll_fd;
+  std::mutex m_mutex;                                       // protects m_connections, m_reading and m_partial_headers
+  std::condition_variable m_reads_cv;                       // notified when a read ends
+  std::unordered_set<CSS_CONN_ENTRY *> m_connections;       // connections added to m_epoll_fd
+  std::unordered_set<CSS_CONN_ENTRY *> m_reading;           // connections handed to a connection worker
+  std::unordered_set<CSS_CONN_ENTRY *> m_partial_headers;   // connections with part of a header, armed by next check
+  clock_type::time_point m_last_check_time;
+  clock_type::time_point m_last_ha_check_time;
+};
+
+#endif /* LINUX */
+
+#endif /* _CONNECTION_EVENT_LOOP_HPP_ */
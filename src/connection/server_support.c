@@ -25,11 +25,14 @@
 #include "server_support.h"
 
 #include "config.h"
+#include "connection_event_loop.hpp"
 #include "load_worker_manager.hpp"
 #include "log_append.hpp"
 #include "session.h"
+#include "thread_daemon.hpp"
 #include "thread_entry_task.hpp"
 #include "thread_entry.hpp"
+#include "thread_looper.hpp"
 #include "thread_manager.hpp"
 #include "thread_worker_pool.hpp"
 
@@ -47,8 +50,17 @@
 #include <fcntl.h>
 #include <netinet/in.h>
 #endif /* !WINDOWS */
+#if defined (LINUX)
+#include <sys/epoll.h>
+#endif /* LINUX */
 #include <assert.h>
 
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
 #include "porting.h"
 #include "memory_alloc.h"
 #include "boot_sr.h"
@@ -202,6 +214,59 @@ private:
   CSS_CONN_ENTRY &m_conn;
 };
 
+// css_connection_close_task - run connection error handler of a connection an event loop stopped listening to. the
+//                             handler may wait a long time for transaction workers, so it is not run by event loop.
+class css_connection_close_task : public cubthread::entry_task
+{
+public:
+
+  css_connection_close_task (void) = delete;
+
+  css_connection_close_task (CSS_CONN_ENTRY & conn)
+  : m_conn (conn)
+  {
+    //
+  }
+
+  void execute (context_type & thread_ref) override final;
+
+  // retire not overwritten; task is automatically deleted
+
+private:
+  CSS_CONN_ENTRY &m_conn;
+};
+
+#if defined (LINUX)
+// css_connection_read_task - read and queue a packet of a connection whose packet header is ready, for an event loop
+class css_connection_read_task : public cubthread::entry_task
+{
+public:
+
+  css_connection_read_task (void) = delete;
+
+  css_connection_read_task (css_event_loop_task & event_loop, CSS_CONN_ENTRY & conn)
+  : m_event_loop (event_loop)
+  , m_conn (conn)
+  {
+    //
+  }
+
+  void execute (context_type & thread_ref) override final
+  {
+    m_event_loop.read (thread_ref, m_conn);
+  }
+
+  // retire not overwritten; task is automatically deleted
+
+private:
+  css_event_loop_task &m_event_loop;
+  CSS_CONN_ENTRY &m_conn;
+};
+
+static std::vector<cubthread::daemon *> css_Event_loop_daemons;
+static std::vector<css_event_loop_task *> css_Event_loops;      // tasks of css_Event_loop_daemons
+#endif /* LINUX */
+
 static const size_t CSS_JOB_QUEUE_SCAN_COLUMN_COUNT = 4;
 
 static void css_setup_server_loop (void);
@@ -253,6 +318,9 @@ css_count_transaction_worker_threads_mapfunc (THREAD_ENTRY & thread_ref, bool &
 static HA_SERVER_STATE css_transit_ha_server_state (THREAD_ENTRY * thread_p, HA_SERVER_STATE req_state);
 
 static bool css_get_connection_thread_pooling_configuration (void);
+static int css_get_event_loop_count_configuration (void);
+static void css_start_event_loops (void);
+static void css_stop_event_loops (void);
 static cubthread::wait_seconds css_get_connection_thread_timeout_configuration (void);
 static bool css_get_server_request_thread_pooling_configuration (void);
 static cubthread::wait_seconds css_get_server_request_thread_timeout_configuration (void);
@@ -1181,6 +1249,19 @@ css_internal_connection_handler (CSS_CONN_ENTRY * conn)
 {
   css_insert_into_active_conn_list (conn);
 
+#if defined (LINUX)
+  if (!css_Event_loops.empty ())
+    {
+      // spread connections over event loops by index
+      css_event_loop_task *event_loop = css_Event_loops[conn->idx % css_Event_loops.size ()];
+      if (event_loop->add (*conn) == NO_ERROR)
+	{
+	  return NO_ERRORS;
+	}
+      // fall back to connection thread
+    }
+#endif /* LINUX */
+
   // push connection handler task
   cubthread::get_manager ()->push_task (css_Connection_worker_pool, new css_connection_task (*conn));
 
@@ -1355,6 +1436,8 @@ css_init (THREAD_ENTRY * thread_p, char *server_name, int name_length, int port_
       goto shutdown;
     }
 
+  css_start_event_loops ();
+
   css_Server_connection_socket = INVALID_SOCKET;
 
   conn = css_connect_to_master_server (port_id, server_name, name_length);
@@ -1420,6 +1503,9 @@ shutdown:
   css_Server_request_worker_pool->er_log_stats ();
   css_Connection_worker_pool->er_log_stats ();
 
+  // all connections are blocked; stop listening to them before connection workers are destroyed
+  css_stop_event_loops ();
+
   // destroy thread worker pools
   thread_get_manager ()->destroy_worker_pool (css_Server_request_worker_pool);
   thread_get_manager ()->destroy_worker_pool (css_Connection_worker_pool);
@@ -2808,6 +2894,372 @@ css_connection_task::execute (context_type & thread_ref)
   thread_ref.conn_entry = NULL;
 }
 
+void
+css_connection_close_task::execute (context_type & thread_ref)
+{
+  thread_ref.conn_entry = &m_conn;
+  thread_ref.type = TT_SERVER;
+
+  er_log_debug (ARG_FILE_LINE, "css_connection_close_task: conn { status %d transaction_id %d db_error %d "
+                "stop_talk %d stop_phase %d }\n", m_conn.status, m_conn.get_tran_index (), m_conn.db_error,
+                m_conn.stop_talk, m_conn.stop_phase);
+
+  // connection error handler expects tran_index_lock to be locked
+  pthread_mutex_lock (&thread_ref.tran_index_lock);
+  (*css_Connection_error_handler) (&thread_ref, &m_conn);
+
+  thread_ref.conn_entry = NULL;
+}
+
+#if defined (LINUX)
+//
+// css_event_loop_task::add () - start listening to connection
+//
+// return    : NO_ERROR or ER_FAILED
+// conn (in) : new connection
+//
+int
+css_event_loop_task::add (CSS_CONN_ENTRY & conn)
+{
+  struct epoll_event ev;
+
+  memset (&ev, 0, sizeof (ev));
+  ev.events = EPOLLIN | EPOLLRDHUP | EPOLLONESHOT;
+  ev.data.ptr = &conn;
+
+  std::unique_lock<std::mutex> ulock (m_mutex);
+  if (epoll_ctl (m_epoll_fd, EPOLL_CTL_ADD, conn.fd, &ev) != 0)
+    {
+      er_log_debug (ARG_FILE_LINE, "css_event_loop_task::add: epoll_ctl () error %d on fd %d\n", errno, conn.fd);
+      return ER_FAILED;
+    }
+  m_connections.insert (&conn);
+  return NO_ERROR;
+}
+
+//
+// css_event_loop_task::remove () - stop listening to connection
+//
+// conn (in) : connection
+//
+void
+css_event_loop_task::remove (CSS_CONN_ENTRY & conn)
+{
+  std::unique_lock<std::mutex> ulock (m_mutex);
+
+  // fd may be already closed; it is removed from epoll set automatically then
+  (void) epoll_ctl (m_epoll_fd, EPOLL_CTL_DEL, conn.fd, NULL);
+  m_connections.erase (&conn);
+  m_partial_headers.erase (&conn);
+}
+
+//
+// css_event_loop_task::close_connection () - stop listening to connection and run its error handler
+//
+// conn (in) : connection
+//
+void
+css_event_loop_task::close_connection (CSS_CONN_ENTRY & conn)
+{
+  remove (conn);
+
+  // conn may be freed by the close task; don't use it after push
+  cubthread::get_manager ()->push_task (css_Connection_worker_pool, new css_connection_close_task (conn));
+}
+
+//
+// css_event_loop_task::remove_blocked_connection () - stop listening to connection blocked by
+//                                                     css_block_all_active_conn; its error handler is run only if it
+//                                                     is broken.
+//
+// conn (in) : connection
+//
+void
+css_event_loop_task::remove_blocked_connection (CSS_CONN_ENTRY & conn)
+{
+  assert (conn.stop_talk);
+
+  if (css_check_conn (&conn) != NO_ERROR)
+    {
+      close_connection (conn);
+    }
+  else
+    {
+      remove (conn);
+    }
+}
+
+//
+// css_event_loop_task::check_connections () - check status of all connections, like css_connection_handler_thread
+//                                             does for one connection.
+//
+// thread_ref (in) : thread entry
+//
+void
+css_event_loop_task::check_connections (THREAD_ENTRY & thread_ref)
+{
+  clock_type::time_point now = clock_type::now ();
+  bool check_ha;
+  std::vector<CSS_CONN_ENTRY *> connections;
+
+  if (now - m_last_check_time < std::chrono::milliseconds (WAIT_MSEC))
+    {
+      return;
+    }
+  m_last_check_time = now;
+
+  check_ha = now - m_last_ha_check_time >= std::chrono::milliseconds (HA_CHECK_MSEC);
+  if (check_ha)
+    {
+      m_last_ha_check_time = now;
+    }
+
+  {
+    std::unique_lock<std::mutex> ulock (m_mutex);
+    connections.assign (m_connections.begin (), m_connections.end ());
+  }
+
+  for (CSS_CONN_ENTRY *conn : connections)
+    {
+      if (!is_listening_idle (*conn))
+        {
+          // a connection worker is reading from it, or it was removed by one
+          continue;
+        }
+
+      if (conn->stop_talk)
+        {
+          remove_blocked_connection (*conn);
+          continue;
+        }
+
+      int conn_status = conn->status;
+      if (conn_status == CONN_CLOSING)
+        {
+          // synchronize with worker thread which may be in sboot_notify_unregister_client, to let it have a chance to
+          // send reply to client. see css_connection_handler_thread.
+          rmutex_lock (&thread_ref, &conn->rmutex);
+          conn_status = conn->status;
+          rmutex_unlock (&thread_ref, &conn->rmutex);
+        }
+      if (conn_status != CONN_OPEN)
+        {
+          close_connection (*conn);
+          continue;
+        }
+
+      if (check_ha && ha_Server_state == HA_SERVER_STATE_TO_BE_STANDBY && conn->in_transaction == false
+          && css_count_transaction_worker_threads (&thread_ref, conn->get_tran_index (), conn->client_id) == 0)
+        {
+          close_connection (*conn);
+        }
+    }
+
+  // listen again to connections that had part of a packet header; closed ones were removed above
+  std::unique_lock<std::mutex> ulock (m_mutex);
+  for (CSS_CONN_ENTRY *conn : m_partial_headers)
+    {
+      arm (*conn);
+    }
+  m_partial_headers.clear ();
+}
+
+//
+// css_event_loop_task::is_listening_idle () - is connection still listened to by this loop and not being read?
+//
+// return    : true if loop may act on connection
+// conn (in) : connection
+//
+bool
+css_event_loop_task::is_listening_idle (CSS_CONN_ENTRY & conn)
+{
+  std::unique_lock<std::mutex> ulock (m_mutex);
+  return m_connections.find (&conn) != m_connections.end () && m_reading.find (&conn) == m_reading.end ();
+}
+
+//
+// css_event_loop_task::arm () - listen again to a connection registered with EPOLLONESHOT
+//
+// conn (in) : connection
+//
+// note: caller must hold m_mutex
+//
+void
+css_event_loop_task::arm (CSS_CONN_ENTRY & conn)
+{
+  struct epoll_event ev;
+
+  memset (&ev, 0, sizeof (ev));
+  ev.events = EPOLLIN | EPOLLRDHUP | EPOLLONESHOT;
+  ev.data.ptr = &conn;
+
+  if (epoll_ctl (m_epoll_fd, EPOLL_CTL_MOD, conn.fd, &ev) != 0)
+    {
+      // the socket is probably closed; the connection is checked by check_connections
+      er_log_debug (ARG_FILE_LINE, "css_event_loop_task::arm: epoll_ctl () error %d on fd %d\n", errno, conn.fd);
+    }
+}
+
+//
+// css_event_loop_task::is_header_ready () - check without blocking whether a whole packet header can be read
+//
+// return         : true if the packet header is in the socket buffer
+// conn (in)      : connection
+// is_closed (out): true if the socket is closed by peer or broken
+//
+bool
+css_event_loop_task::is_header_ready (CSS_CONN_ENTRY & conn, bool & is_closed)
+{
+  char header[sizeof (NET_HEADER)];
+  ssize_t len;
+
+  is_closed = false;
+
+  len = recv (conn.fd, header, sizeof (header), MSG_PEEK | MSG_DONTWAIT);
+  if (len == 0)
+    {
+      is_closed = true;
+      return false;
+    }
+  if (len < 0)
+    {
+      is_closed = (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR);
+      return false;
+    }
+  return (size_t) len == sizeof (header);
+}
+
+//
+// css_event_loop_task::start_read () - hand connection to a connection worker that reads its next packet
+//
+// conn (in) : connection with a packet header ready
+//
+void
+css_event_loop_task::start_read (CSS_CONN_ENTRY & conn)
+{
+  {
+    std::unique_lock<std::mutex> ulock (m_mutex);
+    m_reading.insert (&conn);
+  }
+
+  cubthread::get_manager ()->push_task (css_Connection_worker_pool, new css_connection_read_task (*this, conn));
+}
+
+//
+// css_event_loop_task::end_read () - connection worker is done reading
+//
+// conn (in)           : connection
+// keep_listening (in) : true to listen to the connection again, false to remove it
+//
+void
+css_event_loop_task::end_read (CSS_CONN_ENTRY & conn, bool keep_listening)
+{
+  std::unique_lock<std::mutex> ulock (m_mutex);
+
+  // the connection is removed in the same critical section, so check_connections cannot remove it again
+  m_reading.erase (&conn);
+  if (keep_listening)
+    {
+      arm (conn);
+    }
+  else
+    {
+      (void) epoll_ctl (m_epoll_fd, EPOLL_CTL_DEL, conn.fd, NULL);
+      m_connections.erase (&conn);
+    }
+  m_reads_cv.notify_all ();
+}
+
+//
+// css_event_loop_task::read () - read and queue a packet of connection; executed by a connection worker
+//
+// thread_ref (in) : connection worker entry
+// conn (in)       : connection handed over by start_read
+//
+void
+css_event_loop_task::read (THREAD_ENTRY & thread_ref, CSS_CONN_ENTRY & conn)
+{
+  int type;
+  css_error_code status;
+  bool is_broken;
+
+  // the packet header is in the socket buffer; the rest of the packet is read blocking, like connection threads do
+  status = (css_error_code) css_read_and_queue (&conn, &type);
+  if (status == NO_ERRORS)
+    {
+      // if new command request has arrived, make new job and add it to job queue
+      if (type == COMMAND_TYPE)
+        {
+          css_push_server_task (conn);
+        }
+      end_read (conn, true);
+      return;
+    }
+
+  er_log_debug (ARG_FILE_LINE, "css_event_loop_task: css_read_and_queue() error %d\n", status);
+
+  // connections blocked by css_block_all_active_conn run their error handler only if they are broken
+  is_broken = !conn.stop_talk || css_check_conn (&conn) != NO_ERROR;
+  end_read (conn, false);
+  if (is_broken)
+    {
+      // conn may be freed by the close task; don't use it after push
+      cubthread::get_manager ()->push_task (css_Connection_worker_pool, new css_connection_close_task (conn));
+    }
+}
+
+void
+css_event_loop_task::execute (context_type & thread_ref)
+{
+  struct epoll_event events[MAX_EVENTS];
+  int n;
+  bool is_closed;
+
+  n = epoll_wait (m_epoll_fd, events, MAX_EVENTS, WAIT_MSEC);
+  if (n < 0 && errno != EINTR)
+    {
+      er_log_debug (ARG_FILE_LINE, "css_event_loop_task: epoll_wait () error %d\n", errno);
+    }
+
+  for (int i = 0; i < n; i++)
+    {
+      CSS_CONN_ENTRY *conn = (CSS_CONN_ENTRY *) events[i].data.ptr;
+
+      if (conn->stop_talk)
+        {
+          remove_blocked_connection (*conn);
+          continue;
+        }
+
+      if (events[i].events & (EPOLLERR | EPOLLHUP))
+        {
+          close_connection (*conn);
+          continue;
+        }
+
+      // hand the connection to a worker only when the read cannot block on the packet header
+      if (is_header_ready (*conn, is_closed))
+        {
+          start_read (*conn);
+        }
+      else if (is_closed || (events[i].events & EPOLLRDHUP))
+        {
+          // peer shut down its side; the rest of the header never comes
+          close_connection (*conn);
+        }
+      else
+        {
+          // part of the header arrived; its bytes are still in the socket buffer, so arming the connection now would
+          // wake the loop at once. check_connections arms it again.
+          std::unique_lock<std::mutex> ulock (m_mutex);
+          m_partial_headers.insert (conn);
+        }
+    }
+
+  check_connections (thread_ref);
+}
+#endif /* LINUX */
+
 //
 // css_stop_non_log_writer () - function mapped over worker pools to search and stop non-log writer workers
 //
@@ -3240,7 +3692,66 @@ css_count_transaction_worker_threads (THREAD_ENTRY * thread_p, int tran_index, i
 static bool
 css_get_connection_thread_pooling_configuration (void)
 {
-  return prm_get_bool_value (PRM_ID_THREAD_CONNECTION_POOLING);
+  // with event loops, connection threads only run connection error handlers; don't keep them
+  return prm_get_bool_value (PRM_ID_THREAD_CONNECTION_POOLING) && css_get_event_loop_count_configuration () == 0;
+}
+
+static int
+css_get_event_loop_count_configuration (void)
+{
+#if defined (LINUX)
+  return prm_get_integer_value (PRM_ID_CSS_EVENT_LOOP_COUNT);
+#else
+  // epoll is required
+  return 0;
+#endif
+}
+
+//
+// css_start_event_loops () - start event loop daemons that listen to client connections, if configured. otherwise,
+//                            or if they cannot be started, each connection gets a connection thread.
+//
+static void
+css_start_event_loops (void)
+{
+#if defined (LINUX)
+  int count = css_get_event_loop_count_configuration ();
+
+  for (int i = 0; i < count; i++)
+    {
+      int epoll_fd = epoll_create1 (EPOLL_CLOEXEC);
+      if (epoll_fd < 0)
+        {
+          er_log_debug (ARG_FILE_LINE, "css_start_event_loops: epoll_create1 () error %d\n", errno);
+          break;
+        }
+
+      css_event_loop_task *event_loop = new css_event_loop_task (epoll_fd);
+      // never sleep between executions; the task waits for events itself
+      cubthread::looper looper = cubthread::looper (std::chrono::milliseconds (0));
+
+      css_Event_loops.push_back (event_loop);
+      css_Event_loop_daemons.push_back (cubthread::get_manager ()->create_daemon (looper, event_loop,
+                                                                                  "connection_event_loop"));
+    }
+#endif /* LINUX */
+}
+
+//
+// css_stop_event_loops () - stop event loop daemons
+//
+static void
+css_stop_event_loops (void)
+{
+#if defined (LINUX)
+  css_Event_loops.clear ();
+  for (cubthread::daemon *&daemon_p : css_Event_loop_daemons)
+    {
+      // also deletes event loop task
+      cubthread::get_manager ()->destroy_daemon (daemon_p);
+    }
+  css_Event_loop_daemons.clear ();
+#endif /* LINUX */
 }
 
 static cubthread::wait_seconds
@@ -475,6 +475,7 @@ static UTIL_ARG_MAP ua_Load_Option_Map[] = {
   {LOAD_TABLE_NAME_S, {ARG_STRING}, {0}},
   {LOAD_COMPARE_STORAGE_ORDER_S, {ARG_BOOLEAN}, {0}},
   {LOAD_CS_FORCE_LOAD_S, {ARG_BOOLEAN}, {0}},
+  {LOAD_DEFERRED_INDEX_S, {ARG_BOOLEAN}, {0}},
   {0, {0}, {0}}
 };
 
@@ -500,6 +501,7 @@ static GETOPT_LONG ua_Load_Option[] = {
   {LOAD_TABLE_NAME_L, 1, 0, LOAD_TABLE_NAME_S},
   {LOAD_COMPARE_STORAGE_ORDER_L, 0, 0, LOAD_COMPARE_STORAGE_ORDER_S},
   {LOAD_CS_FORCE_LOAD_L, 0, 0, LOAD_CS_FORCE_LOAD_S},
+  {LOAD_DEFERRED_INDEX_L, 0, 0, LOAD_DEFERRED_INDEX_S},
   {0, 0, 0, 0}
 };
 
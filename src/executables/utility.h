@@ -492,7 +492,8 @@ typedef enum
   LOADDB_MSG_TABLE_IS_MISSING = 120,
   LOADDB_MSG_IGNORED_CLASS = 121,
 
-  LOADDB_MSG_USAGE = 122
+  LOADDB_MSG_USAGE = 122,
+  LOADDB_MSG_UNIQUE_VIOLATION_SKIPPED = 123
 } MSGCAT_LOADDB_MSG;
 
 /* Message id in the set MSGCAT_UTIL_SET_MIGDB */
@@ -1273,6 +1274,8 @@ typedef struct _ha_config
 #define LOAD_COMPARE_STORAGE_ORDER_L            "compare-storage-order"
 #define LOAD_CS_FORCE_LOAD_S                    11824
 #define LOAD_CS_FORCE_LOAD_L                    "force-load"
+#define LOAD_DEFERRED_INDEX_S                   11825
+#define LOAD_DEFERRED_INDEX_L                   "deferred-index"
 
 /* unloaddb option list */
 #define UNLOAD_INPUT_CLASS_FILE_S               'i'
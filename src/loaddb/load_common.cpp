@@ -181,6 +181,7 @@ namespace cubload
     , error_file ()
     , ignore_logging (false)
     , compare_storage_order (false)
+    , deferred_index (false)
     , table_name ()
     , ignore_class_file ()
     , ignore_classes ()
@@ -210,6 +211,7 @@ namespace cubload
     serializator.pack_string (error_file);
     serializator.pack_bool (ignore_logging);
     serializator.pack_bool (compare_storage_order);
+    serializator.pack_bool (deferred_index);
     serializator.pack_string (table_name);
     serializator.pack_string (ignore_class_file);
 
@@ -246,6 +248,7 @@ namespace cubload
     deserializator.unpack_string (error_file);
     deserializator.unpack_bool (ignore_logging);
     deserializator.unpack_bool (compare_storage_order);
+    deserializator.unpack_bool (deferred_index);
     deserializator.unpack_string (table_name);
     deserializator.unpack_string (ignore_class_file);
 
@@ -290,6 +293,7 @@ namespace cubload
     size += serializator.get_packed_string_size (error_file, size);
     size += serializator.get_packed_bool_size (size); // ignore_logging
     size += serializator.get_packed_bool_size (size); // compare_storage_order
+    size += serializator.get_packed_bool_size (size); // deferred_index
     size += serializator.get_packed_string_size (table_name, size);
     size += serializator.get_packed_string_size (ignore_class_file, size);
 
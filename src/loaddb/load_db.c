@@ -1145,6 +1145,7 @@ get_loaddb_args (UTIL_ARG_MAP * arg_map, load_args * args)
   args->error_file = error_file ? error_file : empty;
   args->ignore_logging = utility_get_option_bool_value (arg_map, LOAD_IGNORE_LOGGING_S);
   args->compare_storage_order = utility_get_option_bool_value (arg_map, LOAD_COMPARE_STORAGE_ORDER_S);
+  args->deferred_index = utility_get_option_bool_value (arg_map, LOAD_DEFERRED_INDEX_S);
   args->table_name = table_name ? table_name : empty;
   args->ignore_class_file = ignore_class_file ? ignore_class_file : empty;
 }
@@ -373,6 +373,7 @@ namespace cubload
     , m_attrinfo ()
     , m_db_values ()
     , m_recdes_collected ()
+    , m_recdes_lines ()
     , m_scancache_started (false)
     , m_scancache ()
     , m_rows (0)
@@ -409,6 +410,7 @@ namespace cubload
     stop_scancache ();
 
     m_recdes_collected.clear ();
+    m_recdes_lines.clear ();
 
     m_clsid = NULL_CLASS_ID;
     m_class_entry = NULL;
@@ -504,6 +506,7 @@ namespace cubload
 	if (!m_error_handler.current_line_has_error ())
 	  {
 	    m_recdes_collected.push_back (std::move (new_recdes));
+	    m_recdes_lines.push_back (m_error_handler.get_driver_lineno ());
 	  }
 	else
 	  {
@@ -589,10 +592,12 @@ namespace cubload
       }
     else
       {
+	std::vector<locator_unique_violation> unique_violations;
+
 	log_sysop_start (m_thread_ref);
 	int error_code = locator_multi_insert_force (m_thread_ref, &m_scancache.node.hfid, &m_scancache.node.class_oid,
 			 m_recdes_collected, true, op_type, &m_scancache, &force_count, pruning_type, NULL, NULL,
-			 UPDATE_INPLACE_NONE, true);
+			 UPDATE_INPLACE_NONE, true, m_session.get_args ().deferred_index, &unique_violations);
 	if (error_code != NO_ERROR)
 	  {
 	    ASSERT_ERROR ();
@@ -603,7 +608,15 @@ namespace cubload
 	else
 	  {
 	    log_sysop_attach_to_outer (m_thread_ref);
-	    m_rows += m_recdes_collected.size ();
+	    m_rows += m_recdes_collected.size () - unique_violations.size ();
+	  }
+
+	// With deferred index keys, the rows that violate a unique index are left out of the batch.
+	for (const locator_unique_violation &violation : unique_violations)
+	  {
+	    assert (violation.record_index < m_recdes_lines.size ());
+	    m_error_handler.on_error_with_line (m_recdes_lines[violation.record_index], LOADDB_MSG_UNIQUE_VIOLATION_SKIPPED,
+						violation.index_name.c_str (), violation.key.c_str ());
 	  }
       }
   }
@@ -111,6 +111,7 @@ namespace cubload
       heap_cache_attrinfo m_attrinfo;
       std::vector<db_value> m_db_values;
       std::vector<record_descriptor> m_recdes_collected;
+      std::vector<int> m_recdes_lines; // line of each collected record in the data file
 
       bool m_scancache_started;
       heap_scancache m_scancache;
@@ -0,0 +1,128 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+//
+// monitor_histogram.cpp - implementation of log-linear histogram statistic
+//
+
+#include "monitor_histogram.hpp"
+
+#include <cassert>
+
+namespace cubmonitor
+{
+  histogram_atomic_statistic::histogram_atomic_statistic (void)
+    : m_max (0)
+  {
+    for (std::size_t index = 0; index < BUCKET_COUNT; index++)
+      {
+	m_buckets[index] = 0;
+      }
+  }
+
+  void
+  histogram_atomic_statistic::fetch (statistic_value *destination, fetch_mode mode /* = FETCH_GLOBAL */) const
+  {
+    if (mode == FETCH_TRANSACTION_SHEET)
+      {
+	// no transaction sheet
+	return;
+      }
+    for (std::size_t index = 0; index < BUCKET_COUNT; index++)
+      {
+	destination[index] = statistic_value_cast (m_buckets[index].load (std::memory_order_relaxed));
+      }
+  }
+
+  amount_rep
+  histogram_atomic_statistic::get_max (void) const
+  {
+    return m_max.load (std::memory_order_relaxed);
+  }
+
+  amount_rep
+  histogram_atomic_statistic::get_bucket_value (std::size_t index)
+  {
+    std::size_t shift;
+    amount_rep sub_bucket;
+
+    assert (index < BUCKET_COUNT);
+
+    if (index < SUB_BUCKET_COUNT)
+      {
+	return (amount_rep) index;
+      }
+
+    // reverse of get_bucket_index
+    shift = index / SUB_BUCKET_COUNT - 1;
+    sub_bucket = (amount_rep) (index % SUB_BUCKET_COUNT + SUB_BUCKET_COUNT);
+
+    return ((sub_bucket + 1) << shift) - 1;
+  }
+
+  amount_rep
+  histogram_atomic_statistic::get_total_count (const statistic_value *buckets)
+  {
+    amount_rep total = 0;
+
+    for (std::size_t index = 0; index < BUCKET_COUNT; index++)
+      {
+	total += amount_rep_cast (buckets[index]);
+      }
+    return total;
+  }
+
+  amount_rep
+  histogram_atomic_statistic::get_percentile (const statistic_value *buckets, double percentile)
+  {
+    amount_rep total = get_total_count (buckets);
+    amount_rep rank;
+    amount_rep count = 0;
+
+    if (total == 0)
+      {
+	return 0;
+      }
+
+    assert (percentile >= 0.0 && percentile <= 100.0);
+
+    // rank of the value in sorted collected values; at least first value
+    rank = (amount_rep) (percentile / 100.0 * (double) total + 0.5);
+    if (rank == 0)
+      {
+	rank = 1;
+      }
+    else if (rank > total)
+      {
+	rank = total;
+      }
+
+    for (std::size_t index = 0; index < BUCKET_COUNT; index++)
+      {
+	count += amount_rep_cast (buckets[index]);
+	if (count >= rank)
+	  {
+	    return get_bucket_value (index);
+	  }
+      }
+
+    // buckets changed while counting them? no, total was computed on the same buckets
+    assert (false);
+    return get_bucket_value (BUCKET_COUNT - 1);
+  }
+} // namespace cubmonitor
@@ -0,0 +1,154 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+//
+// monitor_histogram.hpp - log-linear histogram statistic
+//
+//  a histogram keeps the distribution of collected values, so percentiles (e.g. p99 of a latency) can be computed,
+//  not just totals and averages.
+//
+//  buckets are log-linear (like HDR histograms): values below SUB_BUCKET_COUNT have one bucket each; then each range
+//  [2^n, 2^(n+1)) is split in SUB_BUCKET_COUNT buckets of equal size. any value reported from the histogram is
+//  therefore within 1 / SUB_BUCKET_COUNT of the values it represents, whatever the magnitude. values bigger than
+//  MAX_VALUE are counted in the last bucket.
+//
+//  collect is lock-free: one atomic increment of the bucket counter and, only if the value is a new maximum, a compare
+//  and exchange of the maximum.
+//
+//  How to use:
+//
+//          cubmonitor::histogram_atomic_statistic my_latency_stat;
+//
+//          cubmonitor::time_point start_pt = cubmonitor::clock_type::now ();
+//          // do some operations
+//          my_latency_stat.collect (cubmonitor::clock_type::now () - start_pt);   // collected as microseconds
+//
+//          // fetch bucket counts and compute percentiles
+//          cubmonitor::statistic_value buckets[cubmonitor::histogram_atomic_statistic::BUCKET_COUNT];
+//          my_latency_stat.fetch (buckets);
+//          cubmonitor::amount_rep p99 = cubmonitor::histogram_atomic_statistic::get_percentile (buckets, 99.0);
+//
+
+#if !defined _MONITOR_HISTOGRAM_HPP_
+#define _MONITOR_HISTOGRAM_HPP_
+
+#include "monitor_statistic.hpp"
+
+#include <atomic>
+
+#include <cstddef>
+#if defined (WINDOWS)
+#include <intrin.h>
+#endif
+
+namespace cubmonitor
+{
+  class histogram_atomic_statistic
+  {
+    public:
+      static const std::size_t SUB_BUCKET_BITS = 4;
+      static const std::size_t SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+      static const std::size_t MAX_VALUE_BITS = 36;                   // as microseconds, it is more than 19 hours
+      static const amount_rep MAX_VALUE = (((amount_rep) 1) << MAX_VALUE_BITS) - 1;
+      static const std::size_t BUCKET_COUNT = (MAX_VALUE_BITS - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+      histogram_atomic_statistic (void);
+      histogram_atomic_statistic (const histogram_atomic_statistic &) = delete;
+      histogram_atomic_statistic &operator= (const histogram_atomic_statistic &) = delete;
+
+      void collect (amount_rep value);
+      void collect (const time_rep &value);                           // collected as microseconds
+
+      // fetch interface for monitor registration - one statistic for each bucket, with its count
+      void fetch (statistic_value *destination, fetch_mode mode = FETCH_GLOBAL) const;
+      std::size_t get_statistics_count (void) const
+      {
+	return BUCKET_COUNT;
+      }
+
+      amount_rep get_max (void) const;
+
+      // bucket of a value
+      static std::size_t get_bucket_index (amount_rep value);
+      // highest value counted in bucket
+      static amount_rep get_bucket_value (std::size_t index);
+      // functions on fetched bucket counts
+      static amount_rep get_total_count (const statistic_value *buckets);
+      // the value below which are percentile % of collected values (0 if nothing was collected)
+      static amount_rep get_percentile (const statistic_value *buckets, double percentile);
+
+    private:
+      std::atomic<amount_rep> m_buckets[BUCKET_COUNT];
+      std::atomic<amount_rep> m_max;
+  };
+
+  //////////////////////////////////////////////////////////////////////////
+  // inline implementation
+  //////////////////////////////////////////////////////////////////////////
+
+  inline std::size_t
+  histogram_atomic_statistic::get_bucket_index (amount_rep value)
+  {
+    std::size_t msb;
+    std::size_t shift;
+
+    if (value < SUB_BUCKET_COUNT)
+      {
+	return (std::size_t) value;
+      }
+    if (value > MAX_VALUE)
+      {
+	value = MAX_VALUE;
+      }
+
+#if defined (WINDOWS)
+    unsigned long msb_index;
+    _BitScanReverse64 (&msb_index, value);
+    msb = (std::size_t) msb_index;
+#else
+    msb = 63 - (std::size_t) __builtin_clzll (value);
+#endif
+    shift = msb - SUB_BUCKET_BITS;
+
+    // first SUB_BUCKET_COUNT buckets are for values less than SUB_BUCKET_COUNT; then each power of two has
+    // SUB_BUCKET_COUNT buckets, indexed by the SUB_BUCKET_BITS bits after most significant bit
+    return (shift + 1) * SUB_BUCKET_COUNT + (std::size_t) (value >> shift) - SUB_BUCKET_COUNT;
+  }
+
+  inline void
+  histogram_atomic_statistic::collect (amount_rep value)
+  {
+    amount_rep loaded;
+
+    m_buckets[get_bucket_index (value)].fetch_add (1, std::memory_order_relaxed);
+
+    loaded = m_max.load (std::memory_order_relaxed);
+    while (loaded < value && !m_max.compare_exchange_weak (loaded, value, std::memory_order_relaxed))
+      {
+	// loaded was refreshed; try again while value is still bigger
+      }
+  }
+
+  inline void
+  histogram_atomic_statistic::collect (const time_rep &value)
+  {
+    collect (amount_rep_cast (statistic_value_cast (value)));
+  }
+} // namespace cubmonitor
+
+#endif // _MONITOR_HISTOGRAM_HPP_
@@ -127,6 +127,11 @@ typedef struct
 				 * # of {a, b} ... pkeys[key_size-1] -> # of {a, b, ..., x} */
   bool valid_limits;
   bool is_indexed;
+  bool has_col_stats;		/* true if ndv, null_frac and the histogram were gathered */
+  int ndv;			/* estimated number of distinct values */
+  double null_frac;		/* fraction of null values */
+  int n_hist_bounds;		/* number of histogram bounds; 0 if there is no histogram */
+  double *hist_bounds;		/* equi-depth histogram bounds, see stats_value_to_key () */
 } QO_ATTR_CUM_STATS;
 
 typedef struct qo_plan QO_PLAN;
@@ -204,6 +204,8 @@ make_mergelist_proc (QO_ENV * env, QO_PLAN * plan, XASL_NODE * left, PT_NODE * l
   ls_merge = &merge->proc.mergelist.ls_merge;
 
   ls_merge->join_type = plan->plan_un.join.join_type;
+  ls_merge->join_method =
+    (plan->plan_un.join.join_method == QO_JOINMETHOD_HASH_JOIN) ? QFILE_JOIN_METHOD_HASH : QFILE_JOIN_METHOD_MERGE;
 
   ncols = ls_merge->ls_column_cnt = bitset_cardinality (&(plan->plan_un.join.join_terms));
   assert (ncols > 0);
@@ -299,6 +301,13 @@ make_mergelist_proc (QO_ENV * env, QO_PLAN * plan, XASL_NODE * left, PT_NODE * l
 	}
       ls_merge->ls_inner_unique[cnt] = false;	/* currently, unused */
 
+      if (ls_merge->join_method == QFILE_JOIN_METHOD_HASH)
+	{
+	  /* hash join reads both list files unordered */
+	  cnt++;
+	  continue;
+	}
+
       /* set outer list order entry */
       prev_order = NULL;
       for (order = left->orderby_list; order; order = order->next)
@@ -921,7 +930,8 @@ add_sort_spec (QO_ENV * env, XASL_NODE * xasl, QO_PLAN * plan, DB_VALUE * ordby_
   if (instnum_flag)
     {
       if (xasl && subplan->plan_type == QO_PLANTYPE_JOIN
-	  && subplan->plan_un.join.join_method == QO_JOINMETHOD_MERGE_JOIN)
+	  && (subplan->plan_un.join.join_method == QO_JOINMETHOD_MERGE_JOIN
+	      || subplan->plan_un.join.join_method == QO_JOINMETHOD_HASH_JOIN))
 	{
 	  PT_NODE *instnum_pred;
 
@@ -1821,9 +1831,10 @@ gen_outer (QO_ENV * env, QO_PLAN * plan, BITSET * subqueries, XASL_NODE * inner_
 	  break;
 
 	case QO_JOINMETHOD_MERGE_JOIN:
+	case QO_JOINMETHOD_HASH_JOIN:
 	  /*
 	   * The optimizer isn't supposed to produce plans in which a
-	   * merge join isn't "shielded" by a sort (temp file) plan,
+	   * merge or hash join isn't "shielded" by a sort (temp file) plan,
 	   * precisely because XASL has a difficult time coping with
 	   * that.  Because of that, inner_scans should ALWAYS be NULL
 	   * here.
@@ -4220,7 +4231,8 @@ qo_check_join_for_multi_range_opt (QO_PLAN * plan)
 
   /* verify that this is a valid join for multi range optimization */
   if (plan == NULL || plan->plan_type != QO_PLANTYPE_JOIN || plan->plan_un.join.join_type != JOIN_INNER
-      || plan->plan_un.join.join_method == QO_JOINMETHOD_MERGE_JOIN)
+      || plan->plan_un.join.join_method == QO_JOINMETHOD_MERGE_JOIN
+      || plan->plan_un.join.join_method == QO_JOINMETHOD_HASH_JOIN)
     {
       return false;
     }
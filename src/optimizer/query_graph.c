@@ -4935,6 +4935,11 @@ qo_get_attr_info_func_index (QO_ENV * env, QO_SEGMENT * seg, const char *expr_st
   cum_statsp->key_type = NULL;
   cum_statsp->pkeys_size = 0;
   cum_statsp->pkeys = NULL;
+  cum_statsp->has_col_stats = false;
+  cum_statsp->ndv = 0;
+  cum_statsp->null_frac = 0;
+  cum_statsp->n_hist_bounds = 0;
+  cum_statsp->hist_bounds = NULL;
 
   /* set the statistics from the class information(QO_CLASS_INFO_ENTRY) */
   for (i = 0; i < n; class_info_entryp++, i++)
@@ -5063,6 +5068,7 @@ qo_get_attr_info (QO_ENV * env, QO_SEGMENT * seg)
   SM_CLASS_CONSTRAINT *consp;
   CLASS_STATS *stats;
   bool is_reserved_name = false;
+  double col_stats_objects = 0;
 
   if ((QO_SEG_PT_NODE (seg))->info.name.meta_class == PT_RESERVED)
     {
@@ -5107,6 +5113,11 @@ qo_get_attr_info (QO_ENV * env, QO_SEGMENT * seg)
       cum_statsp->key_type = NULL;
       cum_statsp->pkeys_size = 0;
       cum_statsp->pkeys = NULL;
+      cum_statsp->has_col_stats = false;
+      cum_statsp->ndv = 0;
+      cum_statsp->null_frac = 0;
+      cum_statsp->n_hist_bounds = 0;
+      cum_statsp->hist_bounds = NULL;
 
       return attr_infop;
     }
@@ -5120,6 +5131,11 @@ qo_get_attr_info (QO_ENV * env, QO_SEGMENT * seg)
   cum_statsp->key_type = NULL;
   cum_statsp->pkeys_size = 0;
   cum_statsp->pkeys = NULL;
+  cum_statsp->has_col_stats = false;
+  cum_statsp->ndv = 0;
+  cum_statsp->null_frac = 0;
+  cum_statsp->n_hist_bounds = 0;
+  cum_statsp->hist_bounds = NULL;
 
   /* set the statistics from the class information(QO_CLASS_INFO_ENTRY) */
   for (i = 0; i < n; class_info_entryp++, i++)
@@ -5171,6 +5187,41 @@ qo_get_attr_info (QO_ENV * env, QO_SEGMENT * seg)
 	  cum_statsp->valid_limits = true;
 	}
 
+      /* column statistics do not depend on indexes */
+      if (attr_statsp->col_stats.ndv > 0 || attr_statsp->col_stats.null_frac > 0)
+	{
+	  if (cum_statsp->has_col_stats && col_stats_objects + stats->heap_num_objects > 0)
+	    {
+	      /* a class hierarchy; values of the classes are assumed to be distinct, the histograms are not merged */
+	      cum_statsp->null_frac = ((cum_statsp->null_frac * col_stats_objects
+					+ attr_statsp->col_stats.null_frac * stats->heap_num_objects)
+				       / (col_stats_objects + stats->heap_num_objects));
+	      cum_statsp->ndv += attr_statsp->col_stats.ndv;
+	      if (cum_statsp->hist_bounds)
+		{
+		  free_and_init (cum_statsp->hist_bounds);
+		}
+	      cum_statsp->n_hist_bounds = 0;
+	    }
+	  else if (!cum_statsp->has_col_stats)
+	    {
+	      cum_statsp->has_col_stats = true;
+	      cum_statsp->ndv = attr_statsp->col_stats.ndv;
+	      cum_statsp->null_frac = attr_statsp->col_stats.null_frac;
+	      if (n == 1 && attr_statsp->col_stats.n_bounds > 0)
+		{
+		  cum_statsp->hist_bounds = (double *) malloc (attr_statsp->col_stats.n_bounds * sizeof (double));
+		  if (cum_statsp->hist_bounds != NULL)
+		    {
+		      memcpy (cum_statsp->hist_bounds, attr_statsp->col_stats.bounds,
+			      attr_statsp->col_stats.n_bounds * sizeof (double));
+		      cum_statsp->n_hist_bounds = attr_statsp->col_stats.n_bounds;
+		    }
+		}
+	    }
+	  col_stats_objects += stats->heap_num_objects;
+	}
+
       n_func_indexes = 0;
       n_unavail_indexes = 0;
       for (j = 0; j < attr_statsp->n_btstats; j++)
@@ -5316,6 +5367,10 @@ qo_free_attr_info (QO_ENV * env, QO_ATTR_INFO * info)
 	{
 	  free_and_init (cum_statsp->pkeys);
 	}
+      if (cum_statsp->hist_bounds)
+	{
+	  free_and_init (cum_statsp->hist_bounds);
+	}
       free_and_init (info);
     }
 }
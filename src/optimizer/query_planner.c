@@ -45,12 +45,14 @@
 #include "parser_message.h"
 #include "intl_support.h"
 #include "storage_common.h"
+#include "memory_hash.h"
 #include "xasl_analytic.hpp"
 #include "xasl_generation.h"
 #include "schema_manager.h"
 #include "network_interface_cl.h"
 #include "dbtype.h"
 #include "regu_var.hpp"
+#include "statistics.h"
 
 #define INDENT_INCR		4
 #define INDENT_FMT		"%*c"
@@ -141,6 +143,7 @@ static void qo_sscan_cost (QO_PLAN *);
 static void qo_iscan_cost (QO_PLAN *);
 static void qo_sort_cost (QO_PLAN *);
 static void qo_mjoin_cost (QO_PLAN *);
+static void qo_hjoin_cost (QO_PLAN *);
 static void qo_follow_cost (QO_PLAN *);
 static void qo_worst_cost (QO_PLAN *);
 static void qo_zero_cost (QO_PLAN *);
@@ -178,6 +181,7 @@ static int qo_examine_nl_join (QO_INFO *, JOIN_TYPE, QO_INFO *, QO_INFO *, BITSE
 			       BITSET *, int, BITSET *);
 static int qo_examine_merge_join (QO_INFO *, JOIN_TYPE, QO_INFO *, QO_INFO *, BITSET *, BITSET *, BITSET *, BITSET *,
 				  BITSET *);
+static int qo_examine_hash_join (QO_INFO *, JOIN_TYPE, QO_INFO *, QO_INFO *, BITSET *, BITSET *, BITSET *);
 static int qo_examine_correlated_index (QO_INFO *, JOIN_TYPE, QO_INFO *, QO_INFO *, BITSET *, BITSET *, BITSET *);
 static int qo_examine_follow (QO_INFO *, QO_TERM *, QO_INFO *, BITSET *, BITSET *);
 static void qo_compute_projected_segs (QO_PLANNER *, BITSET *, BITSET *, BITSET *);
@@ -322,6 +326,17 @@ static QO_PLAN_VTBL qo_merge_join_plan_vtbl = {
   "Merge join"
 };
 
+static QO_PLAN_VTBL qo_hash_join_plan_vtbl = {
+  "h-join",
+  qo_join_fprint,
+  qo_join_walk,
+  qo_join_free,
+  qo_hjoin_cost,
+  qo_hjoin_cost,
+  qo_join_info,
+  "Hash join"
+};
+
 static QO_PLAN_VTBL qo_follow_plan_vtbl = {
   "follow",
   qo_follow_fprint,
@@ -362,6 +377,7 @@ QO_PLAN_VTBL *all_vtbls[] = {
   &qo_nl_join_plan_vtbl,
   &qo_idx_join_plan_vtbl,
   &qo_merge_join_plan_vtbl,
+  &qo_hash_join_plan_vtbl,
   &qo_follow_plan_vtbl,
   &qo_set_follow_plan_vtbl,
   &qo_worst_plan_vtbl
@@ -410,6 +426,16 @@ static PRED_CLASS qo_classify (PT_NODE * attr);
 
 static int qo_index_cardinality (QO_ENV * env, PT_NODE * attr);
 
+static QO_ATTR_CUM_STATS *qo_get_attr_col_stats (QO_ENV * env, PT_NODE * attr);
+
+static bool qo_get_hist_key (QO_ENV * env, QO_ATTR_CUM_STATS * cum_statsp, PT_NODE * value, double *key_p);
+
+static double qo_hist_fraction_below (QO_ATTR_CUM_STATS * cum_statsp, double key);
+
+static double qo_hist_selectivity (QO_ENV * env, PT_NODE * attr, PT_NODE * lower, PT_NODE * upper);
+
+static double qo_null_selectivity (QO_ENV * env, PT_NODE * attr);
+
 /*
  * log3 () -
  *   return:
@@ -2613,9 +2639,9 @@ qo_join_new (QO_INFO * info, JOIN_TYPE join_type, QO_JOINMETHOD join_method, QO_
 
   bitset_init (&sarg_out_terms, info->env);
 
-  if (inner->has_sort_limit && join_method != QO_JOINMETHOD_MERGE_JOIN)
+  if (inner->has_sort_limit && join_method != QO_JOINMETHOD_MERGE_JOIN && join_method != QO_JOINMETHOD_HASH_JOIN)
     {
-      /* SORT-LIMIT plans are allowed on inner nodes only for merge joins */
+      /* SORT-LIMIT plans are allowed on inner nodes only for merge and hash joins */
       return NULL;
     }
 
@@ -2713,6 +2739,29 @@ qo_join_new (QO_INFO * info, JOIN_TYPE join_type, QO_JOINMETHOD join_method, QO_
 	}
 
       break;
+
+    case QO_JOINMETHOD_HASH_JOIN:
+
+      plan->vtbl = &qo_hash_join_plan_vtbl;
+
+      /* The hash join result is built in the order of the outer list file, but nothing guarantees it; treat it as
+       * unordered.
+       */
+      plan->order = QO_UNORDERED;
+
+      /* Like merge joins, hash joins read both of their inputs from list files, but neither of them needs to be
+       * sorted.
+       */
+      if (outer->plan_type != QO_PLANTYPE_SORT)
+	{
+	  outer = qo_sort_new (outer, QO_UNORDERED, SORT_TEMP);
+	}
+      if (inner->plan_type != QO_PLANTYPE_SORT)
+	{
+	  inner = qo_sort_new (inner, QO_UNORDERED, SORT_TEMP);
+	}
+
+      break;
     }
 
   assert (inner != NULL && outer != NULL);
@@ -2814,7 +2863,7 @@ qo_join_new (QO_INFO * info, JOIN_TYPE join_type, QO_JOINMETHOD join_method, QO_
    * not storing them into a listfile. We could push the cost into the merge plan itself, I suppose, but a rational
    * implementation wouldn't impose this cost, and so I have hope that one day we'll be able to eliminate it.
    */
-  if (join_method == QO_JOINMETHOD_MERGE_JOIN)
+  if (join_method == QO_JOINMETHOD_MERGE_JOIN || join_method == QO_JOINMETHOD_HASH_JOIN)
     {
       plan = qo_sort_new (plan, plan->order, SORT_TEMP);
     }
@@ -3211,6 +3260,82 @@ qo_mjoin_cost (QO_PLAN * planp)
   planp->variable_io_cost = outer->variable_io_cost + inner->variable_io_cost;
 }
 
+/*
+ * qo_hjoin_cost () -
+ *   return:
+ *   planp(in):
+ */
+static void
+qo_hjoin_cost (QO_PLAN * planp)
+{
+  QO_PLAN *inner;
+  QO_PLAN *outer;
+  QO_ENV *env;
+  double outer_cardinality = 0.0, inner_cardinality = 0.0;
+  double inner_size, mem_limit, pages;
+
+  inner = planp->plan_un.join.inner;
+
+  /* for worst cost */
+  if (inner->fixed_cpu_cost == QO_INFINITY || inner->fixed_io_cost == QO_INFINITY
+      || inner->variable_cpu_cost == QO_INFINITY || inner->variable_io_cost == QO_INFINITY)
+    {
+      qo_worst_cost (planp);
+      return;
+    }
+
+  outer = planp->plan_un.join.outer;
+
+  /* for worst cost */
+  if (outer->fixed_cpu_cost == QO_INFINITY || outer->fixed_io_cost == QO_INFINITY
+      || outer->variable_cpu_cost == QO_INFINITY || outer->variable_io_cost == QO_INFINITY)
+    {
+      qo_worst_cost (planp);
+      return;
+    }
+
+  env = outer->info->env;
+  if (outer->has_sort_limit)
+    {
+      outer_cardinality = (double) db_get_bigint (&QO_ENV_LIMIT_VALUE (env));
+    }
+  else
+    {
+      outer_cardinality = outer->info->cardinality;
+    }
+
+  if (inner->has_sort_limit)
+    {
+      inner_cardinality = (double) db_get_bigint (&QO_ENV_LIMIT_VALUE (env));
+    }
+  else
+    {
+      inner_cardinality = inner->info->cardinality;
+    }
+
+  /* CPU and IO costs which are fixed against join */
+  planp->fixed_cpu_cost = outer->fixed_cpu_cost + inner->fixed_cpu_cost;
+  planp->fixed_io_cost = outer->fixed_io_cost + inner->fixed_io_cost;
+  /* CPU and IO costs which are variable according to the join plan */
+  planp->variable_cpu_cost = outer->variable_cpu_cost + inner->variable_cpu_cost;
+  /* build cost: hash every inner row once; probe cost: look up every outer row once and check its matches */
+  planp->variable_cpu_cost += (inner_cardinality + outer_cardinality) * (double) QO_CPU_WEIGHT;
+  planp->variable_cpu_cost += MAX (0.0, (planp->info)->cardinality) * (double) QO_CPU_WEIGHT;
+  planp->variable_io_cost = outer->variable_io_cost + inner->variable_io_cost;
+
+  /* The executor keeps the inner rows, or at least their positions, in memory up to max_hash_list_scan_size. Beyond
+   * that it hashes the positions into the bucket pages of a temp file, so charge writing and reading back those
+   * pages, and fetching the inner rows again by position.
+   */
+  mem_limit = (double) prm_get_bigint_value (PRM_ID_MAX_HASH_LIST_SCAN_SIZE);
+  inner_size = inner_cardinality * (double) (inner->info)->projected_size;
+  if (inner_size > mem_limit && inner_cardinality * (double) (sizeof (HENTRY_HLS) + sizeof (VPID) + sizeof (int)) > mem_limit)
+    {
+      pages = inner_cardinality * (double) (sizeof (int) + sizeof (VPID) + sizeof (int)) / (double) IO_PAGESIZE;
+      planp->variable_io_cost += 2.0 * pages + inner_size / (double) IO_PAGESIZE;
+    }
+}
+
 /*
  * qo_follow_new () -
  *   return:
@@ -5954,6 +6079,97 @@ exit:
   return n;
 }
 
+/*
+ * qo_examine_hash_join () -
+ *   return:
+ *   info(in):
+ *   join_type(in):
+ *   outer(in):
+ *   inner(in):
+ *   hash_join_terms(in): mergeable equi-join terms; used as the hash keys
+ *   sarged_terms(in):
+ *   pinned_subqueries(in):
+ */
+static int
+qo_examine_hash_join (QO_INFO * info, JOIN_TYPE join_type, QO_INFO * outer, QO_INFO * inner, BITSET * hash_join_terms,
+		      BITSET * sarged_terms, BITSET * pinned_subqueries)
+{
+  int n = 0;
+  QO_PLAN *outer_plan, *inner_plan;
+  QO_NODE *inner_node;
+  PT_NODE *spec;
+  int t;
+  BITSET_ITERATOR iter;
+  BITSET empty_terms;
+  bitset_init (&empty_terms, info->env);
+
+  /* the executor implements hash joins for inner joins only */
+  if (join_type != JOIN_INNER)
+    {
+      goto exit;
+    }
+
+  /* As for merge joins, fake terms need the timing of nested loops. */
+  if (bitset_intersects (sarged_terms, &(info->env->fake_terms)))
+    {
+      goto exit;
+    }
+
+  /* path terms are evaluated by fetching the referenced object; keep them out */
+  for (t = bitset_iterate (hash_join_terms, &iter); t != -1; t = bitset_next_member (&iter))
+    {
+      if (QO_IS_PATH_TERM (QO_ENV_TERM (info->env, t)))
+	{
+	  goto exit;
+	}
+    }
+
+  /* At here, inner is single class spec */
+  inner_node = QO_ENV_NODE (inner->env, bitset_first_member (&(inner->nodes)));
+
+  spec = QO_NODE_ENTITY_SPEC (inner_node);
+  if (spec && spec->info.spec.flat_entity_list == NULL && spec->info.spec.derived_table_type == PT_IS_CSELECT)
+    {
+      /* cselect join of method */
+      goto exit;
+    }
+
+  if (QO_NODE_HINT (inner_node) & (PT_HINT_USE_NL | PT_HINT_USE_IDX | PT_HINT_USE_MERGE))
+    {
+      /* join hint: force nl-join, idx-join, m-join; */
+      goto exit;
+    }
+  else if (!prm_get_bool_value (PRM_ID_OPTIMIZER_ENABLE_HASH_JOIN))
+    {
+      /* optimizer prm: keep out h-join; */
+      goto exit;
+    }
+
+  outer_plan = qo_find_best_plan_on_info (outer, QO_UNORDERED, 1.0);
+  if (outer_plan == NULL)
+    {
+      goto exit;
+    }
+
+  inner_plan = qo_find_best_plan_on_info (inner, QO_UNORDERED, 1.0);
+  if (inner_plan == NULL)
+    {
+      goto exit;
+    }
+
+  n =
+    qo_check_plan_on_info (info,
+			   qo_join_new (info, join_type, QO_JOINMETHOD_HASH_JOIN, outer_plan, inner_plan,
+					hash_join_terms, &empty_terms, &empty_terms, sarged_terms, pinned_subqueries,
+					&empty_terms));
+
+exit:
+
+  bitset_delset (&empty_terms);
+
+  return n;
+}
+
 /*
  * qo_examine_correlated_index () -
  *   return: int
@@ -7087,6 +7303,14 @@ planner_visit_node (QO_PLANNER * planner, QO_PARTITION * partition, PT_HINT_ENUM
 				     &sarged_terms, &pinned_subqueries);
 	  }
 #endif /* MERGE_JOINS */
+
+	/* STEP 5-5: examine hash-join */
+	if (!bitset_is_empty (&sm_join_terms))
+	  {
+	    kept +=
+	      qo_examine_hash_join (new_info, join_type, head_info, tail_info, &sm_join_terms, &sarged_terms,
+				    &pinned_subqueries);
+	  }
       }
 
     /* At this point, kept indicates the number of worthwhile plans generated by examine_joins (i.e., plans that where
@@ -9150,11 +9374,11 @@ qo_expr_selectivity (QO_ENV * env, PT_NODE * pt_expr)
 	  break;
 
 	case PT_IS_NULL:
-	  selectivity = DEFAULT_NULL_SELECTIVITY;	/* make a guess */
+	  selectivity = qo_null_selectivity (env, node->info.expr.arg1);
 	  break;
 
 	case PT_IS_NOT_NULL:
-	  selectivity = qo_not_selectivity (env, DEFAULT_NULL_SELECTIVITY);
+	  selectivity = qo_not_selectivity (env, qo_null_selectivity (env, node->info.expr.arg1));
 	  break;
 
 	case PT_EXISTS:
@@ -9248,6 +9472,7 @@ qo_equal_selectivity (QO_ENV * env, PT_NODE * pt_expr)
   PRED_CLASS pc_lhs, pc_rhs;
   int lhs_icard, rhs_icard, icard;
   double selectivity;
+  QO_ATTR_CUM_STATS *cum_statsp;
 
   lhs = pt_expr->info.expr.arg1;
   rhs = pt_expr->info.expr.arg2;
@@ -9296,6 +9521,11 @@ qo_equal_selectivity (QO_ENV * env, PT_NODE * pt_expr)
 	    {
 	      selectivity = (1.0 / lhs_icard);
 	    }
+	  else if ((cum_statsp = qo_get_attr_col_stats (env, lhs)) != NULL && cum_statsp->ndv > 0)
+	    {
+	      /* no index, use the distinct values gathered by sampling */
+	      selectivity = (1.0 - cum_statsp->null_frac) / cum_statsp->ndv;
+	    }
 	  else
 	    {
 	      selectivity = DEFAULT_EQUAL_SELECTIVITY;
@@ -9328,6 +9558,11 @@ qo_equal_selectivity (QO_ENV * env, PT_NODE * pt_expr)
 	    {
 	      selectivity = (1.0 / rhs_icard);
 	    }
+	  else if ((cum_statsp = qo_get_attr_col_stats (env, rhs)) != NULL && cum_statsp->ndv > 0)
+	    {
+	      /* no index, use the distinct values gathered by sampling */
+	      selectivity = (1.0 - cum_statsp->null_frac) / cum_statsp->ndv;
+	    }
 	  else
 	    {
 	      selectivity = DEFAULT_EQUAL_SELECTIVITY;
@@ -9497,12 +9732,50 @@ qo_equal_selectivity (QO_ENV * env, PT_NODE * pt_expr)
  *   env(in): Pointer to an environment structure
  *   pt_expr(in): comparison expression
  *
- * Note: This uses the System R algorithm
+ * Note: This uses the System R algorithm, unless the attribute compared with a constant has a histogram
  */
 static double
 qo_comp_selectivity (QO_ENV * env, PT_NODE * pt_expr)
 {
-  return DEFAULT_COMP_SELECTIVITY;
+  PT_NODE *lhs, *rhs;
+  PT_OP_TYPE op;
+  double selectivity = -1.0;
+
+  lhs = pt_expr->info.expr.arg1;
+  rhs = pt_expr->info.expr.arg2;
+  op = pt_expr->info.expr.op;
+
+  if (qo_classify (lhs) == PC_ATTR && qo_classify (rhs) == PC_CONST)
+    {
+      /* attr < const, attr > const */
+      if (op == PT_LT || op == PT_LE)
+	{
+	  selectivity = qo_hist_selectivity (env, lhs, NULL, rhs);
+	}
+      else
+	{
+	  selectivity = qo_hist_selectivity (env, lhs, rhs, NULL);
+	}
+    }
+  else if (qo_classify (lhs) == PC_CONST && qo_classify (rhs) == PC_ATTR)
+    {
+      /* const < attr, const > attr */
+      if (op == PT_LT || op == PT_LE)
+	{
+	  selectivity = qo_hist_selectivity (env, rhs, lhs, NULL);
+	}
+      else
+	{
+	  selectivity = qo_hist_selectivity (env, rhs, NULL, lhs);
+	}
+    }
+
+  if (selectivity < 0.0)
+    {
+      return DEFAULT_COMP_SELECTIVITY;
+    }
+
+  return selectivity;
 }
 
 /*
@@ -9517,13 +9790,25 @@ static double
 qo_between_selectivity (QO_ENV * env, PT_NODE * pt_expr)
 {
   PT_NODE *and_node;
+  double selectivity = -1.0;
 
   and_node = pt_expr->info.expr.arg2;
 
   QO_ASSERT (env, and_node->node_type == PT_EXPR);
   QO_ASSERT (env, pt_is_between_range_op (and_node->info.expr.op));
 
-  return DEFAULT_BETWEEN_SELECTIVITY;
+  if (qo_classify (pt_expr->info.expr.arg1) == PC_ATTR)
+    {
+      selectivity = qo_hist_selectivity (env, pt_expr->info.expr.arg1, and_node->info.expr.arg1,
+					 and_node->info.expr.arg2);
+    }
+
+  if (selectivity < 0.0)
+    {
+      return DEFAULT_BETWEEN_SELECTIVITY;
+    }
+
+  return selectivity;
 }
 
 /*
@@ -9601,7 +9886,15 @@ qo_range_selectivity (QO_ENV * env, PT_NODE * pt_expr)
       if (op_type == PT_BETWEEN_GE_LE || op_type == PT_BETWEEN_GE_LT || op_type == PT_BETWEEN_GT_LE
 	  || op_type == PT_BETWEEN_GT_LT)
 	{
-	  selectivity = DEFAULT_BETWEEN_SELECTIVITY;
+	  selectivity = -1.0;
+	  if (pc2 == PC_ATTR)
+	    {
+	      selectivity = qo_hist_selectivity (env, lhs, arg1, arg2);
+	    }
+	  if (selectivity < 0.0)
+	    {
+	      selectivity = DEFAULT_BETWEEN_SELECTIVITY;
+	    }
 	}
       else if (op_type == PT_BETWEEN_EQ_NA)
 	{
@@ -9641,7 +9934,22 @@ qo_range_selectivity (QO_ENV * env, PT_NODE * pt_expr)
 	{
 	  /* PT_BETWEEN_INF_LE, PT_BETWEEN_INF_LT, PT_BETWEEN_GE_INF, and PT_BETWEEN_GT_INF have only one argument */
 
-	  selectivity = DEFAULT_COMP_SELECTIVITY;
+	  selectivity = -1.0;
+	  if (pc2 == PC_ATTR)
+	    {
+	      if (op_type == PT_BETWEEN_INF_LE || op_type == PT_BETWEEN_INF_LT)
+		{
+		  selectivity = qo_hist_selectivity (env, lhs, NULL, arg1);
+		}
+	      else
+		{
+		  selectivity = qo_hist_selectivity (env, lhs, arg1, NULL);
+		}
+	    }
+	  if (selectivity < 0.0)
+	    {
+	      selectivity = DEFAULT_COMP_SELECTIVITY;
+	    }
 	}
 
       selectivity = MAX (selectivity, 0.0);
@@ -9871,6 +10179,199 @@ qo_index_cardinality (QO_ENV * env, PT_NODE * attr)
   return info->cum_stats.pkeys[0];
 }
 
+/*
+ * qo_get_attr_col_stats () - Get the column statistics of an attribute
+ *   return: cumulated statistics of the attribute if its column statistics were gathered, otherwise NULL
+ *   env(in): optimizer environment
+ *   attr(in): pt node for the attribute
+ */
+static QO_ATTR_CUM_STATS *
+qo_get_attr_col_stats (QO_ENV * env, PT_NODE * attr)
+{
+  PT_NODE *dummy;
+  QO_NODE *nodep;
+  QO_SEGMENT *segp;
+  QO_ATTR_INFO *info;
+
+  if (attr->node_type == PT_DOT_)
+    {
+      attr = attr->info.dot.arg2;
+    }
+
+  if (attr->node_type != PT_NAME || attr->info.name.meta_class == PT_RESERVED)
+    {
+      return NULL;
+    }
+
+  nodep = lookup_node (attr, env, &dummy);
+  if (nodep == NULL)
+    {
+      return NULL;
+    }
+
+  segp = lookup_seg (nodep, attr, env);
+  if (segp == NULL)
+    {
+      return NULL;
+    }
+
+  info = QO_SEG_INFO (segp);
+  if (info == NULL || !info->cum_stats.has_col_stats)
+    {
+      return NULL;
+    }
+
+  return &info->cum_stats;
+}
+
+/*
+ * qo_get_hist_key () - Get the histogram key of a constant compared with an attribute
+ *   return: true if the constant can be placed in the histogram of the attribute
+ *   env(in): optimizer environment
+ *   cum_statsp(in): statistics of the attribute
+ *   value(in): constant
+ *   key_p(out): histogram key
+ */
+static bool
+qo_get_hist_key (QO_ENV * env, QO_ATTR_CUM_STATS * cum_statsp, PT_NODE * value, double *key_p)
+{
+  DB_VALUE *db_value;
+  DB_TYPE value_type;
+
+  if (value == NULL || value->node_type != PT_VALUE)
+    {
+      return false;
+    }
+
+  db_value = pt_value_to_db (QO_ENV_PARSER (env), value);
+  if (db_value == NULL)
+    {
+      return false;
+    }
+
+  /* keys of different types are not comparable, except numbers */
+  value_type = DB_VALUE_DOMAIN_TYPE (db_value);
+  if (value_type != cum_statsp->type && !(TP_IS_NUMERIC_TYPE (value_type) && TP_IS_NUMERIC_TYPE (cum_statsp->type)))
+    {
+      return false;
+    }
+
+  return stats_value_to_key (db_value, key_p);
+}
+
+/*
+ * qo_hist_fraction_below () - Estimate the fraction of the values that are not null and not greater than key
+ *   return: fraction between 0 and 1
+ *   cum_statsp(in): statistics of the attribute; must have a histogram
+ *   key(in): histogram key
+ *
+ * Note: Each bucket of the equi-depth histogram holds the same number of values; values are assumed to be uniformly
+ *       distributed inside a bucket.
+ */
+static double
+qo_hist_fraction_below (QO_ATTR_CUM_STATS * cum_statsp, double key)
+{
+  double *bounds = cum_statsp->hist_bounds;
+  int n_buckets = cum_statsp->n_hist_bounds - 1;
+  int i;
+
+  assert (n_buckets > 0);
+
+  if (key < bounds[0])
+    {
+      return 0.0;
+    }
+  if (key >= bounds[n_buckets])
+    {
+      return 1.0;
+    }
+
+  for (i = 0; i < n_buckets; i++)
+    {
+      if (key < bounds[i + 1])
+	{
+	  /* bounds[i] <= key < bounds[i + 1], so the bucket is not empty */
+	  return (i + (key - bounds[i]) / (bounds[i + 1] - bounds[i])) / n_buckets;
+	}
+    }
+
+  return 1.0;
+}
+
+/*
+ * qo_hist_selectivity () - Compute the selectivity of lower <= attr <= upper from the histogram of attr
+ *   return: selectivity, or -1 if there is no histogram or the bounds are not constants
+ *   env(in): optimizer environment
+ *   attr(in): pt node for the attribute
+ *   lower(in): lower bound; NULL if there is none
+ *   upper(in): upper bound; NULL if there is none
+ */
+static double
+qo_hist_selectivity (QO_ENV * env, PT_NODE * attr, PT_NODE * lower, PT_NODE * upper)
+{
+  QO_ATTR_CUM_STATS *cum_statsp;
+  double key, fraction_lower = 0.0, fraction_upper = 1.0, selectivity;
+
+  cum_statsp = qo_get_attr_col_stats (env, attr);
+  if (cum_statsp == NULL || cum_statsp->n_hist_bounds < 2)
+    {
+      return -1.0;
+    }
+
+  if (lower != NULL)
+    {
+      if (!qo_get_hist_key (env, cum_statsp, lower, &key))
+	{
+	  return -1.0;
+	}
+      fraction_lower = qo_hist_fraction_below (cum_statsp, key);
+    }
+
+  if (upper != NULL)
+    {
+      if (!qo_get_hist_key (env, cum_statsp, upper, &key))
+	{
+	  return -1.0;
+	}
+      fraction_upper = qo_hist_fraction_below (cum_statsp, key);
+    }
+
+  selectivity = MAX (fraction_upper - fraction_lower, 0.0) * (1.0 - cum_statsp->null_frac);
+
+  /* one distinct value at least, if the range is not empty */
+  if (cum_statsp->ndv > 0 && (lower == NULL || upper == NULL || fraction_upper >= fraction_lower))
+    {
+      selectivity = MAX (selectivity, (1.0 - cum_statsp->null_frac) / cum_statsp->ndv);
+    }
+
+  return MIN (selectivity, 1.0);
+}
+
+/*
+ * qo_null_selectivity () - Compute the selectivity of attr IS NULL
+ *   return: selectivity
+ *   env(in): optimizer environment
+ *   attr(in): pt node for the attribute
+ */
+static double
+qo_null_selectivity (QO_ENV * env, PT_NODE * attr)
+{
+  QO_ATTR_CUM_STATS *cum_statsp;
+
+  if (qo_classify (attr) != PC_ATTR)
+    {
+      return DEFAULT_NULL_SELECTIVITY;	/* make a guess */
+    }
+
+  cum_statsp = qo_get_attr_col_stats (env, attr);
+  if (cum_statsp == NULL)
+    {
+      return DEFAULT_NULL_SELECTIVITY;	/* make a guess */
+    }
+
+  return cum_statsp->null_frac;
+}
+
 /*
  * qo_is_all_unique_index_columns_are_equi_terms () -
  *   check if the current plan uses and
@@ -10787,7 +11288,7 @@ qo_plan_compute_iscan_sort_list (QO_PLAN * root, PT_NODE * group_by, bool * is_i
 	    }
 	  else
 	    {
-	      /* QO_JOINMETHOD_MERGE_JOIN */
+	      /* QO_JOINMETHOD_MERGE_JOIN, QO_JOINMETHOD_HASH_JOIN */
 	      plan = NULL;
 	    }
 	  break;
@@ -11331,6 +11832,10 @@ qo_plan_join_print_json (QO_PLAN * plan)
     case QO_JOINMETHOD_MERGE_JOIN:
       method = "MERGE JOIN";
       break;
+
+    case QO_JOINMETHOD_HASH_JOIN:
+      method = "HASH JOIN";
+      break;
     }
 
   switch (plan->plan_un.join.join_type)
@@ -11642,6 +12147,10 @@ qo_plan_join_print_text (FILE * fp, QO_PLAN * plan, int indent)
     case QO_JOINMETHOD_MERGE_JOIN:
       method = "MERGE JOIN";
       break;
+
+    case QO_JOINMETHOD_HASH_JOIN:
+      method = "HASH JOIN";
+      break;
     }
 
   switch (plan->plan_un.join.join_type)
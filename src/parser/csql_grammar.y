@@ -1554,6 +1554,7 @@ int g_original_buffer_len;
 %token <cptr> HASH
 %token <cptr> HEADER
 %token <cptr> HEAP
+%token <cptr> HISTOGRAMS
 %token <cptr> IFNULL
 %token <cptr> INACTIVE
 %token <cptr> INCREMENT
@@ -1599,6 +1600,7 @@ int g_original_buffer_len;
 %token <cptr> JOB
 %token <cptr> LAG
 %token <cptr> LAST_VALUE
+%token <cptr> LATENCY
 %token <cptr> LCASE
 %token <cptr> LEAD
 %token <cptr> LOCK_
@@ -7098,6 +7100,10 @@ show_type
 		{{
 			$$ = SHOWSTMT_JOB_QUEUES;
 		}}
+	| LATENCY HISTOGRAMS
+		{{
+			$$ = SHOWSTMT_LATENCY_HISTOGRAMS;
+		}}
 	| PAGE BUFFER STATUS
 		{{
 			$$ = SHOWSTMT_PAGE_BUFFER_STATUS;
@@ -21953,6 +21959,16 @@ identifier
 			$$ = p;
 			PARSER_SAVE_ERR_CONTEXT ($$, @$.buffer_pos)
 
+		DBG_PRINT}}
+	| HISTOGRAMS
+		{{
+
+			PT_NODE *p = parser_new_node (this_parser, PT_NAME);
+			if (p)
+			  p->info.name.original = $1;
+			$$ = p;
+			PARSER_SAVE_ERR_CONTEXT ($$, @$.buffer_pos)
+
 		DBG_PRINT}}
 	| INACTIVE
 		{{
@@ -22363,6 +22379,16 @@ identifier
 			$$ = p;
 			PARSER_SAVE_ERR_CONTEXT ($$, @$.buffer_pos)
 
+		DBG_PRINT}}
+	| LATENCY
+		{{
+
+			PT_NODE *p = parser_new_node (this_parser, PT_NAME);
+			if (p)
+			  p->info.name.original = $1;
+			$$ = p;
+			PARSER_SAVE_ERR_CONTEXT ($$, @$.buffer_pos)
+
 		DBG_PRINT}}
 	| LEAD
 		{{
@@ -216,6 +216,7 @@ static KEYWORD_RECORD keywords[] = {
   {HAVING, "HAVING", 0},
   {HEADER, "HEADER", 1},
   {HEAP, "HEAP", 1},
+  {HISTOGRAMS, "HISTOGRAMS", 1},
   {HOUR_, "HOUR", 0},
   {HOUR_MINUTE, "HOUR_MINUTE", 0},
   {HOUR_MILLISECOND, "HOUR_MILLISECOND", 0},
@@ -262,6 +263,7 @@ static KEYWORD_RECORD keywords[] = {
   {LANGUAGE, "LANGUAGE", 0},
   {LAST, "LAST", 0},
   {LAST_VALUE, "LAST_VALUE", 1},
+  {LATENCY, "LATENCY", 1},
   {LCASE, "LCASE", 1},
   {LEADING_, "LEADING", 0},
   {LEAVE, "LEAVE", 0},
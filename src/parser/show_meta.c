@@ -725,6 +725,26 @@ metadata_of_page_buffer_status (void)
   return &md;
 }
 
+static SHOWSTMT_METADATA *
+metadata_of_latency_histograms (void)
+{
+  static const SHOWSTMT_COLUMN cols[] = {
+    {"Name", "varchar(64)"},
+    {"Count", "bigint"},
+    {"P50_usec", "bigint"},
+    {"P90_usec", "bigint"},
+    {"P99_usec", "bigint"},
+    {"P999_usec", "bigint"},
+    {"Max_usec", "bigint"}
+  };
+
+  static SHOWSTMT_METADATA md = {
+    SHOWSTMT_LATENCY_HISTOGRAMS, true /* only_for_dba */ , "show latency histograms",
+    cols, DIM (cols), NULL, 0, NULL, 0, NULL, NULL
+  };
+  return &md;
+}
+
 /*
  * showstmt_get_metadata() -  return show statement column infos
  *   return:-
@@ -967,6 +987,7 @@ showstmt_metadata_init (void)
   show_Metas[SHOWSTMT_TRAN_TABLES] = metadata_of_tran_tables ();
   show_Metas[SHOWSTMT_THREADS] = metadata_of_threads ();
   show_Metas[SHOWSTMT_PAGE_BUFFER_STATUS] = metadata_of_page_buffer_status ();
+  show_Metas[SHOWSTMT_LATENCY_HISTOGRAMS] = metadata_of_latency_histograms ();
 
   for (i = 0; i < DIM (show_Metas); i++)
     {
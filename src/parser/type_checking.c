@@ -18336,7 +18336,7 @@ pt_evaluate_db_value_expr (PARSER_CONTEXT * parser, PT_NODE * expr, PT_OP_TYPE o
 	case PT_RLIKE_BINARY:
 	case PT_NOT_RLIKE_BINARY:
 	  {
-	    int err = db_string_rlike (arg1, arg2, arg3, NULL, NULL, &cmp);
+	    int err = db_string_rlike (arg1, arg2, arg3, NULL, NULL, NULL, &cmp);
 
 	    switch (err)
 	      {
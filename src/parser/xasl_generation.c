@@ -1399,6 +1399,7 @@ pt_make_pred_term_rlike (REGU_VARIABLE * arg1, REGU_VARIABLE * arg2, REGU_VARIAB
   et_rlike->case_sensitive = case_sensitive;
   et_rlike->compiled_regex = NULL;
   et_rlike->compiled_pattern = NULL;
+  et_rlike->compiled_dfa = NULL;
 
   return pred;
 }
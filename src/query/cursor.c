@@ -43,9 +43,12 @@
 #include "virtual_object.h"
 #include "network_interface_cl.h"
 #include "dbtype.h"
+#include "system_parameter.h"
 
 #define CURSOR_BUFFER_SIZE              DB_PAGESIZE
-#define CURSOR_BUFFER_AREA_SIZE         IO_MAX_PAGE_SIZE
+#define CURSOR_BUFFER_AREA_SIZE \
+  (MIN (MAX (prm_get_integer_value (PRM_ID_CURSOR_FETCH_PAGES) * DB_PAGESIZE, IO_MAX_PAGE_SIZE), \
+        QFILE_MAX_FETCH_PAGES * DB_PAGESIZE))
 
 enum
 {
@@ -575,7 +578,8 @@ cursor_get_list_file_page (CURSOR_ID * cursor_id_p, VPID * vpid_p)
       int ret_val;
 
       ret_val = qfile_get_list_file_page (cursor_id_p->query_id, vpid_p->volid, vpid_p->pageid,
-					  cursor_id_p->buffer_area, &cursor_id_p->buffer_filled_size);
+					  cursor_id_p->buffer_area, cursor_id_p->buffer_area_size,
+					  &cursor_id_p->buffer_filled_size);
       if (ret_val != NO_ERROR)
 	{
 	  return ret_val;
@@ -1225,6 +1229,7 @@ cursor_open (CURSOR_ID * cursor_id_p, QFILE_LIST_ID * list_id_p, bool updatable,
   cursor_id_p->oid_col_no_cnt = 0;
   cursor_id_p->buffer = NULL;
   cursor_id_p->buffer_area = NULL;
+  cursor_id_p->buffer_area_size = 0;
   cursor_id_p->buffer_filled_size = 0;
   cursor_id_p->list_id = empty_list_id;
   cursor_id_p->prefetch_lock_mode = DB_FETCH_READ;
@@ -1240,7 +1245,8 @@ cursor_open (CURSOR_ID * cursor_id_p, QFILE_LIST_ID * list_id_p, bool updatable,
 
   if (cursor_id_p->list_id.type_list.type_cnt)
     {
-      cursor_id_p->buffer_area = (char *) malloc (CURSOR_BUFFER_AREA_SIZE);
+      cursor_id_p->buffer_area_size = CURSOR_BUFFER_AREA_SIZE;
+      cursor_id_p->buffer_area = (char *) malloc (cursor_id_p->buffer_area_size);
       cursor_id_p->buffer = cursor_id_p->buffer_area;
 
       if (cursor_id_p->buffer == NULL)
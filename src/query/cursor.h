@@ -65,6 +65,7 @@ struct cursor_id
   QFILE_TUPLE_RECORD tuple_record;	/* Tuple descriptor */
   char *buffer;			/* Current page */
   char *buffer_area;
+  int buffer_area_size;		/* size of buffer_area; a window of pages is fetched at once */
   int buffer_filled_size;
   int buffer_tuple_count;	/* Tuple count in current page */
   int current_tuple_no;		/* Tuple position in current page */
@@ -251,6 +251,7 @@ static int qfile_get_tuple_from_current_list (THREAD_ENTRY * thread_p, QFILE_LIS
 					      QFILE_TUPLE_RECORD * tuple_record_p);
 
 static SCAN_CODE qfile_scan_next (THREAD_ENTRY * thread_p, QFILE_LIST_SCAN_ID * s_id);
+static void qfile_read_ahead_next_vpid (THREAD_ENTRY * thread_p, PAGE_PTR page_p, VPID * next_vpid_p);
 static SCAN_CODE qfile_scan_prev (THREAD_ENTRY * thread_p, QFILE_LIST_SCAN_ID * s_id);
 static SCAN_CODE qfile_retrieve_tuple (THREAD_ENTRY * thread_p, QFILE_LIST_SCAN_ID * scan_id_p,
 				       QFILE_TUPLE_RECORD * tuple_record_p, int peek);
@@ -2188,17 +2189,20 @@ qfile_destroy_list (THREAD_ENTRY * thread_p, QFILE_LIST_ID * list_id_p)
  *   volid(in): List file page volume identifier
  *   pageid(in): List file page identifier
  *   page_bufp(out): Buffer to contain list file page content
+ *   page_buf_size(in): Size of the buffer; at least IO_MAX_PAGE_SIZE
  *   page_sizep(out):
  *
  * Note: This routine is basically called by the C/S communication
  *              routines to fetch and copy the indicated list file page to
  *              the buffer area. The area pointed by the buffer must have
  *              been allocated by the caller and should be big enough to
- *              store a list file page.
+ *              store a list file page. The pages that follow the indicated
+ *              page are appended while they fit in the buffer, so that the
+ *              client gets a window of pages in one round trip.
  */
 int
 xqfile_get_list_file_page (THREAD_ENTRY * thread_p, QUERY_ID query_id, VOLID vol_id, PAGEID page_id, char *page_buf_p,
-			   int *page_size_p)
+			   int page_buf_size, int *page_size_p)
 {
   QMGR_QUERY_ENTRY *query_entry_p = NULL;
   QFILE_LIST_ID *list_id_p;
@@ -2258,8 +2262,10 @@ xqfile_get_list_file_page (THREAD_ENTRY * thread_p, QUERY_ID query_id, VOLID vol
     }
 
 get_page:
-  /* append pages until a network page is full */
-  while ((*page_size_p + DB_PAGESIZE) <= IO_MAX_PAGE_SIZE)
+  assert (page_buf_size >= IO_MAX_PAGE_SIZE);
+
+  /* append pages until the buffer is full */
+  while ((*page_size_p + DB_PAGESIZE) <= page_buf_size)
     {
       page_p = qmgr_get_old_page (thread_p, &vpid, tfile_vfid_p);
       if (page_p == NULL)
@@ -4347,6 +4353,8 @@ qfile_scan_next (THREAD_ENTRY * thread_p, QFILE_LIST_SCAN_ID * scan_id_p)
       else if (qfile_has_next_page (scan_id_p->curr_pgptr))
 	{
 	  QFILE_GET_NEXT_VPID (&next_vpid, scan_id_p->curr_pgptr);
+	  pgbuf_read_ahead (thread_p, &scan_id_p->read_ahead, &scan_id_p->curr_vpid, &next_vpid,
+			    qfile_read_ahead_next_vpid);
 	  next_page_p = qmgr_get_old_page (thread_p, &next_vpid, scan_id_p->list_id.tfile_vfid);
 	  if (next_page_p == NULL)
 	    {
@@ -4385,6 +4393,24 @@ qfile_scan_next (THREAD_ENTRY * thread_p, QFILE_LIST_SCAN_ID * scan_id_p)
     }
 }
 
+/*
+ * qfile_read_ahead_next_vpid () - get next page of a list file page read ahead of the scan
+ *   return: void
+ *   page_p(in): list file page
+ *   next_vpid_p(out): next page identifier or NULL if there is no next page
+ */
+static void
+qfile_read_ahead_next_vpid (THREAD_ENTRY * thread_p, PAGE_PTR page_p, VPID * next_vpid_p)
+{
+  VPID_SET_NULL (next_vpid_p);
+
+  /* the list file may have been destroyed and its pages reused meanwhile */
+  if (pgbuf_get_page_ptype (thread_p, page_p) == PAGE_QRESULT && qfile_has_next_page (page_p))
+    {
+      QFILE_GET_NEXT_VPID (next_vpid_p, page_p);
+    }
+}
+
 /*
  * qfile_scan_prev () -
  *   return: SCAN_CODE (S_SUCCESS, S_END, S_ERROR)
@@ -4662,6 +4688,7 @@ qfile_open_list_scan (QFILE_LIST_ID * list_id_p, QFILE_LIST_SCAN_ID * scan_id_p)
   scan_id_p->keep_page_on_finish = 0;
   scan_id_p->curr_vpid.pageid = NULL_PAGEID;
   scan_id_p->curr_vpid.volid = NULL_VOLID;
+  pgbuf_read_ahead_init (&scan_id_p->read_ahead);
   QFILE_CLEAR_LIST_ID (&scan_id_p->list_id);
 
   if (qfile_copy_list_id (&scan_id_p->list_id, list_id_p, true) != NO_ERROR)
@@ -33,6 +33,7 @@
 #include "object_domain.h"
 #include "object_primitive.h"
 #include "object_representation.h"
+#include "query_evaluator.h"                // SCAN_BATCH
 #include "query_opfunc.h"
 #include "regu_var.hpp"
 #include "string_opfunc.h"
@@ -948,6 +949,327 @@ qdata_evaluate_aggregate_list (cubthread::entry *thread_p, cubxasl::aggregate_li
   return NO_ERROR;
 }
 
+/*
+ * qdata_get_aggregate_batch_column () - get the column of a batch that is the operand of an aggregate function
+ *   return: column, or NULL if the operand is not a column of the batch
+ *   agg_p(in): aggregate function
+ *   batch(in): batch of rows
+ */
+static scan_batch_column *
+qdata_get_aggregate_batch_column (cubxasl::aggregate_list_node *agg_p, scan_batch *batch)
+{
+  regu_variable_list_node *operand = agg_p->operands;
+
+  if (operand == NULL || operand->next != NULL || operand->value.type != TYPE_CONSTANT || operand->value.xasl != NULL)
+    {
+      return NULL;
+    }
+
+  for (int i = 0; i < batch->num_columns; i++)
+    {
+      if (batch->columns[i].fetch_to == operand->value.value.dbvalptr)
+	{
+	  return &batch->columns[i];
+	}
+    }
+
+  return NULL;
+}
+
+/*
+ * qdata_is_aggregate_batch_supported () - check that aggregate functions can consume the selected rows of a batch
+ *   return: true if all functions can
+ *   agg_list(in): aggregate functions
+ *   batch(in): batch of rows
+ *   check_domains(in): also check the domains of the accumulators; they must be resolved
+ *
+ * Note: COUNT(*), and COUNT, MIN, MAX, SUM and AVG of a column of the batch without DISTINCT, are supported. MIN, MAX,
+ *       SUM and AVG also need an accumulator of the type of the column.
+ */
+bool
+qdata_is_aggregate_batch_supported (cubxasl::aggregate_list_node *agg_list, scan_batch *batch, bool check_domains)
+{
+  cubxasl::aggregate_list_node *agg_p;
+  scan_batch_column *column;
+
+  for (agg_p = agg_list; agg_p != NULL; agg_p = agg_p->next)
+    {
+      if (agg_p->option == Q_DISTINCT || agg_p->sort_list != NULL || agg_p->flag_agg_optimize)
+	{
+	  return false;
+	}
+
+      switch (agg_p->function)
+	{
+	case PT_COUNT_STAR:
+	  continue;
+
+	case PT_COUNT:
+	case PT_MIN:
+	case PT_MAX:
+	case PT_SUM:
+	case PT_AVG:
+	  break;
+
+	default:
+	  return false;
+	}
+
+      column = qdata_get_aggregate_batch_column (agg_p, batch);
+      if (column == NULL)
+	{
+	  return false;
+	}
+
+      if (check_domains && agg_p->function != PT_COUNT
+	  && (agg_p->accumulator_domain.value_dom == NULL
+	      || TP_DOMAIN_TYPE (agg_p->accumulator_domain.value_dom) != column->type))
+	{
+	  return false;
+	}
+    }
+
+  return true;
+}
+
+/*
+ * qdata_aggregate_batch_integers () - aggregate the selected rows of an integer column
+ *   return: error code
+ *   agg_p(in/out): MIN, MAX, SUM or AVG function
+ *   column(in): operand of the function; T is the type of the column
+ *   batch(in): batch of rows
+ *   first(in): first selected row to aggregate
+ *
+ * Note: Sums overflow in the type of the column, like qdata_add_dbval does for the accumulator.
+ */
+template <typename T>
+static int
+qdata_aggregate_batch_integers (cubxasl::aggregate_list_node *agg_p, scan_batch_column *column, scan_batch *batch,
+				int first)
+{
+  cubxasl::aggregate_accumulator *acc = &agg_p->accumulator;
+  bool has_result = (acc->curr_cnt >= 1);
+  T result = 0, value, sum;
+  int count = 0, row, i;
+
+  if (has_result)
+    {
+      result = (T) (DB_VALUE_DOMAIN_TYPE (acc->value) == DB_TYPE_SHORT ? db_get_short (acc->value)
+		    : DB_VALUE_DOMAIN_TYPE (acc->value) == DB_TYPE_INTEGER ? db_get_int (acc->value)
+		    : db_get_bigint (acc->value));
+    }
+
+  for (i = first; i < batch->sel_count; i++)
+    {
+      row = batch->selection[i];
+      if (column->is_null[row])
+	{
+	  continue;
+	}
+
+      value = (T) column->bigints[row];
+      count++;
+      if (!has_result)
+	{
+	  result = value;
+	  has_result = true;
+	  continue;
+	}
+
+      switch (agg_p->function)
+	{
+	case PT_MIN:
+	  result = (value < result) ? value : result;
+	  break;
+
+	case PT_MAX:
+	  result = (value > result) ? value : result;
+	  break;
+
+	default:
+	  sum = (T) (result + value);
+	  if (OR_CHECK_ADD_OVERFLOW (result, value, sum))
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_OVERFLOW_ADDITION, 0);
+	      return ER_QPROC_OVERFLOW_ADDITION;
+	    }
+	  result = sum;
+	  break;
+	}
+    }
+
+  if (count > 0)
+    {
+      pr_clear_value (acc->value);
+      switch (column->type)
+	{
+	case DB_TYPE_SHORT:
+	  db_make_short (acc->value, (short) result);
+	  break;
+
+	case DB_TYPE_INTEGER:
+	  db_make_int (acc->value, (int) result);
+	  break;
+
+	default:
+	  db_make_bigint (acc->value, (DB_BIGINT) result);
+	  break;
+	}
+      acc->curr_cnt += count;
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * qdata_aggregate_batch_doubles () - aggregate the selected rows of a DOUBLE column
+ *   return: error code
+ *   agg_p(in/out): MIN, MAX, SUM or AVG function
+ *   column(in): operand of the function
+ *   batch(in): batch of rows
+ *   first(in): first selected row to aggregate
+ */
+static int
+qdata_aggregate_batch_doubles (cubxasl::aggregate_list_node *agg_p, scan_batch_column *column, scan_batch *batch,
+			       int first)
+{
+  cubxasl::aggregate_accumulator *acc = &agg_p->accumulator;
+  bool has_result = (acc->curr_cnt >= 1);
+  double result = 0, value, sum;
+  int count = 0, row, i;
+
+  if (has_result)
+    {
+      result = db_get_double (acc->value);
+    }
+
+  for (i = first; i < batch->sel_count; i++)
+    {
+      row = batch->selection[i];
+      if (column->is_null[row])
+	{
+	  continue;
+	}
+
+      value = column->doubles[row];
+      count++;
+      if (!has_result)
+	{
+	  result = value;
+	  has_result = true;
+	  continue;
+	}
+
+      switch (agg_p->function)
+	{
+	case PT_MIN:
+	  result = (value < result) ? value : result;
+	  break;
+
+	case PT_MAX:
+	  result = (value > result) ? value : result;
+	  break;
+
+	default:
+	  sum = result + value;
+	  if (OR_CHECK_DOUBLE_OVERFLOW (sum))
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_OVERFLOW_ADDITION, 0);
+	      return ER_QPROC_OVERFLOW_ADDITION;
+	    }
+	  result = sum;
+	  break;
+	}
+    }
+
+  if (count > 0)
+    {
+      pr_clear_value (acc->value);
+      db_make_double (acc->value, result);
+      acc->curr_cnt += count;
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * qdata_evaluate_aggregate_batch () - aggregate the selected rows of a batch
+ *   return: error code
+ *   thread_p(in): thread entry
+ *   agg_list(in/out): aggregate functions; qdata_is_aggregate_batch_supported returned true with their domains
+ *   batch(in): batch of rows
+ *   first(in): first selected row to aggregate; the rows before it were aggregated by qdata_evaluate_aggregate_list
+ *
+ * Note: The result is the same as calling qdata_evaluate_aggregate_list for each selected row, without loading the rows
+ *       into the value list.
+ */
+int
+qdata_evaluate_aggregate_batch (cubthread::entry *thread_p, cubxasl::aggregate_list_node *agg_list,
+				scan_batch *batch, int first)
+{
+  cubxasl::aggregate_list_node *agg_p;
+  scan_batch_column *column;
+  int count, row, i;
+  int error = NO_ERROR;
+
+  for (agg_p = agg_list; agg_p != NULL && error == NO_ERROR; agg_p = agg_p->next)
+    {
+      if (agg_p->function == PT_COUNT_STAR)
+	{
+	  agg_p->accumulator.curr_cnt += batch->sel_count - first;
+	  continue;
+	}
+
+      column = qdata_get_aggregate_batch_column (agg_p, batch);
+      assert (column != NULL);
+
+      if (agg_p->function == PT_COUNT)
+	{
+	  count = 0;
+	  for (i = first; i < batch->sel_count; i++)
+	    {
+	      row = batch->selection[i];
+	      count += column->is_null[row] ? 0 : 1;
+	    }
+
+	  if (count > 0)
+	    {
+	      db_make_int (agg_p->accumulator.value,
+			   (agg_p->accumulator.curr_cnt < 1 ? 0 : db_get_int (agg_p->accumulator.value)) + count);
+	      agg_p->accumulator.curr_cnt += count;
+	    }
+	  continue;
+	}
+
+      switch (column->type)
+	{
+	case DB_TYPE_SHORT:
+	  error = qdata_aggregate_batch_integers<short> (agg_p, column, batch, first);
+	  break;
+
+	case DB_TYPE_INTEGER:
+	  error = qdata_aggregate_batch_integers<int> (agg_p, column, batch, first);
+	  break;
+
+	case DB_TYPE_BIGINT:
+	  error = qdata_aggregate_batch_integers<DB_BIGINT> (agg_p, column, batch, first);
+	  break;
+
+	case DB_TYPE_DOUBLE:
+	  error = qdata_aggregate_batch_doubles (agg_p, column, batch, first);
+	  break;
+
+	default:
+	  assert (false);
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_DATATYPE, 0);
+	  error = ER_QPROC_INVALID_DATATYPE;
+	  break;
+	}
+    }
+
+  return error;
+}
+
 /*
  * qdata_evaluate_aggregate_optimize () -
  *   return:
@@ -36,6 +36,7 @@
 // forward definitions
 struct db_value;
 struct mht_table;
+struct scan_batch;
 struct tp_domain;
 struct val_descr;
 
@@ -73,11 +74,13 @@ namespace cubquery
     mht_table *hash_table;	/* memory hash table for hash aggregate eval */
     aggregate_hash_key *temp_key;	/* temporary key used for fetch */
     AGGREGATE_HASH_STATE state;	/* state of hash aggregation */
+    bool is_partial;		/* partial aggregation of a parallel scan worker; never writes list files */
     tp_domain **key_domains;	/* hash key domains */
     cubxasl::aggregate_accumulator_domain **accumulator_domains;	/* accumulator domains */
 
     /* runtime statistics stuff */
     int hash_size;		/* hash table size */
+    INT64 mem_limit;		/* memory reserved for the hash table out of the query memory grant */
     int group_count;		/* groups processed in hash table */
     int tuple_count;		/* tuples processed in hash table */
 
@@ -121,6 +124,10 @@ int qdata_aggregate_accumulator_to_accumulator (cubthread::entry *thread_p, cubx
     tp_domain *func_domain, cubxasl::aggregate_accumulator *new_acc);
 int qdata_evaluate_aggregate_list (cubthread::entry *thread_p, cubxasl::aggregate_list_node *agg_list, val_descr *vd,
 				   cubxasl::aggregate_accumulator *alt_acc_list);
+bool qdata_is_aggregate_batch_supported (cubxasl::aggregate_list_node *agg_list, scan_batch *batch,
+    bool check_domains);
+int qdata_evaluate_aggregate_batch (cubthread::entry *thread_p, cubxasl::aggregate_list_node *agg_list,
+				    scan_batch *batch, int first);
 int qdata_evaluate_aggregate_optimize (cubthread::entry *thread_p, cubxasl::aggregate_list_node *agg_ptr, HFID *hfid,
 				       OID *partition_cls_oid);
 int qdata_evaluate_aggregate_hierarchy (cubthread::entry *thread_p, cubxasl::aggregate_list_node *agg_ptr,
@@ -2525,7 +2525,7 @@ eval_pred_rlike7 (THREAD_ENTRY * thread_p, const PRED_EXPR * pr, val_descr * vd,
 
   /* evaluate regular expression match */
   db_string_rlike (peek_val1, peek_val2, peek_val3, &et_rlike->compiled_regex, &et_rlike->compiled_pattern,
-		   &regexp_res);
+		   &et_rlike->compiled_dfa, &regexp_res);
 
   return (DB_LOGICAL) regexp_res;
 }
@@ -2678,6 +2678,253 @@ update_logical_result (THREAD_ENTRY * thread_p, DB_LOGICAL ev_res, int *qualific
     }
 }
 
+/* comparison of a column of a batch with a constant; the column is the left operand */
+struct batch_pred_term
+{
+  SCAN_BATCH_COLUMN *column;
+  REL_OP rel_op;		/* R_EQ, R_NE, R_GT, R_GE, R_LT or R_LE */
+  bool is_null;			/* the constant is NULL; no row qualifies */
+  DB_BIGINT bigint_const;	/* constant of integer columns */
+  double double_const;		/* constant of DOUBLE columns */
+};
+
+/*
+ * eval_batch_find_column () - find the column of an attribute in a batch
+ *   return: column, or NULL if the attribute has no column
+ *   batch(in): batch of rows
+ *   attr_id(in): attribute identifier
+ */
+SCAN_BATCH_COLUMN *
+eval_batch_find_column (SCAN_BATCH * batch, ATTR_ID attr_id)
+{
+  int i;
+
+  for (i = 0; i < batch->num_columns; i++)
+    {
+      if (batch->columns[i].attr_id == attr_id)
+	{
+	  return &batch->columns[i];
+	}
+    }
+
+  return NULL;
+}
+
+/*
+ * eval_batch_add_pred_terms () - add the comparisons of a predicate to the terms of a batch
+ *   return: false if the predicate is not a conjunction of comparisons of columns with constants
+ *   pr(in): predicate expression
+ *   vd(in): value descriptor of the constants
+ *   batch(in/out): batch of rows
+ */
+static bool
+eval_batch_add_pred_terms (THREAD_ENTRY * thread_p, const PRED_EXPR * pr, val_descr * vd, SCAN_BATCH * batch)
+{
+  const COMP_EVAL_TERM *et_comp;
+  REGU_VARIABLE *attr_regu, *const_regu;
+  struct batch_pred_term *term, *terms;
+  DB_VALUE *peek_val;
+  DB_TYPE const_type;
+  REL_OP rel_op;
+
+  if (pr->type == T_PRED)
+    {
+      return (pr->pe.m_pred.bool_op == B_AND && eval_batch_add_pred_terms (thread_p, pr->pe.m_pred.lhs, vd, batch)
+	      && eval_batch_add_pred_terms (thread_p, pr->pe.m_pred.rhs, vd, batch));
+    }
+
+  if (pr->type != T_EVAL_TERM || pr->pe.m_eval_term.et_type != T_COMP_EVAL_TERM)
+    {
+      return false;
+    }
+
+  et_comp = &pr->pe.m_eval_term.et.et_comp;
+  rel_op = et_comp->rel_op;
+  if (rel_op != R_EQ && rel_op != R_NE && rel_op != R_GT && rel_op != R_GE && rel_op != R_LT && rel_op != R_LE)
+    {
+      return false;
+    }
+
+  if (et_comp->lhs->type == TYPE_ATTR_ID)
+    {
+      attr_regu = et_comp->lhs;
+      const_regu = et_comp->rhs;
+    }
+  else
+    {
+      /* constant op column; swap the operands */
+      attr_regu = et_comp->rhs;
+      const_regu = et_comp->lhs;
+      rel_op = (rel_op == R_GT ? R_LT : rel_op == R_GE ? R_LE : rel_op == R_LT ? R_GT : rel_op == R_LE ? R_GE : rel_op);
+    }
+
+  if (attr_regu->type != TYPE_ATTR_ID || (const_regu->type != TYPE_DBVAL && const_regu->type != TYPE_POS_VALUE))
+    {
+      return false;
+    }
+
+  terms = (struct batch_pred_term *) db_private_realloc (thread_p, batch->pred_terms,
+							  (batch->num_pred_terms + 1) * sizeof (struct batch_pred_term));
+  if (terms == NULL)
+    {
+      return false;
+    }
+  batch->pred_terms = terms;
+
+  term = &terms[batch->num_pred_terms];
+  term->column = eval_batch_find_column (batch, attr_regu->value.attr_descr.id);
+  term->rel_op = rel_op;
+  term->is_null = false;
+  term->bigint_const = 0;
+  term->double_const = 0;
+  if (term->column == NULL)
+    {
+      return false;
+    }
+
+  if (fetch_peek_dbval (thread_p, const_regu, vd, NULL, NULL, NULL, &peek_val) != NO_ERROR)
+    {
+      return false;
+    }
+
+  /* only constants that compare with the column without a coercion of the column */
+  const_type = DB_VALUE_DOMAIN_TYPE (peek_val);
+  if (DB_IS_NULL (peek_val))
+    {
+      term->is_null = true;
+    }
+  else if (const_type == DB_TYPE_SHORT || const_type == DB_TYPE_INTEGER || const_type == DB_TYPE_BIGINT)
+    {
+      term->bigint_const = (const_type == DB_TYPE_SHORT ? db_get_short (peek_val)
+			    : const_type == DB_TYPE_INTEGER ? db_get_int (peek_val) : db_get_bigint (peek_val));
+      term->double_const = (double) term->bigint_const;
+    }
+  else if (const_type == DB_TYPE_DOUBLE && term->column->type == DB_TYPE_DOUBLE)
+    {
+      term->double_const = db_get_double (peek_val);
+    }
+  else
+    {
+      return false;
+    }
+
+  batch->num_pred_terms++;
+  return true;
+}
+
+/*
+ * eval_batch_pred_init () - prepare the evaluation of a predicate on batches of rows
+ *   return: false if the predicate cannot be evaluated on the columns of the batch
+ *   pr(in): predicate expression; NULL if all rows qualify
+ *   vd(in): value descriptor of the constants
+ *   batch(in/out): batch of rows; its columns are already set
+ *
+ * Note: Only conjunctions of comparisons (=, <>, <, <=, >, >=) of a column with a constant are supported. The
+ *       constants are fetched once; an error while fetching them is left to the caller.
+ */
+bool
+eval_batch_pred_init (THREAD_ENTRY * thread_p, const PRED_EXPR * pr, val_descr * vd, SCAN_BATCH * batch)
+{
+  batch->pred_terms = NULL;
+  batch->num_pred_terms = 0;
+
+  if (pr == NULL)
+    {
+      return true;
+    }
+
+  return eval_batch_add_pred_terms (thread_p, pr, vd, batch);
+}
+
+#define EVAL_BATCH_FILTER(column, values, op, constant) \
+  do \
+    { \
+      for (i = 0; i < batch->sel_count; i++) \
+	{ \
+	  row = batch->selection[i]; \
+	  if (!(column)->is_null[row] && (column)->values[row] op (constant)) \
+	    { \
+	      batch->selection[count++] = row; \
+	    } \
+	} \
+    } \
+  while (0)
+
+#define EVAL_BATCH_FILTER_BY_OP(column, values, rel_op, constant) \
+  do \
+    { \
+      switch (rel_op) \
+	{ \
+	case R_EQ: \
+	  EVAL_BATCH_FILTER (column, values, ==, constant); \
+	  break; \
+	case R_NE: \
+	  EVAL_BATCH_FILTER (column, values, !=, constant); \
+	  break; \
+	case R_GT: \
+	  EVAL_BATCH_FILTER (column, values, >, constant); \
+	  break; \
+	case R_GE: \
+	  EVAL_BATCH_FILTER (column, values, >=, constant); \
+	  break; \
+	case R_LT: \
+	  EVAL_BATCH_FILTER (column, values, <, constant); \
+	  break; \
+	case R_LE: \
+	  EVAL_BATCH_FILTER (column, values, <=, constant); \
+	  break; \
+	default: \
+	  assert (false); \
+	  break; \
+	} \
+    } \
+  while (0)
+
+/*
+ * eval_batch_pred () - select the rows of a batch that satisfy its predicate
+ *   return:
+ *   batch(in/out): batch of rows
+ *
+ * Note: Each comparison narrows the selection in one loop over the selected rows. A row whose column is NULL does
+ *       not qualify, like V_UNKNOWN on the row path.
+ */
+void
+eval_batch_pred (SCAN_BATCH * batch)
+{
+  struct batch_pred_term *term;
+  int i, t, row, count;
+
+  for (i = 0; i < batch->row_count; i++)
+    {
+      batch->selection[i] = i;
+    }
+  batch->sel_count = batch->row_count;
+
+  for (t = 0; t < batch->num_pred_terms && batch->sel_count > 0; t++)
+    {
+      term = &batch->pred_terms[t];
+      count = 0;
+
+      if (term->is_null)
+	{
+	  /* nothing qualifies */
+	}
+      else if (term->column->type == DB_TYPE_DOUBLE)
+	{
+	  EVAL_BATCH_FILTER_BY_OP (term->column, doubles, term->rel_op, term->double_const);
+	}
+      else
+	{
+	  EVAL_BATCH_FILTER_BY_OP (term->column, bigints, term->rel_op, term->bigint_const);
+	}
+
+      batch->sel_count = count;
+    }
+}
+
+#undef EVAL_BATCH_FILTER_BY_OP
+#undef EVAL_BATCH_FILTER
+
 /*
  * eval_data_filter () -
  *   return: DB_LOGICAL (V_TRUE, V_FALSE, V_UNKNOWN or V_ERROR)
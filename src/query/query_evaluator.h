@@ -132,6 +132,34 @@ struct filter_info
   // *INDENT-ON*
 };
 
+/* column of a batch of rows: the values of a fixed size attribute, decoded for all rows of the batch */
+typedef struct scan_batch_column SCAN_BATCH_COLUMN;
+struct scan_batch_column
+{
+  ATTR_ID attr_id;		/* attribute identifier */
+  DB_TYPE type;			/* DB_TYPE_SHORT, DB_TYPE_INTEGER, DB_TYPE_BIGINT or DB_TYPE_DOUBLE */
+  DB_VALUE *fetch_to;		/* value list entry of the attribute */
+  DB_BIGINT *bigints;		/* values of SHORT, INTEGER and BIGINT columns */
+  double *doubles;		/* values of DOUBLE columns */
+  bool *is_null;		/* true if the value of the row is unbound */
+};
+
+/* batch of rows read by a heap scan; the rows that satisfy the predicate of the scan are selected */
+typedef struct scan_batch SCAN_BATCH;
+struct scan_batch
+{
+  SCAN_BATCH_COLUMN *columns;	/* columns of the predicate attributes, followed by the other attributes */
+  int num_columns;		/* number of columns */
+  int max_rows;			/* capacity of the batch */
+  int row_count;		/* number of rows read */
+  int *selection;		/* rows that satisfy the predicate, in scan order */
+  int sel_count;		/* number of selected rows */
+  bool end_of_scan;		/* no rows are left after this batch */
+  char **disk_data;		/* disk data of the columns of the row being read */
+  struct batch_pred_term *pred_terms;	/* predicate of the scan; comparisons of columns with constants */
+  int num_pred_terms;		/* number of comparisons */
+};
+
 extern DB_LOGICAL eval_pred (THREAD_ENTRY * thread_p, const PRED_EXPR * pr, val_descr * vd, OID * obj_oid);
 extern DB_LOGICAL eval_pred_comp0 (THREAD_ENTRY * thread_p, const PRED_EXPR * pr, val_descr * vd, OID * obj_oid);
 extern DB_LOGICAL eval_pred_comp1 (THREAD_ENTRY * thread_p, const PRED_EXPR * pr, val_descr * vd, OID * obj_oid);
@@ -146,5 +174,8 @@ extern DB_LOGICAL eval_data_filter (THREAD_ENTRY * thread_p, OID * oid, RECDES *
 				    FILTER_INFO * filter);
 extern DB_LOGICAL eval_key_filter (THREAD_ENTRY * thread_p, DB_VALUE * value, FILTER_INFO * filter);
 extern DB_LOGICAL update_logical_result (THREAD_ENTRY * thread_p, DB_LOGICAL ev_res, int *qualification);
+extern SCAN_BATCH_COLUMN *eval_batch_find_column (SCAN_BATCH * batch, ATTR_ID attr_id);
+extern bool eval_batch_pred_init (THREAD_ENTRY * thread_p, const PRED_EXPR * pr, val_descr * vd, SCAN_BATCH * batch);
+extern void eval_batch_pred (SCAN_BATCH * batch);
 
 #endif /* _QUERY_EVALUATOR_H_ */
@@ -74,12 +74,18 @@
 #include "dbtype.h"
 #include "string_regex.hpp"
 #include "thread_entry.hpp"
+#include "thread_entry_task.hpp"
+#include "thread_manager.hpp"
 #include "regu_var.hpp"
 #include "xasl.h"
 #include "xasl_aggregate.hpp"
 #include "xasl_analytic.hpp"
 #include "xasl_predicate.hpp"
+#include "xasl_unpack_info.hpp"
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
 #include <vector>
 
 // XASL_STATE
@@ -380,6 +386,121 @@ typedef enum
   TOPN_FAILURE
 } TOPN_STATUS;
 
+#if defined (SERVER_MODE)
+/* a parallel heap scan is not worth it for heaps smaller than this many pages per worker */
+#define QEXEC_PARALLEL_SCAN_PAGES_PER_WORKER 512
+/* number of heap pages a worker takes from the heap chain at once */
+#define QEXEC_PARALLEL_SCAN_BATCH_PAGES 16
+
+/* a worker of a parallel heap scan: a clone of the XASL tree that aggregates the rows of the pages it scans */
+typedef struct qexec_parallel_scan_worker QEXEC_PARALLEL_SCAN_WORKER;
+struct qexec_parallel_scan_worker
+{
+  XASL_CLONE clone;		/* XASL tree of the worker */
+  XASL_STATE xasl_state;	/* XASL state of the worker; host variables are shared with the query */
+  bool is_scan_opened;		/* true if the scan of the worker must be closed */
+};
+
+// *INDENT-OFF*
+// class qexec_parallel_scan_context
+//
+//  description:
+//    parallel scan workers borrow the transaction of the query they scan for; they are reset when retired to pool
+//
+class qexec_parallel_scan_context : public cubthread::entry_manager
+{
+  protected:
+    void on_recycle (context_type & context) override
+    {
+      context.tran_index = NULL_TRAN_INDEX;
+      context.conn_entry = NULL;
+    }
+};
+
+// class qexec_parallel_scan
+//
+//  description:
+//    hands out batches of heap pages to the workers of a parallel heap scan and collects their outcome. the pages
+//    are taken in the order of the heap chain, so each page is scanned by exactly one worker.
+//
+class qexec_parallel_scan
+{
+  public:
+    qexec_parallel_scan (const HFID & hfid, int tran_index, css_conn_entry * conn_entry)
+      : m_tran_index (tran_index)
+      , m_conn_entry (conn_entry)
+      , m_hfid (hfid)
+      , m_next_vpid ()
+      , m_is_heap_end (false)
+      , m_read_ahead ()
+      , m_mutex ()
+      , m_idle_cv ()
+      , m_tasks_in_progress (0)
+      , m_is_stopped (false)
+      , m_error_code (NO_ERROR)
+    {
+      VPID_SET_NULL (&m_next_vpid);
+      pgbuf_read_ahead_init (&m_read_ahead);
+    }
+
+    int get_next_pages (THREAD_ENTRY * thread_p, VPID * vpids, int & count);
+    void stop (int error_code);
+    void start_task ();
+    void end_task ();
+    void wait_for_tasks ();
+
+    bool is_stopped () const
+    {
+      return m_is_stopped;
+    }
+
+    int get_error () const
+    {
+      return m_error_code;
+    }
+
+    const int m_tran_index;
+    css_conn_entry *const m_conn_entry;
+
+  private:
+    HFID m_hfid;
+    VPID m_next_vpid;		// first page of the next batch; null before the first batch
+    bool m_is_heap_end;
+    PAGE_READ_AHEAD m_read_ahead;
+
+    std::mutex m_mutex;
+    std::condition_variable m_idle_cv;
+    int m_tasks_in_progress;
+    std::atomic<bool> m_is_stopped;
+    int m_error_code;		// NO_ERROR if the scan was given up; the serial scan is executed instead
+};
+
+// class qexec_parallel_scan_task
+//
+//  description:
+//    scans heap pages with the XASL clone of a worker until the heap ends or the parallel scan is stopped
+//
+class qexec_parallel_scan_task : public cubthread::entry_task
+{
+  public:
+    qexec_parallel_scan_task (qexec_parallel_scan & scan, QEXEC_PARALLEL_SCAN_WORKER & worker)
+      : m_scan (scan)
+      , m_worker (worker)
+    {
+    }
+
+    void execute (context_type & thread_ref) override;
+
+  private:
+    qexec_parallel_scan &m_scan;
+    QEXEC_PARALLEL_SCAN_WORKER &m_worker;
+};
+// *INDENT-ON*
+
+static cubthread::entry_workpool *qexec_Parallel_scan_workers = NULL;
+static qexec_parallel_scan_context *qexec_Parallel_scan_context = NULL;
+#endif /* SERVER_MODE */
+
 static DB_LOGICAL qexec_eval_instnum_pred (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state);
 static int qexec_add_composite_lock (THREAD_ENTRY * thread_p, REGU_VARIABLE_LIST reg_var_list, XASL_STATE * xasl_state,
 				     LK_COMPOSITE_LOCK * composite_lock, int upd_del_cls_cnt, OID * default_cls_oid);
@@ -388,6 +509,26 @@ static QPROC_TPLDESCR_STATUS qexec_generate_tuple_descriptor (THREAD_ENTRY * thr
 static int qexec_upddel_add_unique_oid_to_ehid (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state);
 static int qexec_end_one_iteration (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
 				    QFILE_TUPLE_RECORD * tplrec);
+static void qexec_resolve_domains_for_buildvalue_outptr (XASL_NODE * xasl);
+#if defined (SERVER_MODE)
+static int qexec_parallel_scan_worker_count (THREAD_ENTRY * thread_p, XASL_NODE * xasl);
+static int qexec_parallel_scan_worker_start (THREAD_ENTRY * thread_p, XASL_STATE * xasl_state,
+					     XASL_CACHE_ENTRY * xcache_entry, QEXEC_PARALLEL_SCAN_WORKER * worker);
+static void qexec_parallel_scan_worker_end (THREAD_ENTRY * thread_p, QEXEC_PARALLEL_SCAN_WORKER * worker);
+static int qexec_parallel_scan_worker_execute (THREAD_ENTRY * thread_p, qexec_parallel_scan * scan,
+					       QEXEC_PARALLEL_SCAN_WORKER * worker, bool * gave_up);
+static int qexec_parallel_scan_aggregate_row (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
+					      QFILE_TUPLE_RECORD * tplrec, bool * gave_up);
+static int qexec_parallel_scan_merge (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
+				      QEXEC_PARALLEL_SCAN_WORKER * workers, int worker_count);
+static int qexec_parallel_scan_merge_groups (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
+					     XASL_NODE * worker_xasl);
+static bool qexec_parallel_heap_scan (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
+				      SCAN_CODE * qp_scan);
+#endif /* SERVER_MODE */
+static bool qexec_is_single_class_heap_scan (XASL_NODE * xasl);
+static bool qexec_batch_heap_scan (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
+				   SCAN_CODE * qp_scan);
 static void qexec_failure_line (int line, XASL_STATE * xasl_state);
 static void qexec_reset_regu_variable (REGU_VARIABLE * var);
 static void qexec_reset_regu_variable_list (REGU_VARIABLE_LIST list);
@@ -438,6 +579,8 @@ static int qexec_hash_gby_agg_tuple (THREAD_ENTRY * thread_p, XASL_NODE * xasl,
 				     BUILDLIST_PROC_NODE * proc, QFILE_TUPLE_RECORD * tplrec,
 				     QFILE_TUPLE_DESCRIPTOR * tpldesc, QFILE_LIST_ID * groupby_list,
 				     bool * output_tuple);
+static int qexec_hash_gby_keep_memory_limit (THREAD_ENTRY * thread_p, AGGREGATE_HASH_CONTEXT * context,
+					     QFILE_LIST_ID * groupby_list, UINT64 mem_limit);
 static void qexec_gby_start_group_dim (THREAD_ENTRY * thread_p, GROUPBY_STATE * gbstate, const RECDES * recdes);
 static void qexec_gby_start_group (THREAD_ENTRY * thread_p, GROUPBY_STATE * gbstate, const RECDES * recdes, int N);
 static void qexec_gby_finalize_group_val_list (THREAD_ENTRY * thread_p, GROUPBY_STATE * gbstate, int N);
@@ -498,6 +641,12 @@ static int qexec_merge_tuple_add_list (THREAD_ENTRY * thread_p, QFILE_LIST_ID *
 static QFILE_LIST_ID *qexec_merge_list (THREAD_ENTRY * thread_p, QFILE_LIST_ID * outer_list_idp,
 					QFILE_LIST_ID * inner_list_idp, QFILE_LIST_MERGE_INFO * merge_infop,
 					int ls_flag);
+static QFILE_LIST_ID *qexec_hash_join_list (THREAD_ENTRY * thread_p, QFILE_LIST_ID * outer_list_idp,
+					    QFILE_LIST_ID * inner_list_idp, QFILE_LIST_MERGE_INFO * merge_infop,
+					    int ls_flag);
+static QFILE_LIST_ID *qexec_sort_merge_list (THREAD_ENTRY * thread_p, QFILE_LIST_ID * outer_list_idp,
+					     QFILE_LIST_ID * inner_list_idp, QFILE_LIST_MERGE_INFO * merge_infop,
+					     int ls_flag);
 static QFILE_LIST_ID *qexec_merge_list_outer (THREAD_ENTRY * thread_p, SCAN_ID * outer_sid, SCAN_ID * inner_sid,
 					      QFILE_LIST_MERGE_INFO * merge_infop, PRED_EXPR * other_outer_join_pred,
 					      XASL_STATE * xasl_state, int ls_flag);
@@ -1272,9 +1421,6 @@ qexec_end_one_iteration (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE *
     {
       if (xasl->proc.buildvalue.agg_list != NULL)
 	{
-	  AGGREGATE_TYPE *agg_node = NULL;
-	  REGU_VARIABLE_LIST out_list_val = NULL;
-
 	  if (xasl->proc.buildvalue.agg_list != NULL && !xasl->proc.buildvalue.agg_domains_resolved)
 	    {
 	      if (qexec_resolve_domains_for_aggregation (thread_p, xasl->proc.buildvalue.agg_list, xasl_state, tplrec,
@@ -1291,31 +1437,7 @@ qexec_end_one_iteration (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE *
 	    }
 
 	  /* resolve domains for aggregates */
-	  for (out_list_val = xasl->outptr_list->valptrp; out_list_val != NULL; out_list_val = out_list_val->next)
-	    {
-	      assert (out_list_val->value.domain != NULL);
-
-	      /* aggregates corresponds to CONSTANT regu vars in outptr_list */
-	      if (out_list_val->value.type != TYPE_CONSTANT
-		  || (TP_DOMAIN_TYPE (out_list_val->value.domain) != DB_TYPE_VARIABLE
-		      && TP_DOMAIN_COLLATION_FLAG (out_list_val->value.domain) == TP_DOMAIN_COLL_NORMAL))
-		{
-		  continue;
-		}
-
-	      /* search in aggregate list by comparing DB_VALUE pointers */
-	      for (agg_node = xasl->proc.buildvalue.agg_list; agg_node != NULL; agg_node = agg_node->next)
-		{
-		  if (out_list_val->value.value.dbvalptr == agg_node->accumulator.value
-		      && TP_DOMAIN_TYPE (agg_node->domain) != DB_TYPE_NULL)
-		    {
-		      assert (agg_node->domain != NULL);
-		      assert (TP_DOMAIN_COLLATION_FLAG (agg_node->domain) == TP_DOMAIN_COLL_NORMAL);
-		      out_list_val->value.domain = agg_node->domain;
-		    }
-		}
-
-	    }
+	  qexec_resolve_domains_for_buildvalue_outptr (xasl);
 	}
     }
 
@@ -1326,6 +1448,45 @@ exit_on_error:
   return (ret == NO_ERROR && (ret = er_errid ()) == NO_ERROR) ? ER_FAILED : ret;
 }
 
+/*
+ * qexec_resolve_domains_for_buildvalue_outptr () - set resolved aggregate domains to outptr list of BUILDVALUE
+ *   return:
+ *   xasl(in): BUILDVALUE XASL node
+ */
+static void
+qexec_resolve_domains_for_buildvalue_outptr (XASL_NODE * xasl)
+{
+  AGGREGATE_TYPE *agg_node = NULL;
+  REGU_VARIABLE_LIST out_list_val = NULL;
+
+  assert (xasl->type == BUILDVALUE_PROC);
+
+  for (out_list_val = xasl->outptr_list->valptrp; out_list_val != NULL; out_list_val = out_list_val->next)
+    {
+      assert (out_list_val->value.domain != NULL);
+
+      /* aggregates corresponds to CONSTANT regu vars in outptr_list */
+      if (out_list_val->value.type != TYPE_CONSTANT
+	  || (TP_DOMAIN_TYPE (out_list_val->value.domain) != DB_TYPE_VARIABLE
+	      && TP_DOMAIN_COLLATION_FLAG (out_list_val->value.domain) == TP_DOMAIN_COLL_NORMAL))
+	{
+	  continue;
+	}
+
+      /* search in aggregate list by comparing DB_VALUE pointers */
+      for (agg_node = xasl->proc.buildvalue.agg_list; agg_node != NULL; agg_node = agg_node->next)
+	{
+	  if (out_list_val->value.value.dbvalptr == agg_node->accumulator.value
+	      && TP_DOMAIN_TYPE (agg_node->domain) != DB_TYPE_NULL)
+	    {
+	      assert (agg_node->domain != NULL);
+	      assert (TP_DOMAIN_COLLATION_FLAG (agg_node->domain) == TP_DOMAIN_COLL_NORMAL);
+	      out_list_val->value.domain = agg_node->domain;
+	    }
+	}
+    }
+}
+
 /*
  * Clean_up processing routines
  */
@@ -1759,7 +1920,15 @@ qexec_clear_pred (THREAD_ENTRY * thread_p, XASL_NODE * xasl_p, PRED_EXPR * pr, b
 	    pg_cnt += qexec_clear_regu_var (thread_p, xasl_p, et_rlike->case_sensitive, is_final);
 
 	    /* free memory of compiled regex */
-	    cubregex::clear (et_rlike->compiled_regex, et_rlike->compiled_pattern);
+	    if (XASL_IS_FLAGED (xasl_p, XASL_DECACHE_CLONE) || !xcache_uses_clones ())
+	      {
+		cubregex::clear (et_rlike->compiled_regex, et_rlike->compiled_pattern, et_rlike->compiled_dfa);
+	      }
+	    else
+	      {
+		/* the dfa and its states are kept for the next execution of the clone; they are freed at decache */
+		cubregex::clear (et_rlike->compiled_regex, et_rlike->compiled_pattern);
+	      }
 	  }
 	  break;
 	}
@@ -3717,8 +3886,7 @@ qexec_hash_gby_agg_tuple (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
   AGGREGATE_HASH_CONTEXT *context = proc->agg_hash_context;
   AGGREGATE_HASH_KEY *key = context->temp_key;
   AGGREGATE_HASH_VALUE *value;
-  HENTRY_PTR hentry;
-  UINT64 mem_limit = prm_get_bigint_value (PRM_ID_MAX_AGG_HASH_SIZE);
+  UINT64 mem_limit = context->mem_limit;
   int rc = NO_ERROR;
   TSC_TICKS start_tick, end_tick;
   TSCTIMEVAL tv_diff;
@@ -3833,7 +4001,72 @@ qexec_hash_gby_agg_tuple (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
 	}
     }
 
+  if (context->is_partial && context->hash_size > (int) mem_limit)
+    {
+      /* partial aggregation cannot spill to list files; the parallel scan gives up on hash aggregation */
+      context->state = HS_REJECT_ALL;
+      return NO_ERROR;
+    }
+
   /* keep hash table within memory limit */
+  rc = qexec_hash_gby_keep_memory_limit (thread_p, context, groupby_list, mem_limit);
+  if (rc != NO_ERROR)
+    {
+      return rc;
+    }
+
+  /* check very high selectivity case */
+  if (context->tuple_count > HASH_AGGREGATE_VH_SELECTIVITY_TUPLE_THRESHOLD)
+    {
+      float selectivity = (float) context->group_count / context->tuple_count;
+      if (selectivity > HASH_AGGREGATE_VH_SELECTIVITY_THRESHOLD)
+	{
+	  /* very high selectivity, abort hash aggregation */
+	  context->state = HS_REJECT_ALL;
+
+	  /* dump hash table to list file, no need to keep it in memory */
+	  if (!context->is_partial)
+	    {
+	      qdata_save_agg_htable_to_list (thread_p, context->hash_table, groupby_list, context->part_list_id,
+					     context->temp_dbval_array);
+	    }
+
+#if !defined(NDEBUG)
+	  er_log_debug (ARG_FILE_LINE, "hash aggregation abandoned: very high selectivity");
+#endif
+	}
+    }
+
+  if (thread_is_on_trace (thread_p))
+    {
+      tsc_getticks (&end_tick);
+      tsc_elapsed_time_usec (&tv_diff, end_tick, start_tick);
+      TSC_ADD_TIMEVAL (xasl->groupby_stats.groupby_time, tv_diff);
+      xasl->groupby_stats.groupby_hash = context->state;
+    }
+
+  /* all ok */
+  return NO_ERROR;
+}
+
+/*
+ * qexec_hash_gby_keep_memory_limit () - move least recently used groups of hash table to partial list until the
+ *                                       hash table is within memory limit
+ *   return: error code or NO_ERROR
+ *   thread_p(in): thread
+ *   context(in): hash aggregate context
+ *   groupby_list(in): listfile containing tuples for sort-based aggregation
+ *   mem_limit(in): memory limit of hash table
+ */
+static int
+qexec_hash_gby_keep_memory_limit (THREAD_ENTRY * thread_p, AGGREGATE_HASH_CONTEXT * context,
+				  QFILE_LIST_ID * groupby_list, UINT64 mem_limit)
+{
+  AGGREGATE_HASH_KEY *key;
+  AGGREGATE_HASH_VALUE *value;
+  HENTRY_PTR hentry;
+  int rc = NO_ERROR;
+
   while (context->hash_size > (int) mem_limit)
     {
       /* get least recently used entry */
@@ -3874,34 +4107,6 @@ qexec_hash_gby_agg_tuple (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
       mht_rem (context->hash_table, key, qdata_free_agg_hentry, NULL);
     }
 
-  /* check very high selectivity case */
-  if (context->tuple_count > HASH_AGGREGATE_VH_SELECTIVITY_TUPLE_THRESHOLD)
-    {
-      float selectivity = (float) context->group_count / context->tuple_count;
-      if (selectivity > HASH_AGGREGATE_VH_SELECTIVITY_THRESHOLD)
-	{
-	  /* very high selectivity, abort hash aggregation */
-	  context->state = HS_REJECT_ALL;
-
-	  /* dump hash table to list file, no need to keep it in memory */
-	  qdata_save_agg_htable_to_list (thread_p, context->hash_table, groupby_list, context->part_list_id,
-					 context->temp_dbval_array);
-
-#if !defined(NDEBUG)
-	  er_log_debug (ARG_FILE_LINE, "hash aggregation abandoned: very high selectivity");
-#endif
-	}
-    }
-
-  if (thread_is_on_trace (thread_p))
-    {
-      tsc_getticks (&end_tick);
-      tsc_elapsed_time_usec (&tv_diff, end_tick, start_tick);
-      TSC_ADD_TIMEVAL (xasl->groupby_stats.groupby_time, tv_diff);
-      xasl->groupby_stats.groupby_hash = context->state;
-    }
-
-  /* all ok */
   return NO_ERROR;
 }
 
@@ -5659,23 +5864,26 @@ exit_on_error:
 }
 
 /*
- * qexec_merge_list_outer () -
- *   return:
- *   outer_sid(in)      :
- *   inner_sid(in)      :
- *   merge_infop(in)    :
- *   other_outer_join_pred(in)  :
- *   xasl_state(in)     :
+ * qexec_hash_join_list () -
+ *   return: QFILE_LIST_ID *, or NULL
+ *   outer_list_idp(in) : First (left) list file to be joined; probe input
+ *   inner_list_idp(in) : Second (right) list file to be joined; build input
+ *   merge_infop(in)    : List file merge information
  *   ls_flag(in)        :
+ *
+ * Note: This routine joins the given two unordered list files by building
+ * an in-memory hash table on the join columns of the inner list file and
+ * probing it with every outer tuple. The hash table keeps either copies
+ * of the inner tuples or only their positions, depending on the size of
+ * the inner list file and max_hash_list_scan_size. If even the positions
+ * do not fit, they are hashed into the pages of a temp file instead.
+ * For left outer joins, outer tuples without a matching inner tuple are
+ * joined with a NULL inner row.
  */
 static QFILE_LIST_ID *
-qexec_merge_list_outer (THREAD_ENTRY * thread_p, SCAN_ID * outer_sid, SCAN_ID * inner_sid,
-			QFILE_LIST_MERGE_INFO * merge_infop, PRED_EXPR * other_outer_join_pred, XASL_STATE * xasl_state,
-			int ls_flag)
+qexec_hash_join_list (THREAD_ENTRY * thread_p, QFILE_LIST_ID * outer_list_idp, QFILE_LIST_ID * inner_list_idp,
+		      QFILE_LIST_MERGE_INFO * merge_infop, int ls_flag)
 {
-  /* outer -> left scan, inner -> right scan */
-
-  /* pre-defined vars: */
   QFILE_LIST_ID *list_idp = NULL;
   int nvals;
   QFILE_TUPLE_RECORD tplrec = { NULL, 0 };
@@ -5684,41 +5892,73 @@ qexec_merge_list_outer (THREAD_ENTRY * thread_p, SCAN_ID * outer_sid, SCAN_ID *
   int *outer_indp, *inner_indp;
   char **outer_valp = NULL, **inner_valp = NULL;
   SCAN_CODE outer_scan = S_END, inner_scan = S_END;
+  QFILE_LIST_SCAN_ID outer_sid, inner_sid;
 
-  TP_DOMAIN **outer_domp = NULL, **inner_domp = NULL;
-  QFILE_LIST_ID *outer_list_idp, *inner_list_idp;
+  TP_DOMAIN **outer_domp = NULL, **inner_domp = NULL, **coerce_domp = NULL;
   QFILE_TUPLE_VALUE_TYPE_LIST type_list;
-  int k, cnt, group_cnt, merge_cnt, already_compared;
-  SCAN_DIRECTION direction;
-  SCAN_POS inner_scanpos;
-  bool all_lefts, all_rghts;
-  DB_LOGICAL ev_res;
+  QFILE_TUPLE_POSITION tuple_pos;
+  MHT_HLS_TABLE *hash_table = NULL;
+  FHS_TABLE *file_hash_table = NULL;
+  QFILE_TUPLE_SIMPLE_POS simple_pos;
+  HASH_SCAN_KEY *key = NULL;
+  HASH_SCAN_VALUE *hvalue;
+  HENTRY_HLS_PTR hentry;
+  HASH_METHOD hash_method;
+  DB_TYPE outer_type, inner_type;
+  UINT64 mem_limit = prm_get_bigint_value (PRM_ID_MAX_HASH_LIST_SCAN_SIZE);
   DB_VALUE_COMPARE_RESULT val_cmp;
+  int k, i;
+  bool is_unmatched, is_matched;
+  bool all_lefts;
 
-  direction = S_FORWARD;	/* init */
-  val_cmp = DB_NE;		/* init - mark as not yet compared */
-
-  /* determine all lefts or all rights option depending on join type */
-  all_lefts = (merge_infop->join_type == JOIN_LEFT || merge_infop->join_type == JOIN_OUTER) ? true : false;
-  all_rghts = (merge_infop->join_type == JOIN_RIGHT || merge_infop->join_type == JOIN_OUTER) ? true : false;
-
-  /* QFILE_LIST_ID pointer from SCAN_ID */
-  outer_list_idp = outer_sid->s.llsid.list_id;
-  inner_list_idp = inner_sid->s.llsid.list_id;
+  assert (merge_infop->join_type == JOIN_INNER || merge_infop->join_type == JOIN_LEFT);
+  all_lefts = (merge_infop->join_type == JOIN_LEFT) ? true : false;
 
-  /* get merge columns count */
+  /* get join columns count */
   nvals = merge_infop->ls_column_cnt;
 
-  /* get indicator of merge columns */
+  /* get indicator of join columns */
   outer_indp = merge_infop->ls_outer_column;
   inner_indp = merge_infop->ls_inner_column;
 
+  /* choose how the inner tuples are kept in the hash table; see check_hash_list_scan () */
+  if ((UINT64) inner_list_idp->page_cnt * DB_PAGESIZE <= mem_limit)
+    {
+      hash_method = HASH_METH_IN_MEM;
+    }
+  else if ((UINT64) inner_list_idp->tuple_cnt * (sizeof (HENTRY_HLS) + sizeof (QFILE_TUPLE_SIMPLE_POS)) <= mem_limit)
+    {
+      hash_method = HASH_METH_HYBRID;
+    }
+  else
+    {
+      hash_method = HASH_METH_HASH_FILE;
+    }
+
+  for (k = 0; k < nvals && hash_method != HASH_METH_NOT_USE; k++)
+    {
+      outer_type = TP_DOMAIN_TYPE (outer_list_idp->type_list.domp[outer_indp[k]]);
+      inner_type = TP_DOMAIN_TYPE (inner_list_idp->type_list.domp[inner_indp[k]]);
+
+      /* object references can not be coerced to be hashed alike */
+      if (((outer_type == DB_TYPE_OBJECT || outer_type == DB_TYPE_VOBJ) && inner_type == DB_TYPE_OID)
+	  || ((inner_type == DB_TYPE_OBJECT || inner_type == DB_TYPE_VOBJ) && outer_type == DB_TYPE_OID))
+	{
+	  hash_method = HASH_METH_NOT_USE;
+	}
+    }
+
+  if (hash_method == HASH_METH_NOT_USE)
+    {
+      return qexec_sort_merge_list (thread_p, outer_list_idp, inner_list_idp, merge_infop, ls_flag);
+    }
+
   /* form the typelist for the resultant list file */
   type_list.type_cnt = merge_infop->ls_pos_cnt;
   type_list.domp = (TP_DOMAIN **) malloc (type_list.type_cnt * sizeof (TP_DOMAIN *));
   if (type_list.domp == NULL)
     {
-      GOTO_EXIT_ON_ERROR;
+      goto exit_on_error;
     }
 
   for (k = 0; k < type_list.type_cnt; k++)
@@ -5728,6 +5968,16 @@ qexec_merge_list_outer (THREAD_ENTRY * thread_p, SCAN_ID * outer_sid, SCAN_ID *
 			   : inner_list_idp->type_list.domp[merge_infop->ls_pos_list[k]]);
     }
 
+  outer_sid.status = S_CLOSED;
+  inner_sid.status = S_CLOSED;
+
+  /* open a scan on the outer(inner) list file */
+  if (qfile_open_list_scan (outer_list_idp, &outer_sid) != NO_ERROR
+      || qfile_open_list_scan (inner_list_idp, &inner_sid) != NO_ERROR)
+    {
+      goto exit_on_error;
+    }
+
   /* open the result list file; same query id with outer(inner) list file */
   list_idp = qfile_open_list (thread_p, &type_list, NULL, outer_list_idp->query_id, ls_flag);
   if (list_idp == NULL)
@@ -5735,14 +5985,8 @@ qexec_merge_list_outer (THREAD_ENTRY * thread_p, SCAN_ID * outer_sid, SCAN_ID *
       goto exit_on_error;
     }
 
-  if (all_lefts && outer_list_idp->tuple_cnt == 0)
-    {
-      all_lefts = false;
-      goto exit_on_end;
-    }
-  if (all_rghts && inner_list_idp->tuple_cnt == 0)
+  if (outer_list_idp->tuple_cnt == 0 || (inner_list_idp->tuple_cnt == 0 && !all_lefts))
     {
-      all_rghts = false;
       goto exit_on_end;
     }
 
@@ -5752,7 +5996,7 @@ qexec_merge_list_outer (THREAD_ENTRY * thread_p, SCAN_ID * outer_sid, SCAN_ID *
       goto exit_on_error;
     }
 
-  /* merge column domain info */
+  /* join column domain info */
   outer_domp = (TP_DOMAIN **) db_private_alloc (thread_p, nvals * sizeof (TP_DOMAIN *));
   if (outer_domp == NULL)
     {
@@ -5765,13 +6009,23 @@ qexec_merge_list_outer (THREAD_ENTRY * thread_p, SCAN_ID * outer_sid, SCAN_ID *
       goto exit_on_error;
     }
 
+  coerce_domp = (TP_DOMAIN **) db_private_alloc (thread_p, nvals * sizeof (TP_DOMAIN *));
+  if (coerce_domp == NULL)
+    {
+      goto exit_on_error;
+    }
+
   for (k = 0; k < nvals; k++)
     {
-      outer_domp[k] = outer_list_idp->type_list.domp[merge_infop->ls_outer_column[k]];
-      inner_domp[k] = inner_list_idp->type_list.domp[merge_infop->ls_inner_column[k]];
+      outer_domp[k] = outer_list_idp->type_list.domp[outer_indp[k]];
+      inner_domp[k] = inner_list_idp->type_list.domp[inner_indp[k]];
+
+      /* inner values are hashed in the domain of the outer ones; equal values of domains which differ only in
+       * precision, scale or collation do not share their hash value either */
+      coerce_domp[k] = !tp_domain_match (outer_domp[k], inner_domp[k], TP_EXACT_MATCH) ? outer_domp[k] : NULL;
     }
 
-  /* merge column val pointer */
+  /* join column val pointer */
   outer_valp = (char **) db_private_alloc (thread_p, nvals * sizeof (char *));
   if (outer_valp == NULL)
     {
@@ -5784,3907 +6038,3479 @@ qexec_merge_list_outer (THREAD_ENTRY * thread_p, SCAN_ID * outer_sid, SCAN_ID *
       goto exit_on_error;
     }
 
-  /* start scans */
-  if (scan_start_scan (thread_p, outer_sid) != NO_ERROR || scan_start_scan (thread_p, inner_sid) != NO_ERROR)
+  key = qdata_alloc_hscan_key (thread_p, nvals, true);
+  if (key == NULL)
     {
       goto exit_on_error;
     }
 
-  /* set tuple record pointer in QFILE_LIST_SCAN_ID */
-  outer_sid->s.llsid.tplrecp = &outer_tplrec;
-  inner_sid->s.llsid.tplrecp = &inner_tplrec;
-
-
-  /* When a list file is sorted on a column, all the NULL value appear at the beginning of the list. So, we know that
-   * all the following values in the outer/inner column are BOUND(not NULL) value. And we can process all NULL values
-   * before the merging process. */
-
-  /* move the outer(left) scan to the first tuple */
-  while (1)
+  if (hash_method == HASH_METH_HASH_FILE)
     {
-      /* fetch a next tuple from outer(left) list file and position tuple values (to merge columns) */
-      QEXEC_MERGE_OUTER_NEXT_SCAN_PVALS (thread_p, outer, true);
-
-      if (outer_sid->qualification == QPROC_QUALIFIED)
+      file_hash_table = fhs_create (thread_p, outer_list_idp->query_id, inner_list_idp->tuple_cnt);
+      if (file_hash_table == NULL)
 	{
-	  for (k = 0; k < nvals; k++)
-	    {
-	      if (QFILE_GET_TUPLE_VALUE_FLAG (outer_valp[k]) == V_UNBOUND)
-		{
-		  break;
-		}
-	    }
-	  if (k >= nvals)
-	    {			/* not found V_UNBOUND */
-	      break;		/* found valid tuple. exit loop */
-	    }
+	  goto exit_on_error;
 	}
-
-      /* depending on the join type, join with a NULL opposite row when a NULL or a not-qualified is encountered, or
-       * skip it. */
-      if (all_lefts)
+    }
+  else
+    {
+      hash_table =
+	mht_create_hls ("Hash Join", inner_list_idp->tuple_cnt, qdata_hash_scan_key, qdata_hscan_key_eq);
+      if (hash_table == NULL)
 	{
-	  QEXEC_MERGE_ADD_MERGETUPLE (thread_p, &outer_tplrec, NULL);
+	  goto exit_on_error;
 	}
     }
 
-  /* move the inner(right) scan to the first tuple */
-  while (1)
+  /* build phase: hash every inner tuple on its join columns. NULL values and values which can not be coerced to
+   * the outer domain never join, so skip such tuples. */
+  while ((inner_scan = qfile_scan_list_next (thread_p, &inner_sid, &inner_tplrec, PEEK)) == S_SUCCESS)
     {
-      /* move the inner(right) scan to the first tuple and position tuple values (to merge columns) */
-      QEXEC_MERGE_OUTER_NEXT_SCAN_PVALS (thread_p, inner, true);
+      if (qdata_build_hscan_key_from_tuple (inner_tplrec.tpl, inner_indp, inner_domp, coerce_domp, key,
+					    &is_unmatched) != NO_ERROR)
+	{
+	  goto exit_on_error;
+	}
+      if (is_unmatched)
+	{
+	  continue;
+	}
 
-      if (inner_sid->qualification == QPROC_QUALIFIED)
+      if (hash_method == HASH_METH_HASH_FILE)
 	{
-	  for (k = 0; k < nvals; k++)
+	  simple_pos.vpid = inner_sid.curr_vpid;
+	  simple_pos.offset = inner_sid.curr_offset;
+	  if (fhs_insert (thread_p, file_hash_table, key, &simple_pos) != NO_ERROR)
 	    {
-	      if (QFILE_GET_TUPLE_VALUE_FLAG (inner_valp[k]) == V_UNBOUND)
-		{
-		  break;
-		}
-	    }
-	  if (k >= nvals)
-	    {			/* not found V_UNBOUND */
-	      break;		/* found valid tuple. exit loop */
+	      goto exit_on_error;
 	    }
+	  continue;
 	}
 
-      /* depending on the join type, join with a NULL opposite row when a NULL is encountered, or skip it. */
-      if (all_rghts)
+      if (hash_method == HASH_METH_IN_MEM)
 	{
-	  QEXEC_MERGE_ADD_MERGETUPLE (thread_p, NULL, &inner_tplrec);
+	  hvalue = qdata_alloc_hscan_value (thread_p, inner_tplrec.tpl);
+	}
+      else
+	{
+	  hvalue = qdata_alloc_hscan_value_OID (thread_p, &inner_sid);
+	}
+      if (hvalue == NULL)
+	{
+	  goto exit_on_error;
 	}
-    }
 
-  /* set the comparison function to be called */
-  direction = S_FORWARD;
-  group_cnt = 0;
-  already_compared = false;
-  val_cmp = DB_UNK;
+      if (mht_put_hls (hash_table, (void *) key, (void *) hvalue) == NULL)
+	{
+	  qdata_free_hscan_value (thread_p, hvalue);
+	  goto exit_on_error;
+	}
+    }
+  if (inner_scan == S_ERROR)
+    {
+      goto exit_on_error;
+    }
 
-  while (1)
+  /* probe phase: look up every outer tuple and re-check the join columns of each candidate in the bucket */
+  while ((outer_scan = qfile_scan_list_next (thread_p, &outer_sid, &outer_tplrec, PEEK)) == S_SUCCESS)
     {
-      /* compare two tuple values, if they have not been compared yet */
-      if (!already_compared)
+      if (qdata_build_hscan_key_from_tuple (outer_tplrec.tpl, outer_indp, outer_domp, NULL, key, &is_unmatched)
+	  != NO_ERROR)
 	{
-	  val_cmp = qexec_cmp_tpl_vals_merge (outer_valp, outer_domp, inner_valp, inner_domp, nvals);
-	  if (val_cmp == DB_UNK)
-	    {			/* is error */
-	      goto exit_on_error;
-	    }
+	  goto exit_on_error;
+	}
+      is_matched = false;
+      if (is_unmatched || inner_list_idp->tuple_cnt == 0)
+	{
+	  goto outer_done;
 	}
-      already_compared = false;	/* re-init */
 
-      /* value of the outer is less than value of the inner */
-      if (val_cmp == DB_LT)
+      QEXEC_MERGE_PVALS (outer);
+
+      if (hash_method == HASH_METH_HASH_FILE)
 	{
-	  /* if the group is not yet formed */
-	  if (group_cnt == 0)
+	  /* candidates only share the hash value with the outer key */
+	  if (fhs_search (thread_p, file_hash_table, key) != NO_ERROR)
 	    {
-	      /* depending on the join type, join with a NULL opposite row when it does not match */
-	      if (all_lefts)
+	      goto exit_on_error;
+	    }
+
+	  for (i = 0; i < file_hash_table->found_cnt; i++)
+	    {
+	      MAKE_TUPLE_POSTION (tuple_pos, (&file_hash_table->found[i]), (&inner_sid));
+	      if (qfile_jump_scan_tuple_position (thread_p, &inner_sid, &tuple_pos, &inner_tplrec, PEEK) != S_SUCCESS)
 		{
-		  /* merge the fetched tuple(left) and NULL tuple(right) */
-		  QEXEC_MERGE_ADD_MERGETUPLE (thread_p, &outer_tplrec, NULL);
+		  goto exit_on_error;
 		}
-	    }
 
-	  /* move the outer(left) scan to the next tuple and position tuple values (to merge columns) */
-	  QEXEC_MERGE_OUTER_NEXT_SCAN_PVALS (thread_p, outer, true);
-	  direction = S_FORWARD;
-	  group_cnt = 0;
+	      QEXEC_MERGE_PVALS (inner);
 
-	  continue;
+	      val_cmp = qexec_cmp_tpl_vals_merge (outer_valp, outer_domp, inner_valp, inner_domp, nvals);
+	      if (val_cmp == DB_UNK)
+		{		/* is error */
+		  goto exit_on_error;
+		}
+
+	      if (val_cmp == DB_EQ)
+		{
+		  /* merge the fetched tuples(left and right) */
+		  QEXEC_MERGE_ADD_MERGETUPLE (thread_p, &outer_tplrec, &inner_tplrec);
+		  is_matched = true;
+		}
+	    }
+	  goto outer_done;
 	}
 
-      /* value of the outer is greater than value of the inner */
-      if (val_cmp == DB_GT)
+      hentry = NULL;
+      for (hvalue = (HASH_SCAN_VALUE *) mht_get_hls (hash_table, (void *) key, (void **) &hentry); hvalue != NULL;
+	   hentry = hentry->next, hvalue = (hentry != NULL) ? (HASH_SCAN_VALUE *) hentry->data : NULL)
 	{
-	  /* if the group is not yet formed */
-	  if (group_cnt == 0)
+	  if (hash_method == HASH_METH_IN_MEM)
 	    {
-	      /* depending on the join type, join with a NULL opposite row when a NULL is encountered, or skip it. */
-	      if (all_rghts)
+	      inner_tplrec.tpl = hvalue->tuple;
+	    }
+	  else
+	    {
+	      MAKE_TUPLE_POSTION (tuple_pos, hvalue->pos, (&inner_sid));
+	      if (qfile_jump_scan_tuple_position (thread_p, &inner_sid, &tuple_pos, &inner_tplrec, PEEK) != S_SUCCESS)
 		{
-		  /* merge the fetched tuple(right) and NULL tuple(left) */
-		  QEXEC_MERGE_ADD_MERGETUPLE (thread_p, NULL, &inner_tplrec);
+		  goto exit_on_error;
 		}
 	    }
 
-	  /* move the inner(right) scan to the next tuple and position tuple values (to merge columns) */
-	  QEXEC_MERGE_OUTER_NEXT_SCAN_PVALS (thread_p, inner, true);
-	  direction = S_FORWARD;
-	  group_cnt = 0;
+	  QEXEC_MERGE_PVALS (inner);
 
-	  continue;
-	}
+	  val_cmp = qexec_cmp_tpl_vals_merge (outer_valp, outer_domp, inner_valp, inner_domp, nvals);
+	  if (val_cmp == DB_UNK)
+	    {			/* is error */
+	      goto exit_on_error;
+	    }
 
-      if (val_cmp != DB_EQ)
-	{			/* error ? */
-	  goto exit_on_error;
+	  if (val_cmp == DB_EQ)
+	    {
+	      /* merge the fetched tuples(left and right) */
+	      QEXEC_MERGE_ADD_MERGETUPLE (thread_p, &outer_tplrec, &inner_tplrec);
+	      is_matched = true;
+	    }
 	}
 
-      /* values of the outer and inner are equal, do a scan group processing */
-      merge_cnt = 0;
-      if (direction == S_FORWARD)
+    outer_done:
+      if (all_lefts && !is_matched)
 	{
-	  /* move forwards within a group */
-	  cnt = 0;
-	  /* group_cnt has the number of tuples in the group */
-	  while (1)
-	    {
-	      /* evaluate other outer join predicate */
-	      ev_res = V_UNKNOWN;
-	      if (other_outer_join_pred != NULL)
-		{
-		  ev_res = eval_pred (thread_p, other_outer_join_pred, &xasl_state->vd, NULL);
-		  if (ev_res == V_ERROR)
-		    {
-		      goto exit_on_error;
-		    }
-		}
+	  /* join with a NULL inner row */
+	  QEXEC_MERGE_ADD_MERGETUPLE (thread_p, &outer_tplrec, NULL);
+	}
+    }
+  if (outer_scan == S_ERROR)
+    {
+      goto exit_on_error;
+    }
 
-	      /* is qualified */
-	      if (other_outer_join_pred == NULL || ev_res == V_TRUE)
-		{
-		  /* merge the fetched tuples(left and right) */
-		  QEXEC_MERGE_ADD_MERGETUPLE (thread_p, &outer_tplrec, &inner_tplrec);
+exit_on_end:
+  free_and_init (type_list.domp);
+  qfile_close_scan (thread_p, &outer_sid);
+  qfile_close_scan (thread_p, &inner_sid);
 
-		  merge_cnt++;	/* increase the counter of merged tuples */
+  if (hash_table)
+    {
+      mht_clear_hls (hash_table, qdata_free_hscan_entry, (void *) thread_p);
+      mht_destroy_hls (hash_table);
+    }
 
-		  /* if scan works in a single_fetch mode and first qualified scan item has now been fetched, return
-		   * immediately. */
-		  if (merge_infop->single_fetch == QPROC_SINGLE_OUTER)
-		    {
-		      goto exit_on_end;
-		    }
-		}
+  if (file_hash_table)
+    {
+      fhs_destroy (thread_p, file_hash_table);
+    }
 
-	      cnt++;		/* increase the counter of processed tuples */
+  if (key)
+    {
+      qdata_free_hscan_key (thread_p, key, nvals);
+    }
 
-	      /* if the group is formed for the first time */
-	      if (group_cnt == 0)
-		{
-		  /* not qualified */
-		  if (!(other_outer_join_pred == NULL || ev_res == V_TRUE))
-		    {
-		      /* depending on the join type, join with a NULL opposite row when a NULL or a not-qualified is
-		       * encountered, or skip it. */
-		      if (all_rghts)
-			{
-			  /* merge the fetched tuple(right) and NULL tuple(left) */
-			  QEXEC_MERGE_ADD_MERGETUPLE (thread_p, NULL, &inner_tplrec);
-			}
-		    }
+  if (tplrec.tpl)
+    {
+      db_private_free_and_init (thread_p, tplrec.tpl);
+    }
 
-		  /* move the inner(right) scan to the next tuple and position tuple values (to merge columns) */
-		  QEXEC_MERGE_OUTER_NEXT_SCAN_PVALS (thread_p, inner, false	/* do not exit */
-		    );
-		  if (inner_scan == S_END)
-		    {
-		      if (merge_cnt == 0)
-			{	/* not merged */
-			  /* depending on the join type, join with a NULL opposite row when a NULL or a not-qualified
-			   * is encountered, or skip it. */
-			  if (all_lefts)
-			    {
-			      /* merge the fetched tuple(left) and NULL tuple(right) */
-			      QEXEC_MERGE_ADD_MERGETUPLE (thread_p, &outer_tplrec, NULL);
-			    }
-			}
-		      break;
-		    }
+  if (outer_domp)
+    {
+      db_private_free_and_init (thread_p, outer_domp);
+    }
+  if (outer_valp)
+    {
+      db_private_free_and_init (thread_p, outer_valp);
+    }
 
-		  /* and compare */
-		  val_cmp = qexec_cmp_tpl_vals_merge (outer_valp, outer_domp, inner_valp, inner_domp, nvals);
-		  if (val_cmp != DB_EQ)
-		    {
-		      if (val_cmp == DB_UNK)
-			{	/* is error */
-			  goto exit_on_error;
-			}
+  if (inner_domp)
+    {
+      db_private_free_and_init (thread_p, inner_domp);
+    }
+  if (inner_valp)
+    {
+      db_private_free_and_init (thread_p, inner_valp);
+    }
 
-		      if (merge_cnt == 0)
-			{	/* not merged */
-			  /* depending on the join type, join with a NULL opposite row when a NULL or a not-qualified
-			   * is encountered, or skip it. */
-			  if (all_lefts)
-			    {
-			      /* merge the fetched tuple(left) and NULL tuple(right) */
-			      QEXEC_MERGE_ADD_MERGETUPLE (thread_p, &outer_tplrec, NULL);
-			    }
-			}
+  if (coerce_domp)
+    {
+      db_private_free_and_init (thread_p, coerce_domp);
+    }
 
-		      break;	/* found the bottom of the group */
-		    }
-		}
-	      else
-		{		/* group_cnt > 0 */
-		  if (cnt >= group_cnt)
-		    {
-		      if (merge_cnt == 0)
-			{	/* not merged */
-			  /* depending on the join type, join with a NULL opposite row when a NULL or a not-qualified
-			   * is encountered, or skip it. */
-			  if (all_lefts)
-			    {
-			      /* merge the fetched tuple(left) and NULL tuple(right) */
-			      QEXEC_MERGE_ADD_MERGETUPLE (thread_p, &outer_tplrec, NULL);
-			    }
-			}
-		      break;	/* reached the bottom of the group */
-		    }
-
-		  /* move the inner(right) scan to the next tuple */
-		  QEXEC_MERGE_OUTER_NEXT_SCAN (thread_p, inner, true);
-		}
-	    }			/* while (1) */
+  if (list_idp)
+    {
+      qfile_close_list (thread_p, list_idp);
+    }
 
-	  /* move the outer to the next tuple and position tuple values */
-	  QEXEC_MERGE_OUTER_NEXT_SCAN_PVALS (thread_p, outer, true);
+  return list_idp;
 
-	  /* if the group is formed for the first time */
-	  if (group_cnt == 0)
-	    {
-	      /* save the position of inner scan; it is the bottom of the group */
-	      scan_save_scan_pos (inner_sid, &inner_scanpos);
+exit_on_error:
+  if (list_idp)
+    {
+      qfile_close_list (thread_p, list_idp);
+      QFILE_FREE_AND_INIT_LIST_ID (list_idp);
+    }
 
-	      if (inner_scan == S_END)
-		{
-		  /* move the inner to the previous tuple and position tuple values */
-		  QEXEC_MERGE_OUTER_PREV_SCAN_PVALS (thread_p, inner);
+  list_idp = NULL;
+  goto exit_on_end;
+}
 
-		  /* set group count and direction */
-		  group_cnt = cnt;
-		  direction = S_BACKWARD;
-		}
-	      else
-		{
-		  /* and compare */
-		  val_cmp = qexec_cmp_tpl_vals_merge (outer_valp, outer_domp, inner_valp, inner_domp, nvals);
-		  if (val_cmp == DB_UNK)
-		    {		/* is error */
-		      goto exit_on_error;
-		    }
+/*
+ * qexec_sort_merge_list () -
+ *   return: QFILE_LIST_ID *, or NULL
+ *   outer_list_idp(in) : First (left) list file to be merged
+ *   inner_list_idp(in) : Second (right) list file to be merged
+ *   merge_infop(in)    : List file merge information
+ *   ls_flag(in)        :
+ *
+ * Note: This routine sorts the given two unordered list files on their
+ * join columns and merges them. It is used by a hash join whose inner
+ * list file is too big to be hashed in memory.
+ */
+static QFILE_LIST_ID *
+qexec_sort_merge_list (THREAD_ENTRY * thread_p, QFILE_LIST_ID * outer_list_idp, QFILE_LIST_ID * inner_list_idp,
+		       QFILE_LIST_MERGE_INFO * merge_infop, int ls_flag)
+{
+  QFILE_LIST_ID *list_idp = NULL;
+  SORT_LIST *outer_sort_list = NULL, *inner_sort_list = NULL;
+  SORT_LIST *outer_order, *inner_order;
+  int k;
 
-		  if (val_cmp == DB_LT)
-		    {
-		      /* move the inner to the previous tuple and position tuple values */
-		      QEXEC_MERGE_OUTER_PREV_SCAN_PVALS (thread_p, inner);
+  outer_sort_list = qfile_allocate_sort_list (thread_p, merge_infop->ls_column_cnt);
+  if (outer_sort_list == NULL)
+    {
+      goto exit_on_end;
+    }
 
-		      /* and compare */
-		      val_cmp = qexec_cmp_tpl_vals_merge (outer_valp, outer_domp, inner_valp, inner_domp, nvals);
-		      if (val_cmp == DB_UNK)
-			{	/* is error */
-			  goto exit_on_error;
-			}
+  inner_sort_list = qfile_allocate_sort_list (thread_p, merge_infop->ls_column_cnt);
+  if (inner_sort_list == NULL)
+    {
+      goto exit_on_end;
+    }
 
-		      if (val_cmp == DB_EQ)
-			{
-			  /* next value is the same, so prepare for further group scan operations */
+  for (k = 0, outer_order = outer_sort_list, inner_order = inner_sort_list; k < merge_infop->ls_column_cnt;
+       k++, outer_order = outer_order->next, inner_order = inner_order->next)
+    {
+      outer_order->s_order = S_ASC;
+      outer_order->s_nulls = S_NULLS_FIRST;
+      outer_order->pos_descr.pos_no = merge_infop->ls_outer_column[k];
+      outer_order->pos_descr.dom = outer_list_idp->type_list.domp[merge_infop->ls_outer_column[k]];
 
-			  /* set group count and direction */
-			  group_cnt = cnt;
-			  direction = S_BACKWARD;
-			}
-		      else
-			{
-			  /* move the inner to the current tuple and position tuple values */
-			  QEXEC_MERGE_OUTER_NEXT_SCAN_PVALS (thread_p, inner, true);
+      inner_order->s_order = S_ASC;
+      inner_order->s_nulls = S_NULLS_FIRST;
+      inner_order->pos_descr.pos_no = merge_infop->ls_inner_column[k];
+      inner_order->pos_descr.dom = inner_list_idp->type_list.domp[merge_infop->ls_inner_column[k]];
+    }
 
-			  val_cmp = DB_LT;	/* restore comparison */
-			}
-		    }
+  if (qfile_sort_list (thread_p, outer_list_idp, outer_sort_list, Q_ALL, true) == NULL
+      || qfile_sort_list (thread_p, inner_list_idp, inner_sort_list, Q_ALL, true) == NULL)
+    {
+      goto exit_on_end;
+    }
 
-		  /* comparison has already been done */
-		  already_compared = true;
-		}
-	    }
-	  else
-	    {
-	      /* set further scan direction */
-	      direction = S_BACKWARD;
-	    }
-	}
-      else
-	{			/* (direction == S_BACKWARD) */
-	  /* move backwards within a group */
-	  cnt = group_cnt;
-	  /* group_cnt has the number of tuples in the group */
-	  while (1)
-	    {
-	      /* evaluate other outer join predicate */
-	      ev_res = V_UNKNOWN;
-	      if (other_outer_join_pred != NULL)
-		{
-		  ev_res = eval_pred (thread_p, other_outer_join_pred, &xasl_state->vd, NULL);
-		  if (ev_res == V_ERROR)
-		    {
-		      goto exit_on_error;
-		    }
-		}
+  list_idp = qexec_merge_list (thread_p, outer_list_idp, inner_list_idp, merge_infop, ls_flag);
 
-	      /* is qualified */
-	      if (other_outer_join_pred == NULL || ev_res == V_TRUE)
-		{
-		  /* merge the fetched tuples(left and right) */
-		  QEXEC_MERGE_ADD_MERGETUPLE (thread_p, &outer_tplrec, &inner_tplrec);
+exit_on_end:
+  if (outer_sort_list)
+    {
+      qfile_free_sort_list (thread_p, outer_sort_list);
+    }
+  if (inner_sort_list)
+    {
+      qfile_free_sort_list (thread_p, inner_sort_list);
+    }
 
-		  merge_cnt++;	/* increase the counter of merged tuples */
-		}
+  return list_idp;
+}
 
-	      cnt--;		/* decrease the counter of the processed tuples */
+/*
+ * qexec_merge_list_outer () -
+ *   return:
+ *   outer_sid(in)      :
+ *   inner_sid(in)      :
+ *   merge_infop(in)    :
+ *   other_outer_join_pred(in)  :
+ *   xasl_state(in)     :
+ *   ls_flag(in)        :
+ */
+static QFILE_LIST_ID *
+qexec_merge_list_outer (THREAD_ENTRY * thread_p, SCAN_ID * outer_sid, SCAN_ID * inner_sid,
+			QFILE_LIST_MERGE_INFO * merge_infop, PRED_EXPR * other_outer_join_pred, XASL_STATE * xasl_state,
+			int ls_flag)
+{
+  /* outer -> left scan, inner -> right scan */
 
-	      if (cnt <= 0)
-		{
-		  if (merge_cnt == 0)
-		    {		/* not merged */
-		      /* depending on the join type, join with a NULL opposite row when a NULL or a not-qualified is
-		       * encountered, or skip it. */
-		      if (all_lefts)
-			{
-			  /* merge the fetched tuple(left) and NULL tuple(right) */
-			  QEXEC_MERGE_ADD_MERGETUPLE (thread_p, &outer_tplrec, NULL);
-			}
-		    }
-		  break;	/* finish the group */
-		}
+  /* pre-defined vars: */
+  QFILE_LIST_ID *list_idp = NULL;
+  int nvals;
+  QFILE_TUPLE_RECORD tplrec = { NULL, 0 };
+  QFILE_TUPLE_RECORD outer_tplrec = { NULL, 0 };
+  QFILE_TUPLE_RECORD inner_tplrec = { NULL, 0 };
+  int *outer_indp, *inner_indp;
+  char **outer_valp = NULL, **inner_valp = NULL;
+  SCAN_CODE outer_scan = S_END, inner_scan = S_END;
 
-	      /* if not yet reached the top of the group */
-	      /* move the inner(right) scan to the previous tuple */
-	      QEXEC_MERGE_OUTER_PREV_SCAN (thread_p, inner);
+  TP_DOMAIN **outer_domp = NULL, **inner_domp = NULL;
+  QFILE_LIST_ID *outer_list_idp, *inner_list_idp;
+  QFILE_TUPLE_VALUE_TYPE_LIST type_list;
+  int k, cnt, group_cnt, merge_cnt, already_compared;
+  SCAN_DIRECTION direction;
+  SCAN_POS inner_scanpos;
+  bool all_lefts, all_rghts;
+  DB_LOGICAL ev_res;
+  DB_VALUE_COMPARE_RESULT val_cmp;
 
-	      /* all of the inner tuples in the group have the same value at the merge column, so we don't need to
-	       * compare with the value of the outer one; just count the number of the tuples in the group */
-	    }			/* while (1) */
+  direction = S_FORWARD;	/* init */
+  val_cmp = DB_NE;		/* init - mark as not yet compared */
 
-	  /* position tuple values (to merge columns) */
-	  QEXEC_MERGE_PVALS (inner);
+  /* determine all lefts or all rights option depending on join type */
+  all_lefts = (merge_infop->join_type == JOIN_LEFT || merge_infop->join_type == JOIN_OUTER) ? true : false;
+  all_rghts = (merge_infop->join_type == JOIN_RIGHT || merge_infop->join_type == JOIN_OUTER) ? true : false;
 
-	  /* move the outer(left) scan to the next tuple and position tuple values */
-	  QEXEC_MERGE_OUTER_NEXT_SCAN_PVALS (thread_p, outer, true);
+  /* QFILE_LIST_ID pointer from SCAN_ID */
+  outer_list_idp = outer_sid->s.llsid.list_id;
+  inner_list_idp = inner_sid->s.llsid.list_id;
 
-	  /* and compare */
-	  val_cmp = qexec_cmp_tpl_vals_merge (outer_valp, outer_domp, inner_valp, inner_domp, nvals);
-	  if (val_cmp == DB_UNK)
-	    {			/* is error */
-	      goto exit_on_error;
-	    }
+  /* get merge columns count */
+  nvals = merge_infop->ls_column_cnt;
 
-	  if (val_cmp != DB_EQ)
-	    {
-	      /* jump to the previously set scan position */
-	      inner_scan = scan_jump_scan_pos (thread_p, inner_sid, &inner_scanpos);
-	      /* is saved position the end of scan? */
-	      if (inner_scan == S_END)
-		{
-		  goto exit_on_end;	/* inner(right) is exhausted */
-		}
+  /* get indicator of merge columns */
+  outer_indp = merge_infop->ls_outer_column;
+  inner_indp = merge_infop->ls_inner_column;
 
-	      /* and position tuple values */
-	      QEXEC_MERGE_PVALS (inner);
+  /* form the typelist for the resultant list file */
+  type_list.type_cnt = merge_infop->ls_pos_cnt;
+  type_list.domp = (TP_DOMAIN **) malloc (type_list.type_cnt * sizeof (TP_DOMAIN *));
+  if (type_list.domp == NULL)
+    {
+      GOTO_EXIT_ON_ERROR;
+    }
 
-	      /* reset group count */
-	      group_cnt = 0;
-	    }
-	  else
-	    {
-	      /* comparison has already been done */
-	      already_compared = true;
-	    }
+  for (k = 0; k < type_list.type_cnt; k++)
+    {
+      type_list.domp[k] = ((merge_infop->ls_outer_inner_list[k] == QFILE_OUTER_LIST)
+			   ? outer_list_idp->type_list.domp[merge_infop->ls_pos_list[k]]
+			   : inner_list_idp->type_list.domp[merge_infop->ls_pos_list[k]]);
+    }
 
-	  /* set further scan direction */
-	  direction = S_FORWARD;
-
-	}			/* (direction == S_BACKWARD) */
-
-    }				/* while (1) */
-
-exit_on_end:
-  /* inner(right) is at the end. is there more to the outer(left) ? */
-  if (all_lefts)
+  /* open the result list file; same query id with outer(inner) list file */
+  list_idp = qfile_open_list (thread_p, &type_list, NULL, outer_list_idp->query_id, ls_flag);
+  if (list_idp == NULL)
     {
-      while (outer_scan != S_END)
-	{
-	  /* merge the fetched tuple(left) and NULL tuple(right) */
-	  QEXEC_MERGE_ADD_MERGETUPLE (thread_p, &outer_tplrec, NULL);
-
-	  /* move the outer to the next tuple */
-	  QEXEC_MERGE_OUTER_NEXT_SCAN (thread_p, outer, false /* do not exit */ );
-	}
-    }				/* if (all_lefts) */
+      goto exit_on_error;
+    }
 
-  /* outer(left) is at the end. is there more to the inner(right) ? */
-  if (all_rghts)
+  if (all_lefts && outer_list_idp->tuple_cnt == 0)
     {
-      if (direction == S_FORWARD)
-	{
-	  if (val_cmp == DB_NE)
-	    {			/* mark as not yet compared */
-	      val_cmp = DB_UNK;	/* clear */
-
-	      /* move the inner(right) scan to the first tuple and position tuple values (to merge columns) */
-	      QEXEC_MERGE_OUTER_NEXT_SCAN_PVALS (thread_p, inner, true);
-	    }
-	  else if (val_cmp == DB_EQ)
-	    {			/* outer scan END */
-	      val_cmp = DB_UNK;	/* clear */
-
-	      /* move the inner(right) scan to the next tuple and position tuple values */
-	      QEXEC_MERGE_OUTER_NEXT_SCAN_PVALS (thread_p, inner, true);
-	    }
-	}
-      else
-	{			/* direction == S_BACKWARD */
-	  inner_scan = scan_jump_scan_pos (thread_p, inner_sid, &inner_scanpos);
-	}
-      while (inner_scan != S_END)
-	{
-	  /* merge the fetched tuple(right) and NULL tuple(left) */
-	  QEXEC_MERGE_ADD_MERGETUPLE (thread_p, NULL, &inner_tplrec);
-
-	  /* move the inner to the next tuple */
-	  QEXEC_MERGE_OUTER_NEXT_SCAN (thread_p, inner, false /* do not exit */ );
-	}
-    }				/* if (all_rghts) */
-
-  free_and_init (type_list.domp);
-  scan_end_scan (thread_p, outer_sid);
-  scan_end_scan (thread_p, inner_sid);
-  outer_sid->s.llsid.tplrecp = NULL;
-  inner_sid->s.llsid.tplrecp = NULL;
-
-  if (tplrec.tpl)
+      all_lefts = false;
+      goto exit_on_end;
+    }
+  if (all_rghts && inner_list_idp->tuple_cnt == 0)
     {
-      db_private_free_and_init (thread_p, tplrec.tpl);
+      all_rghts = false;
+      goto exit_on_end;
     }
 
-  if (outer_domp)
+  /* allocate the area to store the merged tuple */
+  if (qfile_reallocate_tuple (&tplrec, DB_PAGESIZE) != NO_ERROR)
     {
-      db_private_free_and_init (thread_p, outer_domp);
+      goto exit_on_error;
     }
-  if (outer_valp)
+
+  /* merge column domain info */
+  outer_domp = (TP_DOMAIN **) db_private_alloc (thread_p, nvals * sizeof (TP_DOMAIN *));
+  if (outer_domp == NULL)
     {
-      db_private_free_and_init (thread_p, outer_valp);
+      goto exit_on_error;
     }
 
-  if (inner_domp)
+  inner_domp = (TP_DOMAIN **) db_private_alloc (thread_p, nvals * sizeof (TP_DOMAIN *));
+  if (inner_domp == NULL)
     {
-      db_private_free_and_init (thread_p, inner_domp);
+      goto exit_on_error;
     }
-  if (inner_valp)
+
+  for (k = 0; k < nvals; k++)
     {
-      db_private_free_and_init (thread_p, inner_valp);
+      outer_domp[k] = outer_list_idp->type_list.domp[merge_infop->ls_outer_column[k]];
+      inner_domp[k] = inner_list_idp->type_list.domp[merge_infop->ls_inner_column[k]];
     }
 
-  if (list_idp)
+  /* merge column val pointer */
+  outer_valp = (char **) db_private_alloc (thread_p, nvals * sizeof (char *));
+  if (outer_valp == NULL)
     {
-      qfile_close_list (thread_p, list_idp);
+      goto exit_on_error;
     }
 
-  return list_idp;
-
-exit_on_error:
-  if (list_idp)
+  inner_valp = (char **) db_private_alloc (thread_p, nvals * sizeof (char *));
+  if (inner_valp == NULL)
     {
-      qfile_close_list (thread_p, list_idp);
-      QFILE_FREE_AND_INIT_LIST_ID (list_idp);
+      goto exit_on_error;
     }
 
-  list_idp = NULL;
-
-  direction = S_FORWARD;
-  val_cmp = DB_UNK;		/* mark as error */
-  all_lefts = all_rghts = false;
-
-  goto exit_on_end;
-}
+  /* start scans */
+  if (scan_start_scan (thread_p, outer_sid) != NO_ERROR || scan_start_scan (thread_p, inner_sid) != NO_ERROR)
+    {
+      goto exit_on_error;
+    }
 
-/*
- * qexec_merge_listfiles () -
- *   return: NO_ERROR, or ER_code
- *   xasl(in)   : XASL Tree pointer
- *   xasl_state(in)     :
- *
- * Note: This function is used for a direct merge of two LIST files
- * during XASL tree interpretation.
- *
- * Note: For a direct list file merge, currently the outer and inner columns
- * should have the same data type.
- */
-static int
-qexec_merge_listfiles (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state)
-{
-  QFILE_LIST_ID *list_id = NULL;
-  ACCESS_SPEC_TYPE *outer_spec = NULL;	/* left */
-  ACCESS_SPEC_TYPE *inner_spec = NULL;	/* right */
-  QFILE_LIST_MERGE_INFO *merge_infop = &(xasl->proc.mergelist.ls_merge);
-  XASL_NODE *outer_xasl, *inner_xasl;
-  int ls_flag = 0;
+  /* set tuple record pointer in QFILE_LIST_SCAN_ID */
+  outer_sid->s.llsid.tplrecp = &outer_tplrec;
+  inner_sid->s.llsid.tplrecp = &inner_tplrec;
 
-  outer_xasl = xasl->proc.mergelist.outer_xasl;
-  inner_xasl = xasl->proc.mergelist.inner_xasl;
 
-  /* open the empty list file if not already open */
+  /* When a list file is sorted on a column, all the NULL value appear at the beginning of the list. So, we know that
+   * all the following values in the outer/inner column are BOUND(not NULL) value. And we can process all NULL values
+   * before the merging process. */
 
-  if (outer_xasl->list_id->type_list.type_cnt == 0)
+  /* move the outer(left) scan to the first tuple */
+  while (1)
     {
-      /* start main block iterations */
-      if (qexec_start_mainblock_iterations (thread_p, outer_xasl, xasl_state) != NO_ERROR)
+      /* fetch a next tuple from outer(left) list file and position tuple values (to merge columns) */
+      QEXEC_MERGE_OUTER_NEXT_SCAN_PVALS (thread_p, outer, true);
+
+      if (outer_sid->qualification == QPROC_QUALIFIED)
 	{
-	  GOTO_EXIT_ON_ERROR;
+	  for (k = 0; k < nvals; k++)
+	    {
+	      if (QFILE_GET_TUPLE_VALUE_FLAG (outer_valp[k]) == V_UNBOUND)
+		{
+		  break;
+		}
+	    }
+	  if (k >= nvals)
+	    {			/* not found V_UNBOUND */
+	      break;		/* found valid tuple. exit loop */
+	    }
 	}
-    }
-  if (inner_xasl->list_id->type_list.type_cnt == 0)
-    {
-      /* start main block iterations */
-      if (qexec_start_mainblock_iterations (thread_p, inner_xasl, xasl_state) != NO_ERROR)
+
+      /* depending on the join type, join with a NULL opposite row when a NULL or a not-qualified is encountered, or
+       * skip it. */
+      if (all_lefts)
 	{
-	  GOTO_EXIT_ON_ERROR;
+	  QEXEC_MERGE_ADD_MERGETUPLE (thread_p, &outer_tplrec, NULL);
 	}
     }
 
-  /* If MERGELIST_PROC does not have 'order by' (xasl->orderby_list), then the list file to be open at here will be the
-   * last one. Otherwise, the last list file will be open at qexec_orderby_distinct(). (Note that only one that can
-   * have 'group by' is BUILDLIST_PROC type.) And, the top most XASL is the other condition for the list file to be the
-   * last result file. */
-
-  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_ALL);
-  if (XASL_IS_FLAGED (xasl, XASL_TOP_MOST_XASL) && XASL_IS_FLAGED (xasl, XASL_TO_BE_CACHED)
-      && (xasl->orderby_list == NULL || XASL_IS_FLAGED (xasl, XASL_SKIP_ORDERBY_LIST)) && xasl->option != Q_DISTINCT)
-    {
-      QFILE_SET_FLAG (ls_flag, QFILE_FLAG_RESULT_FILE);
-    }
-
-  if (merge_infop->join_type == JOIN_INNER)
-    {
-      /* call list file merge routine */
-      list_id = qexec_merge_list (thread_p, outer_xasl->list_id, inner_xasl->list_id, merge_infop, ls_flag);
-    }
-  else
+  /* move the inner(right) scan to the first tuple */
+  while (1)
     {
-      outer_spec = xasl->proc.mergelist.outer_spec_list;
-      inner_spec = xasl->proc.mergelist.inner_spec_list;
+      /* move the inner(right) scan to the first tuple and position tuple values (to merge columns) */
+      QEXEC_MERGE_OUTER_NEXT_SCAN_PVALS (thread_p, inner, true);
 
-      assert (xasl->scan_op_type == S_SELECT);
-      if (qexec_open_scan (thread_p, outer_spec, xasl->proc.mergelist.outer_val_list, &xasl_state->vd, false,
-			   outer_spec->fixed_scan, outer_spec->grouped_scan, true, &outer_spec->s_id,
-			   xasl_state->query_id, S_SELECT, false, NULL) != NO_ERROR)
+      if (inner_sid->qualification == QPROC_QUALIFIED)
 	{
-	  GOTO_EXIT_ON_ERROR;
+	  for (k = 0; k < nvals; k++)
+	    {
+	      if (QFILE_GET_TUPLE_VALUE_FLAG (inner_valp[k]) == V_UNBOUND)
+		{
+		  break;
+		}
+	    }
+	  if (k >= nvals)
+	    {			/* not found V_UNBOUND */
+	      break;		/* found valid tuple. exit loop */
+	    }
 	}
 
-      if (qexec_open_scan (thread_p, inner_spec, xasl->proc.mergelist.inner_val_list, &xasl_state->vd, false,
-			   inner_spec->fixed_scan, inner_spec->grouped_scan, true, &inner_spec->s_id,
-			   xasl_state->query_id, S_SELECT, false, NULL) != NO_ERROR)
+      /* depending on the join type, join with a NULL opposite row when a NULL is encountered, or skip it. */
+      if (all_rghts)
 	{
-	  GOTO_EXIT_ON_ERROR;
+	  QEXEC_MERGE_ADD_MERGETUPLE (thread_p, NULL, &inner_tplrec);
 	}
-
-      /* call outer join merge routine */
-      list_id =
-	qexec_merge_list_outer (thread_p, &outer_spec->s_id, &inner_spec->s_id, merge_infop, xasl->after_join_pred,
-				xasl_state, ls_flag);
-
-      qexec_close_scan (thread_p, outer_spec);
-      outer_spec = NULL;
-
-      qexec_close_scan (thread_p, inner_spec);
-      inner_spec = NULL;
-    }
-
-  if (list_id == NULL)
-    {
-      GOTO_EXIT_ON_ERROR;
     }
 
-  /* make this the resultant list file */
-  qfile_copy_list_id (xasl->list_id, list_id, true);
-  QFILE_FREE_AND_INIT_LIST_ID (list_id);
+  /* set the comparison function to be called */
+  direction = S_FORWARD;
+  group_cnt = 0;
+  already_compared = false;
+  val_cmp = DB_UNK;
 
-  return NO_ERROR;
-
-exit_on_error:
-
-  if (outer_spec)
-    {
-      qexec_close_scan (thread_p, outer_spec);
-    }
-  if (inner_spec)
-    {
-      qexec_close_scan (thread_p, inner_spec);
-    }
-
-  return ER_FAILED;
-}
-
-/*
- * Interpreter routines
- */
-
-/*
- * qexec_open_scan () -
- *   return: NO_ERROR, or ER_code
- *   curr_spec(in)      : Access Specification Node
- *   val_list(in)       : Value list pointer
- *   vd(in)     : Value descriptor
- *   force_select_lock(in)  :
- *   fixed(in)  : Fixed scan flag
- *   grouped(in)        : Grouped scan flag
- *   iscan_oid_order(in)       :
- *   s_id(out)   : Set to the scan identifier
- *   p_mvcc_select_lock_needed(out): true, whether instance lock needed at select
- *
- * Note: This routine is used to open a scan on an access specification
- * node. A scan identifier is created with the given parameters.
- */
-static int
-qexec_open_scan (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * curr_spec, VAL_LIST * val_list, VAL_DESCR * vd,
-		 bool force_select_lock, int fixed, int grouped, bool iscan_oid_order, SCAN_ID * s_id,
-		 QUERY_ID query_id, SCAN_OPERATION_TYPE scan_op_type, bool scan_immediately_stop,
-		 bool * p_mvcc_select_lock_needed)
-{
-  SCAN_TYPE scan_type;
-  INDX_INFO *indx_info;
-  QFILE_LIST_ID *list_id;
-  bool mvcc_select_lock_needed = false;
-  int error_code = NO_ERROR;
-
-  if (curr_spec->pruning_type == DB_PARTITIONED_CLASS && !curr_spec->pruned)
-    {
-      error_code = qexec_prune_spec (thread_p, curr_spec, vd, scan_op_type);
-      if (error_code != NO_ERROR)
-	{
-	  ASSERT_ERROR ();
-	  goto exit_on_error;
-	}
-    }
-
-  if (curr_spec->type == TARGET_CLASS && mvcc_is_mvcc_disabled_class (&ACCESS_SPEC_CLS_OID (curr_spec)))
-    {
-      assert (!force_select_lock);
-
-      /* We expect to update or delete a non MVCC objects via a scan are only db_serial, db_ha_apply_info and
-       * _db_collation objects. */
-      assert ((scan_op_type != S_DELETE && scan_op_type != S_UPDATE) || oid_is_serial (&ACCESS_SPEC_CLS_OID (curr_spec))
-	      || (oid_check_cached_class_oid (OID_CACHE_HA_APPLY_INFO_CLASS_ID, &ACCESS_SPEC_CLS_OID (curr_spec)))
-	      || (oid_check_cached_class_oid (OID_CACHE_COLLATION_CLASS_ID, &ACCESS_SPEC_CLS_OID (curr_spec))));
-    }
-  else
-    {
-      if (force_select_lock)
-	{
-	  mvcc_select_lock_needed = true;
-	}
-      else
-	{
-	  mvcc_select_lock_needed = (curr_spec->flags & ACCESS_SPEC_FLAG_FOR_UPDATE);
-	}
-    }
-
-  switch (curr_spec->type)
+  while (1)
     {
-    case TARGET_CLASS:
-      if (curr_spec->access == ACCESS_METHOD_SEQUENTIAL)
-	{
-	  /* open a sequential heap file scan */
-	  scan_type = S_HEAP_SCAN;
-	  indx_info = NULL;
-	}
-      else if (curr_spec->access == ACCESS_METHOD_SEQUENTIAL_RECORD_INFO)
-	{
-	  /* open a sequential heap file scan that reads record info */
-	  scan_type = S_HEAP_SCAN_RECORD_INFO;
-	  indx_info = NULL;
-	}
-      else if (curr_spec->access == ACCESS_METHOD_SEQUENTIAL_PAGE_SCAN)
-	{
-	  /* open a sequential heap file scan that reads page info */
-	  scan_type = S_HEAP_PAGE_SCAN;
-	  indx_info = NULL;
-	}
-      else if (curr_spec->access == ACCESS_METHOD_INDEX)
-	{
-	  /* open an indexed heap file scan */
-	  scan_type = S_INDX_SCAN;
-	  indx_info = curr_spec->indexptr;
-	}
-      else if (curr_spec->access == ACCESS_METHOD_INDEX_KEY_INFO)
-	{
-	  scan_type = S_INDX_KEY_INFO_SCAN;
-	  indx_info = curr_spec->indexptr;
-	}
-      else if (curr_spec->access == ACCESS_METHOD_INDEX_NODE_INFO)
-	{
-	  scan_type = S_INDX_NODE_INFO_SCAN;
-	  indx_info = curr_spec->indexptr;
-	}
-      else
-	{
-	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_XASLNODE, 0);
-	  return ER_QPROC_INVALID_XASLNODE;
-	}			/* if */
-
-      if (scan_type == S_HEAP_SCAN || scan_type == S_HEAP_SCAN_RECORD_INFO)
-	{
-	  error_code = scan_open_heap_scan (thread_p, s_id, mvcc_select_lock_needed, scan_op_type, fixed, grouped,
-					    curr_spec->single_fetch, curr_spec->s_dbval, val_list, vd,
-					    &ACCESS_SPEC_CLS_OID (curr_spec), &ACCESS_SPEC_HFID (curr_spec),
-					    curr_spec->s.cls_node.cls_regu_list_pred, curr_spec->where_pred,
-					    curr_spec->s.cls_node.cls_regu_list_rest,
-					    curr_spec->s.cls_node.num_attrs_pred,
-					    curr_spec->s.cls_node.attrids_pred, curr_spec->s.cls_node.cache_pred,
-					    curr_spec->s.cls_node.num_attrs_rest, curr_spec->s.cls_node.attrids_rest,
-					    curr_spec->s.cls_node.cache_rest, scan_type,
-					    curr_spec->s.cls_node.cache_reserved,
-					    curr_spec->s.cls_node.cls_regu_list_reserved);
-	  if (error_code != NO_ERROR)
-	    {
-	      ASSERT_ERROR ();
-	      goto exit_on_error;
-	    }
-	}
-      else if (scan_type == S_HEAP_PAGE_SCAN)
-	{
-	  error_code = scan_open_heap_page_scan (thread_p, s_id, val_list, vd, &ACCESS_SPEC_CLS_OID (curr_spec),
-						 &ACCESS_SPEC_HFID (curr_spec), curr_spec->where_pred, scan_type,
-						 curr_spec->s.cls_node.cache_reserved,
-						 curr_spec->s.cls_node.cls_regu_list_reserved);
-	  if (error_code != NO_ERROR)
-	    {
-	      ASSERT_ERROR ();
-	      goto exit_on_error;
-	    }
-	}
-      else if (scan_type == S_INDX_KEY_INFO_SCAN)
+      /* compare two tuple values, if they have not been compared yet */
+      if (!already_compared)
 	{
-	  error_code =
-	    scan_open_index_key_info_scan (thread_p, s_id, val_list, vd, indx_info, &ACCESS_SPEC_CLS_OID (curr_spec),
-					   &ACCESS_SPEC_HFID (curr_spec), curr_spec->where_pred,
-					   curr_spec->s.cls_node.cls_output_val_list, iscan_oid_order, query_id,
-					   curr_spec->s.cls_node.cache_reserved,
-					   curr_spec->s.cls_node.cls_regu_list_reserved);
-	  if (error_code != NO_ERROR)
-	    {
-	      ASSERT_ERROR ();
+	  val_cmp = qexec_cmp_tpl_vals_merge (outer_valp, outer_domp, inner_valp, inner_domp, nvals);
+	  if (val_cmp == DB_UNK)
+	    {			/* is error */
 	      goto exit_on_error;
 	    }
-	  /* monitor */
-	  perfmon_inc_stat (thread_p, PSTAT_QM_NUM_ISCANS);
 	}
-      else if (scan_type == S_INDX_NODE_INFO_SCAN)
+      already_compared = false;	/* re-init */
+
+      /* value of the outer is less than value of the inner */
+      if (val_cmp == DB_LT)
 	{
-	  error_code = scan_open_index_node_info_scan (thread_p, s_id, val_list, vd, indx_info, curr_spec->where_pred,
-						       curr_spec->s.cls_node.cache_reserved,
-						       curr_spec->s.cls_node.cls_regu_list_reserved);
-	  if (error_code != NO_ERROR)
+	  /* if the group is not yet formed */
+	  if (group_cnt == 0)
 	    {
-	      ASSERT_ERROR ();
-	      goto exit_on_error;
+	      /* depending on the join type, join with a NULL opposite row when it does not match */
+	      if (all_lefts)
+		{
+		  /* merge the fetched tuple(left) and NULL tuple(right) */
+		  QEXEC_MERGE_ADD_MERGETUPLE (thread_p, &outer_tplrec, NULL);
+		}
 	    }
-	  /* monitor */
-	  perfmon_inc_stat (thread_p, PSTAT_QM_NUM_ISCANS);
+
+	  /* move the outer(left) scan to the next tuple and position tuple values (to merge columns) */
+	  QEXEC_MERGE_OUTER_NEXT_SCAN_PVALS (thread_p, outer, true);
+	  direction = S_FORWARD;
+	  group_cnt = 0;
+
+	  continue;
 	}
-      else			/* S_INDX_SCAN */
+
+      /* value of the outer is greater than value of the inner */
+      if (val_cmp == DB_GT)
 	{
-	  error_code = scan_open_index_scan (thread_p, s_id, mvcc_select_lock_needed, scan_op_type, fixed, grouped,
-					     curr_spec->single_fetch, curr_spec->s_dbval, val_list, vd, indx_info,
-					     &ACCESS_SPEC_CLS_OID (curr_spec), &ACCESS_SPEC_HFID (curr_spec),
-					     curr_spec->s.cls_node.cls_regu_list_key, curr_spec->where_key,
-					     curr_spec->s.cls_node.cls_regu_list_pred, curr_spec->where_pred,
-					     curr_spec->s.cls_node.cls_regu_list_rest, curr_spec->where_range,
-					     curr_spec->s.cls_node.cls_regu_list_range,
-					     curr_spec->s.cls_node.cls_output_val_list,
-					     curr_spec->s.cls_node.cls_regu_val_list,
-					     curr_spec->s.cls_node.num_attrs_key, curr_spec->s.cls_node.attrids_key,
-					     curr_spec->s.cls_node.cache_key, curr_spec->s.cls_node.num_attrs_pred,
-					     curr_spec->s.cls_node.attrids_pred, curr_spec->s.cls_node.cache_pred,
-					     curr_spec->s.cls_node.num_attrs_rest, curr_spec->s.cls_node.attrids_rest,
-					     curr_spec->s.cls_node.cache_rest, curr_spec->s.cls_node.num_attrs_range,
-					     curr_spec->s.cls_node.attrids_range, curr_spec->s.cls_node.cache_range,
-					     iscan_oid_order, query_id);
-	  if (error_code != NO_ERROR)
+	  /* if the group is not yet formed */
+	  if (group_cnt == 0)
 	    {
-	      ASSERT_ERROR ();
-	      goto exit_on_error;
+	      /* depending on the join type, join with a NULL opposite row when a NULL is encountered, or skip it. */
+	      if (all_rghts)
+		{
+		  /* merge the fetched tuple(right) and NULL tuple(left) */
+		  QEXEC_MERGE_ADD_MERGETUPLE (thread_p, NULL, &inner_tplrec);
+		}
 	    }
-	  /* monitor */
-	  perfmon_inc_stat (thread_p, PSTAT_QM_NUM_ISCANS);
+
+	  /* move the inner(right) scan to the next tuple and position tuple values (to merge columns) */
+	  QEXEC_MERGE_OUTER_NEXT_SCAN_PVALS (thread_p, inner, true);
+	  direction = S_FORWARD;
+	  group_cnt = 0;
+
+	  continue;
 	}
-      break;
 
-    case TARGET_CLASS_ATTR:
-      error_code =
-	scan_open_class_attr_scan (thread_p, s_id, grouped, curr_spec->single_fetch, curr_spec->s_dbval, val_list, vd,
-				   &ACCESS_SPEC_CLS_OID (curr_spec), &ACCESS_SPEC_HFID (curr_spec),
-				   curr_spec->s.cls_node.cls_regu_list_pred, curr_spec->where_pred,
-				   curr_spec->s.cls_node.cls_regu_list_rest, curr_spec->s.cls_node.num_attrs_pred,
-				   curr_spec->s.cls_node.attrids_pred, curr_spec->s.cls_node.cache_pred,
-				   curr_spec->s.cls_node.num_attrs_rest, curr_spec->s.cls_node.attrids_rest,
-				   curr_spec->s.cls_node.cache_rest);
-      if (error_code != NO_ERROR)
-	{
-	  ASSERT_ERROR ();
+      if (val_cmp != DB_EQ)
+	{			/* error ? */
 	  goto exit_on_error;
 	}
-      break;
 
-    case TARGET_LIST:
-      /* open a list file scan */
-      if (ACCESS_SPEC_XASL_NODE (curr_spec) && ACCESS_SPEC_XASL_NODE (curr_spec)->spec_list == curr_spec)
-	{
-	  /* if XASL of access spec for list scan is itself then this is for HQ */
-	  list_id = ACCESS_SPEC_CONNECT_BY_LIST_ID (curr_spec);
-	}
-      else
-	{
-	  list_id = ACCESS_SPEC_LIST_ID (curr_spec);
-	}
-      error_code =
-	scan_open_list_scan (thread_p, s_id, grouped, curr_spec->single_fetch, curr_spec->s_dbval, val_list, vd,
-			     list_id, curr_spec->s.list_node.list_regu_list_pred,
-			     curr_spec->where_pred, curr_spec->s.list_node.list_regu_list_rest,
-			     curr_spec->s.list_node.list_regu_list_build, curr_spec->s.list_node.list_regu_list_probe,
-			     curr_spec->s.list_node.hash_list_scan_yn);
-      if (error_code != NO_ERROR)
+      /* values of the outer and inner are equal, do a scan group processing */
+      merge_cnt = 0;
+      if (direction == S_FORWARD)
 	{
-	  ASSERT_ERROR ();
-	  goto exit_on_error;
-	}
-      break;
+	  /* move forwards within a group */
+	  cnt = 0;
+	  /* group_cnt has the number of tuples in the group */
+	  while (1)
+	    {
+	      /* evaluate other outer join predicate */
+	      ev_res = V_UNKNOWN;
+	      if (other_outer_join_pred != NULL)
+		{
+		  ev_res = eval_pred (thread_p, other_outer_join_pred, &xasl_state->vd, NULL);
+		  if (ev_res == V_ERROR)
+		    {
+		      goto exit_on_error;
+		    }
+		}
 
-    case TARGET_SHOWSTMT:
-      /* open a showstmt scan */
-      error_code =
-	scan_open_showstmt_scan (thread_p, s_id, grouped, curr_spec->single_fetch, curr_spec->s_dbval, val_list, vd,
-				 curr_spec->where_pred, curr_spec->s.showstmt_node.show_type,
-				 curr_spec->s.showstmt_node.arg_list);
-      if (error_code != NO_ERROR)
-	{
-	  ASSERT_ERROR ();
-	  goto exit_on_error;
-	}
-      break;
+	      /* is qualified */
+	      if (other_outer_join_pred == NULL || ev_res == V_TRUE)
+		{
+		  /* merge the fetched tuples(left and right) */
+		  QEXEC_MERGE_ADD_MERGETUPLE (thread_p, &outer_tplrec, &inner_tplrec);
 
-    case TARGET_REGUVAL_LIST:
-      /* open a regu value list scan */
-      error_code =
-	scan_open_values_scan (thread_p, s_id, grouped, curr_spec->single_fetch, curr_spec->s_dbval, val_list, vd,
-			       ACCESS_SPEC_RLIST_VALPTR_LIST (curr_spec));
-      if (error_code != NO_ERROR)
-	{
-	  ASSERT_ERROR ();
-	  goto exit_on_error;
-	}
-      break;
+		  merge_cnt++;	/* increase the counter of merged tuples */
 
-    case TARGET_SET:
-      /* open a set based derived table scan */
-      error_code =
-	scan_open_set_scan (thread_p, s_id, grouped, curr_spec->single_fetch, curr_spec->s_dbval, val_list, vd,
-			    ACCESS_SPEC_SET_PTR (curr_spec), ACCESS_SPEC_SET_REGU_LIST (curr_spec),
-			    curr_spec->where_pred);
-      if (error_code != NO_ERROR)
-	{
-	  ASSERT_ERROR ();
-	  goto exit_on_error;
-	}
-      break;
+		  /* if scan works in a single_fetch mode and first qualified scan item has now been fetched, return
+		   * immediately. */
+		  if (merge_infop->single_fetch == QPROC_SINGLE_OUTER)
+		    {
+		      goto exit_on_end;
+		    }
+		}
 
-    case TARGET_JSON_TABLE:
-      /* open a json table based derived table scan */
-      error_code =
-	scan_open_json_table_scan (thread_p, s_id, grouped, curr_spec->single_fetch, curr_spec->s_dbval, val_list,
-				   vd, curr_spec->where_pred);
-      if (error_code != NO_ERROR)
-	{
-	  ASSERT_ERROR ();
-	  goto exit_on_error;
-	}
-      break;
+	      cnt++;		/* increase the counter of processed tuples */
 
-    case TARGET_METHOD:
-      error_code =
-	scan_open_method_scan (thread_p, s_id, grouped, curr_spec->single_fetch, curr_spec->s_dbval, val_list, vd,
-			       ACCESS_SPEC_METHOD_LIST_ID (curr_spec), ACCESS_SPEC_METHOD_SIG_LIST (curr_spec));
-      if (error_code != NO_ERROR)
-	{
-	  ASSERT_ERROR ();
-	  goto exit_on_error;
-	}
-      break;
+	      /* if the group is formed for the first time */
+	      if (group_cnt == 0)
+		{
+		  /* not qualified */
+		  if (!(other_outer_join_pred == NULL || ev_res == V_TRUE))
+		    {
+		      /* depending on the join type, join with a NULL opposite row when a NULL or a not-qualified is
+		       * encountered, or skip it. */
+		      if (all_rghts)
+			{
+			  /* merge the fetched tuple(right) and NULL tuple(left) */
+			  QEXEC_MERGE_ADD_MERGETUPLE (thread_p, NULL, &inner_tplrec);
+			}
+		    }
 
-    default:
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_XASLNODE, 0);
-      error_code = ER_QPROC_INVALID_XASLNODE;
-      goto exit_on_error;
-    }				/* switch */
+		  /* move the inner(right) scan to the next tuple and position tuple values (to merge columns) */
+		  QEXEC_MERGE_OUTER_NEXT_SCAN_PVALS (thread_p, inner, false	/* do not exit */
+		    );
+		  if (inner_scan == S_END)
+		    {
+		      if (merge_cnt == 0)
+			{	/* not merged */
+			  /* depending on the join type, join with a NULL opposite row when a NULL or a not-qualified
+			   * is encountered, or skip it. */
+			  if (all_lefts)
+			    {
+			      /* merge the fetched tuple(left) and NULL tuple(right) */
+			      QEXEC_MERGE_ADD_MERGETUPLE (thread_p, &outer_tplrec, NULL);
+			    }
+			}
+		      break;
+		    }
 
-  s_id->scan_immediately_stop = scan_immediately_stop;
+		  /* and compare */
+		  val_cmp = qexec_cmp_tpl_vals_merge (outer_valp, outer_domp, inner_valp, inner_domp, nvals);
+		  if (val_cmp != DB_EQ)
+		    {
+		      if (val_cmp == DB_UNK)
+			{	/* is error */
+			  goto exit_on_error;
+			}
 
-  if (p_mvcc_select_lock_needed)
-    {
-      *p_mvcc_select_lock_needed = mvcc_select_lock_needed;
-    }
+		      if (merge_cnt == 0)
+			{	/* not merged */
+			  /* depending on the join type, join with a NULL opposite row when a NULL or a not-qualified
+			   * is encountered, or skip it. */
+			  if (all_lefts)
+			    {
+			      /* merge the fetched tuple(left) and NULL tuple(right) */
+			      QEXEC_MERGE_ADD_MERGETUPLE (thread_p, &outer_tplrec, NULL);
+			    }
+			}
 
-  return NO_ERROR;
+		      break;	/* found the bottom of the group */
+		    }
+		}
+	      else
+		{		/* group_cnt > 0 */
+		  if (cnt >= group_cnt)
+		    {
+		      if (merge_cnt == 0)
+			{	/* not merged */
+			  /* depending on the join type, join with a NULL opposite row when a NULL or a not-qualified
+			   * is encountered, or skip it. */
+			  if (all_lefts)
+			    {
+			      /* merge the fetched tuple(left) and NULL tuple(right) */
+			      QEXEC_MERGE_ADD_MERGETUPLE (thread_p, &outer_tplrec, NULL);
+			    }
+			}
+		      break;	/* reached the bottom of the group */
+		    }
 
-exit_on_error:
+		  /* move the inner(right) scan to the next tuple */
+		  QEXEC_MERGE_OUTER_NEXT_SCAN (thread_p, inner, true);
+		}
+	    }			/* while (1) */
 
-  if (curr_spec->pruning_type == DB_PARTITIONED_CLASS && curr_spec->parts != NULL)
-    {
-      /* reset pruning info */
-      db_private_free (thread_p, curr_spec->parts);
-      curr_spec->parts = NULL;
-      curr_spec->curent = NULL;
-      curr_spec->pruned = false;
-    }
+	  /* move the outer to the next tuple and position tuple values */
+	  QEXEC_MERGE_OUTER_NEXT_SCAN_PVALS (thread_p, outer, true);
 
-  ASSERT_ERROR_AND_SET (error_code);
-  return error_code;
-}
+	  /* if the group is formed for the first time */
+	  if (group_cnt == 0)
+	    {
+	      /* save the position of inner scan; it is the bottom of the group */
+	      scan_save_scan_pos (inner_sid, &inner_scanpos);
 
-/*
- * qexec_close_scan () -
- *   return:
- *   curr_spec(in)      : Access Specification Node
- *
- * Note: This routine is used to close the access specification node scan.
- */
-static void
-qexec_close_scan (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * curr_spec)
-{
-  if (curr_spec == NULL)
-    {
-      return;
-    }
+	      if (inner_scan == S_END)
+		{
+		  /* move the inner to the previous tuple and position tuple values */
+		  QEXEC_MERGE_OUTER_PREV_SCAN_PVALS (thread_p, inner);
 
-  /* monitoring */
-  switch (curr_spec->type)
-    {
-    case TARGET_CLASS:
-      if (curr_spec->access == ACCESS_METHOD_SEQUENTIAL || curr_spec->access == ACCESS_METHOD_SEQUENTIAL_RECORD_INFO
-	  || curr_spec->access == ACCESS_METHOD_SEQUENTIAL_PAGE_SCAN)
-	{
-	  perfmon_inc_stat (thread_p, PSTAT_QM_NUM_SSCANS);
-	}
-      else if (IS_ANY_INDEX_ACCESS (curr_spec->access))
-	{
-	  perfmon_inc_stat (thread_p, PSTAT_QM_NUM_ISCANS);
-	}
+		  /* set group count and direction */
+		  group_cnt = cnt;
+		  direction = S_BACKWARD;
+		}
+	      else
+		{
+		  /* and compare */
+		  val_cmp = qexec_cmp_tpl_vals_merge (outer_valp, outer_domp, inner_valp, inner_domp, nvals);
+		  if (val_cmp == DB_UNK)
+		    {		/* is error */
+		      goto exit_on_error;
+		    }
 
-      if (curr_spec->parts != NULL)
-	{
-	  /* reset pruning info */
-	  db_private_free (thread_p, curr_spec->parts);
-	  curr_spec->parts = NULL;
-	  curr_spec->curent = NULL;
-	  curr_spec->pruned = false;
-	}
-      break;
+		  if (val_cmp == DB_LT)
+		    {
+		      /* move the inner to the previous tuple and position tuple values */
+		      QEXEC_MERGE_OUTER_PREV_SCAN_PVALS (thread_p, inner);
 
-    case TARGET_CLASS_ATTR:
-      break;
+		      /* and compare */
+		      val_cmp = qexec_cmp_tpl_vals_merge (outer_valp, outer_domp, inner_valp, inner_domp, nvals);
+		      if (val_cmp == DB_UNK)
+			{	/* is error */
+			  goto exit_on_error;
+			}
 
-    case TARGET_LIST:
-      perfmon_inc_stat (thread_p, PSTAT_QM_NUM_LSCANS);
-      break;
+		      if (val_cmp == DB_EQ)
+			{
+			  /* next value is the same, so prepare for further group scan operations */
 
-    case TARGET_SHOWSTMT:
-      /* do nothing */
-      break;
+			  /* set group count and direction */
+			  group_cnt = cnt;
+			  direction = S_BACKWARD;
+			}
+		      else
+			{
+			  /* move the inner to the current tuple and position tuple values */
+			  QEXEC_MERGE_OUTER_NEXT_SCAN_PVALS (thread_p, inner, true);
 
-    case TARGET_REGUVAL_LIST:
-      /* currently do nothing */
-      break;
+			  val_cmp = DB_LT;	/* restore comparison */
+			}
+		    }
 
-    case TARGET_SET:
-      perfmon_inc_stat (thread_p, PSTAT_QM_NUM_SETSCANS);
-      break;
+		  /* comparison has already been done */
+		  already_compared = true;
+		}
+	    }
+	  else
+	    {
+	      /* set further scan direction */
+	      direction = S_BACKWARD;
+	    }
+	}
+      else
+	{			/* (direction == S_BACKWARD) */
+	  /* move backwards within a group */
+	  cnt = group_cnt;
+	  /* group_cnt has the number of tuples in the group */
+	  while (1)
+	    {
+	      /* evaluate other outer join predicate */
+	      ev_res = V_UNKNOWN;
+	      if (other_outer_join_pred != NULL)
+		{
+		  ev_res = eval_pred (thread_p, other_outer_join_pred, &xasl_state->vd, NULL);
+		  if (ev_res == V_ERROR)
+		    {
+		      goto exit_on_error;
+		    }
+		}
 
-    case TARGET_JSON_TABLE:
-      /* currently do nothing
-         todo: check if here need to add something
-       */
-      break;
+	      /* is qualified */
+	      if (other_outer_join_pred == NULL || ev_res == V_TRUE)
+		{
+		  /* merge the fetched tuples(left and right) */
+		  QEXEC_MERGE_ADD_MERGETUPLE (thread_p, &outer_tplrec, &inner_tplrec);
 
-    case TARGET_METHOD:
-      perfmon_inc_stat (thread_p, PSTAT_QM_NUM_METHSCANS);
-      break;
-    }
+		  merge_cnt++;	/* increase the counter of merged tuples */
+		}
 
-  scan_close_scan (thread_p, &curr_spec->s_id);
-}
+	      cnt--;		/* decrease the counter of the processed tuples */
 
-/*
- * qexec_end_scan () -
- *   return:
- *   curr_spec(in)      : Access Specification Node
- *
- * Note: This routine is used to end the access specification node scan.
- *
- * Note: This routine is called for ERROR CASE scan end operation.
- */
-static void
-qexec_end_scan (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * curr_spec)
-{
-  if (curr_spec)
-    {
-      scan_end_scan (thread_p, &curr_spec->s_id);
-    }
-}
+	      if (cnt <= 0)
+		{
+		  if (merge_cnt == 0)
+		    {		/* not merged */
+		      /* depending on the join type, join with a NULL opposite row when a NULL or a not-qualified is
+		       * encountered, or skip it. */
+		      if (all_lefts)
+			{
+			  /* merge the fetched tuple(left) and NULL tuple(right) */
+			  QEXEC_MERGE_ADD_MERGETUPLE (thread_p, &outer_tplrec, NULL);
+			}
+		    }
+		  break;	/* finish the group */
+		}
 
-/*
- * qexec_next_merge_block () -
- *   return:
- *   spec(in)   :
- */
-static SCAN_CODE
-qexec_next_merge_block (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE ** spec)
-{
-  SCAN_CODE sb_scan;
+	      /* if not yet reached the top of the group */
+	      /* move the inner(right) scan to the previous tuple */
+	      QEXEC_MERGE_OUTER_PREV_SCAN (thread_p, inner);
 
-  if (scan_start_scan (thread_p, &(*spec)->s_id) != NO_ERROR)
-    {
-      return S_ERROR;
-    }
+	      /* all of the inner tuples in the group have the same value at the merge column, so we don't need to
+	       * compare with the value of the outer one; just count the number of the tuples in the group */
+	    }			/* while (1) */
 
-  do
-    {
-      sb_scan = scan_next_scan_block (thread_p, &(*spec)->s_id);
-      if (sb_scan == S_SUCCESS)
-	{
-	  return S_SUCCESS;
-	}
-      else if (sb_scan == S_END)
-	{
-	  /* close old scan */
-	  scan_end_scan (thread_p, &(*spec)->s_id);
+	  /* position tuple values (to merge columns) */
+	  QEXEC_MERGE_PVALS (inner);
 
-	  /* move to the following access specifications left */
-	  *spec = (*spec)->next;
+	  /* move the outer(left) scan to the next tuple and position tuple values */
+	  QEXEC_MERGE_OUTER_NEXT_SCAN_PVALS (thread_p, outer, true);
 
-	  /* check for and skip the case of empty heap files */
-	  while (*spec != NULL && QEXEC_EMPTY_ACCESS_SPEC_SCAN (*spec))
-	    {
-	      *spec = (*spec)->next;
+	  /* and compare */
+	  val_cmp = qexec_cmp_tpl_vals_merge (outer_valp, outer_domp, inner_valp, inner_domp, nvals);
+	  if (val_cmp == DB_UNK)
+	    {			/* is error */
+	      goto exit_on_error;
 	    }
 
-	  if (*spec == NULL)
+	  if (val_cmp != DB_EQ)
 	    {
-	      return S_END;
-	    }
+	      /* jump to the previously set scan position */
+	      inner_scan = scan_jump_scan_pos (thread_p, inner_sid, &inner_scanpos);
+	      /* is saved position the end of scan? */
+	      if (inner_scan == S_END)
+		{
+		  goto exit_on_end;	/* inner(right) is exhausted */
+		}
 
-	  /* initialize scan */
-	  if (scan_start_scan (thread_p, &(*spec)->s_id) != NO_ERROR)
+	      /* and position tuple values */
+	      QEXEC_MERGE_PVALS (inner);
+
+	      /* reset group count */
+	      group_cnt = 0;
+	    }
+	  else
 	    {
-	      return S_ERROR;
+	      /* comparison has already been done */
+	      already_compared = true;
 	    }
-	}
-      else
-	{
-	  return S_ERROR;
-	}
 
-    }
-  while (1);
-}
+	  /* set further scan direction */
+	  direction = S_FORWARD;
 
-/*
- * qexec_next_scan_block () -
- *   return: SCAN_CODE (S_SUCCESS, S_END, S_ERROR)
- *   xasl(in)   : XASL Tree pointer
- *
- * Note: This function is used to move the current access specification
- * node scan identifier for the given XASL block to the next
- * scan block. If there are no more scan blocks for the current
- * access specfication node, it moves to the next access
- * specification, if any, and starts the new scan block for that
- * node. If there are no more access specification nodes left,
- * it returns S_END.
- */
-static SCAN_CODE
-qexec_next_scan_block (THREAD_ENTRY * thread_p, XASL_NODE * xasl)
-{
-  SCAN_CODE sb_scan;
-  OID *class_oid;
-  HFID *class_hfid;
+	}			/* (direction == S_BACKWARD) */
 
-  if (xasl->curr_spec == NULL)
-    {
-      /* initialize scan id */
-      xasl->curr_spec = xasl->spec_list;
+    }				/* while (1) */
 
-      /* check for and skip the case of empty heap file cases */
-      while (xasl->curr_spec != NULL && QEXEC_EMPTY_ACCESS_SPEC_SCAN (xasl->curr_spec))
+exit_on_end:
+  /* inner(right) is at the end. is there more to the outer(left) ? */
+  if (all_lefts)
+    {
+      while (outer_scan != S_END)
 	{
-	  xasl->curr_spec = xasl->curr_spec->next;
+	  /* merge the fetched tuple(left) and NULL tuple(right) */
+	  QEXEC_MERGE_ADD_MERGETUPLE (thread_p, &outer_tplrec, NULL);
+
+	  /* move the outer to the next tuple */
+	  QEXEC_MERGE_OUTER_NEXT_SCAN (thread_p, outer, false /* do not exit */ );
 	}
+    }				/* if (all_lefts) */
 
-      if (xasl->curr_spec == NULL)
+  /* outer(left) is at the end. is there more to the inner(right) ? */
+  if (all_rghts)
+    {
+      if (direction == S_FORWARD)
 	{
-	  return S_END;
-	}
+	  if (val_cmp == DB_NE)
+	    {			/* mark as not yet compared */
+	      val_cmp = DB_UNK;	/* clear */
 
-      assert (xasl->curr_spec != NULL);
+	      /* move the inner(right) scan to the first tuple and position tuple values (to merge columns) */
+	      QEXEC_MERGE_OUTER_NEXT_SCAN_PVALS (thread_p, inner, true);
+	    }
+	  else if (val_cmp == DB_EQ)
+	    {			/* outer scan END */
+	      val_cmp = DB_UNK;	/* clear */
 
-      /* initialize scan */
-      if ((xasl->curr_spec->type == TARGET_CLASS || xasl->curr_spec->type == TARGET_CLASS_ATTR)
-	  && xasl->curr_spec->parts != NULL && xasl->curr_spec->curent == NULL
-	  && xasl->curr_spec->access != ACCESS_METHOD_INDEX_NODE_INFO)
-	{
-	  /* initialize the scan_id for partitioned classes */
-	  if (xasl->curr_spec->access == ACCESS_METHOD_SEQUENTIAL
-	      || xasl->curr_spec->access == ACCESS_METHOD_SEQUENTIAL_RECORD_INFO)
-	    {
-	      class_oid = &xasl->curr_spec->s_id.s.hsid.cls_oid;
-	      class_hfid = &xasl->curr_spec->s_id.s.hsid.hfid;
-	    }
-	  else if (xasl->curr_spec->access == ACCESS_METHOD_SEQUENTIAL_PAGE_SCAN)
-	    {
-	      class_oid = &xasl->curr_spec->s_id.s.hpsid.cls_oid;
-	      class_hfid = &xasl->curr_spec->s_id.s.hpsid.hfid;
-	    }
-	  else if (xasl->curr_spec->access == ACCESS_METHOD_INDEX
-		   || xasl->curr_spec->access == ACCESS_METHOD_INDEX_KEY_INFO)
-	    {
-	      class_oid = &xasl->curr_spec->s_id.s.isid.cls_oid;
-	      class_hfid = &xasl->curr_spec->s_id.s.isid.hfid;
-	    }
-	  else
-	    {
-	      assert (false);
-	      return S_ERROR;
+	      /* move the inner(right) scan to the next tuple and position tuple values */
+	      QEXEC_MERGE_OUTER_NEXT_SCAN_PVALS (thread_p, inner, true);
 	    }
-
-	  COPY_OID (class_oid, &ACCESS_SPEC_CLS_OID (xasl->curr_spec));
-	  HFID_COPY (class_hfid, &ACCESS_SPEC_HFID (xasl->curr_spec));
 	}
-
-      if (scan_start_scan (thread_p, &xasl->curr_spec->s_id) != NO_ERROR)
+      else
+	{			/* direction == S_BACKWARD */
+	  inner_scan = scan_jump_scan_pos (thread_p, inner_sid, &inner_scanpos);
+	}
+      while (inner_scan != S_END)
 	{
-	  return S_ERROR;
+	  /* merge the fetched tuple(right) and NULL tuple(left) */
+	  QEXEC_MERGE_ADD_MERGETUPLE (thread_p, NULL, &inner_tplrec);
+
+	  /* move the inner to the next tuple */
+	  QEXEC_MERGE_OUTER_NEXT_SCAN (thread_p, inner, false /* do not exit */ );
 	}
-    }
+    }				/* if (all_rghts) */
 
-  do
+  free_and_init (type_list.domp);
+  scan_end_scan (thread_p, outer_sid);
+  scan_end_scan (thread_p, inner_sid);
+  outer_sid->s.llsid.tplrecp = NULL;
+  inner_sid->s.llsid.tplrecp = NULL;
+
+  if (tplrec.tpl)
     {
-      sb_scan = scan_next_scan_block (thread_p, &xasl->curr_spec->s_id);
-      if (sb_scan == S_SUCCESS)
-	{
-	  return S_SUCCESS;
-	}
-      else if (sb_scan == S_END)
-	{
-	  /* if curr_spec is a partitioned class, do not move to the next spec unless we went through all partitions */
-	  SCAN_CODE s_parts = qexec_init_next_partition (thread_p, xasl->curr_spec);
-	  if (s_parts == S_SUCCESS)
-	    {
-	      /* successfully moved to the next partition */
-	      continue;
-	    }
-	  else if (s_parts == S_ERROR)
-	    {
-	      return S_ERROR;
-	    }
+      db_private_free_and_init (thread_p, tplrec.tpl);
+    }
 
-	  /* close old scan */
-	  scan_end_scan (thread_p, &xasl->curr_spec->s_id);
+  if (outer_domp)
+    {
+      db_private_free_and_init (thread_p, outer_domp);
+    }
+  if (outer_valp)
+    {
+      db_private_free_and_init (thread_p, outer_valp);
+    }
 
-	  /* move to the following access specifications left */
-	  xasl->curr_spec = xasl->curr_spec->next;
+  if (inner_domp)
+    {
+      db_private_free_and_init (thread_p, inner_domp);
+    }
+  if (inner_valp)
+    {
+      db_private_free_and_init (thread_p, inner_valp);
+    }
 
-	  /* check for and skip the case of empty heap files */
-	  while (xasl->curr_spec != NULL && QEXEC_EMPTY_ACCESS_SPEC_SCAN (xasl->curr_spec))
-	    {
-	      xasl->curr_spec = xasl->curr_spec->next;
-	    }
+  if (list_idp)
+    {
+      qfile_close_list (thread_p, list_idp);
+    }
 
-	  if (xasl->curr_spec == NULL)
-	    {
-	      return S_END;
-	    }
+  return list_idp;
 
-	  /* initialize scan */
-	  if (scan_start_scan (thread_p, &xasl->curr_spec->s_id) != NO_ERROR)
-	    {
-	      return S_ERROR;
-	    }
-	}
-      else
-	{
-	  return S_ERROR;
-	}
+exit_on_error:
+  if (list_idp)
+    {
+      qfile_close_list (thread_p, list_idp);
+      QFILE_FREE_AND_INIT_LIST_ID (list_idp);
     }
-  while (1);
 
+  list_idp = NULL;
+
+  direction = S_FORWARD;
+  val_cmp = DB_UNK;		/* mark as error */
+  all_lefts = all_rghts = false;
+
+  goto exit_on_end;
 }
 
 /*
- * qexec_next_scan_block_iterations () -
- *   return: SCAN_CODE (S_SUCCESS, S_END, S_ERROR)
+ * qexec_merge_listfiles () -
+ *   return: NO_ERROR, or ER_code
  *   xasl(in)   : XASL Tree pointer
+ *   xasl_state(in)     :
+ *
+ * Note: This function is used for a direct merge of two LIST files
+ * during XASL tree interpretation.
  *
+ * Note: For a direct list file merge, currently the outer and inner columns
+ * should have the same data type.
  */
-static SCAN_CODE
-qexec_next_scan_block_iterations (THREAD_ENTRY * thread_p, XASL_NODE * xasl)
+static int
+qexec_merge_listfiles (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state)
 {
-  SCAN_CODE sb_next;
-  SCAN_CODE xs_scan;
-  SCAN_CODE xs_scan2;
-  XASL_NODE *last_xptr;
-  XASL_NODE *prev_xptr;
-  XASL_NODE *xptr2, *xptr3;
+  QFILE_LIST_ID *list_id = NULL;
+  ACCESS_SPEC_TYPE *outer_spec = NULL;	/* left */
+  ACCESS_SPEC_TYPE *inner_spec = NULL;	/* right */
+  QFILE_LIST_MERGE_INFO *merge_infop = &(xasl->proc.mergelist.ls_merge);
+  XASL_NODE *outer_xasl, *inner_xasl;
+  int ls_flag = 0;
 
-  /* first find the last scan block to be moved */
-  for (last_xptr = xasl; last_xptr->scan_ptr; last_xptr = last_xptr->scan_ptr)
-    {
-      if (!last_xptr->next_scan_block_on
-	  || (last_xptr->curr_spec && last_xptr->curr_spec->s_id.status == S_STARTED
-	      && !last_xptr->curr_spec->s_id.qualified_block))
-	{
-	  break;
-	}
-    }
+  outer_xasl = xasl->proc.mergelist.outer_xasl;
+  inner_xasl = xasl->proc.mergelist.inner_xasl;
 
-  /* move the last scan block and reset further scans */
+  /* open the empty list file if not already open */
 
-  /* if there are no qualified items in the current scan block, this scan block will make no contribution with other
-   * possible scan block combinations from following classes. Thus, directly move to the next scan block in this class. */
-  if (last_xptr->curr_spec && last_xptr->curr_spec->s_id.status == S_STARTED
-      && !last_xptr->curr_spec->s_id.qualified_block)
+  if (outer_xasl->list_id->type_list.type_cnt == 0)
     {
-      if ((xs_scan = qexec_next_scan_block (thread_p, last_xptr)) == S_END)
-	{
-	  /* close following scan procedures if they are still active */
-	  for (xptr2 = last_xptr; xptr2; xptr2 = xptr2->scan_ptr)
-	    {
-	      if (xptr2->scan_ptr && xptr2->next_scan_block_on)
-		{
-		  if (xptr2->scan_ptr->curr_spec)
-		    {
-		      scan_end_scan (thread_p, &xptr2->scan_ptr->curr_spec->s_id);
-		    }
-		  xptr2->scan_ptr->curr_spec->curent = NULL;
-		  xptr2->scan_ptr->curr_spec = NULL;
-		  xptr2->next_scan_block_on = false;
-		}
-	    }
-	}
-      else if (xs_scan == S_ERROR)
+      /* start main block iterations */
+      if (qexec_start_mainblock_iterations (thread_p, outer_xasl, xasl_state) != NO_ERROR)
 	{
-	  return S_ERROR;
+	  GOTO_EXIT_ON_ERROR;
 	}
     }
-  else if ((xs_scan = qexec_next_scan_block (thread_p, last_xptr)) == S_SUCCESS)
-    {				/* reset all the futher scans */
-      for (xptr2 = last_xptr; xptr2; xptr2 = xptr2->scan_ptr)
+  if (inner_xasl->list_id->type_list.type_cnt == 0)
+    {
+      /* start main block iterations */
+      if (qexec_start_mainblock_iterations (thread_p, inner_xasl, xasl_state) != NO_ERROR)
 	{
-	  if (xptr2->scan_ptr)
-	    {
-	      sb_next = qexec_next_scan_block (thread_p, xptr2->scan_ptr);
-	      if (sb_next == S_SUCCESS)
-		{
-		  xptr2->next_scan_block_on = true;
-		}
-	      else if (sb_next == S_END)
-		{
-		  /* close all preceding scan procedures and return */
-		  for (xptr3 = xasl; xptr3 && xptr3 != xptr2->scan_ptr; xptr3 = xptr3->scan_ptr)
-		    {
-		      if (xptr3->curr_spec)
-			{
-			  scan_end_scan (thread_p, &xptr3->curr_spec->s_id);
-			}
-		      xptr3->curr_spec->curent = NULL;
-		      xptr3->curr_spec = NULL;
-		      xptr3->next_scan_block_on = false;
-		    }
-		  return S_END;
-		}
-	      else
-		{
-		  return S_ERROR;
-		}
-	    }
+	  GOTO_EXIT_ON_ERROR;
 	}
     }
-  else if (xs_scan == S_ERROR)
+
+  /* If MERGELIST_PROC does not have 'order by' (xasl->orderby_list), then the list file to be open at here will be the
+   * last one. Otherwise, the last list file will be open at qexec_orderby_distinct(). (Note that only one that can
+   * have 'group by' is BUILDLIST_PROC type.) And, the top most XASL is the other condition for the list file to be the
+   * last result file. */
+
+  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_ALL);
+  if (XASL_IS_FLAGED (xasl, XASL_TOP_MOST_XASL) && XASL_IS_FLAGED (xasl, XASL_TO_BE_CACHED)
+      && (xasl->orderby_list == NULL || XASL_IS_FLAGED (xasl, XASL_SKIP_ORDERBY_LIST)) && xasl->option != Q_DISTINCT)
     {
-      return S_ERROR;
+      QFILE_SET_FLAG (ls_flag, QFILE_FLAG_RESULT_FILE);
     }
 
-  /* now move backwards, resetting all the previous scans */
-  while (last_xptr != xasl)
+  if (merge_infop->join_method == QFILE_JOIN_METHOD_HASH)
+    {
+      /* call list file hash join routine; the planner only makes hash joins for inner joins */
+      list_id = qexec_hash_join_list (thread_p, outer_xasl->list_id, inner_xasl->list_id, merge_infop, ls_flag);
+    }
+  else if (merge_infop->join_type == JOIN_INNER)
     {
+      /* call list file merge routine */
+      list_id = qexec_merge_list (thread_p, outer_xasl->list_id, inner_xasl->list_id, merge_infop, ls_flag);
+    }
+  else
+    {
+      outer_spec = xasl->proc.mergelist.outer_spec_list;
+      inner_spec = xasl->proc.mergelist.inner_spec_list;
 
-      /* find the previous to last xptr */
-      for (prev_xptr = xasl; prev_xptr->scan_ptr != last_xptr; prev_xptr = prev_xptr->scan_ptr)
-	;
-
-      /* set previous scan according to the last scan status */
-      if (last_xptr->curr_spec == NULL)
-	{			/* last scan ended */
-	  prev_xptr->next_scan_block_on = false;
-
-	  /* move the scan block of the previous scan */
-	  xs_scan2 = qexec_next_scan_block (thread_p, prev_xptr);
-	  if (xs_scan2 == S_SUCCESS)
-	    {
-	      /* move all the further scan blocks */
-	      for (xptr2 = prev_xptr; xptr2; xptr2 = xptr2->scan_ptr)
-		{
-		  if (xptr2->scan_ptr)
-		    {
-		      sb_next = qexec_next_scan_block (thread_p, xptr2->scan_ptr);
-		      if (sb_next == S_SUCCESS)
-			{
-			  xptr2->next_scan_block_on = true;
-			}
-		      else if (sb_next == S_END)
-			{
-			  /* close all preceding scan procedures and return */
-			  for (xptr3 = xasl; xptr3 && xptr3 != xptr2->scan_ptr; xptr3 = xptr3->scan_ptr)
-			    {
-			      if (xptr3->curr_spec)
-				{
-				  scan_end_scan (thread_p, &xptr3->curr_spec->s_id);
-				}
-			      xptr3->curr_spec->curent = NULL;
-			      xptr3->curr_spec = NULL;
-			      xptr3->next_scan_block_on = false;
-			    }
-			  return S_END;
-			}
-		      else
-			{
-			  return S_ERROR;
-			}
-		    }
-		}
-	    }
-	  else if (xs_scan2 == S_ERROR)
-	    {
-	      return S_ERROR;
-	    }
-
+      assert (xasl->scan_op_type == S_SELECT);
+      if (qexec_open_scan (thread_p, outer_spec, xasl->proc.mergelist.outer_val_list, &xasl_state->vd, false,
+			   outer_spec->fixed_scan, outer_spec->grouped_scan, true, &outer_spec->s_id,
+			   xasl_state->query_id, S_SELECT, false, NULL) != NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
 	}
-      else			/* last scan successfully moved */
+
+      if (qexec_open_scan (thread_p, inner_spec, xasl->proc.mergelist.inner_val_list, &xasl_state->vd, false,
+			   inner_spec->fixed_scan, inner_spec->grouped_scan, true, &inner_spec->s_id,
+			   xasl_state->query_id, S_SELECT, false, NULL) != NO_ERROR)
 	{
-	  if (scan_reset_scan_block (thread_p, &prev_xptr->curr_spec->s_id) == S_ERROR)
-	    {
-	      return S_ERROR;
-	    }
+	  GOTO_EXIT_ON_ERROR;
 	}
 
-      /* make previous scan the last scan ptr */
-      last_xptr = prev_xptr;
-    }				/* while */
+      /* call outer join merge routine */
+      list_id =
+	qexec_merge_list_outer (thread_p, &outer_spec->s_id, &inner_spec->s_id, merge_infop, xasl->after_join_pred,
+				xasl_state, ls_flag);
 
-  /* return the status of the first XASL block */
-  return (xasl->curr_spec) ? S_SUCCESS : S_END;
+      qexec_close_scan (thread_p, outer_spec);
+      outer_spec = NULL;
+
+      qexec_close_scan (thread_p, inner_spec);
+      inner_spec = NULL;
+    }
+
+  if (list_id == NULL)
+    {
+      GOTO_EXIT_ON_ERROR;
+    }
+
+  /* make this the resultant list file */
+  qfile_copy_list_id (xasl->list_id, list_id, true);
+  QFILE_FREE_AND_INIT_LIST_ID (list_id);
+
+  return NO_ERROR;
+
+exit_on_error:
+
+  if (outer_spec)
+    {
+      qexec_close_scan (thread_p, outer_spec);
+    }
+  if (inner_spec)
+    {
+      qexec_close_scan (thread_p, inner_spec);
+    }
+
+  return ER_FAILED;
 }
 
 /*
- * qexec_execute_scan () -
- *   return: SCAN_CODE (S_SUCCESS, S_END, S_ERROR)
- *   xasl(in)   : XASL Tree block
- *   xasl_state(in)     : XASL tree state information
- *   next_scan_fnc(in)  : Function to interpret following scan block
- *
- * Note: This routine executes one iteration on a scan operation on
- * the given XASL tree block. If end_of_scan is reached, it
- * return S_END. If an error occurs, it returns
- * S_ERROR. Each scan procedure block may have its own scan
- * procedures forming a path of scan procedure blocks. Thus, for
- * each scan procedure block interpretation, if there are already
- * active scan procedures started from that block, first their
- * execution is requested. Only if all of the following scan
- * procedures come to an end returning S_END, then the
- * current scan procedure scan item is advanced. When this scan
- * procedure too come to an end, it returns S_END to the
- * caller, indicating that there are no more scan items in the
- * path of the scan procedure blocks.
+ * Interpreter routines
+ */
+
+/*
+ * qexec_open_scan () -
+ *   return: NO_ERROR, or ER_code
+ *   curr_spec(in)      : Access Specification Node
+ *   val_list(in)       : Value list pointer
+ *   vd(in)     : Value descriptor
+ *   force_select_lock(in)  :
+ *   fixed(in)  : Fixed scan flag
+ *   grouped(in)        : Grouped scan flag
+ *   iscan_oid_order(in)       :
+ *   s_id(out)   : Set to the scan identifier
+ *   p_mvcc_select_lock_needed(out): true, whether instance lock needed at select
  *
- * Note: This function is the general scan block interpretation function.
+ * Note: This routine is used to open a scan on an access specification
+ * node. A scan identifier is created with the given parameters.
  */
-static SCAN_CODE
-qexec_execute_scan (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state, QFILE_TUPLE_RECORD * ignore,
-		    XASL_SCAN_FNC_PTR next_scan_fnc)
+static int
+qexec_open_scan (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * curr_spec, VAL_LIST * val_list, VAL_DESCR * vd,
+		 bool force_select_lock, int fixed, int grouped, bool iscan_oid_order, SCAN_ID * s_id,
+		 QUERY_ID query_id, SCAN_OPERATION_TYPE scan_op_type, bool scan_immediately_stop,
+		 bool * p_mvcc_select_lock_needed)
 {
-  XASL_NODE *xptr;
-  SCAN_CODE sc_scan;
-  SCAN_CODE xs_scan;
-  DB_LOGICAL ev_res;
-  int qualified;
-  SCAN_OPERATION_TYPE scan_operation_type;
+  SCAN_TYPE scan_type;
+  INDX_INFO *indx_info;
+  QFILE_LIST_ID *list_id;
+  bool mvcc_select_lock_needed = false;
+  int error_code = NO_ERROR;
 
-  /* check if further scan procedure are still active */
-  if (xasl->scan_ptr && xasl->next_scan_on)
+  if (curr_spec->pruning_type == DB_PARTITIONED_CLASS && !curr_spec->pruned)
     {
-      xs_scan = (*next_scan_fnc) (thread_p, xasl->scan_ptr, xasl_state, ignore, next_scan_fnc + 1);
-      if (xs_scan != S_END)
+      error_code = qexec_prune_spec (thread_p, curr_spec, vd, scan_op_type);
+      if (error_code != NO_ERROR)
 	{
-	  return xs_scan;
+	  ASSERT_ERROR ();
+	  goto exit_on_error;
 	}
-
-      xasl->next_scan_on = false;
     }
 
-  do
+  if (curr_spec->type == TARGET_CLASS && mvcc_is_mvcc_disabled_class (&ACCESS_SPEC_CLS_OID (curr_spec)))
     {
-      sc_scan = scan_next_scan (thread_p, &xasl->curr_spec->s_id);
-      if (sc_scan != S_SUCCESS)
+      assert (!force_select_lock);
+
+      /* We expect to update or delete a non MVCC objects via a scan are only db_serial, db_ha_apply_info and
+       * _db_collation objects. */
+      assert ((scan_op_type != S_DELETE && scan_op_type != S_UPDATE) || oid_is_serial (&ACCESS_SPEC_CLS_OID (curr_spec))
+	      || (oid_check_cached_class_oid (OID_CACHE_HA_APPLY_INFO_CLASS_ID, &ACCESS_SPEC_CLS_OID (curr_spec)))
+	      || (oid_check_cached_class_oid (OID_CACHE_COLLATION_CLASS_ID, &ACCESS_SPEC_CLS_OID (curr_spec))));
+    }
+  else
+    {
+      if (force_select_lock)
 	{
-	  return sc_scan;
+	  mvcc_select_lock_needed = true;
 	}
-
-      /* set scan item as qualified */
-      qualified = true;
-
-      if (qualified)
+      else
 	{
-	  /* clear bptr subquery list files */
-	  if (xasl->bptr_list)
-	    {
-	      qexec_clear_head_lists (thread_p, xasl->bptr_list);
-	      if (xasl->curr_spec->flags & ACCESS_SPEC_FLAG_FOR_UPDATE)
-		{
-		  scan_operation_type = S_UPDATE;
-		}
-	      else
-		{
-		  scan_operation_type = S_SELECT;
-		}
-	    }
-	  /* evaluate bptr list */
-	  for (xptr = xasl->bptr_list; qualified && xptr != NULL; xptr = xptr->next)
-	    {
-	      if (qexec_execute_obj_fetch (thread_p, xptr, xasl_state, scan_operation_type) != NO_ERROR)
-		{
-		  return S_ERROR;
-		}
-	      else if (xptr->proc.fetch.fetch_res == false)
-		{
-		  qualified = false;
-		}
-	    }
-	}			/* if (qualified) */
+	  mvcc_select_lock_needed = (curr_spec->flags & ACCESS_SPEC_FLAG_FOR_UPDATE);
+	}
+    }
 
-      if (qualified)
+  switch (curr_spec->type)
+    {
+    case TARGET_CLASS:
+      if (curr_spec->access == ACCESS_METHOD_SEQUENTIAL)
 	{
-	  /* evaluate dptr list */
-	  for (xptr = xasl->dptr_list; xptr != NULL; xptr = xptr->next)
-	    {
-	      /* clear correlated subquery list files */
-	      qexec_clear_head_lists (thread_p, xptr);
-	      if (XASL_IS_FLAGED (xptr, XASL_LINK_TO_REGU_VARIABLE))
-		{
-		  /* skip if linked to regu var */
-		  continue;
-		}
-	      if (qexec_execute_mainblock (thread_p, xptr, xasl_state, NULL) != NO_ERROR)
-		{
-		  return S_ERROR;
-		}
-	    }
-	}			/* if (qualified) */
-
-      if (qualified)
+	  /* open a sequential heap file scan */
+	  scan_type = S_HEAP_SCAN;
+	  indx_info = NULL;
+	}
+      else if (curr_spec->access == ACCESS_METHOD_SEQUENTIAL_RECORD_INFO)
 	{
-	  /* evaluate after join predicate */
-	  ev_res = V_UNKNOWN;
-	  if (xasl->after_join_pred != NULL)
-	    {
-	      ev_res = eval_pred (thread_p, xasl->after_join_pred, &xasl_state->vd, NULL);
-	      if (ev_res == V_ERROR)
-		{
-		  return S_ERROR;
-		}
-	    }
-	  qualified = (xasl->after_join_pred == NULL || ev_res == V_TRUE);
-	}			/* if (qualified) */
+	  /* open a sequential heap file scan that reads record info */
+	  scan_type = S_HEAP_SCAN_RECORD_INFO;
+	  indx_info = NULL;
+	}
+      else if (curr_spec->access == ACCESS_METHOD_SEQUENTIAL_PAGE_SCAN)
+	{
+	  /* open a sequential heap file scan that reads page info */
+	  scan_type = S_HEAP_PAGE_SCAN;
+	  indx_info = NULL;
+	}
+      else if (curr_spec->access == ACCESS_METHOD_INDEX)
+	{
+	  /* open an indexed heap file scan */
+	  scan_type = S_INDX_SCAN;
+	  indx_info = curr_spec->indexptr;
+	}
+      else if (curr_spec->access == ACCESS_METHOD_INDEX_KEY_INFO)
+	{
+	  scan_type = S_INDX_KEY_INFO_SCAN;
+	  indx_info = curr_spec->indexptr;
+	}
+      else if (curr_spec->access == ACCESS_METHOD_INDEX_NODE_INFO)
+	{
+	  scan_type = S_INDX_NODE_INFO_SCAN;
+	  indx_info = curr_spec->indexptr;
+	}
+      else
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_XASLNODE, 0);
+	  return ER_QPROC_INVALID_XASLNODE;
+	}			/* if */
 
-      if (qualified)
+      if (scan_type == S_HEAP_SCAN || scan_type == S_HEAP_SCAN_RECORD_INFO)
 	{
-	  /* evaluate if predicate */
-	  ev_res = V_UNKNOWN;
-	  if (xasl->if_pred != NULL)
+	  error_code = scan_open_heap_scan (thread_p, s_id, mvcc_select_lock_needed, scan_op_type, fixed, grouped,
+					    curr_spec->single_fetch, curr_spec->s_dbval, val_list, vd,
+					    &ACCESS_SPEC_CLS_OID (curr_spec), &ACCESS_SPEC_HFID (curr_spec),
+					    curr_spec->s.cls_node.cls_regu_list_pred, curr_spec->where_pred,
+					    curr_spec->s.cls_node.cls_regu_list_rest,
+					    curr_spec->s.cls_node.num_attrs_pred,
+					    curr_spec->s.cls_node.attrids_pred, curr_spec->s.cls_node.cache_pred,
+					    curr_spec->s.cls_node.num_attrs_rest, curr_spec->s.cls_node.attrids_rest,
+					    curr_spec->s.cls_node.cache_rest, scan_type,
+					    curr_spec->s.cls_node.cache_reserved,
+					    curr_spec->s.cls_node.cls_regu_list_reserved);
+	  if (error_code != NO_ERROR)
 	    {
-	      ev_res = eval_pred (thread_p, xasl->if_pred, &xasl_state->vd, NULL);
-	      if (ev_res == V_ERROR)
-		{
-		  return S_ERROR;
-		}
+	      ASSERT_ERROR ();
+	      goto exit_on_error;
 	    }
-	  qualified = (xasl->if_pred == NULL || ev_res == V_TRUE);
-	}			/* if (qualified) */
-
-      if (qualified)
+	}
+      else if (scan_type == S_HEAP_PAGE_SCAN)
 	{
-	  /* clear fptr subquery list files */
-	  if (xasl->fptr_list)
+	  error_code = scan_open_heap_page_scan (thread_p, s_id, val_list, vd, &ACCESS_SPEC_CLS_OID (curr_spec),
+						 &ACCESS_SPEC_HFID (curr_spec), curr_spec->where_pred, scan_type,
+						 curr_spec->s.cls_node.cache_reserved,
+						 curr_spec->s.cls_node.cls_regu_list_reserved);
+	  if (error_code != NO_ERROR)
 	    {
-	      qexec_clear_head_lists (thread_p, xasl->fptr_list);
-	      if (xasl->curr_spec->flags & ACCESS_SPEC_FLAG_FOR_UPDATE)
-		{
-		  scan_operation_type = S_UPDATE;
-		}
-	      else
-		{
-		  scan_operation_type = S_SELECT;
-		}
+	      ASSERT_ERROR ();
+	      goto exit_on_error;
 	    }
-	  /* evaluate fptr list */
-	  for (xptr = xasl->fptr_list; qualified && xptr != NULL; xptr = xptr->next)
+	}
+      else if (scan_type == S_INDX_KEY_INFO_SCAN)
+	{
+	  error_code =
+	    scan_open_index_key_info_scan (thread_p, s_id, val_list, vd, indx_info, &ACCESS_SPEC_CLS_OID (curr_spec),
+					   &ACCESS_SPEC_HFID (curr_spec), curr_spec->where_pred,
+					   curr_spec->s.cls_node.cls_output_val_list, iscan_oid_order, query_id,
+					   curr_spec->s.cls_node.cache_reserved,
+					   curr_spec->s.cls_node.cls_regu_list_reserved);
+	  if (error_code != NO_ERROR)
 	    {
-	      if (qexec_execute_obj_fetch (thread_p, xptr, xasl_state, scan_operation_type) != NO_ERROR)
-		{
-		  return S_ERROR;
-		}
-	      else if (xptr->proc.fetch.fetch_res == false)
-		{
-		  qualified = false;
-		}
+	      ASSERT_ERROR ();
+	      goto exit_on_error;
 	    }
-	}			/* if (qualified) */
-
-      if (qualified)
+	  /* monitor */
+	  perfmon_inc_stat (thread_p, PSTAT_QM_NUM_ISCANS);
+	}
+      else if (scan_type == S_INDX_NODE_INFO_SCAN)
 	{
-	  if (!xasl->scan_ptr)
+	  error_code = scan_open_index_node_info_scan (thread_p, s_id, val_list, vd, indx_info, curr_spec->where_pred,
+						       curr_spec->s.cls_node.cache_reserved,
+						       curr_spec->s.cls_node.cls_regu_list_reserved);
+	  if (error_code != NO_ERROR)
 	    {
-	      /* no scan procedure block */
-	      return S_SUCCESS;
+	      ASSERT_ERROR ();
+	      goto exit_on_error;
 	    }
-	  else
+	  /* monitor */
+	  perfmon_inc_stat (thread_p, PSTAT_QM_NUM_ISCANS);
+	}
+      else			/* S_INDX_SCAN */
+	{
+	  error_code = scan_open_index_scan (thread_p, s_id, mvcc_select_lock_needed, scan_op_type, fixed, grouped,
+					     curr_spec->single_fetch, curr_spec->s_dbval, val_list, vd, indx_info,
+					     &ACCESS_SPEC_CLS_OID (curr_spec), &ACCESS_SPEC_HFID (curr_spec),
+					     curr_spec->s.cls_node.cls_regu_list_key, curr_spec->where_key,
+					     curr_spec->s.cls_node.cls_regu_list_pred, curr_spec->where_pred,
+					     curr_spec->s.cls_node.cls_regu_list_rest, curr_spec->where_range,
+					     curr_spec->s.cls_node.cls_regu_list_range,
+					     curr_spec->s.cls_node.cls_output_val_list,
+					     curr_spec->s.cls_node.cls_regu_val_list,
+					     curr_spec->s.cls_node.num_attrs_key, curr_spec->s.cls_node.attrids_key,
+					     curr_spec->s.cls_node.cache_key, curr_spec->s.cls_node.num_attrs_pred,
+					     curr_spec->s.cls_node.attrids_pred, curr_spec->s.cls_node.cache_pred,
+					     curr_spec->s.cls_node.num_attrs_rest, curr_spec->s.cls_node.attrids_rest,
+					     curr_spec->s.cls_node.cache_rest, curr_spec->s.cls_node.num_attrs_range,
+					     curr_spec->s.cls_node.attrids_range, curr_spec->s.cls_node.cache_range,
+					     iscan_oid_order, query_id);
+	  if (error_code != NO_ERROR)
 	    {
-	      /* current scan block has at least one qualified item */
-	      xasl->curr_spec->s_id.qualified_block = true;
-
-	      /* start following scan procedure */
-	      xasl->scan_ptr->next_scan_on = false;
-	      if (scan_reset_scan_block (thread_p, &xasl->scan_ptr->curr_spec->s_id) == S_ERROR)
-		{
-		  return S_ERROR;
-		}
-
-	      xasl->next_scan_on = true;
-
-	      /* execute following scan procedure */
-	      xs_scan = (*next_scan_fnc) (thread_p, xasl->scan_ptr, xasl_state, ignore, next_scan_fnc + 1);
-	      if (xs_scan == S_END)
-		{
-		  xasl->next_scan_on = false;
-		}
-	      else
-		{
-		  return xs_scan;
-		}
+	      ASSERT_ERROR ();
+	      goto exit_on_error;
 	    }
-	}			/* if (qualified) */
+	  /* monitor */
+	  perfmon_inc_stat (thread_p, PSTAT_QM_NUM_ISCANS);
+	}
+      break;
 
-    }
-  while (1);
+    case TARGET_CLASS_ATTR:
+      error_code =
+	scan_open_class_attr_scan (thread_p, s_id, grouped, curr_spec->single_fetch, curr_spec->s_dbval, val_list, vd,
+				   &ACCESS_SPEC_CLS_OID (curr_spec), &ACCESS_SPEC_HFID (curr_spec),
+				   curr_spec->s.cls_node.cls_regu_list_pred, curr_spec->where_pred,
+				   curr_spec->s.cls_node.cls_regu_list_rest, curr_spec->s.cls_node.num_attrs_pred,
+				   curr_spec->s.cls_node.attrids_pred, curr_spec->s.cls_node.cache_pred,
+				   curr_spec->s.cls_node.num_attrs_rest, curr_spec->s.cls_node.attrids_rest,
+				   curr_spec->s.cls_node.cache_rest);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  goto exit_on_error;
+	}
+      break;
 
-}
+    case TARGET_LIST:
+      /* open a list file scan */
+      if (ACCESS_SPEC_XASL_NODE (curr_spec) && ACCESS_SPEC_XASL_NODE (curr_spec)->spec_list == curr_spec)
+	{
+	  /* if XASL of access spec for list scan is itself then this is for HQ */
+	  list_id = ACCESS_SPEC_CONNECT_BY_LIST_ID (curr_spec);
+	}
+      else
+	{
+	  list_id = ACCESS_SPEC_LIST_ID (curr_spec);
+	}
+      error_code =
+	scan_open_list_scan (thread_p, s_id, grouped, curr_spec->single_fetch, curr_spec->s_dbval, val_list, vd,
+			     list_id, curr_spec->s.list_node.list_regu_list_pred,
+			     curr_spec->where_pred, curr_spec->s.list_node.list_regu_list_rest,
+			     curr_spec->s.list_node.list_regu_list_build, curr_spec->s.list_node.list_regu_list_probe,
+			     curr_spec->s.list_node.hash_list_scan_yn, query_id);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  goto exit_on_error;
+	}
+      break;
 
-/*
- * qexec_reset_regu_variable_list () - reset value cache for a list of regu
- *				       variables
- * return : void
- * list (in) : regu variable list
- */
-static void
-qexec_reset_regu_variable_list (REGU_VARIABLE_LIST list)
-{
-  REGU_VARIABLE_LIST var = list;
+    case TARGET_SHOWSTMT:
+      /* open a showstmt scan */
+      error_code =
+	scan_open_showstmt_scan (thread_p, s_id, grouped, curr_spec->single_fetch, curr_spec->s_dbval, val_list, vd,
+				 curr_spec->where_pred, curr_spec->s.showstmt_node.show_type,
+				 curr_spec->s.showstmt_node.arg_list);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  goto exit_on_error;
+	}
+      break;
 
-  while (var != NULL)
-    {
-      qexec_reset_regu_variable (&var->value);
-      var = var->next;
-    }
-}
+    case TARGET_REGUVAL_LIST:
+      /* open a regu value list scan */
+      error_code =
+	scan_open_values_scan (thread_p, s_id, grouped, curr_spec->single_fetch, curr_spec->s_dbval, val_list, vd,
+			       ACCESS_SPEC_RLIST_VALPTR_LIST (curr_spec));
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  goto exit_on_error;
+	}
+      break;
 
-/*
- * qexec_reset_pred_expr () - reset value cache for a pred expr
- * return : void
- * pred (in) : pred expr
- */
-static void
-qexec_reset_pred_expr (PRED_EXPR * pred)
-{
-  if (pred == NULL)
-    {
-      return;
-    }
-  switch (pred->type)
-    {
-    case T_PRED:
-      qexec_reset_pred_expr (pred->pe.m_pred.lhs);
-      qexec_reset_pred_expr (pred->pe.m_pred.rhs);
-      break;
-    case T_EVAL_TERM:
-      switch (pred->pe.m_eval_term.et_type)
+    case TARGET_SET:
+      /* open a set based derived table scan */
+      error_code =
+	scan_open_set_scan (thread_p, s_id, grouped, curr_spec->single_fetch, curr_spec->s_dbval, val_list, vd,
+			    ACCESS_SPEC_SET_PTR (curr_spec), ACCESS_SPEC_SET_REGU_LIST (curr_spec),
+			    curr_spec->where_pred);
+      if (error_code != NO_ERROR)
 	{
-	case T_COMP_EVAL_TERM:
-	  {
-	    COMP_EVAL_TERM *et_comp = &pred->pe.m_eval_term.et.et_comp;
-
-	    qexec_reset_regu_variable (et_comp->lhs);
-	    qexec_reset_regu_variable (et_comp->rhs);
-	  }
-	  break;
-	case T_ALSM_EVAL_TERM:
-	  {
-	    ALSM_EVAL_TERM *et_alsm = &pred->pe.m_eval_term.et.et_alsm;
-
-	    qexec_reset_regu_variable (et_alsm->elem);
-	    qexec_reset_regu_variable (et_alsm->elemset);
-	  }
-	  break;
-	case T_LIKE_EVAL_TERM:
-	  {
-	    LIKE_EVAL_TERM *et_like = &pred->pe.m_eval_term.et.et_like;
+	  ASSERT_ERROR ();
+	  goto exit_on_error;
+	}
+      break;
 
-	    qexec_reset_regu_variable (et_like->src);
-	    qexec_reset_regu_variable (et_like->pattern);
-	    qexec_reset_regu_variable (et_like->esc_char);
-	  }
-	  break;
-	case T_RLIKE_EVAL_TERM:
-	  {
-	    RLIKE_EVAL_TERM *et_rlike = &pred->pe.m_eval_term.et.et_rlike;
-	    qexec_reset_regu_variable (et_rlike->case_sensitive);
-	    qexec_reset_regu_variable (et_rlike->pattern);
-	    qexec_reset_regu_variable (et_rlike->src);
-	  }
+    case TARGET_JSON_TABLE:
+      /* open a json table based derived table scan */
+      error_code =
+	scan_open_json_table_scan (thread_p, s_id, grouped, curr_spec->single_fetch, curr_spec->s_dbval, val_list,
+				   vd, curr_spec->where_pred);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  goto exit_on_error;
 	}
       break;
-    case T_NOT_TERM:
-      qexec_reset_pred_expr (pred->pe.m_not_term);
+
+    case TARGET_METHOD:
+      error_code =
+	scan_open_method_scan (thread_p, s_id, grouped, curr_spec->single_fetch, curr_spec->s_dbval, val_list, vd,
+			       ACCESS_SPEC_METHOD_LIST_ID (curr_spec), ACCESS_SPEC_METHOD_SIG_LIST (curr_spec));
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  goto exit_on_error;
+	}
       break;
+
+    default:
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_XASLNODE, 0);
+      error_code = ER_QPROC_INVALID_XASLNODE;
+      goto exit_on_error;
+    }				/* switch */
+
+  s_id->scan_immediately_stop = scan_immediately_stop;
+
+  if (p_mvcc_select_lock_needed)
+    {
+      *p_mvcc_select_lock_needed = mvcc_select_lock_needed;
+    }
+
+  return NO_ERROR;
+
+exit_on_error:
+
+  if (curr_spec->pruning_type == DB_PARTITIONED_CLASS && curr_spec->parts != NULL)
+    {
+      /* reset pruning info */
+      db_private_free (thread_p, curr_spec->parts);
+      curr_spec->parts = NULL;
+      curr_spec->curent = NULL;
+      curr_spec->pruned = false;
     }
+
+  ASSERT_ERROR_AND_SET (error_code);
+  return error_code;
 }
 
 /*
- * qexec_reset_regu_variable () - reset the cache for a regu variable
- * return : void
- * var (in) : regu variable
+ * qexec_close_scan () -
+ *   return:
+ *   curr_spec(in)      : Access Specification Node
+ *
+ * Note: This routine is used to close the access specification node scan.
  */
 static void
-qexec_reset_regu_variable (REGU_VARIABLE * var)
+qexec_close_scan (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * curr_spec)
 {
-  if (var == NULL)
+  if (curr_spec == NULL)
     {
       return;
     }
 
-  switch (var->type)
+  /* monitoring */
+  switch (curr_spec->type)
     {
-    case TYPE_ATTR_ID:
-    case TYPE_SHARED_ATTR_ID:
-    case TYPE_CLASS_ATTR_ID:
-      var->value.attr_descr.cache_dbvalp = NULL;
+    case TARGET_CLASS:
+      if (curr_spec->access == ACCESS_METHOD_SEQUENTIAL || curr_spec->access == ACCESS_METHOD_SEQUENTIAL_RECORD_INFO
+	  || curr_spec->access == ACCESS_METHOD_SEQUENTIAL_PAGE_SCAN)
+	{
+	  perfmon_inc_stat (thread_p, PSTAT_QM_NUM_SSCANS);
+	}
+      else if (IS_ANY_INDEX_ACCESS (curr_spec->access))
+	{
+	  perfmon_inc_stat (thread_p, PSTAT_QM_NUM_ISCANS);
+	}
+
+      if (curr_spec->parts != NULL)
+	{
+	  /* reset pruning info */
+	  db_private_free (thread_p, curr_spec->parts);
+	  curr_spec->parts = NULL;
+	  curr_spec->curent = NULL;
+	  curr_spec->pruned = false;
+	}
       break;
-    case TYPE_INARITH:
-    case TYPE_OUTARITH:
-      qexec_reset_regu_variable (var->value.arithptr->leftptr);
-      qexec_reset_regu_variable (var->value.arithptr->rightptr);
-      qexec_reset_regu_variable (var->value.arithptr->thirdptr);
-      /* use arithptr */
+
+    case TARGET_CLASS_ATTR:
       break;
-    case TYPE_FUNC:
-      /* use funcp */
-      qexec_reset_regu_variable_list (var->value.funcp->operand);
+
+    case TARGET_LIST:
+      perfmon_inc_stat (thread_p, PSTAT_QM_NUM_LSCANS);
       break;
-    default:
+
+    case TARGET_SHOWSTMT:
+      /* do nothing */
+      break;
+
+    case TARGET_REGUVAL_LIST:
+      /* currently do nothing */
+      break;
+
+    case TARGET_SET:
+      perfmon_inc_stat (thread_p, PSTAT_QM_NUM_SETSCANS);
+      break;
+
+    case TARGET_JSON_TABLE:
+      /* currently do nothing
+         todo: check if here need to add something
+       */
+      break;
+
+    case TARGET_METHOD:
+      perfmon_inc_stat (thread_p, PSTAT_QM_NUM_METHSCANS);
       break;
     }
+
+  scan_close_scan (thread_p, &curr_spec->s_id);
 }
 
 /*
- * qexec_prune_spec () - perform partition pruning on an access spec
- * return : error code or NO_ERROR
- * thread_p (in) :
- * spec (in) :
- * vd (in) :
- * scan_op_type (in) :
+ * qexec_end_scan () -
+ *   return:
+ *   curr_spec(in)      : Access Specification Node
+ *
+ * Note: This routine is used to end the access specification node scan.
+ *
+ * Note: This routine is called for ERROR CASE scan end operation.
  */
-static int
-qexec_prune_spec (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * spec, VAL_DESCR * vd, SCAN_OPERATION_TYPE scan_op_type)
+static void
+qexec_end_scan (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * curr_spec)
 {
-  PARTITION_SPEC_TYPE *partition_spec = NULL;
-  LOCK lock = NULL_LOCK;
-  int granted;
-  int error = NO_ERROR;
-
-  if (spec == NULL || spec->pruned)
-    {
-      return NO_ERROR;
-    }
-  else if (spec->pruning_type != DB_PARTITIONED_CLASS)
+  if (curr_spec)
     {
-      spec->pruned = true;
-      return NO_ERROR;
+      scan_end_scan (thread_p, &curr_spec->s_id);
     }
+}
 
-  error = partition_prune_spec (thread_p, vd, spec);
-  if (error != NO_ERROR)
-    {
-      ASSERT_ERROR ();
-      return error;
-    }
+/*
+ * qexec_next_merge_block () -
+ *   return:
+ *   spec(in)   :
+ */
+static SCAN_CODE
+qexec_next_merge_block (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE ** spec)
+{
+  SCAN_CODE sb_scan;
 
-  if (!COMPOSITE_LOCK (scan_op_type) && !(spec->flags & ACCESS_SPEC_FLAG_FOR_UPDATE))
-    {
-      lock = IS_LOCK;
-    }
-  else
+  if (scan_start_scan (thread_p, &(*spec)->s_id) != NO_ERROR)
     {
-      /* MVCC use IX_LOCK on class at update/delete */
-      lock = IX_LOCK;
+      return S_ERROR;
     }
 
-  for (partition_spec = spec->parts; partition_spec != NULL; partition_spec = partition_spec->next)
+  do
     {
-      granted = lock_subclass (thread_p, &partition_spec->oid, &ACCESS_SPEC_CLS_OID (spec), lock, LK_UNCOND_LOCK);
-      if (granted != LK_GRANTED)
+      sb_scan = scan_next_scan_block (thread_p, &(*spec)->s_id);
+      if (sb_scan == S_SUCCESS)
 	{
-	  ASSERT_ERROR_AND_SET (error);
-	  return error;
+	  return S_SUCCESS;
 	}
-    }
-
-  return NO_ERROR;
-}
+      else if (sb_scan == S_END)
+	{
+	  /* close old scan */
+	  scan_end_scan (thread_p, &(*spec)->s_id);
 
-/*
- * qexec_init_next_partition () - move to the next partition in the list
- * return : S_END if there are no more partitions, S_SUCCESS on success,
- *	    S_ERROR on error
- * thread_p (in) :
- * spec (in)	 : spec for which to move to the next partition
- */
-static SCAN_CODE
-qexec_init_next_partition (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * spec)
-{
-  int error = NO_ERROR;
-  SCAN_OPERATION_TYPE scan_op_type = spec->s_id.scan_op_type;
-  bool mvcc_select_lock_needed = spec->s_id.mvcc_select_lock_needed;
-  int fixed = spec->s_id.fixed;
-  int grouped = spec->s_id.grouped;
-  QPROC_SINGLE_FETCH single_fetch = spec->s_id.single_fetch;
-  VAL_LIST *val_list = spec->s_id.val_list;
-  VAL_DESCR *vd = spec->s_id.vd;
-  bool iscan_oid_order = spec->s_id.s.isid.iscan_oid_order;
-  INDX_INFO *idxptr = NULL;
-  QUERY_ID query_id = spec->s_id.s.isid.indx_cov.query_id;
-  OID class_oid;
-  HFID class_hfid;
-  BTID btid;
+	  /* move to the following access specifications left */
+	  *spec = (*spec)->next;
 
-  if (spec->type != TARGET_CLASS && spec->type != TARGET_CLASS_ATTR)
-    {
-      return S_END;
-    }
+	  /* check for and skip the case of empty heap files */
+	  while (*spec != NULL && QEXEC_EMPTY_ACCESS_SPEC_SCAN (*spec))
+	    {
+	      *spec = (*spec)->next;
+	    }
 
-  if (spec->parts == NULL)
-    {
-      return S_END;
-    }
+	  if (*spec == NULL)
+	    {
+	      return S_END;
+	    }
 
-  if (spec->curent == NULL)
-    {
-      spec->curent = spec->parts;
-    }
-  else
-    {
-      if (spec->curent->next == NULL)
-	{
-	  /* no more partitions */
-	  spec->curent = NULL;
+	  /* initialize scan */
+	  if (scan_start_scan (thread_p, &(*spec)->s_id) != NO_ERROR)
+	    {
+	      return S_ERROR;
+	    }
 	}
       else
 	{
-	  spec->curent = spec->curent->next;
+	  return S_ERROR;
 	}
+
     }
-  /* close current scan and open a new one on the next partition */
-  scan_end_scan (thread_p, &spec->s_id);
-  scan_close_scan (thread_p, &spec->s_id);
+  while (1);
+}
 
-  /* we also need to reset caches for attributes */
-  qexec_reset_regu_variable_list (spec->s.cls_node.cls_regu_list_pred);
-  qexec_reset_regu_variable_list (spec->s.cls_node.cls_regu_list_rest);
-  qexec_reset_regu_variable_list (spec->s.cls_node.cls_regu_list_key);
-  qexec_reset_pred_expr (spec->where_pred);
-  qexec_reset_pred_expr (spec->where_key);
+/*
+ * qexec_next_scan_block () -
+ *   return: SCAN_CODE (S_SUCCESS, S_END, S_ERROR)
+ *   xasl(in)   : XASL Tree pointer
+ *
+ * Note: This function is used to move the current access specification
+ * node scan identifier for the given XASL block to the next
+ * scan block. If there are no more scan blocks for the current
+ * access specfication node, it moves to the next access
+ * specification, if any, and starts the new scan block for that
+ * node. If there are no more access specification nodes left,
+ * it returns S_END.
+ */
+static SCAN_CODE
+qexec_next_scan_block (THREAD_ENTRY * thread_p, XASL_NODE * xasl)
+{
+  SCAN_CODE sb_scan;
+  OID *class_oid;
+  HFID *class_hfid;
 
-  if (spec->curent == NULL)
+  if (xasl->curr_spec == NULL)
     {
-      /* reset back to root class */
-      COPY_OID (&class_oid, &ACCESS_SPEC_CLS_OID (spec));
-      HFID_COPY (&class_hfid, &ACCESS_SPEC_HFID (spec));
-      if (IS_ANY_INDEX_ACCESS (spec->access))
+      /* initialize scan id */
+      xasl->curr_spec = xasl->spec_list;
+
+      /* check for and skip the case of empty heap file cases */
+      while (xasl->curr_spec != NULL && QEXEC_EMPTY_ACCESS_SPEC_SCAN (xasl->curr_spec))
 	{
-	  btid = spec->btid;
+	  xasl->curr_spec = xasl->curr_spec->next;
 	}
-    }
-  else
-    {
-      COPY_OID (&class_oid, &spec->curent->oid);
-      HFID_COPY (&class_hfid, &spec->curent->hfid);
-      if (IS_ANY_INDEX_ACCESS (spec->access))
+
+      if (xasl->curr_spec == NULL)
 	{
-	  btid = spec->curent->btid;
+	  return S_END;
 	}
-    }
-  if (spec->type == TARGET_CLASS
-      && (spec->access == ACCESS_METHOD_SEQUENTIAL || spec->access == ACCESS_METHOD_SEQUENTIAL_RECORD_INFO))
-    {
-      HEAP_SCAN_ID *hsidp = &spec->s_id.s.hsid;
-      SCAN_TYPE scan_type = (spec->access == ACCESS_METHOD_SEQUENTIAL) ? S_HEAP_SCAN : S_HEAP_SCAN_RECORD_INFO;
-      int i = 0;
-      if (hsidp->caches_inited)
+
+      assert (xasl->curr_spec != NULL);
+
+      /* initialize scan */
+      if ((xasl->curr_spec->type == TARGET_CLASS || xasl->curr_spec->type == TARGET_CLASS_ATTR)
+	  && xasl->curr_spec->parts != NULL && xasl->curr_spec->curent == NULL
+	  && xasl->curr_spec->access != ACCESS_METHOD_INDEX_NODE_INFO)
 	{
-	  heap_attrinfo_end (thread_p, hsidp->pred_attrs.attr_cache);
-	  heap_attrinfo_end (thread_p, hsidp->rest_attrs.attr_cache);
-	  if (hsidp->cache_recordinfo != NULL)
+	  /* initialize the scan_id for partitioned classes */
+	  if (xasl->curr_spec->access == ACCESS_METHOD_SEQUENTIAL
+	      || xasl->curr_spec->access == ACCESS_METHOD_SEQUENTIAL_RECORD_INFO)
 	    {
-	      for (i = 0; i < HEAP_RECORD_INFO_COUNT; i++)
-		{
-		  pr_clear_value (hsidp->cache_recordinfo[i]);
-		}
+	      class_oid = &xasl->curr_spec->s_id.s.hsid.cls_oid;
+	      class_hfid = &xasl->curr_spec->s_id.s.hsid.hfid;
+	    }
+	  else if (xasl->curr_spec->access == ACCESS_METHOD_SEQUENTIAL_PAGE_SCAN)
+	    {
+	      class_oid = &xasl->curr_spec->s_id.s.hpsid.cls_oid;
+	      class_hfid = &xasl->curr_spec->s_id.s.hpsid.hfid;
+	    }
+	  else if (xasl->curr_spec->access == ACCESS_METHOD_INDEX
+		   || xasl->curr_spec->access == ACCESS_METHOD_INDEX_KEY_INFO)
+	    {
+	      class_oid = &xasl->curr_spec->s_id.s.isid.cls_oid;
+	      class_hfid = &xasl->curr_spec->s_id.s.isid.hfid;
+	    }
+	  else
+	    {
+	      assert (false);
+	      return S_ERROR;
 	    }
-	  hsidp->caches_inited = false;
-	}
-      hsidp->scancache_inited = false;
 
-      error =
-	scan_open_heap_scan (thread_p, &spec->s_id, mvcc_select_lock_needed, scan_op_type, fixed, grouped, single_fetch,
-			     spec->s_dbval, val_list, vd, &class_oid, &class_hfid, spec->s.cls_node.cls_regu_list_pred,
-			     spec->where_pred, spec->s.cls_node.cls_regu_list_rest,
-			     spec->s.cls_node.num_attrs_pred, spec->s.cls_node.attrids_pred,
-			     spec->s.cls_node.cache_pred, spec->s.cls_node.num_attrs_rest,
-			     spec->s.cls_node.attrids_rest, spec->s.cls_node.cache_rest,
-			     scan_type, spec->s.cls_node.cache_reserved, spec->s.cls_node.cls_regu_list_reserved);
-    }
-  else if (spec->type == TARGET_CLASS && spec->access == ACCESS_METHOD_SEQUENTIAL_PAGE_SCAN)
-    {
-      HEAP_PAGE_SCAN_ID *hpsidp = &spec->s_id.s.hpsid;
-      SCAN_TYPE scan_type = S_HEAP_PAGE_SCAN;
-      int i = 0;
+	  COPY_OID (class_oid, &ACCESS_SPEC_CLS_OID (xasl->curr_spec));
+	  HFID_COPY (class_hfid, &ACCESS_SPEC_HFID (xasl->curr_spec));
+	}
 
-      if (hpsidp->cache_page_info != NULL)
+      if (scan_start_scan (thread_p, &xasl->curr_spec->s_id) != NO_ERROR)
 	{
-	  for (i = 0; i < HEAP_PAGE_INFO_COUNT; i++)
-	    {
-	      pr_clear_value (hpsidp->cache_page_info[i]);
-	    }
+	  return S_ERROR;
 	}
-      error =
-	scan_open_heap_page_scan (thread_p, &spec->s_id, val_list, vd, &class_oid, &class_hfid, spec->where_pred,
-				  scan_type, spec->s.cls_node.cache_reserved, spec->s.cls_node.cls_regu_list_reserved);
     }
-  else if (spec->type == TARGET_CLASS && spec->access == ACCESS_METHOD_INDEX)
+
+  do
     {
-      INDX_SCAN_ID *isidp = &spec->s_id.s.isid;
-      if (isidp->caches_inited)
+      sb_scan = scan_next_scan_block (thread_p, &xasl->curr_spec->s_id);
+      if (sb_scan == S_SUCCESS)
 	{
-	  if (isidp->range_pred.regu_list)
+	  return S_SUCCESS;
+	}
+      else if (sb_scan == S_END)
+	{
+	  /* if curr_spec is a partitioned class, do not move to the next spec unless we went through all partitions */
+	  SCAN_CODE s_parts = qexec_init_next_partition (thread_p, xasl->curr_spec);
+	  if (s_parts == S_SUCCESS)
 	    {
-	      heap_attrinfo_end (thread_p, isidp->range_attrs.attr_cache);
-
-	      /* some attributes might remain also cached in pred_expr
-	       * (lhs|rhs).value.attr_descr.cache_dbvalp might point to attr_cache values
-	       * see fetch_peek_dbval for example */
-	      qexec_reset_pred_expr (isidp->range_pred.pred_expr);
+	      /* successfully moved to the next partition */
+	      continue;
 	    }
-	  if (isidp->key_pred.regu_list)
+	  else if (s_parts == S_ERROR)
 	    {
-	      heap_attrinfo_end (thread_p, isidp->key_attrs.attr_cache);
+	      return S_ERROR;
 	    }
-	  heap_attrinfo_end (thread_p, isidp->pred_attrs.attr_cache);
-	  heap_attrinfo_end (thread_p, isidp->rest_attrs.attr_cache);
-	  isidp->caches_inited = false;
-	}
-      idxptr = spec->indexptr;
-      idxptr->btid = btid;
-      spec->s_id.s.isid.scancache_inited = false;
-      spec->s_id.s.isid.caches_inited = false;
 
-      error =
-	scan_open_index_scan (thread_p, &spec->s_id, mvcc_select_lock_needed, scan_op_type, fixed, grouped,
-			      single_fetch, spec->s_dbval, val_list, vd, idxptr, &class_oid, &class_hfid,
-			      spec->s.cls_node.cls_regu_list_key, spec->where_key, spec->s.cls_node.cls_regu_list_pred,
-			      spec->where_pred, spec->s.cls_node.cls_regu_list_rest, spec->where_range,
-			      spec->s.cls_node.cls_regu_list_range,
-			      spec->s.cls_node.cls_output_val_list, spec->s.cls_node.cls_regu_val_list,
-			      spec->s.cls_node.num_attrs_key, spec->s.cls_node.attrids_key, spec->s.cls_node.cache_key,
-			      spec->s.cls_node.num_attrs_pred, spec->s.cls_node.attrids_pred,
-			      spec->s.cls_node.cache_pred, spec->s.cls_node.num_attrs_rest,
-			      spec->s.cls_node.attrids_rest, spec->s.cls_node.cache_rest,
-			      spec->s.cls_node.num_attrs_range, spec->s.cls_node.attrids_range,
-			      spec->s.cls_node.cache_range, iscan_oid_order, query_id);
+	  /* close old scan */
+	  scan_end_scan (thread_p, &xasl->curr_spec->s_id);
 
-    }
-  else if (spec->type == TARGET_CLASS_ATTR)
-    {
-      if (spec->s_id.s.hsid.caches_inited)
-	{
-	  heap_attrinfo_end (thread_p, spec->s_id.s.hsid.pred_attrs.attr_cache);
-	  heap_attrinfo_end (thread_p, spec->s_id.s.hsid.rest_attrs.attr_cache);
-	  spec->s_id.s.hsid.caches_inited = false;
-	}
+	  /* move to the following access specifications left */
+	  xasl->curr_spec = xasl->curr_spec->next;
 
-      error =
-	scan_open_class_attr_scan (thread_p, &spec->s_id, grouped, spec->single_fetch, spec->s_dbval, val_list, vd,
-				   &class_oid, &class_hfid, spec->s.cls_node.cls_regu_list_pred, spec->where_pred,
-				   spec->s.cls_node.cls_regu_list_rest, spec->s.cls_node.num_attrs_pred,
-				   spec->s.cls_node.attrids_pred, spec->s.cls_node.cache_pred,
-				   spec->s.cls_node.num_attrs_rest, spec->s.cls_node.attrids_rest,
-				   spec->s.cls_node.cache_rest);
-    }
-  if (error != NO_ERROR)
-    {
-      return S_ERROR;
-    }
+	  /* check for and skip the case of empty heap files */
+	  while (xasl->curr_spec != NULL && QEXEC_EMPTY_ACCESS_SPEC_SCAN (xasl->curr_spec))
+	    {
+	      xasl->curr_spec = xasl->curr_spec->next;
+	    }
 
-  if (spec->curent == NULL)
-    {
-      return S_END;
-    }
+	  if (xasl->curr_spec == NULL)
+	    {
+	      return S_END;
+	    }
 
-  error = scan_start_scan (thread_p, &spec->s_id);
-  if (error != NO_ERROR)
-    {
-      return S_ERROR;
+	  /* initialize scan */
+	  if (scan_start_scan (thread_p, &xasl->curr_spec->s_id) != NO_ERROR)
+	    {
+	      return S_ERROR;
+	    }
+	}
+      else
+	{
+	  return S_ERROR;
+	}
     }
-  return S_SUCCESS;
+  while (1);
+
 }
 
 /*
- * qexec_intprt_fnc () -
- *   return: scan code
+ * qexec_next_scan_block_iterations () -
+ *   return: SCAN_CODE (S_SUCCESS, S_END, S_ERROR)
  *   xasl(in)   : XASL Tree pointer
- *   xasl_state(in)     : XASL Tree state information
- *   tplrec(out) : Tuple record descriptor to store result tuples
- *   next_scan_fnc(in)  : Function to interpret following XASL scan block
  *
- * Note: This function is the main function used to interpret an XASL
- * tree block. That is, it assumes a general format XASL block
- * with all possible representations.
  */
 static SCAN_CODE
-qexec_intprt_fnc (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state, QFILE_TUPLE_RECORD * tplrec,
-		  XASL_SCAN_FNC_PTR next_scan_fnc)
+qexec_next_scan_block_iterations (THREAD_ENTRY * thread_p, XASL_NODE * xasl)
 {
-#define CTE_CURRENT_SCAN_READ_TUPLE(node) \
-  ((((node)->curr_spec->type == TARGET_LIST && (node)->curr_spec->s_id.type == S_LIST_SCAN)) \
-    ? ((node)->curr_spec->s_id.s.llsid.lsid.curr_tplno) : -1)
-#define CTE_CURR_ITERATION_LAST_TUPLE(node) \
-  ((((node)->curr_spec->type == TARGET_LIST && (node)->curr_spec->s_id.type == S_LIST_SCAN)) \
-    ? ((node)->curr_spec->s_id.s.llsid.list_id->tuple_cnt - 1) : -1)
-
-  XASL_NODE *xptr = NULL;
+  SCAN_CODE sb_next;
   SCAN_CODE xs_scan;
-  SCAN_CODE xb_scan;
-  SCAN_CODE ls_scan;
-  DB_LOGICAL ev_res;
-  int qualified;
-  AGGREGATE_TYPE *agg_ptr = NULL;
-  bool count_star_with_iscan_opt = false;
-  SCAN_OPERATION_TYPE scan_operation_type;
-  int curr_iteration_last_cursor = 0;
-  int recursive_iterations = 0;
-  bool max_recursive_iterations_reached = false;
-  bool cte_start_new_iteration = false;
+  SCAN_CODE xs_scan2;
+  XASL_NODE *last_xptr;
+  XASL_NODE *prev_xptr;
+  XASL_NODE *xptr2, *xptr3;
 
-  if (xasl->type == BUILDVALUE_PROC)
+  /* first find the last scan block to be moved */
+  for (last_xptr = xasl; last_xptr->scan_ptr; last_xptr = last_xptr->scan_ptr)
     {
-      BUILDVALUE_PROC_NODE *buildvalue = &xasl->proc.buildvalue;
-      if (buildvalue->agg_list != NULL)
+      if (!last_xptr->next_scan_block_on
+	  || (last_xptr->curr_spec && last_xptr->curr_spec->s_id.status == S_STARTED
+	      && !last_xptr->curr_spec->s_id.qualified_block))
 	{
-	  int error = NO_ERROR;
-	  bool is_scan_needed = false;
-	  if (!buildvalue->is_always_false)
-	    {
-	      error =
-		qexec_evaluate_aggregates_optimize (thread_p, buildvalue->agg_list, xasl->spec_list, &is_scan_needed);
-	      if (error != NO_ERROR)
-		{
-		  is_scan_needed = true;
-		}
-	    }
-
-	  if (prm_get_bool_value (PRM_ID_OPTIMIZER_ENABLE_AGGREGATE_OPTIMIZATION) == false)
-	    {
-	      is_scan_needed = true;
-	    }
+	  break;
+	}
+    }
 
-	  if (!is_scan_needed)
-	    {
-	      return S_SUCCESS;
-	    }
+  /* move the last scan block and reset further scans */
 
-	  agg_ptr = buildvalue->agg_list;
-	  if (!xasl->scan_ptr	/* no scan procedure */
-	      && !xasl->fptr_list	/* no path expressions */
-	      && !xasl->if_pred	/* no if predicates */
-	      && !xasl->instnum_pred	/* no instnum predicate */
-	      && agg_ptr->next == NULL	/* no other aggregate functions */
-	      && agg_ptr->function == PT_COUNT_STAR)
+  /* if there are no qualified items in the current scan block, this scan block will make no contribution with other
+   * possible scan block combinations from following classes. Thus, directly move to the next scan block in this class. */
+  if (last_xptr->curr_spec && last_xptr->curr_spec->s_id.status == S_STARTED
+      && !last_xptr->curr_spec->s_id.qualified_block)
+    {
+      if ((xs_scan = qexec_next_scan_block (thread_p, last_xptr)) == S_END)
+	{
+	  /* close following scan procedures if they are still active */
+	  for (xptr2 = last_xptr; xptr2; xptr2 = xptr2->scan_ptr)
 	    {
-	      /* only one count(*) function */
-	      ACCESS_SPEC_TYPE *specp = xasl->spec_list;
-	      if (specp->next == NULL && specp->access == ACCESS_METHOD_INDEX
-		  && specp->s.cls_node.cls_regu_list_pred == NULL && specp->where_pred == NULL
-		  && !specp->indexptr->use_iss && !SCAN_IS_INDEX_MRO (&specp->s_id.s.isid)
-		  && !SCAN_IS_INDEX_COVERED (&specp->s_id.s.isid))
+	      if (xptr2->scan_ptr && xptr2->next_scan_block_on)
 		{
-		  /* count(*) query will scan an index but does not have a data-filter */
-		  specp->s_id.s.isid.need_count_only = true;
-		  count_star_with_iscan_opt = true;
+		  if (xptr2->scan_ptr->curr_spec)
+		    {
+		      scan_end_scan (thread_p, &xptr2->scan_ptr->curr_spec->s_id);
+		    }
+		  xptr2->scan_ptr->curr_spec->curent = NULL;
+		  xptr2->scan_ptr->curr_spec = NULL;
+		  xptr2->next_scan_block_on = false;
 		}
 	    }
 	}
-    }
-  else if (xasl->type == BUILDLIST_PROC)
-    {
-      /* If it is BUILDLIST, do not optimize aggregation */
-      if (xasl->proc.buildlist.g_agg_list != NULL)
+      else if (xs_scan == S_ERROR)
 	{
-	  for (agg_ptr = xasl->proc.buildlist.g_agg_list; agg_ptr; agg_ptr = agg_ptr->next)
-	    {
-	      agg_ptr->flag_agg_optimize = false;
-	    }
+	  return S_ERROR;
 	}
     }
-
-  while ((xb_scan = qexec_next_scan_block_iterations (thread_p, xasl)) == S_SUCCESS)
-    {
-      int cte_offset_read_tuple = 0;
-      int cte_curr_scan_tplno = -1;
-
-      if (xasl->max_iterations != -1)
-	{
-	  assert (xasl->curr_spec->type == TARGET_LIST);
-	  assert (xasl->curr_spec->s_id.type == S_LIST_SCAN);
-
-	  cte_start_new_iteration = true;
-	  recursive_iterations = 1;
-	}
-
-      while ((ls_scan = scan_next_scan (thread_p, &xasl->curr_spec->s_id)) == S_SUCCESS)
+  else if ((xs_scan = qexec_next_scan_block (thread_p, last_xptr)) == S_SUCCESS)
+    {				/* reset all the futher scans */
+      for (xptr2 = last_xptr; xptr2; xptr2 = xptr2->scan_ptr)
 	{
-	  if (xasl->max_iterations != -1)
+	  if (xptr2->scan_ptr)
 	    {
-	      /* the scan tuple number resets when when a new page is fetched
-	       * cte_offset_read_tuple keeps of the global tuple number across the entire list */
-	      if (CTE_CURRENT_SCAN_READ_TUPLE (xasl) < cte_curr_scan_tplno)
+	      sb_next = qexec_next_scan_block (thread_p, xptr2->scan_ptr);
+	      if (sb_next == S_SUCCESS)
 		{
-		  cte_offset_read_tuple += cte_curr_scan_tplno + 1;
+		  xptr2->next_scan_block_on = true;
 		}
-
-	      cte_curr_scan_tplno = CTE_CURRENT_SCAN_READ_TUPLE (xasl);
-
-	      if (cte_start_new_iteration)
+	      else if (sb_next == S_END)
 		{
-		  recursive_iterations++;
-		  if (recursive_iterations >= xasl->max_iterations)
+		  /* close all preceding scan procedures and return */
+		  for (xptr3 = xasl; xptr3 && xptr3 != xptr2->scan_ptr; xptr3 = xptr3->scan_ptr)
 		    {
-		      max_recursive_iterations_reached = true;
-		      break;
+		      if (xptr3->curr_spec)
+			{
+			  scan_end_scan (thread_p, &xptr3->curr_spec->s_id);
+			}
+		      xptr3->curr_spec->curent = NULL;
+		      xptr3->curr_spec = NULL;
+		      xptr3->next_scan_block_on = false;
 		    }
-
-		  curr_iteration_last_cursor = CTE_CURR_ITERATION_LAST_TUPLE (xasl);
-		  assert (curr_iteration_last_cursor >= 0);
-		  cte_start_new_iteration = false;
+		  return S_END;
 		}
-
-	      if (cte_curr_scan_tplno + cte_offset_read_tuple == curr_iteration_last_cursor)
+	      else
 		{
-		  cte_start_new_iteration = true;
+		  return S_ERROR;
 		}
 	    }
+	}
+    }
+  else if (xs_scan == S_ERROR)
+    {
+      return S_ERROR;
+    }
 
-	  if (count_star_with_iscan_opt)
-	    {
-	      xasl->proc.buildvalue.agg_list->accumulator.curr_cnt += (&xasl->curr_spec->s_id)->s.isid.oids_count;
-	      /* may have more scan ranges */
-	      continue;
-	    }
-	  /* set scan item as qualified */
-	  qualified = true;
+  /* now move backwards, resetting all the previous scans */
+  while (last_xptr != xasl)
+    {
 
-	  if (xasl->bptr_list)
-	    {
-	      if (xasl->curr_spec->flags & ACCESS_SPEC_FLAG_FOR_UPDATE)
-		{
-		  scan_operation_type = S_UPDATE;
-		}
-	      else
-		{
-		  scan_operation_type = S_SELECT;
-		}
-	    }
+      /* find the previous to last xptr */
+      for (prev_xptr = xasl; prev_xptr->scan_ptr != last_xptr; prev_xptr = prev_xptr->scan_ptr)
+	;
 
-	  /* evaluate bptr list */
-	  /* if path expression fetch fails, this instance disqualifies */
-	  for (xptr = xasl->bptr_list; qualified && xptr != NULL; xptr = xptr->next)
+      /* set previous scan according to the last scan status */
+      if (last_xptr->curr_spec == NULL)
+	{			/* last scan ended */
+	  prev_xptr->next_scan_block_on = false;
+
+	  /* move the scan block of the previous scan */
+	  xs_scan2 = qexec_next_scan_block (thread_p, prev_xptr);
+	  if (xs_scan2 == S_SUCCESS)
 	    {
-	      if (qexec_execute_obj_fetch (thread_p, xptr, xasl_state, scan_operation_type) != NO_ERROR)
-		{
-		  return S_ERROR;
-		}
-	      else if (xptr->proc.fetch.fetch_res == false)
+	      /* move all the further scan blocks */
+	      for (xptr2 = prev_xptr; xptr2; xptr2 = xptr2->scan_ptr)
 		{
-		  qualified = false;
-		}
-	    }
-
-	  if (qualified)
-	    {
-	      /* evaluate dptr list */
-	      for (xptr = xasl->dptr_list; xptr != NULL; xptr = xptr->next)
-		{
-		  /* clear correlated subquery list files */
-		  qexec_clear_head_lists (thread_p, xptr);
-		  if (XASL_IS_FLAGED (xptr, XASL_LINK_TO_REGU_VARIABLE))
-		    {
-		      /* skip if linked to regu var */
-		      continue;
-		    }
-		  if (qexec_execute_mainblock (thread_p, xptr, xasl_state, NULL) != NO_ERROR)
-		    {
-		      return S_ERROR;
-		    }
-		}
-
-	      /* evaluate after join predicate */
-	      ev_res = V_UNKNOWN;
-	      if (xasl->after_join_pred != NULL)
-		{
-		  ev_res = eval_pred (thread_p, xasl->after_join_pred, &xasl_state->vd, NULL);
-		  if (ev_res == V_ERROR)
-		    {
-		      return S_ERROR;
-		    }
-		}
-	      qualified = (xasl->after_join_pred == NULL || ev_res == V_TRUE);
-
-	      if (qualified)
-		{
-		  /* evaluate if predicate */
-		  ev_res = V_UNKNOWN;
-		  if (xasl->if_pred != NULL)
-		    {
-		      ev_res = eval_pred (thread_p, xasl->if_pred, &xasl_state->vd, NULL);
-		      if (ev_res == V_ERROR)
-			{
-			  return S_ERROR;
-			}
-		    }
-		  qualified = (xasl->if_pred == NULL || ev_res == V_TRUE);
-		}
-
-	      if (qualified)
-		{
-		  /* evaluate fptr list */
-		  if (xasl->fptr_list)
-		    {
-		      if (xasl->curr_spec->flags & ACCESS_SPEC_FLAG_FOR_UPDATE)
-			{
-			  scan_operation_type = S_UPDATE;
-			}
-		      else
-			{
-			  scan_operation_type = S_SELECT;
-			}
-		    }
-
-		  for (xptr = xasl->fptr_list; qualified && xptr != NULL; xptr = xptr->next)
+		  if (xptr2->scan_ptr)
 		    {
-		      if (qexec_execute_obj_fetch (thread_p, xptr, xasl_state, scan_operation_type) != NO_ERROR)
+		      sb_next = qexec_next_scan_block (thread_p, xptr2->scan_ptr);
+		      if (sb_next == S_SUCCESS)
 			{
-			  return S_ERROR;
+			  xptr2->next_scan_block_on = true;
 			}
-		      else if (xptr->proc.fetch.fetch_res == false)
+		      else if (sb_next == S_END)
 			{
-			  qualified = false;
-			}
-		    }
-
-		  if (qualified)
-		    {
-
-		      if (!xasl->scan_ptr)
-			{	/* no scan procedure block */
-
-			  /* if hierarchical query do special processing */
-			  if (XASL_IS_FLAGED (xasl, XASL_HAS_CONNECT_BY))
-			    {
-			      if (qexec_update_connect_by_lists (thread_p, xasl->connect_by_ptr, xasl_state, tplrec) !=
-				  NO_ERROR)
-				{
-				  return S_ERROR;
-				}
-			    }
-			  else
+			  /* close all preceding scan procedures and return */
+			  for (xptr3 = xasl; xptr3 && xptr3 != xptr2->scan_ptr; xptr3 = xptr3->scan_ptr)
 			    {
-			      /* evaluate inst_num predicate */
-			      if (xasl->instnum_val)
-				{
-				  ev_res = qexec_eval_instnum_pred (thread_p, xasl, xasl_state);
-				  if (ev_res == V_ERROR)
-				    {
-				      return S_ERROR;
-				    }
-
-
-				  if ((xasl->instnum_flag & XASL_INSTNUM_FLAG_SCAN_LAST_STOP))
-				    {
-				      if (qexec_end_one_iteration (thread_p, xasl, xasl_state, tplrec) != NO_ERROR)
-					{
-					  return S_ERROR;
-					}
-
-				      return S_SUCCESS;
-				    }
-
-				  if ((xasl->instnum_flag & XASL_INSTNUM_FLAG_SCAN_STOP))
-				    {
-				      return S_SUCCESS;
-				    }
-				}
-
-			      qualified = (xasl->instnum_pred == NULL || ev_res == V_TRUE);
-			      if (qualified)
+			      if (xptr3->curr_spec)
 				{
-				  /* one iteration successfully completed */
-				  if (qexec_end_one_iteration (thread_p, xasl, xasl_state, tplrec) != NO_ERROR)
-				    {
-				      return S_ERROR;
-				    }
-				  /* only one row is need for exists OP */
-				  if (XASL_IS_FLAGED (xasl, XASL_NEED_SINGLE_TUPLE_SCAN))
-				    {
-				      return S_SUCCESS;
-				    }
+				  scan_end_scan (thread_p, &xptr3->curr_spec->s_id);
 				}
+			      xptr3->curr_spec->curent = NULL;
+			      xptr3->curr_spec = NULL;
+			      xptr3->next_scan_block_on = false;
 			    }
+			  return S_END;
 			}
 		      else
-			{	/* handle the scan procedure */
-			  /* current scan block has at least one qualified item */
-			  xasl->curr_spec->s_id.qualified_block = true;
-
-			  /* handle the scan procedure */
-			  xasl->scan_ptr->next_scan_on = false;
-			  if (scan_reset_scan_block (thread_p, &xasl->scan_ptr->curr_spec->s_id) == S_ERROR)
-			    {
-			      return S_ERROR;
-			    }
-
-			  xasl->next_scan_on = true;
-
-
-			  while ((xs_scan = (*next_scan_fnc) (thread_p, xasl->scan_ptr, xasl_state, tplrec,
-							      next_scan_fnc + 1)) == S_SUCCESS)
-			    {
-
-			      /* if hierarchical query do special processing */
-			      if (XASL_IS_FLAGED (xasl, XASL_HAS_CONNECT_BY))
-				{
-				  if (qexec_update_connect_by_lists (thread_p, xasl->connect_by_ptr, xasl_state, tplrec)
-				      != NO_ERROR)
-				    {
-				      return S_ERROR;
-				    }
-				}
-			      else
-				{
-				  /* evaluate inst_num predicate */
-				  if (xasl->instnum_val)
-				    {
-				      ev_res = qexec_eval_instnum_pred (thread_p, xasl, xasl_state);
-				      if (ev_res == V_ERROR)
-					{
-					  return S_ERROR;
-					}
-
-				      if ((xasl->instnum_flag & XASL_INSTNUM_FLAG_SCAN_LAST_STOP))
-					{
-					  if (qexec_end_one_iteration (thread_p, xasl, xasl_state, tplrec) != NO_ERROR)
-					    {
-					      return S_ERROR;
-					    }
-
-					  return S_SUCCESS;
-					}
-
-				      if (xasl->instnum_flag & XASL_INSTNUM_FLAG_SCAN_STOP)
-					{
-					  return S_SUCCESS;
-					}
-				    }
-
-				  qualified = (xasl->instnum_pred == NULL || ev_res == V_TRUE);
-				  if (qualified)
-				    {
-				      /* one iteration successfully completed */
-				      if (qexec_end_one_iteration (thread_p, xasl, xasl_state, tplrec) != NO_ERROR)
-					{
-					  return S_ERROR;
-					}
-				      /* only one row is need for exists OP */
-				      if (XASL_IS_FLAGED (xasl, XASL_NEED_SINGLE_TUPLE_SCAN))
-					{
-					  return S_SUCCESS;
-					}
-				    }
-				}
-			    }
-
-			  if (xs_scan != S_END)	/* an error happened */
-			    {
-			      return S_ERROR;
-			    }
+			{
+			  return S_ERROR;
 			}
 		    }
 		}
 	    }
+	  else if (xs_scan2 == S_ERROR)
+	    {
+	      return S_ERROR;
+	    }
 
-	  qexec_clear_all_lists (thread_p, xasl);
-	}
-
-      if (max_recursive_iterations_reached)
-	{
-	  xb_scan = S_ERROR;
-	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_CTE_MAX_RECURSION_REACHED, 1, xasl->max_iterations);
-	  break;
 	}
-
-      if (ls_scan != S_END)	/* an error happened */
+      else			/* last scan successfully moved */
 	{
-	  return S_ERROR;
+	  if (scan_reset_scan_block (thread_p, &prev_xptr->curr_spec->s_id) == S_ERROR)
+	    {
+	      return S_ERROR;
+	    }
 	}
-    }
-
-  if (xb_scan != S_END)		/* an error happened */
-    {
-      return S_ERROR;
-    }
 
-  return S_SUCCESS;
+      /* make previous scan the last scan ptr */
+      last_xptr = prev_xptr;
+    }				/* while */
 
-#undef CTE_CURRENT_SCAN_READ_TUPLE
-#undef CTE_CURR_ITERATION_LAST_TUPLE
+  /* return the status of the first XASL block */
+  return (xasl->curr_spec) ? S_SUCCESS : S_END;
 }
 
 /*
- * qexec_merge_fnc () -
- *   return: scan code
- *   xasl(in)   : XASL Tree pointer
- *   xasl_state(in)     : XASL Tree state information
- *   tplrec(out) : Tuple record descriptor to store result tuples
- *
- * Note: This function is used to interpret an XASL merge command
- * tree block. It assumes a general format XASL block
- * with all possible representations.
+ * qexec_execute_scan () -
+ *   return: SCAN_CODE (S_SUCCESS, S_END, S_ERROR)
+ *   xasl(in)   : XASL Tree block
+ *   xasl_state(in)     : XASL tree state information
+ *   next_scan_fnc(in)  : Function to interpret following scan block
+ *
+ * Note: This routine executes one iteration on a scan operation on
+ * the given XASL tree block. If end_of_scan is reached, it
+ * return S_END. If an error occurs, it returns
+ * S_ERROR. Each scan procedure block may have its own scan
+ * procedures forming a path of scan procedure blocks. Thus, for
+ * each scan procedure block interpretation, if there are already
+ * active scan procedures started from that block, first their
+ * execution is requested. Only if all of the following scan
+ * procedures come to an end returning S_END, then the
+ * current scan procedure scan item is advanced. When this scan
+ * procedure too come to an end, it returns S_END to the
+ * caller, indicating that there are no more scan items in the
+ * path of the scan procedure blocks.
+ *
+ * Note: This function is the general scan block interpretation function.
  */
 static SCAN_CODE
-qexec_merge_fnc (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state, QFILE_TUPLE_RECORD * tplrec,
-		 XASL_SCAN_FNC_PTR ignore)
+qexec_execute_scan (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state, QFILE_TUPLE_RECORD * ignore,
+		    XASL_SCAN_FNC_PTR next_scan_fnc)
 {
   XASL_NODE *xptr;
+  SCAN_CODE sc_scan;
+  SCAN_CODE xs_scan;
   DB_LOGICAL ev_res;
   int qualified;
-  SCAN_CODE ls_scan1;		/* first list file scan counter */
-  SCAN_CODE ls_scan2;		/* second list file scan counter */
-  SCAN_ID *s_id1;		/* first list file scan identifier */
-  SCAN_ID *s_id2;		/* second list file scan identifier */
-  ACCESS_SPEC_TYPE *spec;
-
-  /* set first scan parameters */
-  s_id1 = &xasl->spec_list->s_id;
-  /* set second scan parameters */
-  s_id2 = &xasl->merge_spec->s_id;
-
-  if ((!s_id1)
-      || ((s_id1->type == S_LIST_SCAN)
-	  && ((!s_id1->s.llsid.list_id) || (s_id1->s.llsid.list_id->type_list.type_cnt == 0))))
-    {
-      GOTO_EXIT_ON_ERROR;
-    }
+  SCAN_OPERATION_TYPE scan_operation_type;
 
-  if ((!s_id2)
-      || ((s_id2->type == S_LIST_SCAN)
-	  && ((!s_id2->s.llsid.list_id) || (s_id2->s.llsid.list_id->type_list.type_cnt == 0))))
+  /* check if further scan procedure are still active */
+  if (xasl->scan_ptr && xasl->next_scan_on)
     {
-      GOTO_EXIT_ON_ERROR;
-    }
+      xs_scan = (*next_scan_fnc) (thread_p, xasl->scan_ptr, xasl_state, ignore, next_scan_fnc + 1);
+      if (xs_scan != S_END)
+	{
+	  return xs_scan;
+	}
 
-  spec = xasl->merge_spec;
-  if (qexec_next_merge_block (thread_p, &spec) != S_SUCCESS)
-    {
-      GOTO_EXIT_ON_ERROR;
+      xasl->next_scan_on = false;
     }
 
-  while ((ls_scan1 = qexec_next_scan_block (thread_p, xasl)) == S_SUCCESS)
+  do
     {
-      while ((ls_scan1 = scan_next_scan (thread_p, s_id1)) == S_SUCCESS)
+      sc_scan = scan_next_scan (thread_p, &xasl->curr_spec->s_id);
+      if (sc_scan != S_SUCCESS)
 	{
-	  ls_scan2 = scan_next_scan (thread_p, s_id2);
-	  if (ls_scan2 == S_ERROR)
-	    {
-	      GOTO_EXIT_ON_ERROR;
-	    }
+	  return sc_scan;
+	}
 
-	  if (ls_scan2 == S_END)
+      /* set scan item as qualified */
+      qualified = true;
+
+      if (qualified)
+	{
+	  /* clear bptr subquery list files */
+	  if (xasl->bptr_list)
 	    {
-	      if (qexec_next_merge_block (thread_p, &spec) != S_SUCCESS)
+	      qexec_clear_head_lists (thread_p, xasl->bptr_list);
+	      if (xasl->curr_spec->flags & ACCESS_SPEC_FLAG_FOR_UPDATE)
 		{
-		  GOTO_EXIT_ON_ERROR;
+		  scan_operation_type = S_UPDATE;
 		}
-
-	      ls_scan2 = scan_next_scan (thread_p, s_id2);
-	      if (ls_scan2 == S_ERROR)
+	      else
 		{
-		  GOTO_EXIT_ON_ERROR;
+		  scan_operation_type = S_SELECT;
 		}
 	    }
-
-	  /* set scan item as qualified */
-	  qualified = true;
-
 	  /* evaluate bptr list */
-	  /* if path expression fetch fails, this instance disqualifies */
 	  for (xptr = xasl->bptr_list; qualified && xptr != NULL; xptr = xptr->next)
 	    {
-	      if (qexec_execute_obj_fetch (thread_p, xptr, xasl_state, S_SELECT) != NO_ERROR)
+	      if (qexec_execute_obj_fetch (thread_p, xptr, xasl_state, scan_operation_type) != NO_ERROR)
 		{
-		  GOTO_EXIT_ON_ERROR;
+		  return S_ERROR;
 		}
 	      else if (xptr->proc.fetch.fetch_res == false)
 		{
 		  qualified = false;
 		}
 	    }
+	}			/* if (qualified) */
 
-	  if (qualified)
+      if (qualified)
+	{
+	  /* evaluate dptr list */
+	  for (xptr = xasl->dptr_list; xptr != NULL; xptr = xptr->next)
 	    {
-	      /* evaluate dptr list */
-	      for (xptr = xasl->dptr_list; xptr != NULL; xptr = xptr->next)
+	      /* clear correlated subquery list files */
+	      qexec_clear_head_lists (thread_p, xptr);
+	      if (XASL_IS_FLAGED (xptr, XASL_LINK_TO_REGU_VARIABLE))
 		{
-		  /* clear correlated subquery list files */
-		  qexec_clear_head_lists (thread_p, xptr);
-		  if (XASL_IS_FLAGED (xptr, XASL_LINK_TO_REGU_VARIABLE))
-		    {
-		      /* skip if linked to regu var */
-		      continue;
-		    }
-		  if (qexec_execute_mainblock (thread_p, xptr, xasl_state, NULL) != NO_ERROR)
-		    {
-		      GOTO_EXIT_ON_ERROR;
-		    }
+		  /* skip if linked to regu var */
+		  continue;
 		}
-
-	      /* evaluate if predicate */
-	      ev_res = V_UNKNOWN;
-	      if (xasl->if_pred != NULL)
+	      if (qexec_execute_mainblock (thread_p, xptr, xasl_state, NULL) != NO_ERROR)
 		{
-		  ev_res = eval_pred (thread_p, xasl->if_pred, &xasl_state->vd, NULL);
-		  if (ev_res == V_ERROR)
-		    {
-		      GOTO_EXIT_ON_ERROR;
-		    }
+		  return S_ERROR;
 		}
+	    }
+	}			/* if (qualified) */
 
-	      qualified = (xasl->if_pred == NULL || ev_res == V_TRUE);
-	      if (qualified)
+      if (qualified)
+	{
+	  /* evaluate after join predicate */
+	  ev_res = V_UNKNOWN;
+	  if (xasl->after_join_pred != NULL)
+	    {
+	      ev_res = eval_pred (thread_p, xasl->after_join_pred, &xasl_state->vd, NULL);
+	      if (ev_res == V_ERROR)
 		{
-		  /* evaluate fptr list */
-		  for (xptr = xasl->fptr_list; qualified && xptr != NULL; xptr = xptr->next)
-		    {
-		      if (qexec_execute_obj_fetch (thread_p, xptr, xasl_state, S_SELECT) != NO_ERROR)
-			{
-			  GOTO_EXIT_ON_ERROR;
-			}
-		      else if (xptr->proc.fetch.fetch_res == false)
-			{
-			  qualified = false;
-			}
-		    }
-
-		  if (qualified)
-		    {
-		      if (!xasl->scan_ptr)
-			{	/* no scan procedure block */
-			  /* evaluate inst_num predicate */
-			  if (xasl->instnum_val)
-			    {
-			      ev_res = qexec_eval_instnum_pred (thread_p, xasl, xasl_state);
-			      if (ev_res == V_ERROR)
-				{
-				  return S_ERROR;
-				}
-			      if (xasl->instnum_flag & XASL_INSTNUM_FLAG_SCAN_STOP)
-				{
-				  scan_end_scan (thread_p, s_id1);
-				  scan_end_scan (thread_p, s_id2);
-				  return S_SUCCESS;
-				}
-			    }	/* if (xasl->instnum_val) */
-			  qualified = (xasl->instnum_pred == NULL || ev_res == V_TRUE);
+		  return S_ERROR;
+		}
+	    }
+	  qualified = (xasl->after_join_pred == NULL || ev_res == V_TRUE);
+	}			/* if (qualified) */
 
-			  if (qualified && qexec_end_one_iteration (thread_p, xasl, xasl_state, tplrec) != NO_ERROR)
-			    {
-			      return S_ERROR;
-			    }
-			}	/* handle the scan procedure */
-		    }
+      if (qualified)
+	{
+	  /* evaluate if predicate */
+	  ev_res = V_UNKNOWN;
+	  if (xasl->if_pred != NULL)
+	    {
+	      ev_res = eval_pred (thread_p, xasl->if_pred, &xasl_state->vd, NULL);
+	      if (ev_res == V_ERROR)
+		{
+		  return S_ERROR;
 		}
 	    }
-	}
+	  qualified = (xasl->if_pred == NULL || ev_res == V_TRUE);
+	}			/* if (qualified) */
 
-      if (ls_scan1 == S_ERROR)
+      if (qualified)
 	{
-	  GOTO_EXIT_ON_ERROR;
-	}
-    }
+	  /* clear fptr subquery list files */
+	  if (xasl->fptr_list)
+	    {
+	      qexec_clear_head_lists (thread_p, xasl->fptr_list);
+	      if (xasl->curr_spec->flags & ACCESS_SPEC_FLAG_FOR_UPDATE)
+		{
+		  scan_operation_type = S_UPDATE;
+		}
+	      else
+		{
+		  scan_operation_type = S_SELECT;
+		}
+	    }
+	  /* evaluate fptr list */
+	  for (xptr = xasl->fptr_list; qualified && xptr != NULL; xptr = xptr->next)
+	    {
+	      if (qexec_execute_obj_fetch (thread_p, xptr, xasl_state, scan_operation_type) != NO_ERROR)
+		{
+		  return S_ERROR;
+		}
+	      else if (xptr->proc.fetch.fetch_res == false)
+		{
+		  qualified = false;
+		}
+	    }
+	}			/* if (qualified) */
 
-  if (ls_scan1 == S_ERROR)
-    {
-      GOTO_EXIT_ON_ERROR;
-    }
+      if (qualified)
+	{
+	  if (!xasl->scan_ptr)
+	    {
+	      /* no scan procedure block */
+	      return S_SUCCESS;
+	    }
+	  else
+	    {
+	      /* current scan block has at least one qualified item */
+	      xasl->curr_spec->s_id.qualified_block = true;
 
-  scan_end_scan (thread_p, s_id1);
-  scan_end_scan (thread_p, s_id2);
-  return S_SUCCESS;
+	      /* start following scan procedure */
+	      xasl->scan_ptr->next_scan_on = false;
+	      if (scan_reset_scan_block (thread_p, &xasl->scan_ptr->curr_spec->s_id) == S_ERROR)
+		{
+		  return S_ERROR;
+		}
+
+	      xasl->next_scan_on = true;
+
+	      /* execute following scan procedure */
+	      xs_scan = (*next_scan_fnc) (thread_p, xasl->scan_ptr, xasl_state, ignore, next_scan_fnc + 1);
+	      if (xs_scan == S_END)
+		{
+		  xasl->next_scan_on = false;
+		}
+	      else
+		{
+		  return xs_scan;
+		}
+	    }
+	}			/* if (qualified) */
+
+    }
+  while (1);
 
-exit_on_error:
-  scan_end_scan (thread_p, s_id1);
-  scan_end_scan (thread_p, s_id2);
-  scan_close_scan (thread_p, s_id1);
-  scan_close_scan (thread_p, s_id2);
-  return S_ERROR;
 }
 
 /*
- * qexec_setup_list_id () -
- *   return: NO_ERROR, or ER_code
- *   xasl(in)   : XASL Tree block
- *
- * Note: This routine is used by update/delete/insert to set up a
- * type_list. Copying a list_id structure fails unless it has a type list.
+ * qexec_reset_regu_variable_list () - reset value cache for a list of regu
+ *				       variables
+ * return : void
+ * list (in) : regu variable list
  */
-static int
-qexec_setup_list_id (THREAD_ENTRY * thread_p, XASL_NODE * xasl)
+static void
+qexec_reset_regu_variable_list (REGU_VARIABLE_LIST list)
 {
-  QFILE_LIST_ID *list_id;
-
-  list_id = xasl->list_id;
-  list_id->tuple_cnt = 0;
-  list_id->page_cnt = 0;
+  REGU_VARIABLE_LIST var = list;
 
-  /* For streaming queries, set last_pgptr->next_vpid to NULL */
-  if (list_id->last_pgptr != NULL)
+  while (var != NULL)
     {
-      QFILE_PUT_NEXT_VPID_NULL (list_id->last_pgptr);
+      qexec_reset_regu_variable (&var->value);
+      var = var->next;
     }
+}
 
-  list_id->last_pgptr = NULL;	/* don't want qfile_close_list() to free this bogus listid */
-  list_id->type_list.type_cnt = 1;
-  list_id->type_list.domp = (TP_DOMAIN **) malloc (list_id->type_list.type_cnt * sizeof (TP_DOMAIN *));
-  if (list_id->type_list.domp == NULL)
+/*
+ * qexec_reset_pred_expr () - reset value cache for a pred expr
+ * return : void
+ * pred (in) : pred expr
+ */
+static void
+qexec_reset_pred_expr (PRED_EXPR * pred)
+{
+  if (pred == NULL)
     {
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
-	      list_id->type_list.type_cnt * sizeof (TP_DOMAIN *));
-      return ER_OUT_OF_VIRTUAL_MEMORY;
+      return;
     }
-  /* set up to return object domains in case we want to return the updated/inserted/deleted oid's */
-  list_id->type_list.domp[0] = &tp_Object_domain;
-
-  if (xasl->type == INSERT_PROC && XASL_IS_FLAGED (xasl, XASL_RETURN_GENERATED_KEYS))
+  switch (pred->type)
     {
-      list_id->tfile_vfid = qmgr_create_new_temp_file (thread_p, list_id->query_id, TEMP_FILE_MEMBUF_NORMAL);
-      if (list_id->tfile_vfid == NULL)
+    case T_PRED:
+      qexec_reset_pred_expr (pred->pe.m_pred.lhs);
+      qexec_reset_pred_expr (pred->pe.m_pred.rhs);
+      break;
+    case T_EVAL_TERM:
+      switch (pred->pe.m_eval_term.et_type)
 	{
-	  return ER_FAILED;
+	case T_COMP_EVAL_TERM:
+	  {
+	    COMP_EVAL_TERM *et_comp = &pred->pe.m_eval_term.et.et_comp;
+
+	    qexec_reset_regu_variable (et_comp->lhs);
+	    qexec_reset_regu_variable (et_comp->rhs);
+	  }
+	  break;
+	case T_ALSM_EVAL_TERM:
+	  {
+	    ALSM_EVAL_TERM *et_alsm = &pred->pe.m_eval_term.et.et_alsm;
+
+	    qexec_reset_regu_variable (et_alsm->elem);
+	    qexec_reset_regu_variable (et_alsm->elemset);
+	  }
+	  break;
+	case T_LIKE_EVAL_TERM:
+	  {
+	    LIKE_EVAL_TERM *et_like = &pred->pe.m_eval_term.et.et_like;
+
+	    qexec_reset_regu_variable (et_like->src);
+	    qexec_reset_regu_variable (et_like->pattern);
+	    qexec_reset_regu_variable (et_like->esc_char);
+	  }
+	  break;
+	case T_RLIKE_EVAL_TERM:
+	  {
+	    RLIKE_EVAL_TERM *et_rlike = &pred->pe.m_eval_term.et.et_rlike;
+	    qexec_reset_regu_variable (et_rlike->case_sensitive);
+	    qexec_reset_regu_variable (et_rlike->pattern);
+	    qexec_reset_regu_variable (et_rlike->src);
+	  }
 	}
-      VFID_COPY (&(list_id->temp_vfid), &(list_id->tfile_vfid->temp_vfid));
+      break;
+    case T_NOT_TERM:
+      qexec_reset_pred_expr (pred->pe.m_not_term);
+      break;
     }
+}
 
-  assert (list_id->type_list.type_cnt == 1);
-  qfile_update_qlist_count (thread_p, list_id, 1);
+/*
+ * qexec_reset_regu_variable () - reset the cache for a regu variable
+ * return : void
+ * var (in) : regu variable
+ */
+static void
+qexec_reset_regu_variable (REGU_VARIABLE * var)
+{
+  if (var == NULL)
+    {
+      return;
+    }
 
-  return NO_ERROR;
+  switch (var->type)
+    {
+    case TYPE_ATTR_ID:
+    case TYPE_SHARED_ATTR_ID:
+    case TYPE_CLASS_ATTR_ID:
+      var->value.attr_descr.cache_dbvalp = NULL;
+      break;
+    case TYPE_INARITH:
+    case TYPE_OUTARITH:
+      qexec_reset_regu_variable (var->value.arithptr->leftptr);
+      qexec_reset_regu_variable (var->value.arithptr->rightptr);
+      qexec_reset_regu_variable (var->value.arithptr->thirdptr);
+      /* use arithptr */
+      break;
+    case TYPE_FUNC:
+      /* use funcp */
+      qexec_reset_regu_variable_list (var->value.funcp->operand);
+      break;
+    default:
+      break;
+    }
 }
 
 /*
- * qexec_init_upddel_ehash_files () - Initializes the hash files used for
- *				       duplicate OIDs elimination.
- *   return: NO_ERROR, or ER_code
- *   thread_p(in):
- *   buildlist(in): BUILDLIST_PROC XASL
- *
- * Note: The function is used only for SELECT statement generated for
- *	 UPDATE/DELETE. The case of SINGLE-UPDATE/SINGLE-DELETE is skipped.
+ * qexec_prune_spec () - perform partition pruning on an access spec
+ * return : error code or NO_ERROR
+ * thread_p (in) :
+ * spec (in) :
+ * vd (in) :
+ * scan_op_type (in) :
  */
 static int
-qexec_init_upddel_ehash_files (THREAD_ENTRY * thread_p, XASL_NODE * buildlist)
+qexec_prune_spec (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * spec, VAL_DESCR * vd, SCAN_OPERATION_TYPE scan_op_type)
 {
-  int idx;
-  EHID *hash_list = NULL;
+  PARTITION_SPEC_TYPE *partition_spec = NULL;
+  LOCK lock = NULL_LOCK;
+  int granted;
+  int error = NO_ERROR;
 
-  if (buildlist == NULL || buildlist->type != BUILDLIST_PROC)
+  if (spec == NULL || spec->pruned)
     {
       return NO_ERROR;
     }
-
-  hash_list = (EHID *) db_private_alloc (thread_p, buildlist->upd_del_class_cnt * sizeof (EHID));
-  if (hash_list == NULL)
+  else if (spec->pruning_type != DB_PARTITIONED_CLASS)
     {
-      goto exit_on_error;
+      spec->pruned = true;
+      return NO_ERROR;
     }
 
-  for (idx = 0; idx < buildlist->upd_del_class_cnt; idx++)
+  error = partition_prune_spec (thread_p, vd, spec);
+  if (error != NO_ERROR)
     {
-      hash_list[idx].vfid.volid = LOG_DBFIRST_VOLID;
-      if (xehash_create (thread_p, &hash_list[idx], DB_TYPE_OBJECT, -1, NULL, 0, true) == NULL)
-	{
-	  goto exit_on_error;
-	}
+      ASSERT_ERROR ();
+      return error;
     }
-  buildlist->proc.buildlist.upddel_oid_locator_ehids = hash_list;
 
-  return NO_ERROR;
+  if (!COMPOSITE_LOCK (scan_op_type) && !(spec->flags & ACCESS_SPEC_FLAG_FOR_UPDATE))
+    {
+      lock = IS_LOCK;
+    }
+  else
+    {
+      /* MVCC use IX_LOCK on class at update/delete */
+      lock = IX_LOCK;
+    }
 
-exit_on_error:
-  if (hash_list != NULL)
+  for (partition_spec = spec->parts; partition_spec != NULL; partition_spec = partition_spec->next)
     {
-      for (--idx; idx >= 0; idx--)
+      granted = lock_subclass (thread_p, &partition_spec->oid, &ACCESS_SPEC_CLS_OID (spec), lock, LK_UNCOND_LOCK);
+      if (granted != LK_GRANTED)
 	{
-	  xehash_destroy (thread_p, &hash_list[idx]);
+	  ASSERT_ERROR_AND_SET (error);
+	  return error;
 	}
-      db_private_free (thread_p, hash_list);
     }
 
-  return ER_FAILED;
+  return NO_ERROR;
 }
 
 /*
- * qexec_destroy_upddel_ehash_files () - Destroys the hash files used for
- *					 duplicate rows elimination in
- *					 UPDATE/DELETE.
- *   return: void
- *   thread_p(in):
- *   buildlist(in): BUILDLIST_PROC XASL
- *
- * Note: The function is used only for SELECT statement generated for
- *	 UPDATE/DELETE.
+ * qexec_init_next_partition () - move to the next partition in the list
+ * return : S_END if there are no more partitions, S_SUCCESS on success,
+ *	    S_ERROR on error
+ * thread_p (in) :
+ * spec (in)	 : spec for which to move to the next partition
  */
-static void
-qexec_destroy_upddel_ehash_files (THREAD_ENTRY * thread_p, XASL_NODE * buildlist)
+static SCAN_CODE
+qexec_init_next_partition (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * spec)
 {
-  int idx;
-  bool save_interrupted;
-  EHID *hash_list = buildlist->proc.buildlist.upddel_oid_locator_ehids;
-
-  save_interrupted = logtb_set_check_interrupt (thread_p, false);
-
-  for (idx = 0; idx < buildlist->upd_del_class_cnt; idx++)
-    {
-      if (xehash_destroy (thread_p, &hash_list[idx]) != NO_ERROR)
-	{
-	  /* should not fail or we'll leak reserved sectors */
-	  assert (false);
-	}
-    }
-  db_private_free (thread_p, hash_list);
-  buildlist->proc.buildlist.upddel_oid_locator_ehids = NULL;
-
-  (void) logtb_set_check_interrupt (thread_p, save_interrupted);
-}
-
-/*
- * qexec_mvcc_cond_reev_set_scan_order () - link classes for condition
- *					    reevaluation in scan order (from
- *					    outer to inner)
- *   return: list head
- *   aptr(in): XASL for generated SELECT statement for UPDATE
- *   buildlist(in): BUILDLIST_PROC XASL
- *   reev_classes(in): array of classes for reevaluation
- *   num_reev_classes(in): no of classes for reevaluation
- *   classes(in): classes to be updated
- *   num_classes(in): no of classes to be updated
- */
-static UPDDEL_MVCC_COND_REEVAL *
-qexec_mvcc_cond_reev_set_scan_order (XASL_NODE * aptr, UPDDEL_MVCC_COND_REEVAL * reev_classes, int num_reev_classes,
-				     UPDDEL_CLASS_INFO * classes, int num_classes)
-{
-  int idx, idx2, idx3;
-  ACCESS_SPEC_TYPE *access_spec = NULL;
-  UPDDEL_MVCC_COND_REEVAL *scan_elem = NULL, *scan_start = NULL;
-  int *mvcc_extra_assign_reev = NULL;
+  int error = NO_ERROR;
+  SCAN_OPERATION_TYPE scan_op_type = spec->s_id.scan_op_type;
+  bool mvcc_select_lock_needed = spec->s_id.mvcc_select_lock_needed;
+  int fixed = spec->s_id.fixed;
+  int grouped = spec->s_id.grouped;
+  QPROC_SINGLE_FETCH single_fetch = spec->s_id.single_fetch;
+  VAL_LIST *val_list = spec->s_id.val_list;
+  VAL_DESCR *vd = spec->s_id.vd;
+  bool iscan_oid_order = spec->s_id.s.isid.iscan_oid_order;
+  INDX_INFO *idxptr = NULL;
+  QUERY_ID query_id = spec->s_id.s.isid.indx_cov.query_id;
+  OID class_oid;
+  HFID class_hfid;
+  BTID btid;
 
-  if (reev_classes == NULL || num_reev_classes <= 0)
-    {
-      return NULL;
-    }
-  for (; aptr != NULL; aptr = aptr->scan_ptr)
+  if (spec->type != TARGET_CLASS && spec->type != TARGET_CLASS_ATTR)
     {
-      for (access_spec = aptr->spec_list; access_spec != NULL; access_spec = access_spec->next)
-	{
-	  for (idx = num_reev_classes - 1; idx >= 0; idx--)
-	    {
-	      if (OID_EQ (&access_spec->s.cls_node.cls_oid, &reev_classes[idx].cls_oid))
-		{
-		  /* check that this class is not an assignment reevaluation class */
-		  for (idx2 = 0; idx2 < num_classes; idx2++)
-		    {
-		      mvcc_extra_assign_reev = classes[idx2].mvcc_extra_assign_reev;
-		      for (idx3 = classes[idx2].num_extra_assign_reev - 1; idx3 >= 0; idx3--)
-			{
-			  if (mvcc_extra_assign_reev[idx3] == reev_classes[idx].class_index)
-			    {
-			      break;
-			    }
-			}
-		      if (idx3 >= 0)
-			{
-			  break;
-			}
-		    }
-		  if (idx2 < num_classes)
-		    {
-		      continue;
-		    }
-
-		  /* if this class is not an assignment reevaluation class then add to the list */
-		  if (scan_elem == NULL)
-		    {
-		      scan_elem = scan_start = &reev_classes[idx];
-		    }
-		  else
-		    {
-		      scan_elem->next = &reev_classes[idx];
-		      scan_elem = scan_elem->next;
-		    }
-		  break;
-		}
-	    }
-	  if (idx >= 0)
-	    {
-	      break;
-	    }
-	}
+      return S_END;
     }
 
-  return scan_start;
-}
-
-/*
- * prepare_mvcc_reev_data () - create and initialize structures for MVCC
- *			       condition and assignments reevaluation
- * return : error code or NO_ERROR
- * thread_p (in) :
- * aptr (in): XASL for generated SELECT statement for UPDATE
- * num_reev_classes (in): no of indexes for classes used in reevaluation
- * mvcc_reev_indexes (in) : array of indexes for classes used in reevaluation
- * reev_data (in) : MVCC reevaluation data for a specific class
- * num_classes (in) : no. of assignments 'classes' elements
- * classes(in): array of classes to be updated
- * internal_classes (in) : array of information for each class that will be
- *			   updated
- * cons_pred(in): NOT NULL contraints predicate
- * mvcc_reev_classes(in/out): array of classes information used in MVCC
- *			      reevaluation
- * mvcc_reev_assigns(in/out): array of assignments information used in
- *			      reevaluation
- * has_delete (in):
- */
-static int
-prepare_mvcc_reev_data (THREAD_ENTRY * thread_p, XASL_NODE * aptr, XASL_STATE * xasl_state, int num_reev_classes,
-			int *mvcc_reev_indexes, MVCC_UPDDEL_REEV_DATA * reev_data, int num_classes,
-			UPDDEL_CLASS_INFO * classes, UPDDEL_CLASS_INFO_INTERNAL * internal_classes, int num_assigns,
-			UPDATE_ASSIGNMENT * assigns, PRED_EXPR * cons_pred,
-			UPDDEL_MVCC_COND_REEVAL ** mvcc_reev_classes, UPDATE_MVCC_REEV_ASSIGNMENT ** mvcc_reev_assigns,
-			bool has_delete)
-{
-  UPDDEL_MVCC_COND_REEVAL *cond_reev_classes = NULL, *cond_reev_class = NULL;
-  UPDDEL_CLASS_INFO *cls = NULL;
-  UPDDEL_CLASS_INFO_INTERNAL *int_cls = NULL;
-  int idx, idx2, idx3;
-
-  if (reev_data == NULL)
+  if (spec->parts == NULL)
     {
-      assert (0);
-      return ER_FAILED;
+      return S_END;
     }
 
-  /* Make sure reev data is initialized, or else it will crash later */
-  memset (reev_data, 0, sizeof (MVCC_UPDDEL_REEV_DATA));
-
-  if (num_reev_classes == 0)
+  if (spec->curent == NULL)
     {
-      return NO_ERROR;
+      spec->curent = spec->parts;
     }
-
-  if (mvcc_reev_classes == NULL)
+  else
     {
-      GOTO_EXIT_ON_ERROR;
+      if (spec->curent->next == NULL)
+	{
+	  /* no more partitions */
+	  spec->curent = NULL;
+	}
+      else
+	{
+	  spec->curent = spec->curent->next;
+	}
     }
+  /* close current scan and open a new one on the next partition */
+  scan_end_scan (thread_p, &spec->s_id);
+  scan_close_scan (thread_p, &spec->s_id);
 
-  /* allocate and initialize classes for reevaluation */
-  cond_reev_classes =
-    (UPDDEL_MVCC_COND_REEVAL *) db_private_alloc (thread_p, sizeof (UPDDEL_MVCC_COND_REEVAL) * num_reev_classes);
-  if (cond_reev_classes == NULL)
+  /* we also need to reset caches for attributes */
+  qexec_reset_regu_variable_list (spec->s.cls_node.cls_regu_list_pred);
+  qexec_reset_regu_variable_list (spec->s.cls_node.cls_regu_list_rest);
+  qexec_reset_regu_variable_list (spec->s.cls_node.cls_regu_list_key);
+  qexec_reset_pred_expr (spec->where_pred);
+  qexec_reset_pred_expr (spec->where_key);
+
+  if (spec->curent == NULL)
     {
-      GOTO_EXIT_ON_ERROR;
+      /* reset back to root class */
+      COPY_OID (&class_oid, &ACCESS_SPEC_CLS_OID (spec));
+      HFID_COPY (&class_hfid, &ACCESS_SPEC_HFID (spec));
+      if (IS_ANY_INDEX_ACCESS (spec->access))
+	{
+	  btid = spec->btid;
+	}
     }
-  /* init information for reevaluation */
-  for (idx = 0; idx < num_reev_classes; idx++)
+  else
     {
-      cond_reev_class = &cond_reev_classes[idx];
-      cond_reev_class->class_index = mvcc_reev_indexes[idx];
-      OID_SET_NULL (&cond_reev_class->cls_oid);
-      cond_reev_class->inst_oid = NULL;
-      cond_reev_class->rest_attrs = NULL;
-      cond_reev_class->rest_regu_list = NULL;
-      cond_reev_class->next = NULL;
+      COPY_OID (&class_oid, &spec->curent->oid);
+      HFID_COPY (&class_hfid, &spec->curent->hfid);
+      if (IS_ANY_INDEX_ACCESS (spec->access))
+	{
+	  btid = spec->curent->btid;
+	}
     }
-  for (idx = 0; idx < num_classes; idx++)
+  if (spec->type == TARGET_CLASS
+      && (spec->access == ACCESS_METHOD_SEQUENTIAL || spec->access == ACCESS_METHOD_SEQUENTIAL_RECORD_INFO))
     {
-      cls = &classes[idx];
-      int_cls = &internal_classes[idx];
-      if (cls->num_extra_assign_reev > 0)
+      HEAP_SCAN_ID *hsidp = &spec->s_id.s.hsid;
+      SCAN_TYPE scan_type = (spec->access == ACCESS_METHOD_SEQUENTIAL) ? S_HEAP_SCAN : S_HEAP_SCAN_RECORD_INFO;
+      int i = 0;
+      if (hsidp->caches_inited)
 	{
-	  int_cls->mvcc_extra_assign_reev =
-	    (UPDDEL_MVCC_COND_REEVAL **) db_private_alloc (thread_p,
-							   cls->num_extra_assign_reev
-							   * sizeof (UPDDEL_MVCC_COND_REEVAL *));
-	  if (int_cls->mvcc_extra_assign_reev == NULL)
-	    {
-	      GOTO_EXIT_ON_ERROR;
-	    }
-	  for (idx2 = cls->num_extra_assign_reev - 1; idx2 >= 0; idx2--)
+	  heap_attrinfo_end (thread_p, hsidp->pred_attrs.attr_cache);
+	  heap_attrinfo_end (thread_p, hsidp->rest_attrs.attr_cache);
+	  if (hsidp->cache_recordinfo != NULL)
 	    {
-	      for (idx3 = 0; idx3 < num_reev_classes; idx3++)
+	      for (i = 0; i < HEAP_RECORD_INFO_COUNT; i++)
 		{
-		  if (cond_reev_classes[idx3].class_index == cls->mvcc_extra_assign_reev[idx2])
-		    {
-		      int_cls->mvcc_extra_assign_reev[idx2] = &cond_reev_classes[idx3];
-		      break;
-		    }
+		  pr_clear_value (hsidp->cache_recordinfo[i]);
 		}
 	    }
-	  int_cls->extra_assign_reev_cnt = cls->num_extra_assign_reev;
+	  hsidp->caches_inited = false;
 	}
-    }
-  reev_data->mvcc_cond_reev_list = NULL;
-  reev_data->curr_extra_assign_cnt = 0;
-  reev_data->curr_extra_assign_reev = NULL;
-  reev_data->curr_assigns = NULL;
-  reev_data->curr_attrinfo = NULL;
-  reev_data->copyarea = NULL;
-  reev_data->cons_pred = cons_pred;
-  reev_data->vd = &xasl_state->vd;
+      hsidp->scancache_inited = false;
 
-  if (qexec_create_mvcc_reev_assignments (thread_p, aptr, has_delete, internal_classes, num_classes, num_assigns,
-					  assigns, mvcc_reev_assigns) != NO_ERROR)
-    {
-      GOTO_EXIT_ON_ERROR;
+      error =
+	scan_open_heap_scan (thread_p, &spec->s_id, mvcc_select_lock_needed, scan_op_type, fixed, grouped, single_fetch,
+			     spec->s_dbval, val_list, vd, &class_oid, &class_hfid, spec->s.cls_node.cls_regu_list_pred,
+			     spec->where_pred, spec->s.cls_node.cls_regu_list_rest,
+			     spec->s.cls_node.num_attrs_pred, spec->s.cls_node.attrids_pred,
+			     spec->s.cls_node.cache_pred, spec->s.cls_node.num_attrs_rest,
+			     spec->s.cls_node.attrids_rest, spec->s.cls_node.cache_rest,
+			     scan_type, spec->s.cls_node.cache_reserved, spec->s.cls_node.cls_regu_list_reserved);
     }
+  else if (spec->type == TARGET_CLASS && spec->access == ACCESS_METHOD_SEQUENTIAL_PAGE_SCAN)
+    {
+      HEAP_PAGE_SCAN_ID *hpsidp = &spec->s_id.s.hpsid;
+      SCAN_TYPE scan_type = S_HEAP_PAGE_SCAN;
+      int i = 0;
 
-  *mvcc_reev_classes = cond_reev_classes;
-  return NO_ERROR;
+      if (hpsidp->cache_page_info != NULL)
+	{
+	  for (i = 0; i < HEAP_PAGE_INFO_COUNT; i++)
+	    {
+	      pr_clear_value (hpsidp->cache_page_info[i]);
+	    }
+	}
+      error =
+	scan_open_heap_page_scan (thread_p, &spec->s_id, val_list, vd, &class_oid, &class_hfid, spec->where_pred,
+				  scan_type, spec->s.cls_node.cache_reserved, spec->s.cls_node.cls_regu_list_reserved);
+    }
+  else if (spec->type == TARGET_CLASS && spec->access == ACCESS_METHOD_INDEX)
+    {
+      INDX_SCAN_ID *isidp = &spec->s_id.s.isid;
+      if (isidp->caches_inited)
+	{
+	  if (isidp->range_pred.regu_list)
+	    {
+	      heap_attrinfo_end (thread_p, isidp->range_attrs.attr_cache);
 
-exit_on_error:
+	      /* some attributes might remain also cached in pred_expr
+	       * (lhs|rhs).value.attr_descr.cache_dbvalp might point to attr_cache values
+	       * see fetch_peek_dbval for example */
+	      qexec_reset_pred_expr (isidp->range_pred.pred_expr);
+	    }
+	  if (isidp->key_pred.regu_list)
+	    {
+	      heap_attrinfo_end (thread_p, isidp->key_attrs.attr_cache);
+	    }
+	  heap_attrinfo_end (thread_p, isidp->pred_attrs.attr_cache);
+	  heap_attrinfo_end (thread_p, isidp->rest_attrs.attr_cache);
+	  isidp->caches_inited = false;
+	}
+      idxptr = spec->indexptr;
+      idxptr->btid = btid;
+      spec->s_id.s.isid.scancache_inited = false;
+      spec->s_id.s.isid.caches_inited = false;
+
+      error =
+	scan_open_index_scan (thread_p, &spec->s_id, mvcc_select_lock_needed, scan_op_type, fixed, grouped,
+			      single_fetch, spec->s_dbval, val_list, vd, idxptr, &class_oid, &class_hfid,
+			      spec->s.cls_node.cls_regu_list_key, spec->where_key, spec->s.cls_node.cls_regu_list_pred,
+			      spec->where_pred, spec->s.cls_node.cls_regu_list_rest, spec->where_range,
+			      spec->s.cls_node.cls_regu_list_range,
+			      spec->s.cls_node.cls_output_val_list, spec->s.cls_node.cls_regu_val_list,
+			      spec->s.cls_node.num_attrs_key, spec->s.cls_node.attrids_key, spec->s.cls_node.cache_key,
+			      spec->s.cls_node.num_attrs_pred, spec->s.cls_node.attrids_pred,
+			      spec->s.cls_node.cache_pred, spec->s.cls_node.num_attrs_rest,
+			      spec->s.cls_node.attrids_rest, spec->s.cls_node.cache_rest,
+			      spec->s.cls_node.num_attrs_range, spec->s.cls_node.attrids_range,
+			      spec->s.cls_node.cache_range, iscan_oid_order, query_id);
 
-  if (cond_reev_classes != NULL)
-    {
-      db_private_free (thread_p, cond_reev_classes);
     }
-  for (idx = 0; idx < num_classes; idx++)
+  else if (spec->type == TARGET_CLASS_ATTR)
     {
-      int_cls = &internal_classes[idx];
-      if (int_cls->mvcc_extra_assign_reev != NULL)
+      if (spec->s_id.s.hsid.caches_inited)
 	{
-	  db_private_free_and_init (thread_p, int_cls->mvcc_extra_assign_reev);
+	  heap_attrinfo_end (thread_p, spec->s_id.s.hsid.pred_attrs.attr_cache);
+	  heap_attrinfo_end (thread_p, spec->s_id.s.hsid.rest_attrs.attr_cache);
+	  spec->s_id.s.hsid.caches_inited = false;
 	}
+
+      error =
+	scan_open_class_attr_scan (thread_p, &spec->s_id, grouped, spec->single_fetch, spec->s_dbval, val_list, vd,
+				   &class_oid, &class_hfid, spec->s.cls_node.cls_regu_list_pred, spec->where_pred,
+				   spec->s.cls_node.cls_regu_list_rest, spec->s.cls_node.num_attrs_pred,
+				   spec->s.cls_node.attrids_pred, spec->s.cls_node.cache_pred,
+				   spec->s.cls_node.num_attrs_rest, spec->s.cls_node.attrids_rest,
+				   spec->s.cls_node.cache_rest);
+    }
+  if (error != NO_ERROR)
+    {
+      return S_ERROR;
     }
-  *mvcc_reev_classes = NULL;
 
-  return ER_FAILED;
+  if (spec->curent == NULL)
+    {
+      return S_END;
+    }
+
+  error = scan_start_scan (thread_p, &spec->s_id);
+  if (error != NO_ERROR)
+    {
+      return S_ERROR;
+    }
+  return S_SUCCESS;
 }
 
 /*
- * qexec_execute_update () -
- *   return: NO_ERROR, or ER_code
- *   xasl(in): XASL Tree block
- *   has_delete(in): update/delete
- *   xasl_state(in):
+ * qexec_intprt_fnc () -
+ *   return: scan code
+ *   xasl(in)   : XASL Tree pointer
+ *   xasl_state(in)     : XASL Tree state information
+ *   tplrec(out) : Tuple record descriptor to store result tuples
+ *   next_scan_fnc(in)  : Function to interpret following XASL scan block
+ *
+ * Note: This function is the main function used to interpret an XASL
+ * tree block. That is, it assumes a general format XASL block
+ * with all possible representations.
  */
-static int
-qexec_execute_update (THREAD_ENTRY * thread_p, XASL_NODE * xasl, bool has_delete, XASL_STATE * xasl_state)
+static SCAN_CODE
+qexec_intprt_fnc (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state, QFILE_TUPLE_RECORD * tplrec,
+		  XASL_SCAN_FNC_PTR next_scan_fnc)
 {
-  UPDATE_PROC_NODE *update = &xasl->proc.update;
-  UPDDEL_CLASS_INFO *upd_cls = NULL;
-  UPDATE_ASSIGNMENT *assign = NULL;
+#define CTE_CURRENT_SCAN_READ_TUPLE(node) \
+  ((((node)->curr_spec->type == TARGET_LIST && (node)->curr_spec->s_id.type == S_LIST_SCAN)) \
+    ? ((node)->curr_spec->s_id.s.llsid.lsid.curr_tplno) : -1)
+#define CTE_CURR_ITERATION_LAST_TUPLE(node) \
+  ((((node)->curr_spec->type == TARGET_LIST && (node)->curr_spec->s_id.type == S_LIST_SCAN)) \
+    ? ((node)->curr_spec->s_id.s.llsid.list_id->tuple_cnt - 1) : -1)
+
+  XASL_NODE *xptr = NULL;
+  SCAN_CODE xs_scan;
   SCAN_CODE xb_scan;
   SCAN_CODE ls_scan;
-  XASL_NODE *aptr = NULL;
-  DB_VALUE *valp = NULL;
-  QPROC_DB_VALUE_LIST vallist;
-  int assign_idx = 0;
-  int rc;
-  int attr_id;
-  OID *oid = NULL;
-  OID *class_oid = NULL;
-  UPDDEL_CLASS_INFO_INTERNAL *internal_classes = NULL, *internal_class = NULL;
-  ACCESS_SPEC_TYPE *specp = NULL;
-  SCAN_ID *s_id = NULL;
-  LOG_LSA lsa;
-  int savepoint_used = 0;
-  int satisfies_constraints;
-  int force_count;
-  int op_type = SINGLE_ROW_UPDATE;
-  int s = 0;
-  int tuple_cnt, error = NO_ERROR;
-  REPL_INFO_TYPE repl_info;
-  int class_oid_cnt = 0, class_oid_idx = 0;
-  int mvcc_reev_class_cnt = 0, mvcc_reev_class_idx = 0;
-  bool scan_open = false;
-  int should_delete = 0;
-  int current_op_type = SINGLE_ROW_UPDATE;
-  PRUNING_CONTEXT *pcontext = NULL;
-  DEL_LOB_INFO *del_lob_info_list = NULL;
-  MVCC_UPDDEL_REEV_DATA mvcc_upddel_reev_data;
-  MVCC_REEV_DATA mvcc_reev_data;
-  UPDDEL_MVCC_COND_REEVAL *mvcc_reev_classes = NULL, *mvcc_reev_class = NULL;
-  UPDATE_MVCC_REEV_ASSIGNMENT *mvcc_reev_assigns = NULL;
-  bool need_locking;
-  UPDDEL_CLASS_INSTANCE_LOCK_INFO class_instance_lock_info, *p_class_instance_lock_info = NULL;
-
-  thread_p->no_logging = (bool) update->no_logging;
+  DB_LOGICAL ev_res;
+  int qualified;
+  AGGREGATE_TYPE *agg_ptr = NULL;
+  bool count_star_with_iscan_opt = false;
+  SCAN_OPERATION_TYPE scan_operation_type;
+  int curr_iteration_last_cursor = 0;
+  int recursive_iterations = 0;
+  bool max_recursive_iterations_reached = false;
+  bool cte_start_new_iteration = false;
 
-  /* get the snapshot, before acquiring locks, since the transaction may be blocked and we need the snapshot when
-   * update starts, not later */
-  (void) logtb_get_mvcc_snapshot (thread_p);
+  if (xasl->type == BUILDVALUE_PROC)
+    {
+      BUILDVALUE_PROC_NODE *buildvalue = &xasl->proc.buildvalue;
+      if (buildvalue->agg_list != NULL)
+	{
+	  int error = NO_ERROR;
+	  bool is_scan_needed = false;
+	  if (!buildvalue->is_always_false)
+	    {
+	      error =
+		qexec_evaluate_aggregates_optimize (thread_p, buildvalue->agg_list, xasl->spec_list, &is_scan_needed);
+	      if (error != NO_ERROR)
+		{
+		  is_scan_needed = true;
+		}
+	    }
 
-  mvcc_upddel_reev_data.copyarea = NULL;
-  mvcc_reev_data.set_update_reevaluation (mvcc_upddel_reev_data);
-  class_oid_cnt = update->num_classes;
-  mvcc_reev_class_cnt = update->num_reev_classes;
+	  if (prm_get_bool_value (PRM_ID_OPTIMIZER_ENABLE_AGGREGATE_OPTIMIZATION) == false)
+	    {
+	      is_scan_needed = true;
+	    }
 
-  /* Allocate memory for oids, hfids and attributes cache info of all classes used in update */
-  error = qexec_create_internal_classes (thread_p, update->classes, class_oid_cnt, &internal_classes);
-  if (error != NO_ERROR)
-    {
-      GOTO_EXIT_ON_ERROR;
-    }
+	  if (!is_scan_needed)
+	    {
+	      return S_SUCCESS;
+	    }
 
-  /* lock classes which this query will update */
-  aptr = xasl->aptr_list;
-  error = qexec_set_class_locks (thread_p, aptr, update->classes, update->num_classes, internal_classes);
-  if (error != NO_ERROR)
-    {
-      GOTO_EXIT_ON_ERROR;
+	  agg_ptr = buildvalue->agg_list;
+	  if (!xasl->scan_ptr	/* no scan procedure */
+	      && !xasl->fptr_list	/* no path expressions */
+	      && !xasl->if_pred	/* no if predicates */
+	      && !xasl->instnum_pred	/* no instnum predicate */
+	      && agg_ptr->next == NULL	/* no other aggregate functions */
+	      && agg_ptr->function == PT_COUNT_STAR)
+	    {
+	      /* only one count(*) function */
+	      ACCESS_SPEC_TYPE *specp = xasl->spec_list;
+	      if (specp->next == NULL && specp->access == ACCESS_METHOD_INDEX
+		  && specp->s.cls_node.cls_regu_list_pred == NULL && specp->where_pred == NULL
+		  && !specp->indexptr->use_iss && !SCAN_IS_INDEX_MRO (&specp->s_id.s.isid)
+		  && !SCAN_IS_INDEX_COVERED (&specp->s_id.s.isid))
+		{
+		  /* count(*) query will scan an index but does not have a data-filter */
+		  specp->s_id.s.isid.need_count_only = true;
+		  count_star_with_iscan_opt = true;
+		}
+	    }
+	}
     }
-
-  error =
-    prepare_mvcc_reev_data (thread_p, aptr, xasl_state, mvcc_reev_class_cnt, update->mvcc_reev_classes,
-			    &mvcc_upddel_reev_data, update->num_classes, update->classes, internal_classes,
-			    update->num_assigns, update->assigns, update->cons_pred, &mvcc_reev_classes,
-			    &mvcc_reev_assigns, has_delete);
-  if (error != NO_ERROR)
+  else if (xasl->type == BUILDLIST_PROC)
     {
-      GOTO_EXIT_ON_ERROR;
+      /* If it is BUILDLIST, do not optimize aggregation */
+      if (xasl->proc.buildlist.g_agg_list != NULL)
+	{
+	  for (agg_ptr = xasl->proc.buildlist.g_agg_list; agg_ptr; agg_ptr = agg_ptr->next)
+	    {
+	      agg_ptr->flag_agg_optimize = false;
+	    }
+	}
     }
 
-  if (class_oid_cnt == 1 && update->classes->num_subclasses == 1)
+  while ((xb_scan = qexec_next_scan_block_iterations (thread_p, xasl)) == S_SUCCESS)
     {
-      /* We update instances of only one class. We expect to lock the instances at select phase. However this not
-       * happens in all situations. The qexec_execute_mainblock function will set instances_locked of
-       * p_class_instance_lock_info to true in case that current class instances are locked at select phase. */
-      COPY_OID (&class_instance_lock_info.class_oid, (*((*update).classes)).class_oid);
-      class_instance_lock_info.instances_locked = false;
-      p_class_instance_lock_info = &class_instance_lock_info;
-    }
+      int cte_offset_read_tuple = 0;
+      int cte_curr_scan_tplno = -1;
 
-  if (qexec_execute_mainblock (thread_p, aptr, xasl_state, p_class_instance_lock_info) != NO_ERROR)
-    {
-      GOTO_EXIT_ON_ERROR;
-    }
-
-  if (p_class_instance_lock_info && p_class_instance_lock_info->instances_locked)
-    {
-      /* already locked in select phase. Avoid locking again the same instances at update phase */
-      need_locking = false;
-    }
-  else
-    {
-      /* not locked in select phase, need locking at update phase */
-      need_locking = true;
-    }
-
-  /* This guarantees that the result list file will have a type list. Copying a list_id structure fails unless it has a
-   * type list. */
-  if (qexec_setup_list_id (thread_p, xasl) != NO_ERROR)
-    {
-      GOTO_EXIT_ON_ERROR;
-    }
-
-  if (aptr->list_id->tuple_cnt > 1)
-    {
-      /* When multiple instances are updated, statement level uniqueness checking should be performed. In this case,
-       * uniqueness checking is performed by using statistical information generated by the execution of UPDATE
-       * statement. */
-      op_type = MULTI_ROW_UPDATE;
-    }
-  else
-    {				/* tuple_cnt <= 1 */
-      /* When single instance is updated, instance level uniqueness checking is performed. In this case, uniqueness
-       * checking is performed by the server when the key of the instance is inserted into an unique index. */
-      op_type = SINGLE_ROW_UPDATE;
-    }
-
-  /* need to start a topop to ensure statement atomicity. One update statement might update several disk images. For
-   * example, one row update might update zero or more index keys, one heap record, and other things. So, the update
-   * statement must be performed atomically. */
-  if (xtran_server_start_topop (thread_p, &lsa) != NO_ERROR)
-    {
-      GOTO_EXIT_ON_ERROR;
-    }
-  savepoint_used = 1;
-
-  specp = xasl->spec_list;
-  /* force_select_lock = false */
-  assert (xasl->scan_op_type == S_SELECT);
-  if (qexec_open_scan (thread_p, specp, xasl->val_list, &xasl_state->vd, false, specp->fixed_scan, specp->grouped_scan,
-		       true, &specp->s_id, xasl_state->query_id, S_SELECT, false, NULL) != NO_ERROR)
-    {
-      GOTO_EXIT_ON_ERROR;
-    }
+      if (xasl->max_iterations != -1)
+	{
+	  assert (xasl->curr_spec->type == TARGET_LIST);
+	  assert (xasl->curr_spec->s_id.type == S_LIST_SCAN);
 
-  scan_open = true;
+	  cte_start_new_iteration = true;
+	  recursive_iterations = 1;
+	}
 
-  tuple_cnt = 1;
-  while ((xb_scan = qexec_next_scan_block_iterations (thread_p, xasl)) == S_SUCCESS)
-    {
-      s_id = &xasl->curr_spec->s_id;
-      while ((ls_scan = scan_next_scan (thread_p, s_id)) == S_SUCCESS)
+      while ((ls_scan = scan_next_scan (thread_p, &xasl->curr_spec->s_id)) == S_SUCCESS)
 	{
-	  if (op_type == MULTI_ROW_UPDATE)
+	  if (xasl->max_iterations != -1)
 	    {
-	      if (tuple_cnt == 1)
-		{
-		  repl_info = REPL_INFO_TYPE_RBR_START;
-		}
-	      else if (tuple_cnt == aptr->list_id->tuple_cnt)
+	      /* the scan tuple number resets when when a new page is fetched
+	       * cte_offset_read_tuple keeps of the global tuple number across the entire list */
+	      if (CTE_CURRENT_SCAN_READ_TUPLE (xasl) < cte_curr_scan_tplno)
 		{
-		  repl_info = REPL_INFO_TYPE_RBR_END;
+		  cte_offset_read_tuple += cte_curr_scan_tplno + 1;
 		}
-	      else
+
+	      cte_curr_scan_tplno = CTE_CURRENT_SCAN_READ_TUPLE (xasl);
+
+	      if (cte_start_new_iteration)
 		{
-		  repl_info = REPL_INFO_TYPE_RBR_NORMAL;
+		  recursive_iterations++;
+		  if (recursive_iterations >= xasl->max_iterations)
+		    {
+		      max_recursive_iterations_reached = true;
+		      break;
+		    }
+
+		  curr_iteration_last_cursor = CTE_CURR_ITERATION_LAST_TUPLE (xasl);
+		  assert (curr_iteration_last_cursor >= 0);
+		  cte_start_new_iteration = false;
 		}
-	    }
-	  else
-	    {
-	      repl_info = REPL_INFO_TYPE_RBR_NORMAL;
-	    }
-	  tuple_cnt++;
 
-	  /* evaluate constraint predicate */
-	  satisfies_constraints = V_UNKNOWN;
-	  if (update->cons_pred != NULL)
-	    {
-	      satisfies_constraints = eval_pred (thread_p, update->cons_pred, &xasl_state->vd, NULL);
-	      if (satisfies_constraints == V_ERROR)
+	      if (cte_curr_scan_tplno + cte_offset_read_tuple == curr_iteration_last_cursor)
 		{
-		  GOTO_EXIT_ON_ERROR;
+		  cte_start_new_iteration = true;
 		}
 	    }
 
-	  if (update->cons_pred != NULL && satisfies_constraints != V_TRUE)
+	  if (count_star_with_iscan_opt)
 	    {
-	      /* currently there are only NOT NULL constraints */
-	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_NULL_CONSTRAINT_VIOLATION, 0);
-	      GOTO_EXIT_ON_ERROR;
+	      xasl->proc.buildvalue.agg_list->accumulator.curr_cnt += (&xasl->curr_spec->s_id)->s.isid.oids_count;
+	      /* may have more scan ranges */
+	      continue;
 	    }
+	  /* set scan item as qualified */
+	  qualified = true;
 
-	  /* should delete? */
-	  current_op_type = op_type;
-	  if (has_delete)
+	  if (xasl->bptr_list)
 	    {
-	      vallist = s_id->val_list->valp;
-	      for (class_oid_idx = 0; class_oid_idx < class_oid_cnt; vallist = vallist->next->next, class_oid_idx++)
+	      if (xasl->curr_spec->flags & ACCESS_SPEC_FLAG_FOR_UPDATE)
 		{
-		  ;		/* advance */
+		  scan_operation_type = S_UPDATE;
 		}
-	      valp = vallist->val;
-	      if (valp == NULL)
+	      else
 		{
-		  GOTO_EXIT_ON_ERROR;
+		  scan_operation_type = S_SELECT;
 		}
+	    }
 
-	      /* We may get NULL as an expr value. See pt_to_merge_update_query(...). */
-	      if (DB_IS_NULL (valp))
+	  /* evaluate bptr list */
+	  /* if path expression fetch fails, this instance disqualifies */
+	  for (xptr = xasl->bptr_list; qualified && xptr != NULL; xptr = xptr->next)
+	    {
+	      if (qexec_execute_obj_fetch (thread_p, xptr, xasl_state, scan_operation_type) != NO_ERROR)
 		{
-		  should_delete = 0;
+		  return S_ERROR;
 		}
-	      else
+	      else if (xptr->proc.fetch.fetch_res == false)
 		{
-		  should_delete = db_get_int (valp);
+		  qualified = false;
 		}
+	    }
 
-	      if (should_delete)
+	  if (qualified)
+	    {
+	      /* evaluate dptr list */
+	      for (xptr = xasl->dptr_list; xptr != NULL; xptr = xptr->next)
 		{
-		  if (op_type == SINGLE_ROW_UPDATE)
+		  /* clear correlated subquery list files */
+		  qexec_clear_head_lists (thread_p, xptr);
+		  if (XASL_IS_FLAGED (xptr, XASL_LINK_TO_REGU_VARIABLE))
 		    {
-		      current_op_type = SINGLE_ROW_DELETE;
+		      /* skip if linked to regu var */
+		      continue;
 		    }
-		  else
+		  if (qexec_execute_mainblock (thread_p, xptr, xasl_state, NULL) != NO_ERROR)
 		    {
-		      current_op_type = MULTI_ROW_DELETE;
+		      return S_ERROR;
 		    }
 		}
-	    }
-
-	  /* for each class calc. OID, HFID, attributes cache info and statistical information only if class has
-	   * changed */
-	  vallist = s_id->val_list->valp;
-	  for (class_oid_idx = 0, mvcc_reev_class_idx = 0; class_oid_idx < class_oid_cnt;
-	       vallist = vallist->next->next, class_oid_idx++)
-	    {
-	      upd_cls = &update->classes[class_oid_idx];
-	      internal_class = &internal_classes[class_oid_idx];
-
-	      if (mvcc_reev_class_cnt && mvcc_reev_classes[mvcc_reev_class_idx].class_index == class_oid_idx)
-		{
-		  mvcc_reev_class = &mvcc_reev_classes[mvcc_reev_class_idx++];
-		}
-	      else
-		{
-		  mvcc_reev_class = NULL;
-		}
 
-	      /* instance OID */
-	      valp = vallist->val;
-	      if (valp == NULL)
-		{
-		  GOTO_EXIT_ON_ERROR;
-		}
-	      if (DB_IS_NULL (valp))
-		{
-		  internal_class->oid = NULL;
-		  continue;
-		}
-	      internal_class->oid = db_get_oid (valp);
-	      if (mvcc_reev_class != NULL)
+	      /* evaluate after join predicate */
+	      ev_res = V_UNKNOWN;
+	      if (xasl->after_join_pred != NULL)
 		{
-		  mvcc_reev_class->inst_oid = internal_class->oid;
+		  ev_res = eval_pred (thread_p, xasl->after_join_pred, &xasl_state->vd, NULL);
+		  if (ev_res == V_ERROR)
+		    {
+		      return S_ERROR;
+		    }
 		}
+	      qualified = (xasl->after_join_pred == NULL || ev_res == V_TRUE);
 
-	      /* class OID */
-	      valp = vallist->next->val;
-	      if (valp == NULL)
-		{
-		  GOTO_EXIT_ON_ERROR;
-		}
-	      if (DB_IS_NULL (valp))
+	      if (qualified)
 		{
-		  continue;
+		  /* evaluate if predicate */
+		  ev_res = V_UNKNOWN;
+		  if (xasl->if_pred != NULL)
+		    {
+		      ev_res = eval_pred (thread_p, xasl->if_pred, &xasl_state->vd, NULL);
+		      if (ev_res == V_ERROR)
+			{
+			  return S_ERROR;
+			}
+		    }
+		  qualified = (xasl->if_pred == NULL || ev_res == V_TRUE);
 		}
-	      class_oid = db_get_oid (valp);
 
-	      /* class has changed to a new subclass */
-	      if (class_oid
-		  && (!OID_EQ (&internal_class->prev_class_oid, class_oid)
-		      || (!should_delete && BTREE_IS_MULTI_ROW_OP (op_type) && upd_cls->has_uniques
-			  && internal_class->scan_cache != NULL && internal_class->scan_cache->m_index_stats == NULL)))
+	      if (qualified)
 		{
-		  /* Load internal_class object with information for class_oid */
-		  error =
-		    qexec_upddel_setup_current_class (thread_p, upd_cls, internal_class, current_op_type, class_oid);
-		  if (error != NO_ERROR || internal_class->class_hfid == NULL)
+		  /* evaluate fptr list */
+		  if (xasl->fptr_list)
 		    {
-		      /* matching class oid does not exist... error */
-		      er_log_debug (ARG_FILE_LINE, "qexec_execute_update: class OID is not correct\n");
-		      GOTO_EXIT_ON_ERROR;
+		      if (xasl->curr_spec->flags & ACCESS_SPEC_FLAG_FOR_UPDATE)
+			{
+			  scan_operation_type = S_UPDATE;
+			}
+		      else
+			{
+			  scan_operation_type = S_SELECT;
+			}
 		    }
 
-		  /* temporary disable set filters when needs prunning */
-		  if (mvcc_reev_class != NULL)
+		  for (xptr = xasl->fptr_list; qualified && xptr != NULL; xptr = xptr->next)
 		    {
-		      error = qexec_upddel_mvcc_set_filters (thread_p, aptr, mvcc_reev_class, class_oid);
-		      if (error != NO_ERROR)
-			{
-			  GOTO_EXIT_ON_ERROR;
-			}
-		    }
-
-		  /* clear attribute cache information if valid old subclass */
-		  if (!OID_ISNULL (&internal_class->prev_class_oid) && internal_class->is_attr_info_inited)
-		    {
-		      (void) heap_attrinfo_end (thread_p, &internal_class->attr_info);
-		      internal_class->is_attr_info_inited = false;
-		    }
-		  /* start attribute cache information for new subclass */
-		  if (heap_attrinfo_start (thread_p, class_oid, -1, NULL, &internal_class->attr_info) != NO_ERROR)
-		    {
-		      GOTO_EXIT_ON_ERROR;
-		    }
-		  internal_class->is_attr_info_inited = true;
-
-		  if (should_delete)
-		    {
-		      if (internal_class->num_lob_attrs)
+		      if (qexec_execute_obj_fetch (thread_p, xptr, xasl_state, scan_operation_type) != NO_ERROR)
 			{
-			  internal_class->crt_del_lob_info =
-			    qexec_change_delete_lob_info (thread_p, xasl_state, internal_class, &del_lob_info_list);
-			  if (internal_class->crt_del_lob_info == NULL)
-			    {
-			      GOTO_EXIT_ON_ERROR;
-			    }
+			  return S_ERROR;
 			}
-		      else
+		      else if (xptr->proc.fetch.fetch_res == false)
 			{
-			  internal_class->crt_del_lob_info = NULL;
+			  qualified = false;
 			}
 		    }
-		}
 
-	      /* don't update, just delete */
-	      if (should_delete)
-		{
-		  /* handle lobs first */
-		  if (internal_class->crt_del_lob_info)
+		  if (qualified)
 		    {
-		      /* delete lob files */
-		      DEL_LOB_INFO *crt_del_lob_info = internal_class->crt_del_lob_info;
-		      SCAN_CODE scan_code;
-		      int error;
-		      int i;
-		      RECDES recdes = RECDES_INITIALIZER;
 
-		      /* read lob attributes */
-		      scan_code =
-			heap_get_visible_version (thread_p, oid, class_oid, &recdes, internal_class->scan_cache, PEEK,
-						  NULL_CHN);
-		      if (scan_code == S_ERROR)
-			{
-			  GOTO_EXIT_ON_ERROR;
-			}
-		      if (scan_code == S_SUCCESS)
-			{
-			  error =
-			    heap_attrinfo_read_dbvalues (thread_p, oid, &recdes, NULL, &crt_del_lob_info->attr_info);
-			  if (error != NO_ERROR)
+		      if (!xasl->scan_ptr)
+			{	/* no scan procedure block */
+
+			  /* if hierarchical query do special processing */
+			  if (XASL_IS_FLAGED (xasl, XASL_HAS_CONNECT_BY))
 			    {
-			      GOTO_EXIT_ON_ERROR;
+			      if (qexec_update_connect_by_lists (thread_p, xasl->connect_by_ptr, xasl_state, tplrec) !=
+				  NO_ERROR)
+				{
+				  return S_ERROR;
+				}
 			    }
-			  for (i = 0; i < internal_class->num_lob_attrs; i++)
+			  else
 			    {
-			      DB_VALUE *attr_valp = &crt_del_lob_info->attr_info.values[i].dbvalue;
-			      if (!db_value_is_null (attr_valp))
+			      /* evaluate inst_num predicate */
+			      if (xasl->instnum_val)
 				{
-				  DB_ELO *elo;
-				  error = NO_ERROR;
+				  ev_res = qexec_eval_instnum_pred (thread_p, xasl, xasl_state);
+				  if (ev_res == V_ERROR)
+				    {
+				      return S_ERROR;
+				    }
 
-				  assert (db_value_type (attr_valp) == DB_TYPE_BLOB
-					  || db_value_type (attr_valp) == DB_TYPE_CLOB);
-				  elo = db_get_elo (attr_valp);
-				  if (elo)
+
+				  if ((xasl->instnum_flag & XASL_INSTNUM_FLAG_SCAN_LAST_STOP))
 				    {
-				      error = db_elo_delete (elo);
+				      if (qexec_end_one_iteration (thread_p, xasl, xasl_state, tplrec) != NO_ERROR)
+					{
+					  return S_ERROR;
+					}
+
+				      return S_SUCCESS;
 				    }
-				  if (error != NO_ERROR)
+
+				  if ((xasl->instnum_flag & XASL_INSTNUM_FLAG_SCAN_STOP))
 				    {
-				      GOTO_EXIT_ON_ERROR;
+				      return S_SUCCESS;
+				    }
+				}
+
+			      qualified = (xasl->instnum_pred == NULL || ev_res == V_TRUE);
+			      if (qualified)
+				{
+				  /* one iteration successfully completed */
+				  if (qexec_end_one_iteration (thread_p, xasl, xasl_state, tplrec) != NO_ERROR)
+				    {
+				      return S_ERROR;
+				    }
+				  /* only one row is need for exists OP */
+				  if (XASL_IS_FLAGED (xasl, XASL_NEED_SINGLE_TUPLE_SCAN))
+				    {
+				      return S_SUCCESS;
 				    }
 				}
 			    }
 			}
-		    }
+		      else
+			{	/* handle the scan procedure */
+			  /* current scan block has at least one qualified item */
+			  xasl->curr_spec->s_id.qualified_block = true;
 
-		  force_count = 0;
-		  error =
-		    locator_attribute_info_force (thread_p, internal_class->class_hfid, internal_class->oid, NULL, NULL,
-						  0, LC_FLUSH_DELETE, current_op_type, internal_class->scan_cache,
-						  &force_count, false, REPL_INFO_TYPE_RBR_NORMAL,
-						  DB_NOT_PARTITIONED_CLASS, NULL, NULL, &mvcc_reev_data,
-						  UPDATE_INPLACE_NONE, NULL, need_locking);
+			  /* handle the scan procedure */
+			  xasl->scan_ptr->next_scan_on = false;
+			  if (scan_reset_scan_block (thread_p, &xasl->scan_ptr->curr_spec->s_id) == S_ERROR)
+			    {
+			      return S_ERROR;
+			    }
 
-		  if (error == ER_MVCC_NOT_SATISFIED_REEVALUATION)
-		    {
-		      error = NO_ERROR;
-		    }
-		  else if (error != NO_ERROR)
-		    {
-		      GOTO_EXIT_ON_ERROR;
-		    }
-		  else if (force_count)
-		    {
-		      xasl->list_id->tuple_cnt++;
-		    }
-		}
+			  xasl->next_scan_on = true;
 
-	      if (heap_attrinfo_clear_dbvalues (&internal_class->attr_info) != NO_ERROR)
-		{
-		  GOTO_EXIT_ON_ERROR;
-		}
 
-	      if (should_delete)
-		{
-		  goto continue_scan;
-		}
-	    }
+			  while ((xs_scan = (*next_scan_fnc) (thread_p, xasl->scan_ptr, xasl_state, tplrec,
+							      next_scan_fnc + 1)) == S_SUCCESS)
+			    {
 
-	  /* Get info for MVCC condition reevaluation */
-	  for (; mvcc_reev_class_idx < mvcc_reev_class_cnt; mvcc_reev_class_idx++)
-	    {
-	      mvcc_reev_class = &mvcc_reev_classes[mvcc_reev_class_idx];
+			      /* if hierarchical query do special processing */
+			      if (XASL_IS_FLAGED (xasl, XASL_HAS_CONNECT_BY))
+				{
+				  if (qexec_update_connect_by_lists (thread_p, xasl->connect_by_ptr, xasl_state, tplrec)
+				      != NO_ERROR)
+				    {
+				      return S_ERROR;
+				    }
+				}
+			      else
+				{
+				  /* evaluate inst_num predicate */
+				  if (xasl->instnum_val)
+				    {
+				      ev_res = qexec_eval_instnum_pred (thread_p, xasl, xasl_state);
+				      if (ev_res == V_ERROR)
+					{
+					  return S_ERROR;
+					}
 
-	      /* instance OID */
-	      valp = vallist->val;
-	      if (valp == NULL)
-		{
-		  GOTO_EXIT_ON_ERROR;
-		}
-	      /* FIXME: Function version of db_get_oid returns (probably) NULL_OID when the value is NULL,
-	       * while macro version returns NULL pointer. This may cause different behavior.
-	       * As a quick fix, I'm going to add DB_IS_NULL block to keep the existing behavior.
-	       * We need to investigate and get rid of differences of two implementation.
-	       * Inlining would be a good choice.
-	       */
-	      if (DB_IS_NULL (valp))
-		{
-		  OID_SET_NULL (mvcc_reev_class->inst_oid);
-		}
-	      else
-		{
-		  mvcc_reev_class->inst_oid = db_get_oid (valp);
-		}
+				      if ((xasl->instnum_flag & XASL_INSTNUM_FLAG_SCAN_LAST_STOP))
+					{
+					  if (qexec_end_one_iteration (thread_p, xasl, xasl_state, tplrec) != NO_ERROR)
+					    {
+					      return S_ERROR;
+					    }
 
-	      /* class OID */
-	      valp = vallist->next->val;
-	      if (valp == NULL)
-		{
-		  GOTO_EXIT_ON_ERROR;
-		}
+					  return S_SUCCESS;
+					}
 
-	      /* FIXME: please see above FIXME */
-	      if (DB_IS_NULL (valp))
-		{
-		  OID_SET_NULL (class_oid);
-		}
-	      else
-		{
-		  class_oid = db_get_oid (valp);
+				      if (xasl->instnum_flag & XASL_INSTNUM_FLAG_SCAN_STOP)
+					{
+					  return S_SUCCESS;
+					}
+				    }
+
+				  qualified = (xasl->instnum_pred == NULL || ev_res == V_TRUE);
+				  if (qualified)
+				    {
+				      /* one iteration successfully completed */
+				      if (qexec_end_one_iteration (thread_p, xasl, xasl_state, tplrec) != NO_ERROR)
+					{
+					  return S_ERROR;
+					}
+				      /* only one row is need for exists OP */
+				      if (XASL_IS_FLAGED (xasl, XASL_NEED_SINGLE_TUPLE_SCAN))
+					{
+					  return S_SUCCESS;
+					}
+				    }
+				}
+			    }
+
+			  if (xs_scan != S_END)	/* an error happened */
+			    {
+			      return S_ERROR;
+			    }
+			}
+		    }
 		}
+	    }
 
-	      /* class has changed to a new subclass */
-	      if (class_oid && !OID_EQ (&mvcc_reev_class->cls_oid, class_oid))
-		{
-		  error = qexec_upddel_mvcc_set_filters (thread_p, aptr, mvcc_reev_class, class_oid);
-		  if (error != NO_ERROR)
-		    {
-		      GOTO_EXIT_ON_ERROR;
-		    }
-		}
-	      vallist = vallist->next->next;
-	    }
+	  qexec_clear_all_lists (thread_p, xasl);
+	}
 
-	  if (mvcc_upddel_reev_data.mvcc_cond_reev_list == NULL && mvcc_reev_class_cnt > 0)
-	    {
-	      /* If scan order was not set then do it. This operation must be run only once. We do it here and not at
-	       * the beginning of this function because the class OIDs must be set for classes involved in reevaluation
-	       * (in mvcc_reev_classes) prior to this operation */
-	      mvcc_upddel_reev_data.mvcc_cond_reev_list =
-		qexec_mvcc_cond_reev_set_scan_order (aptr, mvcc_reev_classes, mvcc_reev_class_cnt, update->classes,
-						     update->num_classes);
-	    }
-	  if (has_delete)
+      if (max_recursive_iterations_reached)
+	{
+	  xb_scan = S_ERROR;
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_CTE_MAX_RECURSION_REACHED, 1, xasl->max_iterations);
+	  break;
+	}
+
+      if (ls_scan != S_END)	/* an error happened */
+	{
+	  return S_ERROR;
+	}
+    }
+
+  if (xb_scan != S_END)		/* an error happened */
+    {
+      return S_ERROR;
+    }
+
+  return S_SUCCESS;
+
+#undef CTE_CURRENT_SCAN_READ_TUPLE
+#undef CTE_CURR_ITERATION_LAST_TUPLE
+}
+
+/*
+ * qexec_merge_fnc () -
+ *   return: scan code
+ *   xasl(in)   : XASL Tree pointer
+ *   xasl_state(in)     : XASL Tree state information
+ *   tplrec(out) : Tuple record descriptor to store result tuples
+ *
+ * Note: This function is used to interpret an XASL merge command
+ * tree block. It assumes a general format XASL block
+ * with all possible representations.
+ */
+static SCAN_CODE
+qexec_merge_fnc (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state, QFILE_TUPLE_RECORD * tplrec,
+		 XASL_SCAN_FNC_PTR ignore)
+{
+  XASL_NODE *xptr;
+  DB_LOGICAL ev_res;
+  int qualified;
+  SCAN_CODE ls_scan1;		/* first list file scan counter */
+  SCAN_CODE ls_scan2;		/* second list file scan counter */
+  SCAN_ID *s_id1;		/* first list file scan identifier */
+  SCAN_ID *s_id2;		/* second list file scan identifier */
+  ACCESS_SPEC_TYPE *spec;
+
+  /* set first scan parameters */
+  s_id1 = &xasl->spec_list->s_id;
+  /* set second scan parameters */
+  s_id2 = &xasl->merge_spec->s_id;
+
+  if ((!s_id1)
+      || ((s_id1->type == S_LIST_SCAN)
+	  && ((!s_id1->s.llsid.list_id) || (s_id1->s.llsid.list_id->type_list.type_cnt == 0))))
+    {
+      GOTO_EXIT_ON_ERROR;
+    }
+
+  if ((!s_id2)
+      || ((s_id2->type == S_LIST_SCAN)
+	  && ((!s_id2->s.llsid.list_id) || (s_id2->s.llsid.list_id->type_list.type_cnt == 0))))
+    {
+      GOTO_EXIT_ON_ERROR;
+    }
+
+  spec = xasl->merge_spec;
+  if (qexec_next_merge_block (thread_p, &spec) != S_SUCCESS)
+    {
+      GOTO_EXIT_ON_ERROR;
+    }
+
+  while ((ls_scan1 = qexec_next_scan_block (thread_p, xasl)) == S_SUCCESS)
+    {
+      while ((ls_scan1 = scan_next_scan (thread_p, s_id1)) == S_SUCCESS)
+	{
+	  ls_scan2 = scan_next_scan (thread_p, s_id2);
+	  if (ls_scan2 == S_ERROR)
 	    {
-	      vallist = vallist->next;	/* skip should_delete */
+	      GOTO_EXIT_ON_ERROR;
 	    }
 
-	  /* perform assignments */
-	  for (assign_idx = 0; assign_idx < update->num_assigns; assign_idx++)
+	  if (ls_scan2 == S_END)
 	    {
-	      HEAP_CACHE_ATTRINFO *attr_info;
-
-	      assign = &update->assigns[assign_idx];
-	      class_oid_idx = assign->cls_idx;
-	      internal_class = &internal_classes[class_oid_idx];
-	      attr_info = &internal_class->attr_info;
-	      upd_cls = &update->classes[class_oid_idx];
-	      oid = internal_class->oid;
-	      if (oid == NULL)
-		{
-		  /* nothing to update */
-		  if (assign->constant == NULL)
-		    {
-		      vallist = vallist->next;
-		    }
-		  continue;
-		}
-	      attr_id = upd_cls->att_id[internal_class->subclass_idx * upd_cls->num_attrs + assign->att_idx];
-	      if (mvcc_reev_assigns != NULL)
+	      if (qexec_next_merge_block (thread_p, &spec) != S_SUCCESS)
 		{
-		  mvcc_reev_assigns[assign_idx].att_id = attr_id;
+		  GOTO_EXIT_ON_ERROR;
 		}
 
-	      if (assign->constant != NULL)
-		{
-		  rc = heap_attrinfo_set (oid, attr_id, assign->constant, attr_info);
-		}
-	      else
-		{
-		  rc = heap_attrinfo_set (oid, attr_id, vallist->val, attr_info);
-		  vallist = vallist->next;
-		}
-	      if (rc != NO_ERROR)
+	      ls_scan2 = scan_next_scan (thread_p, s_id2);
+	      if (ls_scan2 == S_ERROR)
 		{
 		  GOTO_EXIT_ON_ERROR;
 		}
 	    }
 
-	  /* Flush new values for each class. The class list was built from right to left during XASL generation, so in
-	   * order to maintain the correct update order specified in the query, we must iterate from right to left as
-	   * well; this makes a difference only when we update the same attribute of the same class more than once. */
-	  for (class_oid_idx = class_oid_cnt - 1, mvcc_reev_class_idx = mvcc_reev_class_cnt - 1; class_oid_idx >= 0;
-	       class_oid_idx--)
-	    {
-	      internal_class = &internal_classes[class_oid_idx];
-	      upd_cls = &update->classes[class_oid_idx];
+	  /* set scan item as qualified */
+	  qualified = true;
 
-	      if (mvcc_reev_class_cnt && mvcc_reev_classes[mvcc_reev_class_idx].class_index == class_oid_idx)
+	  /* evaluate bptr list */
+	  /* if path expression fetch fails, this instance disqualifies */
+	  for (xptr = xasl->bptr_list; qualified && xptr != NULL; xptr = xptr->next)
+	    {
+	      if (qexec_execute_obj_fetch (thread_p, xptr, xasl_state, S_SELECT) != NO_ERROR)
 		{
-		  mvcc_reev_class = &mvcc_reev_classes[mvcc_reev_class_idx++];
+		  GOTO_EXIT_ON_ERROR;
 		}
-	      else
+	      else if (xptr->proc.fetch.fetch_res == false)
 		{
-		  mvcc_reev_class = NULL;
+		  qualified = false;
 		}
-	      mvcc_upddel_reev_data.curr_upddel = mvcc_reev_class;
+	    }
 
-	      force_count = 0;
-	      oid = internal_class->oid;
-	      if (oid == NULL)
+	  if (qualified)
+	    {
+	      /* evaluate dptr list */
+	      for (xptr = xasl->dptr_list; xptr != NULL; xptr = xptr->next)
 		{
-		  continue;
+		  /* clear correlated subquery list files */
+		  qexec_clear_head_lists (thread_p, xptr);
+		  if (XASL_IS_FLAGED (xptr, XASL_LINK_TO_REGU_VARIABLE))
+		    {
+		      /* skip if linked to regu var */
+		      continue;
+		    }
+		  if (qexec_execute_mainblock (thread_p, xptr, xasl_state, NULL) != NO_ERROR)
+		    {
+		      GOTO_EXIT_ON_ERROR;
+		    }
 		}
 
-	      if (upd_cls->needs_pruning)
-		{
-		  pcontext = &internal_class->context;
-		}
-	      else
+	      /* evaluate if predicate */
+	      ev_res = V_UNKNOWN;
+	      if (xasl->if_pred != NULL)
 		{
-		  pcontext = NULL;
+		  ev_res = eval_pred (thread_p, xasl->if_pred, &xasl_state->vd, NULL);
+		  if (ev_res == V_ERROR)
+		    {
+		      GOTO_EXIT_ON_ERROR;
+		    }
 		}
 
-	      mvcc_upddel_reev_data.curr_extra_assign_reev = internal_class->mvcc_extra_assign_reev;
-	      mvcc_upddel_reev_data.curr_extra_assign_cnt = internal_class->extra_assign_reev_cnt;
-	      mvcc_upddel_reev_data.curr_assigns = internal_class->mvcc_reev_assigns;
-	      mvcc_upddel_reev_data.curr_attrinfo = &internal_class->attr_info;
-	      error =
-		locator_attribute_info_force (thread_p, internal_class->class_hfid, oid, &internal_class->attr_info,
-					      &upd_cls->att_id[internal_class->subclass_idx * upd_cls->num_attrs],
-					      upd_cls->num_attrs, LC_FLUSH_UPDATE, op_type, internal_class->scan_cache,
-					      &force_count, false, repl_info, internal_class->needs_pruning, pcontext,
-					      NULL, &mvcc_reev_data, UPDATE_INPLACE_NONE, NULL, need_locking);
-	      if (error == ER_MVCC_NOT_SATISFIED_REEVALUATION)
-		{
-		  error = NO_ERROR;
-		}
-	      else if (error == ER_HEAP_UNKNOWN_OBJECT)
-		{
-		  /* TODO: This is a very dangerous. A different way of handling it must be found.
-		   *       This may not even be necessary. I guess this is legacy code from READ COMMITTED
-		   *       re-evaluation made under locator_attribute_info_force. I think currently locking object
-		   *       is done on select phase. However, I am not removing this code yet until more investigation
-		   *       is done.
-		   */
-		  er_clear ();
-		  error = NO_ERROR;
-		}
-	      else if (error != NO_ERROR)
-		{
-		  GOTO_EXIT_ON_ERROR;
-		}
-	      else
+	      qualified = (xasl->if_pred == NULL || ev_res == V_TRUE);
+	      if (qualified)
 		{
-		  /* Successful update. */
-		  force_count = 1;
-		}
+		  /* evaluate fptr list */
+		  for (xptr = xasl->fptr_list; qualified && xptr != NULL; xptr = xptr->next)
+		    {
+		      if (qexec_execute_obj_fetch (thread_p, xptr, xasl_state, S_SELECT) != NO_ERROR)
+			{
+			  GOTO_EXIT_ON_ERROR;
+			}
+		      else if (xptr->proc.fetch.fetch_res == false)
+			{
+			  qualified = false;
+			}
+		    }
 
-	      /* Instances are not put into the result list file, but are counted. */
-	      if (force_count)
-		{
-		  xasl->list_id->tuple_cnt++;
-		}
-	    }
-	continue_scan:
-	  ;
-	}
-      if (ls_scan != S_END)
-	{
+		  if (qualified)
+		    {
+		      if (!xasl->scan_ptr)
+			{	/* no scan procedure block */
+			  /* evaluate inst_num predicate */
+			  if (xasl->instnum_val)
+			    {
+			      ev_res = qexec_eval_instnum_pred (thread_p, xasl, xasl_state);
+			      if (ev_res == V_ERROR)
+				{
+				  return S_ERROR;
+				}
+			      if (xasl->instnum_flag & XASL_INSTNUM_FLAG_SCAN_STOP)
+				{
+				  scan_end_scan (thread_p, s_id1);
+				  scan_end_scan (thread_p, s_id2);
+				  return S_SUCCESS;
+				}
+			    }	/* if (xasl->instnum_val) */
+			  qualified = (xasl->instnum_pred == NULL || ev_res == V_TRUE);
+
+			  if (qualified && qexec_end_one_iteration (thread_p, xasl, xasl_state, tplrec) != NO_ERROR)
+			    {
+			      return S_ERROR;
+			    }
+			}	/* handle the scan procedure */
+		    }
+		}
+	    }
+	}
+
+      if (ls_scan1 == S_ERROR)
+	{
 	  GOTO_EXIT_ON_ERROR;
 	}
     }
-  if (xb_scan != S_END)
+
+  if (ls_scan1 == S_ERROR)
     {
       GOTO_EXIT_ON_ERROR;
     }
 
-  for (s = 0; s < class_oid_cnt; s++)
-    {
-      internal_class = &internal_classes[s];
-      upd_cls = &update->classes[s];
+  scan_end_scan (thread_p, s_id1);
+  scan_end_scan (thread_p, s_id2);
+  return S_SUCCESS;
 
-      if (upd_cls->has_uniques)
-	{
-	  if (internal_class->needs_pruning)
-	    {
-	      error = qexec_process_partition_unique_stats (thread_p, &internal_class->context);
-	    }
-	  else
-	    {
-	      error = qexec_process_unique_stats (thread_p, upd_cls->class_oid, internal_class);
-	    }
-	  if (error != NO_ERROR)
-	    {
-	      GOTO_EXIT_ON_ERROR;
-	    }
-	}
-    }
+exit_on_error:
+  scan_end_scan (thread_p, s_id1);
+  scan_end_scan (thread_p, s_id2);
+  scan_close_scan (thread_p, s_id1);
+  scan_close_scan (thread_p, s_id2);
+  return S_ERROR;
+}
 
-  qexec_close_scan (thread_p, specp);
+/*
+ * qexec_setup_list_id () -
+ *   return: NO_ERROR, or ER_code
+ *   xasl(in)   : XASL Tree block
+ *
+ * Note: This routine is used by update/delete/insert to set up a
+ * type_list. Copying a list_id structure fails unless it has a type list.
+ */
+static int
+qexec_setup_list_id (THREAD_ENTRY * thread_p, XASL_NODE * xasl)
+{
+  QFILE_LIST_ID *list_id;
 
-  if (has_delete)
-    {
-      qexec_free_delete_lob_info_list (thread_p, &del_lob_info_list);
-    }
+  list_id = xasl->list_id;
+  list_id->tuple_cnt = 0;
+  list_id->page_cnt = 0;
 
-  if (internal_classes)
+  /* For streaming queries, set last_pgptr->next_vpid to NULL */
+  if (list_id->last_pgptr != NULL)
     {
-      qexec_clear_internal_classes (thread_p, internal_classes, class_oid_cnt);
-      db_private_free_and_init (thread_p, internal_classes);
+      QFILE_PUT_NEXT_VPID_NULL (list_id->last_pgptr);
     }
 
-  if (mvcc_reev_classes != NULL)
-    {
-      db_private_free (thread_p, mvcc_reev_classes);
-      mvcc_reev_classes = NULL;
-    }
-  if (mvcc_reev_assigns != NULL)
-    {
-      db_private_free (thread_p, mvcc_reev_assigns);
-      mvcc_reev_assigns = NULL;
-    }
-  if (mvcc_upddel_reev_data.copyarea != NULL)
+  list_id->last_pgptr = NULL;	/* don't want qfile_close_list() to free this bogus listid */
+  list_id->type_list.type_cnt = 1;
+  list_id->type_list.domp = (TP_DOMAIN **) malloc (list_id->type_list.type_cnt * sizeof (TP_DOMAIN *));
+  if (list_id->type_list.domp == NULL)
     {
-      locator_free_copy_area (mvcc_upddel_reev_data.copyarea);
-      mvcc_upddel_reev_data.copyarea = NULL;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+	      list_id->type_list.type_cnt * sizeof (TP_DOMAIN *));
+      return ER_OUT_OF_VIRTUAL_MEMORY;
     }
+  /* set up to return object domains in case we want to return the updated/inserted/deleted oid's */
+  list_id->type_list.domp[0] = &tp_Object_domain;
 
-  if (savepoint_used)
+  if (xasl->type == INSERT_PROC && XASL_IS_FLAGED (xasl, XASL_RETURN_GENERATED_KEYS))
     {
-      if (xtran_server_end_topop (thread_p, LOG_RESULT_TOPOP_ATTACH_TO_OUTER, &lsa) != TRAN_ACTIVE)
+      list_id->tfile_vfid = qmgr_create_new_temp_file (thread_p, list_id->query_id, TEMP_FILE_MEMBUF_NORMAL);
+      if (list_id->tfile_vfid == NULL)
 	{
-	  qexec_failure_line (__LINE__, xasl_state);
 	  return ER_FAILED;
 	}
+      VFID_COPY (&(list_id->temp_vfid), &(list_id->tfile_vfid->temp_vfid));
     }
 
-#if 0				/* yaw */
-  /* remove query result cache entries which are relevant with this class */
-  class_oid = update->class_oid;
-  if (!QFILE_IS_LIST_CACHE_DISABLED && class_oid)
-    {
-      for (s = 0; s < update->num_classes; s++, class_oid++)
-	{
-	  if (qexec_clear_list_cache_by_class (class_oid) != NO_ERROR)
-	    {
-	      er_log_debug (ARG_FILE_LINE,
-			    "qexec_execute_update: qexec_clear_list_cache_by_class failed for class { %d %d %d }\n",
-			    class_oid->pageid, class_oid->slotid, class_oid->volid);
-	    }
-	}
-      qmgr_add_modified_class (class_oid);
-    }
-#endif
+  assert (list_id->type_list.type_cnt == 1);
+  qfile_update_qlist_count (thread_p, list_id, 1);
 
   return NO_ERROR;
+}
 
-exit_on_error:
+/*
+ * qexec_init_upddel_ehash_files () - Initializes the hash files used for
+ *				       duplicate OIDs elimination.
+ *   return: NO_ERROR, or ER_code
+ *   thread_p(in):
+ *   buildlist(in): BUILDLIST_PROC XASL
+ *
+ * Note: The function is used only for SELECT statement generated for
+ *	 UPDATE/DELETE. The case of SINGLE-UPDATE/SINGLE-DELETE is skipped.
+ */
+static int
+qexec_init_upddel_ehash_files (THREAD_ENTRY * thread_p, XASL_NODE * buildlist)
+{
+  int idx;
+  EHID *hash_list = NULL;
 
-  if (scan_open)
+  if (buildlist == NULL || buildlist->type != BUILDLIST_PROC)
     {
-      qexec_end_scan (thread_p, specp);
-      qexec_close_scan (thread_p, specp);
+      return NO_ERROR;
     }
 
-  if (del_lob_info_list != NULL)
+  hash_list = (EHID *) db_private_alloc (thread_p, buildlist->upd_del_class_cnt * sizeof (EHID));
+  if (hash_list == NULL)
     {
-      qexec_free_delete_lob_info_list (thread_p, &del_lob_info_list);
+      goto exit_on_error;
     }
 
-  if (mvcc_reev_classes != NULL)
-    {
-      db_private_free (thread_p, mvcc_reev_classes);
-      mvcc_reev_classes = NULL;
-    }
-  if (mvcc_reev_assigns != NULL)
-    {
-      db_private_free (thread_p, mvcc_reev_assigns);
-      mvcc_reev_assigns = NULL;
-    }
-  if (mvcc_upddel_reev_data.copyarea != NULL)
+  for (idx = 0; idx < buildlist->upd_del_class_cnt; idx++)
     {
-      locator_free_copy_area (mvcc_upddel_reev_data.copyarea);
-      mvcc_upddel_reev_data.copyarea = NULL;
+      hash_list[idx].vfid.volid = LOG_DBFIRST_VOLID;
+      if (xehash_create (thread_p, &hash_list[idx], DB_TYPE_OBJECT, -1, NULL, 0, true) == NULL)
+	{
+	  goto exit_on_error;
+	}
     }
+  buildlist->proc.buildlist.upddel_oid_locator_ehids = hash_list;
 
-  if (savepoint_used)
-    {
-      xtran_server_end_topop (thread_p, LOG_RESULT_TOPOP_ABORT, &lsa);
-    }
+  return NO_ERROR;
 
-  if (internal_classes)
+exit_on_error:
+  if (hash_list != NULL)
     {
-      qexec_clear_internal_classes (thread_p, internal_classes, class_oid_cnt);
-      db_private_free_and_init (thread_p, internal_classes);
+      for (--idx; idx >= 0; idx--)
+	{
+	  xehash_destroy (thread_p, &hash_list[idx]);
+	}
+      db_private_free (thread_p, hash_list);
     }
 
   return ER_FAILED;
 }
 
 /*
- * qexec_update_btree_unique_stats_info () - updates statistical information structure
- *   return: NO_ERROR or ER_code
- *   thread_p(in)   :
- *   info(in)     : structure to update
+ * qexec_destroy_upddel_ehash_files () - Destroys the hash files used for
+ *					 duplicate rows elimination in
+ *					 UPDATE/DELETE.
+ *   return: void
+ *   thread_p(in):
+ *   buildlist(in): BUILDLIST_PROC XASL
+ *
+ * Note: The function is used only for SELECT statement generated for
+ *	 UPDATE/DELETE.
  */
 static void
-qexec_update_btree_unique_stats_info (THREAD_ENTRY * thread_p, multi_index_unique_stats * info,
-				      const HEAP_SCANCACHE * scan_cache)
+qexec_destroy_upddel_ehash_files (THREAD_ENTRY * thread_p, XASL_NODE * buildlist)
 {
-  assert (info != NULL && scan_cache != NULL);
+  int idx;
+  bool save_interrupted;
+  EHID *hash_list = buildlist->proc.buildlist.upddel_oid_locator_ehids;
 
-  if (scan_cache->m_index_stats != NULL)
+  save_interrupted = logtb_set_check_interrupt (thread_p, false);
+
+  for (idx = 0; idx < buildlist->upd_del_class_cnt; idx++)
     {
-      (*info) += (*scan_cache->m_index_stats);
+      if (xehash_destroy (thread_p, &hash_list[idx]) != NO_ERROR)
+	{
+	  /* should not fail or we'll leak reserved sectors */
+	  assert (false);
+	}
     }
+  db_private_free (thread_p, hash_list);
+  buildlist->proc.buildlist.upddel_oid_locator_ehids = NULL;
+
+  (void) logtb_set_check_interrupt (thread_p, save_interrupted);
 }
 
 /*
- * qexec_process_unique_stats () - verify unique statistic information for
- *				   a class hierarchy and update index
- * return : error code or NO_ERROR
- * thread_p (in) :
- * class_oid (in) :
- * internal_class (in) :
+ * qexec_mvcc_cond_reev_set_scan_order () - link classes for condition
+ *					    reevaluation in scan order (from
+ *					    outer to inner)
+ *   return: list head
+ *   aptr(in): XASL for generated SELECT statement for UPDATE
+ *   buildlist(in): BUILDLIST_PROC XASL
+ *   reev_classes(in): array of classes for reevaluation
+ *   num_reev_classes(in): no of classes for reevaluation
+ *   classes(in): classes to be updated
+ *   num_classes(in): no of classes to be updated
  */
-static int
-qexec_process_unique_stats (THREAD_ENTRY * thread_p, const OID * class_oid, UPDDEL_CLASS_INFO_INTERNAL * internal_class)
-{
-  assert (class_oid != NULL && internal_class != NULL);
-
-  int error = NO_ERROR;
+static UPDDEL_MVCC_COND_REEVAL *
+qexec_mvcc_cond_reev_set_scan_order (XASL_NODE * aptr, UPDDEL_MVCC_COND_REEVAL * reev_classes, int num_reev_classes,
+				     UPDDEL_CLASS_INFO * classes, int num_classes)
+{
+  int idx, idx2, idx3;
+  ACCESS_SPEC_TYPE *access_spec = NULL;
+  UPDDEL_MVCC_COND_REEVAL *scan_elem = NULL, *scan_start = NULL;
+  int *mvcc_extra_assign_reev = NULL;
 
-  if (internal_class->m_inited_scancache)
+  if (reev_classes == NULL || num_reev_classes <= 0)
     {
-      /* Accumulate current statistics */
-      qexec_update_btree_unique_stats_info (thread_p, &internal_class->m_unique_stats, &internal_class->m_scancache);
+      return NULL;
     }
-// *INDENT-OFF*
-for (const auto & it:internal_class->m_unique_stats.get_map ())
+  for (; aptr != NULL; aptr = aptr->scan_ptr)
     {
-      if (!it.second.is_unique ())
-	{
-	  BTREE_SET_UNIQUE_VIOLATION_ERROR (thread_p, NULL, NULL, class_oid, &it.first, NULL);
-	  return ER_BTREE_UNIQUE_FAILED;
-	}
-      error = logtb_tran_update_unique_stats (thread_p, it.first, it.second, true);
-      if (error != NO_ERROR)
+      for (access_spec = aptr->spec_list; access_spec != NULL; access_spec = access_spec->next)
 	{
-	  ASSERT_ERROR ();
-	  return error;
+	  for (idx = num_reev_classes - 1; idx >= 0; idx--)
+	    {
+	      if (OID_EQ (&access_spec->s.cls_node.cls_oid, &reev_classes[idx].cls_oid))
+		{
+		  /* check that this class is not an assignment reevaluation class */
+		  for (idx2 = 0; idx2 < num_classes; idx2++)
+		    {
+		      mvcc_extra_assign_reev = classes[idx2].mvcc_extra_assign_reev;
+		      for (idx3 = classes[idx2].num_extra_assign_reev - 1; idx3 >= 0; idx3--)
+			{
+			  if (mvcc_extra_assign_reev[idx3] == reev_classes[idx].class_index)
+			    {
+			      break;
+			    }
+			}
+		      if (idx3 >= 0)
+			{
+			  break;
+			}
+		    }
+		  if (idx2 < num_classes)
+		    {
+		      continue;
+		    }
+
+		  /* if this class is not an assignment reevaluation class then add to the list */
+		  if (scan_elem == NULL)
+		    {
+		      scan_elem = scan_start = &reev_classes[idx];
+		    }
+		  else
+		    {
+		      scan_elem->next = &reev_classes[idx];
+		      scan_elem = scan_elem->next;
+		    }
+		  break;
+		}
+	    }
+	  if (idx >= 0)
+	    {
+	      break;
+	    }
 	}
     }
-// *INDENT-ON*
-  return NO_ERROR;
+
+  return scan_start;
 }
 
 /*
- * qexec_process_partition_unique_stats () - process unique statistics on a partitioned class
+ * prepare_mvcc_reev_data () - create and initialize structures for MVCC
+ *			       condition and assignments reevaluation
  * return : error code or NO_ERROR
  * thread_p (in) :
- * pcontext (in) :
- *
- * Note: Since unique indexes for partitioned classes are either local or
- *    global, it's to expensive to use the validation made on normal class
- *    hierarchies. This function just reflects the unique statistics to the
- *    index header
+ * aptr (in): XASL for generated SELECT statement for UPDATE
+ * num_reev_classes (in): no of indexes for classes used in reevaluation
+ * mvcc_reev_indexes (in) : array of indexes for classes used in reevaluation
+ * reev_data (in) : MVCC reevaluation data for a specific class
+ * num_classes (in) : no. of assignments 'classes' elements
+ * classes(in): array of classes to be updated
+ * internal_classes (in) : array of information for each class that will be
+ *			   updated
+ * cons_pred(in): NOT NULL contraints predicate
+ * mvcc_reev_classes(in/out): array of classes information used in MVCC
+ *			      reevaluation
+ * mvcc_reev_assigns(in/out): array of assignments information used in
+ *			      reevaluation
+ * has_delete (in):
  */
 static int
-qexec_process_partition_unique_stats (THREAD_ENTRY * thread_p, PRUNING_CONTEXT * pcontext)
+prepare_mvcc_reev_data (THREAD_ENTRY * thread_p, XASL_NODE * aptr, XASL_STATE * xasl_state, int num_reev_classes,
+			int *mvcc_reev_indexes, MVCC_UPDDEL_REEV_DATA * reev_data, int num_classes,
+			UPDDEL_CLASS_INFO * classes, UPDDEL_CLASS_INFO_INTERNAL * internal_classes, int num_assigns,
+			UPDATE_ASSIGNMENT * assigns, PRED_EXPR * cons_pred,
+			UPDDEL_MVCC_COND_REEVAL ** mvcc_reev_classes, UPDATE_MVCC_REEV_ASSIGNMENT ** mvcc_reev_assigns,
+			bool has_delete)
 {
-  assert (pcontext != NULL);
-
-  PRUNING_SCAN_CACHE *pruned_scan_cache = NULL;
-  SCANCACHE_LIST *node = NULL;
-  int error = NO_ERROR;
+  UPDDEL_MVCC_COND_REEVAL *cond_reev_classes = NULL, *cond_reev_class = NULL;
+  UPDDEL_CLASS_INFO *cls = NULL;
+  UPDDEL_CLASS_INFO_INTERNAL *int_cls = NULL;
+  int idx, idx2, idx3;
 
-  for (node = pcontext->scan_cache_list; node != NULL; node = node->next)
+  if (reev_data == NULL)
     {
-      // *INDENT-OFF*
-      pruned_scan_cache = &node->scan_cache;
-      if (!pruned_scan_cache->is_scan_cache_started)
-	{
-	  continue;
-	}
-
-      HEAP_SCANCACHE &scan_cache = pruned_scan_cache->scan_cache;
-      if (scan_cache.m_index_stats != NULL)
-	{
-          for (const auto &it : scan_cache.m_index_stats->get_map ())
-            {
-              if (!it.second.is_unique ())
-                {
-                  char *index_name = NULL;
-                  error = heap_get_indexinfo_of_btid (thread_p, &scan_cache.node.class_oid, &it.first, NULL, NULL, NULL,
-                                                      NULL, &index_name, NULL);
-                  if (error != NO_ERROR)
-                    {
-                      ASSERT_ERROR ();
-                      return error;
-                    }
-
-                  BTREE_SET_UNIQUE_VIOLATION_ERROR (thread_p, NULL, NULL, &scan_cache.node.class_oid, &it.first,
-                                                    index_name);
-
-                  if (index_name != NULL)
-                    {
-                      free_and_init (index_name);
-                    }
-                  return ER_BTREE_UNIQUE_FAILED;
-                }
-
-              error = logtb_tran_update_unique_stats (thread_p, it.first, it.second, true);
-              if (error != NO_ERROR)
-                {
-                  ASSERT_ERROR ();
-                  return error;
-                }
-            }
-	}
-      // *INDENT-ON*
+      assert (0);
+      return ER_FAILED;
     }
 
-  return NO_ERROR;
-}
-
-/*
- * qexec_execute_delete () -
- *   return: NO_ERROR or ER_code
- *   xasl(in)   : XASL Tree block
- *   xasl_state(in)     :
- */
-static int
-qexec_execute_delete (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state)
-{
-#define MIN_NUM_ROWS_FOR_MULTI_DELETE   20
-
-  DELETE_PROC_NODE *delete_ = &xasl->proc.delete_;
-  SCAN_CODE xb_scan = S_END;
-  SCAN_CODE ls_scan = S_END;
-  XASL_NODE *aptr = NULL;
-  DB_VALUE *valp = NULL;
-  OID *oid = NULL;
-  OID *class_oid = NULL;
-  ACCESS_SPEC_TYPE *specp = NULL;
-  SCAN_ID *s_id = NULL;
-  LOG_LSA lsa;
-  int savepoint_used = 0;
-  int class_oid_cnt = 0, class_oid_idx = 0;
-  int force_count = 0;
-  int op_type = SINGLE_ROW_DELETE;
-  int s = 0, error = NO_ERROR;
-  int mvcc_reev_class_cnt = 0, mvcc_reev_class_idx = 0;
-  QPROC_DB_VALUE_LIST val_list = NULL;
-  bool scan_open = false;
-  UPDDEL_CLASS_INFO *query_class = NULL;
-  UPDDEL_CLASS_INFO_INTERNAL *internal_classes = NULL, *internal_class = NULL;
-  DEL_LOB_INFO *del_lob_info_list = NULL;
-  MVCC_REEV_DATA mvcc_reev_data;
-  MVCC_UPDDEL_REEV_DATA mvcc_upddel_reev_data;
-  UPDDEL_MVCC_COND_REEVAL *mvcc_reev_classes = NULL, *mvcc_reev_class = NULL;
-  bool need_locking;
-  UPDDEL_CLASS_INSTANCE_LOCK_INFO class_instance_lock_info, *p_class_instance_lock_info = NULL;
-
-  thread_p->no_logging = (bool) delete_->no_logging;
-
-  /* get the snapshot, before acquiring locks, since the transaction may be blocked and we need the snapshot when
-   * delete starts, not later */
-  (void) logtb_get_mvcc_snapshot (thread_p);
-
-  class_oid_cnt = delete_->num_classes;
-  mvcc_reev_class_cnt = delete_->num_reev_classes;
-  mvcc_reev_data.set_update_reevaluation (mvcc_upddel_reev_data);
-
-  mvcc_upddel_reev_data.copyarea = NULL;
+  /* Make sure reev data is initialized, or else it will crash later */
+  memset (reev_data, 0, sizeof (MVCC_UPDDEL_REEV_DATA));
 
-  /* Allocate memory for oids, hfids and attributes cache info of all classes used in update */
-  error = qexec_create_internal_classes (thread_p, delete_->classes, class_oid_cnt, &internal_classes);
-  if (error != NO_ERROR)
+  if (num_reev_classes == 0)
     {
-      GOTO_EXIT_ON_ERROR;
+      return NO_ERROR;
     }
 
-  /* lock classes from which this query will delete */
-  aptr = xasl->aptr_list;
-  error = qexec_set_class_locks (thread_p, aptr, delete_->classes, delete_->num_classes, internal_classes);
-  if (error != NO_ERROR)
+  if (mvcc_reev_classes == NULL)
     {
       GOTO_EXIT_ON_ERROR;
     }
 
-  error =
-    prepare_mvcc_reev_data (thread_p, aptr, xasl_state, mvcc_reev_class_cnt, delete_->mvcc_reev_classes,
-			    &mvcc_upddel_reev_data, delete_->num_classes, delete_->classes, internal_classes, 0, NULL,
-			    NULL, &mvcc_reev_classes, NULL, 0);
-  if (error != NO_ERROR)
+  /* allocate and initialize classes for reevaluation */
+  cond_reev_classes =
+    (UPDDEL_MVCC_COND_REEVAL *) db_private_alloc (thread_p, sizeof (UPDDEL_MVCC_COND_REEVAL) * num_reev_classes);
+  if (cond_reev_classes == NULL)
     {
       GOTO_EXIT_ON_ERROR;
     }
-
-  if (class_oid_cnt == 1 && delete_->classes->num_subclasses == 1)
+  /* init information for reevaluation */
+  for (idx = 0; idx < num_reev_classes; idx++)
     {
-      /* We delete instances of only one class. We expect to lock the instances at select phase. However this not
-       * happens in all situations. The qexec_execute_mainblock function will set instances_locked of
-       * p_class_instance_lock_info to true in case that current class instances are locked at select phase. */
-      COPY_OID (&class_instance_lock_info.class_oid, (*((*delete_).classes)).class_oid);
-      class_instance_lock_info.instances_locked = false;
-      p_class_instance_lock_info = &class_instance_lock_info;
+      cond_reev_class = &cond_reev_classes[idx];
+      cond_reev_class->class_index = mvcc_reev_indexes[idx];
+      OID_SET_NULL (&cond_reev_class->cls_oid);
+      cond_reev_class->inst_oid = NULL;
+      cond_reev_class->rest_attrs = NULL;
+      cond_reev_class->rest_regu_list = NULL;
+      cond_reev_class->next = NULL;
     }
-
-  if (qexec_execute_mainblock (thread_p, aptr, xasl_state, p_class_instance_lock_info) != NO_ERROR)
+  for (idx = 0; idx < num_classes; idx++)
     {
-      GOTO_EXIT_ON_ERROR;
-    }
-
+      cls = &classes[idx];
+      int_cls = &internal_classes[idx];
+      if (cls->num_extra_assign_reev > 0)
+	{
+	  int_cls->mvcc_extra_assign_reev =
+	    (UPDDEL_MVCC_COND_REEVAL **) db_private_alloc (thread_p,
+							   cls->num_extra_assign_reev
+							   * sizeof (UPDDEL_MVCC_COND_REEVAL *));
+	  if (int_cls->mvcc_extra_assign_reev == NULL)
+	    {
+	      GOTO_EXIT_ON_ERROR;
+	    }
+	  for (idx2 = cls->num_extra_assign_reev - 1; idx2 >= 0; idx2--)
+	    {
+	      for (idx3 = 0; idx3 < num_reev_classes; idx3++)
+		{
+		  if (cond_reev_classes[idx3].class_index == cls->mvcc_extra_assign_reev[idx2])
+		    {
+		      int_cls->mvcc_extra_assign_reev[idx2] = &cond_reev_classes[idx3];
+		      break;
+		    }
+		}
+	    }
+	  int_cls->extra_assign_reev_cnt = cls->num_extra_assign_reev;
+	}
+    }
+  reev_data->mvcc_cond_reev_list = NULL;
+  reev_data->curr_extra_assign_cnt = 0;
+  reev_data->curr_extra_assign_reev = NULL;
+  reev_data->curr_assigns = NULL;
+  reev_data->curr_attrinfo = NULL;
+  reev_data->copyarea = NULL;
+  reev_data->cons_pred = cons_pred;
+  reev_data->vd = &xasl_state->vd;
+
+  if (qexec_create_mvcc_reev_assignments (thread_p, aptr, has_delete, internal_classes, num_classes, num_assigns,
+					  assigns, mvcc_reev_assigns) != NO_ERROR)
+    {
+      GOTO_EXIT_ON_ERROR;
+    }
+
+  *mvcc_reev_classes = cond_reev_classes;
+  return NO_ERROR;
+
+exit_on_error:
+
+  if (cond_reev_classes != NULL)
+    {
+      db_private_free (thread_p, cond_reev_classes);
+    }
+  for (idx = 0; idx < num_classes; idx++)
+    {
+      int_cls = &internal_classes[idx];
+      if (int_cls->mvcc_extra_assign_reev != NULL)
+	{
+	  db_private_free_and_init (thread_p, int_cls->mvcc_extra_assign_reev);
+	}
+    }
+  *mvcc_reev_classes = NULL;
+
+  return ER_FAILED;
+}
+
+/*
+ * qexec_execute_update () -
+ *   return: NO_ERROR, or ER_code
+ *   xasl(in): XASL Tree block
+ *   has_delete(in): update/delete
+ *   xasl_state(in):
+ */
+static int
+qexec_execute_update (THREAD_ENTRY * thread_p, XASL_NODE * xasl, bool has_delete, XASL_STATE * xasl_state)
+{
+  UPDATE_PROC_NODE *update = &xasl->proc.update;
+  UPDDEL_CLASS_INFO *upd_cls = NULL;
+  UPDATE_ASSIGNMENT *assign = NULL;
+  SCAN_CODE xb_scan;
+  SCAN_CODE ls_scan;
+  XASL_NODE *aptr = NULL;
+  DB_VALUE *valp = NULL;
+  QPROC_DB_VALUE_LIST vallist;
+  int assign_idx = 0;
+  int rc;
+  int attr_id;
+  OID *oid = NULL;
+  OID *class_oid = NULL;
+  UPDDEL_CLASS_INFO_INTERNAL *internal_classes = NULL, *internal_class = NULL;
+  ACCESS_SPEC_TYPE *specp = NULL;
+  SCAN_ID *s_id = NULL;
+  LOG_LSA lsa;
+  int savepoint_used = 0;
+  int satisfies_constraints;
+  int force_count;
+  int op_type = SINGLE_ROW_UPDATE;
+  int s = 0;
+  int tuple_cnt, error = NO_ERROR;
+  REPL_INFO_TYPE repl_info;
+  int class_oid_cnt = 0, class_oid_idx = 0;
+  int mvcc_reev_class_cnt = 0, mvcc_reev_class_idx = 0;
+  bool scan_open = false;
+  int should_delete = 0;
+  int current_op_type = SINGLE_ROW_UPDATE;
+  PRUNING_CONTEXT *pcontext = NULL;
+  DEL_LOB_INFO *del_lob_info_list = NULL;
+  MVCC_UPDDEL_REEV_DATA mvcc_upddel_reev_data;
+  MVCC_REEV_DATA mvcc_reev_data;
+  UPDDEL_MVCC_COND_REEVAL *mvcc_reev_classes = NULL, *mvcc_reev_class = NULL;
+  UPDATE_MVCC_REEV_ASSIGNMENT *mvcc_reev_assigns = NULL;
+  bool need_locking;
+  UPDDEL_CLASS_INSTANCE_LOCK_INFO class_instance_lock_info, *p_class_instance_lock_info = NULL;
+
+  thread_p->no_logging = (bool) update->no_logging;
+
+  /* get the snapshot, before acquiring locks, since the transaction may be blocked and we need the snapshot when
+   * update starts, not later */
+  (void) logtb_get_mvcc_snapshot (thread_p);
+
+  mvcc_upddel_reev_data.copyarea = NULL;
+  mvcc_reev_data.set_update_reevaluation (mvcc_upddel_reev_data);
+  class_oid_cnt = update->num_classes;
+  mvcc_reev_class_cnt = update->num_reev_classes;
+
+  /* Allocate memory for oids, hfids and attributes cache info of all classes used in update */
+  error = qexec_create_internal_classes (thread_p, update->classes, class_oid_cnt, &internal_classes);
+  if (error != NO_ERROR)
+    {
+      GOTO_EXIT_ON_ERROR;
+    }
+
+  /* lock classes which this query will update */
+  aptr = xasl->aptr_list;
+  error = qexec_set_class_locks (thread_p, aptr, update->classes, update->num_classes, internal_classes);
+  if (error != NO_ERROR)
+    {
+      GOTO_EXIT_ON_ERROR;
+    }
+
+  error =
+    prepare_mvcc_reev_data (thread_p, aptr, xasl_state, mvcc_reev_class_cnt, update->mvcc_reev_classes,
+			    &mvcc_upddel_reev_data, update->num_classes, update->classes, internal_classes,
+			    update->num_assigns, update->assigns, update->cons_pred, &mvcc_reev_classes,
+			    &mvcc_reev_assigns, has_delete);
+  if (error != NO_ERROR)
+    {
+      GOTO_EXIT_ON_ERROR;
+    }
+
+  if (class_oid_cnt == 1 && update->classes->num_subclasses == 1)
+    {
+      /* We update instances of only one class. We expect to lock the instances at select phase. However this not
+       * happens in all situations. The qexec_execute_mainblock function will set instances_locked of
+       * p_class_instance_lock_info to true in case that current class instances are locked at select phase. */
+      COPY_OID (&class_instance_lock_info.class_oid, (*((*update).classes)).class_oid);
+      class_instance_lock_info.instances_locked = false;
+      p_class_instance_lock_info = &class_instance_lock_info;
+    }
+
+  if (qexec_execute_mainblock (thread_p, aptr, xasl_state, p_class_instance_lock_info) != NO_ERROR)
+    {
+      GOTO_EXIT_ON_ERROR;
+    }
+
   if (p_class_instance_lock_info && p_class_instance_lock_info->instances_locked)
     {
-      /* already locked in select phase. Avoid locking again the same instances at delete phase. */
+      /* already locked in select phase. Avoid locking again the same instances at update phase */
       need_locking = false;
     }
   else
@@ -9695,37 +9521,37 @@ qexec_execute_delete (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xa
 
   /* This guarantees that the result list file will have a type list. Copying a list_id structure fails unless it has a
    * type list. */
-  if ((qexec_setup_list_id (thread_p, xasl) != NO_ERROR)
-      /* it can be > 2 || (aptr->list_id->type_list.type_cnt != 2) */ )
+  if (qexec_setup_list_id (thread_p, xasl) != NO_ERROR)
     {
       GOTO_EXIT_ON_ERROR;
     }
 
-
-  /* Allocate and init structures for statistical information */
-  if (aptr->list_id->tuple_cnt > MIN_NUM_ROWS_FOR_MULTI_DELETE)
+  if (aptr->list_id->tuple_cnt > 1)
     {
-      op_type = MULTI_ROW_DELETE;
+      /* When multiple instances are updated, statement level uniqueness checking should be performed. In this case,
+       * uniqueness checking is performed by using statistical information generated by the execution of UPDATE
+       * statement. */
+      op_type = MULTI_ROW_UPDATE;
     }
   else
-    {
-      /* When the number of instances to be deleted is small, SINGLE_ROW_DELETE operation would be better, I guess.. */
-      op_type = SINGLE_ROW_DELETE;
+    {				/* tuple_cnt <= 1 */
+      /* When single instance is updated, instance level uniqueness checking is performed. In this case, uniqueness
+       * checking is performed by the server when the key of the instance is inserted into an unique index. */
+      op_type = SINGLE_ROW_UPDATE;
     }
 
-  /* need to start a topop to ensure statement atomicity. One delete statement might update several disk images. For
-   * example, one row delete might update zero or more index keys, one heap record, catalog info of object count, and
-   * other things. So, the delete statement must be performed atomically. */
+  /* need to start a topop to ensure statement atomicity. One update statement might update several disk images. For
+   * example, one row update might update zero or more index keys, one heap record, and other things. So, the update
+   * statement must be performed atomically. */
   if (xtran_server_start_topop (thread_p, &lsa) != NO_ERROR)
     {
       GOTO_EXIT_ON_ERROR;
     }
-
   savepoint_used = 1;
 
   specp = xasl->spec_list;
-  assert (xasl->scan_op_type == S_SELECT);
   /* force_select_lock = false */
+  assert (xasl->scan_op_type == S_SELECT);
   if (qexec_open_scan (thread_p, specp, xasl->val_list, &xasl_state->vd, false, specp->fixed_scan, specp->grouped_scan,
 		       true, &specp->s_id, xasl_state->query_id, S_SELECT, false, NULL) != NO_ERROR)
     {
@@ -9734,83 +9560,177 @@ qexec_execute_delete (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xa
 
   scan_open = true;
 
+  tuple_cnt = 1;
   while ((xb_scan = qexec_next_scan_block_iterations (thread_p, xasl)) == S_SUCCESS)
     {
       s_id = &xasl->curr_spec->s_id;
-
       while ((ls_scan = scan_next_scan (thread_p, s_id)) == S_SUCCESS)
 	{
-	  val_list = s_id->val_list->valp;
-
-	  /* Get info for MVCC condition reevaluation */
-	  for (class_oid_idx = 0, mvcc_reev_class_idx = 0;
-	       class_oid_idx < class_oid_cnt || mvcc_reev_class_idx < mvcc_reev_class_cnt;
-	       val_list = val_list->next->next, class_oid_idx++)
+	  if (op_type == MULTI_ROW_UPDATE)
 	    {
-	      if (mvcc_reev_class_idx < mvcc_reev_class_cnt
-		  && mvcc_reev_classes[mvcc_reev_class_idx].class_index == class_oid_idx)
+	      if (tuple_cnt == 1)
 		{
-		  mvcc_reev_class = &mvcc_reev_classes[mvcc_reev_class_idx++];
+		  repl_info = REPL_INFO_TYPE_RBR_START;
+		}
+	      else if (tuple_cnt == aptr->list_id->tuple_cnt)
+		{
+		  repl_info = REPL_INFO_TYPE_RBR_END;
 		}
 	      else
 		{
-		  mvcc_reev_class = NULL;
+		  repl_info = REPL_INFO_TYPE_RBR_NORMAL;
 		}
+	    }
+	  else
+	    {
+	      repl_info = REPL_INFO_TYPE_RBR_NORMAL;
+	    }
+	  tuple_cnt++;
 
-	      valp = val_list->val;
-	      if (valp == NULL)
+	  /* evaluate constraint predicate */
+	  satisfies_constraints = V_UNKNOWN;
+	  if (update->cons_pred != NULL)
+	    {
+	      satisfies_constraints = eval_pred (thread_p, update->cons_pred, &xasl_state->vd, NULL);
+	      if (satisfies_constraints == V_ERROR)
 		{
 		  GOTO_EXIT_ON_ERROR;
 		}
-	      if (DB_IS_NULL (valp))
+	    }
+
+	  if (update->cons_pred != NULL && satisfies_constraints != V_TRUE)
+	    {
+	      /* currently there are only NOT NULL constraints */
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_NULL_CONSTRAINT_VIOLATION, 0);
+	      GOTO_EXIT_ON_ERROR;
+	    }
+
+	  /* should delete? */
+	  current_op_type = op_type;
+	  if (has_delete)
+	    {
+	      vallist = s_id->val_list->valp;
+	      for (class_oid_idx = 0; class_oid_idx < class_oid_cnt; vallist = vallist->next->next, class_oid_idx++)
 		{
-		  if (class_oid_idx < class_oid_cnt)
-		    {
-		      internal_class = &internal_classes[class_oid_idx];
-		      internal_class->class_oid = NULL;
-		      internal_class->oid = NULL;
-		    }
-		  continue;
+		  ;		/* advance */
 		}
-	      oid = db_get_oid (valp);
-
-	      /* class OID */
-	      valp = val_list->next->val;
+	      valp = vallist->val;
 	      if (valp == NULL)
 		{
 		  GOTO_EXIT_ON_ERROR;
 		}
-	      if (DB_IS_NULL (valp))
+
+	      /* We may get NULL as an expr value. See pt_to_merge_update_query(...). */
+	      if (DB_IS_NULL (valp))
 		{
-		  if (class_oid_idx < class_oid_cnt)
+		  should_delete = 0;
+		}
+	      else
+		{
+		  should_delete = db_get_int (valp);
+		}
+
+	      if (should_delete)
+		{
+		  if (op_type == SINGLE_ROW_UPDATE)
 		    {
-		      internal_classes[class_oid_idx].class_oid = NULL;
+		      current_op_type = SINGLE_ROW_DELETE;
+		    }
+		  else
+		    {
+		      current_op_type = MULTI_ROW_DELETE;
 		    }
-		  continue;
 		}
-	      class_oid = db_get_oid (valp);
+	    }
 
-	      if (class_oid_idx < class_oid_cnt)
+	  /* for each class calc. OID, HFID, attributes cache info and statistical information only if class has
+	   * changed */
+	  vallist = s_id->val_list->valp;
+	  for (class_oid_idx = 0, mvcc_reev_class_idx = 0; class_oid_idx < class_oid_cnt;
+	       vallist = vallist->next->next, class_oid_idx++)
+	    {
+	      upd_cls = &update->classes[class_oid_idx];
+	      internal_class = &internal_classes[class_oid_idx];
+
+	      if (mvcc_reev_class_cnt && mvcc_reev_classes[mvcc_reev_class_idx].class_index == class_oid_idx)
 		{
-		  internal_class = &internal_classes[class_oid_idx];
+		  mvcc_reev_class = &mvcc_reev_classes[mvcc_reev_class_idx++];
+		}
+	      else
+		{
+		  mvcc_reev_class = NULL;
+		}
 
-		  internal_class->oid = oid;
+	      /* instance OID */
+	      valp = vallist->val;
+	      if (valp == NULL)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+	      if (DB_IS_NULL (valp))
+		{
+		  internal_class->oid = NULL;
+		  continue;
+		}
+	      internal_class->oid = db_get_oid (valp);
+	      if (mvcc_reev_class != NULL)
+		{
+		  mvcc_reev_class->inst_oid = internal_class->oid;
+		}
 
-		  if (class_oid
-		      && (internal_class->class_oid == NULL || !OID_EQ (internal_class->class_oid, class_oid)))
+	      /* class OID */
+	      valp = vallist->next->val;
+	      if (valp == NULL)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+	      if (DB_IS_NULL (valp))
+		{
+		  continue;
+		}
+	      class_oid = db_get_oid (valp);
+
+	      /* class has changed to a new subclass */
+	      if (class_oid
+		  && (!OID_EQ (&internal_class->prev_class_oid, class_oid)
+		      || (!should_delete && BTREE_IS_MULTI_ROW_OP (op_type) && upd_cls->has_uniques
+			  && internal_class->scan_cache != NULL && internal_class->scan_cache->m_index_stats == NULL)))
+		{
+		  /* Load internal_class object with information for class_oid */
+		  error =
+		    qexec_upddel_setup_current_class (thread_p, upd_cls, internal_class, current_op_type, class_oid);
+		  if (error != NO_ERROR || internal_class->class_hfid == NULL)
 		    {
-		      query_class = &delete_->classes[class_oid_idx];
+		      /* matching class oid does not exist... error */
+		      er_log_debug (ARG_FILE_LINE, "qexec_execute_update: class OID is not correct\n");
+		      GOTO_EXIT_ON_ERROR;
+		    }
 
-		      /* find class HFID */
-		      error =
-			qexec_upddel_setup_current_class (thread_p, query_class, internal_class, op_type, class_oid);
+		  /* temporary disable set filters when needs prunning */
+		  if (mvcc_reev_class != NULL)
+		    {
+		      error = qexec_upddel_mvcc_set_filters (thread_p, aptr, mvcc_reev_class, class_oid);
 		      if (error != NO_ERROR)
 			{
-			  /* matching class oid does not exist... error */
-			  er_log_debug (ARG_FILE_LINE, "qexec_execute_delete: class OID is not correct\n");
 			  GOTO_EXIT_ON_ERROR;
 			}
+		    }
+
+		  /* clear attribute cache information if valid old subclass */
+		  if (!OID_ISNULL (&internal_class->prev_class_oid) && internal_class->is_attr_info_inited)
+		    {
+		      (void) heap_attrinfo_end (thread_p, &internal_class->attr_info);
+		      internal_class->is_attr_info_inited = false;
+		    }
+		  /* start attribute cache information for new subclass */
+		  if (heap_attrinfo_start (thread_p, class_oid, -1, NULL, &internal_class->attr_info) != NO_ERROR)
+		    {
+		      GOTO_EXIT_ON_ERROR;
+		    }
+		  internal_class->is_attr_info_inited = true;
 
+		  if (should_delete)
+		    {
 		      if (internal_class->num_lob_attrs)
 			{
 			  internal_class->crt_del_lob_info =
@@ -9827,142 +9747,280 @@ qexec_execute_delete (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xa
 		    }
 		}
 
-	      if (mvcc_reev_class != NULL)
+	      /* don't update, just delete */
+	      if (should_delete)
 		{
-		  /* class has changed to a new subclass */
-		  if (class_oid && !OID_EQ (&mvcc_reev_class->cls_oid, class_oid))
+		  /* handle lobs first */
+		  if (internal_class->crt_del_lob_info)
 		    {
-		      error = qexec_upddel_mvcc_set_filters (thread_p, aptr, mvcc_reev_class, class_oid);
-		      if (error != NO_ERROR)
+		      /* delete lob files */
+		      DEL_LOB_INFO *crt_del_lob_info = internal_class->crt_del_lob_info;
+		      SCAN_CODE scan_code;
+		      int error;
+		      int i;
+		      RECDES recdes = RECDES_INITIALIZER;
+
+		      /* read lob attributes */
+		      scan_code =
+			heap_get_visible_version (thread_p, oid, class_oid, &recdes, internal_class->scan_cache, PEEK,
+						  NULL_CHN);
+		      if (scan_code == S_ERROR)
 			{
 			  GOTO_EXIT_ON_ERROR;
 			}
+		      if (scan_code == S_SUCCESS)
+			{
+			  error =
+			    heap_attrinfo_read_dbvalues (thread_p, oid, &recdes, NULL, &crt_del_lob_info->attr_info);
+			  if (error != NO_ERROR)
+			    {
+			      GOTO_EXIT_ON_ERROR;
+			    }
+			  for (i = 0; i < internal_class->num_lob_attrs; i++)
+			    {
+			      DB_VALUE *attr_valp = &crt_del_lob_info->attr_info.values[i].dbvalue;
+			      if (!db_value_is_null (attr_valp))
+				{
+				  DB_ELO *elo;
+				  error = NO_ERROR;
+
+				  assert (db_value_type (attr_valp) == DB_TYPE_BLOB
+					  || db_value_type (attr_valp) == DB_TYPE_CLOB);
+				  elo = db_get_elo (attr_valp);
+				  if (elo)
+				    {
+				      error = db_elo_delete (elo);
+				    }
+				  if (error != NO_ERROR)
+				    {
+				      GOTO_EXIT_ON_ERROR;
+				    }
+				}
+			    }
+			}
+		    }
+
+		  force_count = 0;
+		  error =
+		    locator_attribute_info_force (thread_p, internal_class->class_hfid, internal_class->oid, NULL, NULL,
+						  0, LC_FLUSH_DELETE, current_op_type, internal_class->scan_cache,
+						  &force_count, false, REPL_INFO_TYPE_RBR_NORMAL,
+						  DB_NOT_PARTITIONED_CLASS, NULL, NULL, &mvcc_reev_data,
+						  UPDATE_INPLACE_NONE, NULL, need_locking);
+
+		  if (error == ER_MVCC_NOT_SATISFIED_REEVALUATION)
+		    {
+		      error = NO_ERROR;
+		    }
+		  else if (error != NO_ERROR)
+		    {
+		      GOTO_EXIT_ON_ERROR;
+		    }
+		  else if (force_count)
+		    {
+		      xasl->list_id->tuple_cnt++;
 		    }
 		}
-	    }
 
-	  if (mvcc_upddel_reev_data.mvcc_cond_reev_list == NULL)
-	    {
-	      /* If scan order was not set then do it. This operation must be run only once. We do it here and not at
-	       * the beginning of this function because the class OIDs must be set for classes involved in reevaluation
-	       * (in mvcc_reev_classes) prior to this operation */
-	      mvcc_upddel_reev_data.mvcc_cond_reev_list =
-		qexec_mvcc_cond_reev_set_scan_order (aptr, mvcc_reev_classes, mvcc_reev_class_cnt, delete_->classes,
-						     class_oid_cnt);
+	      if (heap_attrinfo_clear_dbvalues (&internal_class->attr_info) != NO_ERROR)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+
+	      if (should_delete)
+		{
+		  goto continue_scan;
+		}
 	    }
 
-	  for (class_oid_idx = 0, mvcc_reev_class_idx = 0; class_oid_idx < class_oid_cnt; class_oid_idx++)
+	  /* Get info for MVCC condition reevaluation */
+	  for (; mvcc_reev_class_idx < mvcc_reev_class_cnt; mvcc_reev_class_idx++)
 	    {
-	      internal_class = &internal_classes[class_oid_idx];
-	      oid = internal_class->oid;
-	      class_oid = internal_class->class_oid;
+	      mvcc_reev_class = &mvcc_reev_classes[mvcc_reev_class_idx];
 
-	      if (mvcc_reev_class_cnt && mvcc_reev_classes[mvcc_reev_class_idx].class_index == class_oid_idx)
+	      /* instance OID */
+	      valp = vallist->val;
+	      if (valp == NULL)
 		{
-		  mvcc_reev_class = &mvcc_reev_classes[mvcc_reev_class_idx++];
+		  GOTO_EXIT_ON_ERROR;
+		}
+	      /* FIXME: Function version of db_get_oid returns (probably) NULL_OID when the value is NULL,
+	       * while macro version returns NULL pointer. This may cause different behavior.
+	       * As a quick fix, I'm going to add DB_IS_NULL block to keep the existing behavior.
+	       * We need to investigate and get rid of differences of two implementation.
+	       * Inlining would be a good choice.
+	       */
+	      if (DB_IS_NULL (valp))
+		{
+		  OID_SET_NULL (mvcc_reev_class->inst_oid);
 		}
 	      else
 		{
-		  mvcc_reev_class = NULL;
+		  mvcc_reev_class->inst_oid = db_get_oid (valp);
 		}
-	      mvcc_upddel_reev_data.curr_upddel = mvcc_reev_class;
 
-	      if (oid == NULL)
+	      /* class OID */
+	      valp = vallist->next->val;
+	      if (valp == NULL)
 		{
-		  continue;
+		  GOTO_EXIT_ON_ERROR;
 		}
 
-	      if (internal_class->crt_del_lob_info)
+	      /* FIXME: please see above FIXME */
+	      if (DB_IS_NULL (valp))
 		{
-		  /* delete lob files */
-		  DEL_LOB_INFO *crt_del_lob_info = internal_class->crt_del_lob_info;
-		  SCAN_CODE scan_code;
-		  int error;
-		  int i;
-		  RECDES recdes = RECDES_INITIALIZER;
+		  OID_SET_NULL (class_oid);
+		}
+	      else
+		{
+		  class_oid = db_get_oid (valp);
+		}
 
-		  /* read lob attributes */
-		  scan_code =
-		    heap_get_visible_version (thread_p, oid, class_oid, &recdes, internal_class->scan_cache, PEEK,
-					      NULL_CHN);
-		  if (scan_code == S_ERROR)
-		    {
-		      GOTO_EXIT_ON_ERROR;
-		    }
-		  if (scan_code == S_SUCCESS)
+	      /* class has changed to a new subclass */
+	      if (class_oid && !OID_EQ (&mvcc_reev_class->cls_oid, class_oid))
+		{
+		  error = qexec_upddel_mvcc_set_filters (thread_p, aptr, mvcc_reev_class, class_oid);
+		  if (error != NO_ERROR)
 		    {
-		      error = heap_attrinfo_read_dbvalues (thread_p, oid, &recdes, NULL, &crt_del_lob_info->attr_info);
-		      if (error != NO_ERROR)
-			{
-			  GOTO_EXIT_ON_ERROR;
-			}
-		      for (i = 0; i < internal_class->num_lob_attrs; i++)
-			{
-			  DB_VALUE *attr_valp = &crt_del_lob_info->attr_info.values[i].dbvalue;
-			  if (!db_value_is_null (attr_valp))
-			    {
-			      DB_ELO *elo;
-			      error = NO_ERROR;
+		      GOTO_EXIT_ON_ERROR;
+		    }
+		}
+	      vallist = vallist->next->next;
+	    }
 
-			      assert (db_value_type (attr_valp) == DB_TYPE_BLOB
-				      || db_value_type (attr_valp) == DB_TYPE_CLOB);
-			      elo = db_get_elo (attr_valp);
-			      if (elo)
-				{
-				  error = db_elo_delete (elo);
-				}
-			      if (error != NO_ERROR)
-				{
-				  GOTO_EXIT_ON_ERROR;
-				}
-			    }
-			}
+	  if (mvcc_upddel_reev_data.mvcc_cond_reev_list == NULL && mvcc_reev_class_cnt > 0)
+	    {
+	      /* If scan order was not set then do it. This operation must be run only once. We do it here and not at
+	       * the beginning of this function because the class OIDs must be set for classes involved in reevaluation
+	       * (in mvcc_reev_classes) prior to this operation */
+	      mvcc_upddel_reev_data.mvcc_cond_reev_list =
+		qexec_mvcc_cond_reev_set_scan_order (aptr, mvcc_reev_classes, mvcc_reev_class_cnt, update->classes,
+						     update->num_classes);
+	    }
+	  if (has_delete)
+	    {
+	      vallist = vallist->next;	/* skip should_delete */
+	    }
+
+	  /* perform assignments */
+	  for (assign_idx = 0; assign_idx < update->num_assigns; assign_idx++)
+	    {
+	      HEAP_CACHE_ATTRINFO *attr_info;
+
+	      assign = &update->assigns[assign_idx];
+	      class_oid_idx = assign->cls_idx;
+	      internal_class = &internal_classes[class_oid_idx];
+	      attr_info = &internal_class->attr_info;
+	      upd_cls = &update->classes[class_oid_idx];
+	      oid = internal_class->oid;
+	      if (oid == NULL)
+		{
+		  /* nothing to update */
+		  if (assign->constant == NULL)
+		    {
+		      vallist = vallist->next;
 		    }
+		  continue;
+		}
+	      attr_id = upd_cls->att_id[internal_class->subclass_idx * upd_cls->num_attrs + assign->att_idx];
+	      if (mvcc_reev_assigns != NULL)
+		{
+		  mvcc_reev_assigns[assign_idx].att_id = attr_id;
+		}
+
+	      if (assign->constant != NULL)
+		{
+		  rc = heap_attrinfo_set (oid, attr_id, assign->constant, attr_info);
+		}
+	      else
+		{
+		  rc = heap_attrinfo_set (oid, attr_id, vallist->val, attr_info);
+		  vallist = vallist->next;
+		}
+	      if (rc != NO_ERROR)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+	    }
+
+	  /* Flush new values for each class. The class list was built from right to left during XASL generation, so in
+	   * order to maintain the correct update order specified in the query, we must iterate from right to left as
+	   * well; this makes a difference only when we update the same attribute of the same class more than once. */
+	  for (class_oid_idx = class_oid_cnt - 1, mvcc_reev_class_idx = mvcc_reev_class_cnt - 1; class_oid_idx >= 0;
+	       class_oid_idx--)
+	    {
+	      internal_class = &internal_classes[class_oid_idx];
+	      upd_cls = &update->classes[class_oid_idx];
+
+	      if (mvcc_reev_class_cnt && mvcc_reev_classes[mvcc_reev_class_idx].class_index == class_oid_idx)
+		{
+		  mvcc_reev_class = &mvcc_reev_classes[mvcc_reev_class_idx++];
+		}
+	      else
+		{
+		  mvcc_reev_class = NULL;
 		}
+	      mvcc_upddel_reev_data.curr_upddel = mvcc_reev_class;
 
 	      force_count = 0;
+	      oid = internal_class->oid;
+	      if (oid == NULL)
+		{
+		  continue;
+		}
+
+	      if (upd_cls->needs_pruning)
+		{
+		  pcontext = &internal_class->context;
+		}
+	      else
+		{
+		  pcontext = NULL;
+		}
+
+	      mvcc_upddel_reev_data.curr_extra_assign_reev = internal_class->mvcc_extra_assign_reev;
+	      mvcc_upddel_reev_data.curr_extra_assign_cnt = internal_class->extra_assign_reev_cnt;
+	      mvcc_upddel_reev_data.curr_assigns = internal_class->mvcc_reev_assigns;
+	      mvcc_upddel_reev_data.curr_attrinfo = &internal_class->attr_info;
 	      error =
-		locator_attribute_info_force (thread_p, internal_class->class_hfid, oid, NULL, NULL, 0, LC_FLUSH_DELETE,
-					      op_type, internal_class->scan_cache, &force_count, false,
-					      REPL_INFO_TYPE_RBR_NORMAL, DB_NOT_PARTITIONED_CLASS, NULL, NULL,
-					      &mvcc_reev_data, UPDATE_INPLACE_NONE, NULL, need_locking);
+		locator_attribute_info_force (thread_p, internal_class->class_hfid, oid, &internal_class->attr_info,
+					      &upd_cls->att_id[internal_class->subclass_idx * upd_cls->num_attrs],
+					      upd_cls->num_attrs, LC_FLUSH_UPDATE, op_type, internal_class->scan_cache,
+					      &force_count, false, repl_info, internal_class->needs_pruning, pcontext,
+					      NULL, &mvcc_reev_data, UPDATE_INPLACE_NONE, NULL, need_locking);
 	      if (error == ER_MVCC_NOT_SATISFIED_REEVALUATION)
 		{
 		  error = NO_ERROR;
 		}
+	      else if (error == ER_HEAP_UNKNOWN_OBJECT)
+		{
+		  /* TODO: This is a very dangerous. A different way of handling it must be found.
+		   *       This may not even be necessary. I guess this is legacy code from READ COMMITTED
+		   *       re-evaluation made under locator_attribute_info_force. I think currently locking object
+		   *       is done on select phase. However, I am not removing this code yet until more investigation
+		   *       is done.
+		   */
+		  er_clear ();
+		  error = NO_ERROR;
+		}
 	      else if (error != NO_ERROR)
 		{
 		  GOTO_EXIT_ON_ERROR;
 		}
-	      else if (force_count)
+	      else
 		{
-		  xasl->list_id->tuple_cnt++;
+		  /* Successful update. */
+		  force_count = 1;
 		}
-	    }
 
-	  while (val_list)
-	    {
-	      valp = val_list->val;
-	      if (!db_value_is_null (valp))
+	      /* Instances are not put into the result list file, but are counted. */
+	      if (force_count)
 		{
-		  DB_ELO *elo;
-		  int error = NO_ERROR;
-
-		  assert (db_value_type (valp) == DB_TYPE_BLOB || db_value_type (valp) == DB_TYPE_CLOB);
-		  elo = db_get_elo (valp);
-		  if (elo)
-		    {
-		      error = db_elo_delete (elo);
-		    }
-		  pr_clear_value (valp);
-		  if (error < NO_ERROR)
-		    {
-		      GOTO_EXIT_ON_ERROR;
-		    }
+		  xasl->list_id->tuple_cnt++;
 		}
-
-	      val_list = val_list->next;
 	    }
+	continue_scan:
+	  ;
 	}
       if (ls_scan != S_END)
 	{
@@ -9974,28 +10032,34 @@ qexec_execute_delete (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xa
       GOTO_EXIT_ON_ERROR;
     }
 
-  /* reflect local statistical information into transaction's statistical information */
   for (s = 0; s < class_oid_cnt; s++)
     {
-      internal_class = internal_classes + s;
-      query_class = delete_->classes + s;
-      if (internal_classes[s].needs_pruning)
-	{
-	  error = qexec_process_partition_unique_stats (thread_p, &internal_class->context);
-	}
-      else
-	{
-	  error = qexec_process_unique_stats (thread_p, query_class->class_oid, internal_class);
-	}
-      if (error != NO_ERROR)
+      internal_class = &internal_classes[s];
+      upd_cls = &update->classes[s];
+
+      if (upd_cls->has_uniques)
 	{
-	  GOTO_EXIT_ON_ERROR;
+	  if (internal_class->needs_pruning)
+	    {
+	      error = qexec_process_partition_unique_stats (thread_p, &internal_class->context);
+	    }
+	  else
+	    {
+	      error = qexec_process_unique_stats (thread_p, upd_cls->class_oid, internal_class);
+	    }
+	  if (error != NO_ERROR)
+	    {
+	      GOTO_EXIT_ON_ERROR;
+	    }
 	}
     }
 
   qexec_close_scan (thread_p, specp);
 
-  qexec_free_delete_lob_info_list (thread_p, &del_lob_info_list);
+  if (has_delete)
+    {
+      qexec_free_delete_lob_info_list (thread_p, &del_lob_info_list);
+    }
 
   if (internal_classes)
     {
@@ -10008,6 +10072,11 @@ qexec_execute_delete (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xa
       db_private_free (thread_p, mvcc_reev_classes);
       mvcc_reev_classes = NULL;
     }
+  if (mvcc_reev_assigns != NULL)
+    {
+      db_private_free (thread_p, mvcc_reev_assigns);
+      mvcc_reev_assigns = NULL;
+    }
   if (mvcc_upddel_reev_data.copyarea != NULL)
     {
       locator_free_copy_area (mvcc_upddel_reev_data.copyarea);
@@ -10025,15 +10094,15 @@ qexec_execute_delete (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xa
 
 #if 0				/* yaw */
   /* remove query result cache entries which are relevant with this class */
-  class_oid = XASL_DELETE_CLASS_OID (xasl);
+  class_oid = update->class_oid;
   if (!QFILE_IS_LIST_CACHE_DISABLED && class_oid)
     {
-      for (s = 0; s < XASL_DELETE_NO_CLASSES (xasl); s++, class_oid++)
+      for (s = 0; s < update->num_classes; s++, class_oid++)
 	{
 	  if (qexec_clear_list_cache_by_class (class_oid) != NO_ERROR)
 	    {
 	      er_log_debug (ARG_FILE_LINE,
-			    "qexec_execute_delete: qexec_clear_list_cache_by_class failed for class { %d %d %d }\n",
+			    "qexec_execute_update: qexec_clear_list_cache_by_class failed for class { %d %d %d }\n",
 			    class_oid->pageid, class_oid->slotid, class_oid->volid);
 	    }
 	}
@@ -10044,6 +10113,7 @@ qexec_execute_delete (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xa
   return NO_ERROR;
 
 exit_on_error:
+
   if (scan_open)
     {
       qexec_end_scan (thread_p, specp);
@@ -10055,17 +10125,16 @@ exit_on_error:
       qexec_free_delete_lob_info_list (thread_p, &del_lob_info_list);
     }
 
-  if (internal_classes)
-    {
-      qexec_clear_internal_classes (thread_p, internal_classes, class_oid_cnt);
-      db_private_free_and_init (thread_p, internal_classes);
-    }
-
   if (mvcc_reev_classes != NULL)
     {
       db_private_free (thread_p, mvcc_reev_classes);
       mvcc_reev_classes = NULL;
     }
+  if (mvcc_reev_assigns != NULL)
+    {
+      db_private_free (thread_p, mvcc_reev_assigns);
+      mvcc_reev_assigns = NULL;
+    }
   if (mvcc_upddel_reev_data.copyarea != NULL)
     {
       locator_free_copy_area (mvcc_upddel_reev_data.copyarea);
@@ -10077,435 +10146,817 @@ exit_on_error:
       xtran_server_end_topop (thread_p, LOG_RESULT_TOPOP_ABORT, &lsa);
     }
 
+  if (internal_classes)
+    {
+      qexec_clear_internal_classes (thread_p, internal_classes, class_oid_cnt);
+      db_private_free_and_init (thread_p, internal_classes);
+    }
+
   return ER_FAILED;
 }
 
 /*
- * qexec_create_delete_lob_info () - creates a new DEL_LOB_INFO object using
- *			data from class_info
- *
- * thread_p (in)      :
- * xasl_state (in)    :
- * class_info (in)    :
- *
- * return	      : new DEL_LOB_INFO object
+ * qexec_update_btree_unique_stats_info () - updates statistical information structure
+ *   return: NO_ERROR or ER_code
+ *   thread_p(in)   :
+ *   info(in)     : structure to update
  */
-static DEL_LOB_INFO *
-qexec_create_delete_lob_info (THREAD_ENTRY * thread_p, XASL_STATE * xasl_state, UPDDEL_CLASS_INFO_INTERNAL * class_info)
-{
-  DEL_LOB_INFO *del_lob_info;
+static void
+qexec_update_btree_unique_stats_info (THREAD_ENTRY * thread_p, multi_index_unique_stats * info,
+				      const HEAP_SCANCACHE * scan_cache)
+{
+  assert (info != NULL && scan_cache != NULL);
 
-  del_lob_info = (DEL_LOB_INFO *) db_private_alloc (thread_p, sizeof (DEL_LOB_INFO));
-  if (!del_lob_info)
+  if (scan_cache->m_index_stats != NULL)
     {
-      qexec_failure_line (__LINE__, xasl_state);
-      goto error;
+      (*info) += (*scan_cache->m_index_stats);
     }
+}
 
-  del_lob_info->class_oid = class_info->class_oid;
-  del_lob_info->class_hfid = class_info->class_hfid;
+/*
+ * qexec_process_unique_stats () - verify unique statistic information for
+ *				   a class hierarchy and update index
+ * return : error code or NO_ERROR
+ * thread_p (in) :
+ * class_oid (in) :
+ * internal_class (in) :
+ */
+static int
+qexec_process_unique_stats (THREAD_ENTRY * thread_p, const OID * class_oid, UPDDEL_CLASS_INFO_INTERNAL * internal_class)
+{
+  assert (class_oid != NULL && internal_class != NULL);
 
-  if (heap_attrinfo_start (thread_p, class_info->class_oid, class_info->num_lob_attrs, class_info->lob_attr_ids,
-			   &del_lob_info->attr_info) != NO_ERROR)
+  int error = NO_ERROR;
+
+  if (internal_class->m_inited_scancache)
     {
-      goto error;
+      /* Accumulate current statistics */
+      qexec_update_btree_unique_stats_info (thread_p, &internal_class->m_unique_stats, &internal_class->m_scancache);
     }
-
-  del_lob_info->next = NULL;
-
-  return del_lob_info;
-
-error:
-  if (del_lob_info)
+// *INDENT-OFF*
+for (const auto & it:internal_class->m_unique_stats.get_map ())
     {
-      db_private_free (thread_p, del_lob_info);
+      if (!it.second.is_unique ())
+	{
+	  BTREE_SET_UNIQUE_VIOLATION_ERROR (thread_p, NULL, NULL, class_oid, &it.first, NULL);
+	  return ER_BTREE_UNIQUE_FAILED;
+	}
+      error = logtb_tran_update_unique_stats (thread_p, it.first, it.second, true);
+      if (error != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  return error;
+	}
     }
-  return NULL;
+// *INDENT-ON*
+  return NO_ERROR;
 }
 
 /*
- * qexec_change_delete_lob_info () - When the class_oid of the tuple that
- *		needs to be deleted changes, also the current DEL_LOB_INFO
- *		needs to be changed. This can also be used to initialize
- *		the list
- *
- * thread_p (in)	    :
- * xasl_state (in)	    :
- * class_info (in)	    :
- * del_lob_info_list_ptr    : pointer to current list of DEL_LOB_INFO
+ * qexec_process_partition_unique_stats () - process unique statistics on a partitioned class
+ * return : error code or NO_ERROR
+ * thread_p (in) :
+ * pcontext (in) :
  *
- * return		    : DEL_LOB_INFO object specific to current class_info
+ * Note: Since unique indexes for partitioned classes are either local or
+ *    global, it's to expensive to use the validation made on normal class
+ *    hierarchies. This function just reflects the unique statistics to the
+ *    index header
  */
-static DEL_LOB_INFO *
-qexec_change_delete_lob_info (THREAD_ENTRY * thread_p, XASL_STATE * xasl_state, UPDDEL_CLASS_INFO_INTERNAL * class_info,
-			      DEL_LOB_INFO ** del_lob_info_list_ptr)
+static int
+qexec_process_partition_unique_stats (THREAD_ENTRY * thread_p, PRUNING_CONTEXT * pcontext)
 {
-  DEL_LOB_INFO *del_lob_info_list = *del_lob_info_list_ptr;
-  DEL_LOB_INFO *del_lob_info = NULL;
-
-  assert (del_lob_info_list_ptr != NULL);
-  del_lob_info_list = *del_lob_info_list_ptr;
+  assert (pcontext != NULL);
 
-  if (del_lob_info_list == NULL)
-    {
-      /* create new DEL_LOB_INFO */
-      del_lob_info_list = qexec_create_delete_lob_info (thread_p, xasl_state, class_info);
-      *del_lob_info_list_ptr = del_lob_info_list;
-      return del_lob_info_list;
-    }
+  PRUNING_SCAN_CACHE *pruned_scan_cache = NULL;
+  SCANCACHE_LIST *node = NULL;
+  int error = NO_ERROR;
 
-  /* verify if a DEL_LOB_INFO for current class_oid already exists */
-  for (del_lob_info = del_lob_info_list; del_lob_info; del_lob_info = del_lob_info->next)
+  for (node = pcontext->scan_cache_list; node != NULL; node = node->next)
     {
-      if (del_lob_info->class_oid == class_info->class_oid)
+      // *INDENT-OFF*
+      pruned_scan_cache = &node->scan_cache;
+      if (!pruned_scan_cache->is_scan_cache_started)
 	{
-	  /* found */
-	  return del_lob_info;
+	  continue;
 	}
-    }
 
-  /* create a new DEL_LOB_INFO */
-  del_lob_info = qexec_create_delete_lob_info (thread_p, xasl_state, class_info);
-  if (!del_lob_info)
-    {
-      return NULL;
+      HEAP_SCANCACHE &scan_cache = pruned_scan_cache->scan_cache;
+      if (scan_cache.m_index_stats != NULL)
+	{
+          for (const auto &it : scan_cache.m_index_stats->get_map ())
+            {
+              if (!it.second.is_unique ())
+                {
+                  char *index_name = NULL;
+                  error = heap_get_indexinfo_of_btid (thread_p, &scan_cache.node.class_oid, &it.first, NULL, NULL, NULL,
+                                                      NULL, &index_name, NULL);
+                  if (error != NO_ERROR)
+                    {
+                      ASSERT_ERROR ();
+                      return error;
+                    }
+
+                  BTREE_SET_UNIQUE_VIOLATION_ERROR (thread_p, NULL, NULL, &scan_cache.node.class_oid, &it.first,
+                                                    index_name);
+
+                  if (index_name != NULL)
+                    {
+                      free_and_init (index_name);
+                    }
+                  return ER_BTREE_UNIQUE_FAILED;
+                }
+
+              error = logtb_tran_update_unique_stats (thread_p, it.first, it.second, true);
+              if (error != NO_ERROR)
+                {
+                  ASSERT_ERROR ();
+                  return error;
+                }
+            }
+	}
+      // *INDENT-ON*
     }
-  del_lob_info->next = del_lob_info_list;
-  del_lob_info_list = del_lob_info;
-  *del_lob_info_list_ptr = del_lob_info_list;
 
-  return del_lob_info_list;
+  return NO_ERROR;
 }
 
 /*
- * qexec_free_delete_lob_info_list () - frees the list of DEL_LOB_INFO
- *	      created for deleting lob files.
- *
- * thread_p (in)	  :
- * del_lob_info_list_ptr  : pointer to the list of DEL_LOB_INFO structures
- *
- * NOTE: also all HEAP_CACHE_ATTRINFO must be ended
+ * qexec_execute_delete () -
+ *   return: NO_ERROR or ER_code
+ *   xasl(in)   : XASL Tree block
+ *   xasl_state(in)     :
  */
-static void
-qexec_free_delete_lob_info_list (THREAD_ENTRY * thread_p, DEL_LOB_INFO ** del_lob_info_list_ptr)
+static int
+qexec_execute_delete (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state)
 {
-  DEL_LOB_INFO *del_lob_info_list;
-  DEL_LOB_INFO *del_lob_info, *next_del_lob_info;
+#define MIN_NUM_ROWS_FOR_MULTI_DELETE   20
 
-  if (!del_lob_info_list_ptr)
+  DELETE_PROC_NODE *delete_ = &xasl->proc.delete_;
+  SCAN_CODE xb_scan = S_END;
+  SCAN_CODE ls_scan = S_END;
+  XASL_NODE *aptr = NULL;
+  DB_VALUE *valp = NULL;
+  OID *oid = NULL;
+  OID *class_oid = NULL;
+  ACCESS_SPEC_TYPE *specp = NULL;
+  SCAN_ID *s_id = NULL;
+  LOG_LSA lsa;
+  int savepoint_used = 0;
+  int class_oid_cnt = 0, class_oid_idx = 0;
+  int force_count = 0;
+  int op_type = SINGLE_ROW_DELETE;
+  int s = 0, error = NO_ERROR;
+  int mvcc_reev_class_cnt = 0, mvcc_reev_class_idx = 0;
+  QPROC_DB_VALUE_LIST val_list = NULL;
+  bool scan_open = false;
+  UPDDEL_CLASS_INFO *query_class = NULL;
+  UPDDEL_CLASS_INFO_INTERNAL *internal_classes = NULL, *internal_class = NULL;
+  DEL_LOB_INFO *del_lob_info_list = NULL;
+  MVCC_REEV_DATA mvcc_reev_data;
+  MVCC_UPDDEL_REEV_DATA mvcc_upddel_reev_data;
+  UPDDEL_MVCC_COND_REEVAL *mvcc_reev_classes = NULL, *mvcc_reev_class = NULL;
+  bool need_locking;
+  UPDDEL_CLASS_INSTANCE_LOCK_INFO class_instance_lock_info, *p_class_instance_lock_info = NULL;
+
+  thread_p->no_logging = (bool) delete_->no_logging;
+
+  /* get the snapshot, before acquiring locks, since the transaction may be blocked and we need the snapshot when
+   * delete starts, not later */
+  (void) logtb_get_mvcc_snapshot (thread_p);
+
+  class_oid_cnt = delete_->num_classes;
+  mvcc_reev_class_cnt = delete_->num_reev_classes;
+  mvcc_reev_data.set_update_reevaluation (mvcc_upddel_reev_data);
+
+  mvcc_upddel_reev_data.copyarea = NULL;
+
+  /* Allocate memory for oids, hfids and attributes cache info of all classes used in update */
+  error = qexec_create_internal_classes (thread_p, delete_->classes, class_oid_cnt, &internal_classes);
+  if (error != NO_ERROR)
     {
-      /* invalid pointer, nothing to free */
-      return;
+      GOTO_EXIT_ON_ERROR;
     }
 
-  del_lob_info_list = *del_lob_info_list_ptr;
-  if (!del_lob_info_list)
+  /* lock classes from which this query will delete */
+  aptr = xasl->aptr_list;
+  error = qexec_set_class_locks (thread_p, aptr, delete_->classes, delete_->num_classes, internal_classes);
+  if (error != NO_ERROR)
     {
-      /* no item in the list, nothing to free */
-      return;
+      GOTO_EXIT_ON_ERROR;
     }
 
-  del_lob_info = del_lob_info_list;
-  while (del_lob_info)
+  error =
+    prepare_mvcc_reev_data (thread_p, aptr, xasl_state, mvcc_reev_class_cnt, delete_->mvcc_reev_classes,
+			    &mvcc_upddel_reev_data, delete_->num_classes, delete_->classes, internal_classes, 0, NULL,
+			    NULL, &mvcc_reev_classes, NULL, 0);
+  if (error != NO_ERROR)
     {
-      next_del_lob_info = del_lob_info->next;
-      /* end HEAP_CACHE_ATTRINFO first */
-      heap_attrinfo_end (thread_p, &del_lob_info->attr_info);
+      GOTO_EXIT_ON_ERROR;
+    }
 
-      db_private_free (thread_p, del_lob_info);
-      del_lob_info = next_del_lob_info;
+  if (class_oid_cnt == 1 && delete_->classes->num_subclasses == 1)
+    {
+      /* We delete instances of only one class. We expect to lock the instances at select phase. However this not
+       * happens in all situations. The qexec_execute_mainblock function will set instances_locked of
+       * p_class_instance_lock_info to true in case that current class instances are locked at select phase. */
+      COPY_OID (&class_instance_lock_info.class_oid, (*((*delete_).classes)).class_oid);
+      class_instance_lock_info.instances_locked = false;
+      p_class_instance_lock_info = &class_instance_lock_info;
     }
-  *del_lob_info_list_ptr = NULL;
-}
 
+  if (qexec_execute_mainblock (thread_p, aptr, xasl_state, p_class_instance_lock_info) != NO_ERROR)
+    {
+      GOTO_EXIT_ON_ERROR;
+    }
 
-/*
- * qexec_remove_duplicates_for_replace () - Removes the objects that would
- *       generate unique index violations when inserting the given attr_info
- *       (This is used for executing REPLACE statements)
- *   return: NO_ERROR or ER_code
- *   scan_cache(in):
- *   attr_info(in/out): The attribute information that will be inserted
- *   index_attr_info(in/out):
- *   idx_info(in):
- *   op_type (in): operation type
- *   pruning_type (in): one of DB_NOT_PARTITIONED_CLASS, DB_PARTITIONED_CLASS,
- *			DB_PARTITION_CLASS
- *   pcontext (in): pruning context
- *   removed_count (in/out):
- */
-static int
-qexec_remove_duplicates_for_replace (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_cache,
-				     HEAP_CACHE_ATTRINFO * attr_info, HEAP_CACHE_ATTRINFO * index_attr_info,
-				     const HEAP_IDX_ELEMENTS_INFO * idx_info, int op_type, int pruning_type,
-				     PRUNING_CONTEXT * pcontext, int *removed_count)
-{
-  LC_COPYAREA *copyarea = NULL;
-  RECDES new_recdes;
-  int i = 0;
-  int error_code = NO_ERROR;
-  char buf[DBVAL_BUFSIZE + MAX_ALIGNMENT];
-  char *const aligned_buf = PTR_ALIGN (buf, MAX_ALIGNMENT);
-  DB_VALUE dbvalue;
-  DB_VALUE *key_dbvalue = NULL;
-  int force_count = 0;
-  OR_INDEX *index = NULL;
-  OID unique_oid;
-  OID class_oid, pruned_oid;
-  BTID btid;
-  bool is_global_index;
-  HFID class_hfid, pruned_hfid;
-  int local_op_type = SINGLE_ROW_DELETE;
-  HEAP_SCANCACHE *local_scan_cache = NULL;
-  BTREE_SEARCH r;
+  if (p_class_instance_lock_info && p_class_instance_lock_info->instances_locked)
+    {
+      /* already locked in select phase. Avoid locking again the same instances at delete phase. */
+      need_locking = false;
+    }
+  else
+    {
+      /* not locked in select phase, need locking at update phase */
+      need_locking = true;
+    }
 
-  *removed_count = 0;
+  /* This guarantees that the result list file will have a type list. Copying a list_id structure fails unless it has a
+   * type list. */
+  if ((qexec_setup_list_id (thread_p, xasl) != NO_ERROR)
+      /* it can be > 2 || (aptr->list_id->type_list.type_cnt != 2) */ )
+    {
+      GOTO_EXIT_ON_ERROR;
+    }
 
-  db_make_null (&dbvalue);
 
-  if (heap_attrinfo_clear_dbvalues (index_attr_info) != NO_ERROR)
+  /* Allocate and init structures for statistical information */
+  if (aptr->list_id->tuple_cnt > MIN_NUM_ROWS_FOR_MULTI_DELETE)
     {
-      goto error_exit;
+      op_type = MULTI_ROW_DELETE;
     }
-
-  copyarea = locator_allocate_copy_area_by_attr_info (thread_p, attr_info, NULL, &new_recdes, -1, LOB_FLAG_EXCLUDE_LOB);
-  if (copyarea == NULL)
+  else
     {
-      goto error_exit;
+      /* When the number of instances to be deleted is small, SINGLE_ROW_DELETE operation would be better, I guess.. */
+      op_type = SINGLE_ROW_DELETE;
     }
 
-  if (idx_info->has_single_col)
+  /* need to start a topop to ensure statement atomicity. One delete statement might update several disk images. For
+   * example, one row delete might update zero or more index keys, one heap record, catalog info of object count, and
+   * other things. So, the delete statement must be performed atomically. */
+  if (xtran_server_start_topop (thread_p, &lsa) != NO_ERROR)
     {
-      error_code = heap_attrinfo_read_dbvalues (thread_p, &oid_Null_oid, &new_recdes, NULL, index_attr_info);
-      if (error_code != NO_ERROR)
-	{
-	  goto error_exit;
-	}
+      GOTO_EXIT_ON_ERROR;
     }
-  assert_release (index_attr_info->last_classrepr != NULL);
-
-  HFID_COPY (&class_hfid, &scan_cache->node.hfid);
-  COPY_OID (&class_oid, &attr_info->class_oid);
 
-  local_scan_cache = scan_cache;
-  local_op_type = BTREE_IS_MULTI_ROW_OP (op_type) ? MULTI_ROW_DELETE : SINGLE_ROW_DELETE;
+  savepoint_used = 1;
 
-  for (i = 0; i < idx_info->num_btids; ++i)
+  specp = xasl->spec_list;
+  assert (xasl->scan_op_type == S_SELECT);
+  /* force_select_lock = false */
+  if (qexec_open_scan (thread_p, specp, xasl->val_list, &xasl_state->vd, false, specp->fixed_scan, specp->grouped_scan,
+		       true, &specp->s_id, xasl_state->query_id, S_SELECT, false, NULL) != NO_ERROR)
     {
-      is_global_index = false;
-      index = &(index_attr_info->last_classrepr->indexes[i]);
-      if (!btree_is_unique_type (index->type))
-	{
-	  continue;
-	}
+      GOTO_EXIT_ON_ERROR;
+    }
 
-      if (index->index_status == OR_ONLINE_INDEX_BUILDING_IN_PROGRESS)
-	{
-	  /* Skip for online index in loading phase. */
-	  continue;
-	}
+  scan_open = true;
 
-      COPY_OID (&pruned_oid, &class_oid);
-      HFID_COPY (&pruned_hfid, &class_hfid);
-      BTID_COPY (&btid, &index->btid);
-      key_dbvalue =
-	heap_attrvalue_get_key (thread_p, i, index_attr_info, &new_recdes, &btid, &dbvalue, aligned_buf, NULL, NULL);
-      /* TODO: unique with prefix length */
-      if (key_dbvalue == NULL)
-	{
-	  goto error_exit;
-	}
+  while ((xb_scan = qexec_next_scan_block_iterations (thread_p, xasl)) == S_SUCCESS)
+    {
+      s_id = &xasl->curr_spec->s_id;
 
-      if (pruning_type != DB_NOT_PARTITIONED_CLASS)
+      while ((ls_scan = scan_next_scan (thread_p, s_id)) == S_SUCCESS)
 	{
-	  if (pcontext == NULL)
-	    {
-	      assert (false);
-	      goto error_exit;
-	    }
-	  error_code = partition_prune_unique_btid (pcontext, key_dbvalue, &pruned_oid, &pruned_hfid, &btid);
-	  if (error_code != NO_ERROR)
-	    {
-	      goto error_exit;
-	    }
-	}
-
-      OID_SET_NULL (&unique_oid);
-
-      r = xbtree_find_unique (thread_p, &btid, S_DELETE, key_dbvalue, &pruned_oid, &unique_oid, is_global_index);
+	  val_list = s_id->val_list->valp;
 
-      if (r == BTREE_KEY_FOUND)
-	{
-	  if (pruning_type != DB_NOT_PARTITIONED_CLASS)
+	  /* Get info for MVCC condition reevaluation */
+	  for (class_oid_idx = 0, mvcc_reev_class_idx = 0;
+	       class_oid_idx < class_oid_cnt || mvcc_reev_class_idx < mvcc_reev_class_cnt;
+	       val_list = val_list->next->next, class_oid_idx++)
 	    {
-	      COPY_OID (&attr_info->inst_oid, &unique_oid);
-	    }
+	      if (mvcc_reev_class_idx < mvcc_reev_class_cnt
+		  && mvcc_reev_classes[mvcc_reev_class_idx].class_index == class_oid_idx)
+		{
+		  mvcc_reev_class = &mvcc_reev_classes[mvcc_reev_class_idx++];
+		}
+	      else
+		{
+		  mvcc_reev_class = NULL;
+		}
 
-	  if (pruning_type && BTREE_IS_MULTI_ROW_OP (op_type))
-	    {
-	      /* need to provide appropriate scan_cache to locator_delete_force in order to correctly compute
-	       * statistics */
-	      PRUNING_SCAN_CACHE *pruning_cache;
+	      valp = val_list->val;
+	      if (valp == NULL)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+	      if (DB_IS_NULL (valp))
+		{
+		  if (class_oid_idx < class_oid_cnt)
+		    {
+		      internal_class = &internal_classes[class_oid_idx];
+		      internal_class->class_oid = NULL;
+		      internal_class->oid = NULL;
+		    }
+		  continue;
+		}
+	      oid = db_get_oid (valp);
 
-	      pruning_cache =
-		locator_get_partition_scancache (pcontext, &pruned_oid, &pruned_hfid, local_op_type, false);
-	      if (pruning_cache == NULL)
+	      /* class OID */
+	      valp = val_list->next->val;
+	      if (valp == NULL)
 		{
-		  assert (er_errid () != NO_ERROR);
+		  GOTO_EXIT_ON_ERROR;
+		}
+	      if (DB_IS_NULL (valp))
+		{
+		  if (class_oid_idx < class_oid_cnt)
+		    {
+		      internal_classes[class_oid_idx].class_oid = NULL;
+		    }
+		  continue;
+		}
+	      class_oid = db_get_oid (valp);
 
-		  error_code = er_errid ();
-		  if (error_code == NO_ERROR)
+	      if (class_oid_idx < class_oid_cnt)
+		{
+		  internal_class = &internal_classes[class_oid_idx];
+
+		  internal_class->oid = oid;
+
+		  if (class_oid
+		      && (internal_class->class_oid == NULL || !OID_EQ (internal_class->class_oid, class_oid)))
 		    {
-		      error_code = ER_FAILED;
+		      query_class = &delete_->classes[class_oid_idx];
+
+		      /* find class HFID */
+		      error =
+			qexec_upddel_setup_current_class (thread_p, query_class, internal_class, op_type, class_oid);
+		      if (error != NO_ERROR)
+			{
+			  /* matching class oid does not exist... error */
+			  er_log_debug (ARG_FILE_LINE, "qexec_execute_delete: class OID is not correct\n");
+			  GOTO_EXIT_ON_ERROR;
+			}
+
+		      if (internal_class->num_lob_attrs)
+			{
+			  internal_class->crt_del_lob_info =
+			    qexec_change_delete_lob_info (thread_p, xasl_state, internal_class, &del_lob_info_list);
+			  if (internal_class->crt_del_lob_info == NULL)
+			    {
+			      GOTO_EXIT_ON_ERROR;
+			    }
+			}
+		      else
+			{
+			  internal_class->crt_del_lob_info = NULL;
+			}
 		    }
-		  goto error_exit;
 		}
 
-	      local_scan_cache = &pruning_cache->scan_cache;
+	      if (mvcc_reev_class != NULL)
+		{
+		  /* class has changed to a new subclass */
+		  if (class_oid && !OID_EQ (&mvcc_reev_class->cls_oid, class_oid))
+		    {
+		      error = qexec_upddel_mvcc_set_filters (thread_p, aptr, mvcc_reev_class, class_oid);
+		      if (error != NO_ERROR)
+			{
+			  GOTO_EXIT_ON_ERROR;
+			}
+		    }
+		}
 	    }
 
-	  /* last version was already locked and returned by xbtree_find_unique() */
-	  error_code = locator_delete_lob_force (thread_p, &pruned_oid, &unique_oid, NULL);
-	  if (error_code != NO_ERROR)
+	  if (mvcc_upddel_reev_data.mvcc_cond_reev_list == NULL)
 	    {
-	      goto error_exit;
+	      /* If scan order was not set then do it. This operation must be run only once. We do it here and not at
+	       * the beginning of this function because the class OIDs must be set for classes involved in reevaluation
+	       * (in mvcc_reev_classes) prior to this operation */
+	      mvcc_upddel_reev_data.mvcc_cond_reev_list =
+		qexec_mvcc_cond_reev_set_scan_order (aptr, mvcc_reev_classes, mvcc_reev_class_cnt, delete_->classes,
+						     class_oid_cnt);
 	    }
 
-	  force_count = 0;
-	  /* The object was locked during find unique */
-	  error_code =
-	    locator_attribute_info_force (thread_p, &pruned_hfid, &unique_oid, NULL, NULL, 0, LC_FLUSH_DELETE,
-					  local_op_type, local_scan_cache, &force_count, false,
-					  REPL_INFO_TYPE_RBR_NORMAL, DB_NOT_PARTITIONED_CLASS, NULL, NULL, NULL,
-					  UPDATE_INPLACE_NONE, NULL, false);
-
-	  if (error_code == ER_MVCC_NOT_SATISFIED_REEVALUATION)
-	    {
-	      error_code = NO_ERROR;
-	    }
-	  else if (error_code != NO_ERROR)
+	  for (class_oid_idx = 0, mvcc_reev_class_idx = 0; class_oid_idx < class_oid_cnt; class_oid_idx++)
 	    {
-	      goto error_exit;
+	      internal_class = &internal_classes[class_oid_idx];
+	      oid = internal_class->oid;
+	      class_oid = internal_class->class_oid;
+
+	      if (mvcc_reev_class_cnt && mvcc_reev_classes[mvcc_reev_class_idx].class_index == class_oid_idx)
+		{
+		  mvcc_reev_class = &mvcc_reev_classes[mvcc_reev_class_idx++];
+		}
+	      else
+		{
+		  mvcc_reev_class = NULL;
+		}
+	      mvcc_upddel_reev_data.curr_upddel = mvcc_reev_class;
+
+	      if (oid == NULL)
+		{
+		  continue;
+		}
+
+	      if (internal_class->crt_del_lob_info)
+		{
+		  /* delete lob files */
+		  DEL_LOB_INFO *crt_del_lob_info = internal_class->crt_del_lob_info;
+		  SCAN_CODE scan_code;
+		  int error;
+		  int i;
+		  RECDES recdes = RECDES_INITIALIZER;
+
+		  /* read lob attributes */
+		  scan_code =
+		    heap_get_visible_version (thread_p, oid, class_oid, &recdes, internal_class->scan_cache, PEEK,
+					      NULL_CHN);
+		  if (scan_code == S_ERROR)
+		    {
+		      GOTO_EXIT_ON_ERROR;
+		    }
+		  if (scan_code == S_SUCCESS)
+		    {
+		      error = heap_attrinfo_read_dbvalues (thread_p, oid, &recdes, NULL, &crt_del_lob_info->attr_info);
+		      if (error != NO_ERROR)
+			{
+			  GOTO_EXIT_ON_ERROR;
+			}
+		      for (i = 0; i < internal_class->num_lob_attrs; i++)
+			{
+			  DB_VALUE *attr_valp = &crt_del_lob_info->attr_info.values[i].dbvalue;
+			  if (!db_value_is_null (attr_valp))
+			    {
+			      DB_ELO *elo;
+			      error = NO_ERROR;
+
+			      assert (db_value_type (attr_valp) == DB_TYPE_BLOB
+				      || db_value_type (attr_valp) == DB_TYPE_CLOB);
+			      elo = db_get_elo (attr_valp);
+			      if (elo)
+				{
+				  error = db_elo_delete (elo);
+				}
+			      if (error != NO_ERROR)
+				{
+				  GOTO_EXIT_ON_ERROR;
+				}
+			    }
+			}
+		    }
+		}
+
+	      force_count = 0;
+	      error =
+		locator_attribute_info_force (thread_p, internal_class->class_hfid, oid, NULL, NULL, 0, LC_FLUSH_DELETE,
+					      op_type, internal_class->scan_cache, &force_count, false,
+					      REPL_INFO_TYPE_RBR_NORMAL, DB_NOT_PARTITIONED_CLASS, NULL, NULL,
+					      &mvcc_reev_data, UPDATE_INPLACE_NONE, NULL, need_locking);
+	      if (error == ER_MVCC_NOT_SATISFIED_REEVALUATION)
+		{
+		  error = NO_ERROR;
+		}
+	      else if (error != NO_ERROR)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+	      else if (force_count)
+		{
+		  xasl->list_id->tuple_cnt++;
+		}
 	    }
-	  else if (force_count != 0)
+
+	  while (val_list)
 	    {
-	      assert (force_count == 1);
-	      *removed_count += force_count;
-	      force_count = 0;
+	      valp = val_list->val;
+	      if (!db_value_is_null (valp))
+		{
+		  DB_ELO *elo;
+		  int error = NO_ERROR;
+
+		  assert (db_value_type (valp) == DB_TYPE_BLOB || db_value_type (valp) == DB_TYPE_CLOB);
+		  elo = db_get_elo (valp);
+		  if (elo)
+		    {
+		      error = db_elo_delete (elo);
+		    }
+		  pr_clear_value (valp);
+		  if (error < NO_ERROR)
+		    {
+		      GOTO_EXIT_ON_ERROR;
+		    }
+		}
+
+	      val_list = val_list->next;
 	    }
 	}
-      else if (r == BTREE_ERROR_OCCURRED)
+      if (ls_scan != S_END)
 	{
-	  if (!OID_ISNULL (&unique_oid))
-	    {
-	      /* more than one OID has been found */
-	      BTREE_SET_UNIQUE_VIOLATION_ERROR (thread_p, key_dbvalue, &unique_oid, &class_oid, &btid, NULL);
-	    }
-	  goto error_exit;
+	  GOTO_EXIT_ON_ERROR;
+	}
+    }
+  if (xb_scan != S_END)
+    {
+      GOTO_EXIT_ON_ERROR;
+    }
+
+  /* reflect local statistical information into transaction's statistical information */
+  for (s = 0; s < class_oid_cnt; s++)
+    {
+      internal_class = internal_classes + s;
+      query_class = delete_->classes + s;
+      if (internal_classes[s].needs_pruning)
+	{
+	  error = qexec_process_partition_unique_stats (thread_p, &internal_class->context);
 	}
       else
 	{
-	  /* BTREE_KEY_NOTFOUND */
-	  ;			/* just go to the next one */
+	  error = qexec_process_unique_stats (thread_p, query_class->class_oid, internal_class);
+	}
+      if (error != NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
 	}
+    }
 
-      if (key_dbvalue == &dbvalue)
+  qexec_close_scan (thread_p, specp);
+
+  qexec_free_delete_lob_info_list (thread_p, &del_lob_info_list);
+
+  if (internal_classes)
+    {
+      qexec_clear_internal_classes (thread_p, internal_classes, class_oid_cnt);
+      db_private_free_and_init (thread_p, internal_classes);
+    }
+
+  if (mvcc_reev_classes != NULL)
+    {
+      db_private_free (thread_p, mvcc_reev_classes);
+      mvcc_reev_classes = NULL;
+    }
+  if (mvcc_upddel_reev_data.copyarea != NULL)
+    {
+      locator_free_copy_area (mvcc_upddel_reev_data.copyarea);
+      mvcc_upddel_reev_data.copyarea = NULL;
+    }
+
+  if (savepoint_used)
+    {
+      if (xtran_server_end_topop (thread_p, LOG_RESULT_TOPOP_ATTACH_TO_OUTER, &lsa) != TRAN_ACTIVE)
 	{
-	  pr_clear_value (&dbvalue);
-	  key_dbvalue = NULL;
+	  qexec_failure_line (__LINE__, xasl_state);
+	  return ER_FAILED;
 	}
     }
 
-  if (copyarea != NULL)
+#if 0				/* yaw */
+  /* remove query result cache entries which are relevant with this class */
+  class_oid = XASL_DELETE_CLASS_OID (xasl);
+  if (!QFILE_IS_LIST_CACHE_DISABLED && class_oid)
     {
-      locator_free_copy_area (copyarea);
-      copyarea = NULL;
-      new_recdes.data = NULL;
-      new_recdes.area_size = 0;
+      for (s = 0; s < XASL_DELETE_NO_CLASSES (xasl); s++, class_oid++)
+	{
+	  if (qexec_clear_list_cache_by_class (class_oid) != NO_ERROR)
+	    {
+	      er_log_debug (ARG_FILE_LINE,
+			    "qexec_execute_delete: qexec_clear_list_cache_by_class failed for class { %d %d %d }\n",
+			    class_oid->pageid, class_oid->slotid, class_oid->volid);
+	    }
+	}
+      qmgr_add_modified_class (class_oid);
     }
+#endif
 
   return NO_ERROR;
 
-error_exit:
-  if (key_dbvalue == &dbvalue)
+exit_on_error:
+  if (scan_open)
     {
-      pr_clear_value (&dbvalue);
-      key_dbvalue = NULL;
+      qexec_end_scan (thread_p, specp);
+      qexec_close_scan (thread_p, specp);
     }
 
-  if (copyarea != NULL)
+  if (del_lob_info_list != NULL)
     {
-      locator_free_copy_area (copyarea);
-      copyarea = NULL;
-      new_recdes.data = NULL;
-      new_recdes.area_size = 0;
+      qexec_free_delete_lob_info_list (thread_p, &del_lob_info_list);
+    }
+
+  if (internal_classes)
+    {
+      qexec_clear_internal_classes (thread_p, internal_classes, class_oid_cnt);
+      db_private_free_and_init (thread_p, internal_classes);
+    }
+
+  if (mvcc_reev_classes != NULL)
+    {
+      db_private_free (thread_p, mvcc_reev_classes);
+      mvcc_reev_classes = NULL;
+    }
+  if (mvcc_upddel_reev_data.copyarea != NULL)
+    {
+      locator_free_copy_area (mvcc_upddel_reev_data.copyarea);
+      mvcc_upddel_reev_data.copyarea = NULL;
+    }
+
+  if (savepoint_used)
+    {
+      xtran_server_end_topop (thread_p, LOG_RESULT_TOPOP_ABORT, &lsa);
     }
 
   return ER_FAILED;
 }
 
 /*
- * qexec_oid_of_duplicate_key_update () - Finds an OID of an object that would
- *       generate unique index violations when inserting the given attr_info
- *       (This is used for executing INSERT ON DUPLICATE KEY UPDATE
- *        statements)
- *   return: NO_ERROR or ER_code
- *   thread_p(in):
- *   pruned_partition_scan_cache(out): the real scan_cache for this oid
- *   scan_cache(in):
- *   attr_info(in/out): The attribute information that will be inserted
- *   index_attr_info(in/out):
- *   idx_info(in):
- *   pruning_type(in):
- *   pcontext(in):
- *   unique_oid_p(out): the OID of one object to be updated or a NULL OID if
- *                      there are no potential unique index violations
- *   op_type(int):
- * Note: A single OID is returned even if there are several objects that would
- *       generate unique index violations (this can only happen if there are
- *       several unique indexes).
+ * qexec_create_delete_lob_info () - creates a new DEL_LOB_INFO object using
+ *			data from class_info
+ *
+ * thread_p (in)      :
+ * xasl_state (in)    :
+ * class_info (in)    :
+ *
+ * return	      : new DEL_LOB_INFO object
+ */
+static DEL_LOB_INFO *
+qexec_create_delete_lob_info (THREAD_ENTRY * thread_p, XASL_STATE * xasl_state, UPDDEL_CLASS_INFO_INTERNAL * class_info)
+{
+  DEL_LOB_INFO *del_lob_info;
+
+  del_lob_info = (DEL_LOB_INFO *) db_private_alloc (thread_p, sizeof (DEL_LOB_INFO));
+  if (!del_lob_info)
+    {
+      qexec_failure_line (__LINE__, xasl_state);
+      goto error;
+    }
+
+  del_lob_info->class_oid = class_info->class_oid;
+  del_lob_info->class_hfid = class_info->class_hfid;
+
+  if (heap_attrinfo_start (thread_p, class_info->class_oid, class_info->num_lob_attrs, class_info->lob_attr_ids,
+			   &del_lob_info->attr_info) != NO_ERROR)
+    {
+      goto error;
+    }
+
+  del_lob_info->next = NULL;
+
+  return del_lob_info;
+
+error:
+  if (del_lob_info)
+    {
+      db_private_free (thread_p, del_lob_info);
+    }
+  return NULL;
+}
+
+/*
+ * qexec_change_delete_lob_info () - When the class_oid of the tuple that
+ *		needs to be deleted changes, also the current DEL_LOB_INFO
+ *		needs to be changed. This can also be used to initialize
+ *		the list
+ *
+ * thread_p (in)	    :
+ * xasl_state (in)	    :
+ * class_info (in)	    :
+ * del_lob_info_list_ptr    : pointer to current list of DEL_LOB_INFO
+ *
+ * return		    : DEL_LOB_INFO object specific to current class_info
+ */
+static DEL_LOB_INFO *
+qexec_change_delete_lob_info (THREAD_ENTRY * thread_p, XASL_STATE * xasl_state, UPDDEL_CLASS_INFO_INTERNAL * class_info,
+			      DEL_LOB_INFO ** del_lob_info_list_ptr)
+{
+  DEL_LOB_INFO *del_lob_info_list = *del_lob_info_list_ptr;
+  DEL_LOB_INFO *del_lob_info = NULL;
+
+  assert (del_lob_info_list_ptr != NULL);
+  del_lob_info_list = *del_lob_info_list_ptr;
+
+  if (del_lob_info_list == NULL)
+    {
+      /* create new DEL_LOB_INFO */
+      del_lob_info_list = qexec_create_delete_lob_info (thread_p, xasl_state, class_info);
+      *del_lob_info_list_ptr = del_lob_info_list;
+      return del_lob_info_list;
+    }
+
+  /* verify if a DEL_LOB_INFO for current class_oid already exists */
+  for (del_lob_info = del_lob_info_list; del_lob_info; del_lob_info = del_lob_info->next)
+    {
+      if (del_lob_info->class_oid == class_info->class_oid)
+	{
+	  /* found */
+	  return del_lob_info;
+	}
+    }
+
+  /* create a new DEL_LOB_INFO */
+  del_lob_info = qexec_create_delete_lob_info (thread_p, xasl_state, class_info);
+  if (!del_lob_info)
+    {
+      return NULL;
+    }
+  del_lob_info->next = del_lob_info_list;
+  del_lob_info_list = del_lob_info;
+  *del_lob_info_list_ptr = del_lob_info_list;
+
+  return del_lob_info_list;
+}
+
+/*
+ * qexec_free_delete_lob_info_list () - frees the list of DEL_LOB_INFO
+ *	      created for deleting lob files.
+ *
+ * thread_p (in)	  :
+ * del_lob_info_list_ptr  : pointer to the list of DEL_LOB_INFO structures
+ *
+ * NOTE: also all HEAP_CACHE_ATTRINFO must be ended
+ */
+static void
+qexec_free_delete_lob_info_list (THREAD_ENTRY * thread_p, DEL_LOB_INFO ** del_lob_info_list_ptr)
+{
+  DEL_LOB_INFO *del_lob_info_list;
+  DEL_LOB_INFO *del_lob_info, *next_del_lob_info;
+
+  if (!del_lob_info_list_ptr)
+    {
+      /* invalid pointer, nothing to free */
+      return;
+    }
+
+  del_lob_info_list = *del_lob_info_list_ptr;
+  if (!del_lob_info_list)
+    {
+      /* no item in the list, nothing to free */
+      return;
+    }
+
+  del_lob_info = del_lob_info_list;
+  while (del_lob_info)
+    {
+      next_del_lob_info = del_lob_info->next;
+      /* end HEAP_CACHE_ATTRINFO first */
+      heap_attrinfo_end (thread_p, &del_lob_info->attr_info);
+
+      db_private_free (thread_p, del_lob_info);
+      del_lob_info = next_del_lob_info;
+    }
+  *del_lob_info_list_ptr = NULL;
+}
+
+
+/*
+ * qexec_remove_duplicates_for_replace () - Removes the objects that would
+ *       generate unique index violations when inserting the given attr_info
+ *       (This is used for executing REPLACE statements)
+ *   return: NO_ERROR or ER_code
+ *   scan_cache(in):
+ *   attr_info(in/out): The attribute information that will be inserted
+ *   index_attr_info(in/out):
+ *   idx_info(in):
+ *   op_type (in): operation type
+ *   pruning_type (in): one of DB_NOT_PARTITIONED_CLASS, DB_PARTITIONED_CLASS,
+ *			DB_PARTITION_CLASS
+ *   pcontext (in): pruning context
+ *   removed_count (in/out):
  */
 static int
-qexec_oid_of_duplicate_key_update (THREAD_ENTRY * thread_p, HEAP_SCANCACHE ** pruned_partition_scan_cache,
-				   HEAP_SCANCACHE * scan_cache, HEAP_CACHE_ATTRINFO * attr_info,
-				   HEAP_CACHE_ATTRINFO * index_attr_info, const HEAP_IDX_ELEMENTS_INFO * idx_info,
-				   int pruning_type, PRUNING_CONTEXT * pcontext, OID * unique_oid_p, int op_type)
+qexec_remove_duplicates_for_replace (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_cache,
+				     HEAP_CACHE_ATTRINFO * attr_info, HEAP_CACHE_ATTRINFO * index_attr_info,
+				     const HEAP_IDX_ELEMENTS_INFO * idx_info, int op_type, int pruning_type,
+				     PRUNING_CONTEXT * pcontext, int *removed_count)
 {
   LC_COPYAREA *copyarea = NULL;
-  RECDES recdes;
+  RECDES new_recdes;
   int i = 0;
   int error_code = NO_ERROR;
   char buf[DBVAL_BUFSIZE + MAX_ALIGNMENT];
   char *const aligned_buf = PTR_ALIGN (buf, MAX_ALIGNMENT);
   DB_VALUE dbvalue;
   DB_VALUE *key_dbvalue = NULL;
-  bool found_duplicate = false;
-  BTID btid;
-  OR_INDEX *index;
+  int force_count = 0;
+  OR_INDEX *index = NULL;
   OID unique_oid;
-  OID class_oid;
-  HFID class_hfid;
-  bool is_global_index = false;
-  int local_op_type = SINGLE_ROW_UPDATE;
+  OID class_oid, pruned_oid;
+  BTID btid;
+  bool is_global_index;
+  HFID class_hfid, pruned_hfid;
+  int local_op_type = SINGLE_ROW_DELETE;
+  HEAP_SCANCACHE *local_scan_cache = NULL;
   BTREE_SEARCH r;
 
-  assert (pruned_partition_scan_cache != NULL);
+  *removed_count = 0;
 
   db_make_null (&dbvalue);
-  OID_SET_NULL (unique_oid_p);
-  OID_SET_NULL (&unique_oid);
-
-  if (BTREE_IS_MULTI_ROW_OP (op_type))
-    {
-      local_op_type = MULTI_ROW_UPDATE;
-    }
 
   if (heap_attrinfo_clear_dbvalues (index_attr_info) != NO_ERROR)
     {
       goto error_exit;
     }
 
-  copyarea = locator_allocate_copy_area_by_attr_info (thread_p, attr_info, NULL, &recdes, -1, LOB_FLAG_INCLUDE_LOB);
+  copyarea = locator_allocate_copy_area_by_attr_info (thread_p, attr_info, NULL, &new_recdes, -1, LOB_FLAG_EXCLUDE_LOB);
   if (copyarea == NULL)
     {
       goto error_exit;
@@ -10513,16 +10964,23 @@ qexec_oid_of_duplicate_key_update (THREAD_ENTRY * thread_p, HEAP_SCANCACHE ** pr
 
   if (idx_info->has_single_col)
     {
-      error_code = heap_attrinfo_read_dbvalues (thread_p, &oid_Null_oid, &recdes, NULL, index_attr_info);
+      error_code = heap_attrinfo_read_dbvalues (thread_p, &oid_Null_oid, &new_recdes, NULL, index_attr_info);
       if (error_code != NO_ERROR)
 	{
 	  goto error_exit;
 	}
     }
-  assert (index_attr_info->last_classrepr != NULL);
+  assert_release (index_attr_info->last_classrepr != NULL);
 
-  for (i = 0; i < idx_info->num_btids && !found_duplicate; ++i)
+  HFID_COPY (&class_hfid, &scan_cache->node.hfid);
+  COPY_OID (&class_oid, &attr_info->class_oid);
+
+  local_scan_cache = scan_cache;
+  local_op_type = BTREE_IS_MULTI_ROW_OP (op_type) ? MULTI_ROW_DELETE : SINGLE_ROW_DELETE;
+
+  for (i = 0; i < idx_info->num_btids; ++i)
     {
+      is_global_index = false;
       index = &(index_attr_info->last_classrepr->indexes[i]);
       if (!btree_is_unique_type (index->type))
 	{
@@ -10535,11 +10993,12 @@ qexec_oid_of_duplicate_key_update (THREAD_ENTRY * thread_p, HEAP_SCANCACHE ** pr
 	  continue;
 	}
 
-      COPY_OID (&class_oid, &attr_info->class_oid);
-      is_global_index = false;
-
+      COPY_OID (&pruned_oid, &class_oid);
+      HFID_COPY (&pruned_hfid, &class_hfid);
+      BTID_COPY (&btid, &index->btid);
       key_dbvalue =
-	heap_attrvalue_get_key (thread_p, i, index_attr_info, &recdes, &btid, &dbvalue, aligned_buf, NULL, NULL);
+	heap_attrvalue_get_key (thread_p, i, index_attr_info, &new_recdes, &btid, &dbvalue, aligned_buf, NULL, NULL);
+      /* TODO: unique with prefix length */
       if (key_dbvalue == NULL)
 	{
 	  goto error_exit;
@@ -10552,15 +11011,16 @@ qexec_oid_of_duplicate_key_update (THREAD_ENTRY * thread_p, HEAP_SCANCACHE ** pr
 	      assert (false);
 	      goto error_exit;
 	    }
-
-	  error_code = partition_prune_unique_btid (pcontext, key_dbvalue, &class_oid, &class_hfid, &btid);
+	  error_code = partition_prune_unique_btid (pcontext, key_dbvalue, &pruned_oid, &pruned_hfid, &btid);
 	  if (error_code != NO_ERROR)
 	    {
 	      goto error_exit;
 	    }
 	}
 
-      r = xbtree_find_unique (thread_p, &btid, S_UPDATE, key_dbvalue, &class_oid, &unique_oid, is_global_index);
+      OID_SET_NULL (&unique_oid);
+
+      r = xbtree_find_unique (thread_p, &btid, S_DELETE, key_dbvalue, &pruned_oid, &unique_oid, is_global_index);
 
       if (r == BTREE_KEY_FOUND)
 	{
@@ -10569,13 +11029,14 @@ qexec_oid_of_duplicate_key_update (THREAD_ENTRY * thread_p, HEAP_SCANCACHE ** pr
 	      COPY_OID (&attr_info->inst_oid, &unique_oid);
 	    }
 
-	  if (pruning_type != DB_NOT_PARTITIONED_CLASS && BTREE_IS_MULTI_ROW_OP (op_type))
+	  if (pruning_type && BTREE_IS_MULTI_ROW_OP (op_type))
 	    {
 	      /* need to provide appropriate scan_cache to locator_delete_force in order to correctly compute
 	       * statistics */
 	      PRUNING_SCAN_CACHE *pruning_cache;
 
-	      pruning_cache = locator_get_partition_scancache (pcontext, &class_oid, &class_hfid, local_op_type, false);
+	      pruning_cache =
+		locator_get_partition_scancache (pcontext, &pruned_oid, &pruned_hfid, local_op_type, false);
 	      if (pruning_cache == NULL)
 		{
 		  assert (er_errid () != NO_ERROR);
@@ -10588,33 +11049,260 @@ qexec_oid_of_duplicate_key_update (THREAD_ENTRY * thread_p, HEAP_SCANCACHE ** pr
 		  goto error_exit;
 		}
 
-	      *pruned_partition_scan_cache = &pruning_cache->scan_cache;
+	      local_scan_cache = &pruning_cache->scan_cache;
 	    }
 
-	  /* We now hold an U_LOCK on the instance. It will be upgraded to an X_LOCK when the update is executed. */
-	  if (pruning_type == DB_PARTITION_CLASS)
+	  /* last version was already locked and returned by xbtree_find_unique() */
+	  error_code = locator_delete_lob_force (thread_p, &pruned_oid, &unique_oid, NULL);
+	  if (error_code != NO_ERROR)
 	    {
-	      if (!OID_EQ (&class_oid, &pcontext->selected_partition->class_oid))
-		{
-		  /* found a duplicate OID but not in the right partition */
-		  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_INVALID_DATA_FOR_PARTITION, 0);
-		  goto error_exit;
-		}
+	      goto error_exit;
 	    }
 
-	  found_duplicate = true;
-	  COPY_OID (unique_oid_p, &unique_oid);
-	}
-      else if (r == BTREE_ERROR_OCCURRED)
-	{
-	  if (!OID_ISNULL (&unique_oid))
-	    {
-	      /* more than one OID has been found */
-	      BTREE_SET_UNIQUE_VIOLATION_ERROR (thread_p, key_dbvalue, &unique_oid, &class_oid, &btid, NULL);
-	    }
-	  goto error_exit;
-	}
-      else
+	  force_count = 0;
+	  /* The object was locked during find unique */
+	  error_code =
+	    locator_attribute_info_force (thread_p, &pruned_hfid, &unique_oid, NULL, NULL, 0, LC_FLUSH_DELETE,
+					  local_op_type, local_scan_cache, &force_count, false,
+					  REPL_INFO_TYPE_RBR_NORMAL, DB_NOT_PARTITIONED_CLASS, NULL, NULL, NULL,
+					  UPDATE_INPLACE_NONE, NULL, false);
+
+	  if (error_code == ER_MVCC_NOT_SATISFIED_REEVALUATION)
+	    {
+	      error_code = NO_ERROR;
+	    }
+	  else if (error_code != NO_ERROR)
+	    {
+	      goto error_exit;
+	    }
+	  else if (force_count != 0)
+	    {
+	      assert (force_count == 1);
+	      *removed_count += force_count;
+	      force_count = 0;
+	    }
+	}
+      else if (r == BTREE_ERROR_OCCURRED)
+	{
+	  if (!OID_ISNULL (&unique_oid))
+	    {
+	      /* more than one OID has been found */
+	      BTREE_SET_UNIQUE_VIOLATION_ERROR (thread_p, key_dbvalue, &unique_oid, &class_oid, &btid, NULL);
+	    }
+	  goto error_exit;
+	}
+      else
+	{
+	  /* BTREE_KEY_NOTFOUND */
+	  ;			/* just go to the next one */
+	}
+
+      if (key_dbvalue == &dbvalue)
+	{
+	  pr_clear_value (&dbvalue);
+	  key_dbvalue = NULL;
+	}
+    }
+
+  if (copyarea != NULL)
+    {
+      locator_free_copy_area (copyarea);
+      copyarea = NULL;
+      new_recdes.data = NULL;
+      new_recdes.area_size = 0;
+    }
+
+  return NO_ERROR;
+
+error_exit:
+  if (key_dbvalue == &dbvalue)
+    {
+      pr_clear_value (&dbvalue);
+      key_dbvalue = NULL;
+    }
+
+  if (copyarea != NULL)
+    {
+      locator_free_copy_area (copyarea);
+      copyarea = NULL;
+      new_recdes.data = NULL;
+      new_recdes.area_size = 0;
+    }
+
+  return ER_FAILED;
+}
+
+/*
+ * qexec_oid_of_duplicate_key_update () - Finds an OID of an object that would
+ *       generate unique index violations when inserting the given attr_info
+ *       (This is used for executing INSERT ON DUPLICATE KEY UPDATE
+ *        statements)
+ *   return: NO_ERROR or ER_code
+ *   thread_p(in):
+ *   pruned_partition_scan_cache(out): the real scan_cache for this oid
+ *   scan_cache(in):
+ *   attr_info(in/out): The attribute information that will be inserted
+ *   index_attr_info(in/out):
+ *   idx_info(in):
+ *   pruning_type(in):
+ *   pcontext(in):
+ *   unique_oid_p(out): the OID of one object to be updated or a NULL OID if
+ *                      there are no potential unique index violations
+ *   op_type(int):
+ * Note: A single OID is returned even if there are several objects that would
+ *       generate unique index violations (this can only happen if there are
+ *       several unique indexes).
+ */
+static int
+qexec_oid_of_duplicate_key_update (THREAD_ENTRY * thread_p, HEAP_SCANCACHE ** pruned_partition_scan_cache,
+				   HEAP_SCANCACHE * scan_cache, HEAP_CACHE_ATTRINFO * attr_info,
+				   HEAP_CACHE_ATTRINFO * index_attr_info, const HEAP_IDX_ELEMENTS_INFO * idx_info,
+				   int pruning_type, PRUNING_CONTEXT * pcontext, OID * unique_oid_p, int op_type)
+{
+  LC_COPYAREA *copyarea = NULL;
+  RECDES recdes;
+  int i = 0;
+  int error_code = NO_ERROR;
+  char buf[DBVAL_BUFSIZE + MAX_ALIGNMENT];
+  char *const aligned_buf = PTR_ALIGN (buf, MAX_ALIGNMENT);
+  DB_VALUE dbvalue;
+  DB_VALUE *key_dbvalue = NULL;
+  bool found_duplicate = false;
+  BTID btid;
+  OR_INDEX *index;
+  OID unique_oid;
+  OID class_oid;
+  HFID class_hfid;
+  bool is_global_index = false;
+  int local_op_type = SINGLE_ROW_UPDATE;
+  BTREE_SEARCH r;
+
+  assert (pruned_partition_scan_cache != NULL);
+
+  db_make_null (&dbvalue);
+  OID_SET_NULL (unique_oid_p);
+  OID_SET_NULL (&unique_oid);
+
+  if (BTREE_IS_MULTI_ROW_OP (op_type))
+    {
+      local_op_type = MULTI_ROW_UPDATE;
+    }
+
+  if (heap_attrinfo_clear_dbvalues (index_attr_info) != NO_ERROR)
+    {
+      goto error_exit;
+    }
+
+  copyarea = locator_allocate_copy_area_by_attr_info (thread_p, attr_info, NULL, &recdes, -1, LOB_FLAG_INCLUDE_LOB);
+  if (copyarea == NULL)
+    {
+      goto error_exit;
+    }
+
+  if (idx_info->has_single_col)
+    {
+      error_code = heap_attrinfo_read_dbvalues (thread_p, &oid_Null_oid, &recdes, NULL, index_attr_info);
+      if (error_code != NO_ERROR)
+	{
+	  goto error_exit;
+	}
+    }
+  assert (index_attr_info->last_classrepr != NULL);
+
+  for (i = 0; i < idx_info->num_btids && !found_duplicate; ++i)
+    {
+      index = &(index_attr_info->last_classrepr->indexes[i]);
+      if (!btree_is_unique_type (index->type))
+	{
+	  continue;
+	}
+
+      if (index->index_status == OR_ONLINE_INDEX_BUILDING_IN_PROGRESS)
+	{
+	  /* Skip for online index in loading phase. */
+	  continue;
+	}
+
+      COPY_OID (&class_oid, &attr_info->class_oid);
+      is_global_index = false;
+
+      key_dbvalue =
+	heap_attrvalue_get_key (thread_p, i, index_attr_info, &recdes, &btid, &dbvalue, aligned_buf, NULL, NULL);
+      if (key_dbvalue == NULL)
+	{
+	  goto error_exit;
+	}
+
+      if (pruning_type != DB_NOT_PARTITIONED_CLASS)
+	{
+	  if (pcontext == NULL)
+	    {
+	      assert (false);
+	      goto error_exit;
+	    }
+
+	  error_code = partition_prune_unique_btid (pcontext, key_dbvalue, &class_oid, &class_hfid, &btid);
+	  if (error_code != NO_ERROR)
+	    {
+	      goto error_exit;
+	    }
+	}
+
+      r = xbtree_find_unique (thread_p, &btid, S_UPDATE, key_dbvalue, &class_oid, &unique_oid, is_global_index);
+
+      if (r == BTREE_KEY_FOUND)
+	{
+	  if (pruning_type != DB_NOT_PARTITIONED_CLASS)
+	    {
+	      COPY_OID (&attr_info->inst_oid, &unique_oid);
+	    }
+
+	  if (pruning_type != DB_NOT_PARTITIONED_CLASS && BTREE_IS_MULTI_ROW_OP (op_type))
+	    {
+	      /* need to provide appropriate scan_cache to locator_delete_force in order to correctly compute
+	       * statistics */
+	      PRUNING_SCAN_CACHE *pruning_cache;
+
+	      pruning_cache = locator_get_partition_scancache (pcontext, &class_oid, &class_hfid, local_op_type, false);
+	      if (pruning_cache == NULL)
+		{
+		  assert (er_errid () != NO_ERROR);
+
+		  error_code = er_errid ();
+		  if (error_code == NO_ERROR)
+		    {
+		      error_code = ER_FAILED;
+		    }
+		  goto error_exit;
+		}
+
+	      *pruned_partition_scan_cache = &pruning_cache->scan_cache;
+	    }
+
+	  /* We now hold an U_LOCK on the instance. It will be upgraded to an X_LOCK when the update is executed. */
+	  if (pruning_type == DB_PARTITION_CLASS)
+	    {
+	      if (!OID_EQ (&class_oid, &pcontext->selected_partition->class_oid))
+		{
+		  /* found a duplicate OID but not in the right partition */
+		  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_INVALID_DATA_FOR_PARTITION, 0);
+		  goto error_exit;
+		}
+	    }
+
+	  found_duplicate = true;
+	  COPY_OID (unique_oid_p, &unique_oid);
+	}
+      else if (r == BTREE_ERROR_OCCURRED)
+	{
+	  if (!OID_ISNULL (&unique_oid))
+	    {
+	      /* more than one OID has been found */
+	      BTREE_SET_UNIQUE_VIOLATION_ERROR (thread_p, key_dbvalue, &unique_oid, &class_oid, &btid, NULL);
+	    }
+	  goto error_exit;
+	}
+      else
 	{
 	  /* BTREE_KEY_NOTFOUND */
 	  ;			/* just go to the next one */
@@ -11184,2325 +11872,3335 @@ qexec_execute_insert (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xa
 
       if (attr->current_default_value.default_expr.default_expr_op == T_TO_CHAR)
 	{
-	  assert (attr->current_default_value.default_expr.default_expr_type != DB_DEFAULT_NONE);
-	  if (attr->current_default_value.default_expr.default_expr_format != NULL)
-	    {
-	      db_make_string (&format_val, attr->current_default_value.default_expr.default_expr_format);
-	      has_user_format = 1;
-	    }
-	  else
-	    {
-	      db_make_null (&format_val);
-	      has_user_format = 0;
-	    }
-
-	  lang_str = prm_get_string_value (PRM_ID_INTL_DATE_LANG);
-	  lang_set_flag_from_lang (lang_str, has_user_format, 0, &flag);
-	  db_make_int (&lang_val, flag);
+	  assert (attr->current_default_value.default_expr.default_expr_type != DB_DEFAULT_NONE);
+	  if (attr->current_default_value.default_expr.default_expr_format != NULL)
+	    {
+	      db_make_string (&format_val, attr->current_default_value.default_expr.default_expr_format);
+	      has_user_format = 1;
+	    }
+	  else
+	    {
+	      db_make_null (&format_val);
+	      has_user_format = 0;
+	    }
+
+	  lang_str = prm_get_string_value (PRM_ID_INTL_DATE_LANG);
+	  lang_set_flag_from_lang (lang_str, has_user_format, 0, &flag);
+	  db_make_int (&lang_val, flag);
+
+	  if (!TP_IS_CHAR_TYPE (TP_DOMAIN_TYPE (attr->domain)))
+	    {
+	      /* TO_CHAR returns a string value, we need to pass an expected domain of the result */
+	      if (TP_IS_CHAR_TYPE (DB_VALUE_TYPE (&insert_val)))
+		{
+		  result_domain = NULL;
+		}
+	      else if (DB_IS_NULL (&format_val))
+		{
+		  result_domain = tp_domain_resolve_default (DB_TYPE_STRING);
+		}
+	      else
+		{
+		  result_domain = tp_domain_resolve_value (&format_val, NULL);
+		}
+	    }
+	  else
+	    {
+	      result_domain = attr->domain;
+	    }
+
+	  error = db_to_char (&insert_val, &format_val, &lang_val, insert->vals[k], result_domain);
+
+	  if (has_user_format)
+	    {
+	      pr_clear_value (&format_val);
+	    }
+	}
+      else
+	{
+	  pr_clone_value (&insert_val, insert->vals[k]);
+	}
+
+      pr_clear_value (&insert_val);
+
+      if (error != NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+
+      if (attr->current_default_value.default_expr.default_expr_type == DB_DEFAULT_NONE)
+	{
+	  /* skip the value cast */
+	  continue;
+	}
+
+      status = tp_value_cast (insert->vals[k], insert->vals[k], attr->domain, false);
+      if (status != DOMAIN_COMPATIBLE)
+	{
+	  (void) tp_domain_status_er_set (status, ARG_FILE_LINE, insert->vals[k], attr->domain);
+	  GOTO_EXIT_ON_ERROR;
+	}
+    }
+
+  specp = xasl->spec_list;
+  if (specp != NULL || ((insert->do_replace || (xasl->dptr_list != NULL)) && insert->has_uniques)
+      || insert->num_val_lists > 1)
+    {
+      scan_cache_op_type = MULTI_ROW_INSERT;
+    }
+  else
+    {
+      scan_cache_op_type = SINGLE_ROW_INSERT;
+    }
+
+  if (specp)
+    {
+      /* we are inserting multiple values ... ie. insert into foo select ... */
+
+      /* if the class has at least one function index, the function expressions will be cached */
+      if (heap_init_func_pred_unpack_info (thread_p, &attr_info, &class_oid, &func_indx_preds) != NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+
+      if (locator_start_force_scan_cache (thread_p, &scan_cache, &insert->class_hfid, &class_oid,
+					  scan_cache_op_type) != NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+      scan_cache_inited = true;
+
+      assert (xasl->scan_op_type == S_SELECT);
+
+      /* force_select_lock = false */
+      if (qexec_open_scan (thread_p, specp, xasl->val_list, &xasl_state->vd, false, specp->fixed_scan,
+			   specp->grouped_scan, true, &specp->s_id, xasl_state->query_id, S_SELECT, false,
+			   NULL) != NO_ERROR)
+	{
+	  if (savepoint_used)
+	    {
+	      xtran_server_end_topop (thread_p, LOG_RESULT_TOPOP_ABORT, &lsa);
+	    }
+	  qexec_failure_line (__LINE__, xasl_state);
+	  GOTO_EXIT_ON_ERROR;
+	}
+
+      while ((xb_scan = qexec_next_scan_block_iterations (thread_p, xasl)) == S_SUCCESS)
+	{
+	  s_id = &xasl->curr_spec->s_id;
+	  while ((ls_scan = scan_next_scan (thread_p, s_id)) == S_SUCCESS)
+	    {
+	      for (k = num_default_expr, vallist = s_id->val_list->valp; k < val_no; k++, vallist = vallist->next)
+		{
+		  if (vallist == NULL || vallist->val == NULL)
+		    {
+		      assert (0);
+		      GOTO_EXIT_ON_ERROR;
+		    }
+
+		  insert->vals[k] = vallist->val;
+		}
+
+	      /* evaluate constraint predicate */
+	      satisfies_constraints = V_UNKNOWN;
+	      if (insert->cons_pred != NULL)
+		{
+		  satisfies_constraints = eval_pred (thread_p, insert->cons_pred, &xasl_state->vd, NULL);
+		  if (satisfies_constraints == V_ERROR)
+		    {
+		      GOTO_EXIT_ON_ERROR;
+		    }
+		}
+
+	      if (insert->cons_pred != NULL && satisfies_constraints != V_TRUE)
+		{
+		  /* currently there are only NOT NULL constraints */
+		  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_NULL_CONSTRAINT_VIOLATION, 0);
+		  GOTO_EXIT_ON_ERROR;
+		}
+
+	      if (heap_attrinfo_clear_dbvalues (&attr_info) != NO_ERROR)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+	      for (k = 0; k < val_no; ++k)
+		{
+		  if (DB_IS_NULL (insert->vals[k]))
+		    {
+		      OR_ATTRIBUTE *attr = heap_locate_last_attrepr (insert->att_id[k], &attr_info);
+
+		      if (attr == NULL)
+			{
+			  GOTO_EXIT_ON_ERROR;
+			}
+
+		      if (attr->is_autoincrement)
+			{
+			  continue;
+			}
+		    }
+
+
+		  rc = heap_attrinfo_set (NULL, insert->att_id[k], insert->vals[k], &attr_info);
+		  if (rc != NO_ERROR)
+		    {
+		      GOTO_EXIT_ON_ERROR;
+		    }
+		}
+
+	      if (heap_set_autoincrement_value (thread_p, &attr_info, &scan_cache, &is_autoincrement_set) != NO_ERROR)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+
+	      if (insert->do_replace && insert->has_uniques)
+		{
+		  int removed_count = 0;
+
+		  assert (index_attr_info_inited == true);
+
+		  if (qexec_remove_duplicates_for_replace (thread_p, &scan_cache, &attr_info, &index_attr_info,
+							   &idx_info, scan_cache_op_type, insert->pruning_type,
+							   pcontext, &removed_count) != NO_ERROR)
+		    {
+		      GOTO_EXIT_ON_ERROR;
+		    }
+		  xasl->list_id->tuple_cnt += removed_count;
+		}
+
+	      if (odku_assignments && insert->has_uniques)
+		{
+		  force_count = 0;
+		  error =
+		    qexec_execute_duplicate_key_update (thread_p, insert->odku, &insert->class_hfid, &xasl_state->vd,
+							scan_cache_op_type, &scan_cache, &attr_info, &index_attr_info,
+							&idx_info, insert->pruning_type, pcontext, &force_count);
+		  if (error != NO_ERROR)
+		    {
+		      GOTO_EXIT_ON_ERROR;
+		    }
+
+		  if (force_count != 0)
+		    {
+		      assert (force_count == 1);
+
+		      xasl->list_id->tuple_cnt += force_count * 2;
+		      continue;
+		    }
+		}
+
+	      force_count = 0;
+	      /* when insert in heap, don't care about instance locking */
+	      if (locator_attribute_info_force (thread_p, &insert->class_hfid, &oid, &attr_info, NULL, 0, operation,
+						scan_cache_op_type, &scan_cache, &force_count, false,
+						REPL_INFO_TYPE_RBR_NORMAL, insert->pruning_type, pcontext,
+						func_indx_preds, NULL, UPDATE_INPLACE_NONE, NULL, false) != NO_ERROR)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+
+	      /* restore class oid and hfid that might have changed in the call above */
+	      HFID_COPY (&insert->class_hfid, &class_hfid);
+	      COPY_OID (&(attr_info.class_oid), &class_oid);
+
+	      /* Instances are not put into the result list file, but are counted. */
+	      if (force_count)
+		{
+		  assert (force_count == 1);
+
+		  if (!OID_ISNULL (&oid) && XASL_IS_FLAGED (xasl, XASL_RETURN_GENERATED_KEYS)
+		      && is_autoincrement_set > 0)
+		    {
+		      db_make_oid (&oid_val, &oid);
+		      if (qfile_fast_val_tuple_to_list (thread_p, xasl->list_id, &oid_val) != NO_ERROR)
+			{
+			  GOTO_EXIT_ON_ERROR;
+			}
+		    }
+		  else
+		    {
+		      xasl->list_id->tuple_cnt += force_count;
+		    }
+		}
+	    }
+
+	  if (ls_scan != S_END)
+	    {
+	      GOTO_EXIT_ON_ERROR;
+	    }
+	}
+
+      if (xb_scan != S_END)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+      qexec_close_scan (thread_p, specp);
+    }
+  else
+    {
+      /* we are inserting a single row ie. insert into foo values(...) */
+      REGU_VARIABLE_LIST regu_list = NULL;
+
+      if (locator_start_force_scan_cache (thread_p, &scan_cache, &insert->class_hfid, &class_oid, scan_cache_op_type) !=
+	  NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+      scan_cache_inited = true;
+
+      if (XASL_IS_FLAGED (xasl, XASL_LINK_TO_REGU_VARIABLE) && scan_cache.file_type == FILE_HEAP_REUSE_SLOTS)
+	{
+	  /* do not allow references to reusable oids in sub-inserts. this is a safety check and should have been
+	   * detected at semantic level */
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_REFERENCE_TO_NON_REFERABLE_NOT_ALLOWED, 0);
+	  GOTO_EXIT_ON_ERROR;
+	}
+
+      for (i = 0; i < insert->num_val_lists; i++)
+	{
+	  for (regu_list = insert->valptr_lists[i]->valptrp, vallist = xasl->val_list->valp, k = num_default_expr;
+	       k < val_no; k++, regu_list = regu_list->next, vallist = vallist->next)
+	    {
+	      regu_list->value.flags |= REGU_VARIABLE_STRICT_TYPE_CAST;
+	      if (fetch_peek_dbval (thread_p, &regu_list->value, &xasl_state->vd, &class_oid, NULL, NULL, &valp) !=
+		  NO_ERROR)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+	      if (!qdata_copy_db_value (vallist->val, valp))
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+	      insert->vals[k] = valp;
+	    }
+
+	  /* evaluate constraint predicate */
+	  satisfies_constraints = V_UNKNOWN;
+	  if (insert->cons_pred != NULL)
+	    {
+	      satisfies_constraints = eval_pred (thread_p, insert->cons_pred, &xasl_state->vd, NULL);
+	      if (satisfies_constraints == V_ERROR)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+	    }
+
+	  if (insert->cons_pred != NULL && satisfies_constraints != V_TRUE)
+	    {
+	      /* currently there are only NOT NULL constraints */
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_NULL_CONSTRAINT_VIOLATION, 0);
+	      GOTO_EXIT_ON_ERROR;
+	    }
+
+	  if (heap_attrinfo_clear_dbvalues (&attr_info) != NO_ERROR)
+	    {
+	      GOTO_EXIT_ON_ERROR;
+	    }
+
+	  for (k = 0; k < val_no; ++k)
+	    {
+	      if (DB_IS_NULL (insert->vals[k]))
+		{
+		  OR_ATTRIBUTE *attr = heap_locate_last_attrepr (insert->att_id[k], &attr_info);
+		  if (attr == NULL)
+		    {
+		      GOTO_EXIT_ON_ERROR;
+		    }
+
+		  if (attr->is_autoincrement)
+		    {
+		      continue;
+		    }
+		}
+	      rc = heap_attrinfo_set (NULL, insert->att_id[k], insert->vals[k], &attr_info);
+	      if (rc != NO_ERROR)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+	    }
+
+	  if (heap_set_autoincrement_value (thread_p, &attr_info, &scan_cache, &is_autoincrement_set) != NO_ERROR)
+	    {
+	      GOTO_EXIT_ON_ERROR;
+	    }
+
+	  if (insert->do_replace && insert->has_uniques)
+	    {
+	      int removed_count = 0;
+	      assert (index_attr_info_inited == true);
+	      error =
+		qexec_remove_duplicates_for_replace (thread_p, &scan_cache, &attr_info, &index_attr_info, &idx_info,
+						     scan_cache_op_type, insert->pruning_type, pcontext,
+						     &removed_count);
+	      if (error != NO_ERROR)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+	      xasl->list_id->tuple_cnt += removed_count;
+	    }
+
+	  force_count = 0;
+	  if (odku_assignments && insert->has_uniques)
+	    {
+	      error =
+		qexec_execute_duplicate_key_update (thread_p, insert->odku, &insert->class_hfid, &xasl_state->vd,
+						    scan_cache_op_type, &scan_cache, &attr_info, &index_attr_info,
+						    &idx_info, insert->pruning_type, pcontext, &force_count);
+	      if (error != NO_ERROR)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+
+	      if (force_count)
+		{
+		  assert (force_count == 1);
+		  xasl->list_id->tuple_cnt += force_count * 2;
+		}
+	    }
+
+	  if (force_count == 0)
+	    {
+	      if (locator_attribute_info_force (thread_p, &insert->class_hfid, &oid, &attr_info, NULL, 0, operation,
+						scan_cache_op_type, &scan_cache, &force_count, false,
+						REPL_INFO_TYPE_RBR_NORMAL, insert->pruning_type, pcontext, NULL, NULL,
+						UPDATE_INPLACE_NONE, NULL, false) != NO_ERROR)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+
+	      /* Instances are not put into the result list file, but are counted. */
+	      if (force_count)
+		{
+		  assert (force_count == 1);
+		  if (!OID_ISNULL (&oid) && XASL_IS_FLAGED (xasl, XASL_RETURN_GENERATED_KEYS)
+		      && is_autoincrement_set > 0)
+		    {
+		      db_make_oid (&oid_val, &oid);
+		      if (qfile_fast_val_tuple_to_list (thread_p, xasl->list_id, &oid_val) != NO_ERROR)
+			{
+			  GOTO_EXIT_ON_ERROR;
+			}
+		    }
+		  else
+		    {
+		      xasl->list_id->tuple_cnt += force_count;
+		    }
+		}
+	    }
+
+	  if (XASL_IS_FLAGED (xasl, XASL_LINK_TO_REGU_VARIABLE))
+	    {
+	      /* this must be a sub-insert, and the inserted OID must be saved to obj_oid in insert_proc */
+	      assert (force_count == 1);
+	      if (force_count != 1)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+	      db_make_oid (insert->obj_oid, &oid);
+	      /* Clear the list id */
+	      qfile_clear_list_id (xasl->list_id);
+	    }
+	}
+    }
+
+  /* check uniques */
+  /* In this case, consider only single class. Therefore, uniqueness checking is performed based on the local
+   * statistical information kept in scan_cache. And then, it is reflected into the transaction's statistical
+   * information. */
+  if (pcontext != NULL)
+    {
+      error = qexec_process_partition_unique_stats (thread_p, pcontext);
+      if (error != NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+    }
+  else
+    {
+      // *INDENT-OFF*
+      if (scan_cache.m_index_stats != NULL)
+        {
+          for (const auto &it : scan_cache.m_index_stats->get_map ())
+	    {
+              if (!it.second.is_unique ())
+	        {
+                  // set no error?
+	          GOTO_EXIT_ON_ERROR;
+	        }
+
+	      error = logtb_tran_update_unique_stats (thread_p, it.first, it.second, true);
+	      if (error != NO_ERROR)
+	        {
+                  ASSERT_ERROR ();
+	          GOTO_EXIT_ON_ERROR;
+	        }
+	    }
+        }
+      // *INDENT-ON*
+    }
+
+  if (func_indx_preds)
+    {
+      heap_free_func_pred_unpack_info (thread_p, n_indexes, func_indx_preds, NULL);
+    }
+  if (index_attr_info_inited)
+    {
+      (void) heap_attrinfo_end (thread_p, &index_attr_info);
+    }
+  if (attr_info_inited)
+    {
+      (void) heap_attrinfo_end (thread_p, &attr_info);
+    }
+  if (scan_cache_inited)
+    {
+      (void) locator_end_force_scan_cache (thread_p, &scan_cache);
+    }
+  if (pcontext != NULL)
+    {
+      partition_clear_pruning_context (pcontext);
+      pcontext = NULL;
+    }
+
+  if (savepoint_used)
+    {
+      if (xtran_server_end_topop (thread_p, LOG_RESULT_TOPOP_ATTACH_TO_OUTER, &lsa) != TRAN_ACTIVE)
+	{
+	  qexec_failure_line (__LINE__, xasl_state);
+	  GOTO_EXIT_ON_ERROR;
+	}
+    }
+
+#if 0				/* yaw */
+  /* remove query result cache entries which are relevant with this class */
+  COPY_OID (&class_oid, &XASL_INSERT_CLASS_OID (xasl));
+  if (!QFILE_IS_LIST_CACHE_DISABLED && !OID_ISNULL (&class_oid))
+    {
+      if (qexec_clear_list_cache_by_class (&class_oid) != NO_ERROR)
+	{
+	  er_log_debug (ARG_FILE_LINE,
+			"qexec_execute_insert: qexec_clear_list_cache_by_class failed for class { %d %d %d }\n",
+			class_oid.pageid, class_oid.slotid, class_oid.volid);
+	}
+      qmgr_add_modified_class (&class_oid);
+    }
+#endif
+
+  for (k = 0; k < num_default_expr; k++)
+    {
+      pr_clear_value (insert->vals[k]);
+      db_private_free_and_init (thread_p, insert->vals[k]);
+    }
+
+  if (odku_assignments && insert->has_uniques)
+    {
+      heap_attrinfo_end (thread_p, odku_assignments->attr_info);
+    }
+
+  return NO_ERROR;
+
+exit_on_error:
+  (void) session_reset_cur_insert_id (thread_p);
+  for (k = 0; k < num_default_expr; k++)
+    {
+      pr_clear_value (insert->vals[k]);
+      db_private_free_and_init (thread_p, insert->vals[k]);
+    }
+  qexec_end_scan (thread_p, specp);
+  qexec_close_scan (thread_p, specp);
+  if (func_indx_preds)
+    {
+      heap_free_func_pred_unpack_info (thread_p, n_indexes, func_indx_preds, NULL);
+    }
+  if (index_attr_info_inited)
+    {
+      (void) heap_attrinfo_end (thread_p, &index_attr_info);
+    }
+  if (attr_info_inited)
+    {
+      (void) heap_attrinfo_end (thread_p, &attr_info);
+    }
+  if (odku_attr_info_inited)
+    {
+      (void) heap_attrinfo_end (thread_p, odku_assignments->attr_info);
+    }
+  if (scan_cache_inited)
+    {
+      (void) locator_end_force_scan_cache (thread_p, &scan_cache);
+    }
+
+  if (savepoint_used)
+    {
+      xtran_server_end_topop (thread_p, LOG_RESULT_TOPOP_ABORT, &lsa);
+    }
+  if (pcontext != NULL)
+    {
+      partition_clear_pruning_context (pcontext);
+      pcontext = NULL;
+    }
+  if ((XASL_IS_FLAGED (xasl, XASL_LINK_TO_REGU_VARIABLE) || XASL_IS_FLAGED (xasl, XASL_RETURN_GENERATED_KEYS))
+      && xasl->list_id != NULL)
+    {
+      qfile_clear_list_id (xasl->list_id);
+    }
+
+  return ER_FAILED;
+}
+
+/*
+ * qexec_execute_obj_fetch () -
+ *   return: NO_ERROR or ER_code
+ *   xasl(in)   : XASL Tree pointer
+ *   xasl_state(in)     : XASL tree state information
+ *   scan_operation_type(in) : scan operation type
+ *
+ * Note: This routines interpretes an XASL procedure block that denotes
+ * an object fetch operation, one of the basic operations
+ * of a path expression evaluation. A path expression evaluation
+ * consists of fetching the objects linked in a path expression
+ * and performing value fetch or predicate evalution operations
+ * on them. A path expression evaluation successfully completes
+ * if all the objects in the path are succesfully fetched and
+ * qualified imposed predicates. Some of the objects in a path
+ * expression may be non-existent. If that
+ * happens, path expression evaluation succeeds and the value
+ * list for the procedure block is filled with NULLs. A path
+ * evaluation may consist of an ordered list of object_fetch operations.
+ * To conform to the above mentioned semantics,
+ * an object fetch may succeed or fail
+ * depending whether the objects succesfully fetched and/or
+ * qualified. The result of the object fetch operation is
+ * indicated by setting a flag in the procedure block head node.
+ * The objects to be fetched are indicated by object identifiers
+ * already set in the procedure block head node.
+ */
+static int
+qexec_execute_obj_fetch (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
+			 SCAN_OPERATION_TYPE scan_operation_type)
+{
+  XASL_NODE *xptr;
+  DB_LOGICAL ev_res;
+  DB_LOGICAL ev_res2;
+  RECDES oRec = RECDES_INITIALIZER;
+  HEAP_SCANCACHE scan_cache;
+  ACCESS_SPEC_TYPE *specp = NULL;
+  OID cls_oid = OID_INITIALIZER;
+  int dead_end = false;
+  int unqualified_dead_end = false;
+  FETCH_PROC_NODE *fetch = &xasl->proc.fetch;
+  OID dbvaloid = OID_INITIALIZER;
+
+  /* the fetch_res represents whether current node in a path expression is successfully completed to the end, or failed */
+  fetch->fetch_res = false;
+
+  /* object is non_existent ? */
+  if (DB_IS_NULL (fetch->arg))
+    {
+      dead_end = true;
+    }
+  else
+    {
+      /* check for virtual objects */
+      if (DB_VALUE_DOMAIN_TYPE (fetch->arg) != DB_TYPE_VOBJ)
+	{
+	  SAFE_COPY_OID (&dbvaloid, db_get_oid (fetch->arg));
+	}
+      else
+	{
+	  DB_SET *setp = db_get_set (fetch->arg);
+	  DB_VALUE dbval, dbval1;
 
-	  if (!TP_IS_CHAR_TYPE (TP_DOMAIN_TYPE (attr->domain)))
+	  if ((db_set_size (setp) == 3) && (db_set_get (setp, 1, &dbval) == NO_ERROR)
+	      && (db_set_get (setp, 2, &dbval1) == NO_ERROR)
+	      && (DB_IS_NULL (&dbval)
+		  || ((DB_VALUE_DOMAIN_TYPE (&dbval) == DB_TYPE_OID) && OID_ISNULL (db_get_oid (&dbval))))
+	      && (DB_VALUE_DOMAIN_TYPE (&dbval1) == DB_TYPE_OID))
 	    {
-	      /* TO_CHAR returns a string value, we need to pass an expected domain of the result */
-	      if (TP_IS_CHAR_TYPE (DB_VALUE_TYPE (&insert_val)))
-		{
-		  result_domain = NULL;
-		}
-	      else if (DB_IS_NULL (&format_val))
-		{
-		  result_domain = tp_domain_resolve_default (DB_TYPE_STRING);
-		}
-	      else
-		{
-		  result_domain = tp_domain_resolve_value (&format_val, NULL);
-		}
+	      SAFE_COPY_OID (&dbvaloid, db_get_oid (&dbval1));
 	    }
 	  else
 	    {
-	      result_domain = attr->domain;
-	    }
-
-	  error = db_to_char (&insert_val, &format_val, &lang_val, insert->vals[k], result_domain);
-
-	  if (has_user_format)
-	    {
-	      pr_clear_value (&format_val);
+	      return ER_FAILED;
 	    }
 	}
-      else
-	{
-	  pr_clone_value (&insert_val, insert->vals[k]);
-	}
-
-      pr_clear_value (&insert_val);
 
-      if (error != NO_ERROR)
+      /* object is non_existent ? */
+      if (OID_ISNULL (&dbvaloid))
 	{
-	  GOTO_EXIT_ON_ERROR;
+	  dead_end = true;
 	}
+    }
 
-      if (attr->current_default_value.default_expr.default_expr_type == DB_DEFAULT_NONE)
+  /*
+   * Pre_processing
+   */
+
+  /* evaluate aptr list */
+  for (xptr = xasl->aptr_list; xptr != NULL; xptr = xptr->next)
+    {
+      if (XASL_IS_FLAGED (xptr, XASL_LINK_TO_REGU_VARIABLE))
 	{
-	  /* skip the value cast */
+	  /* skip if linked to regu var */
 	  continue;
 	}
 
-      status = tp_value_cast (insert->vals[k], insert->vals[k], attr->domain, false);
-      if (status != DOMAIN_COMPATIBLE)
+      if (xptr->status == XASL_CLEARED || xptr->status == XASL_INITIALIZED)
 	{
-	  (void) tp_domain_status_er_set (status, ARG_FILE_LINE, insert->vals[k], attr->domain);
-	  GOTO_EXIT_ON_ERROR;
+	  if (qexec_execute_mainblock (thread_p, xptr, xasl_state, NULL) != NO_ERROR)
+	    {
+	      GOTO_EXIT_ON_ERROR;
+	    }
+	}
+      else
+	{			/* already executed. success or failure */
+	  if (xptr->status != XASL_SUCCESS)
+	    {
+	      GOTO_EXIT_ON_ERROR;
+	    }
 	}
     }
 
-  specp = xasl->spec_list;
-  if (specp != NULL || ((insert->do_replace || (xasl->dptr_list != NULL)) && insert->has_uniques)
-      || insert->num_val_lists > 1)
-    {
-      scan_cache_op_type = MULTI_ROW_INSERT;
-    }
-  else
-    {
-      scan_cache_op_type = SINGLE_ROW_INSERT;
-    }
+  /*
+   * Processing
+   */
 
-  if (specp)
+  if (!dead_end)
     {
-      /* we are inserting multiple values ... ie. insert into foo select ... */
+      int cache_pred_end_needed = false;
+      int cache_rest_end_needed = false;
+      int scan_cache_end_needed = false;
+      int status = NO_ERROR;
+      MVCC_SNAPSHOT *mvcc_snapshot = NULL;
+      SCAN_CODE scan;
+      LOCK lock_mode;
 
-      /* if the class has at least one function index, the function expressions will be cached */
-      if (heap_init_func_pred_unpack_info (thread_p, &attr_info, &class_oid, &func_indx_preds) != NO_ERROR)
+      /* Start heap file scan operation */
+      /* A new argument(is_indexscan = false) is appended */
+
+      mvcc_snapshot = logtb_get_mvcc_snapshot (thread_p);
+      if (mvcc_snapshot == NULL)
 	{
 	  GOTO_EXIT_ON_ERROR;
 	}
 
-      if (locator_start_force_scan_cache (thread_p, &scan_cache, &insert->class_hfid, &class_oid,
-					  scan_cache_op_type) != NO_ERROR)
+      if (heap_scancache_start (thread_p, &scan_cache, NULL, NULL, true, false, mvcc_snapshot) != NO_ERROR)
 	{
 	  GOTO_EXIT_ON_ERROR;
 	}
-      scan_cache_inited = true;
+      scan_cache_end_needed = true;
 
-      assert (xasl->scan_op_type == S_SELECT);
+      /* must choose corresponding lock_mode for scan_operation_type.
+       * for root classes the lock_mode is considered, not the operation type */
+      lock_mode = locator_get_lock_mode_from_op_type (scan_operation_type);
 
-      /* force_select_lock = false */
-      if (qexec_open_scan (thread_p, specp, xasl->val_list, &xasl_state->vd, false, specp->fixed_scan,
-			   specp->grouped_scan, true, &specp->s_id, xasl_state->query_id, S_SELECT, false,
-			   NULL) != NO_ERROR)
+      /* fetch the object and the class oid */
+      scan = locator_get_object (thread_p, &dbvaloid, &cls_oid, &oRec, &scan_cache, scan_operation_type, lock_mode,
+				 PEEK, NULL_CHN);
+      if (scan != S_SUCCESS)
 	{
-	  if (savepoint_used)
+	  /* setting ER_HEAP_UNKNOWN_OBJECT error for deleted or invisible objects should be replaced by a more clear
+	   * way of handling the return code; it is imposible to decide at low level heap get functions if it is
+	   * expected to reach a deleted object and also it is difficult to propagate the NON_EXISTENT_HANDLING
+	   * argument through all the callers; this system can currently generate some irrelevant error log that is
+	   * hard to eliminate */
+	  if (scan == S_DOESNT_EXIST || scan == S_SNAPSHOT_NOT_SATISFIED)
 	    {
-	      xtran_server_end_topop (thread_p, LOG_RESULT_TOPOP_ABORT, &lsa);
+	      /* dangling object reference */
+	      dead_end = true;
+	      er_clear ();	/* probably ER_HEAP_UNKNOWN_OBJECT is set */
 	    }
-	  qexec_failure_line (__LINE__, xasl_state);
-	  GOTO_EXIT_ON_ERROR;
-	}
-
-      while ((xb_scan = qexec_next_scan_block_iterations (thread_p, xasl)) == S_SUCCESS)
-	{
-	  s_id = &xasl->curr_spec->s_id;
-	  while ((ls_scan = scan_next_scan (thread_p, s_id)) == S_SUCCESS)
+	  else if (er_errid () == ER_HEAP_NODATA_NEWADDRESS)
 	    {
-	      for (k = num_default_expr, vallist = s_id->val_list->valp; k < val_no; k++, vallist = vallist->next)
-		{
-		  if (vallist == NULL || vallist->val == NULL)
-		    {
-		      assert (0);
-		      GOTO_EXIT_ON_ERROR;
-		    }
-
-		  insert->vals[k] = vallist->val;
-		}
-
-	      /* evaluate constraint predicate */
-	      satisfies_constraints = V_UNKNOWN;
-	      if (insert->cons_pred != NULL)
-		{
-		  satisfies_constraints = eval_pred (thread_p, insert->cons_pred, &xasl_state->vd, NULL);
-		  if (satisfies_constraints == V_ERROR)
-		    {
-		      GOTO_EXIT_ON_ERROR;
-		    }
-		}
-
-	      if (insert->cons_pred != NULL && satisfies_constraints != V_TRUE)
-		{
-		  /* currently there are only NOT NULL constraints */
-		  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_NULL_CONSTRAINT_VIOLATION, 0);
-		  GOTO_EXIT_ON_ERROR;
-		}
-
-	      if (heap_attrinfo_clear_dbvalues (&attr_info) != NO_ERROR)
-		{
-		  GOTO_EXIT_ON_ERROR;
-		}
-	      for (k = 0; k < val_no; ++k)
-		{
-		  if (DB_IS_NULL (insert->vals[k]))
-		    {
-		      OR_ATTRIBUTE *attr = heap_locate_last_attrepr (insert->att_id[k], &attr_info);
-
-		      if (attr == NULL)
-			{
-			  GOTO_EXIT_ON_ERROR;
-			}
-
-		      if (attr->is_autoincrement)
-			{
-			  continue;
-			}
-		    }
-
-
-		  rc = heap_attrinfo_set (NULL, insert->att_id[k], insert->vals[k], &attr_info);
-		  if (rc != NO_ERROR)
-		    {
-		      GOTO_EXIT_ON_ERROR;
-		    }
-		}
-
-	      if (heap_set_autoincrement_value (thread_p, &attr_info, &scan_cache, &is_autoincrement_set) != NO_ERROR)
-		{
-		  GOTO_EXIT_ON_ERROR;
-		}
-
-	      if (insert->do_replace && insert->has_uniques)
-		{
-		  int removed_count = 0;
-
-		  assert (index_attr_info_inited == true);
-
-		  if (qexec_remove_duplicates_for_replace (thread_p, &scan_cache, &attr_info, &index_attr_info,
-							   &idx_info, scan_cache_op_type, insert->pruning_type,
-							   pcontext, &removed_count) != NO_ERROR)
-		    {
-		      GOTO_EXIT_ON_ERROR;
-		    }
-		  xasl->list_id->tuple_cnt += removed_count;
-		}
-
-	      if (odku_assignments && insert->has_uniques)
-		{
-		  force_count = 0;
-		  error =
-		    qexec_execute_duplicate_key_update (thread_p, insert->odku, &insert->class_hfid, &xasl_state->vd,
-							scan_cache_op_type, &scan_cache, &attr_info, &index_attr_info,
-							&idx_info, insert->pruning_type, pcontext, &force_count);
-		  if (error != NO_ERROR)
-		    {
-		      GOTO_EXIT_ON_ERROR;
-		    }
-
-		  if (force_count != 0)
-		    {
-		      assert (force_count == 1);
+	      dead_end = true;
+	      unqualified_dead_end = true;
+	      er_clear ();	/* clear ER_HEAP_NODATA_NEWADDRESS */
+	    }
+	  else if (er_errid () == ER_HEAP_UNKNOWN_OBJECT)
+	    {
+	      /* where is this from? */
+	      assert (false);
+	      dead_end = true;
+	      er_clear ();	/* clear ER_HEAP_UNKOWN_OBJECT */
+	    }
+	  else
+	    {
+	      status = ER_FAILED;
+	      goto wrapup;
+	    }
+	}
+      else
+	{
+	  /* check to see if the object is one of the classes that we are interested in.  This can only fail if there
+	   * was a selector variable in the query.  we can optimize this further to pass from the compiler whether this
+	   * check is necessary or not. */
+	  bool found = false;
 
-		      xasl->list_id->tuple_cnt += force_count * 2;
-		      continue;
-		    }
-		}
+	  for (specp = xasl->spec_list;
+	       specp && specp->type == TARGET_CLASS && !XASL_IS_FLAGED (xasl, XASL_OBJFETCH_IGNORE_CLASSOID);
+	       specp = specp->next)
+	    {
+	      PARTITION_SPEC_TYPE *current = NULL;
 
-	      force_count = 0;
-	      /* when insert in heap, don't care about instance locking */
-	      if (locator_attribute_info_force (thread_p, &insert->class_hfid, &oid, &attr_info, NULL, 0, operation,
-						scan_cache_op_type, &scan_cache, &force_count, false,
-						REPL_INFO_TYPE_RBR_NORMAL, insert->pruning_type, pcontext,
-						func_indx_preds, NULL, UPDATE_INPLACE_NONE, NULL, false) != NO_ERROR)
+	      if (OID_EQ (&ACCESS_SPEC_CLS_OID (specp), &cls_oid))
 		{
-		  GOTO_EXIT_ON_ERROR;
+		  /* found it */
+		  break;
 		}
 
-	      /* restore class oid and hfid that might have changed in the call above */
-	      HFID_COPY (&insert->class_hfid, &class_hfid);
-	      COPY_OID (&(attr_info.class_oid), &class_oid);
-
-	      /* Instances are not put into the result list file, but are counted. */
-	      if (force_count)
+	      if (!specp->pruned && specp->type == TARGET_CLASS)
 		{
-		  assert (force_count == 1);
+		  /* cls_oid might still refer to this spec through a partition. See if we already pruned this spec and
+		   * search through partitions for the appropriate class */
+		  PARTITION_SPEC_TYPE *partition_spec = NULL;
+		  int granted;
 
-		  if (!OID_ISNULL (&oid) && XASL_IS_FLAGED (xasl, XASL_RETURN_GENERATED_KEYS)
-		      && is_autoincrement_set > 0)
+		  if (partition_prune_spec (thread_p, &xasl_state->vd, specp) != NO_ERROR)
 		    {
-		      db_make_oid (&oid_val, &oid);
-		      if (qfile_fast_val_tuple_to_list (thread_p, xasl->list_id, &oid_val) != NO_ERROR)
+		      status = ER_FAILED;
+		      goto wrapup;
+		    }
+		  for (partition_spec = specp->parts; partition_spec != NULL; partition_spec = partition_spec->next)
+		    {
+		      granted =
+			lock_subclass (thread_p, &partition_spec->oid, &ACCESS_SPEC_CLS_OID (specp), IS_LOCK,
+				       LK_UNCOND_LOCK);
+		      if (granted != LK_GRANTED)
 			{
-			  GOTO_EXIT_ON_ERROR;
+			  status = ER_FAILED;
+			  goto wrapup;
 			}
 		    }
-		  else
+		}
+
+	      current = specp->parts;
+	      found = false;
+	      while (current != NULL)
+		{
+		  if (OID_EQ (&current->oid, &cls_oid))
 		    {
-		      xasl->list_id->tuple_cnt += force_count;
+		      found = true;
+		      break;
 		    }
+		  current = current->next;
+		}
+
+	      if (found)
+		{
+		  break;
 		}
 	    }
 
-	  if (ls_scan != S_END)
+	  if (specp == NULL)
 	    {
-	      GOTO_EXIT_ON_ERROR;
+	      /* no specification contains the class oid, this is a possible situation for object domain definitions.
+	       * It just causes the object fetch result to fail. */
+	      fetch->fetch_res = false;
+	      dead_end = true;
+	      unqualified_dead_end = true;
 	    }
 	}
 
-      if (xb_scan != S_END)
+      if (!dead_end)
 	{
-	  GOTO_EXIT_ON_ERROR;
-	}
-      qexec_close_scan (thread_p, specp);
-    }
-  else
-    {
-      /* we are inserting a single row ie. insert into foo values(...) */
-      REGU_VARIABLE_LIST regu_list = NULL;
+	  /* set up the attribute cache info */
+	  status =
+	    heap_attrinfo_start (thread_p, &cls_oid, specp->s.cls_node.num_attrs_pred, specp->s.cls_node.attrids_pred,
+				 specp->s.cls_node.cache_pred);
+	  if (status != NO_ERROR)
+	    {
+	      goto wrapup;
+	    }
+	  cache_pred_end_needed = true;
 
-      if (locator_start_force_scan_cache (thread_p, &scan_cache, &insert->class_hfid, &class_oid, scan_cache_op_type) !=
-	  NO_ERROR)
-	{
-	  GOTO_EXIT_ON_ERROR;
-	}
-      scan_cache_inited = true;
+	  status =
+	    heap_attrinfo_start (thread_p, &cls_oid, specp->s.cls_node.num_attrs_rest, specp->s.cls_node.attrids_rest,
+				 specp->s.cls_node.cache_rest);
+	  if (status != NO_ERROR)
+	    {
+	      goto wrapup;
+	    }
+	  cache_rest_end_needed = true;
 
-      if (XASL_IS_FLAGED (xasl, XASL_LINK_TO_REGU_VARIABLE) && scan_cache.file_type == FILE_HEAP_REUSE_SLOTS)
-	{
-	  /* do not allow references to reusable oids in sub-inserts. this is a safety check and should have been
-	   * detected at semantic level */
-	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_REFERENCE_TO_NON_REFERABLE_NOT_ALLOWED, 0);
-	  GOTO_EXIT_ON_ERROR;
-	}
+	  fetch_init_val_list (specp->s.cls_node.cls_regu_list_pred);
+	  fetch_init_val_list (specp->s.cls_node.cls_regu_list_rest);
 
-      for (i = 0; i < insert->num_val_lists; i++)
-	{
-	  for (regu_list = insert->valptr_lists[i]->valptrp, vallist = xasl->val_list->valp, k = num_default_expr;
-	       k < val_no; k++, regu_list = regu_list->next, vallist = vallist->next)
+	  /* read the predicate values from the heap into the scancache */
+	  status = heap_attrinfo_read_dbvalues (thread_p, &dbvaloid, &oRec, &scan_cache, specp->s.cls_node.cache_pred);
+	  if (status != NO_ERROR)
 	    {
-	      regu_list->value.flags |= REGU_VARIABLE_STRICT_TYPE_CAST;
-	      if (fetch_peek_dbval (thread_p, &regu_list->value, &xasl_state->vd, &class_oid, NULL, NULL, &valp) !=
-		  NO_ERROR)
-		{
-		  GOTO_EXIT_ON_ERROR;
-		}
-	      if (!qdata_copy_db_value (vallist->val, valp))
-		{
-		  GOTO_EXIT_ON_ERROR;
-		}
-	      insert->vals[k] = valp;
+	      goto wrapup;
 	    }
 
-	  /* evaluate constraint predicate */
-	  satisfies_constraints = V_UNKNOWN;
-	  if (insert->cons_pred != NULL)
+	  /* fetch the values for the predicate from the object */
+	  if (xasl->val_list != NULL)
 	    {
-	      satisfies_constraints = eval_pred (thread_p, insert->cons_pred, &xasl_state->vd, NULL);
-	      if (satisfies_constraints == V_ERROR)
+	      status =
+		fetch_val_list (thread_p, specp->s.cls_node.cls_regu_list_pred, &xasl_state->vd, NULL, &dbvaloid, NULL,
+				COPY);
+	      if (status != NO_ERROR)
 		{
-		  GOTO_EXIT_ON_ERROR;
+		  goto wrapup;
 		}
 	    }
 
-	  if (insert->cons_pred != NULL && satisfies_constraints != V_TRUE)
+	  /* evaluate where predicate, if any */
+	  ev_res = V_UNKNOWN;
+	  if (specp->where_pred)
 	    {
-	      /* currently there are only NOT NULL constraints */
-	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_NULL_CONSTRAINT_VIOLATION, 0);
-	      GOTO_EXIT_ON_ERROR;
+	      ev_res = eval_pred (thread_p, specp->where_pred, &xasl_state->vd, &dbvaloid);
+	      if (ev_res == V_ERROR)
+		{
+		  status = ER_FAILED;
+		  goto wrapup;
+		}
 	    }
 
-	  if (heap_attrinfo_clear_dbvalues (&attr_info) != NO_ERROR)
+	  if (specp->where_pred != NULL && ev_res != V_TRUE)
 	    {
-	      GOTO_EXIT_ON_ERROR;
+	      /* the object is a disqualified one */
+	      fetch->fetch_res = false;
 	    }
-
-	  for (k = 0; k < val_no; ++k)
+	  else
 	    {
-	      if (DB_IS_NULL (insert->vals[k]))
+	      /* the object is a qualified */
+	      fetch->fetch_res = true;
+	      /* read the rest of the values from the heap */
+	      status =
+		heap_attrinfo_read_dbvalues (thread_p, &dbvaloid, &oRec, &scan_cache, specp->s.cls_node.cache_rest);
+	      if (status != NO_ERROR)
 		{
-		  OR_ATTRIBUTE *attr = heap_locate_last_attrepr (insert->att_id[k], &attr_info);
-		  if (attr == NULL)
-		    {
-		      GOTO_EXIT_ON_ERROR;
-		    }
+		  goto wrapup;
+		}
 
-		  if (attr->is_autoincrement)
+	      /* fetch the rest of the values from the object */
+	      if (xasl->val_list != NULL)
+		{
+		  status =
+		    fetch_val_list (thread_p, specp->s.cls_node.cls_regu_list_rest, &xasl_state->vd, NULL, &dbvaloid,
+				    NULL, COPY);
+		  if (status != NO_ERROR)
 		    {
-		      continue;
+		      goto wrapup;
 		    }
 		}
-	      rc = heap_attrinfo_set (NULL, insert->att_id[k], insert->vals[k], &attr_info);
-	      if (rc != NO_ERROR)
-		{
-		  GOTO_EXIT_ON_ERROR;
-		}
 	    }
+	}
 
-	  if (heap_set_autoincrement_value (thread_p, &attr_info, &scan_cache, &is_autoincrement_set) != NO_ERROR)
+    wrapup:
+      if (cache_pred_end_needed)
+	{
+	  heap_attrinfo_end (thread_p, specp->s.cls_node.cache_pred);
+	}
+      if (cache_rest_end_needed)
+	{
+	  heap_attrinfo_end (thread_p, specp->s.cls_node.cache_rest);
+	}
+      if (scan_cache_end_needed)
+	{
+	  (void) heap_scancache_end (thread_p, &scan_cache);
+	}
+      if (status == ER_FAILED)
+	{
+	  return ER_FAILED;
+	}
+    }				/* if !dead_end */
+
+  if (dead_end)
+    {
+      /* set values to null */
+      if (unqualified_dead_end || fetch->ql_flag == true)
+	{
+	  /* the object is unqualified */
+	  fetch->fetch_res = false;
+	}
+      else
+	{
+	  qdata_set_value_list_to_null (xasl->val_list);
+	  fetch->fetch_res = true;	/* the object is qualified */
+	}
+    }
+
+  if (fetch->fetch_res)
+    {
+      /* evaluate bptr list */
+      for (xptr = xasl->bptr_list; fetch->fetch_res == true && xptr != NULL; xptr = xptr->next)
+	{
+	  if (qexec_execute_obj_fetch (thread_p, xptr, xasl_state, scan_operation_type) != NO_ERROR)
 	    {
 	      GOTO_EXIT_ON_ERROR;
 	    }
+	  else if (xptr->proc.fetch.fetch_res == false)
+	    {
+	      fetch->fetch_res = false;
+	    }
+	}
 
-	  if (insert->do_replace && insert->has_uniques)
+      if (fetch->fetch_res)
+	{
+
+	  /* evaluate dptr list */
+	  for (xptr = xasl->dptr_list; xptr != NULL; xptr = xptr->next)
 	    {
-	      int removed_count = 0;
-	      assert (index_attr_info_inited == true);
-	      error =
-		qexec_remove_duplicates_for_replace (thread_p, &scan_cache, &attr_info, &index_attr_info, &idx_info,
-						     scan_cache_op_type, insert->pruning_type, pcontext,
-						     &removed_count);
-	      if (error != NO_ERROR)
+	      /* clear correlated subquery list files */
+	      qexec_clear_head_lists (thread_p, xptr);
+	      if (XASL_IS_FLAGED (xptr, XASL_LINK_TO_REGU_VARIABLE))
+		{
+		  /* skip if linked to regu var */
+		  continue;
+		}
+	      if (qexec_execute_mainblock (thread_p, xptr, xasl_state, NULL) != NO_ERROR)
 		{
 		  GOTO_EXIT_ON_ERROR;
 		}
-	      xasl->list_id->tuple_cnt += removed_count;
 	    }
 
-	  force_count = 0;
-	  if (odku_assignments && insert->has_uniques)
+	  /* evaluate constant (if) predicate */
+	  if (fetch->fetch_res && xasl->if_pred != NULL)
 	    {
-	      error =
-		qexec_execute_duplicate_key_update (thread_p, insert->odku, &insert->class_hfid, &xasl_state->vd,
-						    scan_cache_op_type, &scan_cache, &attr_info, &index_attr_info,
-						    &idx_info, insert->pruning_type, pcontext, &force_count);
-	      if (error != NO_ERROR)
+	      ev_res2 = eval_pred (thread_p, xasl->if_pred, &xasl_state->vd, NULL);
+	      if (ev_res2 == V_ERROR)
 		{
 		  GOTO_EXIT_ON_ERROR;
 		}
-
-	      if (force_count)
+	      else if (ev_res2 != V_TRUE)
 		{
-		  assert (force_count == 1);
-		  xasl->list_id->tuple_cnt += force_count * 2;
+		  fetch->fetch_res = false;
 		}
-	    }
+	    }			/* if */
 
-	  if (force_count == 0)
+	  if (fetch->fetch_res)
 	    {
-	      if (locator_attribute_info_force (thread_p, &insert->class_hfid, &oid, &attr_info, NULL, 0, operation,
-						scan_cache_op_type, &scan_cache, &force_count, false,
-						REPL_INFO_TYPE_RBR_NORMAL, insert->pruning_type, pcontext, NULL, NULL,
-						UPDATE_INPLACE_NONE, NULL, false) != NO_ERROR)
-		{
-		  GOTO_EXIT_ON_ERROR;
-		}
-
-	      /* Instances are not put into the result list file, but are counted. */
-	      if (force_count)
+	      /* evaluate fptr list */
+	      for (xptr = xasl->fptr_list; fetch->fetch_res == true && xptr != NULL; xptr = xptr->next)
 		{
-		  assert (force_count == 1);
-		  if (!OID_ISNULL (&oid) && XASL_IS_FLAGED (xasl, XASL_RETURN_GENERATED_KEYS)
-		      && is_autoincrement_set > 0)
+		  if (qexec_execute_obj_fetch (thread_p, xptr, xasl_state, scan_operation_type) != NO_ERROR)
 		    {
-		      db_make_oid (&oid_val, &oid);
-		      if (qfile_fast_val_tuple_to_list (thread_p, xasl->list_id, &oid_val) != NO_ERROR)
-			{
-			  GOTO_EXIT_ON_ERROR;
-			}
+		      GOTO_EXIT_ON_ERROR;
 		    }
-		  else
+		  else if (xptr->proc.fetch.fetch_res == false)
 		    {
-		      xasl->list_id->tuple_cnt += force_count;
+		      fetch->fetch_res = false;
 		    }
 		}
-	    }
-
-	  if (XASL_IS_FLAGED (xasl, XASL_LINK_TO_REGU_VARIABLE))
-	    {
-	      /* this must be a sub-insert, and the inserted OID must be saved to obj_oid in insert_proc */
-	      assert (force_count == 1);
-	      if (force_count != 1)
-		{
-		  GOTO_EXIT_ON_ERROR;
-		}
-	      db_make_oid (insert->obj_oid, &oid);
-	      /* Clear the list id */
-	      qfile_clear_list_id (xasl->list_id);
-	    }
-	}
-    }
-
-  /* check uniques */
-  /* In this case, consider only single class. Therefore, uniqueness checking is performed based on the local
-   * statistical information kept in scan_cache. And then, it is reflected into the transaction's statistical
-   * information. */
-  if (pcontext != NULL)
-    {
-      error = qexec_process_partition_unique_stats (thread_p, pcontext);
-      if (error != NO_ERROR)
-	{
-	  GOTO_EXIT_ON_ERROR;
-	}
-    }
-  else
-    {
-      // *INDENT-OFF*
-      if (scan_cache.m_index_stats != NULL)
-        {
-          for (const auto &it : scan_cache.m_index_stats->get_map ())
-	    {
-              if (!it.second.is_unique ())
-	        {
-                  // set no error?
-	          GOTO_EXIT_ON_ERROR;
-	        }
-
-	      error = logtb_tran_update_unique_stats (thread_p, it.first, it.second, true);
-	      if (error != NO_ERROR)
-	        {
-                  ASSERT_ERROR ();
-	          GOTO_EXIT_ON_ERROR;
-	        }
-	    }
-        }
-      // *INDENT-ON*
-    }
-
-  if (func_indx_preds)
-    {
-      heap_free_func_pred_unpack_info (thread_p, n_indexes, func_indx_preds, NULL);
-    }
-  if (index_attr_info_inited)
-    {
-      (void) heap_attrinfo_end (thread_p, &index_attr_info);
-    }
-  if (attr_info_inited)
-    {
-      (void) heap_attrinfo_end (thread_p, &attr_info);
-    }
-  if (scan_cache_inited)
-    {
-      (void) locator_end_force_scan_cache (thread_p, &scan_cache);
-    }
-  if (pcontext != NULL)
-    {
-      partition_clear_pruning_context (pcontext);
-      pcontext = NULL;
-    }
-
-  if (savepoint_used)
-    {
-      if (xtran_server_end_topop (thread_p, LOG_RESULT_TOPOP_ATTACH_TO_OUTER, &lsa) != TRAN_ACTIVE)
-	{
-	  qexec_failure_line (__LINE__, xasl_state);
-	  GOTO_EXIT_ON_ERROR;
-	}
-    }
-
-#if 0				/* yaw */
-  /* remove query result cache entries which are relevant with this class */
-  COPY_OID (&class_oid, &XASL_INSERT_CLASS_OID (xasl));
-  if (!QFILE_IS_LIST_CACHE_DISABLED && !OID_ISNULL (&class_oid))
-    {
-      if (qexec_clear_list_cache_by_class (&class_oid) != NO_ERROR)
-	{
-	  er_log_debug (ARG_FILE_LINE,
-			"qexec_execute_insert: qexec_clear_list_cache_by_class failed for class { %d %d %d }\n",
-			class_oid.pageid, class_oid.slotid, class_oid.volid);
-	}
-      qmgr_add_modified_class (&class_oid);
-    }
-#endif
-
-  for (k = 0; k < num_default_expr; k++)
-    {
-      pr_clear_value (insert->vals[k]);
-      db_private_free_and_init (thread_p, insert->vals[k]);
-    }
-
-  if (odku_assignments && insert->has_uniques)
-    {
-      heap_attrinfo_end (thread_p, odku_assignments->attr_info);
-    }
-
-  return NO_ERROR;
 
-exit_on_error:
-  (void) session_reset_cur_insert_id (thread_p);
-  for (k = 0; k < num_default_expr; k++)
-    {
-      pr_clear_value (insert->vals[k]);
-      db_private_free_and_init (thread_p, insert->vals[k]);
-    }
-  qexec_end_scan (thread_p, specp);
-  qexec_close_scan (thread_p, specp);
-  if (func_indx_preds)
-    {
-      heap_free_func_pred_unpack_info (thread_p, n_indexes, func_indx_preds, NULL);
-    }
-  if (index_attr_info_inited)
-    {
-      (void) heap_attrinfo_end (thread_p, &index_attr_info);
-    }
-  if (attr_info_inited)
-    {
-      (void) heap_attrinfo_end (thread_p, &attr_info);
-    }
-  if (odku_attr_info_inited)
-    {
-      (void) heap_attrinfo_end (thread_p, odku_assignments->attr_info);
-    }
-  if (scan_cache_inited)
-    {
-      (void) locator_end_force_scan_cache (thread_p, &scan_cache);
-    }
+	      /* NO SCAN PROCEDURES are supported for these blocks! */
+	    }			/* if */
 
-  if (savepoint_used)
-    {
-      xtran_server_end_topop (thread_p, LOG_RESULT_TOPOP_ABORT, &lsa);
-    }
-  if (pcontext != NULL)
-    {
-      partition_clear_pruning_context (pcontext);
-      pcontext = NULL;
-    }
-  if ((XASL_IS_FLAGED (xasl, XASL_LINK_TO_REGU_VARIABLE) || XASL_IS_FLAGED (xasl, XASL_RETURN_GENERATED_KEYS))
-      && xasl->list_id != NULL)
-    {
-      qfile_clear_list_id (xasl->list_id);
-    }
+	}			/* if */
 
-  return ER_FAILED;
-}
+    }				/* if */
 
-/*
- * qexec_execute_obj_fetch () -
- *   return: NO_ERROR or ER_code
- *   xasl(in)   : XASL Tree pointer
- *   xasl_state(in)     : XASL tree state information
- *   scan_operation_type(in) : scan operation type
- *
- * Note: This routines interpretes an XASL procedure block that denotes
- * an object fetch operation, one of the basic operations
- * of a path expression evaluation. A path expression evaluation
- * consists of fetching the objects linked in a path expression
- * and performing value fetch or predicate evalution operations
- * on them. A path expression evaluation successfully completes
- * if all the objects in the path are succesfully fetched and
- * qualified imposed predicates. Some of the objects in a path
- * expression may be non-existent. If that
- * happens, path expression evaluation succeeds and the value
- * list for the procedure block is filled with NULLs. A path
- * evaluation may consist of an ordered list of object_fetch operations.
- * To conform to the above mentioned semantics,
- * an object fetch may succeed or fail
- * depending whether the objects succesfully fetched and/or
- * qualified. The result of the object fetch operation is
- * indicated by setting a flag in the procedure block head node.
- * The objects to be fetched are indicated by object identifiers
- * already set in the procedure block head node.
+  /* clear uncorrelated subquery list files */
+  if (xasl->aptr_list)
+    {
+      qexec_clear_head_lists (thread_p, xasl->aptr_list);
+    }
+
+  return NO_ERROR;
+
+exit_on_error:
+
+  /* clear uncorrelated subquery list files */
+  if (xasl->aptr_list)
+    {
+      qexec_clear_head_lists (thread_p, xasl->aptr_list);
+    }
+
+  return ER_FAILED;
+}
+
+/*
+ * qexec_execute_increment () -
+ *   return:
+ *   oid(in)    :
+ *   class_oid(in)      :
+ *   class_hfid(in)     :
+ *   attrid(in) :
+ *   n_increment(in)    :
+ *   pruning_type(in)	:
+ *   need_locking(in)	: true, if need locking
  */
 static int
-qexec_execute_obj_fetch (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
-			 SCAN_OPERATION_TYPE scan_operation_type)
+qexec_execute_increment (THREAD_ENTRY * thread_p, const OID * oid, const OID * class_oid, const HFID * class_hfid,
+			 ATTR_ID attrid, int n_increment, int pruning_type)
 {
-  XASL_NODE *xptr;
-  DB_LOGICAL ev_res;
-  DB_LOGICAL ev_res2;
-  RECDES oRec = RECDES_INITIALIZER;
+  HEAP_CACHE_ATTRINFO attr_info;
+  int attr_info_inited = 0;
   HEAP_SCANCACHE scan_cache;
-  ACCESS_SPEC_TYPE *specp = NULL;
-  OID cls_oid = OID_INITIALIZER;
-  int dead_end = false;
-  int unqualified_dead_end = false;
-  FETCH_PROC_NODE *fetch = &xasl->proc.fetch;
-  OID dbvaloid = OID_INITIALIZER;
+  bool scan_cache_inited = false;
+  HEAP_ATTRVALUE *value = NULL;
+  int force_count;
+  int error = NO_ERROR;
+  int op_type = SINGLE_ROW_UPDATE;
+  LC_COPYAREA_OPERATION area_op = LC_FLUSH_UPDATE;
 
-  /* the fetch_res represents whether current node in a path expression is successfully completed to the end, or failed */
-  fetch->fetch_res = false;
+  error = heap_attrinfo_start (thread_p, class_oid, -1, NULL, &attr_info);
+  if (error != NO_ERROR)
+    {
+      goto wrapup;
+    }
+  attr_info_inited = 1;
 
-  /* object is non_existent ? */
-  if (DB_IS_NULL (fetch->arg))
+
+  error = locator_start_force_scan_cache (thread_p, &scan_cache, class_hfid, class_oid, op_type);
+  if (error != NO_ERROR)
     {
-      dead_end = true;
+      goto wrapup;
     }
-  else
+  scan_cache_inited = true;
+
+  if (!class_hfid)
     {
-      /* check for virtual objects */
-      if (DB_VALUE_DOMAIN_TYPE (fetch->arg) != DB_TYPE_VOBJ)
-	{
-	  SAFE_COPY_OID (&dbvaloid, db_get_oid (fetch->arg));
-	}
-      else
-	{
-	  DB_SET *setp = db_get_set (fetch->arg);
-	  DB_VALUE dbval, dbval1;
+      error = ER_FAILED;
+      goto wrapup;
+    }
 
-	  if ((db_set_size (setp) == 3) && (db_set_get (setp, 1, &dbval) == NO_ERROR)
-	      && (db_set_get (setp, 2, &dbval1) == NO_ERROR)
-	      && (DB_IS_NULL (&dbval)
-		  || ((DB_VALUE_DOMAIN_TYPE (&dbval) == DB_TYPE_OID) && OID_ISNULL (db_get_oid (&dbval))))
-	      && (DB_VALUE_DOMAIN_TYPE (&dbval1) == DB_TYPE_OID))
-	    {
-	      SAFE_COPY_OID (&dbvaloid, db_get_oid (&dbval1));
-	    }
-	  else
-	    {
-	      return ER_FAILED;
-	    }
+  if (!HFID_IS_NULL (class_hfid))
+    {
+      if (heap_attrinfo_clear_dbvalues (&attr_info) != NO_ERROR)
+	{
+	  error = ER_FAILED;
+	  goto wrapup;
 	}
 
-      /* object is non_existent ? */
-      if (OID_ISNULL (&dbvaloid))
+      /* set increment operation for the attr */
+      value = heap_attrvalue_locate (attrid, &attr_info);
+      if (value == NULL)
 	{
-	  dead_end = true;
+	  error = ER_FAILED;
+	  goto wrapup;
 	}
-    }
 
-  /*
-   * Pre_processing
-   */
+      value->do_increment = n_increment;
 
-  /* evaluate aptr list */
-  for (xptr = xasl->aptr_list; xptr != NULL; xptr = xptr->next)
-    {
-      if (XASL_IS_FLAGED (xptr, XASL_LINK_TO_REGU_VARIABLE))
+      force_count = 0;
+      /* oid was already locked in select phase */
+      OID copy_oid = *oid;
+      error =
+	locator_attribute_info_force (thread_p, class_hfid, &copy_oid, &attr_info, &attrid, 1, area_op, op_type,
+				      &scan_cache, &force_count, false, REPL_INFO_TYPE_RBR_NORMAL, pruning_type, NULL,
+				      NULL, NULL, UPDATE_INPLACE_NONE, NULL, false);
+      if (error == ER_MVCC_NOT_SATISFIED_REEVALUATION)
 	{
-	  /* skip if linked to regu var */
-	  continue;
+	  assert (force_count == 0);
+	  error = NO_ERROR;
 	}
-
-      if (xptr->status == XASL_CLEARED || xptr->status == XASL_INITIALIZED)
+      else if (error != NO_ERROR)
 	{
-	  if (qexec_execute_mainblock (thread_p, xptr, xasl_state, NULL) != NO_ERROR)
-	    {
-	      GOTO_EXIT_ON_ERROR;
-	    }
-	}
-      else
-	{			/* already executed. success or failure */
-	  if (xptr->status != XASL_SUCCESS)
-	    {
-	      GOTO_EXIT_ON_ERROR;
-	    }
+	  error = ER_FAILED;
+	  goto wrapup;
 	}
     }
 
-  /*
-   * Processing
-   */
-
-  if (!dead_end)
+#if 0				/* yaw */
+  /* remove query result cache entries which are relevant with this class */
+  if (!QFILE_IS_LIST_CACHE_DISABLED)
     {
-      int cache_pred_end_needed = false;
-      int cache_rest_end_needed = false;
-      int scan_cache_end_needed = false;
-      int status = NO_ERROR;
-      MVCC_SNAPSHOT *mvcc_snapshot = NULL;
-      SCAN_CODE scan;
-      LOCK lock_mode;
-
-      /* Start heap file scan operation */
-      /* A new argument(is_indexscan = false) is appended */
-
-      mvcc_snapshot = logtb_get_mvcc_snapshot (thread_p);
-      if (mvcc_snapshot == NULL)
+      if (qexec_clear_list_cache_by_class (class_oid) != NO_ERROR)
 	{
-	  GOTO_EXIT_ON_ERROR;
+	  OID *o = class_oid;
+	  er_log_debug (ARG_FILE_LINE,
+			"qexec_execute_increment: qexec_clear_list_cache_by_class failed for class { %d %d %d }\n",
+			o->pageid, o->slotid, o->volid);
 	}
+      qmgr_add_modified_class (class_oid);
+    }
+#endif
 
-      if (heap_scancache_start (thread_p, &scan_cache, NULL, NULL, true, false, mvcc_snapshot) != NO_ERROR)
-	{
-	  GOTO_EXIT_ON_ERROR;
-	}
-      scan_cache_end_needed = true;
+wrapup:
 
-      /* must choose corresponding lock_mode for scan_operation_type.
-       * for root classes the lock_mode is considered, not the operation type */
-      lock_mode = locator_get_lock_mode_from_op_type (scan_operation_type);
+  if (attr_info_inited)
+    {
+      (void) heap_attrinfo_end (thread_p, &attr_info);
+    }
 
-      /* fetch the object and the class oid */
-      scan = locator_get_object (thread_p, &dbvaloid, &cls_oid, &oRec, &scan_cache, scan_operation_type, lock_mode,
-				 PEEK, NULL_CHN);
-      if (scan != S_SUCCESS)
-	{
-	  /* setting ER_HEAP_UNKNOWN_OBJECT error for deleted or invisible objects should be replaced by a more clear
-	   * way of handling the return code; it is imposible to decide at low level heap get functions if it is
-	   * expected to reach a deleted object and also it is difficult to propagate the NON_EXISTENT_HANDLING
-	   * argument through all the callers; this system can currently generate some irrelevant error log that is
-	   * hard to eliminate */
-	  if (scan == S_DOESNT_EXIST || scan == S_SNAPSHOT_NOT_SATISFIED)
-	    {
-	      /* dangling object reference */
-	      dead_end = true;
-	      er_clear ();	/* probably ER_HEAP_UNKNOWN_OBJECT is set */
-	    }
-	  else if (er_errid () == ER_HEAP_NODATA_NEWADDRESS)
-	    {
-	      dead_end = true;
-	      unqualified_dead_end = true;
-	      er_clear ();	/* clear ER_HEAP_NODATA_NEWADDRESS */
-	    }
-	  else if (er_errid () == ER_HEAP_UNKNOWN_OBJECT)
-	    {
-	      /* where is this from? */
-	      assert (false);
-	      dead_end = true;
-	      er_clear ();	/* clear ER_HEAP_UNKOWN_OBJECT */
-	    }
-	  else
-	    {
-	      status = ER_FAILED;
-	      goto wrapup;
-	    }
-	}
-      else
-	{
-	  /* check to see if the object is one of the classes that we are interested in.  This can only fail if there
-	   * was a selector variable in the query.  we can optimize this further to pass from the compiler whether this
-	   * check is necessary or not. */
-	  bool found = false;
+  if (scan_cache_inited)
+    {
+      (void) locator_end_force_scan_cache (thread_p, &scan_cache);
+    }
+
+  return error;
+}
+
+/*
+ * qexec_execute_selupd_list_find_class () -
+ * Helper function used by qexec_execute_selupd_list to find class oid/hfid
+ *
+ * return:  NO_ERROR or a error code
+ * thread_p(in)       : thread entry
+ * xasl(in)           : XASL Tree
+ * vd(in)             : Value Descriptor (from XASL State)
+ * oid(in)            : oid of the column used in click counter function
+ * selupd(in)         : select update list
+ * class_oid(out)     : corresponding class oid
+ * class_hfid(out)    : corresponding class hfid
+ * needs_pruning(out) : type of pruning that should be performed later
+ * found(out)         : true if class oid/hfid was found, false otherwise
+ */
+static int
+qexec_execute_selupd_list_find_class (THREAD_ENTRY * thread_p, XASL_NODE * xasl, VAL_DESCR * vd, OID * oid,
+				      SELUPD_LIST * selupd, OID * class_oid, HFID * class_hfid,
+				      DB_CLASS_PARTITION_TYPE * needs_pruning, bool * found)
+{
 
-	  for (specp = xasl->spec_list;
-	       specp && specp->type == TARGET_CLASS && !XASL_IS_FLAGED (xasl, XASL_OBJFETCH_IGNORE_CLASSOID);
-	       specp = specp->next)
-	    {
-	      PARTITION_SPEC_TYPE *current = NULL;
+  OID class_oid_buf;
+  XASL_NODE *scan_ptr = xasl;
 
-	      if (OID_EQ (&ACCESS_SPEC_CLS_OID (specp), &cls_oid))
-		{
-		  /* found it */
-		  break;
-		}
+  *found = false;
+  *needs_pruning = DB_NOT_PARTITIONED_CLASS;
 
-	      if (!specp->pruned && specp->type == TARGET_CLASS)
-		{
-		  /* cls_oid might still refer to this spec through a partition. See if we already pruned this spec and
-		   * search through partitions for the appropriate class */
-		  PARTITION_SPEC_TYPE *partition_spec = NULL;
-		  int granted;
+  if (!OID_EQ (&selupd->class_oid, &oid_Null_oid))
+    {
+      *class_oid = selupd->class_oid;
+      *class_hfid = selupd->class_hfid;
+      *found = true;
+      return NO_ERROR;
+    }
 
-		  if (partition_prune_spec (thread_p, &xasl_state->vd, specp) != NO_ERROR)
-		    {
-		      status = ER_FAILED;
-		      goto wrapup;
-		    }
-		  for (partition_spec = specp->parts; partition_spec != NULL; partition_spec = partition_spec->next)
-		    {
-		      granted =
-			lock_subclass (thread_p, &partition_spec->oid, &ACCESS_SPEC_CLS_OID (specp), IS_LOCK,
-				       LK_UNCOND_LOCK);
-		      if (granted != LK_GRANTED)
-			{
-			  status = ER_FAILED;
-			  goto wrapup;
-			}
-		    }
-		}
+  if (heap_get_class_oid (thread_p, oid, &class_oid_buf) != S_SUCCESS)
+    {
+      ASSERT_ERROR ();
+      return er_errid ();
+    }
+  *class_oid = class_oid_buf;
 
-	      current = specp->parts;
-	      found = false;
-	      while (current != NULL)
+  for (; scan_ptr != NULL; scan_ptr = scan_ptr->scan_ptr)
+    {
+      ACCESS_SPEC_TYPE *specp = NULL;
+      for (specp = scan_ptr->spec_list; specp; specp = specp->next)
+	{
+	  if (specp->type == TARGET_CLASS && OID_EQ (&specp->s.cls_node.cls_oid, class_oid))
+	    {
+	      *found = true;
+	      *class_hfid = specp->s.cls_node.hfid;
+	      *needs_pruning = (DB_CLASS_PARTITION_TYPE) specp->pruning_type;
+	      return NO_ERROR;
+	    }
+	  else if (specp->pruning_type)
+	    {
+	      if (!specp->pruned)
 		{
-		  if (OID_EQ (&current->oid, &cls_oid))
+		  /* perform pruning */
+		  int error_code = qexec_prune_spec (thread_p, specp, vd, scan_ptr->scan_op_type);
+		  if (error_code != NO_ERROR)
 		    {
-		      found = true;
-		      break;
+		      return error_code;
 		    }
-		  current = current->next;
 		}
 
-	      if (found)
+	      PARTITION_SPEC_TYPE *part_spec = NULL;
+	      for (part_spec = specp->parts; part_spec != NULL; part_spec = part_spec->next)
 		{
-		  break;
+		  if (OID_EQ (&part_spec->oid, class_oid))
+		    {
+		      *found = true;
+		      *class_hfid = part_spec->hfid;
+		      *needs_pruning = (DB_CLASS_PARTITION_TYPE) specp->pruning_type;
+		      return NO_ERROR;
+		    }
 		}
 	    }
+	}
 
-	  if (specp == NULL)
+      if (specp == NULL)
+	{
+	  specp = scan_ptr->spec_list;
+	  if (specp != NULL && specp->pruning_type == DB_PARTITION_CLASS && specp->next == NULL
+	      && specp->s_id.mvcc_select_lock_needed)
 	    {
-	      /* no specification contains the class oid, this is a possible situation for object domain definitions.
-	       * It just causes the object fetch result to fail. */
-	      fetch->fetch_res = false;
-	      dead_end = true;
-	      unqualified_dead_end = true;
+	      /* the object may be updated to other partition */
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_INVALID_DATA_FOR_PARTITION, 0);
+	      return ER_INVALID_DATA_FOR_PARTITION;
 	    }
 	}
+    }
 
-      if (!dead_end)
+  return NO_ERROR;
+}
+
+/*
+ * qexec_execute_selupd_list () -
+ *   return: NO_ERROR, or ER_code
+ *   xasl(in)   : XASL Tree
+ *   xasl_state(in)     :
+ * Note: This routine executes update for a selected tuple
+ */
+static int
+qexec_execute_selupd_list (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state)
+{
+  SELUPD_LIST *list = NULL, *selupd = NULL;
+  REGU_VARLIST_LIST outptr = NULL;
+  REGU_VARIABLE *varptr = NULL;
+  DB_VALUE *rightvalp = NULL, *thirdvalp = NULL;
+  bool subtransaction_started = false;
+  OID last_cached_class_oid;
+  int tran_index;
+  int err = NO_ERROR;
+  HEAP_SCANCACHE scan_cache;
+  bool scan_cache_inited = false;
+  SCAN_CODE scan_code;
+  LOG_TDES *tdes = NULL;
+  UPDDEL_MVCC_COND_REEVAL upd_reev;
+  MVCC_SCAN_REEV_DATA mvcc_sel_reev_data;
+  MVCC_REEV_DATA mvcc_reev_data, *p_mvcc_reev_data = NULL;
+  bool clear_list_id = false;
+  MVCC_SNAPSHOT *mvcc_snapshot = logtb_get_mvcc_snapshot (thread_p);
+  bool need_ha_replication = !LOG_CHECK_LOG_APPLIER (thread_p) && log_does_allow_replication () == true;
+  bool sysop_started = false;
+  bool in_instant_lock_mode;
+
+  // *INDENT-OFF*
+  struct incr_info
+  {
+    OID m_oid;
+    OID m_class_oid;
+    HFID m_class_hfid;
+    int m_attrid;
+    int m_n_increment;
+    DB_CLASS_PARTITION_TYPE m_ptype;
+
+    incr_info () = default;
+    incr_info (const incr_info & other) = default;
+  };
+  std::vector<incr_info> all_incr_info;
+  std::vector<bool> all_skipped;
+  size_t incr_info_index = 0;
+  size_t skipped_index = 0;
+  // *INDENT-ON*
+
+  assert (xasl->list_id->tuple_cnt == 1);
+  OID_SET_NULL (&last_cached_class_oid);
+
+  tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
+
+  if (QEXEC_SEL_UPD_USE_REEVALUATION (xasl))
+    {
+      /* need reevaluation in this function */
+      upd_reev.init (xasl->spec_list->s_id);
+      mvcc_sel_reev_data.set_filters (upd_reev);
+      mvcc_sel_reev_data.qualification = &xasl->spec_list->s_id.qualification;
+      mvcc_reev_data.set_scan_reevaluation (mvcc_sel_reev_data);
+      p_mvcc_reev_data = &mvcc_reev_data;
+
+      /* clear list id if all reevaluations result is false */
+      clear_list_id = true;
+
+      /* need lock & reevaluation */
+      lock_start_instant_lock_mode (tran_index);
+      in_instant_lock_mode = true;
+    }
+  else
+    {
+      // locking and evaluation is done at scan phase
+      in_instant_lock_mode = lock_is_instant_lock_mode (tran_index);
+    }
+
+  list = xasl->selected_upd_list;
+
+  /* do increment operation */
+  for (selupd = list; selupd; selupd = selupd->next)
+    {
+      for (outptr = selupd->select_list; outptr; outptr = outptr->next)
 	{
-	  /* set up the attribute cache info */
-	  status =
-	    heap_attrinfo_start (thread_p, &cls_oid, specp->s.cls_node.num_attrs_pred, specp->s.cls_node.attrids_pred,
-				 specp->s.cls_node.cache_pred);
-	  if (status != NO_ERROR)
+	  incr_info crt_incr_info;
+
+	  if (outptr->list == NULL)
 	    {
-	      goto wrapup;
+	      goto exit_on_error;
 	    }
-	  cache_pred_end_needed = true;
 
-	  status =
-	    heap_attrinfo_start (thread_p, &cls_oid, specp->s.cls_node.num_attrs_rest, specp->s.cls_node.attrids_rest,
-				 specp->s.cls_node.cache_rest);
-	  if (status != NO_ERROR)
+	  /* pointer to the regu variable */
+	  varptr = &(outptr->list->value);
+
+	  /* check something */
+	  if (!((varptr->type == TYPE_INARITH || varptr->type == TYPE_OUTARITH)
+		&& (varptr->value.arithptr->opcode == T_INCR || varptr->value.arithptr->opcode == T_DECR)))
 	    {
-	      goto wrapup;
+	      goto exit_on_error;
+	    }
+	  if (varptr->value.arithptr->leftptr->type != TYPE_CONSTANT
+	      || varptr->value.arithptr->rightptr->type != TYPE_CONSTANT)
+	    {
+	      goto exit_on_error;
 	    }
-	  cache_rest_end_needed = true;
 
-	  fetch_init_val_list (specp->s.cls_node.cls_regu_list_pred);
-	  fetch_init_val_list (specp->s.cls_node.cls_regu_list_rest);
+	  /* get oid and attrid to be fetched last at scan */
+	  rightvalp = varptr->value.arithptr->value;
 
-	  /* read the predicate values from the heap into the scancache */
-	  status = heap_attrinfo_read_dbvalues (thread_p, &dbvaloid, &oRec, &scan_cache, specp->s.cls_node.cache_pred);
-	  if (status != NO_ERROR)
+	  if (db_get_oid (rightvalp) == NULL)
 	    {
-	      goto wrapup;
+	      /* Probably this would be INCR(NULL). When the source value is NULL, INCR/DECR expression is also NULL. */
+	      clear_list_id = false;
+	      all_skipped.push_back (true);
+	      continue;
+	    }
+	  crt_incr_info.m_oid = *db_get_oid (rightvalp);
+	  if (OID_ISNULL (&crt_incr_info.m_oid))
+	    {
+	      /* in some cases, a query returns no result even if it should have an result on dirty read mode. it may
+	       * be caused by index scan failure for index to be updated frequently (hot spot index). if this case is
+	       * fixed, it does not need to be checked */
+	      er_log_debug (ARG_FILE_LINE, "qexec_execute_selupd_list: OID is null\n");
+	      clear_list_id = false;
+	      all_skipped.push_back (true);
+	      continue;
 	    }
 
-	  /* fetch the values for the predicate from the object */
-	  if (xasl->val_list != NULL)
+	  /* we also need attribute id to perform increment */
+	  if (fetch_peek_dbval (thread_p, varptr->value.arithptr->thirdptr, NULL, NULL, NULL, NULL, &thirdvalp) !=
+	      NO_ERROR)
 	    {
-	      status =
-		fetch_val_list (thread_p, specp->s.cls_node.cls_regu_list_pred, &xasl_state->vd, NULL, &dbvaloid, NULL,
-				COPY);
-	      if (status != NO_ERROR)
-		{
-		  goto wrapup;
-		}
+	      goto exit_on_error;
 	    }
+	  crt_incr_info.m_attrid = db_get_int (thirdvalp);
 
-	  /* evaluate where predicate, if any */
-	  ev_res = V_UNKNOWN;
-	  if (specp->where_pred)
+	  crt_incr_info.m_n_increment = (varptr->value.arithptr->opcode == T_INCR ? 1 : -1);
+
+	  /* check if class oid/hfid does not set, find class oid/hfid to access */
+	  bool found = false;
+	  err = qexec_execute_selupd_list_find_class (thread_p, xasl, &xasl_state->vd, &crt_incr_info.m_oid, selupd,
+						      &crt_incr_info.m_class_oid, &crt_incr_info.m_class_hfid,
+						      &crt_incr_info.m_ptype, &found);
+	  if (err != NO_ERROR)
 	    {
-	      ev_res = eval_pred (thread_p, specp->where_pred, &xasl_state->vd, &dbvaloid);
-	      if (ev_res == V_ERROR)
-		{
-		  status = ER_FAILED;
-		  goto wrapup;
-		}
+	      goto exit_on_error;
 	    }
-
-	  if (specp->where_pred != NULL && ev_res != V_TRUE)
+	  if (!found)
 	    {
-	      /* the object is a disqualified one */
-	      fetch->fetch_res = false;
+	      /* not found hfid */
+	      er_log_debug (ARG_FILE_LINE, "qexec_execute_selupd_list: class hfid to access is null\n");
+	      assert (false);
+	      goto exit_on_error;
 	    }
-	  else
+
+	  if (p_mvcc_reev_data != NULL)
 	    {
-	      /* the object is a qualified */
-	      fetch->fetch_res = true;
-	      /* read the rest of the values from the heap */
-	      status =
-		heap_attrinfo_read_dbvalues (thread_p, &dbvaloid, &oRec, &scan_cache, specp->s.cls_node.cache_rest);
-	      if (status != NO_ERROR)
+	      /* need locking and reevaluation */
+	      if (!OID_EQ (&last_cached_class_oid, &crt_incr_info.m_class_oid) && scan_cache_inited == true)
 		{
-		  goto wrapup;
+		  (void) heap_scancache_end (thread_p, &scan_cache);
+		  scan_cache_inited = false;
 		}
 
-	      /* fetch the rest of the values from the object */
-	      if (xasl->val_list != NULL)
+	      if (scan_cache_inited == false)
 		{
-		  status =
-		    fetch_val_list (thread_p, specp->s.cls_node.cls_regu_list_rest, &xasl_state->vd, NULL, &dbvaloid,
-				    NULL, COPY);
-		  if (status != NO_ERROR)
+		  if (heap_scancache_start (thread_p, &scan_cache, &crt_incr_info.m_class_hfid,
+					    &crt_incr_info.m_class_oid, false, false, mvcc_snapshot) != NO_ERROR)
 		    {
-		      goto wrapup;
+		      goto exit_on_error;
+		    }
+		  scan_cache_inited = true;
+		  COPY_OID (&last_cached_class_oid, &crt_incr_info.m_class_oid);
+		}
+	      /* need to handle reevaluation */
+	      scan_code =
+		locator_lock_and_get_object_with_evaluation (thread_p, &crt_incr_info.m_oid, &crt_incr_info.m_class_oid,
+							     NULL, &scan_cache, COPY, NULL_CHN, p_mvcc_reev_data,
+							     LOG_WARNING_IF_DELETED);
+	      if (scan_code != S_SUCCESS)
+		{
+		  int er_id = er_errid ();
+		  if (er_id == ER_LK_UNILATERALLY_ABORTED || er_id == ER_MVCC_SERIALIZABLE_CONFLICT)
+		    {
+		      /* error, deadlock or something */
+		      goto exit_on_error;
+		    }
+		  else if (er_id == ER_LK_OBJECT_DL_TIMEOUT_SIMPLE_MSG || er_id == ER_LK_OBJECT_DL_TIMEOUT_CLASS_MSG
+			   || er_id == ER_LK_OBJECT_DL_TIMEOUT_CLASSOF_MSG)
+		    {
+		      /* ignore lock timeout for click counter, and skip this increment operation */
+		      er_log_debug (ARG_FILE_LINE,
+				    "qexec_execute_selupd_list: lock(X_LOCK) timed out "
+				    "for OID { %d %d %d } class OID { %d %d %d }\n", OID_AS_ARGS (&crt_incr_info.m_oid),
+				    OID_AS_ARGS (&crt_incr_info.m_class_oid));
+		      er_clear ();
+		      all_skipped.push_back (true);
+		      continue;
+		    }
+		  else
+		    {
+		      if (er_id != NO_ERROR)
+			{
+			  er_clear ();
+			}
+		      /* simply, skip this increment operation */
+		      er_log_debug (ARG_FILE_LINE,
+				    "qexec_execute_selupd_list: skip for OID "
+				    "{ %d %d %d } class OID { %d %d %d } error_id %d\n",
+				    OID_AS_ARGS (&crt_incr_info.m_oid), OID_AS_ARGS (&crt_incr_info.m_class_oid),
+				    er_id);
+		      all_skipped.push_back (true);
+		      continue;
 		    }
 		}
+	      else if (p_mvcc_reev_data->filter_result != V_TRUE)
+		{
+		  /* simply, skip this increment operation */
+		  er_log_debug (ARG_FILE_LINE,
+				"qexec_execute_selupd_list: skip for OID "
+				"{ %d %d %d } class OID { %d %d %d } error_id %d\n", OID_AS_ARGS (&crt_incr_info.m_oid),
+				OID_AS_ARGS (&crt_incr_info.m_class_oid), NO_ERROR);
+		  all_skipped.push_back (true);
+		  continue;
+		}
+	      else
+		{
+		  /* one tuple successfully reevaluated, do not clear list file */
+		  clear_list_id = false;
+		}
+	    }
+	  else
+	    {
+	      /* already locked during scan phase */
+	      assert ((lock_get_object_lock (&crt_incr_info.m_oid, &crt_incr_info.m_class_oid) == X_LOCK)
+		      || lock_get_object_lock (&crt_incr_info.m_class_oid, oid_Root_class_oid) >= X_LOCK);
 	    }
-	}
 
-    wrapup:
-      if (cache_pred_end_needed)
-	{
-	  heap_attrinfo_end (thread_p, specp->s.cls_node.cache_pred);
-	}
-      if (cache_rest_end_needed)
-	{
-	  heap_attrinfo_end (thread_p, specp->s.cls_node.cache_rest);
-	}
-      if (scan_cache_end_needed)
-	{
-	  (void) heap_scancache_end (thread_p, &scan_cache);
-	}
-      if (status == ER_FAILED)
-	{
-	  return ER_FAILED;
+	  all_incr_info.push_back (crt_incr_info);
+	  all_skipped.push_back (false);
 	}
-    }				/* if !dead_end */
+    }
 
-  if (dead_end)
+  log_sysop_start (thread_p);
+  sysop_started = true;
+
+  if (lock_is_instant_lock_mode (tran_index))
     {
-      /* set values to null */
-      if (unqualified_dead_end || fetch->ql_flag == true)
-	{
-	  /* the object is unqualified */
-	  fetch->fetch_res = false;
-	}
-      else
+      assert (in_instant_lock_mode);
+
+      /* in this function, several instances can be updated, so it need to be atomic */
+      if (need_ha_replication)
 	{
-	  qdata_set_value_list_to_null (xasl->val_list);
-	  fetch->fetch_res = true;	/* the object is qualified */
+	  repl_start_flush_mark (thread_p);
 	}
+
+      /* Subtransaction case. Locks and MVCCID are acquired/released by subtransaction. */
+      tdes = LOG_FIND_TDES (LOG_FIND_THREAD_TRAN_INDEX (thread_p));
+      assert (tdes != NULL);
+      logtb_get_new_subtransaction_mvccid (thread_p, &tdes->mvccinfo);
+      subtransaction_started = true;
     }
 
-  if (fetch->fetch_res)
+  for (selupd = list; selupd; selupd = selupd->next)
     {
-      /* evaluate bptr list */
-      for (xptr = xasl->bptr_list; fetch->fetch_res == true && xptr != NULL; xptr = xptr->next)
+      for (outptr = selupd->select_list; outptr; outptr = outptr->next)
 	{
-	  if (qexec_execute_obj_fetch (thread_p, xptr, xasl_state, scan_operation_type) != NO_ERROR)
+	  if (all_skipped[skipped_index++])
 	    {
-	      GOTO_EXIT_ON_ERROR;
+	      // skip this increment
+	      continue;
 	    }
-	  else if (xptr->proc.fetch.fetch_res == false)
+	  const incr_info & crt_incr_info = all_incr_info[incr_info_index++];
+	  if (qexec_execute_increment (thread_p, &crt_incr_info.m_oid, &crt_incr_info.m_class_oid,
+				       &crt_incr_info.m_class_hfid, crt_incr_info.m_attrid, crt_incr_info.m_n_increment,
+				       crt_incr_info.m_ptype) != NO_ERROR)
 	    {
-	      fetch->fetch_res = false;
+	      goto exit_on_error;
 	    }
 	}
+    }
+  assert (skipped_index == all_skipped.size ());
+  assert (incr_info_index == all_incr_info.size ());
 
-      if (fetch->fetch_res)
-	{
+  if (scan_cache_inited == true)
+    {
+      (void) heap_scancache_end (thread_p, &scan_cache);
+      scan_cache_inited = false;
+    }
 
-	  /* evaluate dptr list */
-	  for (xptr = xasl->dptr_list; xptr != NULL; xptr = xptr->next)
-	    {
-	      /* clear correlated subquery list files */
-	      qexec_clear_head_lists (thread_p, xptr);
-	      if (XASL_IS_FLAGED (xptr, XASL_LINK_TO_REGU_VARIABLE))
-		{
-		  /* skip if linked to regu var */
-		  continue;
-		}
-	      if (qexec_execute_mainblock (thread_p, xptr, xasl_state, NULL) != NO_ERROR)
-		{
-		  GOTO_EXIT_ON_ERROR;
-		}
-	    }
+  if (subtransaction_started && need_ha_replication)
+    {
+      /* Ends previously started marker. */
+      repl_end_flush_mark (thread_p, false);
+    }
 
-	  /* evaluate constant (if) predicate */
-	  if (fetch->fetch_res && xasl->if_pred != NULL)
-	    {
-	      ev_res2 = eval_pred (thread_p, xasl->if_pred, &xasl_state->vd, NULL);
-	      if (ev_res2 == V_ERROR)
-		{
-		  GOTO_EXIT_ON_ERROR;
-		}
-	      else if (ev_res2 != V_TRUE)
-		{
-		  fetch->fetch_res = false;
-		}
-	    }			/* if */
+  /* Here we need to check instant lock mode, since it may be reseted by qexec_execute_increment. */
+  if (lock_is_instant_lock_mode (tran_index))
+    {
+      /* Subtransaction case. */
+      assert (subtransaction_started);
+      log_sysop_commit (thread_p);
 
-	  if (fetch->fetch_res)
-	    {
-	      /* evaluate fptr list */
-	      for (xptr = xasl->fptr_list; fetch->fetch_res == true && xptr != NULL; xptr = xptr->next)
-		{
-		  if (qexec_execute_obj_fetch (thread_p, xptr, xasl_state, scan_operation_type) != NO_ERROR)
-		    {
-		      GOTO_EXIT_ON_ERROR;
-		    }
-		  else if (xptr->proc.fetch.fetch_res == false)
-		    {
-		      fetch->fetch_res = false;
-		    }
-		}
+      assert (in_instant_lock_mode);
+    }
+  else
+    {
+      /* Transaction case. */
+      log_sysop_attach_to_outer (thread_p);
+
+      in_instant_lock_mode = false;
+    }
+
+exit:
+  /* Release subtransaction resources. */
+  if (subtransaction_started)
+    {
+      /* Release subtransaction MVCCID. */
+      logtb_complete_sub_mvcc (thread_p, tdes);
+    }
 
-	      /* NO SCAN PROCEDURES are supported for these blocks! */
-	    }			/* if */
+  if (in_instant_lock_mode)
+    {
+      /* Release instant locks, if not already released. */
+      lock_stop_instant_lock_mode (thread_p, tran_index, true);
+      in_instant_lock_mode = false;
+    }
 
-	}			/* if */
+  // not hold instant locks any more.
+  assert (!in_instant_lock_mode && !lock_is_instant_lock_mode (tran_index));
 
-    }				/* if */
+  if (err != NO_ERROR)
+    {
+      qexec_failure_line (__LINE__, xasl_state);
+      return ER_FAILED;
+    }
 
-  /* clear uncorrelated subquery list files */
-  if (xasl->aptr_list)
+  if (clear_list_id)
     {
-      qexec_clear_head_lists (thread_p, xasl->aptr_list);
+      /* can't reevaluate any data, clear list file */
+      qfile_clear_list_id (xasl->list_id);
     }
 
   return NO_ERROR;
 
 exit_on_error:
 
-  /* clear uncorrelated subquery list files */
-  if (xasl->aptr_list)
+  if (scan_cache_inited == true)
     {
-      qexec_clear_head_lists (thread_p, xasl->aptr_list);
+      (void) heap_scancache_end (thread_p, &scan_cache);
+      scan_cache_inited = false;
     }
 
-  return ER_FAILED;
+  if (subtransaction_started && need_ha_replication)
+    {
+      /* Ends previously started marker. */
+      repl_end_flush_mark (thread_p, true);
+    }
+
+  if (sysop_started)
+    {
+      log_sysop_abort (thread_p);
+      sysop_started = false;
+    }
+
+  /* clear some kinds of error code; it's click counter! */
+  ASSERT_ERROR_AND_SET (err);
+  if (err == ER_LK_UNILATERALLY_ABORTED || err == ER_LK_OBJECT_TIMEOUT_CLASSOF_MSG
+      || err == ER_LK_OBJECT_DL_TIMEOUT_CLASSOF_MSG || err == ER_LK_OBJECT_DL_TIMEOUT_SIMPLE_MSG
+      || err == ER_LK_OBJECT_TIMEOUT_SIMPLE_MSG)
+    {
+      er_log_debug (ARG_FILE_LINE, "qexec_execute_selupd_list: ignore error %d\n", err);
+
+      lock_clear_deadlock_victim (tran_index);
+      qfile_close_list (thread_p, xasl->list_id);
+      qfile_destroy_list (thread_p, xasl->list_id);
+      er_clear ();
+      err = NO_ERROR;
+    }
+
+  goto exit;
 }
 
 /*
- * qexec_execute_increment () -
- *   return:
- *   oid(in)    :
- *   class_oid(in)      :
- *   class_hfid(in)     :
- *   attrid(in) :
- *   n_increment(in)    :
- *   pruning_type(in)	:
- *   need_locking(in)	: true, if need locking
+ * qexec_init_instnum_val () -
+ *   return: NO_ERROR, or ER_code
+ *   xasl(in)   : XASL Tree pointer
+ *   thread_p   : Thread entry pointer
+ *   xasl_state(in)     : XASL tree state information
+ *
+ * Note: This routine initializes the instnum value used in execution
+ *       to evaluate rownum() predicates.
+ *       Usually the value is set to 0, so that the first row number will be 1,
+ *       but for single table index scans that have a keylimit with a lower
+ *       value, we initialize instnum_val with keylimit's low value.
+ *       Otherwise, keylimit would skip some rows and instnum will start
+ *       counting from 1, which is wrong.
  */
 static int
-qexec_execute_increment (THREAD_ENTRY * thread_p, const OID * oid, const OID * class_oid, const HFID * class_hfid,
-			 ATTR_ID attrid, int n_increment, int pruning_type)
+qexec_init_instnum_val (XASL_NODE * xasl, THREAD_ENTRY * thread_p, XASL_STATE * xasl_state)
 {
-  HEAP_CACHE_ATTRINFO attr_info;
-  int attr_info_inited = 0;
-  HEAP_SCANCACHE scan_cache;
-  bool scan_cache_inited = false;
-  HEAP_ATTRVALUE *value = NULL;
-  int force_count;
+  TP_DOMAIN *domainp = tp_domain_resolve_default (DB_TYPE_BIGINT);
+  DB_TYPE orig_type;
+  REGU_VARIABLE *key_limit_l;
+  DB_VALUE *dbvalp;
   int error = NO_ERROR;
-  int op_type = SINGLE_ROW_UPDATE;
-  LC_COPYAREA_OPERATION area_op = LC_FLUSH_UPDATE;
-
-  error = heap_attrinfo_start (thread_p, class_oid, -1, NULL, &attr_info);
-  if (error != NO_ERROR)
-    {
-      goto wrapup;
-    }
-  attr_info_inited = 1;
-
+  TP_DOMAIN_STATUS dom_status;
 
-  error = locator_start_force_scan_cache (thread_p, &scan_cache, class_hfid, class_oid, op_type);
-  if (error != NO_ERROR)
-    {
-      goto wrapup;
-    }
-  scan_cache_inited = true;
+  assert (xasl && xasl->instnum_val);
+  db_make_bigint (xasl->instnum_val, 0);
 
-  if (!class_hfid)
+  if (xasl->save_instnum_val)
     {
-      error = ER_FAILED;
-      goto wrapup;
+      db_make_bigint (xasl->save_instnum_val, 0);
     }
 
-  if (!HFID_IS_NULL (class_hfid))
+  /* Single table, index scan, with keylimit that has lower value */
+  if (xasl->scan_ptr == NULL && xasl->spec_list != NULL && xasl->spec_list->next == NULL
+      && xasl->spec_list->access == ACCESS_METHOD_INDEX && xasl->spec_list->indexptr
+      && xasl->spec_list->indexptr->key_info.key_limit_l)
     {
-      if (heap_attrinfo_clear_dbvalues (&attr_info) != NO_ERROR)
+      key_limit_l = xasl->spec_list->indexptr->key_info.key_limit_l;
+      if (fetch_peek_dbval (thread_p, key_limit_l, &xasl_state->vd, NULL, NULL, NULL, &dbvalp) != NO_ERROR)
 	{
-	  error = ER_FAILED;
-	  goto wrapup;
+	  goto exit_on_error;
 	}
 
-      /* set increment operation for the attr */
-      value = heap_attrvalue_locate (attrid, &attr_info);
-      if (value == NULL)
+      orig_type = DB_VALUE_DOMAIN_TYPE (dbvalp);
+      if (orig_type != DB_TYPE_BIGINT)
 	{
-	  error = ER_FAILED;
-	  goto wrapup;
-	}
+	  dom_status = tp_value_coerce (dbvalp, dbvalp, domainp);
+	  if (dom_status != DOMAIN_COMPATIBLE)
+	    {
+	      error = tp_domain_status_er_set (dom_status, ARG_FILE_LINE, dbvalp, domainp);
+	      assert_release (error != NO_ERROR);
 
-      value->do_increment = n_increment;
+	      goto exit_on_error;
+	    }
 
-      force_count = 0;
-      /* oid was already locked in select phase */
-      OID copy_oid = *oid;
-      error =
-	locator_attribute_info_force (thread_p, class_hfid, &copy_oid, &attr_info, &attrid, 1, area_op, op_type,
-				      &scan_cache, &force_count, false, REPL_INFO_TYPE_RBR_NORMAL, pruning_type, NULL,
-				      NULL, NULL, UPDATE_INPLACE_NONE, NULL, false);
-      if (error == ER_MVCC_NOT_SATISFIED_REEVALUATION)
+	  if (DB_VALUE_DOMAIN_TYPE (dbvalp) != DB_TYPE_BIGINT)
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_DATATYPE, 0);
+	      goto exit_on_error;
+	    }
+	}
+
+      if (pr_clone_value (dbvalp, xasl->instnum_val) != NO_ERROR)
 	{
-	  assert (force_count == 0);
-	  error = NO_ERROR;
+	  goto exit_on_error;
 	}
-      else if (error != NO_ERROR)
+
+      if (xasl->save_instnum_val && pr_clone_value (dbvalp, xasl->save_instnum_val) != NO_ERROR)
 	{
-	  error = ER_FAILED;
-	  goto wrapup;
+	  goto exit_on_error;
 	}
     }
 
-#if 0				/* yaw */
-  /* remove query result cache entries which are relevant with this class */
-  if (!QFILE_IS_LIST_CACHE_DISABLED)
-    {
-      if (qexec_clear_list_cache_by_class (class_oid) != NO_ERROR)
-	{
-	  OID *o = class_oid;
-	  er_log_debug (ARG_FILE_LINE,
-			"qexec_execute_increment: qexec_clear_list_cache_by_class failed for class { %d %d %d }\n",
-			o->pageid, o->slotid, o->volid);
-	}
-      qmgr_add_modified_class (class_oid);
-    }
-#endif
+  xasl->instnum_flag &= ~(XASL_INSTNUM_FLAG_SCAN_CHECK | XASL_INSTNUM_FLAG_SCAN_STOP
+			  | XASL_INSTNUM_FLAG_SCAN_LAST_STOP);
+
+  return NO_ERROR;
+
+exit_on_error:
+  return ER_FAILED;
+}
+
+/*
+ * qexec_start_mainblock_iterations () -
+ *   return: NO_ERROR, or ER_code
+ *   xasl(in)   : XASL Tree pointer
+ *   xasl_state(in)     : XASL tree state information
+ *
+ * Note: This routines performs the start-up operations for a main
+ * procedure block iteration. The main procedure block nodes can
+ * be of type BUILDLIST_PROC, BUILDVALUE, UNION_PROC,
+ * DIFFERENCE_PROC and INTERSECTION_PROC.
+ */
+int
+qexec_start_mainblock_iterations (THREAD_ENTRY * thread_p, xasl_node * xasl, xasl_state * xasl_state)
+{
+  QFILE_TUPLE_VALUE_TYPE_LIST type_list;
+  QFILE_LIST_ID *t_list_id = NULL;
+  int ls_flag = 0;
+
+  switch (xasl->type)
+    {
+    case CONNECTBY_PROC:
+      {
+	if (xasl->list_id->type_list.type_cnt == 0)
+	  {
+	    if (qdata_get_valptr_type_list (thread_p, xasl->outptr_list, &type_list) != NO_ERROR)
+	      {
+		if (type_list.domp)
+		  {
+		    db_private_free_and_init (thread_p, type_list.domp);
+		  }
+		GOTO_EXIT_ON_ERROR;
+	      }
+
+	    QFILE_SET_FLAG (ls_flag, QFILE_FLAG_ALL);
+	    t_list_id = qfile_open_list (thread_p, &type_list, NULL, xasl_state->query_id, ls_flag);
+	    if (t_list_id == NULL)
+	      {
+		if (type_list.domp)
+		  {
+		    db_private_free_and_init (thread_p, type_list.domp);
+		  }
+		if (t_list_id)
+		  {
+		    QFILE_FREE_AND_INIT_LIST_ID (t_list_id);
+		  }
+		GOTO_EXIT_ON_ERROR;
+	      }
+
+	    if (type_list.domp)
+	      {
+		db_private_free_and_init (thread_p, type_list.domp);
+	      }
+
+	    if (qfile_copy_list_id (xasl->list_id, t_list_id, true) != NO_ERROR)
+	      {
+		QFILE_FREE_AND_INIT_LIST_ID (t_list_id);
+		GOTO_EXIT_ON_ERROR;
+	      }			/* if */
+	    QFILE_FREE_AND_INIT_LIST_ID (t_list_id);
+	  }
+      }
+      break;
+
+    case BUILDLIST_PROC:	/* start BUILDLIST_PROC iterations */
+      {
+	BUILDLIST_PROC_NODE *buildlist = &xasl->proc.buildlist;
+
+	/* Initialize extendible hash files for SELECT statement generated for multi UPDATE/DELETE */
+	if (QEXEC_IS_MULTI_TABLE_UPDATE_DELETE (xasl) && !XASL_IS_FLAGED (xasl, XASL_MULTI_UPDATE_AGG))
+	  {
+	    if (qexec_init_upddel_ehash_files (thread_p, xasl) != NO_ERROR)
+	      {
+		GOTO_EXIT_ON_ERROR;
+	      }
+	  }
+	else
+	  {
+	    buildlist->upddel_oid_locator_ehids = NULL;
+	  }
+
+	/* initialize groupby_num() value for BUILDLIST_PROC */
+	if (buildlist->g_grbynum_val)
+	  {
+	    db_make_bigint (buildlist->g_grbynum_val, 0);
+	  }
 
-wrapup:
+	if (xasl->list_id->type_list.type_cnt == 0)
+	  {
+	    if (qdata_get_valptr_type_list (thread_p, xasl->outptr_list, &type_list) != NO_ERROR)
+	      {
+		if (type_list.domp)
+		  {
+		    db_private_free_and_init (thread_p, type_list.domp);
+		  }
+		GOTO_EXIT_ON_ERROR;
+	      }
 
-  if (attr_info_inited)
-    {
-      (void) heap_attrinfo_end (thread_p, &attr_info);
-    }
 
-  if (scan_cache_inited)
-    {
-      (void) locator_end_force_scan_cache (thread_p, &scan_cache);
-    }
+	    QFILE_SET_FLAG (ls_flag, QFILE_FLAG_ALL);
+	    if (XASL_IS_FLAGED (xasl, XASL_TOP_MOST_XASL) && XASL_IS_FLAGED (xasl, XASL_TO_BE_CACHED)
+		&& buildlist->groupby_list == NULL && buildlist->a_eval_list == NULL
+		&& (xasl->orderby_list == NULL || XASL_IS_FLAGED (xasl, XASL_SKIP_ORDERBY_LIST))
+		&& xasl->option != Q_DISTINCT)
+	      {
+		QFILE_SET_FLAG (ls_flag, QFILE_FLAG_RESULT_FILE);
+	      }
 
-  return error;
-}
+	    t_list_id = qfile_open_list (thread_p, &type_list, xasl->after_iscan_list, xasl_state->query_id, ls_flag);
+	    if (t_list_id == NULL)
+	      {
+		if (type_list.domp)
+		  {
+		    db_private_free_and_init (thread_p, type_list.domp);
+		  }
+		if (t_list_id)
+		  {
+		    QFILE_FREE_AND_INIT_LIST_ID (t_list_id);
+		  }
+		GOTO_EXIT_ON_ERROR;
+	      }
 
-/*
- * qexec_execute_selupd_list_find_class () -
- * Helper function used by qexec_execute_selupd_list to find class oid/hfid
- *
- * return:  NO_ERROR or a error code
- * thread_p(in)       : thread entry
- * xasl(in)           : XASL Tree
- * vd(in)             : Value Descriptor (from XASL State)
- * oid(in)            : oid of the column used in click counter function
- * selupd(in)         : select update list
- * class_oid(out)     : corresponding class oid
- * class_hfid(out)    : corresponding class hfid
- * needs_pruning(out) : type of pruning that should be performed later
- * found(out)         : true if class oid/hfid was found, false otherwise
- */
-static int
-qexec_execute_selupd_list_find_class (THREAD_ENTRY * thread_p, XASL_NODE * xasl, VAL_DESCR * vd, OID * oid,
-				      SELUPD_LIST * selupd, OID * class_oid, HFID * class_hfid,
-				      DB_CLASS_PARTITION_TYPE * needs_pruning, bool * found)
-{
+	    if (type_list.domp)
+	      {
+		db_private_free_and_init (thread_p, type_list.domp);
+	      }
 
-  OID class_oid_buf;
-  XASL_NODE *scan_ptr = xasl;
+	    if (qfile_copy_list_id (xasl->list_id, t_list_id, true) != NO_ERROR)
+	      {
+		QFILE_FREE_AND_INIT_LIST_ID (t_list_id);
+		GOTO_EXIT_ON_ERROR;
+	      }			/* if */
 
-  *found = false;
-  *needs_pruning = DB_NOT_PARTITIONED_CLASS;
+	    QFILE_FREE_AND_INIT_LIST_ID (t_list_id);
 
-  if (!OID_EQ (&selupd->class_oid, &oid_Null_oid))
-    {
-      *class_oid = selupd->class_oid;
-      *class_hfid = selupd->class_hfid;
-      *found = true;
-      return NO_ERROR;
-    }
+	    if (xasl->orderby_list != NULL)
+	      {
+		if (qexec_setup_topn_proc (thread_p, xasl, &xasl_state->vd) != NO_ERROR)
+		  {
+		    GOTO_EXIT_ON_ERROR;
+		  }
+	      }
+	  }
+	break;
+      }
 
-  if (heap_get_class_oid (thread_p, oid, &class_oid_buf) != S_SUCCESS)
-    {
-      ASSERT_ERROR ();
-      return er_errid ();
-    }
-  *class_oid = class_oid_buf;
+    case BUILD_SCHEMA_PROC:	/* start BUILDSCHEMA_PROC iterations */
+      {
+	if (xasl->list_id->type_list.type_cnt == 0)
+	  {
+	    if (qdata_get_valptr_type_list (thread_p, xasl->outptr_list, &type_list) != NO_ERROR)
+	      {
+		if (type_list.domp)
+		  {
+		    db_private_free_and_init (thread_p, type_list.domp);
+		  }
+		GOTO_EXIT_ON_ERROR;
+	      }
 
-  for (; scan_ptr != NULL; scan_ptr = scan_ptr->scan_ptr)
-    {
-      ACCESS_SPEC_TYPE *specp = NULL;
-      for (specp = scan_ptr->spec_list; specp; specp = specp->next)
-	{
-	  if (specp->type == TARGET_CLASS && OID_EQ (&specp->s.cls_node.cls_oid, class_oid))
-	    {
-	      *found = true;
-	      *class_hfid = specp->s.cls_node.hfid;
-	      *needs_pruning = (DB_CLASS_PARTITION_TYPE) specp->pruning_type;
-	      return NO_ERROR;
-	    }
-	  else if (specp->pruning_type)
-	    {
-	      if (!specp->pruned)
-		{
-		  /* perform pruning */
-		  int error_code = qexec_prune_spec (thread_p, specp, vd, scan_ptr->scan_op_type);
-		  if (error_code != NO_ERROR)
-		    {
-		      return error_code;
-		    }
-		}
+	    QFILE_SET_FLAG (ls_flag, QFILE_FLAG_ALL);
+	    t_list_id = qfile_open_list (thread_p, &type_list, NULL, xasl_state->query_id, ls_flag);
+	    if (t_list_id == NULL)
+	      {
+		if (type_list.domp)
+		  {
+		    db_private_free_and_init (thread_p, type_list.domp);
+		  }
+		if (t_list_id)
+		  {
+		    qfile_free_list_id (t_list_id);
+		  }
+		GOTO_EXIT_ON_ERROR;
+	      }
 
-	      PARTITION_SPEC_TYPE *part_spec = NULL;
-	      for (part_spec = specp->parts; part_spec != NULL; part_spec = part_spec->next)
-		{
-		  if (OID_EQ (&part_spec->oid, class_oid))
-		    {
-		      *found = true;
-		      *class_hfid = part_spec->hfid;
-		      *needs_pruning = (DB_CLASS_PARTITION_TYPE) specp->pruning_type;
-		      return NO_ERROR;
-		    }
-		}
-	    }
-	}
+	    if (type_list.domp)
+	      {
+		db_private_free_and_init (thread_p, type_list.domp);
+	      }
 
-      if (specp == NULL)
-	{
-	  specp = scan_ptr->spec_list;
-	  if (specp != NULL && specp->pruning_type == DB_PARTITION_CLASS && specp->next == NULL
-	      && specp->s_id.mvcc_select_lock_needed)
-	    {
-	      /* the object may be updated to other partition */
-	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_INVALID_DATA_FOR_PARTITION, 0);
-	      return ER_INVALID_DATA_FOR_PARTITION;
-	    }
-	}
-    }
+	    if (qfile_copy_list_id (xasl->list_id, t_list_id, true) != NO_ERROR)
+	      {
+		qfile_free_list_id (t_list_id);
+		GOTO_EXIT_ON_ERROR;
+	      }			/* if */
 
-  return NO_ERROR;
-}
+	    qfile_free_list_id (t_list_id);
+	  }
 
-/*
- * qexec_execute_selupd_list () -
- *   return: NO_ERROR, or ER_code
- *   xasl(in)   : XASL Tree
- *   xasl_state(in)     :
- * Note: This routine executes update for a selected tuple
- */
-static int
-qexec_execute_selupd_list (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state)
-{
-  SELUPD_LIST *list = NULL, *selupd = NULL;
-  REGU_VARLIST_LIST outptr = NULL;
-  REGU_VARIABLE *varptr = NULL;
-  DB_VALUE *rightvalp = NULL, *thirdvalp = NULL;
-  bool subtransaction_started = false;
-  OID last_cached_class_oid;
-  int tran_index;
-  int err = NO_ERROR;
-  HEAP_SCANCACHE scan_cache;
-  bool scan_cache_inited = false;
-  SCAN_CODE scan_code;
-  LOG_TDES *tdes = NULL;
-  UPDDEL_MVCC_COND_REEVAL upd_reev;
-  MVCC_SCAN_REEV_DATA mvcc_sel_reev_data;
-  MVCC_REEV_DATA mvcc_reev_data, *p_mvcc_reev_data = NULL;
-  bool clear_list_id = false;
-  MVCC_SNAPSHOT *mvcc_snapshot = logtb_get_mvcc_snapshot (thread_p);
-  bool need_ha_replication = !LOG_CHECK_LOG_APPLIER (thread_p) && log_does_allow_replication () == true;
-  bool sysop_started = false;
-  bool in_instant_lock_mode;
+	qexec_clear_regu_list (thread_p, xasl, xasl->outptr_list->valptrp, true);
+	break;
+      }
 
-  // *INDENT-OFF*
-  struct incr_info
-  {
-    OID m_oid;
-    OID m_class_oid;
-    HFID m_class_hfid;
-    int m_attrid;
-    int m_n_increment;
-    DB_CLASS_PARTITION_TYPE m_ptype;
+    case BUILDVALUE_PROC:	/* start BUILDVALUE_PROC iterations */
+      {
+	BUILDVALUE_PROC_NODE *buildvalue = &xasl->proc.buildvalue;
 
-    incr_info () = default;
-    incr_info (const incr_info & other) = default;
-  };
-  std::vector<incr_info> all_incr_info;
-  std::vector<bool> all_skipped;
-  size_t incr_info_index = 0;
-  size_t skipped_index = 0;
-  // *INDENT-ON*
+	/* set groupby_num() value as 1 for BUILDVALUE_PROC */
+	if (buildvalue->grbynum_val)
+	  {
+	    db_make_bigint (buildvalue->grbynum_val, 1);
+	  }
 
-  assert (xasl->list_id->tuple_cnt == 1);
-  OID_SET_NULL (&last_cached_class_oid);
+	/* initialize aggregation list */
+	if (qdata_initialize_aggregate_list (thread_p, buildvalue->agg_list, xasl_state->query_id) != NO_ERROR)
+	  {
+	    GOTO_EXIT_ON_ERROR;
+	  }
+	break;
+      }
 
-  tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
+    case MERGELIST_PROC:
+    case UNION_PROC:
+    case DIFFERENCE_PROC:
+    case INTERSECTION_PROC:	/* start SET block iterations */
+      break;
 
-  if (QEXEC_SEL_UPD_USE_REEVALUATION (xasl))
-    {
-      /* need reevaluation in this function */
-      upd_reev.init (xasl->spec_list->s_id);
-      mvcc_sel_reev_data.set_filters (upd_reev);
-      mvcc_sel_reev_data.qualification = &xasl->spec_list->s_id.qualification;
-      mvcc_reev_data.set_scan_reevaluation (mvcc_sel_reev_data);
-      p_mvcc_reev_data = &mvcc_reev_data;
+    case CTE_PROC:
+      break;
 
-      /* clear list id if all reevaluations result is false */
-      clear_list_id = true;
+    default:
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_XASLNODE, 0);
+      GOTO_EXIT_ON_ERROR;
+    }				/* switch */
 
-      /* need lock & reevaluation */
-      lock_start_instant_lock_mode (tran_index);
-      in_instant_lock_mode = true;
-    }
-  else
+  /* initialize inst_num() value, instnum_flag */
+  if (xasl->instnum_val && qexec_init_instnum_val (xasl, thread_p, xasl_state) != NO_ERROR)
     {
-      // locking and evaluation is done at scan phase
-      in_instant_lock_mode = lock_is_instant_lock_mode (tran_index);
+      goto exit_on_error;
     }
 
-  list = xasl->selected_upd_list;
+  /* initialize orderby_num() value */
+  if (xasl->ordbynum_val)
+    {
+      db_make_bigint (xasl->ordbynum_val, 0);
+    }
 
-  /* do increment operation */
-  for (selupd = list; selupd; selupd = selupd->next)
+  if (XASL_IS_FLAGED (xasl, XASL_HAS_CONNECT_BY))
     {
-      for (outptr = selupd->select_list; outptr; outptr = outptr->next)
+      /* initialize level_val value */
+      if (xasl->level_val)
 	{
-	  incr_info crt_incr_info;
-
-	  if (outptr->list == NULL)
-	    {
-	      goto exit_on_error;
-	    }
-
-	  /* pointer to the regu variable */
-	  varptr = &(outptr->list->value);
-
-	  /* check something */
-	  if (!((varptr->type == TYPE_INARITH || varptr->type == TYPE_OUTARITH)
-		&& (varptr->value.arithptr->opcode == T_INCR || varptr->value.arithptr->opcode == T_DECR)))
-	    {
-	      goto exit_on_error;
-	    }
-	  if (varptr->value.arithptr->leftptr->type != TYPE_CONSTANT
-	      || varptr->value.arithptr->rightptr->type != TYPE_CONSTANT)
-	    {
-	      goto exit_on_error;
-	    }
-
-	  /* get oid and attrid to be fetched last at scan */
-	  rightvalp = varptr->value.arithptr->value;
-
-	  if (db_get_oid (rightvalp) == NULL)
-	    {
-	      /* Probably this would be INCR(NULL). When the source value is NULL, INCR/DECR expression is also NULL. */
-	      clear_list_id = false;
-	      all_skipped.push_back (true);
-	      continue;
-	    }
-	  crt_incr_info.m_oid = *db_get_oid (rightvalp);
-	  if (OID_ISNULL (&crt_incr_info.m_oid))
-	    {
-	      /* in some cases, a query returns no result even if it should have an result on dirty read mode. it may
-	       * be caused by index scan failure for index to be updated frequently (hot spot index). if this case is
-	       * fixed, it does not need to be checked */
-	      er_log_debug (ARG_FILE_LINE, "qexec_execute_selupd_list: OID is null\n");
-	      clear_list_id = false;
-	      all_skipped.push_back (true);
-	      continue;
-	    }
-
-	  /* we also need attribute id to perform increment */
-	  if (fetch_peek_dbval (thread_p, varptr->value.arithptr->thirdptr, NULL, NULL, NULL, NULL, &thirdvalp) !=
-	      NO_ERROR)
-	    {
-	      goto exit_on_error;
-	    }
-	  crt_incr_info.m_attrid = db_get_int (thirdvalp);
+	  db_make_int (xasl->level_val, 0);
+	}
+      /* initialize isleaf_val value */
+      if (xasl->isleaf_val)
+	{
+	  db_make_int (xasl->isleaf_val, 0);
+	}
+      /* initialize iscycle_val value */
+      if (xasl->iscycle_val)
+	{
+	  db_make_int (xasl->iscycle_val, 0);
+	}
+    }
 
-	  crt_incr_info.m_n_increment = (varptr->value.arithptr->opcode == T_INCR ? 1 : -1);
+  return NO_ERROR;
 
-	  /* check if class oid/hfid does not set, find class oid/hfid to access */
-	  bool found = false;
-	  err = qexec_execute_selupd_list_find_class (thread_p, xasl, &xasl_state->vd, &crt_incr_info.m_oid, selupd,
-						      &crt_incr_info.m_class_oid, &crt_incr_info.m_class_hfid,
-						      &crt_incr_info.m_ptype, &found);
-	  if (err != NO_ERROR)
-	    {
-	      goto exit_on_error;
-	    }
-	  if (!found)
-	    {
-	      /* not found hfid */
-	      er_log_debug (ARG_FILE_LINE, "qexec_execute_selupd_list: class hfid to access is null\n");
-	      assert (false);
-	      goto exit_on_error;
-	    }
+exit_on_error:
 
-	  if (p_mvcc_reev_data != NULL)
-	    {
-	      /* need locking and reevaluation */
-	      if (!OID_EQ (&last_cached_class_oid, &crt_incr_info.m_class_oid) && scan_cache_inited == true)
-		{
-		  (void) heap_scancache_end (thread_p, &scan_cache);
-		  scan_cache_inited = false;
-		}
+  if (xasl->type == BUILDLIST_PROC)
+    {
+      if (xasl->proc.buildlist.upddel_oid_locator_ehids != NULL)
+	{
+	  qexec_destroy_upddel_ehash_files (thread_p, xasl);
+	}
+    }
+  return ER_FAILED;
+}
 
-	      if (scan_cache_inited == false)
-		{
-		  if (heap_scancache_start (thread_p, &scan_cache, &crt_incr_info.m_class_hfid,
-					    &crt_incr_info.m_class_oid, false, false, mvcc_snapshot) != NO_ERROR)
-		    {
-		      goto exit_on_error;
-		    }
-		  scan_cache_inited = true;
-		  COPY_OID (&last_cached_class_oid, &crt_incr_info.m_class_oid);
-		}
-	      /* need to handle reevaluation */
-	      scan_code =
-		locator_lock_and_get_object_with_evaluation (thread_p, &crt_incr_info.m_oid, &crt_incr_info.m_class_oid,
-							     NULL, &scan_cache, COPY, NULL_CHN, p_mvcc_reev_data,
-							     LOG_WARNING_IF_DELETED);
-	      if (scan_code != S_SUCCESS)
-		{
-		  int er_id = er_errid ();
-		  if (er_id == ER_LK_UNILATERALLY_ABORTED || er_id == ER_MVCC_SERIALIZABLE_CONFLICT)
-		    {
-		      /* error, deadlock or something */
-		      goto exit_on_error;
-		    }
-		  else if (er_id == ER_LK_OBJECT_DL_TIMEOUT_SIMPLE_MSG || er_id == ER_LK_OBJECT_DL_TIMEOUT_CLASS_MSG
-			   || er_id == ER_LK_OBJECT_DL_TIMEOUT_CLASSOF_MSG)
-		    {
-		      /* ignore lock timeout for click counter, and skip this increment operation */
-		      er_log_debug (ARG_FILE_LINE,
-				    "qexec_execute_selupd_list: lock(X_LOCK) timed out "
-				    "for OID { %d %d %d } class OID { %d %d %d }\n", OID_AS_ARGS (&crt_incr_info.m_oid),
-				    OID_AS_ARGS (&crt_incr_info.m_class_oid));
-		      er_clear ();
-		      all_skipped.push_back (true);
-		      continue;
-		    }
-		  else
-		    {
-		      if (er_id != NO_ERROR)
-			{
-			  er_clear ();
-			}
-		      /* simply, skip this increment operation */
-		      er_log_debug (ARG_FILE_LINE,
-				    "qexec_execute_selupd_list: skip for OID "
-				    "{ %d %d %d } class OID { %d %d %d } error_id %d\n",
-				    OID_AS_ARGS (&crt_incr_info.m_oid), OID_AS_ARGS (&crt_incr_info.m_class_oid),
-				    er_id);
-		      all_skipped.push_back (true);
-		      continue;
-		    }
-		}
-	      else if (p_mvcc_reev_data->filter_result != V_TRUE)
-		{
-		  /* simply, skip this increment operation */
-		  er_log_debug (ARG_FILE_LINE,
-				"qexec_execute_selupd_list: skip for OID "
-				"{ %d %d %d } class OID { %d %d %d } error_id %d\n", OID_AS_ARGS (&crt_incr_info.m_oid),
-				OID_AS_ARGS (&crt_incr_info.m_class_oid), NO_ERROR);
-		  all_skipped.push_back (true);
-		  continue;
-		}
-	      else
-		{
-		  /* one tuple successfully reevaluated, do not clear list file */
-		  clear_list_id = false;
-		}
-	    }
-	  else
-	    {
-	      /* already locked during scan phase */
-	      assert ((lock_get_object_lock (&crt_incr_info.m_oid, &crt_incr_info.m_class_oid) == X_LOCK)
-		      || lock_get_object_lock (&crt_incr_info.m_class_oid, oid_Root_class_oid) >= X_LOCK);
-	    }
+/*
+ * qexec_end_buildvalueblock_iterations () -
+ *   return: NO_ERROR or ER_code
+ *   xasl(in)   : XASL Tree pointer
+ *   xasl_state(in)     : XASL tree state information
+ *   tplrec(out) : Tuple record descriptor to store result tuples
+ *
+ * Note: This routines performs the finish-up operations for BUILDVALUE
+ * block iteration.
+ */
+static int
+qexec_end_buildvalueblock_iterations (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
+				      QFILE_TUPLE_RECORD * tplrec)
+{
+  QFILE_LIST_ID *t_list_id = NULL;
+  int status = NO_ERROR;
+  int ls_flag = 0;
+  QPROC_TPLDESCR_STATUS tpldescr_status;
+  DB_LOGICAL ev_res = V_UNKNOWN;
+  QFILE_LIST_ID *output = NULL;
+  QFILE_TUPLE_VALUE_TYPE_LIST type_list;
+  BUILDVALUE_PROC_NODE *buildvalue = &xasl->proc.buildvalue;
 
-	  all_incr_info.push_back (crt_incr_info);
-	  all_skipped.push_back (false);
-	}
+  /* make final pass on aggregate list nodes */
+  if (buildvalue->agg_list && qdata_finalize_aggregate_list (thread_p, buildvalue->agg_list, false) != NO_ERROR)
+    {
+      GOTO_EXIT_ON_ERROR;
     }
 
-  log_sysop_start (thread_p);
-  sysop_started = true;
+  /* evaluate having predicate */
+  if (buildvalue->having_pred != NULL)
+    {
+      ev_res = eval_pred (thread_p, buildvalue->having_pred, &xasl_state->vd, NULL);
+      if (ev_res == V_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+      else if (ev_res != V_TRUE
+	       && qdata_set_valptr_list_unbound (thread_p, xasl->outptr_list, &xasl_state->vd) != NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+    }
 
-  if (lock_is_instant_lock_mode (tran_index))
+  /* a list of one tuple with a single value needs to be produced */
+  if (qdata_get_valptr_type_list (thread_p, xasl->outptr_list, &type_list) != NO_ERROR)
     {
-      assert (in_instant_lock_mode);
+      GOTO_EXIT_ON_ERROR;
+    }
 
-      /* in this function, several instances can be updated, so it need to be atomic */
-      if (need_ha_replication)
+  /* If BUILDVALUE_PROC does not have 'order by'(xasl->orderby_list), then the list file to be open at here will be the
+   * last one. Otherwise, the last list file will be open at qexec_orderby_distinct(). (Note that only one that can
+   * have 'group by' is BUILDLIST_PROC type.) And, the top most XASL is the other condition for the list file to be the
+   * last result file. */
+  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_ALL);
+  if (XASL_IS_FLAGED (xasl, XASL_TOP_MOST_XASL) && XASL_IS_FLAGED (xasl, XASL_TO_BE_CACHED)
+      && (xasl->orderby_list == NULL || XASL_IS_FLAGED (xasl, XASL_SKIP_ORDERBY_LIST)) && xasl->option != Q_DISTINCT)
+    {
+      QFILE_SET_FLAG (ls_flag, QFILE_FLAG_RESULT_FILE);
+    }
+  t_list_id = qfile_open_list (thread_p, &type_list, NULL, xasl_state->query_id, ls_flag);
+  if (t_list_id == NULL)
+    {
+      if (type_list.domp)
 	{
-	  repl_start_flush_mark (thread_p);
+	  db_private_free_and_init (thread_p, type_list.domp);
 	}
+      GOTO_EXIT_ON_ERROR;
+    }
 
-      /* Subtransaction case. Locks and MVCCID are acquired/released by subtransaction. */
-      tdes = LOG_FIND_TDES (LOG_FIND_THREAD_TRAN_INDEX (thread_p));
-      assert (tdes != NULL);
-      logtb_get_new_subtransaction_mvccid (thread_p, &tdes->mvccinfo);
-      subtransaction_started = true;
+      /***** WHAT IN THE WORLD IS THIS? *****/
+  if (type_list.domp)
+    {
+      db_private_free_and_init (thread_p, type_list.domp);
     }
 
-  for (selupd = list; selupd; selupd = selupd->next)
+  if (qfile_copy_list_id (xasl->list_id, t_list_id, true) != NO_ERROR)
     {
-      for (outptr = selupd->select_list; outptr; outptr = outptr->next)
+      GOTO_EXIT_ON_ERROR;
+    }
+
+  output = xasl->list_id;
+  QFILE_FREE_AND_INIT_LIST_ID (t_list_id);
+
+  if (buildvalue->having_pred == NULL || ev_res == V_TRUE)
+    {
+      tpldescr_status = qexec_generate_tuple_descriptor (thread_p, xasl->list_id, xasl->outptr_list, &xasl_state->vd);
+      if (tpldescr_status == QPROC_TPLDESCR_FAILURE)
 	{
-	  if (all_skipped[skipped_index++])
+	  GOTO_EXIT_ON_ERROR;
+	}
+
+      switch (tpldescr_status)
+	{
+	case QPROC_TPLDESCR_SUCCESS:
+	  /* build tuple into the list file page */
+	  if (qfile_generate_tuple_into_list (thread_p, xasl->list_id, T_NORMAL) != NO_ERROR)
 	    {
-	      // skip this increment
-	      continue;
+	      GOTO_EXIT_ON_ERROR;
 	    }
-	  const incr_info & crt_incr_info = all_incr_info[incr_info_index++];
-	  if (qexec_execute_increment (thread_p, &crt_incr_info.m_oid, &crt_incr_info.m_class_oid,
-				       &crt_incr_info.m_class_hfid, crt_incr_info.m_attrid, crt_incr_info.m_n_increment,
-				       crt_incr_info.m_ptype) != NO_ERROR)
+	  break;
+
+	case QPROC_TPLDESCR_RETRY_SET_TYPE:
+	case QPROC_TPLDESCR_RETRY_BIG_REC:
+	  if (tplrec->tpl == NULL)
 	    {
-	      goto exit_on_error;
+	      /* allocate tuple descriptor */
+	      tplrec->size = DB_PAGESIZE;
+	      tplrec->tpl = (QFILE_TUPLE) db_private_alloc (thread_p, DB_PAGESIZE);
+	      if (tplrec->tpl == NULL)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+	    }
+	  if (qdata_copy_valptr_list_to_tuple (thread_p, xasl->outptr_list, &xasl_state->vd, tplrec) != NO_ERROR)
+	    {
+	      GOTO_EXIT_ON_ERROR;
+	    }
+	  if (qfile_add_tuple_to_list (thread_p, xasl->list_id, tplrec->tpl) != NO_ERROR)
+	    {
+	      GOTO_EXIT_ON_ERROR;
 	    }
+	  break;
+
+	default:
+	  break;
 	}
     }
-  assert (skipped_index == all_skipped.size ());
-  assert (incr_info_index == all_incr_info.size ());
 
-  if (scan_cache_inited == true)
+end:
+
+  QEXEC_CLEAR_AGG_LIST_VALUE (buildvalue->agg_list);
+  if (t_list_id)
     {
-      (void) heap_scancache_end (thread_p, &scan_cache);
-      scan_cache_inited = false;
+      QFILE_FREE_AND_INIT_LIST_ID (t_list_id);
+    }
+  if (output)
+    {
+      qfile_close_list (thread_p, output);
     }
 
-  if (subtransaction_started && need_ha_replication)
+  return status;
+
+exit_on_error:
+
+  status = ER_FAILED;
+  goto end;
+}
+
+/*
+ * qexec_end_mainblock_iterations () -
+ *   return: NO_ERROR, or ER_code
+ *   xasl(in)   : XASL Tree pointer
+ *   xasl_state(in)     : XASL tree state information
+ *   tplrec(out) : Tuple record descriptor to store result tuples
+ *
+ * Note: This routines performs the finish-up operations for a main
+ * procedure block iteration. The main procedure block nodes can
+ * be of type BUILDLIST_PROC, BUILDVALUE, UNION_PROC,
+ * DIFFERENCE_PROC and INTERSECTION_PROC.
+ */
+static int
+qexec_end_mainblock_iterations (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
+				QFILE_TUPLE_RECORD * tplrec)
+{
+  QFILE_LIST_ID *t_list_id = NULL;
+  int status = NO_ERROR;
+  bool distinct_needed;
+  int ls_flag = 0;
+
+  distinct_needed = (xasl->option == Q_DISTINCT) ? true : false;
+
+#if defined (ENABLE_COMPOSITE_LOCK)
+  /* Acquire the lockset if composite locking is enabled. */
+  if ((COMPOSITE_LOCK (xasl->scan_op_type) || QEXEC_IS_MULTI_TABLE_UPDATE_DELETE (xasl))
+      && (!XASL_IS_FLAGED (xasl, XASL_MULTI_UPDATE_AGG)))
     {
-      /* Ends previously started marker. */
-      repl_end_flush_mark (thread_p, false);
+      if (lock_finalize_composite_lock (thread_p, &xasl->composite_lock) != LK_GRANTED)
+	{
+	  return ER_FAILED;
+	}
     }
+#endif /* defined (ENABLE_COMPOSITE_LOCK) */
 
-  /* Here we need to check instant lock mode, since it may be reseted by qexec_execute_increment. */
-  if (lock_is_instant_lock_mode (tran_index))
+  switch (xasl->type)
     {
-      /* Subtransaction case. */
-      assert (subtransaction_started);
-      log_sysop_commit (thread_p);
 
-      assert (in_instant_lock_mode);
-    }
-  else
-    {
-      /* Transaction case. */
-      log_sysop_attach_to_outer (thread_p);
+    case BUILDLIST_PROC:	/* end BUILDLIST_PROC iterations */
+      /* Destroy the extendible hash files for SELECT statement generated for UPDATE/DELETE */
+      if (xasl->proc.buildlist.upddel_oid_locator_ehids != NULL)
+	{
+	  qexec_destroy_upddel_ehash_files (thread_p, xasl);
+	}
+      /* fall through */
+    case CONNECTBY_PROC:
+    case BUILD_SCHEMA_PROC:
+      /* close the list file */
+      qfile_close_list (thread_p, xasl->list_id);
+      break;
+
+    case MERGELIST_PROC:
+      /* do a direct list file merge to generate resultant list file */
+      if (qexec_merge_listfiles (thread_p, xasl, xasl_state) != NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+      break;
+
+    case BUILDVALUE_PROC:	/* end BUILDVALUE_PROC iterations */
+      status = qexec_end_buildvalueblock_iterations (thread_p, xasl, xasl_state, tplrec);
+      break;
+
+    case UNION_PROC:
+    case DIFFERENCE_PROC:
+    case INTERSECTION_PROC:
+      if (xasl->type == UNION_PROC)
+	{
+	  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_UNION);
+	}
+      else if (xasl->type == DIFFERENCE_PROC)
+	{
+	  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_DIFFERENCE);
+	}
+      else
+	{
+	  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_INTERSECT);
+	}
+
+      if (distinct_needed)
+	{
+	  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_DISTINCT);
+	}
+      else
+	{
+	  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_ALL);
+	}
+
+      /* For UNION_PROC, DIFFERENCE_PROC, and INTERSECTION_PROC, if they do not have 'order by'(xasl->orderby_list),
+       * then the list file to be open at here will be the last one. Otherwise, the last list file will be open at
+       * qexec_groupby() or qexec_orderby_distinct(). (Note that only one that can have 'group by' is BUILDLIST_PROC
+       * type.) And, the top most XASL is the other condition for the list file to be the last result file. */
+
+      if (XASL_IS_FLAGED (xasl, XASL_TOP_MOST_XASL) && XASL_IS_FLAGED (xasl, XASL_TO_BE_CACHED)
+	  && (xasl->orderby_list == NULL || XASL_IS_FLAGED (xasl, XASL_SKIP_ORDERBY_LIST)))
+	{
+	  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_RESULT_FILE);
+	}
+
+      t_list_id =
+	qfile_combine_two_list (thread_p, xasl->proc.union_.left->list_id, xasl->proc.union_.right->list_id, ls_flag);
+      distinct_needed = false;
+      if (!t_list_id)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+      if (qfile_copy_list_id (xasl->list_id, t_list_id, true) != NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+      QFILE_FREE_AND_INIT_LIST_ID (t_list_id);
+      break;
+
+    case CTE_PROC:
+      /* close the list file */
+      qfile_close_list (thread_p, xasl->list_id);
+      break;
+
+    default:
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_XASLNODE, 0);
+      GOTO_EXIT_ON_ERROR;
+    }				/* switch */
 
-      in_instant_lock_mode = false;
-    }
+  /* DISTINCT processing (i.e, duplicates elimination) is performed at qexec_orderby_distinct() after GROUP BY
+   * processing */
 
-exit:
-  /* Release subtransaction resources. */
-  if (subtransaction_started)
+success:
+  if (t_list_id)
     {
-      /* Release subtransaction MVCCID. */
-      logtb_complete_sub_mvcc (thread_p, tdes);
+      QFILE_FREE_AND_INIT_LIST_ID (t_list_id);
     }
+  return status;
 
-  if (in_instant_lock_mode)
-    {
-      /* Release instant locks, if not already released. */
-      lock_stop_instant_lock_mode (thread_p, tran_index, true);
-      in_instant_lock_mode = false;
-    }
+exit_on_error:
+  status = ER_FAILED;
+  goto success;
 
-  // not hold instant locks any more.
-  assert (!in_instant_lock_mode && !lock_is_instant_lock_mode (tran_index));
+}
 
-  if (err != NO_ERROR)
-    {
-      qexec_failure_line (__LINE__, xasl_state);
-      return ER_FAILED;
-    }
+/*
+ * qexec_clear_mainblock_iterations () -
+ *   return:
+ *   xasl(in)   : XASL Tree pointer
+ */
+static void
+qexec_clear_mainblock_iterations (THREAD_ENTRY * thread_p, XASL_NODE * xasl)
+{
+  AGGREGATE_TYPE *agg_p;
 
-  if (clear_list_id)
+  switch (xasl->type)
     {
-      /* can't reevaluate any data, clear list file */
-      qfile_clear_list_id (xasl->list_id);
-    }
+    case BUILDLIST_PROC:
+      /* Destroy the extendible hash files for SELECT statement generated for UPDATE/DELETE */
+      if (xasl->proc.buildlist.upddel_oid_locator_ehids != NULL)
+	{
+	  qexec_destroy_upddel_ehash_files (thread_p, xasl);
+	}
+      /* fall through */
+    case CONNECTBY_PROC:
+      qfile_close_list (thread_p, xasl->list_id);
+      break;
 
-  return NO_ERROR;
+    case BUILDVALUE_PROC:
+      for (agg_p = xasl->proc.buildvalue.agg_list; agg_p != NULL; agg_p = agg_p->next)
+	{
+	  qfile_close_list (thread_p, agg_p->list_id);
+	  qfile_destroy_list (thread_p, agg_p->list_id);
+	}
+      break;
 
-exit_on_error:
+    case UNION_PROC:
+    case DIFFERENCE_PROC:
+    case INTERSECTION_PROC:
+    case OBJFETCH_PROC:
+    case SCAN_PROC:
+    case MERGELIST_PROC:
+    case UPDATE_PROC:
+    case DELETE_PROC:
+    case INSERT_PROC:
+    case DO_PROC:
+    case MERGE_PROC:
+    case BUILD_SCHEMA_PROC:
+    case CTE_PROC:
+      break;
 
-  if (scan_cache_inited == true)
-    {
-      (void) heap_scancache_end (thread_p, &scan_cache);
-      scan_cache_inited = false;
+    default:
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_XASLNODE, 0);
+      break;
     }
 
-  if (subtransaction_started && need_ha_replication)
-    {
-      /* Ends previously started marker. */
-      repl_end_flush_mark (thread_p, true);
-    }
+  return;
+}
 
-  if (sysop_started)
+#if defined (SERVER_MODE)
+/*
+ * qexec_parallel_scan_workers_init () - create worker pool of parallel heap scans
+ */
+void
+qexec_parallel_scan_workers_init (void)
+{
+  int worker_count = prm_get_integer_value (PRM_ID_PARALLEL_HEAP_SCAN_WORKER_COUNT);
+
+  if (worker_count < 2 || qexec_Parallel_scan_workers != NULL)
     {
-      log_sysop_abort (thread_p);
-      sysop_started = false;
+      /* parallel heap scan is disabled, or the pool already exists */
+      return;
     }
 
-  /* clear some kinds of error code; it's click counter! */
-  ASSERT_ERROR_AND_SET (err);
-  if (err == ER_LK_UNILATERALLY_ABORTED || err == ER_LK_OBJECT_TIMEOUT_CLASSOF_MSG
-      || err == ER_LK_OBJECT_DL_TIMEOUT_CLASSOF_MSG || err == ER_LK_OBJECT_DL_TIMEOUT_SIMPLE_MSG
-      || err == ER_LK_OBJECT_TIMEOUT_SIMPLE_MSG)
+  qexec_Parallel_scan_context = new qexec_parallel_scan_context ();
+  qexec_Parallel_scan_workers =
+    cubthread::get_manager ()->create_worker_pool (worker_count, worker_count, "parallel heap scan",
+						   qexec_Parallel_scan_context, 1, false);
+  if (qexec_Parallel_scan_workers == NULL)
     {
-      er_log_debug (ARG_FILE_LINE, "qexec_execute_selupd_list: ignore error %d\n", err);
-
-      lock_clear_deadlock_victim (tran_index);
-      qfile_close_list (thread_p, xasl->list_id);
-      qfile_destroy_list (thread_p, xasl->list_id);
-      er_clear ();
-      err = NO_ERROR;
+      /* not enough thread entries; heaps are scanned serially */
+      delete qexec_Parallel_scan_context;
+      qexec_Parallel_scan_context = NULL;
     }
-
-  goto exit;
 }
 
 /*
- * qexec_init_instnum_val () -
- *   return: NO_ERROR, or ER_code
- *   xasl(in)   : XASL Tree pointer
- *   thread_p   : Thread entry pointer
- *   xasl_state(in)     : XASL tree state information
- *
- * Note: This routine initializes the instnum value used in execution
- *       to evaluate rownum() predicates.
- *       Usually the value is set to 0, so that the first row number will be 1,
- *       but for single table index scans that have a keylimit with a lower
- *       value, we initialize instnum_val with keylimit's low value.
- *       Otherwise, keylimit would skip some rows and instnum will start
- *       counting from 1, which is wrong.
+ * qexec_parallel_scan_workers_destroy () - destroy worker pool of parallel heap scans
  */
-static int
-qexec_init_instnum_val (XASL_NODE * xasl, THREAD_ENTRY * thread_p, XASL_STATE * xasl_state)
+void
+qexec_parallel_scan_workers_destroy (void)
 {
-  TP_DOMAIN *domainp = tp_domain_resolve_default (DB_TYPE_BIGINT);
-  DB_TYPE orig_type;
-  REGU_VARIABLE *key_limit_l;
-  DB_VALUE *dbvalp;
-  int error = NO_ERROR;
-  TP_DOMAIN_STATUS dom_status;
+  cubthread::get_manager ()->destroy_worker_pool (qexec_Parallel_scan_workers);
+  delete qexec_Parallel_scan_context;
+  qexec_Parallel_scan_context = NULL;
+}
 
-  assert (xasl && xasl->instnum_val);
-  db_make_bigint (xasl->instnum_val, 0);
+// *INDENT-OFF*
+int
+qexec_parallel_scan::get_next_pages (THREAD_ENTRY * thread_p, VPID * vpids, int & count)
+{
+  std::lock_guard<std::mutex> lockg (m_mutex);
+  int error_code;
 
-  if (xasl->save_instnum_val)
+  count = 0;
+  if (m_is_heap_end || m_is_stopped)
     {
-      db_make_bigint (xasl->save_instnum_val, 0);
+      return NO_ERROR;
     }
 
-  /* Single table, index scan, with keylimit that has lower value */
-  if (xasl->scan_ptr == NULL && xasl->spec_list != NULL && xasl->spec_list->next == NULL
-      && xasl->spec_list->access == ACCESS_METHOD_INDEX && xasl->spec_list->indexptr
-      && xasl->spec_list->indexptr->key_info.key_limit_l)
+  error_code = heap_get_page_batch (thread_p, &m_hfid, &m_next_vpid, &m_read_ahead, vpids,
+				    QEXEC_PARALLEL_SCAN_BATCH_PAGES, &count);
+  if (error_code != NO_ERROR)
     {
-      key_limit_l = xasl->spec_list->indexptr->key_info.key_limit_l;
-      if (fetch_peek_dbval (thread_p, key_limit_l, &xasl_state->vd, NULL, NULL, NULL, &dbvalp) != NO_ERROR)
-	{
-	  goto exit_on_error;
-	}
-
-      orig_type = DB_VALUE_DOMAIN_TYPE (dbvalp);
-      if (orig_type != DB_TYPE_BIGINT)
-	{
-	  dom_status = tp_value_coerce (dbvalp, dbvalp, domainp);
-	  if (dom_status != DOMAIN_COMPATIBLE)
-	    {
-	      error = tp_domain_status_er_set (dom_status, ARG_FILE_LINE, dbvalp, domainp);
-	      assert_release (error != NO_ERROR);
-
-	      goto exit_on_error;
-	    }
+      return error_code;
+    }
 
-	  if (DB_VALUE_DOMAIN_TYPE (dbvalp) != DB_TYPE_BIGINT)
-	    {
-	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_DATATYPE, 0);
-	      goto exit_on_error;
-	    }
-	}
+  if (VPID_ISNULL (&m_next_vpid))
+    {
+      m_is_heap_end = true;
+    }
+  return NO_ERROR;
+}
 
-      if (pr_clone_value (dbvalp, xasl->instnum_val) != NO_ERROR)
-	{
-	  goto exit_on_error;
-	}
+void
+qexec_parallel_scan::stop (int error_code)
+{
+  std::lock_guard<std::mutex> lockg (m_mutex);
 
-      if (xasl->save_instnum_val && pr_clone_value (dbvalp, xasl->save_instnum_val) != NO_ERROR)
-	{
-	  goto exit_on_error;
-	}
+  // an interrupt must be reported even if the scan was already given up
+  if (!m_is_stopped || error_code == ER_INTERRUPTED)
+    {
+      m_error_code = error_code;
     }
+  m_is_stopped = true;
+}
 
-  xasl->instnum_flag &= ~(XASL_INSTNUM_FLAG_SCAN_CHECK | XASL_INSTNUM_FLAG_SCAN_STOP
-			  | XASL_INSTNUM_FLAG_SCAN_LAST_STOP);
+void
+qexec_parallel_scan::start_task ()
+{
+  std::lock_guard<std::mutex> lockg (m_mutex);
+  m_tasks_in_progress++;
+}
 
-  return NO_ERROR;
+void
+qexec_parallel_scan::end_task ()
+{
+  std::lock_guard<std::mutex> lockg (m_mutex);
 
-exit_on_error:
-  return ER_FAILED;
+  assert (m_tasks_in_progress > 0);
+  if (--m_tasks_in_progress == 0)
+    {
+      m_idle_cv.notify_all ();
+    }
 }
 
-/*
- * qexec_start_mainblock_iterations () -
- *   return: NO_ERROR, or ER_code
- *   xasl(in)   : XASL Tree pointer
- *   xasl_state(in)     : XASL tree state information
- *
- * Note: This routines performs the start-up operations for a main
- * procedure block iteration. The main procedure block nodes can
- * be of type BUILDLIST_PROC, BUILDVALUE, UNION_PROC,
- * DIFFERENCE_PROC and INTERSECTION_PROC.
- */
-int
-qexec_start_mainblock_iterations (THREAD_ENTRY * thread_p, xasl_node * xasl, xasl_state * xasl_state)
+void
+qexec_parallel_scan::wait_for_tasks ()
 {
-  QFILE_TUPLE_VALUE_TYPE_LIST type_list;
-  QFILE_LIST_ID *t_list_id = NULL;
-  int ls_flag = 0;
+  std::unique_lock<std::mutex> ulock (m_mutex);
+  m_idle_cv.wait (ulock, [this] { return m_tasks_in_progress == 0; });
+}
 
-  switch (xasl->type)
+void
+qexec_parallel_scan_task::execute (context_type & thread_ref)
+{
+  int save_tran_index = thread_ref.tran_index;
+  css_conn_entry *save_conn_entry = thread_ref.conn_entry;
+  HL_HEAPID save_heapid;
+  bool gave_up = false;
+  int error_code;
+
+  // scan for the transaction of the query; the clone of the worker was loaded in the global heap
+  thread_ref.tran_index = m_scan.m_tran_index;
+  thread_ref.conn_entry = m_scan.m_conn_entry;
+  save_heapid = db_change_private_heap (&thread_ref, 0);
+
+  error_code = qexec_parallel_scan_worker_execute (&thread_ref, &m_scan, &m_worker, &gave_up);
+  if (error_code != NO_ERROR || gave_up)
     {
-    case CONNECTBY_PROC:
-      {
-	if (xasl->list_id->type_list.type_cnt == 0)
-	  {
-	    if (qdata_get_valptr_type_list (thread_p, xasl->outptr_list, &type_list) != NO_ERROR)
-	      {
-		if (type_list.domp)
-		  {
-		    db_private_free_and_init (thread_p, type_list.domp);
-		  }
-		GOTO_EXIT_ON_ERROR;
-	      }
+      m_scan.stop (error_code);
+      er_clear ();
+    }
+
+  (void) db_change_private_heap (&thread_ref, save_heapid);
+  thread_ref.tran_index = save_tran_index;
+  thread_ref.conn_entry = save_conn_entry;
 
-	    QFILE_SET_FLAG (ls_flag, QFILE_FLAG_ALL);
-	    t_list_id = qfile_open_list (thread_p, &type_list, NULL, xasl_state->query_id, ls_flag);
-	    if (t_list_id == NULL)
-	      {
-		if (type_list.domp)
-		  {
-		    db_private_free_and_init (thread_p, type_list.domp);
-		  }
-		if (t_list_id)
-		  {
-		    QFILE_FREE_AND_INIT_LIST_ID (t_list_id);
-		  }
-		GOTO_EXIT_ON_ERROR;
-	      }
+  m_scan.end_task ();
+}
+// *INDENT-ON*
 
-	    if (type_list.domp)
-	      {
-		db_private_free_and_init (thread_p, type_list.domp);
-	      }
+/*
+ * qexec_parallel_scan_worker_count () - get number of workers to scan the heap of XASL
+ *   return: number of workers, or 0 if the heap must be scanned serially
+ *   thread_p(in): thread entry
+ *   xasl(in): XASL tree
+ *
+ * Note: Only a top-most aggregation over the sequential scan of a single class is scanned in parallel, and only if
+ *       its aggregate functions can be computed from partial aggregates of the workers.
+ */
+static int
+qexec_parallel_scan_worker_count (THREAD_ENTRY * thread_p, XASL_NODE * xasl)
+{
+  ACCESS_SPEC_TYPE *spec = xasl->spec_list;
+  AGGREGATE_TYPE *agg_list, *agg_p;
+  int max_workers, num_pages, worker_count;
 
-	    if (qfile_copy_list_id (xasl->list_id, t_list_id, true) != NO_ERROR)
-	      {
-		QFILE_FREE_AND_INIT_LIST_ID (t_list_id);
-		GOTO_EXIT_ON_ERROR;
-	      }			/* if */
-	    QFILE_FREE_AND_INIT_LIST_ID (t_list_id);
-	  }
-      }
-      break;
+  max_workers = prm_get_integer_value (PRM_ID_PARALLEL_HEAP_SCAN_WORKER_COUNT);
+  if (max_workers < 2 || qexec_Parallel_scan_workers == NULL || thread_is_on_trace (thread_p))
+    {
+      return 0;
+    }
 
-    case BUILDLIST_PROC:	/* start BUILDLIST_PROC iterations */
-      {
-	BUILDLIST_PROC_NODE *buildlist = &xasl->proc.buildlist;
+  if (!qexec_is_single_class_heap_scan (xasl))
+    {
+      return 0;
+    }
 
-	/* Initialize extendible hash files for SELECT statement generated for multi UPDATE/DELETE */
-	if (QEXEC_IS_MULTI_TABLE_UPDATE_DELETE (xasl) && !XASL_IS_FLAGED (xasl, XASL_MULTI_UPDATE_AGG))
-	  {
-	    if (qexec_init_upddel_ehash_files (thread_p, xasl) != NO_ERROR)
-	      {
-		GOTO_EXIT_ON_ERROR;
-	      }
-	  }
-	else
-	  {
-	    buildlist->upddel_oid_locator_ehids = NULL;
-	  }
+  switch (xasl->type)
+    {
+    case BUILDVALUE_PROC:
+      if (xasl->proc.buildvalue.is_always_false)
+	{
+	  return 0;
+	}
+      agg_list = xasl->proc.buildvalue.agg_list;
+      break;
 
-	/* initialize groupby_num() value for BUILDLIST_PROC */
-	if (buildlist->g_grbynum_val)
-	  {
-	    db_make_bigint (buildlist->g_grbynum_val, 0);
-	  }
+    case BUILDLIST_PROC:
+      if (xasl->proc.buildlist.groupby_list == NULL || !xasl->proc.buildlist.g_hash_eligible
+	  || xasl->proc.buildlist.g_output_first_tuple || xasl->proc.buildlist.g_with_rollup
+	  || xasl->proc.buildlist.agg_hash_context->state == HS_REJECT_ALL)
+	{
+	  return 0;
+	}
+      agg_list = xasl->proc.buildlist.g_agg_list;
+      break;
 
-	if (xasl->list_id->type_list.type_cnt == 0)
-	  {
-	    if (qdata_get_valptr_type_list (thread_p, xasl->outptr_list, &type_list) != NO_ERROR)
-	      {
-		if (type_list.domp)
-		  {
-		    db_private_free_and_init (thread_p, type_list.domp);
-		  }
-		GOTO_EXIT_ON_ERROR;
-	      }
+    default:
+      return 0;
+    }
 
+  if (agg_list == NULL)
+    {
+      return 0;
+    }
 
-	    QFILE_SET_FLAG (ls_flag, QFILE_FLAG_ALL);
-	    if (XASL_IS_FLAGED (xasl, XASL_TOP_MOST_XASL) && XASL_IS_FLAGED (xasl, XASL_TO_BE_CACHED)
-		&& buildlist->groupby_list == NULL && buildlist->a_eval_list == NULL
-		&& (xasl->orderby_list == NULL || XASL_IS_FLAGED (xasl, XASL_SKIP_ORDERBY_LIST))
-		&& xasl->option != Q_DISTINCT)
-	      {
-		QFILE_SET_FLAG (ls_flag, QFILE_FLAG_RESULT_FILE);
-	      }
+  for (agg_p = agg_list; agg_p != NULL; agg_p = agg_p->next)
+    {
+      if (agg_p->option == Q_DISTINCT || agg_p->sort_list != NULL || agg_p->flag_agg_optimize)
+	{
+	  return 0;
+	}
 
-	    t_list_id = qfile_open_list (thread_p, &type_list, xasl->after_iscan_list, xasl_state->query_id, ls_flag);
-	    if (t_list_id == NULL)
-	      {
-		if (type_list.domp)
-		  {
-		    db_private_free_and_init (thread_p, type_list.domp);
-		  }
-		if (t_list_id)
-		  {
-		    QFILE_FREE_AND_INIT_LIST_ID (t_list_id);
-		  }
-		GOTO_EXIT_ON_ERROR;
-	      }
+      switch (agg_p->function)
+	{
+	case PT_COUNT_STAR:
+	case PT_COUNT:
+	case PT_MIN:
+	case PT_MAX:
+	case PT_SUM:
+	case PT_AVG:
+	case PT_AGG_BIT_AND:
+	case PT_AGG_BIT_OR:
+	case PT_AGG_BIT_XOR:
+	case PT_STDDEV:
+	case PT_STDDEV_POP:
+	case PT_STDDEV_SAMP:
+	case PT_VARIANCE:
+	case PT_VAR_POP:
+	case PT_VAR_SAMP:
+	  /* partial aggregates of workers can be merged */
+	  break;
 
-	    if (type_list.domp)
-	      {
-		db_private_free_and_init (thread_p, type_list.domp);
-	      }
+	default:
+	  return 0;
+	}
+    }
 
-	    if (qfile_copy_list_id (xasl->list_id, t_list_id, true) != NO_ERROR)
-	      {
-		QFILE_FREE_AND_INIT_LIST_ID (t_list_id);
-		GOTO_EXIT_ON_ERROR;
-	      }			/* if */
+  if (file_get_num_user_pages (thread_p, &ACCESS_SPEC_HFID (spec).vfid, &num_pages) != NO_ERROR)
+    {
+      er_clear ();
+      return 0;
+    }
 
-	    QFILE_FREE_AND_INIT_LIST_ID (t_list_id);
+  worker_count = MIN (max_workers, num_pages / QEXEC_PARALLEL_SCAN_PAGES_PER_WORKER);
+  return (worker_count < 2) ? 0 : worker_count;
+}
 
-	    if (xasl->orderby_list != NULL)
-	      {
-		if (qexec_setup_topn_proc (thread_p, xasl, &xasl_state->vd) != NO_ERROR)
-		  {
-		    GOTO_EXIT_ON_ERROR;
-		  }
-	      }
-	  }
-	break;
-      }
+/*
+ * qexec_parallel_scan_worker_start () - load XASL clone of a parallel scan worker and start its heap scan
+ *   return: error code
+ *   thread_p(in): thread entry
+ *   xasl_state(in): XASL state of the query
+ *   xcache_entry(in): XASL cache entry of the query
+ *   worker(out): parallel scan worker
+ *
+ * Note: The clone is loaded in the global heap, because it is used by another thread. The scan uses the MVCC snapshot
+ *       of the transaction.
+ */
+static int
+qexec_parallel_scan_worker_start (THREAD_ENTRY * thread_p, XASL_STATE * xasl_state, XASL_CACHE_ENTRY * xcache_entry,
+				  QEXEC_PARALLEL_SCAN_WORKER * worker)
+{
+  XASL_NODE *xasl;
+  ACCESS_SPEC_TYPE *spec;
+  AGGREGATE_TYPE *agg_p;
+  HL_HEAPID save_heapid;
+  bool mvcc_select_lock_needed = false;
+  int error_code = NO_ERROR;
 
-    case BUILD_SCHEMA_PROC:	/* start BUILDSCHEMA_PROC iterations */
-      {
-	if (xasl->list_id->type_list.type_cnt == 0)
-	  {
-	    if (qdata_get_valptr_type_list (thread_p, xasl->outptr_list, &type_list) != NO_ERROR)
-	      {
-		if (type_list.domp)
-		  {
-		    db_private_free_and_init (thread_p, type_list.domp);
-		  }
-		GOTO_EXIT_ON_ERROR;
-	      }
+  save_heapid = db_change_private_heap (thread_p, 0);
 
-	    QFILE_SET_FLAG (ls_flag, QFILE_FLAG_ALL);
-	    t_list_id = qfile_open_list (thread_p, &type_list, NULL, xasl_state->query_id, ls_flag);
-	    if (t_list_id == NULL)
-	      {
-		if (type_list.domp)
-		  {
-		    db_private_free_and_init (thread_p, type_list.domp);
-		  }
-		if (t_list_id)
-		  {
-		    qfile_free_list_id (t_list_id);
-		  }
-		GOTO_EXIT_ON_ERROR;
-	      }
+  error_code =
+    stx_map_stream_to_xasl (thread_p, &worker->clone.xasl, true, xcache_entry->stream.buffer,
+			    xcache_entry->stream.buffer_size, &worker->clone.xasl_buf);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      goto end;
+    }
+  xasl = worker->clone.xasl;
 
-	    if (type_list.domp)
-	      {
-		db_private_free_and_init (thread_p, type_list.domp);
-	      }
+  worker->xasl_state = *xasl_state;
+  worker->xasl_state.vd.xasl_state = &worker->xasl_state;
 
-	    if (qfile_copy_list_id (xasl->list_id, t_list_id, true) != NO_ERROR)
-	      {
-		qfile_free_list_id (t_list_id);
-		GOTO_EXIT_ON_ERROR;
-	      }			/* if */
+  if (xasl->type == BUILDLIST_PROC)
+    {
+      error_code = qexec_alloc_agg_hash_context (thread_p, &xasl->proc.buildlist, &worker->xasl_state);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  goto end;
+	}
+      xasl->proc.buildlist.agg_hash_context->is_partial = true;
 
-	    qfile_free_list_id (t_list_id);
-	  }
+      /* nullify domains */
+      for (agg_p = xasl->proc.buildlist.g_agg_list; agg_p != NULL; agg_p = agg_p->next)
+	{
+	  agg_p->accumulator_domain.value_dom = NULL;
+	  agg_p->accumulator_domain.value2_dom = NULL;
+	}
+      xasl->proc.buildlist.g_agg_domains_resolved = 0;
+    }
+  else
+    {
+      assert (xasl->type == BUILDVALUE_PROC);
 
-	qexec_clear_regu_list (thread_p, xasl, xasl->outptr_list->valptrp, true);
-	break;
-      }
+      /* nullify domains */
+      for (agg_p = xasl->proc.buildvalue.agg_list; agg_p != NULL; agg_p = agg_p->next)
+	{
+	  agg_p->accumulator_domain.value_dom = NULL;
+	  agg_p->accumulator_domain.value2_dom = NULL;
+	}
+      xasl->proc.buildvalue.agg_domains_resolved = 0;
+    }
 
-    case BUILDVALUE_PROC:	/* start BUILDVALUE_PROC iterations */
-      {
-	BUILDVALUE_PROC_NODE *buildvalue = &xasl->proc.buildvalue;
+  error_code = qexec_start_mainblock_iterations (thread_p, xasl, &worker->xasl_state);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      goto end;
+    }
 
-	/* set groupby_num() value as 1 for BUILDVALUE_PROC */
-	if (buildvalue->grbynum_val)
-	  {
-	    db_make_bigint (buildvalue->grbynum_val, 1);
-	  }
+  spec = xasl->spec_list;
+  error_code =
+    qexec_open_scan (thread_p, spec, xasl->val_list, &worker->xasl_state.vd, false, spec->fixed_scan, false, false,
+		     &spec->s_id, worker->xasl_state.query_id, S_SELECT, false, &mvcc_select_lock_needed);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      goto end;
+    }
+  worker->is_scan_opened = true;
 
-	/* initialize aggregation list */
-	if (qdata_initialize_aggregate_list (thread_p, buildvalue->agg_list, xasl_state->query_id) != NO_ERROR)
-	  {
-	    GOTO_EXIT_ON_ERROR;
-	  }
-	break;
-      }
+  error_code = scan_start_scan (thread_p, &spec->s_id);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      goto end;
+    }
 
-    case MERGELIST_PROC:
-    case UNION_PROC:
-    case DIFFERENCE_PROC:
-    case INTERSECTION_PROC:	/* start SET block iterations */
-      break;
+  if (mvcc_select_lock_needed || spec->s_id.type != S_HEAP_SCAN)
+    {
+      /* the main scan was checked; the clone is expected to be opened the same way */
+      assert (false);
+      error_code = ER_FAILED;
+    }
 
-    case CTE_PROC:
-      break;
+end:
+  (void) db_change_private_heap (thread_p, save_heapid);
+  return error_code;
+}
 
-    default:
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_XASLNODE, 0);
-      GOTO_EXIT_ON_ERROR;
-    }				/* switch */
+/*
+ * qexec_parallel_scan_worker_end () - end heap scan of a parallel scan worker and free its XASL clone
+ *   return:
+ *   thread_p(in): thread entry
+ *   worker(in): parallel scan worker
+ */
+static void
+qexec_parallel_scan_worker_end (THREAD_ENTRY * thread_p, QEXEC_PARALLEL_SCAN_WORKER * worker)
+{
+  XASL_NODE *xasl = worker->clone.xasl;
+  HL_HEAPID save_heapid;
 
-  /* initialize inst_num() value, instnum_flag */
-  if (xasl->instnum_val && qexec_init_instnum_val (xasl, thread_p, xasl_state) != NO_ERROR)
+  if (xasl == NULL)
     {
-      goto exit_on_error;
+      return;
     }
 
-  /* initialize orderby_num() value */
-  if (xasl->ordbynum_val)
+  save_heapid = db_change_private_heap (thread_p, 0);
+
+  if (worker->is_scan_opened)
     {
-      db_make_bigint (xasl->ordbynum_val, 0);
+      qexec_end_scan (thread_p, xasl->spec_list);
+      qexec_close_scan (thread_p, xasl->spec_list);
+      worker->is_scan_opened = false;
     }
 
-  if (XASL_IS_FLAGED (xasl, XASL_HAS_CONNECT_BY))
+  XASL_SET_FLAG (xasl, XASL_DECACHE_CLONE);
+  (void) qexec_clear_xasl (thread_p, xasl, true);
+  free_xasl_unpack_info (thread_p, worker->clone.xasl_buf);
+  worker->clone.xasl = NULL;
+
+  (void) db_change_private_heap (thread_p, save_heapid);
+}
+
+/*
+ * qexec_parallel_scan_worker_execute () - scan batches of heap pages with the XASL clone of a worker
+ *   return: error code
+ *   thread_p(in): thread entry
+ *   scan(in): parallel scan
+ *   worker(in): parallel scan worker
+ *   gave_up(out): true if the worker cannot aggregate the rows it scans
+ *
+ * Note: Each page is scanned alone, by starting the heap scan of the worker before the first slot of the page and
+ *       ending it with the page.
+ */
+static int
+qexec_parallel_scan_worker_execute (THREAD_ENTRY * thread_p, qexec_parallel_scan * scan,
+				    QEXEC_PARALLEL_SCAN_WORKER * worker, bool * gave_up)
+{
+  XASL_NODE *xasl = worker->clone.xasl;
+  SCAN_ID *s_id = &xasl->spec_list->s_id;
+  HEAP_SCAN_ID *hsidp = &s_id->s.hsid;
+  VPID vpids[QEXEC_PARALLEL_SCAN_BATCH_PAGES];
+  QFILE_TUPLE_RECORD tplrec = { NULL, 0 };
+  SCAN_CODE scan_code;
+  bool continue_checking = true;
+  int count = 0, i;
+  int error_code = NO_ERROR;
+
+  *gave_up = false;
+
+  while (true)
     {
-      /* initialize level_val value */
-      if (xasl->level_val)
-	{
-	  db_make_int (xasl->level_val, 0);
-	}
-      /* initialize isleaf_val value */
-      if (xasl->isleaf_val)
+      error_code = scan->get_next_pages (thread_p, vpids, count);
+      if (error_code != NO_ERROR || count == 0)
 	{
-	  db_make_int (xasl->isleaf_val, 0);
+	  break;
 	}
-      /* initialize iscycle_val value */
-      if (xasl->iscycle_val)
+
+      for (i = 0; i < count; i++)
 	{
-	  db_make_int (xasl->iscycle_val, 0);
-	}
-    }
+	  if (scan->is_stopped ())
+	    {
+	      goto end;
+	    }
+	  if (logtb_is_interrupted_tran (thread_p, false, &continue_checking, scan->m_tran_index))
+	    {
+	      error_code = ER_INTERRUPTED;
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error_code, 0);
+	      goto end;
+	    }
 
-  return NO_ERROR;
+	  hsidp->curr_oid.volid = vpids[i].volid;
+	  hsidp->curr_oid.pageid = vpids[i].pageid;
+	  hsidp->curr_oid.slotid = NULL_SLOTID;
+	  hsidp->scan_cache.last_vpid = vpids[i];
 
-exit_on_error:
+	  while ((scan_code = scan_next_scan (thread_p, s_id)) == S_SUCCESS)
+	    {
+	      error_code = qexec_parallel_scan_aggregate_row (thread_p, xasl, &worker->xasl_state, &tplrec, gave_up);
+	      if (error_code != NO_ERROR || *gave_up)
+		{
+		  goto end;
+		}
+	    }
+	  if (scan_code == S_ERROR)
+	    {
+	      ASSERT_ERROR_AND_SET (error_code);
+	      goto end;
+	    }
+	}
+    }
 
-  if (xasl->type == BUILDLIST_PROC)
+end:
+  if (hsidp->scan_cache.page_watcher.pgptr != NULL)
     {
-      if (xasl->proc.buildlist.upddel_oid_locator_ehids != NULL)
-	{
-	  qexec_destroy_upddel_ehash_files (thread_p, xasl);
-	}
+      /* pages must be unfixed by the thread that fixed them */
+      pgbuf_ordered_unfix (thread_p, &hsidp->scan_cache.page_watcher);
     }
-  return ER_FAILED;
+  if (tplrec.tpl != NULL)
+    {
+      db_private_free_and_init (thread_p, tplrec.tpl);
+    }
+
+  return error_code;
 }
 
 /*
- * qexec_end_buildvalueblock_iterations () -
- *   return: NO_ERROR or ER_code
- *   xasl(in)   : XASL Tree pointer
- *   xasl_state(in)     : XASL tree state information
- *   tplrec(out) : Tuple record descriptor to store result tuples
- *
- * Note: This routines performs the finish-up operations for BUILDVALUE
- * block iteration.
+ * qexec_parallel_scan_aggregate_row () - aggregate current row of a parallel scan worker
+ *   return: error code
+ *   thread_p(in): thread entry
+ *   xasl(in): XASL tree of the worker
+ *   xasl_state(in): XASL state of the worker
+ *   tplrec(in): tuple record
+ *   gave_up(out): true if the worker cannot aggregate the row
  */
 static int
-qexec_end_buildvalueblock_iterations (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
-				      QFILE_TUPLE_RECORD * tplrec)
+qexec_parallel_scan_aggregate_row (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
+				   QFILE_TUPLE_RECORD * tplrec, bool * gave_up)
 {
-  QFILE_LIST_ID *t_list_id = NULL;
-  int status = NO_ERROR;
-  int ls_flag = 0;
+  BUILDLIST_PROC_NODE *buildlist;
   QPROC_TPLDESCR_STATUS tpldescr_status;
-  DB_LOGICAL ev_res = V_UNKNOWN;
-  QFILE_LIST_ID *output = NULL;
-  QFILE_TUPLE_VALUE_TYPE_LIST type_list;
-  BUILDVALUE_PROC_NODE *buildvalue = &xasl->proc.buildvalue;
+  bool output_tuple = true;
+  int error_code = NO_ERROR;
 
-  /* make final pass on aggregate list nodes */
-  if (buildvalue->agg_list && qdata_finalize_aggregate_list (thread_p, buildvalue->agg_list, false) != NO_ERROR)
+  if (xasl->type == BUILDVALUE_PROC)
     {
-      GOTO_EXIT_ON_ERROR;
+      return qexec_end_one_iteration (thread_p, xasl, xasl_state, tplrec);
     }
 
-  /* evaluate having predicate */
-  if (buildvalue->having_pred != NULL)
+  assert (xasl->type == BUILDLIST_PROC);
+  buildlist = &xasl->proc.buildlist;
+
+  tpldescr_status = qexec_generate_tuple_descriptor (thread_p, xasl->list_id, xasl->outptr_list, &xasl_state->vd);
+  if (tpldescr_status == QPROC_TPLDESCR_FAILURE)
     {
-      ev_res = eval_pred (thread_p, buildvalue->having_pred, &xasl_state->vd, NULL);
-      if (ev_res == V_ERROR)
-	{
-	  GOTO_EXIT_ON_ERROR;
-	}
-      else if (ev_res != V_TRUE
-	       && qdata_set_valptr_list_unbound (thread_p, xasl->outptr_list, &xasl_state->vd) != NO_ERROR)
+      ASSERT_ERROR_AND_SET (error_code);
+      return error_code;
+    }
+  else if (tpldescr_status != QPROC_TPLDESCR_SUCCESS)
+    {
+      /* the row must be written to the list file as it is */
+      *gave_up = true;
+      return NO_ERROR;
+    }
+
+  /* update aggregation domains */
+  if (buildlist->g_agg_list != NULL && !buildlist->g_agg_domains_resolved)
+    {
+      error_code =
+	qexec_resolve_domains_for_aggregation (thread_p, buildlist->g_agg_list, xasl_state, tplrec,
+					       buildlist->g_scan_regu_list, &buildlist->g_agg_domains_resolved);
+      if (error_code != NO_ERROR)
 	{
-	  GOTO_EXIT_ON_ERROR;
+	  return error_code;
 	}
     }
 
-  /* a list of one tuple with a single value needs to be produced */
-  if (qdata_get_valptr_type_list (thread_p, xasl->outptr_list, &type_list) != NO_ERROR)
+  error_code =
+    qexec_hash_gby_agg_tuple (thread_p, xasl, xasl_state, buildlist, tplrec, &xasl->list_id->tpl_descr,
+			      xasl->list_id, &output_tuple);
+  if (error_code != NO_ERROR)
     {
-      GOTO_EXIT_ON_ERROR;
+      return error_code;
     }
 
-  /* If BUILDVALUE_PROC does not have 'order by'(xasl->orderby_list), then the list file to be open at here will be the
-   * last one. Otherwise, the last list file will be open at qexec_orderby_distinct(). (Note that only one that can
-   * have 'group by' is BUILDLIST_PROC type.) And, the top most XASL is the other condition for the list file to be the
-   * last result file. */
-  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_ALL);
-  if (XASL_IS_FLAGED (xasl, XASL_TOP_MOST_XASL) && XASL_IS_FLAGED (xasl, XASL_TO_BE_CACHED)
-      && (xasl->orderby_list == NULL || XASL_IS_FLAGED (xasl, XASL_SKIP_ORDERBY_LIST)) && xasl->option != Q_DISTINCT)
+  if (buildlist->agg_hash_context->state == HS_REJECT_ALL)
     {
-      QFILE_SET_FLAG (ls_flag, QFILE_FLAG_RESULT_FILE);
+      /* the groups do not fit in memory or the rows are hardly grouped */
+      *gave_up = true;
     }
-  t_list_id = qfile_open_list (thread_p, &type_list, NULL, xasl_state->query_id, ls_flag);
-  if (t_list_id == NULL)
+
+  return NO_ERROR;
+}
+
+/*
+ * qexec_parallel_scan_merge () - merge partial aggregates of parallel scan workers into XASL tree
+ *   return: error code
+ *   thread_p(in): thread entry
+ *   xasl(in): XASL tree of the query
+ *   xasl_state(in): XASL state of the query
+ *   workers(in): parallel scan workers
+ *   worker_count(in): number of workers
+ *
+ * Note: Afterwards, the XASL tree is in the state it would be if it had scanned the heap itself.
+ */
+static int
+qexec_parallel_scan_merge (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
+			   QEXEC_PARALLEL_SCAN_WORKER * workers, int worker_count)
+{
+  AGGREGATE_TYPE *agg_list, *agg_p, *worker_agg_p;
+  XASL_NODE *worker_xasl;
+  REGU_VARIABLE_LIST regu_p, worker_regu_p;
+  int *domains_resolved;
+  int i, error_code = NO_ERROR;
+
+  if (xasl->type == BUILDLIST_PROC)
     {
-      if (type_list.domp)
+      agg_list = xasl->proc.buildlist.g_agg_list;
+      domains_resolved = &xasl->proc.buildlist.g_agg_domains_resolved;
+    }
+  else
+    {
+      agg_list = xasl->proc.buildvalue.agg_list;
+      domains_resolved = &xasl->proc.buildvalue.agg_domains_resolved;
+    }
+
+  /* aggregate domains are resolved by the workers that found values */
+  for (i = 0; i < worker_count; i++)
+    {
+      worker_xasl = workers[i].clone.xasl;
+      worker_agg_p =
+	(worker_xasl->type == BUILDLIST_PROC) ? worker_xasl->proc.buildlist.g_agg_list :
+	worker_xasl->proc.buildvalue.agg_list;
+
+      for (agg_p = agg_list; agg_p != NULL; agg_p = agg_p->next, worker_agg_p = worker_agg_p->next)
 	{
-	  db_private_free_and_init (thread_p, type_list.domp);
+	  if ((agg_p->accumulator_domain.value_dom == NULL || agg_p->accumulator_domain.value2_dom == NULL)
+	      && worker_agg_p->accumulator_domain.value_dom != NULL
+	      && worker_agg_p->accumulator_domain.value2_dom != NULL)
+	    {
+	      agg_p->domain = worker_agg_p->domain;
+	      agg_p->opr_dbtype = worker_agg_p->opr_dbtype;
+	      agg_p->accumulator_domain = worker_agg_p->accumulator_domain;
+	    }
 	}
-      GOTO_EXIT_ON_ERROR;
     }
 
-      /***** WHAT IN THE WORLD IS THIS? *****/
-  if (type_list.domp)
+  *domains_resolved = 1;
+  for (agg_p = agg_list; agg_p != NULL; agg_p = agg_p->next)
     {
-      db_private_free_and_init (thread_p, type_list.domp);
+      if (agg_p->accumulator_domain.value_dom == NULL || agg_p->accumulator_domain.value2_dom == NULL)
+	{
+	  *domains_resolved = 0;
+	}
     }
 
-  if (qfile_copy_list_id (xasl->list_id, t_list_id, true) != NO_ERROR)
+  if (xasl->type == BUILDVALUE_PROC)
     {
-      GOTO_EXIT_ON_ERROR;
+      for (i = 0; i < worker_count; i++)
+	{
+	  worker_agg_p = workers[i].clone.xasl->proc.buildvalue.agg_list;
+	  for (agg_p = agg_list; agg_p != NULL; agg_p = agg_p->next, worker_agg_p = worker_agg_p->next)
+	    {
+	      error_code =
+		qdata_aggregate_accumulator_to_accumulator (thread_p, &agg_p->accumulator, &agg_p->accumulator_domain,
+							    agg_p->function, agg_p->domain,
+							    &worker_agg_p->accumulator);
+	      if (error_code != NO_ERROR)
+		{
+		  return error_code;
+		}
+	    }
+	}
+
+      /* resolve domains for aggregates */
+      qexec_resolve_domains_for_buildvalue_outptr (xasl);
+      return NO_ERROR;
     }
 
-  output = xasl->list_id;
-  QFILE_FREE_AND_INIT_LIST_ID (t_list_id);
+  assert (xasl->type == BUILDLIST_PROC);
 
-  if (buildvalue->having_pred == NULL || ev_res == V_TRUE)
+  /* output list domains are resolved by the workers that generated tuples */
+  for (i = 0; i < worker_count; i++)
     {
-      tpldescr_status = qexec_generate_tuple_descriptor (thread_p, xasl->list_id, xasl->outptr_list, &xasl_state->vd);
-      if (tpldescr_status == QPROC_TPLDESCR_FAILURE)
+      worker_xasl = workers[i].clone.xasl;
+      if (worker_xasl->proc.buildlist.agg_hash_context->tuple_count == 0)
 	{
-	  GOTO_EXIT_ON_ERROR;
+	  continue;
 	}
 
-      switch (tpldescr_status)
+      worker_regu_p = worker_xasl->outptr_list->valptrp;
+      for (regu_p = xasl->outptr_list->valptrp; regu_p != NULL; regu_p = regu_p->next, worker_regu_p = worker_regu_p->next)
 	{
-	case QPROC_TPLDESCR_SUCCESS:
-	  /* build tuple into the list file page */
-	  if (qfile_generate_tuple_into_list (thread_p, xasl->list_id, T_NORMAL) != NO_ERROR)
+	  if (TP_DOMAIN_TYPE (regu_p->value.domain) == DB_TYPE_VARIABLE
+	      || TP_DOMAIN_COLLATION_FLAG (regu_p->value.domain) != TP_DOMAIN_COLL_NORMAL)
 	    {
-	      GOTO_EXIT_ON_ERROR;
+	      regu_p->value.domain = worker_regu_p->value.domain;
 	    }
-	  break;
+	}
 
-	case QPROC_TPLDESCR_RETRY_SET_TYPE:
-	case QPROC_TPLDESCR_RETRY_BIG_REC:
-	  if (tplrec->tpl == NULL)
+      if (!xasl->list_id->is_domain_resolved)
+	{
+	  error_code = qfile_update_domains_on_type_list (thread_p, xasl->list_id, xasl->outptr_list);
+	  if (error_code != NO_ERROR)
 	    {
-	      /* allocate tuple descriptor */
-	      tplrec->size = DB_PAGESIZE;
-	      tplrec->tpl = (QFILE_TUPLE) db_private_alloc (thread_p, DB_PAGESIZE);
-	      if (tplrec->tpl == NULL)
-		{
-		  GOTO_EXIT_ON_ERROR;
-		}
+	      return error_code;
 	    }
-	  if (qdata_copy_valptr_list_to_tuple (thread_p, xasl->outptr_list, &xasl_state->vd, tplrec) != NO_ERROR)
+	}
+      break;
+    }
+
+  for (i = 0; i < worker_count; i++)
+    {
+      error_code = qexec_parallel_scan_merge_groups (thread_p, xasl, xasl_state, workers[i].clone.xasl);
+      if (error_code != NO_ERROR)
+	{
+	  return error_code;
+	}
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * qexec_parallel_scan_merge_groups () - merge aggregate hash table of a parallel scan worker into hash table of query
+ *   return: error code
+ *   thread_p(in): thread entry
+ *   xasl(in): XASL tree of the query
+ *   xasl_state(in): XASL state of the query
+ *   worker_xasl(in): XASL tree of the worker
+ *
+ * Note: The first tuple of a group is not aggregated until the group is output. A group that is new to the query
+ *       keeps the first tuple of the worker; otherwise the first tuple of the worker is aggregated now.
+ */
+static int
+qexec_parallel_scan_merge_groups (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
+				  XASL_NODE * worker_xasl)
+{
+  BUILDLIST_PROC_NODE *proc = &xasl->proc.buildlist;
+  AGGREGATE_HASH_CONTEXT *context = proc->agg_hash_context;
+  AGGREGATE_HASH_KEY *key, *worker_key;
+  AGGREGATE_HASH_VALUE *value, *worker_value;
+  AGGREGATE_TYPE *agg_p;
+  HENTRY_PTR hentry;
+  UINT64 mem_limit = context->mem_limit;
+  bool is_new_group;
+  int i, error_code = NO_ERROR;
+
+  for (hentry = worker_xasl->proc.buildlist.agg_hash_context->hash_table->act_head; hentry != NULL;
+       hentry = hentry->act_next)
+    {
+      worker_key = (AGGREGATE_HASH_KEY *) hentry->key;
+      worker_value = (AGGREGATE_HASH_VALUE *) hentry->data;
+
+      value = (AGGREGATE_HASH_VALUE *) mht_get (context->hash_table, (void *) worker_key);
+      is_new_group = (value == NULL);
+      if (is_new_group)
+	{
+	  key = qdata_copy_agg_hkey (thread_p, worker_key);
+	  if (key == NULL)
 	    {
-	      GOTO_EXIT_ON_ERROR;
+	      ASSERT_ERROR_AND_SET (error_code);
+	      return error_code;
 	    }
-	  if (qfile_add_tuple_to_list (thread_p, xasl->list_id, tplrec->tpl) != NO_ERROR)
+
+	  value = qdata_alloc_agg_hvalue (thread_p, proc->g_func_count, proc->g_agg_list);
+	  if (value == NULL)
 	    {
-	      GOTO_EXIT_ON_ERROR;
+	      qdata_free_agg_hkey (thread_p, key);
+	      ASSERT_ERROR_AND_SET (error_code);
+	      return error_code;
 	    }
-	  break;
 
-	default:
-	  break;
-	}
-    }
+	  value->first_tuple.size = worker_value->first_tuple.size;
+	  value->first_tuple.tpl = (QFILE_TUPLE) db_private_alloc (thread_p, value->first_tuple.size);
+	  if (value->first_tuple.tpl == NULL)
+	    {
+	      qdata_free_agg_hkey (thread_p, key);
+	      qdata_free_agg_hvalue (thread_p, value);
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+		      (size_t) worker_value->first_tuple.size);
+	      return ER_OUT_OF_VIRTUAL_MEMORY;
+	    }
+	  memcpy (value->first_tuple.tpl, worker_value->first_tuple.tpl, worker_value->first_tuple.size);
 
-end:
+	  mht_put (context->hash_table, (void *) key, (void *) value);
 
-  QEXEC_CLEAR_AGG_LIST_VALUE (buildvalue->agg_list);
-  if (t_list_id)
-    {
-      QFILE_FREE_AND_INIT_LIST_ID (t_list_id);
-    }
-  if (output)
-    {
-      qfile_close_list (thread_p, output);
-    }
+	  context->tuple_count++;
+	  context->group_count++;
+	  context->hash_size += qdata_get_agg_hkey_size (key);
+	}
+      else
+	{
+	  /* aggregate first tuple of the worker group */
+	  error_code =
+	    fetch_val_list (thread_p, proc->g_regu_list, &xasl_state->vd, NULL, NULL, worker_value->first_tuple.tpl,
+			    PEEK);
+	  if (error_code == NO_ERROR)
+	    {
+	      error_code = qdata_evaluate_aggregate_list (thread_p, proc->g_agg_list, &xasl_state->vd,
+							  value->accumulators);
+	    }
+	  if (error_code != NO_ERROR)
+	    {
+	      return error_code;
+	    }
+
+	  value->tuple_count++;
+	  context->tuple_count++;
+	}
 
-  return status;
+      for (agg_p = proc->g_agg_list, i = 0; agg_p != NULL; agg_p = agg_p->next, i++)
+	{
+	  error_code =
+	    qdata_aggregate_accumulator_to_accumulator (thread_p, &value->accumulators[i], &agg_p->accumulator_domain,
+							agg_p->function, agg_p->domain, &worker_value->accumulators[i]);
+	  if (error_code != NO_ERROR)
+	    {
+	      return error_code;
+	    }
+	}
+      value->tuple_count += worker_value->tuple_count;
+      context->tuple_count += worker_value->tuple_count;
+      context->hash_size += qdata_get_agg_hvalue_size (value, !is_new_group);
 
-exit_on_error:
+      /* keep hash table within memory limit */
+      error_code = qexec_hash_gby_keep_memory_limit (thread_p, context, xasl->list_id, mem_limit);
+      if (error_code != NO_ERROR)
+	{
+	  return error_code;
+	}
+    }
 
-  status = ER_FAILED;
-  goto end;
+  return NO_ERROR;
 }
 
 /*
- * qexec_end_mainblock_iterations () -
- *   return: NO_ERROR, or ER_code
- *   xasl(in)   : XASL Tree pointer
- *   xasl_state(in)     : XASL tree state information
- *   tplrec(out) : Tuple record descriptor to store result tuples
+ * qexec_parallel_heap_scan () - scan heap of an aggregate query with parallel workers
+ *   return: true if the heap was scanned, false if it must be scanned serially
+ *   thread_p(in): thread entry
+ *   xasl(in): XASL tree
+ *   xasl_state(in): XASL state
+ *   qp_scan(out): S_SUCCESS, or S_ERROR if the heap was scanned with errors
  *
- * Note: This routines performs the finish-up operations for a main
- * procedure block iteration. The main procedure block nodes can
- * be of type BUILDLIST_PROC, BUILDVALUE, UNION_PROC,
- * DIFFERENCE_PROC and INTERSECTION_PROC.
+ * Note: Each worker aggregates the rows of the heap pages it takes with its own XASL clone; the query thread is one of
+ *       the workers. The partial aggregates are merged into the XASL tree afterwards. Workers never write list files;
+ *       if the groups of a worker do not fit in memory, the parallel scan is given up and the heap is scanned serially.
  */
-static int
-qexec_end_mainblock_iterations (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
-				QFILE_TUPLE_RECORD * tplrec)
+static bool
+qexec_parallel_heap_scan (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state, SCAN_CODE * qp_scan)
 {
-  QFILE_LIST_ID *t_list_id = NULL;
-  int status = NO_ERROR;
-  bool distinct_needed;
-  int ls_flag = 0;
+  QMGR_QUERY_ENTRY *query_p;
+  QEXEC_PARALLEL_SCAN_WORKER *workers;
+  qexec_parallel_scan_task *task;
+  int tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
+  int worker_count, i;
+  int error_code = NO_ERROR;
+  bool is_scanned = false;
 
-  distinct_needed = (xasl->option == Q_DISTINCT) ? true : false;
+  worker_count = qexec_parallel_scan_worker_count (thread_p, xasl);
+  if (worker_count == 0)
+    {
+      return false;
+    }
 
-#if defined (ENABLE_COMPOSITE_LOCK)
-  /* Acquire the lockset if composite locking is enabled. */
-  if ((COMPOSITE_LOCK (xasl->scan_op_type) || QEXEC_IS_MULTI_TABLE_UPDATE_DELETE (xasl))
-      && (!XASL_IS_FLAGED (xasl, XASL_MULTI_UPDATE_AGG)))
+  query_p = qmgr_get_query_entry (thread_p, xasl_state->query_id, tran_index);
+  if (query_p == NULL || query_p->xasl_ent == NULL)
     {
-      if (lock_finalize_composite_lock (thread_p, &xasl->composite_lock) != LK_GRANTED)
-	{
-	  return ER_FAILED;
-	}
+      /* workers need the XASL stream to load their clones */
+      er_clear ();
+      return false;
     }
-#endif /* defined (ENABLE_COMPOSITE_LOCK) */
 
-  switch (xasl->type)
+  workers = (QEXEC_PARALLEL_SCAN_WORKER *) db_private_alloc (thread_p, worker_count * sizeof (*workers));
+  if (workers == NULL)
     {
+      er_clear ();
+      return false;
+    }
+  memset (workers, 0, worker_count * sizeof (*workers));
 
-    case BUILDLIST_PROC:	/* end BUILDLIST_PROC iterations */
-      /* Destroy the extendible hash files for SELECT statement generated for UPDATE/DELETE */
-      if (xasl->proc.buildlist.upddel_oid_locator_ehids != NULL)
-	{
-	  qexec_destroy_upddel_ehash_files (thread_p, xasl);
-	}
-      /* fall through */
-    case CONNECTBY_PROC:
-    case BUILD_SCHEMA_PROC:
-      /* close the list file */
-      qfile_close_list (thread_p, xasl->list_id);
-      break;
+  // *INDENT-OFF*
+  qexec_parallel_scan scan (ACCESS_SPEC_HFID (xasl->spec_list), tran_index, thread_p->conn_entry);
+  // *INDENT-ON*
 
-    case MERGELIST_PROC:
-      /* do a direct list file merge to generate resultant list file */
-      if (qexec_merge_listfiles (thread_p, xasl, xasl_state) != NO_ERROR)
+  for (i = 0; i < worker_count; i++)
+    {
+      error_code = qexec_parallel_scan_worker_start (thread_p, xasl_state, query_p->xasl_ent, &workers[i]);
+      if (error_code != NO_ERROR)
 	{
-	  GOTO_EXIT_ON_ERROR;
+	  goto end;
 	}
-      break;
-
-    case BUILDVALUE_PROC:	/* end BUILDVALUE_PROC iterations */
-      status = qexec_end_buildvalueblock_iterations (thread_p, xasl, xasl_state, tplrec);
-      break;
+    }
 
-    case UNION_PROC:
-    case DIFFERENCE_PROC:
-    case INTERSECTION_PROC:
-      if (xasl->type == UNION_PROC)
-	{
-	  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_UNION);
-	}
-      else if (xasl->type == DIFFERENCE_PROC)
-	{
-	  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_DIFFERENCE);
-	}
-      else
+  /* the pool may be busy with other queries; tasks it refuses are executed by this thread */
+  for (i = 1; i < worker_count; i++)
+    {
+      task = new qexec_parallel_scan_task (scan, workers[i]);
+      scan.start_task ();
+      if (!cubthread::get_manager ()->try_task (*thread_p, qexec_Parallel_scan_workers, task))
 	{
-	  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_INTERSECT);
+	  task->execute (*thread_p);
+	  task->retire ();
 	}
+    }
+  task = new qexec_parallel_scan_task (scan, workers[0]);
+  scan.start_task ();
+  task->execute (*thread_p);
+  task->retire ();
 
-      if (distinct_needed)
-	{
-	  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_DISTINCT);
-	}
-      else
+  scan.wait_for_tasks ();
+
+  if (scan.is_stopped ())
+    {
+      if (scan.get_error () == ER_INTERRUPTED)
 	{
-	  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_ALL);
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_INTERRUPTED, 0);
+	  *qp_scan = S_ERROR;
+	  is_scanned = true;
 	}
+      /* otherwise the serial scan reports the error again, if it is not caused by the parallel scan */
+      goto end;
+    }
 
-      /* For UNION_PROC, DIFFERENCE_PROC, and INTERSECTION_PROC, if they do not have 'order by'(xasl->orderby_list),
-       * then the list file to be open at here will be the last one. Otherwise, the last list file will be open at
-       * qexec_groupby() or qexec_orderby_distinct(). (Note that only one that can have 'group by' is BUILDLIST_PROC
-       * type.) And, the top most XASL is the other condition for the list file to be the last result file. */
+  error_code = qexec_parallel_scan_merge (thread_p, xasl, xasl_state, workers, worker_count);
+  *qp_scan = (error_code == NO_ERROR) ? S_SUCCESS : S_ERROR;
+  is_scanned = true;
 
-      if (XASL_IS_FLAGED (xasl, XASL_TOP_MOST_XASL) && XASL_IS_FLAGED (xasl, XASL_TO_BE_CACHED)
-	  && (xasl->orderby_list == NULL || XASL_IS_FLAGED (xasl, XASL_SKIP_ORDERBY_LIST)))
-	{
-	  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_RESULT_FILE);
-	}
+end:
+  for (i = 0; i < worker_count; i++)
+    {
+      qexec_parallel_scan_worker_end (thread_p, &workers[i]);
+    }
+  db_private_free (thread_p, workers);
 
-      t_list_id =
-	qfile_combine_two_list (thread_p, xasl->proc.union_.left->list_id, xasl->proc.union_.right->list_id, ls_flag);
-      distinct_needed = false;
-      if (!t_list_id)
-	{
-	  GOTO_EXIT_ON_ERROR;
-	}
-      if (qfile_copy_list_id (xasl->list_id, t_list_id, true) != NO_ERROR)
-	{
-	  GOTO_EXIT_ON_ERROR;
-	}
-      QFILE_FREE_AND_INIT_LIST_ID (t_list_id);
-      break;
+  if (!is_scanned)
+    {
+      er_clear ();
+    }
+  return is_scanned;
+}
+#endif /* SERVER_MODE */
 
-    case CTE_PROC:
-      /* close the list file */
-      qfile_close_list (thread_p, xasl->list_id);
-      break;
+/*
+ * qexec_is_single_class_heap_scan () - check that XASL is a top-most selection over the sequential scan of one class
+ *   return: true if it is
+ *   xasl(in): XASL tree
+ *
+ * Note: Nothing but the scan may produce or filter the rows: the XASL has no subqueries, path expressions, inst_num
+ *       or predicates outside the scan.
+ */
+static bool
+qexec_is_single_class_heap_scan (XASL_NODE * xasl)
+{
+  ACCESS_SPEC_TYPE *spec = xasl->spec_list;
 
-    default:
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_XASLNODE, 0);
-      GOTO_EXIT_ON_ERROR;
-    }				/* switch */
+  if (!XASL_IS_FLAGED (xasl, XASL_TOP_MOST_XASL) || XASL_IS_FLAGED (xasl, XASL_HAS_CONNECT_BY)
+      || XASL_IS_FLAGED (xasl, XASL_NEED_SINGLE_TUPLE_SCAN) || xasl->scan_op_type != S_SELECT
+      || QEXEC_IS_MULTI_TABLE_UPDATE_DELETE (xasl))
+    {
+      return false;
+    }
 
-  /* DISTINCT processing (i.e, duplicates elimination) is performed at qexec_orderby_distinct() after GROUP BY
-   * processing */
+  if (xasl->aptr_list != NULL || xasl->dptr_list != NULL || xasl->scan_ptr != NULL || xasl->bptr_list != NULL
+      || xasl->fptr_list != NULL || xasl->merge_spec != NULL || xasl->connect_by_ptr != NULL
+      || xasl->if_pred != NULL || xasl->after_join_pred != NULL || xasl->instnum_val != NULL
+      || xasl->instnum_pred != NULL || xasl->selected_upd_list != NULL || xasl->topn_items != NULL)
+    {
+      return false;
+    }
 
-success:
-  if (t_list_id)
+  if (spec == NULL || spec->next != NULL || spec->type != TARGET_CLASS || spec->access != ACCESS_METHOD_SEQUENTIAL
+      || spec->pruning_type != DB_NOT_PARTITIONED_CLASS || (spec->flags & ACCESS_SPEC_FLAG_FOR_UPDATE)
+      || spec->single_fetch != QPROC_NO_SINGLE_INNER || spec->grouped_scan
+      || mvcc_is_mvcc_disabled_class (&ACCESS_SPEC_CLS_OID (spec)))
     {
-      QFILE_FREE_AND_INIT_LIST_ID (t_list_id);
+      return false;
     }
-  return status;
 
-exit_on_error:
-  status = ER_FAILED;
-  goto success;
+  if (spec->s_id.type != S_HEAP_SCAN || spec->s_id.scan_immediately_stop || spec->s_id.mvcc_select_lock_needed)
+    {
+      return false;
+    }
 
+  return true;
 }
 
 /*
- * qexec_clear_mainblock_iterations () -
- *   return:
- *   xasl(in)   : XASL Tree pointer
+ * qexec_batch_heap_scan () - scan heap of an aggregate query in batches of rows
+ *   return: true if the heap was scanned, false if it must be scanned row by row
+ *   thread_p(in): thread entry
+ *   xasl(in): XASL tree
+ *   xasl_state(in): XASL state
+ *   qp_scan(out): S_SUCCESS, or S_ERROR if the heap was scanned with errors
+ *
+ * Note: The scan decodes the columns of up to heap_scan_batch_size rows at a time and selects the qualified rows in
+ *       one pass over the columns of the predicate. Once the domains of the aggregate functions are resolved, the
+ *       functions consume the selected rows from the columns. Before that, or if the accumulator of a function does
+ *       not have the type of its column, each selected row is loaded into the value list and aggregated as usual.
  */
-static void
-qexec_clear_mainblock_iterations (THREAD_ENTRY * thread_p, XASL_NODE * xasl)
+static bool
+qexec_batch_heap_scan (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state, SCAN_CODE * qp_scan)
 {
-  AGGREGATE_TYPE *agg_p;
+  BUILDVALUE_PROC_NODE *buildvalue = &xasl->proc.buildvalue;
+  QFILE_TUPLE_RECORD tplrec = { NULL, 0 };
+  SCAN_BATCH batch;
+  SCAN_ID *s_id;
+  SCAN_CODE xb_scan, ls_scan;
+  int batch_size, i;
+  bool domains_checked = false;
+  bool use_batch_aggregate = false;
 
-  switch (xasl->type)
+  batch_size = prm_get_integer_value (PRM_ID_HEAP_SCAN_BATCH_SIZE);
+  if (batch_size <= 0 || thread_is_on_trace (thread_p) || xasl->type != BUILDVALUE_PROC
+      || buildvalue->agg_list == NULL || buildvalue->is_always_false || !qexec_is_single_class_heap_scan (xasl))
     {
-    case BUILDLIST_PROC:
-      /* Destroy the extendible hash files for SELECT statement generated for UPDATE/DELETE */
-      if (xasl->proc.buildlist.upddel_oid_locator_ehids != NULL)
+      return false;
+    }
+
+  s_id = &xasl->spec_list->s_id;
+  if (!scan_init_heap_batch (thread_p, s_id, batch_size, &batch))
+    {
+      er_clear ();
+      return false;
+    }
+
+  if (!qdata_is_aggregate_batch_supported (buildvalue->agg_list, &batch, false))
+    {
+      scan_clear_heap_batch (thread_p, &batch);
+      return false;
+    }
+
+  *qp_scan = S_SUCCESS;
+
+  while ((xb_scan = qexec_next_scan_block_iterations (thread_p, xasl)) == S_SUCCESS)
+    {
+      while ((ls_scan = scan_next_heap_batch (thread_p, s_id, &batch)) == S_SUCCESS)
 	{
-	  qexec_destroy_upddel_ehash_files (thread_p, xasl);
+	  for (i = 0; i < batch.sel_count && !use_batch_aggregate; i++)
+	    {
+	      if (buildvalue->agg_domains_resolved && !domains_checked)
+		{
+		  domains_checked = true;
+		  use_batch_aggregate = qdata_is_aggregate_batch_supported (buildvalue->agg_list, &batch, true);
+		  if (use_batch_aggregate)
+		    {
+		      break;
+		    }
+		}
+
+	      scan_load_heap_batch_row (&batch, batch.selection[i]);
+	      if (qexec_end_one_iteration (thread_p, xasl, xasl_state, &tplrec) != NO_ERROR)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+	    }
+
+	  if (use_batch_aggregate && qdata_evaluate_aggregate_batch (thread_p, buildvalue->agg_list, &batch, i) != NO_ERROR)
+	    {
+	      GOTO_EXIT_ON_ERROR;
+	    }
 	}
-      /* fall through */
-    case CONNECTBY_PROC:
-      qfile_close_list (thread_p, xasl->list_id);
-      break;
 
-    case BUILDVALUE_PROC:
-      for (agg_p = xasl->proc.buildvalue.agg_list; agg_p != NULL; agg_p = agg_p->next)
+      if (ls_scan != S_END)
 	{
-	  qfile_close_list (thread_p, agg_p->list_id);
-	  qfile_destroy_list (thread_p, agg_p->list_id);
+	  GOTO_EXIT_ON_ERROR;
 	}
-      break;
-
-    case UNION_PROC:
-    case DIFFERENCE_PROC:
-    case INTERSECTION_PROC:
-    case OBJFETCH_PROC:
-    case SCAN_PROC:
-    case MERGELIST_PROC:
-    case UPDATE_PROC:
-    case DELETE_PROC:
-    case INSERT_PROC:
-    case DO_PROC:
-    case MERGE_PROC:
-    case BUILD_SCHEMA_PROC:
-    case CTE_PROC:
-      break;
+    }
 
-    default:
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_XASLNODE, 0);
-      break;
+  if (xb_scan != S_END)
+    {
+      GOTO_EXIT_ON_ERROR;
     }
 
-  return;
+  scan_clear_heap_batch (thread_p, &batch);
+  return true;
+
+exit_on_error:
+  scan_clear_heap_batch (thread_p, &batch);
+  *qp_scan = S_ERROR;
+  return true;
 }
 
 /*
@@ -14270,7 +15968,15 @@ qexec_execute_mainblock_internal (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XAS
 	    }
 
 	  /* call the first xasl interpreter function */
-	  qp_scan = (*func_vector[0]) (thread_p, xasl, xasl_state, &tplrec, &func_vector[1]);
+#if defined (SERVER_MODE)
+	  if (!qexec_parallel_heap_scan (thread_p, xasl, xasl_state, &qp_scan))
+#endif /* SERVER_MODE */
+	    {
+	      if (!qexec_batch_heap_scan (thread_p, xasl, xasl_state, &qp_scan))
+		{
+		  qp_scan = (*func_vector[0]) (thread_p, xasl, xasl_state, &tplrec, &func_vector[1]);
+		}
+	    }
 
 	  if (XASL_IS_FLAGED (xasl, XASL_HAS_CONNECT_BY))
 	    {
@@ -14679,6 +16385,7 @@ qexec_execute_query (THREAD_ENTRY * thread_p, xasl_node * xasl, int dbval_cnt, c
 
 #if defined (SERVER_MODE)
   int qlist_enter_count;
+  bool is_arena_pushed;
 #endif // SERVER_MODE
 
 #if defined(ENABLE_SYSTEMTAP)
@@ -14767,6 +16474,12 @@ qexec_execute_query (THREAD_ENTRY * thread_p, xasl_node * xasl, int dbval_cnt, c
   /* this routine should not be called if an outstanding error condition already exists. */
   er_clear ();
 
+#if defined (SERVER_MODE)
+  /* memory that is private to this execution comes from an arena that is released at once at the end; whatever must
+   * live longer (the result list id, the trace, the query entry) is allocated with malloc */
+  is_arena_pushed = db_private_arena_push (thread_p, (size_t) prm_get_bigint_value (PRM_ID_QUERY_ARENA_SIZE));
+#endif // SERVER_MODE
+
 #if defined(ENABLE_SYSTEMTAP)
   tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
   query_str = qmgr_get_query_sql_user_text (thread_p, query_id, tran_index);
@@ -14922,6 +16635,11 @@ qexec_execute_query (THREAD_ENTRY * thread_p, xasl_node * xasl, int dbval_cnt, c
 end:
 
 #if defined (SERVER_MODE)
+  if (is_arena_pushed)
+    {
+      db_private_arena_pop (thread_p);
+    }
+
   if (prm_get_bool_value (PRM_ID_LOG_QUERY_LISTS))
     {
       er_print_callstack (ARG_FILE_LINE, "ending query execution with qlist_count = %d\n", thread_p->m_qlist_count);
@@ -24964,6 +26682,11 @@ qexec_alloc_agg_hash_context (THREAD_ENTRY * thread_p, BUILDLIST_PROC_NODE * pro
   proc->agg_hash_context->tuple_count = 0;
   proc->agg_hash_context->sorted_count = 0;
   proc->agg_hash_context->state = HS_ACCEPT_ALL;
+  proc->agg_hash_context->is_partial = false;
+
+  /* the hash table spills to partial list files once it outgrows its share of the query memory grant */
+  proc->agg_hash_context->mem_limit =
+    qmgr_reserve_query_memory (thread_p, (INT64) prm_get_bigint_value (PRM_ID_MAX_AGG_HASH_SIZE), DB_PAGESIZE);
 
   /* all ok */
   return NO_ERROR;
@@ -25092,6 +26815,10 @@ qexec_free_agg_hash_context (THREAD_ENTRY * thread_p, BUILDLIST_PROC_NODE * proc
   proc->agg_hash_context->hash_size = 0;
   proc->agg_hash_context->group_count = 0;
   proc->agg_hash_context->tuple_count = 0;
+
+  /* give back the reserved memory */
+  qmgr_unreserve_query_memory (thread_p, proc->agg_hash_context->mem_limit);
+  proc->agg_hash_context->mem_limit = 0;
 }
 
 /*
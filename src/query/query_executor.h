@@ -101,4 +101,9 @@ extern int qexec_insert_tuple_into_list (THREAD_ENTRY * thread_p, qfile_list_id
 extern void qexec_replace_prior_regu_vars_prior_expr (THREAD_ENTRY * thread_p, regu_variable_node * regu,
 						      xasl_node * xasl, xasl_node * connect_by_ptr);
 
+#if defined (SERVER_MODE)
+extern void qexec_parallel_scan_workers_init (void);
+extern void qexec_parallel_scan_workers_destroy (void);
+#endif /* SERVER_MODE */
+
 #endif /* _QUERY_EXECUTOR_H_ */
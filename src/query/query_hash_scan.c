@@ -25,6 +25,7 @@
 #include "object_domain.h"
 #include "object_primitive.h"
 #include "object_representation.h"
+#include "query_manager.h"
 #include "query_opfunc.h"
 #include "string_opfunc.h"
 #include "query_hash_scan.h"
@@ -34,6 +35,30 @@
 static bool safe_memcpy (void *data, void *source, int size);
 static DB_VALUE_COMPARE_RESULT qdata_hscan_key_compare (HASH_SCAN_KEY * ckey1, HASH_SCAN_KEY * ckey2, int *diff_pos);
 
+/* file hash table page layout: FHS_PAGE_HEADER followed by an array of FHS_ENTRY */
+typedef struct fhs_page_header FHS_PAGE_HEADER;
+struct fhs_page_header
+{
+  VPID next_vpid;		/* next page of the same bucket */
+  int entry_cnt;		/* number of entries in this page */
+};
+
+typedef struct fhs_entry FHS_ENTRY;
+struct fhs_entry
+{
+  unsigned int hash_val;	/* full hash value of the key, to skip most mismatches without reading the tuple */
+  QFILE_TUPLE_SIMPLE_POS pos;	/* position of the build tuple */
+};
+
+#define FHS_PAGE_ENTRIES_OFFSET DB_ALIGN (sizeof (FHS_PAGE_HEADER), MAX_ALIGNMENT)
+#define FHS_MAX_PAGE_ENTRIES ((int) ((DB_PAGESIZE - FHS_PAGE_ENTRIES_OFFSET) / sizeof (FHS_ENTRY)))
+#define FHS_PAGE_ENTRIES(page) ((FHS_ENTRY *) ((char *) (page) + FHS_PAGE_ENTRIES_OFFSET))
+
+/* hash value range used for the full hash value kept in each entry */
+#define FHS_HASH_RANGE INT_MAX
+/* target fill factor of bucket pages */
+#define FHS_FILL_FACTOR 0.75
+
 /*
  * qdata_alloc_hscan_key () - allocate new hash key
  *   returns: pointer to new structure or NULL on error
@@ -233,6 +258,82 @@ qdata_build_hscan_key (THREAD_ENTRY * thread_p, val_descr * vd, REGU_VARIABLE_LI
   return NO_ERROR;
 }
 
+/*
+ * qdata_build_hscan_key_from_tuple () - build hash key from the join columns of a list file tuple
+ *   returns: NO_ERROR or error code
+ *   tpl(in): list file tuple
+ *   col_indp(in): positions of the key columns in the tuple
+ *   domp(in): domains of the key columns
+ *   coerce_domp(in): domains the values are coerced to, or NULL
+ *   key(out): hash key; the key values must be allocated
+ *   is_unmatched(out): true if the key can not be equal to any key of the other input, either because one of
+ *                      the values is NULL or because it can not be coerced
+ *
+ * Note: Values which are not coerced are peeked from the tuple, so the key is valid only as long as the tuple is.
+ */
+int
+qdata_build_hscan_key_from_tuple (QFILE_TUPLE tpl, int *col_indp, TP_DOMAIN ** domp, TP_DOMAIN ** coerce_domp,
+				  HASH_SCAN_KEY * key, bool * is_unmatched)
+{
+  OR_BUF buf;
+  DB_VALUE dbval;
+  DB_VALUE *valuep;
+  char *valp;
+  int k, len;
+  bool is_set;
+  TP_DOMAIN_STATUS status;
+
+  *is_unmatched = false;
+
+  for (k = 0; k < key->val_count; k++)
+    {
+      pr_clear_value (key->values[k]);
+
+      QFILE_GET_TUPLE_VALUE_HEADER_POSITION (tpl, col_indp[k], valp);
+
+      /* zero length means NULL */
+      len = QFILE_GET_TUPLE_VALUE_LENGTH (valp);
+      if (QFILE_GET_TUPLE_VALUE_FLAG (valp) == V_UNBOUND || len == 0)
+	{
+	  *is_unmatched = true;
+	  return NO_ERROR;
+	}
+
+      valuep = (coerce_domp != NULL && coerce_domp[k] != NULL) ? &dbval : key->values[k];
+      db_make_null (valuep);
+
+      or_init (&buf, valp + QFILE_TUPLE_VALUE_HEADER_SIZE, len);
+      is_set = pr_is_set_type (TP_DOMAIN_TYPE (domp[k])) ? true : false;
+      if (domp[k]->type->data_readval (&buf, valuep, domp[k], -1, is_set, NULL, 0) != NO_ERROR)
+	{
+	  return ER_FAILED;
+	}
+
+      if (DB_IS_NULL (valuep))
+	{
+	  pr_clear_value (valuep);
+	  *is_unmatched = true;
+	  return NO_ERROR;
+	}
+
+      if (valuep == &dbval)
+	{
+	  /* both inputs must share the representation used for hashing. A value out of the range of the other
+	   * domain can not be equal to any value of that domain, so it is not an error but a key without match. */
+	  status = tp_value_coerce (&dbval, key->values[k], coerce_domp[k]);
+	  pr_clear_value (&dbval);
+	  if (status != DOMAIN_COMPATIBLE)
+	    {
+	      pr_clear_value (key->values[k]);
+	      *is_unmatched = true;
+	      return NO_ERROR;
+	    }
+	}
+    }
+
+  return NO_ERROR;
+}
+
 /*
  * qdata_print_hash_scan_entry () - Print the entry
  *                              Will be used by mht_dump() function
@@ -515,3 +616,219 @@ qdata_free_hscan_entry (const void *key, void *data, void *args)
   /* all ok */
   return NO_ERROR;
 }
+
+/*
+ * fhs_create () - create file hash table
+ *   returns: file hash table or NULL on error
+ *   thread_p(in): thread
+ *   query_id(in): query the temp file is created for
+ *   est_entries(in): estimated number of entries
+ *
+ * Note: the number of buckets is chosen so that a bucket fits in one page on average. Only the directory of
+ *       buckets is kept in memory; the entries themselves are kept in temp file pages, which may be spilled to disk
+ *       by the page buffer.
+ */
+FHS_TABLE *
+fhs_create (THREAD_ENTRY * thread_p, QUERY_ID query_id, int est_entries)
+{
+  FHS_TABLE *ht;
+  unsigned int i;
+
+  ht = (FHS_TABLE *) db_private_alloc (thread_p, sizeof (FHS_TABLE));
+  if (ht == NULL)
+    {
+      return NULL;
+    }
+
+  ht->query_id = query_id;
+  ht->nentries = 0;
+  ht->found = NULL;
+  ht->found_cnt = 0;
+  ht->found_size = 0;
+  ht->nbuckets = (unsigned int) (MAX (est_entries, 1) / (FHS_MAX_PAGE_ENTRIES * FHS_FILL_FACTOR)) + 1;
+
+  ht->bucket_vpids = (VPID *) db_private_alloc (thread_p, ht->nbuckets * sizeof (VPID));
+  if (ht->bucket_vpids == NULL)
+    {
+      db_private_free_and_init (thread_p, ht);
+      return NULL;
+    }
+  for (i = 0; i < ht->nbuckets; i++)
+    {
+      VPID_SET_NULL (&ht->bucket_vpids[i]);
+    }
+
+  ht->tfile_vfid = qmgr_create_new_temp_file (thread_p, query_id, TEMP_FILE_MEMBUF_NORMAL);
+  if (ht->tfile_vfid == NULL)
+    {
+      db_private_free_and_init (thread_p, ht->bucket_vpids);
+      db_private_free_and_init (thread_p, ht);
+      return NULL;
+    }
+
+  return ht;
+}
+
+/*
+ * fhs_destroy () - destroy file hash table and its temp file
+ *   returns:
+ *   thread_p(in): thread
+ *   ht(in): file hash table
+ */
+void
+fhs_destroy (THREAD_ENTRY * thread_p, FHS_TABLE * ht)
+{
+  if (ht == NULL)
+    {
+      return;
+    }
+
+  if (ht->tfile_vfid != NULL)
+    {
+      qmgr_free_list_temp_file (thread_p, ht->query_id, ht->tfile_vfid);
+      ht->tfile_vfid = NULL;
+    }
+  if (ht->bucket_vpids != NULL)
+    {
+      db_private_free_and_init (thread_p, ht->bucket_vpids);
+    }
+  if (ht->found != NULL)
+    {
+      db_private_free_and_init (thread_p, ht->found);
+    }
+  db_private_free_and_init (thread_p, ht);
+}
+
+/*
+ * fhs_insert () - insert tuple position into file hash table
+ *   returns: error code or NO_ERROR
+ *   thread_p(in): thread
+ *   ht(in): file hash table
+ *   key(in): build key of the tuple
+ *   pos(in): tuple position
+ *
+ * Note: when the first page of the bucket is full, a new page is linked in front of it.
+ */
+int
+fhs_insert (THREAD_ENTRY * thread_p, FHS_TABLE * ht, HASH_SCAN_KEY * key, QFILE_TUPLE_SIMPLE_POS * pos)
+{
+  unsigned int hash_val, bucket;
+  PAGE_PTR page;
+  FHS_PAGE_HEADER *header;
+  FHS_ENTRY *entry;
+  VPID new_vpid;
+  int error;
+
+  hash_val = qdata_hash_scan_key (key, FHS_HASH_RANGE);
+  bucket = hash_val % ht->nbuckets;
+
+  page = NULL;
+  if (!VPID_ISNULL (&ht->bucket_vpids[bucket]))
+    {
+      page = qmgr_get_old_page (thread_p, &ht->bucket_vpids[bucket], ht->tfile_vfid);
+      if (page == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error);
+	  return error;
+	}
+      if (((FHS_PAGE_HEADER *) page)->entry_cnt >= FHS_MAX_PAGE_ENTRIES)
+	{
+	  qmgr_free_old_page_and_init (thread_p, page, ht->tfile_vfid);
+	}
+    }
+
+  if (page == NULL)
+    {
+      /* empty bucket or full first page */
+      page = qmgr_get_new_page (thread_p, &new_vpid, ht->tfile_vfid);
+      if (page == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error);
+	  return error;
+	}
+      header = (FHS_PAGE_HEADER *) page;
+      header->next_vpid = ht->bucket_vpids[bucket];
+      header->entry_cnt = 0;
+      ht->bucket_vpids[bucket] = new_vpid;
+    }
+
+  header = (FHS_PAGE_HEADER *) page;
+  entry = FHS_PAGE_ENTRIES (page) + header->entry_cnt;
+  entry->hash_val = hash_val;
+  entry->pos = *pos;
+  header->entry_cnt++;
+  ht->nentries++;
+
+  qmgr_set_dirty_page (thread_p, page, FREE, NULL, ht->tfile_vfid);
+
+  return NO_ERROR;
+}
+
+/*
+ * fhs_search () - collect positions of the tuples whose hash value matches the key
+ *   returns: error code or NO_ERROR
+ *   thread_p(in): thread
+ *   ht(in): file hash table
+ *   key(in): probe key
+ *
+ * Note: results are stored in ht->found and ht->found_cnt, in no particular order. Since only hash values are
+ *       compared, the caller must still check the tuples for equality.
+ */
+int
+fhs_search (THREAD_ENTRY * thread_p, FHS_TABLE * ht, HASH_SCAN_KEY * key)
+{
+  unsigned int hash_val;
+  PAGE_PTR page;
+  FHS_PAGE_HEADER *header;
+  FHS_ENTRY *entries;
+  QFILE_TUPLE_SIMPLE_POS *new_found;
+  VPID vpid;
+  int i, new_size, error;
+
+  ht->found_cnt = 0;
+
+  hash_val = qdata_hash_scan_key (key, FHS_HASH_RANGE);
+  vpid = ht->bucket_vpids[hash_val % ht->nbuckets];
+
+  while (!VPID_ISNULL (&vpid))
+    {
+      page = qmgr_get_old_page (thread_p, &vpid, ht->tfile_vfid);
+      if (page == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error);
+	  return error;
+	}
+
+      header = (FHS_PAGE_HEADER *) page;
+      entries = FHS_PAGE_ENTRIES (page);
+      for (i = 0; i < header->entry_cnt; i++)
+	{
+	  if (entries[i].hash_val != hash_val)
+	    {
+	      continue;
+	    }
+
+	  if (ht->found_cnt >= ht->found_size)
+	    {
+	      new_size = MAX (ht->found_size * 2, 16);
+	      new_found =
+		(QFILE_TUPLE_SIMPLE_POS *) db_private_realloc (thread_p, ht->found,
+							       new_size * sizeof (QFILE_TUPLE_SIMPLE_POS));
+	      if (new_found == NULL)
+		{
+		  qmgr_free_old_page_and_init (thread_p, page, ht->tfile_vfid);
+		  ASSERT_ERROR_AND_SET (error);
+		  return error;
+		}
+	      ht->found = new_found;
+	      ht->found_size = new_size;
+	    }
+	  ht->found[ht->found_cnt++] = entries[i].pos;
+	}
+
+      vpid = header->next_vpid;
+      qmgr_free_old_page_and_init (thread_p, page, ht->tfile_vfid);
+    }
+
+  return NO_ERROR;
+}
@@ -47,7 +47,7 @@ enum hash_method
   HASH_METH_NOT_USE = 0,
   HASH_METH_IN_MEM = 1,
   HASH_METH_HYBRID = 2,
-  HASH_METH_HASH_FILE = 3 /* not used */
+  HASH_METH_HASH_FILE = 3
 };
 typedef enum hash_method HASH_METHOD;
 
@@ -77,6 +77,22 @@ struct hash_scan_key
   db_value **values;		/* value array */
 };
 
+/* file hash table; used when the build input does not fit in memory.
+ * Build tuple positions are hashed into buckets whose entries are kept in temp file pages,
+ * only the first page of each bucket is remembered in memory. */
+typedef struct fhs_table FHS_TABLE;
+struct fhs_table
+{
+  struct qmgr_temp_file *tfile_vfid;	/* temp file holding the bucket pages */
+  QUERY_ID query_id;		/* query owning the temp file */
+  VPID *bucket_vpids;		/* first page of each bucket, NULL VPID if the bucket is empty */
+  unsigned int nbuckets;	/* number of buckets */
+  unsigned int nentries;	/* number of entries */
+  QFILE_TUPLE_SIMPLE_POS *found;	/* tuple positions found by the last search */
+  int found_cnt;		/* number of found positions */
+  int found_size;		/* allocated size of found */
+};
+
 /* hash list scan */
 typedef struct hash_list_scan HASH_LIST_SCAN;
 struct hash_list_scan
@@ -87,6 +103,8 @@ struct hash_list_scan
   hash_scan_key *temp_key;	/* temp probe key */
   hash_scan_key *temp_new_key;	/* temp probe key with db_value */
   HENTRY_HLS_PTR curr_hash_entry;	/* current hash entry */
+  FHS_TABLE *file_hash_table;	/* file hash table for hash list scan */
+  int curr_found_idx;		/* current position in file_hash_table->found */
   int hash_list_scan_yn;	/* Is hash list scan possible? */
   bool need_coerce_type;	/* Are the types of probe and build different? */
 };
@@ -102,12 +120,19 @@ int qdata_free_hscan_entry (const void *key, void *data, void *args);
 int qdata_hscan_key_eq (const void *key1, const void *key2);
 
 int qdata_build_hscan_key (THREAD_ENTRY * thread_p, val_descr * vd, REGU_VARIABLE_LIST regu_list, HASH_SCAN_KEY * key);
+int qdata_build_hscan_key_from_tuple (QFILE_TUPLE tpl, int *col_indp, TP_DOMAIN ** domp, TP_DOMAIN ** coerce_domp,
+				      HASH_SCAN_KEY * key, bool * is_unmatched);
 unsigned int qdata_hash_scan_key (const void *key, unsigned int ht_size);
 HASH_SCAN_KEY *qdata_copy_hscan_key (THREAD_ENTRY * thread_p, HASH_SCAN_KEY * key,
 				     REGU_VARIABLE_LIST probe_regu_list, val_descr * vd);
 HASH_SCAN_KEY *qdata_copy_hscan_key_without_alloc (THREAD_ENTRY * thread_p, HASH_SCAN_KEY * key,
 						   REGU_VARIABLE_LIST probe_regu_list, HASH_SCAN_KEY * new_key);
 
+FHS_TABLE *fhs_create (THREAD_ENTRY * thread_p, QUERY_ID query_id, int est_entries);
+void fhs_destroy (THREAD_ENTRY * thread_p, FHS_TABLE * ht);
+int fhs_insert (THREAD_ENTRY * thread_p, FHS_TABLE * ht, HASH_SCAN_KEY * key, QFILE_TUPLE_SIMPLE_POS * pos);
+int fhs_search (THREAD_ENTRY * thread_p, FHS_TABLE * ht, HASH_SCAN_KEY * key);
+
 int qdata_print_hash_scan_entry (THREAD_ENTRY * thread_p, FILE * fp, const void *data, void *args);
 
 #endif /* _QUERY_HASH_SCAN_H_ */
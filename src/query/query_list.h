@@ -46,6 +46,9 @@ typedef enum
 /* aligned size of the field */
 #define QFILE_PAGE_HEADER_SIZE          32
 
+/* maximum number of list file pages sent to the client in one round trip */
+#define QFILE_MAX_FETCH_PAGES           256
+
 /* offset values to access fields */
 #define QFILE_TUPLE_COUNT_OFFSET        0
 #define QFILE_PREV_PAGE_ID_OFFSET       4
@@ -331,11 +334,19 @@ typedef enum
   QPROC_NO_SINGLE_OUTER		/* 1 NULL row or n qualified rows */
 } QPROC_SINGLE_FETCH;
 
+/* List File Join Method */
+typedef enum
+{
+  QFILE_JOIN_METHOD_MERGE = 0,	/* sort-merge of two ordered list files */
+  QFILE_JOIN_METHOD_HASH	/* build/probe hash join of two unordered list files */
+} QFILE_JOIN_METHOD;
+
 /* List File Merge Information */
 typedef struct qfile_list_merge_info QFILE_LIST_MERGE_INFO;
 struct qfile_list_merge_info
 {
   JOIN_TYPE join_type;		/* inner, left, right or outer */
+  QFILE_JOIN_METHOD join_method;	/* merge or hash */
   QPROC_SINGLE_FETCH single_fetch;	/* merge in single fetch mode */
   int ls_column_cnt;		/* join columns count */
   int ls_pos_cnt;		/* tuple value fetch count */
@@ -505,6 +516,7 @@ struct qfile_list_scan_id
   int curr_tplno;		/* current tuple number */
   QFILE_TUPLE_RECORD tplrec;	/* used for overflow tuple peeking */
   QFILE_LIST_ID list_id;	/* list file identifier */
+  PAGE_READ_AHEAD read_ahead;	/* read-ahead state of the scan */
 };
 
 /* list file flag; denoting type and/or operation of the list file */
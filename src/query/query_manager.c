@@ -45,6 +45,7 @@
 #include "probes.h"
 #endif /* ENABLE_SYSTEMTAP */
 #include "thread_entry.hpp"
+#include "thread_manager.hpp"	// for thread_get_thread_entry_info
 #include "xasl_cache.h"
 #include "xasl_unpack_info.hpp"
 
@@ -67,6 +68,9 @@ extern int method_Num_method_jsp_calls;
 
 #define QMGR_SQL_ID_LENGTH      13
 
+/* Smallest grant of the query memory broker; enough for a sort and a few temp file buffers. */
+#define QMGR_MIN_QUERY_MEMORY_GRANT     (64 * DB_PAGESIZE)
+
 /* We have two valid types of membuf used by temporary file. */
 #define QMGR_IS_VALID_MEMBUF_TYPE(m)    ((m) == TEMP_FILE_MEMBUF_NORMAL || (m) == TEMP_FILE_MEMBUF_KEY_BUFFER)
 
@@ -136,6 +140,21 @@ QMGR_QUERY_TABLE qmgr_Query_table = { NULL, 0, NULL,
   {{PTHREAD_MUTEX_INITIALIZER, NULL, 0}, {PTHREAD_MUTEX_INITIALIZER, NULL, 0}}
 };
 
+/*
+ * Query memory broker. Each executing query is granted a share of PRM_ID_QUERY_MEMORY_POOL_SIZE, sized by its
+ * estimated cardinality and by the memory already granted to other queries. Temp file buffers, sorts and hash
+ * aggregation reserve their memory out of the grant and spill to disk when it is exhausted.
+ */
+typedef struct qmgr_memory_broker QMGR_MEMORY_BROKER;
+struct qmgr_memory_broker
+{
+  pthread_mutex_t mutex;
+  INT64 granted;		/* memory granted to executing queries */
+  int granted_count;		/* number of executing queries holding a grant */
+};
+
+static QMGR_MEMORY_BROKER qmgr_Memory_broker = { PTHREAD_MUTEX_INITIALIZER, 0, 0 };
+
 #if !defined(SERVER_MODE)
 static struct drand48_data qmgr_rand_buf;
 #endif
@@ -165,6 +184,12 @@ static int qmgr_free_query_temp_file_helper (THREAD_ENTRY * thread_p, QMGR_QUERY
 static int qmgr_free_query_temp_file (THREAD_ENTRY * thread_p, QMGR_QUERY_ENTRY * qptr, int tran_idx);
 static QMGR_TEMP_FILE *qmgr_allocate_tempfile_with_buffer (int num_buffer_pages);
 
+static double qmgr_estimate_query_memory (XASL_NODE * xasl);
+static void qmgr_grant_query_memory (QMGR_QUERY_ENTRY * query_p, XASL_NODE * xasl);
+static void qmgr_revoke_query_memory (QMGR_QUERY_ENTRY * query_p);
+static INT64 qmgr_reserve_query_entry_memory (QMGR_QUERY_ENTRY * query_p, INT64 size, INT64 min_size);
+static void qmgr_unreserve_query_entry_memory (QMGR_QUERY_ENTRY * query_p, INT64 size);
+
 #if defined (SERVER_MODE)
 static XASL_NODE *qmgr_find_leaf (XASL_NODE * xasl);
 static QFILE_LIST_ID *qmgr_process_query (THREAD_ENTRY * thread_p, XASL_NODE * xasl_tree, char *xasl_stream,
@@ -342,6 +367,8 @@ qmgr_allocate_query_entry (THREAD_ENTRY * thread_p, QMGR_TRAN_ENTRY * tran_entry
   query_p->query_flag = 0;
   query_p->is_holdable = false;
   query_p->includes_tde_class = false;
+  query_p->mem_grant = -1;
+  query_p->mem_reserved = 0;
 
 #if defined (NDEBUG)
   /* just a safe guard for a release build. I don't expect it will be hit. */
@@ -1126,6 +1153,7 @@ qmgr_process_query (THREAD_ENTRY * thread_p, XASL_NODE * xasl_tree, char *xasl_s
   XASL_NODE *xasl_p;
   XASL_UNPACK_INFO *xasl_buf_info;
   QFILE_LIST_ID *list_id;
+  void *prev_query_entry;
 
   assert (query_p != NULL);
   assert (tran_entry_p != NULL);
@@ -1174,9 +1202,16 @@ qmgr_process_query (THREAD_ENTRY * thread_p, XASL_NODE * xasl_tree, char *xasl_s
     }
 
   /* execute the query with the value list, if any */
+  qmgr_grant_query_memory (query_p, xasl_p);
+  prev_query_entry = thread_p->query_entry;
+  thread_p->query_entry = query_p;
+
   query_p->list_id = qexec_execute_query (thread_p, xasl_p, dbval_count, dbvals_p, query_p->query_id);
   thread_p->no_logging = false;
 
+  thread_p->query_entry = prev_query_entry;
+  qmgr_revoke_query_memory (query_p);
+
   /* Note: qexec_execute_query() returns listid (NOT NULL) even if an error was occurred. We should check the error
    * condition and free listid. */
   if (query_p->errid < 0)
@@ -2630,6 +2665,8 @@ qmgr_create_new_temp_file (THREAD_ENTRY * thread_p, QUERY_ID query_id, QMGR_TEMP
   QFILE_PAGE_HEADER pgheader = { 0, NULL_PAGEID, NULL_PAGEID, 0, NULL_PAGEID, NULL_VOLID, NULL_VOLID, NULL_VOLID };
   static int temp_mem_buffer_pages = prm_get_integer_value (PRM_ID_TEMP_MEM_BUFFER_PAGES);
   static int index_scan_key_buffer_pages = prm_get_integer_value (PRM_ID_INDEX_SCAN_KEY_BUFFER_PAGES);
+  int max_buffer_pages, min_buffer_pages;
+  INT64 reserved;
 
   assert (QMGR_IS_VALID_MEMBUF_TYPE (membuf_type));
 
@@ -2638,7 +2675,41 @@ qmgr_create_new_temp_file (THREAD_ENTRY * thread_p, QUERY_ID query_id, QMGR_TEMP
       return NULL;
     }
 
-  num_buffer_pages = ((membuf_type == TEMP_FILE_MEMBUF_NORMAL) ? temp_mem_buffer_pages : index_scan_key_buffer_pages);
+  tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
+  tran_entry_p = &qmgr_Query_table.tran_entries_p[tran_index];
+
+  /* find query entry */
+  if (qmgr_Query_table.tran_entries_p != NULL)
+    {
+      query_p = qmgr_find_query_entry (tran_entry_p->query_entry_list_p, query_id);
+    }
+  else
+    {
+      query_p = NULL;
+    }
+
+  if (query_p == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_UNKNOWN_QUERYID, 1, query_id);
+      return NULL;
+    }
+
+  /* the memory buffer is reserved out of the query memory grant; without it, pages go straight to the temp file.
+   * the key buffer of a covering index scan keeps at least the size of a normal buffer. */
+  if (membuf_type == TEMP_FILE_MEMBUF_NORMAL)
+    {
+      max_buffer_pages = temp_mem_buffer_pages;
+      min_buffer_pages = 0;
+    }
+  else
+    {
+      max_buffer_pages = index_scan_key_buffer_pages;
+      min_buffer_pages = MIN (MAX (temp_mem_buffer_pages, 1), index_scan_key_buffer_pages);
+    }
+  reserved = qmgr_reserve_query_entry_memory (query_p, (INT64) max_buffer_pages * DB_PAGESIZE,
+					      (INT64) min_buffer_pages * DB_PAGESIZE);
+  num_buffer_pages = (int) (reserved / DB_PAGESIZE);
+  qmgr_unreserve_query_entry_memory (query_p, reserved - (INT64) num_buffer_pages * DB_PAGESIZE);
 
   tfile_vfid_p = qmgr_get_temp_file_from_list (&qmgr_Query_table.temp_file_list[membuf_type]);
   if (tfile_vfid_p == NULL)
@@ -2648,6 +2719,7 @@ qmgr_create_new_temp_file (THREAD_ENTRY * thread_p, QUERY_ID query_id, QMGR_TEMP
 
   if (tfile_vfid_p == NULL)
     {
+      qmgr_unreserve_query_entry_memory (query_p, (INT64) num_buffer_pages * DB_PAGESIZE);
       return NULL;
     }
 
@@ -2672,26 +2744,6 @@ qmgr_create_new_temp_file (THREAD_ENTRY * thread_p, QUERY_ID query_id, QMGR_TEMP
       page_p += DB_PAGESIZE;
     }
 
-  tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
-  tran_entry_p = &qmgr_Query_table.tran_entries_p[tran_index];
-
-  /* find query entry */
-  if (qmgr_Query_table.tran_entries_p != NULL)
-    {
-      query_p = qmgr_find_query_entry (tran_entry_p->query_entry_list_p, query_id);
-    }
-  else
-    {
-      query_p = NULL;
-    }
-
-  if (query_p == NULL)
-    {
-      free_and_init (tfile_vfid_p);
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_UNKNOWN_QUERYID, 1, query_id);
-      return NULL;
-    }
-
   if (query_p->includes_tde_class)
     {
       tfile_vfid_p->tde_encrypted = true;
@@ -3026,6 +3078,7 @@ qmgr_free_list_temp_file (THREAD_ENTRY * thread_p, QUERY_ID query_id, QMGR_TEMP_
 
       if (tfile_vfid_p->temp_file_type != FILE_QUERY_AREA)
 	{
+	  qmgr_unreserve_query_entry_memory (query_p, (INT64) tfile_vfid_p->membuf_npages * DB_PAGESIZE);
 	  qmgr_put_temp_file_into_list (tfile_vfid_p);
 	}
       else if (tfile_vfid_p)
@@ -3317,7 +3370,11 @@ qmgr_put_temp_file_into_list (QMGR_TEMP_FILE * temp_file_p)
 
   temp_file_p->membuf_last = -1;
 
-  if (QMGR_IS_VALID_MEMBUF_TYPE (temp_file_p->membuf_type))
+  /* a buffer cut short by the query memory broker may be smaller than the others in the list */
+  if (QMGR_IS_VALID_MEMBUF_TYPE (temp_file_p->membuf_type)
+      && temp_file_p->membuf_npages == ((temp_file_p->membuf_type == TEMP_FILE_MEMBUF_NORMAL)
+					? prm_get_integer_value (PRM_ID_TEMP_MEM_BUFFER_PAGES)
+					: prm_get_integer_value (PRM_ID_INDEX_SCAN_KEY_BUFFER_PAGES)))
     {
       temp_file_list_p = &qmgr_Query_table.temp_file_list[temp_file_p->membuf_type];
 
@@ -3357,6 +3414,205 @@ qmgr_get_temp_file_membuf_pages (QMGR_TEMP_FILE * temp_file_p)
   return temp_file_p->membuf_npages;
 }
 
+/*
+ * qmgr_estimate_query_memory () - estimate the memory a query would need to keep its intermediate results in memory
+ *   return: estimated size in bytes
+ *   xasl(in): XASL tree of the query
+ *
+ * Note: The estimate sums the estimated result size of the main query and of its uncorrelated subqueries and derived
+ *       tables, which are the inputs of the sorts and of the hash aggregation of the query.
+ */
+static double
+qmgr_estimate_query_memory (XASL_NODE * xasl)
+{
+  double size = 0;
+
+  for (; xasl != NULL; xasl = xasl->next)
+    {
+      if (xasl->cardinality > 0)
+	{
+	  size += xasl->cardinality * MAX (xasl->projected_size, 1);
+	}
+      size += qmgr_estimate_query_memory (xasl->aptr_list);
+    }
+
+  return size;
+}
+
+/*
+ * qmgr_grant_query_memory () - grant an executing query its share of the query memory pool
+ *   return: none
+ *   query_p(in/out): query entry
+ *   xasl(in): XASL tree of the query
+ *
+ * Note: A query is granted the memory it is estimated to need, as long as the pool has it. Under pressure, the grant
+ *       is cut to an even share of the pool between the executing queries, but never below QMGR_MIN_QUERY_MEMORY_GRANT.
+ *       Grants may exceed the pool when many queries run at once; they only get smaller.
+ */
+static void
+qmgr_grant_query_memory (QMGR_QUERY_ENTRY * query_p, XASL_NODE * xasl)
+{
+  INT64 pool_size = (INT64) prm_get_bigint_value (PRM_ID_QUERY_MEMORY_POOL_SIZE);
+  INT64 need, share, available, grant;
+  double estimate;
+  int rv;
+
+  if (pool_size <= 0)
+    {
+      /* no limit */
+      query_p->mem_grant = -1;
+      return;
+    }
+
+  estimate = qmgr_estimate_query_memory (xasl);
+  need = (estimate >= (double) pool_size) ? pool_size : (INT64) estimate;
+  need = MAX (need, QMGR_MIN_QUERY_MEMORY_GRANT);
+
+  rv = pthread_mutex_lock (&qmgr_Memory_broker.mutex);
+
+  available = pool_size - qmgr_Memory_broker.granted;
+  share = pool_size / (qmgr_Memory_broker.granted_count + 1);
+  grant = MIN (need, MAX (available, share));
+  grant = MAX (grant, QMGR_MIN_QUERY_MEMORY_GRANT);
+
+  qmgr_Memory_broker.granted += grant;
+  qmgr_Memory_broker.granted_count++;
+
+  pthread_mutex_unlock (&qmgr_Memory_broker.mutex);
+
+  query_p->mem_grant = grant;
+}
+
+/*
+ * qmgr_revoke_query_memory () - give the grant of a query back to the query memory pool
+ *   return: none
+ *   query_p(in/out): query entry
+ *
+ * Note: Memory still reserved by the files of the query result stays accounted in the query entry until the
+ *       files are freed.
+ */
+static void
+qmgr_revoke_query_memory (QMGR_QUERY_ENTRY * query_p)
+{
+  int rv;
+
+  if (query_p->mem_grant < 0)
+    {
+      return;
+    }
+
+  rv = pthread_mutex_lock (&qmgr_Memory_broker.mutex);
+
+  assert (qmgr_Memory_broker.granted >= query_p->mem_grant && qmgr_Memory_broker.granted_count > 0);
+  qmgr_Memory_broker.granted -= query_p->mem_grant;
+  qmgr_Memory_broker.granted_count--;
+
+  pthread_mutex_unlock (&qmgr_Memory_broker.mutex);
+
+  query_p->mem_grant = -1;
+}
+
+/*
+ * qmgr_reserve_query_entry_memory () - reserve memory out of the grant of a query
+ *   return: reserved size, between min_size and size
+ *   query_p(in/out): query entry
+ *   size(in): memory the caller would like to use
+ *   min_size(in): memory the caller cannot do without
+ *
+ * Note: min_size is always reserved, even if the grant is exhausted, so that the caller can make progress by spilling
+ *       to disk. The reservation must be given back with qmgr_unreserve_query_entry_memory.
+ */
+static INT64
+qmgr_reserve_query_entry_memory (QMGR_QUERY_ENTRY * query_p, INT64 size, INT64 min_size)
+{
+  INT64 available, reserved;
+
+  assert (min_size <= size);
+
+  if (query_p == NULL)
+    {
+      return size;
+    }
+
+  if (query_p->mem_grant < 0)
+    {
+      reserved = size;
+    }
+  else
+    {
+      /* parallel scan workers may reserve for the same query */
+      available = query_p->mem_grant - ATOMIC_LOAD_64 (&query_p->mem_reserved);
+      reserved = MIN (size, MAX (available, min_size));
+    }
+
+  ATOMIC_INC_64 (&query_p->mem_reserved, reserved);
+
+  return reserved;
+}
+
+/*
+ * qmgr_unreserve_query_entry_memory () - give back memory reserved out of the grant of a query
+ *   return: none
+ *   query_p(in/out): query entry
+ *   size(in): reserved size
+ */
+static void
+qmgr_unreserve_query_entry_memory (QMGR_QUERY_ENTRY * query_p, INT64 size)
+{
+  INT64 new_value;
+
+  if (query_p == NULL || size <= 0)
+    {
+      return;
+    }
+
+  new_value = ATOMIC_INC_64 (&query_p->mem_reserved, -size);
+  if (new_value < 0)
+    {
+      /* more was given back than was reserved; every reservation must be given back to the entry it was taken from */
+      er_log_debug (ARG_FILE_LINE, "qmgr_unreserve_query_entry_memory: query %lld gave back %lld bytes of %lld\n",
+		    (long long) query_p->query_id, (long long) size, (long long) (new_value + size));
+    }
+  assert (new_value >= 0);
+}
+
+/*
+ * qmgr_reserve_query_memory () - reserve memory for a sort or a hash table out of the grant of the executing query
+ *   return: reserved size, between min_size and size
+ *   thread_p(in): thread entry
+ *   size(in): memory the caller would like to use
+ *   min_size(in): memory the caller cannot do without
+ *
+ * Note: Outside of query execution, size is returned.
+ */
+INT64
+qmgr_reserve_query_memory (THREAD_ENTRY * thread_p, INT64 size, INT64 min_size)
+{
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
+  return qmgr_reserve_query_entry_memory ((QMGR_QUERY_ENTRY *) thread_p->query_entry, size, min_size);
+}
+
+/*
+ * qmgr_unreserve_query_memory () - give back memory reserved by qmgr_reserve_query_memory
+ *   return: none
+ *   thread_p(in): thread entry
+ *   size(in): reserved size
+ */
+void
+qmgr_unreserve_query_memory (THREAD_ENTRY * thread_p, INT64 size)
+{
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
+  qmgr_unreserve_query_entry_memory ((QMGR_QUERY_ENTRY *) thread_p->query_entry, size);
+}
+
 #if defined (SERVER_MODE)
 /*
  * qmgr_set_query_exec_info_to_tdes () - calculate timeout and set to transaction
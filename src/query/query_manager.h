@@ -137,6 +137,8 @@ struct qmgr_query_entry
   QUERY_FLAG query_flag;
   bool is_holdable;		/* true if this query should be available */
   bool includes_tde_class;	/* true if this query include some tde class. It is from xasl node */
+  INT64 mem_grant;		/* memory granted by the query memory broker while executing; -1 if not limited */
+  INT64 mem_reserved;		/* memory reserved out of mem_grant by temp files, sorts and hash aggregation */
 };
 
 extern QMGR_QUERY_ENTRY *qmgr_get_query_entry (THREAD_ENTRY * thread_p, QUERY_ID query_id, int trans_ind);
@@ -162,6 +164,8 @@ extern QMGR_TEMP_FILE *qmgr_create_result_file (THREAD_ENTRY * thread_p, QUERY_I
 extern int qmgr_free_list_temp_file (THREAD_ENTRY * thread_p, QUERY_ID query_id, QMGR_TEMP_FILE * tfile_vfidp);
 extern int qmgr_free_temp_file_list (THREAD_ENTRY * thread_p, QMGR_TEMP_FILE * tfile_vfidp, QUERY_ID query_id,
 				     bool is_error);
+extern INT64 qmgr_reserve_query_memory (THREAD_ENTRY * thread_p, INT64 size, INT64 min_size);
+extern void qmgr_unreserve_query_memory (THREAD_ENTRY * thread_p, INT64 size);
 
 #if defined (SERVER_MODE)
 extern bool qmgr_is_query_interrupted (THREAD_ENTRY * thread_p, QUERY_ID query_id);
@@ -203,6 +203,7 @@ static int scan_key_compare (DB_VALUE * val1, DB_VALUE * val2, int num_index_ter
 static SCAN_CODE scan_build_hash_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
 static SCAN_CODE scan_next_hash_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
 static SCAN_CODE scan_hash_probe_next (THREAD_ENTRY * thread_p, SCAN_ID * scan_id, QFILE_TUPLE * tuple);
+static SCAN_CODE scan_hash_file_probe_next (THREAD_ENTRY * thread_p, SCAN_ID * scan_id, QFILE_TUPLE * tuple);
 static HASH_METHOD check_hash_list_scan (LLIST_SCAN_ID * llsidp, int *val_cnt, int hash_list_scan_yn);
 
 /*
@@ -3657,6 +3658,10 @@ scan_open_index_node_info_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
  *   regu_list_pred(in):
  *   pr(in):
  *   regu_list_rest(in):
+ *   regu_list_build(in):
+ *   regu_list_probe(in):
+ *   hash_list_scan_yn(in):
+ *   query_id(in):
  */
 int
 scan_open_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
@@ -3666,7 +3671,7 @@ scan_open_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
 		     /* fields of LLIST_SCAN_ID */
 		     QFILE_LIST_ID * list_id, regu_variable_list_node * regu_list_pred, PRED_EXPR * pr,
 		     regu_variable_list_node * regu_list_rest, regu_variable_list_node * regu_list_build,
-		     regu_variable_list_node * regu_list_probe, int hash_list_scan_yn)
+		     regu_variable_list_node * regu_list_probe, int hash_list_scan_yn, QUERY_ID query_id)
 {
   LLIST_SCAN_ID *llsidp;
   int val_cnt;
@@ -3713,12 +3718,26 @@ scan_open_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
 	}
 
       /* create hash table */
-      llsidp->hlsid.hash_table =
-	mht_create_hls ("Hash List Scan", llsidp->list_id->tuple_cnt, qdata_hash_scan_key, qdata_hscan_key_eq);
-      if (llsidp->hlsid.hash_table == NULL)
+      if (llsidp->hlsid.hash_list_scan_yn == HASH_METH_HASH_FILE)
 	{
-	  return S_ERROR;
+	  llsidp->hlsid.hash_table = NULL;
+	  llsidp->hlsid.file_hash_table = fhs_create (thread_p, query_id, llsidp->list_id->tuple_cnt);
+	  if (llsidp->hlsid.file_hash_table == NULL)
+	    {
+	      return S_ERROR;
+	    }
+	}
+      else
+	{
+	  llsidp->hlsid.file_hash_table = NULL;
+	  llsidp->hlsid.hash_table =
+	    mht_create_hls ("Hash List Scan", llsidp->list_id->tuple_cnt, qdata_hash_scan_key, qdata_hscan_key_eq);
+	  if (llsidp->hlsid.hash_table == NULL)
+	    {
+	      return S_ERROR;
+	    }
 	}
+      llsidp->hlsid.curr_found_idx = 0;
 
       /* alloc temp key */
       llsidp->hlsid.temp_key = qdata_alloc_hscan_key (thread_p, val_cnt, false);
@@ -3743,9 +3762,11 @@ scan_open_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
   else
     {
       llsidp->hlsid.hash_table = NULL;
+      llsidp->hlsid.file_hash_table = NULL;
       llsidp->hlsid.temp_key = NULL;
       llsidp->hlsid.temp_new_key = NULL;
       llsidp->hlsid.curr_hash_entry = NULL;
+      llsidp->hlsid.curr_found_idx = 0;
     }
 
   return NO_ERROR;
@@ -4857,6 +4878,11 @@ scan_close_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 	  mht_clear_hls (llsidp->hlsid.hash_table, qdata_free_hscan_entry, (void *) thread_p);
 	  mht_destroy_hls (llsidp->hlsid.hash_table);
 	}
+      if (llsidp->hlsid.file_hash_table != NULL)
+	{
+	  fhs_destroy (thread_p, llsidp->hlsid.file_hash_table);
+	  llsidp->hlsid.file_hash_table = NULL;
+	}
       /* free temp keys and values */
       if (llsidp->hlsid.temp_key != NULL)
 	{
@@ -6966,6 +6992,529 @@ scan_next_scan (THREAD_ENTRY * thread_p, SCAN_ID * s_id)
   return scan_handle_single_scan (thread_p, s_id, scan_next_scan_local);
 }
 
+/*
+ * scan_batch_add_column () - add the column of an attribute to a batch
+ *   return: false if the attribute cannot be read into a column
+ *   batch(in/out): batch of rows
+ *   attr_id(in): attribute identifier
+ *   regu_list(in): regulator variables that fetch the attribute
+ */
+static bool
+scan_batch_add_column (THREAD_ENTRY * thread_p, SCAN_BATCH * batch, ATTR_ID attr_id,
+		       regu_variable_list_node * regu_list)
+{
+  SCAN_BATCH_COLUMN *column;
+  regu_variable_list_node *p;
+
+  if (eval_batch_find_column (batch, attr_id) != NULL)
+    {
+      /* the attribute is in both attribute caches */
+      return false;
+    }
+
+  for (p = regu_list; p != NULL; p = p->next)
+    {
+      if (p->value.type == TYPE_ATTR_ID && p->value.value.attr_descr.id == attr_id && p->value.vfetch_to != NULL)
+	{
+	  break;
+	}
+    }
+  if (p == NULL || (p->value.domain != NULL && TP_DOMAIN_TYPE (p->value.domain) != p->value.value.attr_descr.type))
+    {
+      return false;
+    }
+
+  column = &batch->columns[batch->num_columns++];
+  column->attr_id = attr_id;
+  column->type = p->value.value.attr_descr.type;
+  column->fetch_to = p->value.vfetch_to;
+
+  switch (column->type)
+    {
+    case DB_TYPE_SHORT:
+    case DB_TYPE_INTEGER:
+    case DB_TYPE_BIGINT:
+      column->bigints = (DB_BIGINT *) db_private_alloc (thread_p, batch->max_rows * sizeof (DB_BIGINT));
+      if (column->bigints == NULL)
+	{
+	  return false;
+	}
+      break;
+
+    case DB_TYPE_DOUBLE:
+      column->doubles = (double *) db_private_alloc (thread_p, batch->max_rows * sizeof (double));
+      if (column->doubles == NULL)
+	{
+	  return false;
+	}
+      break;
+
+    default:
+      return false;
+    }
+
+  column->is_null = (bool *) db_private_alloc (thread_p, batch->max_rows * sizeof (bool));
+  if (column->is_null == NULL)
+    {
+      return false;
+    }
+
+  if (DB_NEED_CLEAR (column->fetch_to))
+    {
+      pr_clear_value (column->fetch_to);
+    }
+
+  return true;
+}
+
+/*
+ * scan_batch_has_columns () - check that all regulator variables of a list fetch an attribute of a batch
+ *   return: true if they do
+ *   batch(in): batch of rows
+ *   regu_list(in): regulator variables
+ */
+static bool
+scan_batch_has_columns (SCAN_BATCH * batch, regu_variable_list_node * regu_list)
+{
+  regu_variable_list_node *p;
+  SCAN_BATCH_COLUMN *column;
+
+  for (p = regu_list; p != NULL; p = p->next)
+    {
+      if (p->value.type != TYPE_ATTR_ID)
+	{
+	  return false;
+	}
+
+      column = eval_batch_find_column (batch, p->value.value.attr_descr.id);
+      if (column == NULL || column->fetch_to != p->value.vfetch_to)
+	{
+	  return false;
+	}
+    }
+
+  return true;
+}
+
+/*
+ * scan_init_heap_batch () - prepare a heap scan to read its rows in batches
+ *   return: false if the scan cannot be read in batches
+ *   scan_id(in): Scan identifier; opened but not started
+ *   batch_size(in): maximum number of rows of a batch
+ *   batch(out): batch of rows
+ *
+ * Note: Only forward heap scans of a SELECT that lock no objects are read in batches, and only if all attributes are
+ *       SHORT, INTEGER, BIGINT or DOUBLE attributes fetched as they are, and the predicate is a conjunction of
+ *       comparisons of attributes with constants. The columns are in the order of the attribute caches: the
+ *       attributes of the predicate first, then the other attributes.
+ *
+ *       If false is returned, an error may be set; the scan is left as it was and can be read row by row.
+ */
+bool
+scan_init_heap_batch (THREAD_ENTRY * thread_p, SCAN_ID * scan_id, int batch_size, SCAN_BATCH * batch)
+{
+  HEAP_SCAN_ID *hsidp = &scan_id->s.hsid;
+  int num_attrs, i;
+
+  memset (batch, 0, sizeof (SCAN_BATCH));
+
+  if (scan_id->type != S_HEAP_SCAN || scan_id->direction != S_FORWARD || scan_id->grouped
+      || scan_id->mvcc_select_lock_needed || scan_id->scan_op_type != S_SELECT
+      || scan_id->single_fetch != QPROC_NO_SINGLE_INNER || scan_id->qualification != QPROC_QUALIFIED
+      || scan_id->join_dbval != NULL || scan_id->val_list == NULL || hsidp->recordinfo_regu_list != NULL
+      || mvcc_is_mvcc_disabled_class (&hsidp->cls_oid) || batch_size <= 0)
+    {
+      return false;
+    }
+
+  batch->max_rows = batch_size;
+
+  num_attrs = hsidp->pred_attrs.num_attrs + hsidp->rest_attrs.num_attrs;
+  if (num_attrs > 0)
+    {
+      batch->columns = (SCAN_BATCH_COLUMN *) db_private_alloc (thread_p, num_attrs * sizeof (SCAN_BATCH_COLUMN));
+      batch->disk_data = (char **) db_private_alloc (thread_p, num_attrs * sizeof (char *));
+      if (batch->columns == NULL || batch->disk_data == NULL)
+	{
+	  goto exit_on_fail;
+	}
+      memset (batch->columns, 0, num_attrs * sizeof (SCAN_BATCH_COLUMN));
+    }
+
+  for (i = 0; i < hsidp->pred_attrs.num_attrs; i++)
+    {
+      if (!scan_batch_add_column (thread_p, batch, hsidp->pred_attrs.attr_ids[i], hsidp->scan_pred.regu_list))
+	{
+	  goto exit_on_fail;
+	}
+    }
+  for (i = 0; i < hsidp->rest_attrs.num_attrs; i++)
+    {
+      if (!scan_batch_add_column (thread_p, batch, hsidp->rest_attrs.attr_ids[i], hsidp->rest_regu_list))
+	{
+	  goto exit_on_fail;
+	}
+    }
+
+  if (!scan_batch_has_columns (batch, hsidp->scan_pred.regu_list)
+      || !scan_batch_has_columns (batch, hsidp->rest_regu_list))
+    {
+      goto exit_on_fail;
+    }
+
+  batch->selection = (int *) db_private_alloc (thread_p, batch->max_rows * sizeof (int));
+  if (batch->selection == NULL)
+    {
+      goto exit_on_fail;
+    }
+
+  if (!eval_batch_pred_init (thread_p, hsidp->scan_pred.pred_expr, scan_id->vd, batch))
+    {
+      goto exit_on_fail;
+    }
+
+  return true;
+
+exit_on_fail:
+  scan_clear_heap_batch (thread_p, batch);
+  return false;
+}
+
+/*
+ * scan_batch_decode_value () - decode the disk data of an attribute into a column
+ *   return:
+ *   column(in/out): column of the attribute
+ *   row(in): row of the batch
+ *   disk_data(in): disk data of the attribute; NULL if the attribute is unbound
+ */
+static void
+scan_batch_decode_value (SCAN_BATCH_COLUMN * column, int row, char *disk_data)
+{
+  column->is_null[row] = (disk_data == NULL);
+  if (disk_data == NULL)
+    {
+      return;
+    }
+
+  switch (column->type)
+    {
+    case DB_TYPE_SHORT:
+      column->bigints[row] = OR_GET_SHORT (disk_data);
+      break;
+
+    case DB_TYPE_INTEGER:
+      column->bigints[row] = OR_GET_INT (disk_data);
+      break;
+
+    case DB_TYPE_BIGINT:
+      OR_GET_BIGINT (disk_data, &column->bigints[row]);
+      break;
+
+    case DB_TYPE_DOUBLE:
+      OR_GET_DOUBLE (disk_data, &column->doubles[row]);
+      break;
+
+    default:
+      assert (false);
+      break;
+    }
+}
+
+/*
+ * scan_batch_set_value () - set the value of an attribute read by the attribute cache into a column
+ *   return: NO_ERROR, or error code
+ *   column(in/out): column of the attribute
+ *   row(in): row of the batch
+ *   value(in): value of the attribute
+ */
+static int
+scan_batch_set_value (SCAN_BATCH_COLUMN * column, int row, DB_VALUE * value)
+{
+  DB_VALUE coerced;
+  TP_DOMAIN *domain;
+  TP_DOMAIN_STATUS dom_status;
+
+  column->is_null[row] = DB_IS_NULL (value);
+  if (column->is_null[row])
+    {
+      return NO_ERROR;
+    }
+
+  if (DB_VALUE_DOMAIN_TYPE (value) != column->type)
+    {
+      /* the instance has an older representation */
+      domain = tp_domain_resolve_default (column->type);
+      dom_status = tp_value_coerce (value, &coerced, domain);
+      if (dom_status != DOMAIN_COMPATIBLE)
+	{
+	  return tp_domain_status_er_set (dom_status, ARG_FILE_LINE, value, domain);
+	}
+      value = &coerced;
+    }
+
+  switch (column->type)
+    {
+    case DB_TYPE_SHORT:
+      column->bigints[row] = db_get_short (value);
+      break;
+
+    case DB_TYPE_INTEGER:
+      column->bigints[row] = db_get_int (value);
+      break;
+
+    case DB_TYPE_BIGINT:
+      column->bigints[row] = db_get_bigint (value);
+      break;
+
+    case DB_TYPE_DOUBLE:
+      column->doubles[row] = db_get_double (value);
+      break;
+
+    default:
+      assert (false);
+      break;
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * scan_batch_read_row () - read the attributes of an instance into a row of a batch
+ *   return: NO_ERROR, or error code
+ *   hsidp(in/out): heap scan identifier
+ *   recdes(in): record of the instance
+ *   batch(in/out): batch of rows; the instance is read into row row_count
+ *
+ * Note: Fixed size attributes are decoded from the record. If the record has another representation in which the
+ *       attributes are not all fixed size, the instance is read through the attribute cache.
+ */
+static int
+scan_batch_read_row (THREAD_ENTRY * thread_p, HEAP_SCAN_ID * hsidp, RECDES * recdes, SCAN_BATCH * batch)
+{
+  SCAN_ATTRS *scan_attrs[2] = { &hsidp->pred_attrs, &hsidp->rest_attrs };
+  HEAP_CACHE_ATTRINFO *attr_cache;
+  int row = batch->row_count;
+  int offset = 0;
+  int c, i;
+  bool is_fixed;
+  int error;
+
+  for (c = 0; c < 2; offset += scan_attrs[c]->num_attrs, c++)
+    {
+      if (scan_attrs[c]->num_attrs <= 0)
+	{
+	  continue;
+	}
+      attr_cache = scan_attrs[c]->attr_cache;
+
+      error = heap_attrinfo_peek_fixed_values (thread_p, recdes, attr_cache, batch->disk_data + offset, &is_fixed);
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
+
+      if (is_fixed)
+	{
+	  for (i = 0; i < scan_attrs[c]->num_attrs; i++)
+	    {
+	      scan_batch_decode_value (&batch->columns[offset + i], row, batch->disk_data[offset + i]);
+	    }
+	  continue;
+	}
+
+      error = heap_attrinfo_read_dbvalues (thread_p, &hsidp->curr_oid, recdes, &hsidp->scan_cache, attr_cache);
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
+
+      for (i = 0; i < scan_attrs[c]->num_attrs; i++)
+	{
+	  error = scan_batch_set_value (&batch->columns[offset + i], row, &attr_cache->values[i].dbvalue);
+	  if (error != NO_ERROR)
+	    {
+	      return error;
+	    }
+	}
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * scan_next_heap_batch () - read the next batch of rows of a heap scan
+ *   return: SCAN_CODE (S_SUCCESS, S_END, S_ERROR)
+ *   scan_id(in/out): Scan identifier; started, and prepared by scan_init_heap_batch
+ *   batch(in/out): batch of rows
+ *
+ * Note: Up to max_rows rows are read, then the predicate of the scan selects the qualified rows. S_SUCCESS is returned
+ *       if any row was read, even if none qualified.
+ */
+SCAN_CODE
+scan_next_heap_batch (THREAD_ENTRY * thread_p, SCAN_ID * scan_id, SCAN_BATCH * batch)
+{
+  HEAP_SCAN_ID *hsidp = &scan_id->s.hsid;
+  RECDES recdes = RECDES_INITIALIZER;
+  SCAN_CODE sp_scan;
+  OID retry_oid;
+  LOG_LSA ref_lsa;
+  bool is_peeking;
+
+  batch->row_count = 0;
+  batch->sel_count = 0;
+
+  if (batch->end_of_scan || scan_id->scan_immediately_stop)
+    {
+      scan_id->position = S_AFTER;
+      return S_END;
+    }
+
+  is_peeking = scan_id->fixed;
+
+  while (batch->row_count < batch->max_rows)
+    {
+      COPY_OID (&retry_oid, &hsidp->curr_oid);
+
+    restart_scan_oid:
+
+      recdes.data = NULL;
+      sp_scan = heap_next (thread_p, &hsidp->hfid, &hsidp->cls_oid, &hsidp->curr_oid, &recdes, &hsidp->scan_cache,
+			   is_peeking);
+      if (sp_scan != S_SUCCESS)
+	{
+	  if (sp_scan != S_END)
+	    {
+	      return S_ERROR;
+	    }
+	  batch->end_of_scan = true;
+	  break;
+	}
+
+      if (hsidp->scan_cache.page_watcher.pgptr != NULL)
+	{
+	  LSA_COPY (&ref_lsa, pgbuf_get_lsa (hsidp->scan_cache.page_watcher.pgptr));
+	}
+
+      if (scan_batch_read_row (thread_p, hsidp, &recdes, batch) != NO_ERROR)
+	{
+	  return S_ERROR;
+	}
+
+      if (is_peeking == PEEK && hsidp->scan_cache.page_watcher.pgptr != NULL
+	  && pgbuf_page_has_changed (hsidp->scan_cache.page_watcher.pgptr, &ref_lsa))
+	{
+	  is_peeking = COPY;
+	  COPY_OID (&hsidp->curr_oid, &retry_oid);
+	  goto restart_scan_oid;
+	}
+
+      scan_id->scan_stats.read_rows++;
+      batch->row_count++;
+    }
+
+  if (batch->row_count == 0)
+    {
+      scan_id->position = S_AFTER;
+      return S_END;
+    }
+
+  eval_batch_pred (batch);
+  scan_id->scan_stats.qualified_rows += batch->sel_count;
+
+  return S_SUCCESS;
+}
+
+/*
+ * scan_load_heap_batch_row () - set the values of a row of a batch into the value list of the scan
+ *   return:
+ *   batch(in): batch of rows
+ *   row(in): row of the batch
+ */
+void
+scan_load_heap_batch_row (SCAN_BATCH * batch, int row)
+{
+  SCAN_BATCH_COLUMN *column;
+  int i;
+
+  for (i = 0; i < batch->num_columns; i++)
+    {
+      column = &batch->columns[i];
+      if (column->is_null[row])
+	{
+	  db_value_domain_init (column->fetch_to, column->type, DB_DEFAULT_PRECISION, DB_DEFAULT_SCALE);
+	  continue;
+	}
+
+      switch (column->type)
+	{
+	case DB_TYPE_SHORT:
+	  db_make_short (column->fetch_to, (short) column->bigints[row]);
+	  break;
+
+	case DB_TYPE_INTEGER:
+	  db_make_int (column->fetch_to, (int) column->bigints[row]);
+	  break;
+
+	case DB_TYPE_BIGINT:
+	  db_make_bigint (column->fetch_to, column->bigints[row]);
+	  break;
+
+	case DB_TYPE_DOUBLE:
+	  db_make_double (column->fetch_to, column->doubles[row]);
+	  break;
+
+	default:
+	  assert (false);
+	  break;
+	}
+    }
+}
+
+/*
+ * scan_clear_heap_batch () - free the memory of a batch of rows
+ *   return:
+ *   batch(in/out): batch of rows
+ */
+void
+scan_clear_heap_batch (THREAD_ENTRY * thread_p, SCAN_BATCH * batch)
+{
+  int i;
+
+  if (batch->columns != NULL)
+    {
+      for (i = 0; i < batch->num_columns; i++)
+	{
+	  if (batch->columns[i].bigints != NULL)
+	    {
+	      db_private_free (thread_p, batch->columns[i].bigints);
+	    }
+	  if (batch->columns[i].doubles != NULL)
+	    {
+	      db_private_free (thread_p, batch->columns[i].doubles);
+	    }
+	  if (batch->columns[i].is_null != NULL)
+	    {
+	      db_private_free (thread_p, batch->columns[i].is_null);
+	    }
+	}
+      db_private_free (thread_p, batch->columns);
+    }
+  if (batch->disk_data != NULL)
+    {
+      db_private_free (thread_p, batch->disk_data);
+    }
+  if (batch->selection != NULL)
+    {
+      db_private_free (thread_p, batch->selection);
+    }
+  if (batch->pred_terms != NULL)
+    {
+      db_private_free (thread_p, batch->pred_terms);
+    }
+
+  memset (batch, 0, sizeof (SCAN_BATCH));
+}
+
 /*
  * scan_prev_scan_local () - The scan is moved to the previous scan item.
  *   return: SCAN_CODE (S_SUCCESS, S_END, S_ERROR)
@@ -7718,6 +8267,10 @@ scan_print_stats_text (FILE * fp, SCAN_ID * scan_id)
 	{
 	  fprintf (fp, "(hash temp(h), build time: %d,", TO_MSEC (scan_id->scan_stats.elapsed_hash_build));
 	}
+      else if (scan_id->s.llsid.hlsid.hash_list_scan_yn == HASH_METH_HASH_FILE)
+	{
+	  fprintf (fp, "(hash temp(f), build time: %d,", TO_MSEC (scan_id->scan_stats.elapsed_hash_build));
+	}
       else
 	{
 	  fprintf (fp, "(temp");
@@ -7809,6 +8362,7 @@ scan_build_hash_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
   QFILE_TUPLE_RECORD tplrec = { NULL, 0 };
   HASH_SCAN_KEY *key, *new_key;
   HASH_SCAN_VALUE *new_value;
+  QFILE_TUPLE_SIMPLE_POS pos;
 
   llsidp = &scan_id->s.llsid;
   key = llsidp->hlsid.temp_key;
@@ -7852,6 +8406,18 @@ scan_build_hash_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 	  new_key = key;
 	}
 
+      if (llsidp->hlsid.hash_list_scan_yn == HASH_METH_HASH_FILE)
+	{
+	  /* add tuple position to file hash table */
+	  pos.vpid = llsidp->lsid.curr_vpid;
+	  pos.offset = llsidp->lsid.curr_offset;
+	  if (fhs_insert (thread_p, llsidp->hlsid.file_hash_table, new_key, &pos) != NO_ERROR)
+	    {
+	      return S_ERROR;
+	    }
+	  continue;
+	}
+
       /* create new value */
       if (llsidp->hlsid.hash_list_scan_yn == HASH_METH_IN_MEM)
 	{
@@ -8003,6 +8569,11 @@ scan_hash_probe_next (THREAD_ENTRY * thread_p, SCAN_ID * scan_id, QFILE_TUPLE *
   key = llsidp->hlsid.temp_key;
   scan_id_p = &llsidp->lsid;
 
+  if (llsidp->hlsid.hash_list_scan_yn == HASH_METH_HASH_FILE)
+    {
+      return scan_hash_file_probe_next (thread_p, scan_id, tuple);
+    }
+
   if (scan_id_p->position == S_BEFORE)
     {
       if (llsidp->hlsid.hash_table->nentries > 0)
@@ -8096,9 +8667,85 @@ scan_hash_probe_next (THREAD_ENTRY * thread_p, SCAN_ID * scan_id, QFILE_TUPLE *
   return qp_scan;
 }
 
+/*
+ * scan_hash_file_probe_next () - The scan is moved to the next tuple of the file hash table matching the probe key.
+ *   return: SCAN_CODE (S_SUCCESS, S_END, S_ERROR)
+ *   scan_id(in/out): Scan identifier
+ *   tuple(out): peeked tuple
+ *
+ * Note: The positions matching the probe key are collected when the probe starts,
+ *       then each of them is read from the list file like the hybrid method does.
+ */
+static SCAN_CODE
+scan_hash_file_probe_next (THREAD_ENTRY * thread_p, SCAN_ID * scan_id, QFILE_TUPLE * tuple)
+{
+  LLIST_SCAN_ID *llsidp;
+  FHS_TABLE *ht;
+  QFILE_LIST_SCAN_ID *scan_id_p;
+  QFILE_TUPLE_POSITION tuple_pos;
+  QFILE_TUPLE_SIMPLE_POS *simple_pos;
+  QFILE_TUPLE_RECORD tplrec = { NULL, 0 };
+
+  llsidp = &scan_id->s.llsid;
+  ht = llsidp->hlsid.file_hash_table;
+  scan_id_p = &llsidp->lsid;
+
+  if (scan_id_p->position == S_BEFORE)
+    {
+      if (ht->nentries == 0)
+	{
+	  return S_END;
+	}
+      /* build key */
+      if (qdata_build_hscan_key (thread_p, scan_id->vd, llsidp->hlsid.probe_regu_list, llsidp->hlsid.temp_key) !=
+	  NO_ERROR)
+	{
+	  return S_ERROR;
+	}
+      if (fhs_search (thread_p, ht, llsidp->hlsid.temp_key) != NO_ERROR)
+	{
+	  return S_ERROR;
+	}
+      if (ht->found_cnt == 0)
+	{
+	  return S_END;
+	}
+      llsidp->hlsid.curr_found_idx = 0;
+      scan_id_p->position = S_ON;
+    }
+  else if (scan_id_p->position == S_ON)
+    {
+      if (++llsidp->hlsid.curr_found_idx >= ht->found_cnt)
+	{
+	  qmgr_free_old_page_and_init (thread_p, scan_id_p->curr_pgptr, scan_id_p->list_id.tfile_vfid);
+	  scan_id_p->position = S_AFTER;
+	  return S_END;
+	}
+    }
+  else if (scan_id_p->position == S_AFTER)
+    {
+      return S_END;
+    }
+  else
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_UNKNOWN_CRSPOS, 0);
+      return S_ERROR;
+    }
+
+  simple_pos = &ht->found[llsidp->hlsid.curr_found_idx];
+  MAKE_TUPLE_POSTION (tuple_pos, simple_pos, scan_id_p);
+  if (qfile_jump_scan_tuple_position (thread_p, scan_id_p, &tuple_pos, &tplrec, PEEK) != S_SUCCESS)
+    {
+      return S_ERROR;
+    }
+  *tuple = tplrec.tpl;
+
+  return S_SUCCESS;
+}
+
 /*
  * check_hash_list_scan () - Check if hash list scan is possible
- *   return: int  1: in-memory 2: hybrid in-memory
+ *   return: int  1: in-memory 2: hybrid in-memory 3: file hash
  *   llsidp (in): list scan id pointer
  *   node :
  *      1. count of tuple of list file > 0
@@ -8180,7 +8827,8 @@ check_hash_list_scan (LLIST_SCAN_ID * llsidp, int *val_cnt, int hash_list_scan_y
     }
   else
     {
-      return HASH_METH_NOT_USE;
+      /* even the tuple positions do not fit in memory; hash them into temp file pages */
+      return HASH_METH_HASH_FILE;
     }
 
   return HASH_METH_NOT_USE;
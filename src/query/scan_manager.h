@@ -434,7 +434,7 @@ extern int scan_open_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
 				/* fields of LLIST_SCAN_ID */
 				QFILE_LIST_ID * list_id, regu_variable_list_node * regu_list_pred, PRED_EXPR * pr,
 				regu_variable_list_node * regu_list_rest, regu_variable_list_node * regu_list_build,
-				regu_variable_list_node * regu_list_probe, int hash_list_scan_yn);
+				regu_variable_list_node * regu_list_probe, int hash_list_scan_yn, QUERY_ID query_id);
 extern int scan_open_showstmt_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
 				    /* fields of SCAN_ID */
 				    int grouped, QPROC_SINGLE_FETCH single_fetch, DB_VALUE * join_dbval,
@@ -468,6 +468,10 @@ extern SCAN_CODE scan_next_scan_block (THREAD_ENTRY * thread_p, SCAN_ID * s_id);
 extern void scan_end_scan (THREAD_ENTRY * thread_p, SCAN_ID * s_id);
 extern void scan_close_scan (THREAD_ENTRY * thread_p, SCAN_ID * s_id);
 extern SCAN_CODE scan_next_scan (THREAD_ENTRY * thread_p, SCAN_ID * s_id);
+extern bool scan_init_heap_batch (THREAD_ENTRY * thread_p, SCAN_ID * scan_id, int batch_size, SCAN_BATCH * batch);
+extern SCAN_CODE scan_next_heap_batch (THREAD_ENTRY * thread_p, SCAN_ID * scan_id, SCAN_BATCH * batch);
+extern void scan_load_heap_batch_row (SCAN_BATCH * batch, int row);
+extern void scan_clear_heap_batch (THREAD_ENTRY * thread_p, SCAN_BATCH * batch);
 extern SCAN_CODE scan_prev_scan (THREAD_ENTRY * thread_p, SCAN_ID * s_id);
 extern void scan_save_scan_pos (SCAN_ID * s_id, SCAN_POS * scan_pos);
 extern SCAN_CODE scan_jump_scan_pos (THREAD_ENTRY * thread_p, SCAN_ID * s_id, SCAN_POS * scan_pos);
@@ -3028,6 +3028,9 @@ stx_build_ls_merge_info (THREAD_ENTRY * thread_p, char *ptr, QFILE_LIST_MERGE_IN
   ptr = or_unpack_int (ptr, &tmp);
   list_merge_info->join_type = (JOIN_TYPE) tmp;
 
+  ptr = or_unpack_int (ptr, &tmp);
+  list_merge_info->join_method = (QFILE_JOIN_METHOD) tmp;
+
   ptr = or_unpack_int (ptr, &single_fetch);
   list_merge_info->single_fetch = (QPROC_SINGLE_FETCH) single_fetch;
 
@@ -4234,6 +4237,7 @@ stx_build_rlike_eval_term (THREAD_ENTRY * thread_p, char *ptr, RLIKE_EVAL_TERM *
   /* initialize regex object pointer */
   rlike_eval_term->compiled_regex = NULL;
   rlike_eval_term->compiled_pattern = NULL;
+  rlike_eval_term->compiled_dfa = NULL;
 
   return ptr;
 
@@ -44,6 +44,7 @@
 #include "tz_support.h"
 #include "db_date.h"
 #include "misc_string.h"
+#include "byte_search.h"
 #include "crypt_opfunc.h"
 #include "base64.h"
 #include "tz_support.h"
@@ -173,6 +174,8 @@ static int qstr_pad (MISC_OPERAND pad_operand, int pad_length, const unsigned ch
 		     int *result_length, int *result_size);
 static int qstr_eval_like (const char *tar, int tar_length, const char *expr, int expr_length, const char *escape,
 			   INTL_CODESET codeset, int coll_id);
+static bool qstr_eval_like_bytes (const char *tar, int tar_length, const char *expr, int expr_length,
+				  const char *escape, int coll_id, int *result);
 #if defined(ENABLE_UNUSED_FUNCTION)
 static int kor_cmp (unsigned char *src, unsigned char *dest, int size);
 #endif
@@ -4465,6 +4468,7 @@ db_string_like (const DB_VALUE * src_string, const DB_VALUE * pattern, const DB_
  *	   case_sensitive:     (IN) Perform case sensitive matching when 1
  *	       comp_regex: (IN/OUT) Compiled regex object
  *	     comp_pattern: (IN/OUT) Compiled regex pattern
+ *		 comp_dfa: (IN/OUT) Compiled dfa of the pattern
  *                 result:    (OUT) Integer result.
  *
  * Returns: int
@@ -4481,17 +4485,20 @@ db_string_like (const DB_VALUE * src_string, const DB_VALUE * pattern, const DB_
  *      ER_QSTR_INVALID_ESCAPE_SEQUENCE:
  *          An illegal pattern is specified.
  *
+ * Note: patterns the dfa supports are searched in linear time, on the UTF-8 string as it is. the regex object is
+ *       compiled for the other patterns and, lazily, for strings whose result depends on the locale.
  */
 int
 db_string_rlike (const DB_VALUE * src, const DB_VALUE * pattern, const DB_VALUE * case_sensitive,
-		 cub_regex_object ** comp_regex, char **comp_pattern, int *result)
+		 cub_regex_object ** comp_regex, char **comp_pattern, cub_regex_dfa ** comp_dfa, int *result)
 {
   int error_status = NO_ERROR;
   *result = V_FALSE;
 
-  /* get compiled pattern and regex object */
+  /* get compiled pattern, regex object and dfa */
   char *rx_compiled_pattern = (comp_pattern != NULL) ? *comp_pattern : NULL;
   cub_regex_object *rx_compiled_regex = (comp_regex != NULL) ? *comp_regex : NULL;
+  cub_regex_dfa *rx_compiled_dfa = (comp_dfa != NULL) ? *comp_dfa : NULL;
 
   {
     /* check for allocated DB values */
@@ -4570,9 +4577,15 @@ db_string_rlike (const DB_VALUE * src, const DB_VALUE * pattern, const DB_VALUE
 
     /* compile pattern if needed */
     std::string pattern_string (db_get_string (pattern), db_get_string_size (pattern));
-    if (cubregex::check_should_recompile (rx_compiled_regex, rx_compiled_pattern, pattern_string, reg_flags) == true)
+    if (cubregex::check_should_recompile (rx_compiled_regex, rx_compiled_dfa, rx_compiled_pattern, pattern_string,
+					  reg_flags) == true)
+      {
+	cubregex::clear (rx_compiled_regex, rx_compiled_pattern, rx_compiled_dfa);
+      }
+
+    /* the dfa is kept for the next executions of an XASL clone, the compiled pattern is freed after each one */
+    if (rx_compiled_pattern == NULL)
       {
-	cubregex::clear (rx_compiled_regex, rx_compiled_pattern);
 	int pattern_length = pattern_string.size ();
 	rx_compiled_pattern = (char *) db_private_alloc (NULL, pattern_length + 1);
 	if (rx_compiled_pattern == NULL)
@@ -4584,7 +4597,30 @@ db_string_rlike (const DB_VALUE * src, const DB_VALUE * pattern, const DB_VALUE
 	  }
 	memcpy (rx_compiled_pattern, pattern_string.c_str (), pattern_length);
 	rx_compiled_pattern[pattern_length] = '\0';
+      }
+
+    if (rx_compiled_dfa == NULL && rx_compiled_regex == NULL)
+      {
+	rx_compiled_dfa = cubregex::compile_dfa (rx_compiled_pattern, reg_flags, collation);
+      }
+
+    if (rx_compiled_dfa != NULL)
+      {
+	switch (rx_compiled_dfa->search (db_get_string (src), db_get_string_size (src)))
+	  {
+	  case cubregex::dfa_matcher::MATCH:
+	    *result = V_TRUE;
+	    goto cleanup;
+	  case cubregex::dfa_matcher::NO_MATCH:
+	    *result = V_FALSE;
+	    goto cleanup;
+	  case cubregex::dfa_matcher::NEED_FALLBACK:
+	    break;
+	  }
+      }
 
+    if (rx_compiled_regex == NULL)
+      {
 	error_status = cubregex::compile (rx_compiled_regex, rx_compiled_pattern, reg_flags, collation);
 	if (error_status != NO_ERROR)
 	  {
@@ -4608,7 +4644,7 @@ cleanup:
     {
       *result = V_ERROR;
       // *INDENT-OFF*
-      cubregex::clear (rx_compiled_regex, rx_compiled_pattern);
+      cubregex::clear (rx_compiled_regex, rx_compiled_pattern, rx_compiled_dfa);
       // *INDENT-ON*
       if (prm_get_bool_value (PRM_ID_RETURN_NULL_ON_FUNCTION_ERRORS))
 	{
@@ -4619,18 +4655,19 @@ cleanup:
 	}
     }
 
-  if (comp_regex == NULL || comp_pattern == NULL)
+  if (comp_regex == NULL || comp_pattern == NULL || comp_dfa == NULL)
     {
       /* free memory if this function is invoked in constant folding */
         // *INDENT-OFF*
-        cubregex::clear (rx_compiled_regex, rx_compiled_pattern);
+        cubregex::clear (rx_compiled_regex, rx_compiled_pattern, rx_compiled_dfa);
         // *INDENT-ON*
     }
   else
     {
-      /* pass compiled regex object and compiled pattern out to reuse them */
+      /* pass compiled regex object, compiled pattern and dfa out to reuse them */
       *comp_regex = rx_compiled_regex;
       *comp_pattern = rx_compiled_pattern;
+      *comp_dfa = rx_compiled_dfa;
     }
 
   return error_status;
@@ -6011,6 +6048,116 @@ db_string_fix_string_size (DB_VALUE * src_string)
   return error_status;
 }
 
+/*
+ * qstr_eval_like_bytes () - evaluate LIKE patterns of the shapes 'literal', 'literal%', '%literal' and '%literal%'
+ *			     by comparing bytes
+ *   return: true if the pattern was evaluated, false if it must be evaluated with the collation
+ *   tar(in): target string
+ *   tar_length(in): size of target string
+ *   expr(in): pattern
+ *   expr_length(in): size of pattern
+ *   escape(in): escape character, NULL if none
+ *   coll_id(in): collation
+ *   result(out): V_TRUE or V_FALSE
+ *
+ * Note: a match of valid UTF-8 bytes starts and ends on character boundaries, so substring search on bytes gives the
+ *	 same result as on characters.
+ */
+static bool
+qstr_eval_like_bytes (const char *tar, int tar_length, const char *expr, int expr_length, const char *escape,
+		      int coll_id, int *result)
+{
+  const char *lit, *lit_end, *tar_end, *p;
+  int lit_size;
+  bool has_leading_many, has_trailing_many, has_space = false;
+
+  if (!LANG_IS_BYTE_MATCH_COLL (coll_id))
+    {
+      return false;
+    }
+
+  if (escape != NULL && (*escape == LIKE_WILDCARD_MATCH_MANY || *escape == LIKE_WILDCARD_MATCH_ONE))
+    {
+      return false;
+    }
+
+  lit = expr;
+  lit_end = expr + expr_length;
+  while (lit < lit_end && *lit == LIKE_WILDCARD_MATCH_MANY)
+    {
+      lit++;
+    }
+  while (lit_end > lit && *(lit_end - 1) == LIKE_WILDCARD_MATCH_MANY)
+    {
+      lit_end--;
+    }
+  has_leading_many = (lit > expr);
+  has_trailing_many = (lit_end < expr + expr_length);
+  lit_size = CAST_BUFLEN (lit_end - lit);
+  if (lit_size == 0)
+    {
+      return false;
+    }
+
+  for (p = lit; p < lit_end; p++)
+    {
+      if (*p == LIKE_WILDCARD_MATCH_MANY || *p == LIKE_WILDCARD_MATCH_ONE || *p == '\0'
+	  || (escape != NULL && *p == *escape))
+	{
+	  return false;
+	}
+      if (*p == ' ')
+	{
+	  has_space = true;
+	}
+    }
+
+  if (has_space && memchr (tar, '\0', tar_length) != NULL)
+    {
+      /* space and NUL have the same weight */
+      return false;
+    }
+
+  tar_end = tar + tar_length;
+  *result = V_FALSE;
+
+  if (has_leading_many && has_trailing_many)
+    {
+      if (byte_search_find (tar, tar_length, lit, lit_size) != NULL)
+	{
+	  *result = V_TRUE;
+	}
+    }
+  else if (has_trailing_many)
+    {
+      if (tar_length >= lit_size && memcmp (tar, lit, lit_size) == 0)
+	{
+	  *result = V_TRUE;
+	}
+    }
+  else
+    {
+      /* only trailing spaces of target may follow the literal; try the literal before each of them */
+      p = tar_end;
+      while (true)
+	{
+	  if (p - tar >= lit_size && memcmp (p - lit_size, lit, lit_size) == 0
+	      && (has_leading_many || p - tar == lit_size))
+	    {
+	      *result = V_TRUE;
+	      break;
+	    }
+	  if (p == tar || *(p - 1) != ' ')
+	    {
+	      break;
+	    }
+	  p--;
+	}
+    }
+
+  return true;
+}
+
 /*
  * qstr_eval_like () -
  */
@@ -6041,6 +6188,16 @@ qstr_eval_like (const char *tar, int tar_length, const char *expr, int expr_leng
 
   int pad_char_size;
 
+  if (codeset != INTL_CODESET_KSC5601_EUC)
+    {
+      int result;
+
+      if (qstr_eval_like_bytes (tar, tar_length, expr, expr_length, escape, coll_id, &result))
+	{
+	  return result;
+	}
+    }
+
   current_collation = lang_get_collation (coll_id);
   intl_pad_char (codeset, pad_char, &pad_char_size);
 
@@ -137,6 +137,18 @@ namespace cubregex
       }
   }
 
+  void
+  clear (cub_regex_object *&regex, char *&pattern, cub_regex_dfa *&dfa)
+  {
+    clear (regex, pattern);
+
+    if (dfa != NULL)
+      {
+	delete dfa;
+	dfa = NULL;
+      }
+  }
+
   bool check_should_recompile (const cub_regex_object *compiled_regex, const char *compiled_pattern,
 			       const std::string &pattern,
 			       const std::regex_constants::syntax_option_type reg_flags)
@@ -157,6 +169,31 @@ namespace cubregex
     return false;
   }
 
+  bool check_should_recompile (const cub_regex_object *compiled_regex, const cub_regex_dfa *compiled_dfa,
+			       const char *compiled_pattern, const std::string &pattern,
+			       const std::regex_constants::syntax_option_type reg_flags)
+  {
+    if (compiled_dfa == NULL)
+      {
+	return check_should_recompile (compiled_regex, compiled_pattern, pattern, reg_flags);
+      }
+
+    /* the regex object is compiled only when a string needs it; the dfa is compiled for one flag set but icase */
+    bool is_icase = (reg_flags & std::regex_constants::icase) != 0;
+    if (is_icase != compiled_dfa->is_icase ())
+      {
+	return true;
+      }
+
+    /* the dfa is kept between executions of an XASL clone, the compiled pattern is not */
+    if (pattern != compiled_dfa->get_pattern ())
+      {
+	return true;
+      }
+
+    return false;
+  }
+
   int compile (cub_regex_object *&compiled_regex, const char *pattern,
 	       const std::regex_constants::syntax_option_type reg_flags, const LANG_COLLATION *collation)
   {
@@ -213,6 +250,32 @@ namespace cubregex
     return error_status;
   }
 
+  cub_regex_dfa *
+  compile_dfa (const char *pattern, const std::regex_constants::syntax_option_type reg_flags,
+	       const LANG_COLLATION *collation)
+  {
+    /* the dfa reads UTF-8 strings as they are stored */
+    if (collation->codeset != INTL_CODESET_UTF8)
+      {
+	return NULL;
+      }
+
+    bool is_icase = (reg_flags & std::regex_constants::icase) != 0;
+    std::regex_constants::syntax_option_type other_flags = reg_flags & ~std::regex_constants::icase;
+    if (other_flags != (std::regex_constants::ECMAScript | std::regex_constants::nosubs))
+      {
+	return NULL;
+      }
+
+    /* dotted and dotless i do not fold to ASCII in turkish */
+    if (is_icase && collation->default_lang != NULL && collation->default_lang->lang_id == INTL_LANG_TURKISH)
+      {
+	return NULL;
+      }
+
+    return cub_regex_dfa::compile (pattern, strlen (pattern), is_icase);
+  }
+
   int search (int &result, const cub_regex_object &reg, const std::string &src, const INTL_CODESET codeset)
   {
     int error_status = NO_ERROR;
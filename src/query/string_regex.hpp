@@ -29,6 +29,7 @@
 
 #include "error_manager.h"
 #include "language_support.h"
+#include "string_regex_dfa.hpp"
 
 // forward declarations
 namespace cubregex
@@ -42,6 +43,7 @@ using cub_compiled_regex = cubregex::compiled_regex;
 using cub_regex_object = std::basic_regex <wchar_t, cubregex::cub_reg_traits>;
 using cub_regex_iterator = std::regex_iterator<std::wstring::iterator, wchar_t, cubregex::cub_reg_traits>;
 using cub_regex_results = std::match_results <std::wstring::iterator>;
+using cub_regex_dfa = cubregex::dfa_matcher;
 
 namespace cubregex
 {
@@ -80,6 +82,7 @@ namespace cubregex
   };
 
   void clear (cub_regex_object *&compiled_regex, char *&compiled_pattern);
+  void clear (cub_regex_object *&compiled_regex, char *&compiled_pattern, cub_regex_dfa *&compiled_dfa);
   int parse_match_type (std::regex_constants::syntax_option_type &reg_flags, std::string &opt_str);
 
   /* because regex_error::what() gives different messages depending on compiler, an error message should be returned by error code of regex_error explicitly. */
@@ -89,8 +92,15 @@ namespace cubregex
 			       const std::string &pattern,
 			       const std::regex_constants::syntax_option_type reg_flags);
 
+  bool check_should_recompile (const cub_regex_object *compiled_regex, const cub_regex_dfa *compiled_dfa,
+			       const char *compiled_pattern, const std::string &pattern,
+			       const std::regex_constants::syntax_option_type reg_flags);
+
   int compile (cub_regex_object *&rx_compiled_regex, const char *pattern,
 	       const std::regex_constants::syntax_option_type reg_flags, const LANG_COLLATION *collation);
+  /* NULL if the pattern, the flags or the collation need std::regex */
+  cub_regex_dfa *compile_dfa (const char *pattern, const std::regex_constants::syntax_option_type reg_flags,
+			      const LANG_COLLATION *collation);
   int search (int &result, const cub_regex_object &reg, const std::string &src, const INTL_CODESET codeset);
 
   int count (int &result, const cub_regex_object &reg, const std::string &src, const int position,
@@ -0,0 +1,1213 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+//
+// string_regex_dfa - linear time regular expression search on UTF-8 strings
+//
+
+#include "string_regex_dfa.hpp"
+
+#include <algorithm>
+#include <array>
+#include <new>
+
+namespace cubregex
+{
+  static const std::uint32_t MAX_CODE_POINT = 0x10FFFF;
+
+  //
+  // UTF-8 decoding; overlong forms and code points above U+10FFFF are invalid, as for the std::codecvt_utf8 used to
+  // convert strings for std::regex (which lets encoded surrogates through)
+  //
+  static bool
+  decode_utf8 (const unsigned char *&p, const unsigned char *end, std::uint32_t &cp)
+  {
+    unsigned char c = *p;
+    std::uint32_t min_cp;
+    int len;
+
+    if (c < 0x80)
+      {
+	cp = c;
+	p++;
+	return true;
+      }
+    else if (c >= 0xC2 && c <= 0xDF)
+      {
+	cp = c & 0x1F;
+	min_cp = 0x80;
+	len = 2;
+      }
+    else if (c >= 0xE0 && c <= 0xEF)
+      {
+	cp = c & 0x0F;
+	min_cp = 0x800;
+	len = 3;
+      }
+    else if (c >= 0xF0 && c <= 0xF4)
+      {
+	cp = c & 0x07;
+	min_cp = 0x10000;
+	len = 4;
+      }
+    else
+      {
+	return false;
+      }
+
+    if (end - p < len)
+      {
+	return false;
+      }
+
+    for (int i = 1; i < len; i++)
+      {
+	if ((p[i] & 0xC0) != 0x80)
+	  {
+	    return false;
+	  }
+	cp = (cp << 6) | (p[i] & 0x3F);
+      }
+
+    if (cp < min_cp || cp > MAX_CODE_POINT)
+      {
+	return false;
+      }
+
+    p += len;
+    return true;
+  }
+
+  static bool
+  is_valid_utf8 (const unsigned char *p, const unsigned char *end)
+  {
+    std::uint32_t cp;
+
+    while (p < end)
+      {
+	if (*p < 0x80)
+	  {
+	    p++;
+	  }
+	else if (!decode_utf8 (p, end, cp))
+	  {
+	    return false;
+	  }
+      }
+    return true;
+  }
+
+  //
+  // char_class - a set of code points, kept as sorted disjoint ranges; ASCII membership is also kept as a table
+  //
+  struct dfa_matcher::char_class
+  {
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> m_ranges;
+    std::array<bool, 128> m_ascii;
+
+    void add (std::uint32_t lo, std::uint32_t hi)
+    {
+      m_ranges.emplace_back (lo, hi);
+    }
+
+    void add_case_variants ()
+    {
+      std::size_t count = m_ranges.size ();
+
+      for (std::size_t i = 0; i < count; i++)
+	{
+	  std::uint32_t lo = m_ranges[i].first;
+	  std::uint32_t hi = m_ranges[i].second;
+
+	  if (lo <= 'z' && hi >= 'a')
+	    {
+	      add (std::max<std::uint32_t> (lo, 'a') - 'a' + 'A', std::min<std::uint32_t> (hi, 'z') - 'a' + 'A');
+	    }
+	  if (lo <= 'Z' && hi >= 'A')
+	    {
+	      add (std::max<std::uint32_t> (lo, 'A') - 'A' + 'a', std::min<std::uint32_t> (hi, 'Z') - 'A' + 'a');
+	    }
+	}
+    }
+
+    // sort and merge the ranges, negate them if needed and fill the ASCII table
+    void finish (bool negate)
+    {
+      std::vector<std::pair<std::uint32_t, std::uint32_t>> merged;
+
+      std::sort (m_ranges.begin (), m_ranges.end ());
+      for (const auto &range : m_ranges)
+	{
+	  if (!merged.empty () && range.first <= merged.back ().second + 1)
+	    {
+	      merged.back ().second = std::max (merged.back ().second, range.second);
+	    }
+	  else
+	    {
+	      merged.push_back (range);
+	    }
+	}
+
+      if (negate)
+	{
+	  std::vector<std::pair<std::uint32_t, std::uint32_t>> negated;
+	  std::uint32_t next = 0;
+
+	  for (const auto &range : merged)
+	    {
+	      if (range.first > next)
+		{
+		  negated.emplace_back (next, range.first - 1);
+		}
+	      next = range.second + 1;
+	    }
+	  if (next <= MAX_CODE_POINT)
+	    {
+	      negated.emplace_back (next, MAX_CODE_POINT);
+	    }
+	  merged.swap (negated);
+	}
+
+      m_ranges.swap (merged);
+
+      for (std::uint32_t c = 0; c < 128; c++)
+	{
+	  m_ascii[c] = contains (c);
+	}
+    }
+
+    bool contains (std::uint32_t cp) const
+    {
+      auto it = std::upper_bound (m_ranges.begin (), m_ranges.end (), std::make_pair (cp, MAX_CODE_POINT + 1));
+
+      return it != m_ranges.begin () && cp <= (it - 1)->second;
+    }
+
+    bool matches (std::uint32_t cp) const
+    {
+      return cp < 128 ? m_ascii[cp] : contains (cp);
+    }
+  };
+
+  //
+  // instruction - a Thompson NFA instruction
+  //
+  struct dfa_matcher::instruction
+  {
+    enum opcode
+    {
+      OP_CLASS,		// consume a code point of m_classes[arg]
+      OP_SPLIT,		// continue at both x and y
+      OP_JUMP,		// continue at x
+      OP_BOL,		// begin of string
+      OP_EOL,		// end of string
+      OP_MATCH
+    };
+
+    opcode op;
+    int arg;
+    int x;
+    int y;
+  };
+
+  //
+  // dfa_state - a set of NFA instructions that are live at the same position of the string
+  //
+  //  the set holds OP_CLASS instructions waiting for the next code point, OP_EOL instructions waiting for the end of
+  //  the string and OP_MATCH.
+  //
+  struct dfa_matcher::dfa_state
+  {
+    std::vector<int> m_nfa_states;
+    bool m_is_match;
+    std::array<state_id, 128> m_next_ascii;
+    std::unordered_map<std::uint32_t, state_id> m_next_other;
+  };
+
+  //
+  // parser - parse the pattern into a syntax tree and generate the NFA program
+  //
+  class dfa_matcher::parser
+  {
+    public:
+      parser (dfa_matcher &matcher, const char *pattern, std::size_t pattern_size)
+	: m_matcher (matcher)
+	, m_pos (reinterpret_cast<const unsigned char *> (pattern))
+	, m_end (reinterpret_cast<const unsigned char *> (pattern) + pattern_size)
+      {
+      }
+
+      bool parse_and_generate ()
+      {
+	node root;
+
+	if (!parse_alternation (root) || m_pos != m_end)
+	  {
+	    return false;
+	  }
+	if (!generate (root))
+	  {
+	    return false;
+	  }
+	return emit (instruction::OP_MATCH) >= 0;
+      }
+
+    private:
+      struct node
+      {
+	enum node_type
+	{
+	  EMPTY,
+	  CLASS,
+	  BOL,
+	  EOL,
+	  CONCAT,
+	  ALTERNATE,
+	  REPEAT
+	};
+
+	node_type type = EMPTY;
+	int cls = -1;
+	int min = 0;
+	int max = 0;		// -1 if unbounded
+	std::vector<node> children;
+      };
+
+      static const int MAX_REPEAT = 1000;
+
+      bool at_end () const
+      {
+	return m_pos == m_end;
+      }
+
+      bool peek (unsigned char c) const
+      {
+	return m_pos < m_end && *m_pos == c;
+      }
+
+      bool parse_alternation (node &result)
+      {
+	node branch;
+
+	if (!parse_concat (branch))
+	  {
+	    return false;
+	  }
+	if (!peek ('|'))
+	  {
+	    result = std::move (branch);
+	    return true;
+	  }
+
+	result.type = node::ALTERNATE;
+	result.children.push_back (std::move (branch));
+	while (peek ('|'))
+	  {
+	    m_pos++;
+	    branch = node ();
+	    if (!parse_concat (branch))
+	      {
+		return false;
+	      }
+	    result.children.push_back (std::move (branch));
+	  }
+	return true;
+      }
+
+      bool parse_concat (node &result)
+      {
+	result.type = node::CONCAT;
+	while (!at_end () && !peek ('|') && !peek (')'))
+	  {
+	    node atom;
+
+	    if (!parse_atom (atom) || !parse_quantifier (atom))
+	      {
+		return false;
+	      }
+	    result.children.push_back (std::move (atom));
+	  }
+	return true;
+      }
+
+      bool parse_atom (node &result)
+      {
+	std::uint32_t cp;
+
+	switch (*m_pos)
+	  {
+	  case '^':
+	    m_pos++;
+	    result.type = node::BOL;
+	    return true;
+	  case '$':
+	    m_pos++;
+	    result.type = node::EOL;
+	    return true;
+	  case '.':
+	    m_pos++;
+	    result.type = node::CLASS;
+	    result.cls = new_class ();
+	    m_matcher.m_classes[result.cls].add ('\n', '\n');
+	    m_matcher.m_classes[result.cls].add ('\r', '\r');
+	    m_matcher.m_classes[result.cls].finish (true);
+	    return true;
+	  case '(':
+	    m_pos++;
+	    if (peek ('?'))
+	      {
+		// only non-capturing groups; lookahead assertions need backtracking
+		if (m_end - m_pos < 2 || m_pos[1] != ':')
+		  {
+		    return false;
+		  }
+		m_pos += 2;
+	      }
+	    if (!parse_alternation (result) || !peek (')'))
+	      {
+		return false;
+	      }
+	    m_pos++;
+	    return true;
+	  case '[':
+	    m_pos++;
+	    return parse_bracket (result);
+	  case '\\':
+	    {
+	      bool is_single;
+
+	      m_pos++;
+	      result.type = node::CLASS;
+	      result.cls = new_class ();
+	      if (!parse_escape (m_matcher.m_classes[result.cls], is_single, cp))
+		{
+		  return false;
+		}
+	      if (is_single)
+		{
+		  m_matcher.m_classes[result.cls].add (cp, cp);
+		}
+	      return finish_class (result.cls, false);
+	    }
+	  case '*':
+	  case '+':
+	  case '?':
+	  case '{':
+	  case '}':
+	  case ']':
+	  case ')':
+	    return false;
+	  default:
+	    if (!decode_utf8 (m_pos, m_end, cp))
+	      {
+		return false;
+	      }
+	    result.type = node::CLASS;
+	    result.cls = new_class ();
+	    m_matcher.m_classes[result.cls].add (cp, cp);
+	    return finish_class (result.cls, false);
+	  }
+      }
+
+      bool parse_quantifier (node &atom)
+      {
+	int min, max;
+
+	if (at_end ())
+	  {
+	    return true;
+	  }
+
+	switch (*m_pos)
+	  {
+	  case '*':
+	    min = 0;
+	    max = -1;
+	    m_pos++;
+	    break;
+	  case '+':
+	    min = 1;
+	    max = -1;
+	    m_pos++;
+	    break;
+	  case '?':
+	    min = 0;
+	    max = 1;
+	    m_pos++;
+	    break;
+	  case '{':
+	    m_pos++;
+	    if (!parse_number (min))
+	      {
+		return false;
+	      }
+	    max = min;
+	    if (peek (','))
+	      {
+		m_pos++;
+		max = -1;
+		if (!peek ('}') && !parse_number (max))
+		  {
+		    return false;
+		  }
+	      }
+	    if (!peek ('}') || (max != -1 && max < min))
+	      {
+		return false;
+	      }
+	    m_pos++;
+	    break;
+	  default:
+	    return true;
+	  }
+
+	if (atom.type == node::BOL || atom.type == node::EOL)
+	  {
+	    return false;
+	  }
+
+	// a lazy quantifier matches the same strings as the greedy one
+	if (peek ('?'))
+	  {
+	    m_pos++;
+	  }
+
+	if (!at_end () && (*m_pos == '*' || *m_pos == '+' || *m_pos == '?' || *m_pos == '{'))
+	  {
+	    return false;
+	  }
+
+	node repeat;
+	repeat.type = node::REPEAT;
+	repeat.min = min;
+	repeat.max = max;
+	repeat.children.push_back (std::move (atom));
+	atom = std::move (repeat);
+	return true;
+      }
+
+      bool parse_number (int &value)
+      {
+	value = 0;
+	if (at_end () || *m_pos < '0' || *m_pos > '9')
+	  {
+	    return false;
+	  }
+	while (!at_end () && *m_pos >= '0' && *m_pos <= '9')
+	  {
+	    value = value * 10 + (*m_pos - '0');
+	    if (value > MAX_REPEAT)
+	      {
+		return false;
+	      }
+	    m_pos++;
+	  }
+	return true;
+      }
+
+      bool parse_hex (int digits, std::uint32_t &cp)
+      {
+	cp = 0;
+	for (int i = 0; i < digits; i++, m_pos++)
+	  {
+	    if (at_end ())
+	      {
+		return false;
+	      }
+
+	    unsigned char c = *m_pos;
+	    if (c >= '0' && c <= '9')
+	      {
+		cp = cp * 16 + (c - '0');
+	      }
+	    else if (c >= 'a' && c <= 'f')
+	      {
+		cp = cp * 16 + (c - 'a' + 10);
+	      }
+	    else if (c >= 'A' && c <= 'F')
+	      {
+		cp = cp * 16 + (c - 'A' + 10);
+	      }
+	    else
+	      {
+		return false;
+	      }
+	  }
+	return true;
+      }
+
+      // parse an escape sequence after '\'; a single code point is returned in cp, a class escape is added to cls
+      bool parse_escape (char_class &cls, bool &is_single, std::uint32_t &cp)
+      {
+	is_single = false;
+	if (at_end ())
+	  {
+	    return false;
+	  }
+
+	unsigned char c = *m_pos++;
+	switch (c)
+	  {
+	  case 'd':
+	  case 'D':
+	  case 'w':
+	  case 'W':
+	  case 's':
+	  case 'S':
+	    add_class_escape (cls, c);
+	    return true;
+	  case 'n':
+	    cp = '\n';
+	    break;
+	  case 't':
+	    cp = '\t';
+	    break;
+	  case 'r':
+	    cp = '\r';
+	    break;
+	  case 'f':
+	    cp = '\f';
+	    break;
+	  case 'v':
+	    cp = '\v';
+	    break;
+	  case 'x':
+	    if (!parse_hex (2, cp))
+	      {
+		return false;
+	      }
+	    break;
+	  case 'u':
+	    if (!parse_hex (4, cp) || (cp >= 0xD800 && cp <= 0xDFFF))
+	      {
+		return false;
+	      }
+	    break;
+	  default:
+	    // word boundaries, back references, \0, \c and other letter escapes are left to std::regex
+	    if (c >= 0x80 || (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_')
+	      {
+		return false;
+	      }
+	    cp = c;
+	    break;
+	  }
+
+	is_single = true;
+	return true;
+      }
+
+      // \d \w \s and their negations; their meaning for non-ASCII code points depends on the locale
+      void add_class_escape (char_class &cls, unsigned char c)
+      {
+	char_class ascii;
+
+	switch (c)
+	  {
+	  case 'd':
+	  case 'D':
+	    ascii.add ('0', '9');
+	    break;
+	  case 'w':
+	  case 'W':
+	    ascii.add ('0', '9');
+	    ascii.add ('A', 'Z');
+	    ascii.add ('a', 'z');
+	    ascii.add ('_', '_');
+	    break;
+	  default:
+	    ascii.add ('\t', '\r');
+	    ascii.add (' ', ' ');
+	    break;
+	  }
+
+	if (c >= 'a')
+	  {
+	    cls.m_ranges.insert (cls.m_ranges.end (), ascii.m_ranges.begin (), ascii.m_ranges.end ());
+	  }
+	else
+	  {
+	    ascii.finish (true);
+	    cls.m_ranges.insert (cls.m_ranges.end (), ascii.m_ranges.begin (), ascii.m_ranges.end ());
+	  }
+	m_matcher.m_locale_sensitive = true;
+      }
+
+      bool parse_bracket (node &result)
+      {
+	bool negate = false;
+
+	result.type = node::CLASS;
+	result.cls = new_class ();
+
+	if (peek ('^'))
+	  {
+	    negate = true;
+	    m_pos++;
+	  }
+
+	// an empty bracket expression or one starting with ']' is handled differently by implementations
+	if (at_end () || peek (']'))
+	  {
+	    return false;
+	  }
+
+	while (!peek (']'))
+	  {
+	    std::uint32_t lo, hi;
+	    bool is_single;
+
+	    if (at_end () || !parse_bracket_item (result.cls, lo, is_single))
+	      {
+		return false;
+	      }
+
+	    if (is_single && peek ('-') && m_end - m_pos >= 2 && m_pos[1] != ']')
+	      {
+		// range
+		m_pos++;
+		if (!parse_bracket_item (result.cls, hi, is_single) || !is_single || hi < lo)
+		  {
+		    return false;
+		  }
+		m_matcher.m_classes[result.cls].add (lo, hi);
+	      }
+	    else if (is_single)
+	      {
+		m_matcher.m_classes[result.cls].add (lo, lo);
+	      }
+
+	    // '-' after a range or a class escape is literal only as the last character
+	    if (peek ('-') && m_end - m_pos >= 2 && m_pos[1] != ']')
+	      {
+		return false;
+	      }
+	  }
+	m_pos++;
+
+	return finish_class (result.cls, negate);
+      }
+
+      // one character or class escape of a bracket expression; single code points are returned, not added
+      bool parse_bracket_item (int cls, std::uint32_t &cp, bool &is_single)
+      {
+	if (at_end ())
+	  {
+	    return false;
+	  }
+
+	if (*m_pos == '\\')
+	  {
+	    m_pos++;
+	    // \b is a backspace in a bracket expression, but not all implementations agree
+	    if (!at_end () && (*m_pos == 'b' || *m_pos == 'B'))
+	      {
+		return false;
+	      }
+	    return parse_escape (m_matcher.m_classes[cls], is_single, cp);
+	  }
+
+	if (*m_pos == '[' && m_end - m_pos >= 2 && (m_pos[1] == ':' || m_pos[1] == '.' || m_pos[1] == '='))
+	  {
+	    // character class, collating element and equivalence class names
+	    return false;
+	  }
+
+	is_single = true;
+	return decode_utf8 (m_pos, m_end, cp);
+      }
+
+      int new_class ()
+      {
+	m_matcher.m_classes.emplace_back ();
+	return (int) m_matcher.m_classes.size () - 1;
+      }
+
+      bool finish_class (int cls, bool negate)
+      {
+	char_class &char_cls = m_matcher.m_classes[cls];
+
+	if (m_matcher.m_icase)
+	  {
+	    // case folding of non-ASCII characters depends on the locale; leave it to std::regex
+	    for (const auto &range : char_cls.m_ranges)
+	      {
+		if (range.second >= 0x80)
+		  {
+		    return false;
+		  }
+	      }
+	    char_cls.add_case_variants ();
+	  }
+	char_cls.finish (negate);
+	return true;
+      }
+
+      int emit (instruction::opcode op, int arg = -1)
+      {
+	if (m_matcher.m_program.size () >= MAX_INSTRUCTIONS)
+	  {
+	    return -1;
+	  }
+	m_matcher.m_program.push_back ({ op, arg, -1, -1 });
+	return (int) m_matcher.m_program.size () - 1;
+      }
+
+      int next_pc () const
+      {
+	return (int) m_matcher.m_program.size ();
+      }
+
+      bool generate (const node &n)
+      {
+	std::vector<instruction> &program = m_matcher.m_program;
+	std::vector<int> to_end;
+	int pc;
+
+	switch (n.type)
+	  {
+	  case node::EMPTY:
+	    return true;
+
+	  case node::CLASS:
+	    return emit (instruction::OP_CLASS, n.cls) >= 0;
+
+	  case node::BOL:
+	    return emit (instruction::OP_BOL) >= 0;
+
+	  case node::EOL:
+	    return emit (instruction::OP_EOL) >= 0;
+
+	  case node::CONCAT:
+	    for (const node &child : n.children)
+	      {
+		if (!generate (child))
+		  {
+		    return false;
+		  }
+	      }
+	    return true;
+
+	  case node::ALTERNATE:
+	    //    split L1, L2
+	    // L1: child 1
+	    //    jump END
+	    // L2: split ...
+	    //     child n
+	    // END:
+	    for (std::size_t i = 0; i < n.children.size (); i++)
+	      {
+		int split = -1;
+
+		if (i + 1 < n.children.size ())
+		  {
+		    split = emit (instruction::OP_SPLIT);
+		    if (split < 0)
+		      {
+			return false;
+		      }
+		    program[split].x = next_pc ();
+		  }
+		if (!generate (n.children[i]))
+		  {
+		    return false;
+		  }
+		if (split >= 0)
+		  {
+		    pc = emit (instruction::OP_JUMP);
+		    if (pc < 0)
+		      {
+			return false;
+		      }
+		    to_end.push_back (pc);
+		    program[split].y = next_pc ();
+		  }
+	      }
+	    for (int jump : to_end)
+	      {
+		program[jump].x = next_pc ();
+	      }
+	    return true;
+
+	  case node::REPEAT:
+	    for (int i = 0; i < n.min; i++)
+	      {
+		if (!generate (n.children[0]))
+		  {
+		    return false;
+		  }
+	      }
+	    if (n.max == -1)
+	      {
+		// L: split L1, END
+		// L1: child
+		//    jump L
+		// END:
+		int split = emit (instruction::OP_SPLIT);
+		if (split < 0)
+		  {
+		    return false;
+		  }
+		program[split].x = next_pc ();
+		if (!generate (n.children[0]))
+		  {
+		    return false;
+		  }
+		pc = emit (instruction::OP_JUMP);
+		if (pc < 0)
+		  {
+		    return false;
+		  }
+		program[pc].x = split;
+		program[split].y = next_pc ();
+		return true;
+	      }
+	    // optional copies: split L1, END; L1: child; split L2, END; L2: child ... END:
+	    for (int i = n.min; i < n.max; i++)
+	      {
+		int split = emit (instruction::OP_SPLIT);
+		if (split < 0)
+		  {
+		    return false;
+		  }
+		program[split].x = next_pc ();
+		to_end.push_back (split);
+		if (!generate (n.children[0]))
+		  {
+		    return false;
+		  }
+	      }
+	    for (int split : to_end)
+	      {
+		program[split].y = next_pc ();
+	      }
+	    return true;
+	  }
+
+	return false;
+      }
+
+      dfa_matcher &m_matcher;
+      const unsigned char *m_pos;
+      const unsigned char *m_end;
+  };
+
+  const dfa_matcher::state_id dfa_matcher::UNKNOWN_STATE;
+  const std::size_t dfa_matcher::MAX_INSTRUCTIONS;
+  const std::size_t dfa_matcher::MAX_DFA_STATES;
+
+  dfa_matcher::dfa_matcher (const char *pattern, std::size_t pattern_size, bool icase)
+    : m_pattern (pattern, pattern_size)
+    , m_icase (icase)
+    , m_locale_sensitive (icase)
+    , m_classes ()
+    , m_program ()
+    , m_states ()
+    , m_state_index ()
+    , m_start_state (UNKNOWN_STATE)
+  {
+  }
+
+  dfa_matcher::~dfa_matcher ()
+  {
+  }
+
+  dfa_matcher *
+  dfa_matcher::compile (const char *pattern, std::size_t pattern_size, bool icase)
+  {
+    dfa_matcher *matcher = new (std::nothrow) dfa_matcher (pattern, pattern_size, icase);
+    if (matcher == NULL)
+      {
+	return NULL;
+      }
+
+    parser p (*matcher, pattern, pattern_size);
+    if (!p.parse_and_generate ())
+      {
+	delete matcher;
+	return NULL;
+      }
+
+    return matcher;
+  }
+
+  //
+  // add_closure - add instructions reachable from pc without consuming a code point
+  //
+  void
+  dfa_matcher::add_closure (int pc, bool at_begin, std::vector<int> &nfa_states, std::vector<char> &on_list) const
+  {
+    std::vector<int> stack;
+
+    stack.push_back (pc);
+    while (!stack.empty ())
+      {
+	pc = stack.back ();
+	stack.pop_back ();
+	if (on_list[pc])
+	  {
+	    continue;
+	  }
+	on_list[pc] = 1;
+
+	const instruction &inst = m_program[pc];
+	switch (inst.op)
+	  {
+	  case instruction::OP_JUMP:
+	    stack.push_back (inst.x);
+	    break;
+	  case instruction::OP_SPLIT:
+	    stack.push_back (inst.y);
+	    stack.push_back (inst.x);
+	    break;
+	  case instruction::OP_BOL:
+	    if (at_begin)
+	      {
+		stack.push_back (pc + 1);
+	      }
+	    break;
+	  case instruction::OP_CLASS:
+	  case instruction::OP_EOL:
+	  case instruction::OP_MATCH:
+	    nfa_states.push_back (pc);
+	    break;
+	  }
+      }
+  }
+
+  dfa_matcher::state_id
+  dfa_matcher::get_state (std::vector<int> &nfa_states)
+  {
+    std::sort (nfa_states.begin (), nfa_states.end ());
+
+    auto found = m_state_index.find (nfa_states);
+    if (found != m_state_index.end ())
+      {
+	return found->second;
+      }
+
+    if (m_states.size () >= MAX_DFA_STATES)
+      {
+	// too many states for this pattern; start over instead of growing without limit
+	reset_states ();
+      }
+
+    dfa_state state;
+    state.m_nfa_states = nfa_states;
+    state.m_is_match = false;
+    for (int pc : nfa_states)
+      {
+	if (m_program[pc].op == instruction::OP_MATCH)
+	  {
+	    state.m_is_match = true;
+	  }
+      }
+    state.m_next_ascii.fill (UNKNOWN_STATE);
+
+    state_id id = (state_id) m_states.size ();
+    m_states.push_back (std::move (state));
+    m_state_index.emplace (nfa_states, id);
+    return id;
+  }
+
+  dfa_matcher::state_id
+  dfa_matcher::get_start_state ()
+  {
+    if (m_start_state == UNKNOWN_STATE)
+      {
+	std::vector<int> nfa_states;
+	std::vector<char> on_list (m_program.size (), 0);
+
+	add_closure (0, true, nfa_states, on_list);
+	m_start_state = get_state (nfa_states);
+      }
+    return m_start_state;
+  }
+
+  dfa_matcher::state_id
+  dfa_matcher::step (state_id from, std::uint32_t cp)
+  {
+    std::vector<int> nfa_states;
+    std::vector<char> on_list (m_program.size (), 0);
+
+    for (int pc : m_states[from].m_nfa_states)
+      {
+	const instruction &inst = m_program[pc];
+	if (inst.op == instruction::OP_CLASS && m_classes[inst.arg].matches (cp))
+	  {
+	    add_closure (pc + 1, false, nfa_states, on_list);
+	  }
+      }
+    // the search is not anchored; a match may also start after cp
+    add_closure (0, false, nfa_states, on_list);
+
+    std::size_t state_count = m_states.size ();
+    state_id to = get_state (nfa_states);
+    if (m_states.size () < state_count)
+      {
+	// states were reset; from no longer exists
+	return to;
+      }
+
+    if (cp < 128)
+      {
+	m_states[from].m_next_ascii[cp] = to;
+      }
+    else
+      {
+	m_states[from].m_next_other.emplace (cp, to);
+      }
+    return to;
+  }
+
+  bool
+  dfa_matcher::matches_at_end (const dfa_state &state) const
+  {
+    for (int pc : state.m_nfa_states)
+      {
+	if (m_program[pc].op != instruction::OP_EOL)
+	  {
+	    continue;
+	  }
+
+	// follow the instructions after $; only more assertions can be satisfied at the end
+	std::vector<int> stack;
+	std::vector<char> on_list (m_program.size (), 0);
+
+	stack.push_back (pc + 1);
+	while (!stack.empty ())
+	  {
+	    int next = stack.back ();
+	    stack.pop_back ();
+	    if (on_list[next])
+	      {
+		continue;
+	      }
+	    on_list[next] = 1;
+
+	    const instruction &inst = m_program[next];
+	    switch (inst.op)
+	      {
+	      case instruction::OP_MATCH:
+		return true;
+	      case instruction::OP_JUMP:
+		stack.push_back (inst.x);
+		break;
+	      case instruction::OP_SPLIT:
+		stack.push_back (inst.y);
+		stack.push_back (inst.x);
+		break;
+	      case instruction::OP_EOL:
+		stack.push_back (next + 1);
+		break;
+	      case instruction::OP_BOL:
+		// only reached from the start state of an empty string, which is handled by the caller
+	      case instruction::OP_CLASS:
+		break;
+	      }
+	  }
+      }
+    return false;
+  }
+
+  void
+  dfa_matcher::reset_states ()
+  {
+    m_states.clear ();
+    m_state_index.clear ();
+    m_start_state = UNKNOWN_STATE;
+  }
+
+  dfa_matcher::search_result
+  dfa_matcher::search (const char *str, std::size_t str_size)
+  {
+    const unsigned char *p = reinterpret_cast<const unsigned char *> (str);
+    const unsigned char *end = p + str_size;
+
+    if (str_size == 0)
+      {
+	// both ^ and $ hold; run the whole program on the empty string
+	std::vector<int> nfa_states;
+	std::vector<char> on_list (m_program.size (), 0);
+
+	add_closure (0, true, nfa_states, on_list);
+	for (std::size_t i = 0; i < nfa_states.size (); i++)
+	  {
+	    const instruction &inst = m_program[nfa_states[i]];
+	    if (inst.op == instruction::OP_MATCH)
+	      {
+		return MATCH;
+	      }
+	    if (inst.op == instruction::OP_EOL)
+	      {
+		add_closure (nfa_states[i] + 1, true, nfa_states, on_list);
+	      }
+	  }
+	return NO_MATCH;
+      }
+
+    state_id state = get_start_state ();
+    while (!m_states[state].m_is_match)
+      {
+	if (p == end)
+	  {
+	    return matches_at_end (m_states[state]) ? MATCH : NO_MATCH;
+	  }
+	if (m_states[state].m_nfa_states.empty ())
+	  {
+	    // anchored pattern that can no longer match; only check the rest of the string is valid
+	    break;
+	  }
+
+	std::uint32_t cp;
+	state_id next;
+	if (*p < 0x80)
+	  {
+	    cp = *p++;
+	    if (m_locale_sensitive && cp >= 0x1C && cp <= 0x1F)
+	      {
+		// information separators are white space in some locales only
+		return NEED_FALLBACK;
+	      }
+	    next = m_states[state].m_next_ascii[cp];
+	  }
+	else
+	  {
+	    if (!decode_utf8 (p, end, cp))
+	      {
+		return NO_MATCH;
+	      }
+	    if (m_locale_sensitive)
+	      {
+		return NEED_FALLBACK;
+	      }
+	    auto found = m_states[state].m_next_other.find (cp);
+	    next = found != m_states[state].m_next_other.end () ? found->second : UNKNOWN_STATE;
+	  }
+
+	state = next != UNKNOWN_STATE ? next : step (state, cp);
+      }
+
+    // std::regex would not have been run at all on an invalid string
+    if (!is_valid_utf8 (p, end))
+      {
+	return NO_MATCH;
+      }
+    return m_states[state].m_is_match ? MATCH : NO_MATCH;
+  }
+} // namespace cubregex
@@ -0,0 +1,135 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+//
+// string_regex_dfa - linear time regular expression search on UTF-8 strings
+//
+
+#ifndef _STRING_REGEX_DFA_HPP_
+#define _STRING_REGEX_DFA_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace cubregex
+{
+  // dfa_matcher - answers "does the pattern match anywhere in the string" without backtracking
+  //
+  //  how it works:
+  //    the pattern is compiled into a Thompson NFA. the NFA is simulated as a DFA whose states are built lazily, the
+  //    first time they are reached, and are cached for the next strings. each input code point is looked at once, so
+  //    the search time is linear in the size of the string whatever the pattern is.
+  //
+  //    the input is read as UTF-8 bytes; there is no conversion to a wide string.
+  //
+  //  what is supported:
+  //    the ECMAScript subset that can be matched without backtracking: literals, '.', bracket expressions with ranges
+  //    and negation, \d \w \s \D \W \S, ^ and $, groups, alternation and the *, +, ?, {n}, {n,}, {n,m} quantifiers
+  //    (lazy quantifiers are accepted; they do not change whether a string matches).
+  //
+  //    compile returns NULL for anything else (back references, assertions, POSIX classes, ...) and the caller has to
+  //    use std::regex instead.
+  //
+  //  how to use:
+  //    cubregex::dfa_matcher *matcher = cubregex::dfa_matcher::compile (pattern, pattern_size, icase);
+  //    if (matcher != NULL)
+  //      {
+  //        switch (matcher->search (str, str_size))
+  //          {
+  //          case cubregex::dfa_matcher::MATCH: ...
+  //          case cubregex::dfa_matcher::NO_MATCH: ...
+  //          case cubregex::dfa_matcher::NEED_FALLBACK: ...   // result depends on the locale; use std::regex
+  //          }
+  //      }
+  //
+  //  a matcher is not thread safe; search builds DFA states.
+  //
+  class dfa_matcher
+  {
+    public:
+      enum search_result
+      {
+	NO_MATCH,
+	MATCH,
+	NEED_FALLBACK
+      };
+
+      dfa_matcher (const dfa_matcher &) = delete;
+      dfa_matcher (dfa_matcher &&) = delete;
+
+      ~dfa_matcher ();
+
+      dfa_matcher &operator= (const dfa_matcher &) = delete;
+      dfa_matcher &operator= (dfa_matcher &&) = delete;
+
+      // NULL if the pattern is invalid or not supported
+      static dfa_matcher *compile (const char *pattern, std::size_t pattern_size, bool icase);
+
+      // invalid UTF-8 never matches
+      search_result search (const char *str, std::size_t str_size);
+
+      bool is_icase () const
+      {
+	return m_icase;
+      }
+
+      const std::string &get_pattern () const
+      {
+	return m_pattern;
+      }
+
+    private:
+      struct char_class;
+      struct instruction;
+      struct dfa_state;
+      class parser;
+
+      using state_id = int;
+
+      static const state_id UNKNOWN_STATE = -1;
+      static const std::size_t MAX_INSTRUCTIONS = 10000;
+      static const std::size_t MAX_DFA_STATES = 2048;
+
+      dfa_matcher (const char *pattern, std::size_t pattern_size, bool icase);
+
+      void add_closure (int pc, bool at_begin, std::vector<int> &nfa_states, std::vector<char> &on_list) const;
+      state_id get_state (std::vector<int> &nfa_states);
+      state_id get_start_state ();
+      state_id step (state_id from, std::uint32_t cp);
+      bool matches_at_end (const dfa_state &state) const;
+      void reset_states ();
+
+      std::string m_pattern;	// kept for cubregex::check_should_recompile; it outlives the caller's copy
+      bool m_icase;
+      bool m_locale_sensitive;	// the result for some code points depends on the locale of std::regex
+
+      std::vector<char_class> m_classes;
+      std::vector<instruction> m_program;
+
+      std::vector<dfa_state> m_states;
+      std::map<std::vector<int>, state_id> m_state_index;
+      state_id m_start_state;
+  };
+} // namespace cubregex
+
+#endif // _STRING_REGEX_DFA_HPP_
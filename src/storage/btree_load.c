@@ -33,6 +33,7 @@
 #include "btree.h"
 #include "dbtype.h"
 #include "external_sort.h"
+#include "file_manager.h"
 #include "heap_file.h"
 #include "log_append.hpp"
 #include "log_manager.h"
@@ -54,6 +55,18 @@
 #include "xasl.h"
 #include "xasl_unpack_info.hpp"
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#if defined (SERVER_MODE)
+#define BTREE_LOAD_EXTRACT_BATCH_PAGES 16	/* heap pages taken at once by a key extract worker */
+#define BTREE_LOAD_EXTRACT_CHUNK_SIZE (256 * 1024)	/* size of the chunks of sort items of key extract workers */
+#define BTREE_LOAD_EXTRACT_ITEM_HEADER_SIZE (DB_ALIGN (OR_INT_SIZE, MAX_ALIGNMENT))
+#endif /* SERVER_MODE */
+
 typedef struct sort_args SORT_ARGS;
 struct sort_args
 {				/* Collection of information required for "sr_index_sort" */
@@ -216,6 +229,122 @@ class index_builder_loader_task: public cubthread::entry_task
     void clear_keys ();
 };
 
+#if defined (SERVER_MODE)
+// class btree_load_extract_context
+//
+//  description:
+//    key extract workers borrow the transaction of the index load; they are reset when retired to pool
+//
+class btree_load_extract_context : public cubthread::entry_manager
+{
+  protected:
+    void on_recycle (context_type & context) override
+    {
+      context.tran_index = NULL_TRAN_INDEX;
+      context.conn_entry = NULL;
+    }
+};
+
+// class btree_load_extract
+//
+//  description:
+//    extracts the sort items of an index load with several workers. the workers take batches of heap pages in the
+//    order of the heap chain, produce the sort items of the objects of each page into chunks and queue the chunks.
+//    the sorting thread consumes the chunks in the order they were queued; since the items are sorted afterwards,
+//    the order of the pages does not matter.
+//
+//    the number of queued chunks is limited; workers wait for the sorting thread when the queue is full.
+//
+class btree_load_extract
+{
+  public:
+    btree_load_extract (const SORT_ARGS & sort_args, int tran_index, css_conn_entry * conn_entry);
+    ~btree_load_extract ();
+
+    bool start (int worker_count);
+    void stop_and_wait ();
+    SORT_STATUS get_next (RECDES * temp_recdes);
+    void execute (cubthread::entry & thread_ref);
+
+    int get_n_oids () const
+    {
+      return m_n_oids;
+    }
+
+    int get_n_nulls () const
+    {
+      return m_n_nulls;
+    }
+
+  private:
+    // a chunk of sort items; each item is its length followed by its aligned data
+    struct chunk
+    {
+      std::vector<char> m_area;
+      std::size_t m_size;	// used part of area
+      std::size_t m_read_pos;	// next item read by the sorting thread
+    };
+
+    int get_next_pages (THREAD_ENTRY * thread_p, VPID * vpids, int & count);
+    int extract_page (THREAD_ENTRY * thread_p, SORT_ARGS & args, const VPID & vpid, chunk *& chunk_p);
+    bool push_chunk (chunk * chunk_p);
+    void end_worker (int error_code, int n_oids, int n_nulls);
+
+    bool is_stopped () const
+    {
+      // pairs with the release store of the thread that stops the extraction
+      return m_is_stopped.load (std::memory_order_acquire);
+    }
+
+    const SORT_ARGS &m_sort_args;
+    const int m_tran_index;
+    css_conn_entry *const m_conn_entry;
+
+    btree_load_extract_context m_context;
+    cubthread::entry_workpool *m_worker_pool;
+    std::size_t m_max_queued_chunks;
+
+    VPID m_next_vpid;		// first page of the next batch; null before the first batch
+    bool m_is_heap_end;
+    PAGE_READ_AHEAD m_read_ahead;
+
+    std::mutex m_mutex;
+    std::condition_variable m_queued_cv;	// a chunk was queued or a worker ended
+    std::condition_variable m_dequeued_cv;	// a chunk was dequeued or the extraction was stopped
+    std::deque<chunk *> m_chunks;
+    chunk *m_read_chunk;
+    int m_workers_running;
+    std::atomic<bool> m_is_stopped;	// read without the mutex by workers between pages
+    int m_error_code;
+    std::vector<char> m_error_area;	// error of the worker that failed, set again on the sorting thread
+
+    int m_n_oids;
+    int m_n_nulls;
+};
+
+// class btree_load_extract_task
+//
+//  description:
+//    a worker of the key extraction of an index load
+//
+class btree_load_extract_task : public cubthread::entry_task
+{
+  public:
+    explicit btree_load_extract_task (btree_load_extract & extract)
+      : m_extract (extract)
+    {
+    }
+
+    void execute (context_type & thread_ref) override
+    {
+      m_extract.execute (thread_ref);
+    }
+
+  private:
+    btree_load_extract &m_extract;
+};
+#endif /* SERVER_MODE */
+
 // *INDENT-ON*
 
 
@@ -238,6 +367,12 @@ static int btree_dump_sort_output (const RECDES * recdes, LOAD_ARGS * load_args)
 #endif /* defined(CUBRID_DEBUG) */
 static int btree_index_sort (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args, SORT_PUT_FUNC * out_func, void *out_args);
 static SORT_STATUS btree_sort_get_next (THREAD_ENTRY * thread_p, RECDES * temp_recdes, void *arg);
+static SORT_STATUS btree_sort_make_item (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args, RECDES * temp_recdes,
+					 bool * is_skipped);
+#if defined (SERVER_MODE)
+static int btree_index_sort_worker_count (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args);
+static SORT_STATUS btree_sort_get_next_parallel (THREAD_ENTRY * thread_p, RECDES * temp_recdes, void *arg);
+#endif /* SERVER_MODE */
 static int compare_driver (const void *first, const void *second, void *arg);
 static int list_add (BTREE_NODE ** list, VPID * pageid);
 static void list_remove_first (BTREE_NODE ** list);
@@ -1209,6 +1344,279 @@ error:
   return NULL;
 }
 
+/*
+ * btree_load_sorted_keys () - build an empty index bottom-up from keys given in key order
+ *   return: NO_ERROR or error code
+ *   btid(in): B+tree index identifier
+ *   bt_name(in): index name
+ *   class_oid(in): class of the objects
+ *   keys(in): keys in key order; none is null and, for a unique index, no two are equal
+ *   oids(in): object of each key
+ *   n_keys(in): number of keys
+ *   is_loaded(out): false if the index is not empty and nothing was done
+ *
+ * Note: The leaves are built by btree_construct_leafs as in xbtree_load_index, but in the pages of the existing
+ * index file, so the index keeps its identifier. The root page is kept fixed during the whole load: a transaction
+ * inserting into the index waits for it and another loader finds the index no longer empty.
+ * The objects are loaded as visible to all, as they are when the class is locked with BU_LOCK. The root page is
+ * logged for undo, so a rollback empties the index again; the pages allocated by the load stay in the index file.
+ */
+int
+btree_load_sorted_keys (THREAD_ENTRY * thread_p, BTID * btid, const char *bt_name, OID * class_oid,
+			DB_VALUE * keys, OID * oids, int n_keys, bool * is_loaded)
+{
+  LOAD_ARGS load_args_info, *load_args;
+  BTID_INT btid_int;
+  VPID root_vpid;
+  PAGE_PTR root_page = NULL;
+  BTREE_ROOT_HEADER *root_header = NULL;
+  MVCCID creator_mvccid;
+  VFID old_ovfid;
+  int num_nulls, num_oids, num_keys;
+  RECDES sort_recdes;
+  char *sort_buf = NULL;
+  int sort_buf_size = 0;
+  int oid_size, key_len, record_size;
+  OR_BUF buf;
+  bool is_sysop_started = false;
+  int i;
+  int error_code = NO_ERROR;
+
+  assert (n_keys > 0);
+
+  *is_loaded = false;
+
+  load_args = &load_args_info;
+  load_args->nleaf.pgptr = NULL;
+  load_args->leaf.pgptr = NULL;
+  load_args->ovf.pgptr = NULL;
+  load_args->leaf_nleaf_recdes.data = NULL;
+  load_args->ovf_recdes.data = NULL;
+  load_args->out_recdes = NULL;
+  load_args->push_list = NULL;
+  load_args->pop_list = NULL;
+  db_make_null (&load_args->current_key);
+
+  btree_get_root_vpid_from_btid (thread_p, btid, &root_vpid);
+  root_page = pgbuf_fix (thread_p, &root_vpid, OLD_PAGE, PGBUF_LATCH_WRITE, PGBUF_UNCONDITIONAL_LATCH);
+  if (root_page == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      return error_code;
+    }
+  (void) pgbuf_check_page_ptype (thread_p, root_page, PAGE_BTREE);
+
+  root_header = btree_get_root_header (thread_p, root_page);
+  if (root_header == NULL)
+    {
+      assert_release (false);
+      error_code = ER_FAILED;
+      goto end;
+    }
+
+  if (root_header->node.node_level != 1 || btree_node_number_of_keys (thread_p, root_page) > 0)
+    {
+      /* not empty; the caller inserts the keys one by one */
+      goto end;
+    }
+
+  btid_int.sys_btid = btid;
+  error_code = btree_glean_root_header_info (thread_p, root_header, &btid_int);
+  if (error_code != NO_ERROR)
+    {
+      goto end;
+    }
+
+  /* the root header of the loaded index is built again; keep what does not come from the load */
+  creator_mvccid = root_header->creator_mvccid;
+  num_nulls = root_header->num_nulls;
+  num_oids = root_header->num_oids;
+  num_keys = root_header->num_keys;
+  old_ovfid = btid_int.ovfid;
+
+  load_args->btid = &btid_int;
+  load_args->bt_name = bt_name;
+  VPID_SET_NULL (&load_args->nleaf.vpid);
+  VPID_SET_NULL (&load_args->leaf.vpid);
+  VPID_SET_NULL (&load_args->ovf.vpid);
+  load_args->n_keys = 0;
+  load_args->curr_non_del_obj_count = 0;
+
+  load_args->leaf_nleaf_recdes.area_size = BTREE_MAX_KEYLEN_INPAGE + BTREE_MAX_OIDLEN_INPAGE;
+  load_args->leaf_nleaf_recdes.length = 0;
+  load_args->leaf_nleaf_recdes.type = REC_HOME;
+  load_args->leaf_nleaf_recdes.data = (char *) os_malloc (load_args->leaf_nleaf_recdes.area_size);
+  if (load_args->leaf_nleaf_recdes.data == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, load_args->leaf_nleaf_recdes.area_size);
+      error_code = ER_OUT_OF_VIRTUAL_MEMORY;
+      goto end;
+    }
+  load_args->ovf_recdes.area_size = DB_PAGESIZE;
+  load_args->ovf_recdes.length = 0;
+  load_args->ovf_recdes.type = REC_HOME;
+  load_args->ovf_recdes.data = (char *) os_malloc (load_args->ovf_recdes.area_size);
+  if (load_args->ovf_recdes.data == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, load_args->ovf_recdes.area_size);
+      error_code = ER_OUT_OF_VIRTUAL_MEMORY;
+      goto end;
+    }
+
+  /* btree_load_new_page needs a system operation */
+  log_sysop_start (thread_p);
+  is_sysop_started = true;
+
+  log_append_undo_data2 (thread_p, RVBT_COPYPAGE, &btid->vfid, root_page, -1, DB_PAGESIZE, root_page);
+
+  /* build the leaves from sort items made like those of btree_sort_make_item */
+  oid_size = BTREE_IS_UNIQUE (btid_int.unique_pk) ? 2 * OR_OID_SIZE : OR_OID_SIZE;
+  for (i = 0; i < n_keys; i++)
+    {
+      assert (!DB_IS_NULL (&keys[i]) && !btree_multicol_key_is_null (&keys[i]));
+
+      key_len = btid_int.key_type->type->get_disk_size_of_value (&keys[i]);
+      record_size = ((int) sizeof (char *) + OR_INT_SIZE + oid_size + 2 * OR_MVCCID_SIZE + key_len
+		     + (int) MAX_ALIGNMENT);
+      if (record_size > sort_buf_size)
+	{
+	  if (sort_buf != NULL)
+	    {
+	      db_private_free_and_init (thread_p, sort_buf);
+	    }
+	  sort_buf = (char *) db_private_alloc (thread_p, record_size + MAX_ALIGNMENT);
+	  if (sort_buf == NULL)
+	    {
+	      sort_buf_size = 0;
+	      error_code = ER_OUT_OF_VIRTUAL_MEMORY;
+	      goto end;
+	    }
+	  sort_buf_size = record_size;
+	}
+
+      sort_recdes.data = PTR_ALIGN (sort_buf, MAX_ALIGNMENT);
+      sort_recdes.area_size = sort_buf_size;
+
+      or_init (&buf, sort_recdes.data, sort_recdes.area_size);
+      (void) or_pad (&buf, sizeof (char *));	/* no next item */
+      (void) or_put_int (&buf, btree_multicol_key_has_null (&keys[i]) ? 1 : 0);
+      if (BTREE_IS_UNIQUE (btid_int.unique_pk))
+	{
+	  (void) or_put_oid (&buf, class_oid);
+	}
+      (void) or_put_oid (&buf, &oids[i]);
+      (void) or_put_mvccid (&buf, MVCCID_ALL_VISIBLE);
+      (void) or_put_mvccid (&buf, MVCCID_NULL);
+      error_code = btid_int.key_type->type->data_writeval (&buf, &keys[i]);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  goto end;
+	}
+      sort_recdes.length = CAST_STRLEN (buf.ptr - buf.buffer);
+
+      error_code = btree_construct_leafs (thread_p, &sort_recdes, load_args);
+      if (error_code != NO_ERROR)
+	{
+	  goto end;
+	}
+    }
+
+  assert (load_args->leaf.pgptr != NULL);
+  if (btree_save_last_leafrec (thread_p, load_args) != NO_ERROR)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_BTREE_LOAD_FAILED, 0);
+      error_code = ER_BTREE_LOAD_FAILED;
+      goto end;
+    }
+  load_args->ovf.pgptr = NULL;
+
+  /* the statistics of a unique index are counted by the caller, as for an insert */
+  if (btree_build_nleafs (thread_p, load_args, num_nulls, num_oids, num_keys) != NO_ERROR)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_BTREE_LOAD_FAILED, 0);
+      error_code = ER_BTREE_LOAD_FAILED;
+      goto end;
+    }
+
+  /* btree_build_nleafs copied the new root into the root page */
+  root_header = btree_get_root_header (thread_p, root_page);
+  if (root_header == NULL)
+    {
+      assert_release (false);
+      error_code = ER_FAILED;
+      goto end;
+    }
+  root_header->creator_mvccid = creator_mvccid;
+
+#if !defined(NDEBUG)
+  (void) btree_verify_tree (thread_p, class_oid, &btid_int, bt_name);
+#endif
+
+  btree_log_page (thread_p, &btid->vfid, root_page);
+  root_page = NULL;
+
+  if (VFID_ISNULL (&old_ovfid) && !VFID_ISNULL (&btid_int.ovfid))
+    {
+      BTREE_SET_CREATED_OVERFLOW_KEY_NOTIFICATION (thread_p, NULL, NULL, class_oid, btid, bt_name);
+    }
+
+  *is_loaded = true;
+
+end:
+  if (load_args->leaf.pgptr != NULL)
+    {
+      pgbuf_unfix_and_init (thread_p, load_args->leaf.pgptr);
+    }
+  if (load_args->ovf.pgptr != NULL)
+    {
+      pgbuf_unfix_and_init (thread_p, load_args->ovf.pgptr);
+    }
+  if (load_args->nleaf.pgptr != NULL)
+    {
+      pgbuf_unfix_and_init (thread_p, load_args->nleaf.pgptr);
+    }
+  if (load_args->push_list != NULL)
+    {
+      list_clear (load_args->push_list);
+    }
+  if (load_args->pop_list != NULL)
+    {
+      list_clear (load_args->pop_list);
+    }
+  if (root_page != NULL)
+    {
+      pgbuf_unfix_and_init (thread_p, root_page);
+    }
+  if (load_args->leaf_nleaf_recdes.data != NULL)
+    {
+      os_free_and_init (load_args->leaf_nleaf_recdes.data);
+    }
+  if (load_args->ovf_recdes.data != NULL)
+    {
+      os_free_and_init (load_args->ovf_recdes.data);
+    }
+  pr_clear_value (&load_args->current_key);
+  if (sort_buf != NULL)
+    {
+      db_private_free_and_init (thread_p, sort_buf);
+    }
+
+  if (is_sysop_started)
+    {
+      if (error_code == NO_ERROR)
+	{
+	  log_sysop_attach_to_outer (thread_p);
+	}
+      else
+	{
+	  log_sysop_abort (thread_p);
+	}
+    }
+
+  return error_code;
+}
+
 /*
  * btree_save_last_leafrec () - save the last leaf record
  *   return: NO_ERROR
@@ -2930,6 +3338,10 @@ btree_index_sort (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args, SORT_PUT_FUNC
   int i;
   bool includes_tde_class = false;
   TDE_ALGORITHM tde_algo = TDE_ALGORITHM_NONE;
+#if defined (SERVER_MODE)
+  int worker_count;
+  int error;
+#endif /* SERVER_MODE */
 
   for (i = 0; i < sort_args->n_classes; i++)
     {
@@ -2944,33 +3356,52 @@ btree_index_sort (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args, SORT_PUT_FUNC
 	}
     }
 
+#if defined (SERVER_MODE)
+  worker_count = btree_index_sort_worker_count (thread_p, sort_args);
+  if (worker_count > 1)
+    {
+      // *INDENT-OFF*
+      btree_load_extract extract (*sort_args, LOG_FIND_THREAD_TRAN_INDEX (thread_p), thread_p->conn_entry);
+      // *INDENT-ON*
+
+      if (extract.start (worker_count))
+	{
+	  error = sort_listfile (thread_p, sort_args->hfids[0].vfid.volid, 0 /* TODO - support parallelism */ ,
+				 &btree_sort_get_next_parallel, &extract, out_func, out_args, compare_driver, sort_args,
+				 SORT_DUP, NO_SORT_LIMIT, includes_tde_class);
+
+	  /* workers must be done with sort_args before it is changed or freed */
+	  extract.stop_and_wait ();
+
+	  sort_args->n_oids += extract.get_n_oids ();
+	  sort_args->n_nulls += extract.get_n_nulls ();
+	  return error;
+	}
+      /* not enough thread entries; extract keys on this thread */
+    }
+#endif /* SERVER_MODE */
+
   return sort_listfile (thread_p, sort_args->hfids[0].vfid.volid, 0 /* TODO - support parallelism */ ,
 			&btree_sort_get_next, sort_args, out_func, out_args, compare_driver, sort_args, SORT_DUP,
 			NO_SORT_LIMIT, includes_tde_class);
 }
 
 /*
- * btree_sort_get_next () - Get_key function for index sorting
+ * btree_sort_make_item () - Produce the sort item of the current object
  *   return: SORT_STATUS
- *   temp_recdes(in): temporary record descriptor; specifies where to put the
- *                    next sort item.
- *   arg(in): sort arguments; provides information about how to produce
- *            the next sort item.
+ *   sort_args(in): sort arguments; the current object is cur_oid and its record is in_recdes
+ *   temp_recdes(in): temporary record descriptor; specifies where to put the sort item.
+ *   is_skipped(out): true if the object has no sort item (e.g. it is dead, filtered out or its key is null)
  *
- * Note: This function is passed by the "btree_index_sort" function to
- * the "sort_listfile" function to obtain the value of the attribute
- * (on which the B+tree index for the class is to be created)
- * of each object successively.
+ * Note: If the sort item does not fit into temp_recdes, SORT_REC_DOESNT_FIT is returned and temp_recdes->length is
+ *       set to the size it needs; the item of the same object is produced again when the caller retries.
  */
 static SORT_STATUS
-btree_sort_get_next (THREAD_ENTRY * thread_p, RECDES * temp_recdes, void *arg)
+btree_sort_make_item (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args, RECDES * temp_recdes, bool * is_skipped)
 {
-  SCAN_CODE scan_result;
   DB_VALUE dbvalue;
-  DB_VALUE *dbvalue_ptr;
+  DB_VALUE *dbvalue_ptr = NULL;
   int key_len;
-  OID prev_oid;
-  SORT_ARGS *sort_args;
   OR_BUF buf;
   int value_has_null;
   int next_size;
@@ -2979,6 +3410,7 @@ btree_sort_get_next (THREAD_ENTRY * thread_p, RECDES * temp_recdes, void *arg)
   char midxkey_buf[DBVAL_BUFSIZE + MAX_ALIGNMENT], *aligned_midxkey_buf;
   int *prefix_lengthp;
   int result;
+  int cur_class, attr_offset;
   MVCC_REC_HEADER mvcc_header = MVCC_REC_HEADER_INITIALIZER;
   MVCC_SNAPSHOT mvcc_snapshot_dirty;
   MVCC_SATISFIES_SNAPSHOT_RESULT snapshot_dirty_satisfied;
@@ -2987,8 +3419,7 @@ btree_sort_get_next (THREAD_ENTRY * thread_p, RECDES * temp_recdes, void *arg)
 
   aligned_midxkey_buf = PTR_ALIGN (midxkey_buf, MAX_ALIGNMENT);
 
-  sort_args = (SORT_ARGS *) arg;
-  prev_oid = sort_args->cur_oid;
+  *is_skipped = false;
 
   if (BTREE_IS_UNIQUE (sort_args->unique_pk))
     {
@@ -3001,10 +3432,293 @@ btree_sort_get_next (THREAD_ENTRY * thread_p, RECDES * temp_recdes, void *arg)
 
   mvcc_snapshot_dirty.snapshot_fnc = mvcc_satisfies_dirty;
 
-  do
-    {				/* Infinite loop */
-      int cur_class, attr_offset;
-      bool save_cache_last_fix_page;
+  cur_class = sort_args->cur_class;
+  attr_offset = cur_class * sort_args->n_attrs;
+
+  /* filter out dead records before any more checks */
+  if (or_mvcc_get_header (&sort_args->in_recdes, &mvcc_header) != NO_ERROR)
+    {
+      return SORT_ERROR_OCCURRED;
+    }
+  if (MVCC_IS_HEADER_DELID_VALID (&mvcc_header) && MVCC_GET_DELID (&mvcc_header) < sort_args->oldest_visible_mvccid)
+    {
+      *is_skipped = true;
+      return SORT_SUCCESS;
+    }
+  if (MVCC_IS_HEADER_INSID_NOT_ALL_VISIBLE (&mvcc_header)
+      && MVCC_GET_INSID (&mvcc_header) < sort_args->oldest_visible_mvccid)
+    {
+      /* Insert MVCCID is now visible to everyone. Clear it to avoid unnecessary vacuuming. */
+      MVCC_CLEAR_FLAG_BITS (&mvcc_header, OR_MVCC_FLAG_VALID_INSID);
+    }
+
+  snapshot_dirty_satisfied = mvcc_snapshot_dirty.snapshot_fnc (thread_p, &mvcc_header, &mvcc_snapshot_dirty);
+
+  if (sort_args->filter)
+    {
+      if (heap_attrinfo_read_dbvalues (thread_p, &sort_args->cur_oid, &sort_args->in_recdes, NULL,
+				       sort_args->filter->cache_pred) != NO_ERROR)
+	{
+	  return SORT_ERROR_OCCURRED;
+	}
+
+      result = (*sort_args->filter_eval_func) (thread_p, sort_args->filter->pred, NULL, &sort_args->cur_oid);
+      if (result == V_ERROR)
+	{
+	  return SORT_ERROR_OCCURRED;
+	}
+      else if (result != V_TRUE)
+	{
+	  *is_skipped = true;
+	  return SORT_SUCCESS;
+	}
+    }
+
+  if (sort_args->func_index_info && sort_args->func_index_info->expr)
+    {
+      if (snapshot_dirty_satisfied != SNAPSHOT_SATISFIED)
+	{
+	  /* Check snapshot before key generation. Key generation may leads to errors when a function is involved. */
+	  *is_skipped = true;
+	  return SORT_SUCCESS;
+	}
+
+      if (heap_attrinfo_read_dbvalues (thread_p, &sort_args->cur_oid, &sort_args->in_recdes, NULL,
+				       sort_args->func_index_info->expr->cache_attrinfo) != NO_ERROR)
+	{
+	  return SORT_ERROR_OCCURRED;
+	}
+    }
+
+  if (sort_args->n_attrs == 1)
+    {			/* single-column index */
+      if (heap_attrinfo_read_dbvalues (thread_p, &sort_args->cur_oid, &sort_args->in_recdes, NULL,
+				       &sort_args->attr_info) != NO_ERROR)
+	{
+	  return SORT_ERROR_OCCURRED;
+	}
+    }
+
+  prefix_lengthp = NULL;
+  if (sort_args->attrs_prefix_length)
+    {
+      prefix_lengthp = &(sort_args->attrs_prefix_length[0]);
+    }
+
+  dbvalue_ptr =
+    heap_attrinfo_generate_key (thread_p, sort_args->n_attrs, &sort_args->attr_ids[attr_offset], prefix_lengthp,
+				&sort_args->attr_info, &sort_args->in_recdes, &dbvalue, aligned_midxkey_buf,
+				sort_args->func_index_info, NULL);
+  if (dbvalue_ptr == NULL)
+    {
+      return SORT_ERROR_OCCURRED;
+    }
+
+  value_has_null = 0;	/* init */
+  if (DB_IS_NULL (dbvalue_ptr) || btree_multicol_key_has_null (dbvalue_ptr))
+    {
+      value_has_null = 1;	/* found null columns */
+    }
+
+  if (sort_args->not_null_flag && value_has_null && snapshot_dirty_satisfied == SNAPSHOT_SATISFIED)
+    {
+      if (dbvalue_ptr == &dbvalue || dbvalue_ptr->need_clear == true)
+	{
+	  pr_clear_value (dbvalue_ptr);
+	}
+
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_NOT_NULL_DOES_NOT_ALLOW_NULL_VALUE, 0);
+      return SORT_ERROR_OCCURRED;
+    }
+
+  if (DB_IS_NULL (dbvalue_ptr) || btree_multicol_key_is_null (dbvalue_ptr))
+    {
+      if (snapshot_dirty_satisfied == SNAPSHOT_SATISFIED)
+	{
+	  /* All objects that were not candidates for vacuum are loaded, but statistics should only care for
+	   * objects that have not been deleted and committed at the time of load. */
+	  sort_args->n_oids++;	/* Increment the OID counter */
+	  sort_args->n_nulls++;	/* Increment the NULL counter */
+	}
+      if (dbvalue_ptr == &dbvalue || dbvalue_ptr->need_clear == true)
+	{
+	  pr_clear_value (dbvalue_ptr);
+	}
+      if (prm_get_bool_value (PRM_ID_LOG_BTREE_OPS))
+	{
+	  _er_log_debug (ARG_FILE_LINE,
+			 "DEBUG_BTREE: load sort found null at oid(%d, %d, %d)"
+			 ", class_oid(%d, %d, %d), btid(%d, (%d, %d).", sort_args->cur_oid.volid,
+			 sort_args->cur_oid.pageid, sort_args->cur_oid.slotid,
+			 sort_args->class_ids[sort_args->cur_class].volid,
+			 sort_args->class_ids[sort_args->cur_class].pageid,
+			 sort_args->class_ids[sort_args->cur_class].slotid, sort_args->btid->sys_btid->root_pageid,
+			 sort_args->btid->sys_btid->vfid.volid, sort_args->btid->sys_btid->vfid.fileid);
+	}
+      *is_skipped = true;
+      return SORT_SUCCESS;
+    }
+
+  key_len = sort_args->key_type->type->get_disk_size_of_value (dbvalue_ptr);
+
+  if (key_len > 0)
+    {
+      next_size = sizeof (char *);
+      record_size = (next_size	/* Pointer to next */
+		     + OR_INT_SIZE	/* Has null */
+		     + oid_size	/* OID, Class OID */
+		     + 2 * OR_MVCCID_SIZE	/* Insert and delete MVCCID */
+		     + key_len	/* Key length */
+		     + (int) MAX_ALIGNMENT /* Alignment */ );
+
+      if (temp_recdes->area_size < record_size)
+	{
+	  /* Record is too big to fit into temp_recdes area; the caller backtracks this object */
+	  temp_recdes->length = record_size;
+	  goto nofit;
+	}
+
+      assert (PTR_ALIGN (temp_recdes->data, MAX_ALIGNMENT) == temp_recdes->data);
+      or_init (&buf, temp_recdes->data, 0);
+
+      or_pad (&buf, next_size);	/* init as NULL */
+
+      /* save has_null */
+      if (or_put_byte (&buf, value_has_null) != NO_ERROR)
+	{
+	  goto nofit;
+	}
+
+      or_advance (&buf, (OR_INT_SIZE - OR_BYTE_SIZE));
+      assert (buf.ptr == PTR_ALIGN (buf.ptr, INT_ALIGNMENT));
+
+      if (BTREE_IS_UNIQUE (sort_args->unique_pk))
+	{
+	  if (or_put_oid (&buf, &sort_args->class_ids[cur_class]) != NO_ERROR)
+	    {
+	      goto nofit;
+	    }
+	}
+
+      if (or_put_oid (&buf, &sort_args->cur_oid) != NO_ERROR)
+	{
+	  goto nofit;
+	}
+
+      /* Pack insert and delete MVCCID's */
+      if (MVCC_IS_HEADER_INSID_NOT_ALL_VISIBLE (&mvcc_header))
+	{
+	  if (or_put_mvccid (&buf, MVCC_GET_INSID (&mvcc_header)) != NO_ERROR)
+	    {
+	      goto nofit;
+	    }
+	}
+      else
+	{
+	  if (or_put_mvccid (&buf, MVCCID_ALL_VISIBLE) != NO_ERROR)
+	    {
+	      goto nofit;
+	    }
+	}
+
+      if (MVCC_IS_HEADER_DELID_VALID (&mvcc_header))
+	{
+	  if (or_put_mvccid (&buf, MVCC_GET_DELID (&mvcc_header)) != NO_ERROR)
+	    {
+	      goto nofit;
+	    }
+	}
+      else
+	{
+	  if (or_put_mvccid (&buf, MVCCID_NULL) != NO_ERROR)
+	    {
+	      goto nofit;
+	    }
+	}
+
+      if (prm_get_bool_value (PRM_ID_LOG_BTREE_OPS))
+	{
+	  _er_log_debug (ARG_FILE_LINE,
+			 "DEBUG_BTREE: load sort found oid(%d, %d, %d)"
+			 ", class_oid(%d, %d, %d), btid(%d, (%d, %d), mvcc_info=%llu | %llu.",
+			 sort_args->cur_oid.volid, sort_args->cur_oid.pageid, sort_args->cur_oid.slotid,
+			 sort_args->class_ids[sort_args->cur_class].volid,
+			 sort_args->class_ids[sort_args->cur_class].pageid,
+			 sort_args->class_ids[sort_args->cur_class].slotid, sort_args->btid->sys_btid->root_pageid,
+			 sort_args->btid->sys_btid->vfid.volid, sort_args->btid->sys_btid->vfid.fileid,
+			 MVCC_IS_FLAG_SET (&mvcc_header,
+					   OR_MVCC_FLAG_VALID_INSID) ? MVCC_GET_INSID (&mvcc_header) :
+			 MVCCID_ALL_VISIBLE, MVCC_IS_FLAG_SET (&mvcc_header,
+							       OR_MVCC_FLAG_VALID_DELID) ?
+			 MVCC_GET_DELID (&mvcc_header) : MVCCID_NULL);
+	}
+
+      assert (buf.ptr == PTR_ALIGN (buf.ptr, INT_ALIGNMENT));
+
+      if (sort_args->key_type->type->data_writeval (&buf, dbvalue_ptr) != NO_ERROR)
+	{
+	  goto nofit;
+	}
+
+      temp_recdes->length = CAST_STRLEN (buf.ptr - buf.buffer);
+
+      if (dbvalue_ptr == &dbvalue || dbvalue_ptr->need_clear == true)
+	{
+	  pr_clear_value (dbvalue_ptr);
+	}
+    }
+
+  if (snapshot_dirty_satisfied == SNAPSHOT_SATISFIED)
+    {
+      /* All objects that were not candidates for vacuum are loaded, but statistics should only care for objects
+       * that have not been deleted and committed at the time of load. */
+      sort_args->n_oids++;	/* Increment the OID counter */
+    }
+
+  if (key_len <= 0)
+    {
+      *is_skipped = true;
+    }
+  return SORT_SUCCESS;
+
+nofit:
+
+  if (dbvalue_ptr == &dbvalue || dbvalue_ptr->need_clear == true)
+    {
+      pr_clear_value (dbvalue_ptr);
+    }
+
+  return SORT_REC_DOESNT_FIT;
+}
+
+/*
+ * btree_sort_get_next () - Get_key function for index sorting
+ *   return: SORT_STATUS
+ *   temp_recdes(in): temporary record descriptor; specifies where to put the
+ *                    next sort item.
+ *   arg(in): sort arguments; provides information about how to produce
+ *            the next sort item.
+ *
+ * Note: This function is passed by the "btree_index_sort" function to
+ * the "sort_listfile" function to obtain the value of the attribute
+ * (on which the B+tree index for the class is to be created)
+ * of each object successively.
+ */
+static SORT_STATUS
+btree_sort_get_next (THREAD_ENTRY * thread_p, RECDES * temp_recdes, void *arg)
+{
+  SCAN_CODE scan_result;
+  SORT_STATUS status;
+  OID prev_oid;
+  SORT_ARGS *sort_args;
+  bool is_skipped;
+
+  sort_args = (SORT_ARGS *) arg;
+
+  do
+    {				/* Infinite loop */
+      int cur_class, attr_offset;
+      bool save_cache_last_fix_page;
 
       /*
        * This infinite loop will be exited when a satisfactory next value is
@@ -3019,6 +3733,7 @@ btree_sort_get_next (THREAD_ENTRY * thread_p, RECDES * temp_recdes, void *arg)
 
       cur_class = sort_args->cur_class;
       attr_offset = cur_class * sort_args->n_attrs;
+      prev_oid = sort_args->cur_oid;
       sort_args->in_recdes.data = NULL;
       scan_result =
 	heap_next (thread_p, &sort_args->hfids[cur_class], &sort_args->class_ids[cur_class], &sort_args->cur_oid,
@@ -3108,268 +3823,90 @@ btree_sort_get_next (THREAD_ENTRY * thread_p, RECDES * temp_recdes, void *arg)
 	case S_SUCCESS:
 	  break;
 	}
-
       /*
        * Produce the sort item for this object
        */
 
-      /* filter out dead records before any more checks */
-      if (or_mvcc_get_header (&sort_args->in_recdes, &mvcc_header) != NO_ERROR)
-	{
-	  return SORT_ERROR_OCCURRED;
-	}
-      if (MVCC_IS_HEADER_DELID_VALID (&mvcc_header) && MVCC_GET_DELID (&mvcc_header) < sort_args->oldest_visible_mvccid)
+      status = btree_sort_make_item (thread_p, sort_args, temp_recdes, &is_skipped);
+      if (status == SORT_REC_DOESNT_FIT)
 	{
-	  continue;
+	  /* backtrack this iteration */
+	  sort_args->cur_oid = prev_oid;
 	}
-      if (MVCC_IS_HEADER_INSID_NOT_ALL_VISIBLE (&mvcc_header)
-	  && MVCC_GET_INSID (&mvcc_header) < sort_args->oldest_visible_mvccid)
+      if (status != SORT_SUCCESS || !is_skipped)
 	{
-	  /* Insert MVCCID is now visible to everyone. Clear it to avoid unnecessary vacuuming. */
-	  MVCC_CLEAR_FLAG_BITS (&mvcc_header, OR_MVCC_FLAG_VALID_INSID);
+	  return status;
 	}
+    }
+  while (true);
+}
 
-      snapshot_dirty_satisfied = mvcc_snapshot_dirty.snapshot_fnc (thread_p, &mvcc_header, &mvcc_snapshot_dirty);
-
-      if (sort_args->filter)
-	{
-	  if (heap_attrinfo_read_dbvalues (thread_p, &sort_args->cur_oid, &sort_args->in_recdes, NULL,
-					   sort_args->filter->cache_pred) != NO_ERROR)
-	    {
-	      return SORT_ERROR_OCCURRED;
-	    }
-
-	  result = (*sort_args->filter_eval_func) (thread_p, sort_args->filter->pred, NULL, &sort_args->cur_oid);
-	  if (result == V_ERROR)
-	    {
-	      return SORT_ERROR_OCCURRED;
-	    }
-	  else if (result != V_TRUE)
-	    {
-	      continue;
-	    }
-	}
-
-      if (sort_args->func_index_info && sort_args->func_index_info->expr)
-	{
-	  if (snapshot_dirty_satisfied != SNAPSHOT_SATISFIED)
-	    {
-	      /* Check snapshot before key generation. Key generation may leads to errors when a function is involved. */
-	      continue;
-	    }
-
-	  if (heap_attrinfo_read_dbvalues (thread_p, &sort_args->cur_oid, &sort_args->in_recdes, NULL,
-					   sort_args->func_index_info->expr->cache_attrinfo) != NO_ERROR)
-	    {
-	      return SORT_ERROR_OCCURRED;
-	    }
-	}
-
-      if (sort_args->n_attrs == 1)
-	{			/* single-column index */
-	  if (heap_attrinfo_read_dbvalues (thread_p, &sort_args->cur_oid, &sort_args->in_recdes, NULL,
-					   &sort_args->attr_info) != NO_ERROR)
-	    {
-	      return SORT_ERROR_OCCURRED;
-	    }
-	}
-
-      prefix_lengthp = NULL;
-      if (sort_args->attrs_prefix_length)
-	{
-	  prefix_lengthp = &(sort_args->attrs_prefix_length[0]);
-	}
-
-      dbvalue_ptr =
-	heap_attrinfo_generate_key (thread_p, sort_args->n_attrs, &sort_args->attr_ids[attr_offset], prefix_lengthp,
-				    &sort_args->attr_info, &sort_args->in_recdes, &dbvalue, aligned_midxkey_buf,
-				    sort_args->func_index_info, NULL);
-      if (dbvalue_ptr == NULL)
-	{
-	  return SORT_ERROR_OCCURRED;
-	}
-
-      value_has_null = 0;	/* init */
-      if (DB_IS_NULL (dbvalue_ptr) || btree_multicol_key_has_null (dbvalue_ptr))
-	{
-	  value_has_null = 1;	/* found null columns */
-	}
-
-      if (sort_args->not_null_flag && value_has_null && snapshot_dirty_satisfied == SNAPSHOT_SATISFIED)
-	{
-	  if (dbvalue_ptr == &dbvalue || dbvalue_ptr->need_clear == true)
-	    {
-	      pr_clear_value (dbvalue_ptr);
-	    }
-
-	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_NOT_NULL_DOES_NOT_ALLOW_NULL_VALUE, 0);
-	  return SORT_ERROR_OCCURRED;
-	}
-
-      if (DB_IS_NULL (dbvalue_ptr) || btree_multicol_key_is_null (dbvalue_ptr))
-	{
-	  if (snapshot_dirty_satisfied == SNAPSHOT_SATISFIED)
-	    {
-	      /* All objects that were not candidates for vacuum are loaded, but statistics should only care for
-	       * objects that have not been deleted and committed at the time of load. */
-	      sort_args->n_oids++;	/* Increment the OID counter */
-	      sort_args->n_nulls++;	/* Increment the NULL counter */
-	    }
-	  if (dbvalue_ptr == &dbvalue || dbvalue_ptr->need_clear == true)
-	    {
-	      pr_clear_value (dbvalue_ptr);
-	    }
-	  if (prm_get_bool_value (PRM_ID_LOG_BTREE_OPS))
-	    {
-	      _er_log_debug (ARG_FILE_LINE,
-			     "DEBUG_BTREE: load sort found null at oid(%d, %d, %d)"
-			     ", class_oid(%d, %d, %d), btid(%d, (%d, %d).", sort_args->cur_oid.volid,
-			     sort_args->cur_oid.pageid, sort_args->cur_oid.slotid,
-			     sort_args->class_ids[sort_args->cur_class].volid,
-			     sort_args->class_ids[sort_args->cur_class].pageid,
-			     sort_args->class_ids[sort_args->cur_class].slotid, sort_args->btid->sys_btid->root_pageid,
-			     sort_args->btid->sys_btid->vfid.volid, sort_args->btid->sys_btid->vfid.fileid);
-	    }
-	  continue;
-	}
-
-      key_len = sort_args->key_type->type->get_disk_size_of_value (dbvalue_ptr);
-
-      if (key_len > 0)
-	{
-	  next_size = sizeof (char *);
-	  record_size = (next_size	/* Pointer to next */
-			 + OR_INT_SIZE	/* Has null */
-			 + oid_size	/* OID, Class OID */
-			 + 2 * OR_MVCCID_SIZE	/* Insert and delete MVCCID */
-			 + key_len	/* Key length */
-			 + (int) MAX_ALIGNMENT /* Alignment */ );
-
-	  if (temp_recdes->area_size < record_size)
-	    {
-	      /*
-	       * Record is too big to fit into temp_recdes area; so
-	       * backtrack this iteration
-	       */
-	      sort_args->cur_oid = prev_oid;
-	      temp_recdes->length = record_size;
-	      goto nofit;
-	    }
-
-	  assert (PTR_ALIGN (temp_recdes->data, MAX_ALIGNMENT) == temp_recdes->data);
-	  or_init (&buf, temp_recdes->data, 0);
-
-	  or_pad (&buf, next_size);	/* init as NULL */
-
-	  /* save has_null */
-	  if (or_put_byte (&buf, value_has_null) != NO_ERROR)
-	    {
-	      goto nofit;
-	    }
-
-	  or_advance (&buf, (OR_INT_SIZE - OR_BYTE_SIZE));
-	  assert (buf.ptr == PTR_ALIGN (buf.ptr, INT_ALIGNMENT));
-
-	  if (BTREE_IS_UNIQUE (sort_args->unique_pk))
-	    {
-	      if (or_put_oid (&buf, &sort_args->class_ids[cur_class]) != NO_ERROR)
-		{
-		  goto nofit;
-		}
-	    }
-
-	  if (or_put_oid (&buf, &sort_args->cur_oid) != NO_ERROR)
-	    {
-	      goto nofit;
-	    }
-
-	  /* Pack insert and delete MVCCID's */
-	  if (MVCC_IS_HEADER_INSID_NOT_ALL_VISIBLE (&mvcc_header))
-	    {
-	      if (or_put_mvccid (&buf, MVCC_GET_INSID (&mvcc_header)) != NO_ERROR)
-		{
-		  goto nofit;
-		}
-	    }
-	  else
-	    {
-	      if (or_put_mvccid (&buf, MVCCID_ALL_VISIBLE) != NO_ERROR)
-		{
-		  goto nofit;
-		}
-	    }
-
-	  if (MVCC_IS_HEADER_DELID_VALID (&mvcc_header))
-	    {
-	      if (or_put_mvccid (&buf, MVCC_GET_DELID (&mvcc_header)) != NO_ERROR)
-		{
-		  goto nofit;
-		}
-	    }
-	  else
-	    {
-	      if (or_put_mvccid (&buf, MVCCID_NULL) != NO_ERROR)
-		{
-		  goto nofit;
-		}
-	    }
-
-	  if (prm_get_bool_value (PRM_ID_LOG_BTREE_OPS))
-	    {
-	      _er_log_debug (ARG_FILE_LINE,
-			     "DEBUG_BTREE: load sort found oid(%d, %d, %d)"
-			     ", class_oid(%d, %d, %d), btid(%d, (%d, %d), mvcc_info=%llu | %llu.",
-			     sort_args->cur_oid.volid, sort_args->cur_oid.pageid, sort_args->cur_oid.slotid,
-			     sort_args->class_ids[sort_args->cur_class].volid,
-			     sort_args->class_ids[sort_args->cur_class].pageid,
-			     sort_args->class_ids[sort_args->cur_class].slotid, sort_args->btid->sys_btid->root_pageid,
-			     sort_args->btid->sys_btid->vfid.volid, sort_args->btid->sys_btid->vfid.fileid,
-			     MVCC_IS_FLAG_SET (&mvcc_header,
-					       OR_MVCC_FLAG_VALID_INSID) ? MVCC_GET_INSID (&mvcc_header) :
-			     MVCCID_ALL_VISIBLE, MVCC_IS_FLAG_SET (&mvcc_header,
-								   OR_MVCC_FLAG_VALID_DELID) ?
-			     MVCC_GET_DELID (&mvcc_header) : MVCCID_NULL);
-	    }
-
-	  assert (buf.ptr == PTR_ALIGN (buf.ptr, INT_ALIGNMENT));
-
-	  if (sort_args->key_type->type->data_writeval (&buf, dbvalue_ptr) != NO_ERROR)
-	    {
-	      goto nofit;
-	    }
-
-	  temp_recdes->length = CAST_STRLEN (buf.ptr - buf.buffer);
+#if defined (SERVER_MODE)
+/*
+ * btree_index_sort_worker_count () - Get the number of workers that extract the keys of an index load
+ *   return: number of workers, or 0 if the keys are extracted by the sorting thread
+ *   sort_args(in): sort arguments
+ *
+ * Note: Keys are extracted in parallel only from a single heap and only if no filter predicate or function has to be
+ *       evaluated, since their XASL structures cannot be shared by several threads.
+ */
+static int
+btree_index_sort_worker_count (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args)
+{
+  int worker_count;
+  int num_pages;
+  int i;
 
-	  if (dbvalue_ptr == &dbvalue || dbvalue_ptr->need_clear == true)
-	    {
-	      pr_clear_value (dbvalue_ptr);
-	    }
-	}
+  worker_count = prm_get_integer_value (PRM_ID_INDEX_LOAD_WORKER_COUNT);
+  if (worker_count < 2)
+    {
+      return 0;
+    }
 
-      if (snapshot_dirty_satisfied == SNAPSHOT_SATISFIED)
-	{
-	  /* All objects that were not candidates for vacuum are loaded, but statistics should only care for objects
-	   * that have not been deleted and committed at the time of load. */
-	  sort_args->n_oids++;	/* Increment the OID counter */
-	}
+  if (sort_args->filter != NULL || sort_args->func_index_info != NULL)
+    {
+      return 0;
+    }
 
-      if (key_len > 0)
+  for (i = sort_args->cur_class + 1; i < sort_args->n_classes; i++)
+    {
+      if (!HFID_IS_NULL (&sort_args->hfids[i]))
 	{
-	  return SORT_SUCCESS;
+	  /* more than one heap */
+	  return 0;
 	}
-
     }
-  while (true);
 
-nofit:
-
-  if (dbvalue_ptr == &dbvalue || dbvalue_ptr->need_clear == true)
+  if (file_get_num_user_pages (thread_p, &sort_args->hfids[sort_args->cur_class].vfid, &num_pages) != NO_ERROR)
     {
-      pr_clear_value (dbvalue_ptr);
+      er_clear ();
+      return 0;
+    }
+  if (num_pages < 2 * BTREE_LOAD_EXTRACT_BATCH_PAGES)
+    {
+      /* not worth it */
+      return 0;
     }
 
-  return SORT_REC_DOESNT_FIT;
+  return MIN (worker_count, num_pages / BTREE_LOAD_EXTRACT_BATCH_PAGES);
+}
+
+/*
+ * btree_sort_get_next_parallel () - Get_key function for index sorting with parallel key extraction
+ *   return: SORT_STATUS
+ *   temp_recdes(in): temporary record descriptor; specifies where to put the next sort item.
+ *   arg(in): key extraction of the index load
+ */
+static SORT_STATUS
+btree_sort_get_next_parallel (THREAD_ENTRY * thread_p, RECDES * temp_recdes, void *arg)
+{
+  // *INDENT-OFF*
+  btree_load_extract *extract = (btree_load_extract *) arg;
+  // *INDENT-ON*
+
+  return extract->get_next (temp_recdes);
 }
+#endif /* SERVER_MODE */
 
 /*
  * compare_driver () -
@@ -5187,4 +5724,372 @@ index_builder_loader_task::execute (cubthread::entry &thread_ref)
 
   m_load_context.m_tasks_executed++;
 }
+
+#if defined (SERVER_MODE)
+btree_load_extract::btree_load_extract (const SORT_ARGS &sort_args, int tran_index, css_conn_entry *conn_entry)
+  : m_sort_args (sort_args)
+  , m_tran_index (tran_index)
+  , m_conn_entry (conn_entry)
+  , m_context ()
+  , m_worker_pool (NULL)
+  , m_max_queued_chunks (0)
+  , m_next_vpid ()
+  , m_is_heap_end (false)
+  , m_read_ahead ()
+  , m_mutex ()
+  , m_queued_cv ()
+  , m_dequeued_cv ()
+  , m_chunks ()
+  , m_read_chunk (NULL)
+  , m_workers_running (0)
+  , m_is_stopped (false)
+  , m_error_code (NO_ERROR)
+  , m_error_area ()
+  , m_n_oids (0)
+  , m_n_nulls (0)
+{
+  VPID_SET_NULL (&m_next_vpid);
+  pgbuf_read_ahead_init (&m_read_ahead);
+}
+
+btree_load_extract::~btree_load_extract ()
+{
+  stop_and_wait ();
+
+  for (chunk *chunk_p : m_chunks)
+    {
+      delete chunk_p;
+    }
+  delete m_read_chunk;
+}
+
+bool
+btree_load_extract::start (int worker_count)
+{
+  m_worker_pool = thread_get_manager ()->create_worker_pool (worker_count, worker_count, "index key extract",
+			  &m_context, 1, false);
+  if (m_worker_pool == NULL)
+    {
+      return false;
+    }
+
+  m_max_queued_chunks = 2 * worker_count;
+  for (int i = 0; i < worker_count; i++)
+    {
+      {
+	std::lock_guard<std::mutex> lockg (m_mutex);
+	m_workers_running++;
+      }
+      thread_get_manager ()->push_task (m_worker_pool, new btree_load_extract_task (*this));
+    }
+
+  return true;
+}
+
+void
+btree_load_extract::stop_and_wait ()
+{
+  if (m_worker_pool == NULL)
+    {
+      return;
+    }
+
+  {
+    std::unique_lock<std::mutex> ulock (m_mutex);
+
+    m_is_stopped.store (true, std::memory_order_release);
+    m_dequeued_cv.notify_all ();
+    m_queued_cv.wait (ulock, [this] { return m_workers_running == 0; });
+  }
+
+  thread_get_manager ()->destroy_worker_pool (m_worker_pool);
+  m_worker_pool = NULL;
+}
+
+SORT_STATUS
+btree_load_extract::get_next (RECDES *temp_recdes)
+{
+  const char *item;
+  int length;
+
+  if (m_read_chunk == NULL || m_read_chunk->m_read_pos >= m_read_chunk->m_size)
+    {
+      delete m_read_chunk;
+      m_read_chunk = NULL;
+
+      std::unique_lock<std::mutex> ulock (m_mutex);
+
+      m_queued_cv.wait (ulock, [this] { return !m_chunks.empty () || m_workers_running == 0 || is_stopped (); });
+      if (m_error_code != NO_ERROR)
+	{
+	  // set the error of the worker on this thread
+	  (void) er_set_area_error (m_error_area.data ());
+	  return SORT_ERROR_OCCURRED;
+	}
+      if (m_chunks.empty ())
+	{
+	  assert (m_workers_running == 0);
+	  return SORT_NOMORE_RECS;
+	}
+
+      m_read_chunk = m_chunks.front ();
+      m_chunks.pop_front ();
+      m_dequeued_cv.notify_one ();
+    }
+
+  item = m_read_chunk->m_area.data () + m_read_chunk->m_read_pos;
+  length = OR_GET_INT (item);
+  if (temp_recdes->area_size < length)
+    {
+      temp_recdes->length = length;
+      return SORT_REC_DOESNT_FIT;
+    }
+
+  memcpy (temp_recdes->data, item + BTREE_LOAD_EXTRACT_ITEM_HEADER_SIZE, length);
+  temp_recdes->length = length;
+  m_read_chunk->m_read_pos += BTREE_LOAD_EXTRACT_ITEM_HEADER_SIZE + DB_ALIGN (length, MAX_ALIGNMENT);
+
+  return SORT_SUCCESS;
+}
+
+void
+btree_load_extract::execute (cubthread::entry &thread_ref)
+{
+  THREAD_ENTRY *thread_p = &thread_ref;
+  int save_tran_index = thread_p->tran_index;
+  css_conn_entry *save_conn_entry = thread_p->conn_entry;
+  SORT_ARGS args = m_sort_args;
+  VPID vpids[BTREE_LOAD_EXTRACT_BATCH_PAGES];
+  chunk *chunk_p = NULL;
+  bool dummy_continue_checking = true;
+  int count, i;
+  int error_code = NO_ERROR;
+
+  // extract for the transaction of the index load
+  thread_p->tran_index = m_tran_index;
+  thread_p->conn_entry = m_conn_entry;
+
+  // the worker has its own scan of the heap; the page of an object is left fixed while its sort item is produced
+  args.n_oids = 0;
+  args.n_nulls = 0;
+  args.scancache_inited = 0;
+  args.attrinfo_inited = 0;
+
+  error_code = heap_scancache_start (thread_p, &args.hfscan_cache, &args.hfids[args.cur_class],
+				     &args.class_ids[args.cur_class], true, false, NULL);
+  if (error_code != NO_ERROR)
+    {
+      goto end;
+    }
+  args.scancache_inited = 1;
+
+  error_code = heap_attrinfo_start (thread_p, &args.class_ids[args.cur_class], args.n_attrs,
+				    &args.attr_ids[args.cur_class * args.n_attrs], &args.attr_info);
+  if (error_code != NO_ERROR)
+    {
+      goto end;
+    }
+  args.attrinfo_inited = 1;
+
+  while (!is_stopped ())
+    {
+      error_code = get_next_pages (thread_p, vpids, count);
+      if (error_code != NO_ERROR || count == 0)
+	{
+	  break;
+	}
+
+      for (i = 0; i < count && error_code == NO_ERROR && !is_stopped (); i++)
+	{
+	  error_code = extract_page (thread_p, args, vpids[i], chunk_p);
+	}
+      if (error_code != NO_ERROR)
+	{
+	  break;
+	}
+
+      if (logtb_is_interrupted (thread_p, false, &dummy_continue_checking))
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_INTERRUPTED, 0);
+	  error_code = ER_INTERRUPTED;
+	  break;
+	}
+    }
+
+  if (error_code == NO_ERROR && chunk_p != NULL && chunk_p->m_size > 0)
+    {
+      (void) push_chunk (chunk_p);
+    }
+  else
+    {
+      delete chunk_p;
+    }
+
+end:
+  if (args.attrinfo_inited)
+    {
+      heap_attrinfo_end (thread_p, &args.attr_info);
+    }
+  if (args.scancache_inited)
+    {
+      // pages must be unfixed by the thread that fixed them
+      (void) heap_scancache_end (thread_p, &args.hfscan_cache);
+    }
+
+  end_worker (error_code, args.n_oids, args.n_nulls);
+  er_clear ();
+
+  thread_p->tran_index = save_tran_index;
+  thread_p->conn_entry = save_conn_entry;
+}
+
+int
+btree_load_extract::get_next_pages (THREAD_ENTRY *thread_p, VPID *vpids, int &count)
+{
+  std::lock_guard<std::mutex> lockg (m_mutex);
+  int error_code;
+
+  count = 0;
+  if (m_is_heap_end || is_stopped ())
+    {
+      return NO_ERROR;
+    }
+
+  error_code = heap_get_page_batch (thread_p, &m_sort_args.hfids[m_sort_args.cur_class], &m_next_vpid,
+				    &m_read_ahead, vpids, BTREE_LOAD_EXTRACT_BATCH_PAGES, &count);
+  if (error_code != NO_ERROR)
+    {
+      return error_code;
+    }
+
+  if (VPID_ISNULL (&m_next_vpid))
+    {
+      m_is_heap_end = true;
+    }
+  return NO_ERROR;
+}
+
+int
+btree_load_extract::extract_page (THREAD_ENTRY *thread_p, SORT_ARGS &args, const VPID &vpid, chunk *&chunk_p)
+{
+  SCAN_CODE scan_code;
+  SORT_STATUS status;
+  RECDES item_recdes;
+  bool is_skipped;
+  int error_code = NO_ERROR;
+
+  // scan this page alone
+  args.cur_oid.volid = vpid.volid;
+  args.cur_oid.pageid = vpid.pageid;
+  args.cur_oid.slotid = NULL_SLOTID;
+  args.hfscan_cache.last_vpid = vpid;
+
+  while (true)
+    {
+      args.in_recdes.data = NULL;
+      scan_code = heap_next (thread_p, &args.hfids[args.cur_class], &args.class_ids[args.cur_class], &args.cur_oid,
+			     &args.in_recdes, &args.hfscan_cache, PEEK);
+      if (scan_code == S_END)
+	{
+	  return NO_ERROR;
+	}
+      if (scan_code != S_SUCCESS)
+	{
+	  ASSERT_ERROR_AND_SET (error_code);
+	  return error_code;
+	}
+
+      do
+	{
+	  if (chunk_p == NULL)
+	    {
+	      chunk_p = new chunk ();
+	      chunk_p->m_area.resize (BTREE_LOAD_EXTRACT_CHUNK_SIZE);
+	      chunk_p->m_size = 0;
+	      chunk_p->m_read_pos = 0;
+	    }
+
+	  item_recdes.data = chunk_p->m_area.data () + chunk_p->m_size + BTREE_LOAD_EXTRACT_ITEM_HEADER_SIZE;
+	  item_recdes.area_size = (int) (chunk_p->m_area.size () - chunk_p->m_size - BTREE_LOAD_EXTRACT_ITEM_HEADER_SIZE);
+	  item_recdes.length = 0;
+
+	  status = btree_sort_make_item (thread_p, &args, &item_recdes, &is_skipped);
+	  if (status == SORT_REC_DOESNT_FIT)
+	    {
+	      if (chunk_p->m_size == 0)
+		{
+		  // an item larger than a chunk gets a chunk of its own
+		  chunk_p->m_area.resize (BTREE_LOAD_EXTRACT_ITEM_HEADER_SIZE + DB_ALIGN (item_recdes.length,
+					  MAX_ALIGNMENT));
+		}
+	      else if (!push_chunk (chunk_p))
+		{
+		  // stopped
+		  chunk_p = NULL;
+		  return NO_ERROR;
+		}
+	      else
+		{
+		  chunk_p = NULL;
+		}
+	    }
+	}
+      while (status == SORT_REC_DOESNT_FIT);
+
+      if (status != SORT_SUCCESS)
+	{
+	  ASSERT_ERROR_AND_SET (error_code);
+	  return error_code;
+	}
+
+      if (!is_skipped)
+	{
+	  OR_PUT_INT (chunk_p->m_area.data () + chunk_p->m_size, item_recdes.length);
+	  chunk_p->m_size += BTREE_LOAD_EXTRACT_ITEM_HEADER_SIZE + DB_ALIGN (item_recdes.length, MAX_ALIGNMENT);
+	}
+    }
+}
+
+bool
+btree_load_extract::push_chunk (chunk *chunk_p)
+{
+  std::unique_lock<std::mutex> ulock (m_mutex);
+
+  m_dequeued_cv.wait (ulock, [this] { return m_chunks.size () < m_max_queued_chunks || is_stopped (); });
+  if (is_stopped ())
+    {
+      delete chunk_p;
+      return false;
+    }
+
+  m_chunks.push_back (chunk_p);
+  m_queued_cv.notify_one ();
+  return true;
+}
+
+void
+btree_load_extract::end_worker (int error_code, int n_oids, int n_nulls)
+{
+  std::lock_guard<std::mutex> lockg (m_mutex);
+
+  m_n_oids += n_oids;
+  m_n_nulls += n_nulls;
+
+  if (error_code != NO_ERROR && !is_stopped ())
+    {
+      // keep the error of the first worker that failed and stop the others
+      int length = 1024;
+
+      m_error_area.resize (length);
+      (void) er_get_area_error (m_error_area.data (), &length);
+      m_error_code = error_code;
+      m_is_stopped.store (true, std::memory_order_release);
+      m_dequeued_cv.notify_all ();
+    }
+
+  assert (m_workers_running > 0);
+  m_workers_running--;
+  m_queued_cv.notify_all ();
+}
+#endif /* SERVER_MODE */
 // *INDENT-ON*
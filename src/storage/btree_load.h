@@ -280,5 +280,7 @@ extern int btree_get_prefix_separator (const DB_VALUE * key1, const DB_VALUE * k
 				       TP_DOMAIN * key_domain);
 
 extern int btree_get_asc_desc (THREAD_ENTRY * thread_p, BTID * btid, int col_idx, int *asc_desc);
+extern int btree_load_sorted_keys (THREAD_ENTRY * thread_p, BTID * btid, const char *bt_name, OID * class_oid,
+				   DB_VALUE * keys, OID * oids, int n_keys, bool * is_loaded);
 
 #endif /* _BTREE_LOAD_H_ */
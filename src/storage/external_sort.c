@@ -41,6 +41,7 @@
 #include "slotted_page.h"
 #include "overflow_file.h"
 #include "boot_sr.h"
+#include "query_manager.h"
 #if defined(ENABLE_SYSTEMTAP)
 #include "probes.h"
 #endif /* ENABLE_SYSTEMTAP */
@@ -155,6 +156,7 @@ struct sort_param
 				 * files during merging phase */
   int tot_runs;			/* Total number of runs */
   int tot_buffers;		/* Size of internal memory used in terms of number of buffers it occupies */
+  int reserved_buffers;		/* Buffers reserved out of the memory granted to the query */
   int tot_tempfiles;		/* Total number of temporary files */
   int half_files;		/* Half number of temporary files */
   int in_half;			/* Which half of temp files is for input */
@@ -179,6 +181,7 @@ struct sort_param
   /* support parallelism */
 #if defined(SERVER_MODE)
   pthread_mutex_t px_mtx;	/* px_node status mutex */
+  pthread_cond_t px_cond;	/* signaled when a px_node is done; waited with px_mtx */
 #endif
   int px_height_max;		/* px_node tournament tree max level */
   int px_array_size;		/* px_node array size */
@@ -248,7 +251,53 @@ static PX_TREE_NODE *px_sort_assign (THREAD_ENTRY * thread_p, SORT_PARAM * sort_
 				     char **px_vector, long px_vector_size, int px_height, int px_myself);
 static int px_sort_myself (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node);
 #if defined(SERVER_MODE)
-static int px_sort_communicate (PX_TREE_NODE * px_node);
+static int px_sort_communicate (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node);
+static void px_sort_set_done (SORT_PARAM * sort_param, PX_TREE_NODE * px_node);
+
+// *INDENT-OFF*
+// class px_sort_context
+//
+//  description:
+//    sort workers borrow the transaction of the sort they work for; they are reset when retired to pool
+//
+class px_sort_context : public cubthread::entry_manager
+{
+  protected:
+    void on_recycle (context_type & context) override
+    {
+      context.tran_index = NULL_TRAN_INDEX;
+    }
+};
+
+// class px_sort_task
+//
+//  description:
+//    sorts the part of a run assigned to a px_node of the tournament tree
+//
+class px_sort_task : public cubthread::entry_task
+{
+  public:
+    explicit px_sort_task (PX_TREE_NODE * px_node)
+      : m_px_node (px_node)
+    {
+    }
+
+    void execute (context_type & thread_ref) override
+    {
+      int save_tran_index = thread_ref.tran_index;
+
+      thread_ref.tran_index = m_px_node->px_tran_index;
+      (void) px_sort_myself (&thread_ref, m_px_node);
+      thread_ref.tran_index = save_tran_index;
+    }
+
+  private:
+    PX_TREE_NODE *m_px_node;
+};
+// *INDENT-ON*
+
+static cubthread::entry_workpool *sort_Px_workers = NULL;
+static px_sort_context *sort_Px_context = NULL;
 #endif
 
 static int sort_inphase_sort (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, SORT_GET_FUNC * get_next,
@@ -1348,13 +1397,13 @@ sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GE
 {
   int error = NO_ERROR;
   SORT_PARAM *sort_param = NULL;
-  bool prm_enable_sort_parallel = false;	/* TODO - PRM_SORT_PARALLEL_SORT */
   INT32 input_pages;
   int i;
   int file_pg_cnt_est;
   unsigned int total_numrecs = 0;
+  INT64 reserved_memory;
 #if defined(SERVER_MODE)
-  int num_cpus;
+  int px_count = 1;
   int rv;
 #endif /* SERVER_MODE */
 
@@ -1381,6 +1430,18 @@ sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GE
 
       free_and_init (sort_param);
 
+      return error;
+    }
+
+  rv = pthread_cond_init (&(sort_param->px_cond), NULL);
+  if (rv != 0)
+    {
+      error = ER_CSS_PTHREAD_COND_INIT;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 0);
+
+      pthread_mutex_destroy (&(sort_param->px_mtx));
+      free_and_init (sort_param);
+
       return error;
     }
 #endif /* SERVER_MODE */
@@ -1402,6 +1463,7 @@ sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GE
       sort_param->file_contents[i].num_pages = NULL;
     }
   sort_param->internal_memory = NULL;
+  sort_param->reserved_buffers = 0;
   sort_param->px_height_max = sort_param->px_array_size = 0;
   sort_param->px_array = NULL;
 
@@ -1427,9 +1489,14 @@ sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GE
       input_pages = prm_get_integer_value (PRM_ID_SR_NBUFFERS);
     }
 
-  /* The size of a sort buffer is limited to PRM_SR_NBUFFERS. */
+  /* The size of a sort buffer is limited to PRM_SR_NBUFFERS and to the memory granted to the query. */
   sort_param->tot_buffers = MIN (prm_get_integer_value (PRM_ID_SR_NBUFFERS), input_pages);
   sort_param->tot_buffers = MAX (4, sort_param->tot_buffers);
+  reserved_memory =
+    qmgr_reserve_query_memory (thread_p, (INT64) sort_param->tot_buffers * DB_PAGESIZE, 4 * DB_PAGESIZE);
+  sort_param->tot_buffers = (int) (reserved_memory / DB_PAGESIZE);
+  qmgr_unreserve_query_memory (thread_p, reserved_memory - (INT64) sort_param->tot_buffers * DB_PAGESIZE);
+  sort_param->reserved_buffers = sort_param->tot_buffers;
 
   sort_param->internal_memory = (char *) malloc ((size_t) sort_param->tot_buffers * (size_t) DB_PAGESIZE);
   if (sort_param->internal_memory == NULL)
@@ -1478,26 +1545,22 @@ sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GE
   sort_param->px_height_max = 0;	/* init */
   sort_param->px_array_size = 1;	/* init */
 
-#if 1				/* TODO - currently, disable parallelism */
-  prm_enable_sort_parallel = false;
-#endif
-
 #if !defined(NDEBUG)
   er_log_debug (ARG_FILE_LINE, "TDE: sort_listfile(): tde_encrypted = %d\n", sort_param->tde_encrypted);
 #endif /* !NDEBUG */
 
 #if defined(SERVER_MODE)
-  if (prm_enable_sort_parallel == true)
+  if (sort_Px_workers != NULL)
     {
-      /* TODO - calc n, 2^^n get the number of CPUs TODO - fileio_os_sysconf really get #cores instead of #CPUs -
-       * NEED MORE CONSIDERATION */
-      num_cpus = fileio_os_sysconf ();
-
-      sort_param->px_height_max = (int) sqrt ((double) num_cpus);	/* n */
-      sort_param->px_array_size = num_cpus;	/* 2^^n */
+      px_count = prm_get_integer_value (PRM_ID_SORT_PARALLEL_COUNT);
+    }
 
-      assert_release (sort_param->px_array_size == pow ((double) 2, (double) sort_param->px_height_max));
+  /* the tournament tree has 2^^n leaves; each leaf sorts its part of the run on a thread of its own */
+  while ((2 << sort_param->px_height_max) <= px_count)
+    {
+      sort_param->px_height_max++;
     }
+  sort_param->px_array_size = 1 << sort_param->px_height_max;
 #endif /* SERVER_MODE */
 
   sort_param->px_array = (PX_TREE_NODE *) malloc (sort_param->px_array_size * sizeof (PX_TREE_NODE));
@@ -1695,23 +1758,17 @@ px_sort_assign (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, int px_id, cha
 }
 
 #if defined(SERVER_MODE)
-// *INDENT-OFF*
-static void
-px_sort_myself_execute (cubthread::entry &thread_ref, PX_TREE_NODE * px_node)
-{
-  (void) px_sort_myself (&thread_ref, px_node);
-}
-
 /*
- * px_sort_communicate() -
- *   return:
+ * px_sort_communicate() - sort the px_node on a sort worker
+ *   return: NO_ERROR, or error code
  *   thread_p(in):
  *   px_node(in):
  *
  * NOTE: support parallelism
+ *       If all sort workers are busy, the px_node is sorted by this thread.
  */
 static int
-px_sort_communicate (PX_TREE_NODE * px_node)
+px_sort_communicate (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node)
 {
   SORT_PARAM *sort_param;
 
@@ -1723,13 +1780,77 @@ px_sort_communicate (PX_TREE_NODE * px_node)
   assert_release (px_node->px_id < sort_param->px_array_size);
   assert_release (px_node->px_vector_size > 1);
 
-  cubthread::entry_callable_task *task =
-    new cubthread::entry_callable_task (std::bind (px_sort_myself_execute, std::placeholders::_1, px_node));
-  css_push_external_task (css_get_current_conn_entry (), task);
+  // *INDENT-OFF*
+  px_sort_task *task = new px_sort_task (px_node);
+  // *INDENT-ON*
+  if (!cubthread::get_manager ()->try_task (*thread_p, sort_Px_workers, task))
+    {
+      delete task;
+      return px_sort_myself (thread_p, px_node);
+    }
 
   return NO_ERROR;
 }
-// *INDENT-ON*
+
+/*
+ * px_sort_set_done() - mark px_node as done and wake up its parent
+ *   return:
+ *   sort_param(in): sort parameters
+ *   px_node(in):
+ *
+ * NOTE: support parallelism
+ */
+static void
+px_sort_set_done (SORT_PARAM * sort_param, PX_TREE_NODE * px_node)
+{
+  int rv;
+
+  rv = pthread_mutex_lock (&(sort_param->px_mtx));
+  assert (rv == NO_ERROR);
+
+  assert_release (px_node->px_status == 0);
+  px_node->px_status = 1;	/* done */
+  pthread_cond_broadcast (&(sort_param->px_cond));
+
+  pthread_mutex_unlock (&(sort_param->px_mtx));
+}
+
+/*
+ * sort_workers_init () - create worker pool of parallel in-memory sorts
+ */
+void
+sort_workers_init (void)
+{
+  int worker_count = prm_get_integer_value (PRM_ID_SORT_PARALLEL_COUNT);
+
+  if (worker_count < 2 || sort_Px_workers != NULL)
+    {
+      /* parallel sort is disabled, or the pool already exists */
+      return;
+    }
+
+  sort_Px_context = new px_sort_context ();
+  sort_Px_workers =
+    cubthread::get_manager ()->create_worker_pool (worker_count, worker_count, "parallel sort", sort_Px_context, 1,
+						   false);
+  if (sort_Px_workers == NULL)
+    {
+      /* not enough thread entries; runs are sorted by a single thread */
+      delete sort_Px_context;
+      sort_Px_context = NULL;
+    }
+}
+
+/*
+ * sort_workers_destroy () - destroy worker pool of parallel in-memory sorts
+ */
+void
+sort_workers_destroy (void)
+{
+  cubthread::get_manager ()->destroy_worker_pool (sort_Px_workers);
+  delete sort_Px_context;
+  sort_Px_context = NULL;
+}
 #endif /* SERVER_MODE */
 
 /*
@@ -1751,7 +1872,7 @@ px_sort_communicate (PX_TREE_NODE * px_node)
 static int
 px_sort_myself (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node)
 {
-#define SORT_PARTITION_RUN_SIZE_MIN (ONE_M)
+#define SORT_PARTITION_RUN_SIZE_MIN (8 * ONE_K)
 
   int ret = NO_ERROR;
   bool old_check_interrupt;
@@ -1787,13 +1908,6 @@ px_sort_myself (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node)
   sort_param = (SORT_PARAM *) (px_node->px_arg);
 
 #if defined(SERVER_MODE)
-  if (px_node->px_id > 0)
-    {
-      /* is new childs */
-      thread_p->tran_index = px_node->px_tran_index;
-      pthread_mutex_unlock (&thread_p->tran_index_lock);
-    }
-
 #if !defined(NDEBUG)
   rv = pthread_mutex_lock (&(sort_param->px_mtx));
   assert (rv == NO_ERROR);
@@ -1835,16 +1949,6 @@ px_sort_myself (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node)
       result = px_node->px_result = vector;
       result_size = px_node->px_result_size = vector_size;
 
-      /* mark as finished */
-
-      rv = pthread_mutex_lock (&(sort_param->px_mtx));
-      assert (rv == NO_ERROR);
-
-      assert_release (px_node->px_status == 0);
-      px_node->px_status = 1;	/* done */
-
-      pthread_mutex_unlock (&(sort_param->px_mtx));
-
       goto exit_on_end;
     }
 
@@ -1862,7 +1966,7 @@ px_sort_myself (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node)
 
       assert_release (vector_size == left_vector_size + right_vector_size);
 
-      /* do new child first */
+      /* assign both children before launching the new one; once it is launched, we must wait for it */
       right_vector = vector + left_vector_size;
       right_px_node = px_sort_assign (thread_p, sort_param, px_node->px_id + child_right, buff + left_vector_size,
 				      right_vector, right_vector_size, child_height, 0 /* px_myself: set as root */ );
@@ -1871,27 +1975,6 @@ px_sort_myself (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node)
 	  goto exit_on_error;
 	}
 
-      if (right_vector_size > 1)
-	{
-	  /* launch new worker */
-	  if (px_sort_communicate (right_px_node) != NO_ERROR)
-	    {
-	      goto exit_on_error;
-	    }
-	}
-      else
-	{
-	  /* mark as finished */
-
-	  rv = pthread_mutex_lock (&(sort_param->px_mtx));
-	  assert (rv == NO_ERROR);
-
-	  assert_release (right_px_node->px_status == 0);
-	  right_px_node->px_status = 1;	/* done */
-
-	  pthread_mutex_unlock (&(sort_param->px_mtx));
-	}
-
       left_vector = vector;
       left_px_node =
 	px_sort_assign (thread_p, sort_param, px_node->px_id, buff, left_vector, left_vector_size, child_height,
@@ -1911,34 +1994,38 @@ px_sort_myself (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node)
       pthread_mutex_unlock (&(sort_param->px_mtx));
 #endif
 
-      if (left_vector_size > 1)
+      if (right_vector_size > 1)
 	{
-	  if (px_sort_myself (thread_p, left_px_node) != NO_ERROR)
-	    {
-	      goto exit_on_error;
-	    }
+	  /* launch new worker; it marks the right-child as finished, even on error */
+	  ret = px_sort_communicate (thread_p, right_px_node);
+	}
+      else
+	{
+	  /* mark as finished */
+	  px_sort_set_done (sort_param, right_px_node);
 	}
 
-      /* wait for right-child finished */
-      do
+      if (ret == NO_ERROR && left_vector_size > 1)
 	{
-	  rv = pthread_mutex_lock (&(sort_param->px_mtx));
-	  assert (rv == NO_ERROR);
+	  ret = px_sort_myself (thread_p, left_px_node);
+	}
 
-	  if (right_px_node->px_status != 0)
-	    {
-	      assert (right_px_node->px_status == 1);
-	      pthread_mutex_unlock (&(sort_param->px_mtx));
-	      break;
-	    }
+      /* wait for right-child finished */
+      rv = pthread_mutex_lock (&(sort_param->px_mtx));
+      assert (rv == NO_ERROR);
 
-	  pthread_mutex_unlock (&(sort_param->px_mtx));
+      while (right_px_node->px_status == 0)
+	{
+	  pthread_cond_wait (&(sort_param->px_cond), &(sort_param->px_mtx));
+	}
+      assert (right_px_node->px_status == 1);
 
-#if 1				/* TODO */
-	  thread_sleep (10);	/* 10 msec */
-#endif
+      pthread_mutex_unlock (&(sort_param->px_mtx));
+
+      if (ret != NO_ERROR)
+	{
+	  goto exit_on_error;
 	}
-      while (1);
 
       assert_release (px_node == left_px_node);
 #if !defined(NDEBUG)
@@ -2126,14 +2213,7 @@ exit_on_end:
   if (parent != px_node->px_id)
     {
       /* mark as finished */
-
-      rv = pthread_mutex_lock (&(sort_param->px_mtx));
-      assert (rv == NO_ERROR);
-
-      assert_release (px_node->px_status == 0);
-      px_node->px_status = 1;	/* done */
-
-      pthread_mutex_unlock (&(sort_param->px_mtx));
+      px_sort_set_done (sort_param, px_node);
     }
 #endif /* SERVER_MODE */
 
@@ -4426,6 +4506,8 @@ sort_return_used_resources (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
     {
       free_and_init (sort_param->internal_memory);
     }
+  qmgr_unreserve_query_memory (thread_p, (INT64) sort_param->reserved_buffers * DB_PAGESIZE);
+  sort_param->reserved_buffers = 0;
 
   for (k = 0; k < sort_param->tot_tempfiles; k++)
     {
@@ -4460,6 +4542,11 @@ sort_return_used_resources (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
     {
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_CSS_PTHREAD_MUTEX_DESTROY, 0);
     }
+  rv = pthread_cond_destroy (&(sort_param->px_cond));
+  if (rv != 0)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_CSS_PTHREAD_COND_DESTROY, 0);
+    }
 #endif
 
   free_and_init (sort_param);
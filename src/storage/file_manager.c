@@ -430,6 +430,18 @@ struct file_map_context
   void *args;
 };
 
+/* FILE_SAMPLE_CONTEXT - context variables for file_sample_user_pages function. */
+typedef struct file_sample_context FILE_SAMPLE_CONTEXT;
+struct file_sample_context
+{
+  bool is_partial;
+
+  FILE_PARTIAL_SECTOR *sectors;	/* sampled sectors */
+  int n_sectors;
+  int n_sectors_max;
+  INT64 n_sectors_seen;
+};
+
 /* FILE_SET_TDE_ALGORITHM_ARGS - args varaible for file_apply_tde_algorithm() */
 typedef struct file_set_tde_algorithm_args FILE_SET_TDE_ALGORITHM_ARGS;
 struct file_set_tde_algorithm_args
@@ -726,6 +738,7 @@ static int file_rv_dealloc_internal (THREAD_ENTRY * thread_p, LOG_RCV * rcv, boo
 STATIC_INLINE int file_create_temp_internal (THREAD_ENTRY * thread_p, int npages, FILE_TYPE ftype, bool is_numerable,
 					     VFID * vfid_out) __attribute__ ((ALWAYS_INLINE));
 static int file_sector_map_pages (THREAD_ENTRY * thread_p, const void *data, int index, bool * stop, void *args);
+static int file_sector_sample (THREAD_ENTRY * thread_p, const void *data, int index, bool * stop, void *args);
 static DISK_ISVALID file_table_check (THREAD_ENTRY * thread_p, const VFID * vfid, DISK_VOLMAP_CLONE * disk_map_clone);
 
 STATIC_INLINE int file_table_dump (THREAD_ENTRY * thread_p, const FILE_HEADER * fhead, FILE * fp)
@@ -7265,6 +7278,211 @@ exit:
   return error_code;
 }
 
+/*
+ * file_sector_sample () - FILE_EXTDATA_ITEM_FUNC to pick sectors of file tables at random
+ *
+ * return        : NO_ERROR
+ * thread_p (in) : thread entry
+ * data (in)     : FILE_PARTIAL_SECTOR * or VSID *
+ * index (in)    : unused
+ * stop (in)     : unused
+ * args (in/out) : FILE_SAMPLE_CONTEXT *
+ */
+static int
+file_sector_sample (THREAD_ENTRY * thread_p, const void *data, int index, bool * stop, void *args)
+{
+  FILE_SAMPLE_CONTEXT *context = (FILE_SAMPLE_CONTEXT *) args;
+  FILE_PARTIAL_SECTOR partsect;
+  INT64 pos;
+
+  /* hack to know this is partial table or full table */
+  if (context->is_partial)
+    {
+      partsect = *(FILE_PARTIAL_SECTOR *) data;
+      if (partsect.page_bitmap == FILE_EMPTY_PAGE_BITMAP)
+	{
+	  return NO_ERROR;
+	}
+    }
+  else
+    {
+      partsect.vsid = *(VSID *) data;
+      partsect.page_bitmap = FILE_FULL_PAGE_BITMAP;
+    }
+
+  /* reservoir sampling; every sector has the same chance to be kept, whatever the size of the file is */
+  if (context->n_sectors < context->n_sectors_max)
+    {
+      context->sectors[context->n_sectors++] = partsect;
+    }
+  else
+    {
+      pos = (INT64) (drand48 () * (context->n_sectors_seen + 1));
+      if (pos < context->n_sectors_max)
+	{
+	  context->sectors[pos] = partsect;
+	}
+    }
+  context->n_sectors_seen++;
+
+  return NO_ERROR;
+}
+
+/*
+ * file_sample_user_pages () - pick sectors of file at random and get their user pages
+ *
+ * return            : error code
+ * thread_p (in)     : thread entry
+ * vfid (in)         : file identifier
+ * npages_max (in)   : number of pages to sample. all user pages are returned if the file does not have more
+ * vpids_out (out)   : sampled pages in VPID order; must be freed with db_private_free
+ * n_vpids_out (out) : number of sampled pages
+ *
+ * note: sampling whole sectors keeps the reads sequential (block sampling), and only the file table is read to pick
+ *       them, so the cost does not depend on the file size. the pages are not fixed; they may be deallocated by the
+ *       time the caller reads them.
+ */
+int
+file_sample_user_pages (THREAD_ENTRY * thread_p, const VFID * vfid, int npages_max, VPID ** vpids_out,
+			int *n_vpids_out)
+{
+  VPID vpid_fhead;
+  VPID vpid;
+  PAGE_PTR page_fhead = NULL;
+  FILE_HEADER *fhead = NULL;
+  FILE_EXTENSIBLE_DATA *extdata_ftab;
+  FILE_SAMPLE_CONTEXT context;
+  FILE_FTAB_COLLECTOR ftab_collector = FILE_FTAB_COLLECTOR_INITIALIZER;
+  VPID *vpids = NULL;
+  int n_vpids = 0;
+  int iter_sect, iter_page;
+  int error_code = NO_ERROR;
+
+  assert (vfid != NULL && !VFID_ISNULL (vfid));
+  assert (npages_max > 0);
+  assert (vpids_out != NULL && n_vpids_out != NULL);
+
+  *vpids_out = NULL;
+  *n_vpids_out = 0;
+
+  context.is_partial = true;
+  context.sectors = NULL;
+  context.n_sectors = 0;
+  context.n_sectors_max = CEIL_PTVDIV (npages_max, FILE_ALLOC_BITMAP_NBITS);
+  context.n_sectors_seen = 0;
+
+  FILE_GET_HEADER_VPID (vfid, &vpid_fhead);
+  page_fhead = pgbuf_fix (thread_p, &vpid_fhead, OLD_PAGE, PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH);
+  if (page_fhead == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      return error_code;
+    }
+  fhead = (FILE_HEADER *) page_fhead;
+  file_header_sanity_check (thread_p, fhead);
+
+  context.n_sectors_max = MIN (context.n_sectors_max, MAX (fhead->n_sector_total, 1));
+  context.sectors =
+    (FILE_PARTIAL_SECTOR *) db_private_alloc (thread_p, context.n_sectors_max * sizeof (FILE_PARTIAL_SECTOR));
+  if (context.sectors == NULL)
+    {
+      error_code = ER_OUT_OF_VIRTUAL_MEMORY;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error_code, 1, context.n_sectors_max * sizeof (FILE_PARTIAL_SECTOR));
+      goto exit;
+    }
+
+  /* file table pages are allocated in the same sectors as user pages; they must be skipped */
+  error_code = file_table_collect_ftab_pages (thread_p, page_fhead, true, &ftab_collector);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      goto exit;
+    }
+
+  FILE_HEADER_GET_PART_FTAB (fhead, extdata_ftab);
+  context.is_partial = true;
+  error_code = file_extdata_apply_funcs (thread_p, extdata_ftab, NULL, NULL, file_sector_sample, &context, false,
+					 NULL, NULL);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      goto exit;
+    }
+
+  if (!FILE_IS_TEMPORARY (fhead))
+    {
+      FILE_HEADER_GET_FULL_FTAB (fhead, extdata_ftab);
+      context.is_partial = false;
+      error_code = file_extdata_apply_funcs (thread_p, extdata_ftab, NULL, NULL, file_sector_sample, &context, false,
+					     NULL, NULL);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  goto exit;
+	}
+    }
+
+  /* file header is no longer needed; do not block allocations while the output is built */
+  pgbuf_unfix_and_init (thread_p, page_fhead);
+
+  if (context.n_sectors == 0)
+    {
+      goto exit;
+    }
+
+  vpids = (VPID *) db_private_alloc (thread_p, context.n_sectors * FILE_ALLOC_BITMAP_NBITS * sizeof (VPID));
+  if (vpids == NULL)
+    {
+      error_code = ER_OUT_OF_VIRTUAL_MEMORY;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error_code, 1,
+	      context.n_sectors * FILE_ALLOC_BITMAP_NBITS * sizeof (VPID));
+      goto exit;
+    }
+
+  /* VSID is the first member of FILE_PARTIAL_SECTOR */
+  qsort (context.sectors, context.n_sectors, sizeof (FILE_PARTIAL_SECTOR), disk_compare_vsids);
+
+  for (iter_sect = 0; iter_sect < context.n_sectors; iter_sect++)
+    {
+      vpid.volid = context.sectors[iter_sect].vsid.volid;
+      for (iter_page = 0, vpid.pageid = SECTOR_FIRST_PAGEID (context.sectors[iter_sect].vsid.sectid);
+	   iter_page < FILE_ALLOC_BITMAP_NBITS; iter_page++, vpid.pageid++)
+	{
+	  if (!file_partsect_is_bit_set (&context.sectors[iter_sect], iter_page)
+	      || file_table_collector_has_page (&ftab_collector, &vpid))
+	    {
+	      /* not allocated or table page */
+	      continue;
+	    }
+	  vpids[n_vpids++] = vpid;
+	}
+    }
+
+  *vpids_out = vpids;
+  *n_vpids_out = n_vpids;
+  vpids = NULL;
+
+exit:
+  if (page_fhead != NULL)
+    {
+      pgbuf_unfix (thread_p, page_fhead);
+    }
+  if (ftab_collector.partsect_ftab != NULL)
+    {
+      db_private_free (thread_p, ftab_collector.partsect_ftab);
+    }
+  if (context.sectors != NULL)
+    {
+      db_private_free (thread_p, context.sectors);
+    }
+  if (vpids != NULL)
+    {
+      db_private_free (thread_p, vpids);
+    }
+
+  return error_code;
+}
+
 /*
  * file_table_check () - check file table is valid
  *
@@ -594,6 +594,8 @@ static PAGE_PTR heap_scan_pb_lock_and_fetch_debug (THREAD_ENTRY * thread_p, cons
 						   const int caller_line);
 #endif /* !NDEBUG */
 
+static void heap_read_ahead_next_vpid (THREAD_ENTRY * thread_p, PAGE_PTR pgptr, VPID * next_vpid);
+
 static int heap_classrepr_initialize_cache (void);
 static int heap_classrepr_finalize_cache (void);
 static int heap_classrepr_decache_guessed_last (const OID * class_oid);
@@ -5015,6 +5017,95 @@ heap_vpid_next (THREAD_ENTRY * thread_p, const HFID * hfid, PAGE_PTR pgptr, VPID
   return ret;
 }
 
+/*
+ * heap_read_ahead_next_vpid () - Find next page of heap, for read-ahead
+ *   return: void
+ *   pgptr(in): Page read ahead of the scan
+ *   next_vpid(out): Next volume-page identifier or NULL if there is no next page
+ *
+ * Note: The page is only latched by read-ahead and may have been deallocated and reused meanwhile. Anything that does
+ *       not look like a heap chain record ends the read-ahead. Read-ahead never starts on the header page.
+ */
+static void
+heap_read_ahead_next_vpid (THREAD_ENTRY * thread_p, PAGE_PTR pgptr, VPID * next_vpid)
+{
+  RECDES recdes;
+
+  VPID_SET_NULL (next_vpid);
+
+  if (pgbuf_get_page_ptype (thread_p, pgptr) != PAGE_HEAP)
+    {
+      return;
+    }
+  if (spage_get_record (thread_p, pgptr, HEAP_HEADER_AND_CHAIN_SLOTID, &recdes, PEEK) != S_SUCCESS
+      || recdes.length != sizeof (HEAP_CHAIN))
+    {
+      return;
+    }
+
+  *next_vpid = ((HEAP_CHAIN *) recdes.data)->next_vpid;
+}
+
+/*
+ * heap_get_page_batch () - Get the identifiers of the next pages of a heap
+ *   return: NO_ERROR, or error code
+ *   hfid(in): Object heap file identifier
+ *   next_vpid(in/out): First page of the batch, or null to start with the heap header page. Set to the page that
+ *                      follows the batch, or null if the batch ends the heap.
+ *   read_ahead(in/out): read-ahead state of the walk
+ *   vpids(out): page identifiers of the batch, in heap chain order
+ *   max_count(in): maximum number of pages in the batch
+ *   count(out): number of pages in the batch
+ *
+ * Note: Walks the heap chain so that the scan of a heap can be split into batches of pages, each scanned separately by
+ *       setting the last_vpid of a scan cache to the page itself. The pages are only read latched while walking.
+ */
+int
+heap_get_page_batch (THREAD_ENTRY * thread_p, const HFID * hfid, VPID * next_vpid, PAGE_READ_AHEAD * read_ahead,
+		     VPID * vpids, int max_count, int *count)
+{
+  PGBUF_WATCHER pg_watcher;
+  VPID vpid;
+  int error_code = NO_ERROR;
+
+  assert (max_count > 0);
+
+  *count = 0;
+  if (VPID_ISNULL (next_vpid))
+    {
+      next_vpid->volid = hfid->vfid.volid;
+      next_vpid->pageid = hfid->hpgid;
+    }
+
+  PGBUF_INIT_WATCHER (&pg_watcher, PGBUF_ORDERED_HEAP_NORMAL, hfid);
+  while (*count < max_count && !VPID_ISNULL (next_vpid))
+    {
+      vpid = *next_vpid;
+      error_code = pgbuf_ordered_fix (thread_p, &vpid, OLD_PAGE_PREVENT_DEALLOC, PGBUF_LATCH_READ, &pg_watcher);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  return error_code;
+	}
+
+      error_code = heap_vpid_next (thread_p, hfid, pg_watcher.pgptr, next_vpid);
+      if (error_code == NO_ERROR)
+	{
+	  pgbuf_read_ahead (thread_p, read_ahead, &vpid, next_vpid, heap_read_ahead_next_vpid);
+	}
+      pgbuf_ordered_unfix (thread_p, &pg_watcher);
+      if (error_code != NO_ERROR)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
+	  return ER_GENERIC_ERROR;
+	}
+
+      vpids[(*count)++] = vpid;
+    }
+
+  return NO_ERROR;
+}
+
 /*
  * heap_vpid_prev () - Find previous page of heap
  *   return: NO_ERROR
@@ -6787,6 +6878,8 @@ heap_scancache_start_internal (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_ca
   scan_cache->node.classname = NULL;
   scan_cache->cache_last_fix_page = cache_last_fix_page;
   PGBUF_INIT_WATCHER (&(scan_cache->page_watcher), PGBUF_ORDERED_HEAP_NORMAL, hfid);
+  pgbuf_read_ahead_init (&scan_cache->read_ahead);
+  VPID_SET_NULL (&scan_cache->last_vpid);
   scan_cache->start_area ();
   scan_cache->num_btids = 0;
   scan_cache->m_index_stats = NULL;
@@ -7086,6 +7179,8 @@ heap_scancache_quick_start_internal (HEAP_SCANCACHE * scan_cache, const HFID * h
   scan_cache->node.classname = NULL;
   scan_cache->page_latch = S_LOCK;
   scan_cache->cache_last_fix_page = true;
+  pgbuf_read_ahead_init (&scan_cache->read_ahead);
+  VPID_SET_NULL (&scan_cache->last_vpid);
   scan_cache->start_area ();
   scan_cache->num_btids = 0;
   scan_cache->m_index_stats = NULL;
@@ -7959,9 +8054,16 @@ heap_next_internal (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid,
 		    {
 		      (void) heap_vpid_prev (thread_p, hfid, curr_page_watcher.pgptr, &vpid);
 		    }
+		  else if (!VPID_ISNULL (&scan_cache->last_vpid) && VPID_EQ (&vpid, &scan_cache->last_vpid))
+		    {
+		      /* the scan is limited to pages up to last_vpid */
+		      VPID_SET_NULL (&vpid);
+		    }
 		  else
 		    {
 		      (void) heap_vpid_next (thread_p, hfid, curr_page_watcher.pgptr, &vpid);
+		      pgbuf_read_ahead (thread_p, &scan_cache->read_ahead, pgbuf_get_vpid_ptr (curr_page_watcher.pgptr),
+					&vpid, heap_read_ahead_next_vpid);
 		    }
 		  pgbuf_replace_watcher (thread_p, &curr_page_watcher, &old_page_watcher);
 		  oid.volid = vpid.volid;
@@ -10451,6 +10553,87 @@ exit_on_error:
   return (ret == NO_ERROR && (ret = er_errid ()) == NO_ERROR) ? ER_FAILED : ret;
 }
 
+/*
+ * heap_attrinfo_peek_fixed_values () - find disk data of fixed size attributes of an instance
+ *   return: NO_ERROR, or error code
+ *   recdes(in): The instance Record descriptor
+ *   attr_info(in/out): The attribute information structure; recached if the instance has another representation
+ *   disk_data(out): disk data of each attribute of attr_info, or NULL if the attribute is unbound
+ *   is_fixed(out): false if an attribute is not an instance attribute of the same fixed size type in the
+ *                  representation of the instance
+ *
+ * Note: The caller decodes the disk data itself, without making DB_VALUEs. If is_fixed is false, disk_data is not
+ *       complete and the instance must be read with heap_attrinfo_read_dbvalues.
+ */
+int
+heap_attrinfo_peek_fixed_values (THREAD_ENTRY * thread_p, RECDES * recdes, HEAP_CACHE_ATTRINFO * attr_info,
+				 char **disk_data, bool * is_fixed)
+{
+  HEAP_ATTRVALUE *value;
+  OR_ATTRIBUTE *attrepr;
+  REPR_ID reprid;
+  int i;
+  int ret = NO_ERROR;
+
+  *is_fixed = true;
+
+  if (attr_info->num_values == -1)
+    {
+      return NO_ERROR;
+    }
+
+  reprid = or_rep_id (recdes);
+  if (attr_info->read_classrepr == NULL || attr_info->read_classrepr->id != reprid)
+    {
+      ret = heap_attrinfo_recache (thread_p, reprid, attr_info);
+      if (ret != NO_ERROR)
+	{
+	  return ret;
+	}
+    }
+
+  for (i = 0; i < attr_info->num_values; i++)
+    {
+      value = &attr_info->values[i];
+      attrepr = value->read_attrepr;
+
+      if (value->attr_type != HEAP_INSTANCE_ATTR)
+	{
+	  *is_fixed = false;
+	  return NO_ERROR;
+	}
+
+      if (attrepr == NULL)
+	{
+	  /* the attribute was added after the instance was stored; use its default value */
+	  disk_data[i] = NULL;
+	  if (value->last_attrepr->default_value.val_length > 0)
+	    {
+	      disk_data[i] = (char *) value->last_attrepr->default_value.value;
+	    }
+	}
+      else if (attrepr->is_fixed == 0 || attrepr->type != value->last_attrepr->type)
+	{
+	  *is_fixed = false;
+	  return NO_ERROR;
+	}
+      else if (OR_FIXED_ATT_IS_UNBOUND (recdes->data, attr_info->read_classrepr->n_variable,
+					attr_info->read_classrepr->fixed_length, attrepr->position))
+	{
+	  disk_data[i] = NULL;
+	}
+      else
+	{
+	  disk_data[i] =
+	    ((char *) recdes->data
+	     + OR_FIXED_ATTRIBUTES_OFFSET_BY_OBJ (recdes->data, attr_info->read_classrepr->n_variable)
+	     + attrepr->location);
+	}
+    }
+
+  return NO_ERROR;
+}
+
 /*
  * heap_attrinfo_delete_lob ()
  *   return: NO_ERROR
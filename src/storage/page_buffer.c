@@ -86,6 +86,13 @@ const VPID vpid_Null_vpid = { NULL_PAGEID, NULL_VOLID };
    has PGBUF_NUM_ALLOC_HOLDER elements(BCB holder entries). */
 #define PGBUF_NUM_ALLOC_HOLDER     10
 
+/* read-ahead related constants */
+
+/* A scan must visit this many pages in chain order before its next pages are read ahead. */
+#define PGBUF_READ_AHEAD_MIN_SEQ_PAGES  2
+/* Maximum number of requests in the queue of read-ahead workers. Requests beyond are dropped. */
+#define PGBUF_READ_AHEAD_MAX_TASKS      64
+
 #if !defined(SERVER_MODE)
 /* TODO: do we need to do this? */
 #define pthread_mutex_init(a, b)
@@ -229,6 +236,8 @@ typedef enum
 #define PGBUF_BCB_TO_VACUUM_FLAG            ((int) 0x04000000)
 /* flag for asynchronous flush request */
 #define PGBUF_BCB_ASYNC_FLUSH_REQ           ((int) 0x02000000)
+/* flag for pages read from disk ahead of a scan and not yet fixed by anyone else. */
+#define PGBUF_BCB_READ_AHEAD_FLAG           ((int) 0x01000000)
 
 /* add all flags here */
 #define PGBUF_BCB_FLAGS_MASK \
@@ -238,7 +247,8 @@ typedef enum
    | PGBUF_BCB_INVALIDATE_DIRECT_VICTIM_FLAG \
    | PGBUF_BCB_MOVE_TO_LRU_BOTTOM_FLAG \
    | PGBUF_BCB_TO_VACUUM_FLAG \
-   | PGBUF_BCB_ASYNC_FLUSH_REQ)
+   | PGBUF_BCB_ASYNC_FLUSH_REQ \
+   | PGBUF_BCB_READ_AHEAD_FLAG)
 
 /* add flags that invalidate a victim candidate here */
 /* 1. dirty bcb's cannot be victimized.
@@ -323,6 +333,16 @@ typedef enum
 #define PGBUF_LRU_ZONE_MIN_RATIO 0.05f
 #define PGBUF_LRU_ZONE_MAX_RATIO 0.90f
 
+/* page replacement policies (data_buffer_replacement_policy) */
+enum
+{
+  PGBUF_REPLACEMENT_LRU_ZONES = 0,	/* pages read for the first time enter the lru middle (top of zone 2) */
+  PGBUF_REPLACEMENT_PROBATION = 1	/* pages read for the first time enter on probation, at the top of zone 3; only
+					 * a second hit while on probation or in Aout promotes them. this is not an
+					 * adaptive policy like ARC or CLOCK-Pro: the room for pages on probation is
+					 * whatever zone 3 holds, and Aout is the only history of evicted pages. */
+};
+
 /* buffer lock return value */
 enum
 {
@@ -723,6 +743,7 @@ struct pgbuf_buffer_pool
   int num_LRU_list;		/* number of shared LRU lists */
   float ratio_lru1;		/* ratio for lru 1 zone */
   float ratio_lru2;		/* ratio for lru 2 zone */
+  int replacement_policy;	/* PGBUF_REPLACEMENT_LRU_ZONES or PGBUF_REPLACEMENT_PROBATION */
   PGBUF_LRU_LIST *buf_LRU_list;	/* LRU lists. When Page quota is enabled, first 'num_LRU_list' store shared pages;
 				 * the next 'num_garbage_LRU_list' lists store shared garbage pages;
 				 * the last 'num_private_LRU_list' are private lists.
@@ -1043,6 +1064,8 @@ STATIC_INLINE void pgbuf_lru_add_bcb_to_middle (THREAD_ENTRY * thread_p, PGBUF_B
   __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE void pgbuf_lru_add_bcb_to_bottom (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb, PGBUF_LRU_LIST * lru_list)
   __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE void pgbuf_lru_add_bcb_to_zone_3 (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb, PGBUF_LRU_LIST * lru_list)
+  __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE void pgbuf_lru_adjust_zone1 (THREAD_ENTRY * thread_p, PGBUF_LRU_LIST * lru_list, bool min_one)
   __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE void pgbuf_lru_adjust_zone2 (THREAD_ENTRY * thread_p, PGBUF_LRU_LIST * lru_list, bool min_one)
@@ -1058,6 +1081,8 @@ STATIC_INLINE void pgbuf_lru_add_new_bcb_to_middle (THREAD_ENTRY * thread_p, PGB
   __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE void pgbuf_lru_add_new_bcb_to_bottom (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb, int lru_idx)
   __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE void pgbuf_lru_add_new_bcb_to_zone_3 (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb, int lru_idx)
+  __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE void pgbuf_lru_remove_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
 static void pgbuf_lru_move_from_private_to_shared (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb);
 static void pgbuf_move_bcb_to_bottom_lru (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb);
@@ -1220,7 +1245,12 @@ static cubthread::daemon *pgbuf_Page_maintenance_daemon = NULL;
 static cubthread::daemon *pgbuf_Page_flush_daemon = NULL;
 static cubthread::daemon *pgbuf_Page_post_flush_daemon = NULL;
 static cubthread::daemon *pgbuf_Flush_control_daemon = NULL;
+static cubthread::entry_workpool *pgbuf_Read_ahead_workers = NULL;
+static cubthread::entry_manager *pgbuf_Read_ahead_context = NULL;
 // *INDENT-ON*
+
+static bool pgbuf_read_ahead_page (THREAD_ENTRY * thread_p, const VPID * vpid, PGBUF_READ_AHEAD_NEXT_FUNC next_func,
+				   VPID * next_vpid);
 #endif /* SERVER_MODE */
 
 static bool pgbuf_is_page_flush_daemon_available ();
@@ -1342,6 +1372,8 @@ pgbuf_initialize (void)
   assert ((pgbuf_Pool.ratio_lru1 + pgbuf_Pool.ratio_lru2) >= 0.099f
 	  && (pgbuf_Pool.ratio_lru1 + pgbuf_Pool.ratio_lru2) <= 0.951f);
 
+  pgbuf_Pool.replacement_policy = prm_get_integer_value (PRM_ID_PB_REPLACEMENT_POLICY);
+
   /* keep page quota parameter initializer first */
   if (pgbuf_initialize_page_quota_parameters () != NO_ERROR)
     {
@@ -1901,6 +1933,13 @@ try_again:
 
       show_status->num_hit++;
 
+      if ((bufptr->flags & PGBUF_BCB_READ_AHEAD_FLAG) && fetch_mode != OLD_PAGE_IF_IN_BUFFER)
+	{
+	  /* first fix of a page that was read ahead. read-ahead itself only peeks pages with OLD_PAGE_IF_IN_BUFFER. */
+	  pgbuf_bcb_update_flags (thread_p, bufptr, 0, PGBUF_BCB_READ_AHEAD_FLAG);
+	  perfmon_inc_stat (thread_p, PSTAT_PB_READ_AHEAD_HITS);
+	}
+
       if (fetch_mode == NEW_PAGE)
 	{
 	  /* Fix a page as NEW_PAGE, when oldest_unflush_lsa of the page is not NULL_LSA, it should be dirty. */
@@ -2175,6 +2214,10 @@ try_again:
 	  perfmon_pbx_fix_acquire_time (thread_p, perf.perf_page_type, perf.perf_page_found, perf.perf_latch_mode,
 					perf.perf_cond_type, perf.fix_wait_time);
 	}
+      if (perf.perf_cond_type == PERF_UNCONDITIONAL_FIX_WITH_WAIT || perf.lock_wait_time > 0)
+	{
+	  perfmon_add_latency (PERFMON_LATENCY_PGBUF_FIX_WAIT, perf.fix_wait_time);
+	}
     }
 
   if (VACUUM_IS_THREAD_VACUUM_WORKER (thread_p))
@@ -6201,6 +6244,15 @@ pgbuf_unlatch_bcb_upon_unfix (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, int h
 		  perfmon_inc_stat (thread_p, PSTAT_PB_UNFIX_LRU_THREE_PRV_TO_SHR_MID);
 		  break;
 		}
+	      if (pgbuf_Pool.replacement_policy == PGBUF_REPLACEMENT_PROBATION
+		  && !PGBUF_IS_BCB_OLD_ENOUGH (bufptr, pgbuf_lru_list_from_bcb (bufptr)))
+		{
+		  /* bcb is on probation and the hit is too close to the first one (e.g. the scan that read the page
+		   * fixed it again); it does not prove the page is reused. keep it. */
+		  perfmon_inc_stat (thread_p, PSTAT_PB_UNFIX_LRU_THREE_KEEP);
+		  pgbuf_bcb_register_hit_for_lru (bufptr);
+		  break;
+		}
 	      /* boost */
 	      pgbuf_lru_boost_bcb (thread_p, bufptr);
 	      pgbuf_bcb_register_hit_for_lru (bufptr);
@@ -6260,6 +6312,7 @@ pgbuf_unlatch_void_zone_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb, int threa
 {
   bool aout_enabled = false;
   int aout_list_id = PGBUF_AOUT_NOT_FOUND;
+  bool is_probation = pgbuf_Pool.replacement_policy == PGBUF_REPLACEMENT_PROBATION;
 
   assert (pgbuf_bcb_get_zone (bcb) == PGBUF_VOID_ZONE);
 
@@ -6317,13 +6370,20 @@ pgbuf_unlatch_void_zone_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb, int threa
     {
       if (PGBUF_THREAD_SHOULD_IGNORE_UNFIX (thread_p))
 	{
+	  if (is_probation)
+	    {
+	      /* vacuum reads pages once; put them on probation */
+	      pgbuf_lru_add_new_bcb_to_zone_3 (thread_p, bcb, thread_private_lru_index);
+	      perfmon_inc_stat (thread_p, PSTAT_PB_UNFIX_VOID_TO_PRIVATE_LRU3);
+	      return;
+	    }
 	  /* add to top of current private list */
 	  pgbuf_lru_add_new_bcb_to_top (thread_p, bcb, thread_private_lru_index);
 	  perfmon_inc_stat (thread_p, PSTAT_PB_UNFIX_VOID_TO_PRIVATE_TOP_VAC);
 	  return;
 	}
 
-      if (!aout_enabled || thread_private_lru_index == aout_list_id)
+      if ((!aout_enabled && !is_probation) || thread_private_lru_index == aout_list_id)
 	{
 	  /* add to top of current private list */
 	  pgbuf_lru_add_new_bcb_to_top (thread_p, bcb, thread_private_lru_index);
@@ -6332,6 +6392,15 @@ pgbuf_unlatch_void_zone_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb, int threa
 	  return;
 	}
 
+      if (aout_list_id == PGBUF_AOUT_NOT_FOUND && is_probation)
+	{
+	  /* first access we know of. put it on probation in current private list; a second hit boosts it. */
+	  pgbuf_lru_add_new_bcb_to_zone_3 (thread_p, bcb, thread_private_lru_index);
+	  perfmon_inc_stat (thread_p, PSTAT_PB_UNFIX_VOID_TO_PRIVATE_LRU3);
+	  pgbuf_bcb_register_hit_for_lru (bcb);
+	  return;
+	}
+
       if (aout_list_id == PGBUF_AOUT_NOT_FOUND)
 	{
 	  /* add to middle of current private list */
@@ -6343,6 +6412,17 @@ pgbuf_unlatch_void_zone_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb, int threa
 
       /* fall through to add to shared */
     }
+  if (aout_list_id == PGBUF_AOUT_NOT_FOUND && is_probation)
+    {
+      /* first access we know of. put it on probation in shared list; a second hit boosts it. */
+      pgbuf_lru_add_new_bcb_to_zone_3 (thread_p, bcb, pgbuf_get_shared_lru_index_for_add ());
+      perfmon_inc_stat (thread_p, PSTAT_PB_UNFIX_VOID_TO_SHARED_LRU3);
+      if (!PGBUF_THREAD_SHOULD_IGNORE_UNFIX (thread_p))
+	{
+	  pgbuf_bcb_register_hit_for_lru (bcb);
+	}
+      return;
+    }
   /* add to middle of shared list. */
   pgbuf_lru_add_new_bcb_to_middle (thread_p, bcb, pgbuf_get_shared_lru_index_for_add ());
   perfmon_inc_stat (thread_p, PSTAT_PB_UNFIX_VOID_TO_SHARED_MID);
@@ -7686,6 +7766,13 @@ pgbuf_claim_bcb_for_fix (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_
 
   /* Currently, caller has one allocated BCB and is holding mutex */
 
+  if (bufptr->flags & PGBUF_BCB_READ_AHEAD_FLAG)
+    {
+      /* the page was read ahead for nothing; it is replaced before anyone fixed it */
+      pgbuf_bcb_update_flags (thread_p, bufptr, 0, PGBUF_BCB_READ_AHEAD_FLAG);
+      perfmon_inc_stat (thread_p, PSTAT_PB_READ_AHEAD_MISSES);
+    }
+
   /* initialize the BCB */
   bufptr->vpid = *vpid;
   assert (!pgbuf_bcb_avoid_victim (bufptr));
@@ -9048,6 +9135,61 @@ pgbuf_lru_add_bcb_to_bottom (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb, PGBUF_LRU
   pgbuf_bcb_change_zone (thread_p, bcb, lru_list->index, PGBUF_LRU_3_ZONE);
 }
 
+/*
+ * pgbuf_lru_add_bcb_to_zone_3 () - add a bcb to the top of lru list zone 3
+ *
+ * return        : void
+ * thread_p (in) : thread entry
+ * bcb (in)      : bcb added to top of zone 3
+ * lru_list (in) : lru list
+ *
+ * note: the bcb is placed where bcb's falling from zone 2 are placed, so it gets the same tick_lru3 they would get. it
+ *       is victimized before any bcb of zones 1 and 2, unless it is hit again and boosted.
+ */
+STATIC_INLINE void
+pgbuf_lru_add_bcb_to_zone_3 (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb, PGBUF_LRU_LIST * lru_list)
+{
+  PGBUF_BCB *bcb_prev;
+  PGBUF_BCB *bcb_next;
+
+  /* zone 3 starts after the bottom of zone 2, or after the bottom of zone 1 if zone 2 is empty */
+  bcb_prev = lru_list->bottom_2 != NULL ? lru_list->bottom_2 : lru_list->bottom_1;
+  if (bcb_prev == NULL)
+    {
+      /* zones 1 and 2 are empty; bcb becomes top of list */
+      assert (lru_list->count_lru1 == 0 && lru_list->count_lru2 == 0);
+      bcb_next = lru_list->top;
+      lru_list->top = bcb;
+    }
+  else
+    {
+      bcb_next = bcb_prev->next_BCB;
+      bcb_prev->next_BCB = bcb;
+    }
+  bcb->prev_BCB = bcb_prev;
+  bcb->next_BCB = bcb_next;
+
+  if (bcb_next == NULL)
+    {
+      /* zone 3 was empty */
+      assert (lru_list->bottom == bcb_prev);
+      lru_list->bottom = bcb;
+    }
+  else
+    {
+      bcb_next->prev_BCB = bcb;
+    }
+
+  /* tick_lru3 */
+  bcb->tick_lru3 = lru_list->tick_lru3;
+  if (++lru_list->tick_lru3 >= DB_INT32_MAX)
+    {
+      lru_list->tick_lru3 = 0;
+    }
+
+  pgbuf_bcb_change_zone (thread_p, bcb, lru_list->index, PGBUF_LRU_3_ZONE);
+}
+
 /*
  * pgbuf_lru_adjust_zone1 () - adjust zone 1 of lru list
  *
@@ -9466,6 +9608,34 @@ pgbuf_lru_add_new_bcb_to_bottom (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb, int l
   pthread_mutex_unlock (&lru_list->mutex);
 }
 
+/*
+ * pgbuf_lru_add_new_bcb_to_zone_3 () - add a new bcb to top of lru list zone 3. this is where pages read for the first
+ *                                      time are put on probation by the PGBUF_REPLACEMENT_PROBATION policy.
+ *
+ * return        : void
+ * thread_p (in) : thread entry
+ * bcb (in)      : new bcb
+ * lru_idx (in)  : lru list index
+ */
+STATIC_INLINE void
+pgbuf_lru_add_new_bcb_to_zone_3 (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb, int lru_idx)
+{
+  PGBUF_LRU_LIST *lru_list;
+
+  /* this is not meant for changes in this list */
+  assert (!PGBUF_IS_BCB_IN_LRU (bcb));
+
+  lru_list = &pgbuf_Pool.buf_LRU_list[lru_idx];
+  pthread_mutex_lock (&lru_list->mutex);
+
+  bcb->tick_lru_list = lru_list->tick_list;
+  pgbuf_lru_add_bcb_to_zone_3 (thread_p, bcb, lru_list);
+
+  pgbuf_lru_sanity_check (lru_list);
+
+  pthread_mutex_unlock (&lru_list->mutex);
+}
+
 /*
  * pgbuf_lru_remove_bcb () - remove bcb from lru list
  *
@@ -16016,6 +16186,246 @@ pgbuf_flush_control_daemon_init ()
 }
 #endif /* SERVER_MODE */
 
+#if defined (SERVER_MODE)
+// class pgbuf_read_ahead_context
+//
+//  description:
+//    read-ahead workers fix pages as system transaction workers
+//
+class pgbuf_read_ahead_context : public cubthread::entry_manager
+{
+  protected:
+    void on_create (context_type & context) override
+    {
+      context.claim_system_worker ();
+    }
+
+    void on_retire (context_type & context) override
+    {
+      context.retire_system_worker ();
+    }
+
+    void on_recycle (context_type & context) override
+    {
+      context.tran_index = LOG_SYSTEM_TRAN_INDEX;
+    }
+};
+
+// class pgbuf_read_ahead_task
+//
+//  description:
+//    walks a page chain ahead of a scan and reads the pages that are not in page buffer yet. the scan finds them
+//    in buffer when it gets there.
+//
+class pgbuf_read_ahead_task : public cubthread::entry_task
+{
+  private:
+    VPID m_start_vpid;
+    int m_page_count;
+    PGBUF_READ_AHEAD_NEXT_FUNC m_next_func;
+
+  public:
+    pgbuf_read_ahead_task (const VPID & start_vpid, int page_count, PGBUF_READ_AHEAD_NEXT_FUNC next_func)
+      : m_start_vpid (start_vpid)
+      , m_page_count (page_count)
+      , m_next_func (next_func)
+    {
+    }
+
+    void execute (cubthread::entry & thread_ref) override
+    {
+      VPID vpid = m_start_vpid;
+
+      for (int i = 0; i < m_page_count; i++)
+	{
+	  if (VPID_ISNULL (&vpid) || vpid.volid == NULL_VOLID)
+	    {
+	      break;
+	    }
+	  if (!pgbuf_read_ahead_page (&thread_ref, &vpid, m_next_func, &vpid))
+	    {
+	      break;
+	    }
+	}
+    }
+};
+
+/*
+ * pgbuf_read_ahead_page () - read-ahead one page and get its next page in chain
+ *
+ * return         : false if the walk on the chain should stop
+ * thread_p (in)  : thread entry
+ * vpid (in)      : page identifier
+ * next_func (in) : function to get next page in chain
+ * next_vpid (out): next page identifier
+ *
+ * note: pages already in buffer are only peeked, they are not marked as read ahead. read-ahead never waits for page
+ *       latches and never raises errors; if something is wrong, the scan will find out by itself.
+ */
+static bool
+pgbuf_read_ahead_page (THREAD_ENTRY * thread_p, const VPID * vpid, PGBUF_READ_AHEAD_NEXT_FUNC next_func,
+		       VPID * next_vpid)
+{
+  PGBUF_BUFFER_HASH *hash_anchor;
+  PGBUF_BCB *bufptr;
+  PAGE_PTR pgptr;
+  PAGE_FETCH_MODE fetch_mode;
+
+  hash_anchor = &pgbuf_Pool.buf_hash_table[PGBUF_HASH_VALUE (vpid)];
+  bufptr = pgbuf_search_hash_chain (thread_p, hash_anchor, vpid);
+  if (bufptr != NULL)
+    {
+      PGBUF_BCB_UNLOCK (bufptr);
+      fetch_mode = OLD_PAGE_IF_IN_BUFFER;
+    }
+  else
+    {
+      pthread_mutex_unlock (&hash_anchor->hash_mutex);
+      fetch_mode = OLD_PAGE_MAYBE_DEALLOCATED;
+    }
+
+  pgptr = pgbuf_fix (thread_p, vpid, fetch_mode, PGBUF_LATCH_READ, PGBUF_CONDITIONAL_LATCH);
+  if (pgptr == NULL)
+    {
+      /* latched by someone else, evicted meanwhile or deallocated */
+      er_clear ();
+      return false;
+    }
+
+  if (fetch_mode != OLD_PAGE_IF_IN_BUFFER)
+    {
+      CAST_PGPTR_TO_BFPTR (bufptr, pgptr);
+      pgbuf_bcb_update_flags (thread_p, bufptr, PGBUF_BCB_READ_AHEAD_FLAG, 0);
+      perfmon_inc_stat (thread_p, PSTAT_PB_READ_AHEAD_PAGES);
+    }
+
+  next_func (thread_p, pgptr, next_vpid);
+  pgbuf_unfix_and_init (thread_p, pgptr);
+
+  return true;
+}
+#endif /* SERVER_MODE */
+
+/*
+ * pgbuf_read_ahead_init () - initialize read-ahead state of a scan
+ *
+ * return          : void
+ * read_ahead (out): read-ahead state
+ */
+void
+pgbuf_read_ahead_init (PAGE_READ_AHEAD * read_ahead)
+{
+  VPID_SET_NULL (&read_ahead->expected_vpid);
+  read_ahead->seq_pages = 0;
+  read_ahead->pages_ahead = 0;
+}
+
+/*
+ * pgbuf_read_ahead () - notify read-ahead that a scan leaves a page for its next page in chain
+ *
+ * return             : void
+ * thread_p (in)      : thread entry
+ * read_ahead (in/out): read-ahead state of the scan
+ * vpid (in)          : page the scan leaves
+ * next_vpid (in)     : next page of vpid in chain, the page the scan goes to
+ * next_func (in)     : function to get next page of a page in chain
+ *
+ * note: once the scan visited PGBUF_READ_AHEAD_MIN_SEQ_PAGES pages in chain order, the next
+ *       data_buffer_read_ahead_pages pages of the chain are read in background by read-ahead workers. the next request
+ *       is sent when the scan consumed half of them. if all workers are busy, the request is dropped and the scan reads
+ *       its pages as usual.
+ *
+ *       the pages are read one by one, using the regular page buffer fix. pages already in buffer are skipped.
+ */
+void
+pgbuf_read_ahead (THREAD_ENTRY * thread_p, PAGE_READ_AHEAD * read_ahead, const VPID * vpid, const VPID * next_vpid,
+		  PGBUF_READ_AHEAD_NEXT_FUNC next_func)
+{
+#if defined (SERVER_MODE)
+  int window = prm_get_integer_value (PRM_ID_DATA_BUFFER_READ_AHEAD_PAGES);
+  pgbuf_read_ahead_task *task;
+
+  if (VPID_EQ (vpid, &read_ahead->expected_vpid))
+    {
+      read_ahead->seq_pages++;
+      if (read_ahead->pages_ahead > 0)
+	{
+	  read_ahead->pages_ahead--;
+	}
+    }
+  else
+    {
+      /* the scan jumped; start over */
+      read_ahead->seq_pages = 1;
+      read_ahead->pages_ahead = 0;
+    }
+  read_ahead->expected_vpid = *next_vpid;
+
+  if (window <= 0 || pgbuf_Read_ahead_workers == NULL)
+    {
+      return;
+    }
+  if (VPID_ISNULL (next_vpid) || next_vpid->volid == NULL_VOLID)
+    {
+      /* end of chain or a page that is not in page buffer (e.g. list file membuf page) */
+      return;
+    }
+  if (read_ahead->seq_pages < PGBUF_READ_AHEAD_MIN_SEQ_PAGES || read_ahead->pages_ahead > window / 2)
+    {
+      return;
+    }
+
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
+  task = new pgbuf_read_ahead_task (*next_vpid, window, next_func);
+  if (!cubthread::get_manager ()->try_task (*thread_p, pgbuf_Read_ahead_workers, task))
+    {
+      /* all workers are busy */
+      delete task;
+      return;
+    }
+  read_ahead->pages_ahead = window;
+#endif /* SERVER_MODE */
+}
+
+#if defined (SERVER_MODE)
+/*
+ * pgbuf_read_ahead_workers_init () - initialize read-ahead worker pool
+ */
+static void
+pgbuf_read_ahead_workers_init ()
+{
+  assert (pgbuf_Read_ahead_workers == NULL);
+
+  pgbuf_Read_ahead_context = new pgbuf_read_ahead_context ();
+  pgbuf_Read_ahead_workers =
+    cubthread::get_manager ()->create_worker_pool (PGBUF_READ_AHEAD_WORKER_COUNT, PGBUF_READ_AHEAD_MAX_TASKS,
+						   "pgbuf_read_ahead", pgbuf_Read_ahead_context, 1, false);
+  if (pgbuf_Read_ahead_workers == NULL)
+    {
+      /* not enough thread entries; scans read their own pages */
+      delete pgbuf_Read_ahead_context;
+      pgbuf_Read_ahead_context = NULL;
+    }
+}
+#endif /* SERVER_MODE */
+
+#if defined (SERVER_MODE)
+/*
+ * pgbuf_read_ahead_workers_destroy () - destroy read-ahead worker pool
+ */
+static void
+pgbuf_read_ahead_workers_destroy ()
+{
+  cubthread::get_manager ()->destroy_worker_pool (pgbuf_Read_ahead_workers);
+  delete pgbuf_Read_ahead_context;
+  pgbuf_Read_ahead_context = NULL;
+}
+#endif /* SERVER_MODE */
+
 #if defined (SERVER_MODE)
 /*
  * pgbuf_daemons_init () - initialize page buffer daemon threads
@@ -16027,6 +16437,7 @@ pgbuf_daemons_init ()
   pgbuf_page_flush_daemon_init ();
   pgbuf_page_post_flush_daemon_init ();
   pgbuf_flush_control_daemon_init ();
+  pgbuf_read_ahead_workers_init ();
 }
 #endif /* SERVER_MODE */
 
@@ -16041,6 +16452,7 @@ pgbuf_daemons_destroy ()
   cubthread::get_manager ()->destroy_daemon (pgbuf_Page_flush_daemon);
   cubthread::get_manager ()->destroy_daemon (pgbuf_Page_post_flush_daemon);
   cubthread::get_manager ()->destroy_daemon (pgbuf_Flush_control_daemon);
+  pgbuf_read_ahead_workers_destroy ();
 }
 #endif /* SERVER_MODE */
 
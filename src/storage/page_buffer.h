@@ -454,6 +454,16 @@ extern bool pgbuf_assign_flushed_pages (THREAD_ENTRY * thread_p);
 extern void pgbuf_notify_vacuum_follows (THREAD_ENTRY * thread_p, PAGE_PTR page);
 extern bool pgbuf_is_io_stressful (void);
 
+/* Read-ahead workers; the thread manager reserves thread entries for them. */
+#define PGBUF_READ_AHEAD_WORKER_COUNT   4
+
+/* get next page of a page chain; used by read-ahead to walk the pages ahead of a scan */
+typedef void (*PGBUF_READ_AHEAD_NEXT_FUNC) (THREAD_ENTRY * thread_p, PAGE_PTR pgptr, VPID * next_vpid);
+
+extern void pgbuf_read_ahead_init (PAGE_READ_AHEAD * read_ahead);
+extern void pgbuf_read_ahead (THREAD_ENTRY * thread_p, PAGE_READ_AHEAD * read_ahead, const VPID * vpid,
+			      const VPID * next_vpid, PGBUF_READ_AHEAD_NEXT_FUNC next_func);
+
 #if defined (SERVER_MODE)
 extern void pgbuf_daemons_init ();
 extern void pgbuf_daemons_destroy ();
@@ -43,6 +43,12 @@
 
 #define STATS_MIN_MAX_SIZE    sizeof(DB_DATA)
 
+/* column statistics are gathered from a sample of the heap pages */
+#define STATS_SAMPLING_HEAP_PAGES   1024	/* heap pages read by a sampled UPDATE STATISTICS */
+#define STATS_SAMPLING_ROWS_MAX     30000	/* rows kept in the sample of each class */
+#define STATS_HISTOGRAM_BUCKETS     32	/* buckets of the equi-depth histogram */
+#define STATS_HISTOGRAM_BOUNDS_MAX  (STATS_HISTOGRAM_BUCKETS + 1)
+
 /* free_and_init routine */
 #define stats_free_statistics_and_init(stats) \
   do \
@@ -71,6 +77,18 @@ struct btree_stats
 #endif
 };
 
+/* Statistical information about the values of a column */
+typedef struct column_stats COLUMN_STATS;
+struct column_stats
+{
+  int ndv;			/* estimated number of distinct non-null values; 0 if not gathered */
+  double null_frac;		/* fraction of null values */
+  int n_bounds;			/* number of histogram bounds; 0 if there is no histogram */
+  double *bounds;		/* equi-depth histogram of the values mapped by stats_value_to_key (); bounds[0] is the
+				 * minimum, bounds[n_bounds - 1] is the maximum and each of the (n_bounds - 1) buckets
+				 * holds the same number of sampled values */
+};
+
 /* Statistical Information about the attribute */
 typedef struct attr_stats ATTR_STATS;
 struct attr_stats
@@ -79,6 +97,7 @@ struct attr_stats
   DB_TYPE type;
   int n_btstats;		/* number of B+tree statistics information */
   BTREE_STATS *bt_stats;	/* pointer to array of BTREE_STATS[n_btstats] */
+  COLUMN_STATS col_stats;	/* statistics of the column values */
 };
 
 /* Statistical Information about the class */
@@ -92,6 +111,8 @@ struct class_stats
   ATTR_STATS *attr_stats;	/* pointer to the array of attribute statistics */
 };
 
+extern bool stats_value_to_key (const DB_VALUE * value, double *key_p);
+
 #if !defined(SERVER_MODE)
 extern int stats_get_statistics (OID * classoid, unsigned int timestamp, CLASS_STATS ** stats_p);
 extern void stats_free_statistics (CLASS_STATS * stats);
@@ -138,6 +138,7 @@ stats_client_unpack_statistics (char *buf_p)
       db_ws_free (class_stats_p);
       return NULL;
     }
+  memset (class_stats_p->attr_stats, 0, class_stats_p->n_attrs * sizeof (ATTR_STATS));
 
   for (i = 0, attr_stats_p = class_stats_p->attr_stats; i < class_stats_p->n_attrs; i++, attr_stats_p++)
     {
@@ -150,6 +151,32 @@ stats_client_unpack_statistics (char *buf_p)
       attr_stats_p->n_btstats = OR_GET_INT (buf_p);
       buf_p += OR_INT_SIZE;
 
+      attr_stats_p->col_stats.ndv = OR_GET_INT (buf_p);
+      buf_p += OR_INT_SIZE;
+
+      OR_GET_DOUBLE (buf_p, &attr_stats_p->col_stats.null_frac);
+      buf_p += OR_DOUBLE_SIZE;
+
+      attr_stats_p->col_stats.n_bounds = OR_GET_INT (buf_p);
+      buf_p += OR_INT_SIZE;
+
+      attr_stats_p->col_stats.bounds = NULL;
+      if (attr_stats_p->col_stats.n_bounds > 0)
+	{
+	  attr_stats_p->col_stats.bounds = (double *) db_ws_alloc (attr_stats_p->col_stats.n_bounds * sizeof (double));
+	  if (attr_stats_p->col_stats.bounds == NULL)
+	    {
+	      stats_free_statistics (class_stats_p);
+	      return NULL;
+	    }
+
+	  for (j = 0; j < attr_stats_p->col_stats.n_bounds; j++)
+	    {
+	      OR_GET_DOUBLE (buf_p, &attr_stats_p->col_stats.bounds[j]);
+	      buf_p += OR_DOUBLE_SIZE;
+	    }
+	}
+
       if (attr_stats_p->n_btstats <= 0)
 	{
 	  attr_stats_p->bt_stats = NULL;
@@ -275,6 +302,12 @@ stats_free_statistics (CLASS_STATS * class_statsp)
 		  db_ws_free (attr_statsp->bt_stats);
 		  attr_statsp->bt_stats = NULL;
 		}
+
+	      if (attr_statsp->col_stats.bounds)
+		{
+		  db_ws_free (attr_statsp->col_stats.bounds);
+		  attr_statsp->col_stats.bounds = NULL;
+		}
 	    }
 	  db_ws_free (class_statsp->attr_stats);
 	  class_statsp->attr_stats = NULL;
@@ -479,6 +512,21 @@ stats_dump (const char *class_name_p, FILE * file_p)
 	  break;
 	}
 
+      fprintf (file_p, "    Distinct values: %d , Null fraction: %.4f\n", attr_stats_p->col_stats.ndv,
+	       attr_stats_p->col_stats.null_frac);
+      if (attr_stats_p->col_stats.n_bounds > 0)
+	{
+	  fprintf (file_p, "    Histogram bounds: ");
+
+	  prefix_p = "";
+	  for (k = 0; k < attr_stats_p->col_stats.n_bounds; k++)
+	    {
+	      fprintf (file_p, "%s%g", prefix_p, attr_stats_p->col_stats.bounds[k]);
+	      prefix_p = ",";
+	    }
+	  fprintf (file_p, "\n");
+	}
+
       if (attr_stats_p->n_btstats > 0)
 	{
 	  fprintf (file_p, "    B+tree statistics:\n");
@@ -25,13 +25,20 @@
 #include "config.h"
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <limits.h>
 #include <math.h>
 
 #include "statistics_sr.h"
 
 #include "btree.h"
 #include "heap_file.h"
+#include "file_manager.h"
+#include "slotted_page.h"
+#include "memory_hash.h"
+#include "object_representation_sr.h"
+#include "dbtype.h"
 #include "boot_sr.h"
 #include "partition_sr.h"
 #include "object_primitive.h"
@@ -62,6 +69,24 @@ struct partition_stats_acumulator
 				 * # of {a, b} ... pkeys[pkeys_size-1] -> # of {a, b, ..., x} */
 };
 
+/* Sampled values of a column. A value is kept either as its histogram key (see stats_value_to_key) or, for types
+   that have no order usable by histograms, as its hash; hashes are only used to count distinct values. */
+typedef enum
+{
+  STATS_SAMPLE_NONE,		/* only nulls are counted */
+  STATS_SAMPLE_KEY,
+  STATS_SAMPLE_HASH
+} STATS_SAMPLE_KIND;
+
+typedef struct stats_column_sample STATS_COLUMN_SAMPLE;
+struct stats_column_sample
+{
+  ATTR_ID id;
+  STATS_SAMPLE_KIND kind;
+  double *values;		/* values[STATS_SAMPLING_ROWS_MAX] */
+  bool *is_null;		/* is_null[STATS_SAMPLING_ROWS_MAX] */
+};
+
 #if defined(ENABLE_UNUSED_FUNCTION)
 static int stats_compare_data (DB_DATA * data1, DB_DATA * data2, DB_TYPE type);
 static int stats_compare_date (DB_DATE * date1, DB_DATE * date2);
@@ -72,6 +97,14 @@ static int stats_compare_money (DB_MONETARY * mn1, DB_MONETARY * mn2);
 #endif
 static int stats_update_partitioned_statistics (THREAD_ENTRY * thread_p, OID * class_oid, OID * partitions, int count,
 						bool with_fullscan);
+static int stats_gather_column_statistics (THREAD_ENTRY * thread_p, OID * class_id_p, HFID * hfid_p,
+					   DISK_REPR * disk_repr_p, int n_objects, bool with_fullscan);
+static int stats_sample_heap_page (THREAD_ENTRY * thread_p, const VPID * vpid, HEAP_CACHE_ATTRINFO * attr_info,
+				   STATS_COLUMN_SAMPLE * samples, int n_samples, INT64 * n_rows_seen_p);
+static void stats_compute_column_statistics (THREAD_ENTRY * thread_p, STATS_COLUMN_SAMPLE * sample, int n_rows,
+					     double n_objects, COLUMN_STATS * col_stats_p);
+static STATS_SAMPLE_KIND stats_get_sample_kind (DB_TYPE type);
+static int stats_compare_sample_values (const void *first, const void *second);
 
 /*
  * xstats_update_statistics () -  Updates the statistics for the objects
@@ -278,6 +311,14 @@ xstats_update_statistics (THREAD_ENTRY * thread_p, OID * class_id_p, bool with_f
 	}			/* for (j = 0; ...) */
     }				/* for (i = 0; ...) */
 
+  /* column statistics are gathered from a sample of the heap */
+  error_code = stats_gather_column_statistics (thread_p, class_id_p, &cls_info_p->ci_hfid, disk_repr_p,
+					       cls_info_p->ci_tot_objects, with_fullscan);
+  if (error_code != NO_ERROR)
+    {
+      goto error;
+    }
+
   error_code = catalog_start_access_with_dir_oid (thread_p, &catalog_access_info, X_LOCK);
   if (error_code != NO_ERROR)
     {
@@ -449,7 +490,7 @@ xstats_get_statistics_from_server (THREAD_ENTRY * thread_p, OID * class_id_p, un
   BTREE_STATS *btree_stats_p;
   OID dir_oid;
   int npages, estimated_nobjs, max_unique_keys;
-  int i, j, k, size, n_attrs, tot_n_btstats, tot_key_info_size;
+  int i, j, k, size, n_attrs, tot_n_btstats, tot_key_info_size, tot_n_bounds;
   char *buf_p, *start_p;
   int key_size;
   int lk_grant_code;
@@ -527,7 +568,7 @@ xstats_get_statistics_from_server (THREAD_ENTRY * thread_p, OID * class_id_p, un
 
   n_attrs = disk_repr_p->n_fixed + disk_repr_p->n_variable;
 
-  tot_n_btstats = tot_key_info_size = 0;
+  tot_n_btstats = tot_key_info_size = tot_n_bounds = 0;
   for (i = 0; i < n_attrs; i++)
     {
       if (i < disk_repr_p->n_fixed)
@@ -540,6 +581,7 @@ xstats_get_statistics_from_server (THREAD_ENTRY * thread_p, OID * class_id_p, un
 	}
 
       tot_n_btstats += disk_attr_p->n_btstats;
+      tot_n_bounds += disk_attr_p->col_stats.n_bounds;
       for (j = 0, btree_stats_p = disk_attr_p->bt_stats; j < disk_attr_p->n_btstats; j++, btree_stats_p++)
 	{
 	  tot_key_info_size += or_packed_domain_size (btree_stats_p->key_type, 0);
@@ -555,8 +597,13 @@ xstats_get_statistics_from_server (THREAD_ENTRY * thread_p, OID * class_id_p, un
 	  + (OR_INT_SIZE	/* id of DISK_ATTR */
 	     + OR_INT_SIZE	/* type of DISK_ATTR */
 	     + OR_INT_SIZE	/* n_btstats of DISK_ATTR */
+	     + OR_INT_SIZE	/* ndv of COLUMN_STATS */
+	     + OR_DOUBLE_SIZE	/* null_frac of COLUMN_STATS */
+	     + OR_INT_SIZE	/* n_bounds of COLUMN_STATS */
 	  ) * n_attrs);		/* number of attributes */
 
+  size += OR_DOUBLE_SIZE * tot_n_bounds;	/* bounds[] of COLUMN_STATS */
+
   size += ((OR_BTID_ALIGNED_SIZE	/* btid of BTREE_STATS */
 	    + OR_INT_SIZE	/* leafs of BTREE_STATS */
 	    + OR_INT_SIZE	/* pages of BTREE_STATS */
@@ -664,6 +711,21 @@ xstats_get_statistics_from_server (THREAD_ENTRY * thread_p, OID * class_id_p, un
       OR_PUT_INT (buf_p, disk_attr_p->n_btstats);
       buf_p += OR_INT_SIZE;
 
+      OR_PUT_INT (buf_p, disk_attr_p->col_stats.ndv);
+      buf_p += OR_INT_SIZE;
+
+      OR_PUT_DOUBLE (buf_p, disk_attr_p->col_stats.null_frac);
+      buf_p += OR_DOUBLE_SIZE;
+
+      OR_PUT_INT (buf_p, disk_attr_p->col_stats.n_bounds);
+      buf_p += OR_INT_SIZE;
+
+      for (j = 0; j < disk_attr_p->col_stats.n_bounds; j++)
+	{
+	  OR_PUT_DOUBLE (buf_p, disk_attr_p->col_stats.bounds[j]);
+	  buf_p += OR_DOUBLE_SIZE;
+	}
+
       for (j = 0, btree_stats_p = disk_attr_p->bt_stats; j < disk_attr_p->n_btstats; j++, btree_stats_p++)
 	{
 	  /* collect maximum unique keys info */
@@ -1171,6 +1233,20 @@ stats_dump_class_statistics (CLASS_STATS * class_stats, FILE * fpp)
 	  break;
 	}
 
+      fprintf (fpp, "    Distinct values: %d , Null fraction: %.4f\n", class_stats->attr_stats[i].col_stats.ndv,
+	       class_stats->attr_stats[i].col_stats.null_frac);
+      if (class_stats->attr_stats[i].col_stats.n_bounds > 0)
+	{
+	  fprintf (fpp, "    Histogram bounds: ");
+	  prefix = "";
+	  for (k = 0; k < class_stats->attr_stats[i].col_stats.n_bounds; k++)
+	    {
+	      fprintf (fpp, "%s%g", prefix, class_stats->attr_stats[i].col_stats.bounds[k]);
+	      prefix = ",";
+	    }
+	  fprintf (fpp, "\n");
+	}
+
       fprintf (fpp, "    BTree statistics:\n");
 
       for (j = 0; j < class_stats->attr_stats[i].n_btstats; j++)
@@ -1349,6 +1425,15 @@ stats_update_partitioned_statistics (THREAD_ENTRY * thread_p, OID * class_id_p,
 	  disk_attr_p = disk_repr_p->variable + (i - disk_repr_p->n_fixed);
 	}
 
+      /* column statistics are merged from partitions; partitions do not share a histogram */
+      if (disk_attr_p->col_stats.bounds != NULL)
+	{
+	  db_private_free_and_init (thread_p, disk_attr_p->col_stats.bounds);
+	}
+      disk_attr_p->col_stats.n_bounds = 0;
+      disk_attr_p->col_stats.ndv = 0;
+      disk_attr_p->col_stats.null_frac = 0;
+
       for (j = 0, btree_stats_p = disk_attr_p->bt_stats; j < disk_attr_p->n_btstats; j++, btree_stats_p++)
 	{
 	  mean[btree_iter].pkeys_size = btree_stats_p->pkeys_size;
@@ -1477,6 +1562,11 @@ stats_update_partitioned_statistics (THREAD_ENTRY * thread_p, OID * class_id_p,
 	  assert_release (subcls_attr_p->id == disk_attr_p->id);
 	  assert_release (subcls_attr_p->n_btstats == disk_attr_p->n_btstats);
 
+	  /* partitions may share values, so the largest count is the safest estimate of the distinct values; nulls are
+	   * counted here and turned into a fraction once all partitions are added */
+	  disk_attr_p->col_stats.ndv = MAX (disk_attr_p->col_stats.ndv, subcls_attr_p->col_stats.ndv);
+	  disk_attr_p->col_stats.null_frac += subcls_attr_p->col_stats.null_frac * subcls_info->ci_tot_objects;
+
 	  for (k = 0, btree_stats_p = disk_attr_p->bt_stats; k < disk_attr_p->n_btstats; k++, btree_stats_p++)
 	    {
 	      const BTREE_STATS *subcls_stats;
@@ -1508,6 +1598,27 @@ stats_update_partitioned_statistics (THREAD_ENTRY * thread_p, OID * class_id_p,
 	}
     }
 
+  for (i = 0; i < disk_repr_p->n_fixed + disk_repr_p->n_variable; i++)
+    {
+      if (i < disk_repr_p->n_fixed)
+	{
+	  disk_attr_p = disk_repr_p->fixed + i;
+	}
+      else
+	{
+	  disk_attr_p = disk_repr_p->variable + (i - disk_repr_p->n_fixed);
+	}
+
+      if (cls_info_p->ci_tot_objects > 0)
+	{
+	  disk_attr_p->col_stats.null_frac /= cls_info_p->ci_tot_objects;
+	}
+      else
+	{
+	  disk_attr_p->col_stats.null_frac = 0;
+	}
+    }
+
   /* compute actual mean */
   for (btree_iter = 0; btree_iter < n_btrees; btree_iter++)
     {
@@ -1837,3 +1948,438 @@ stats_find_inherited_index_stats (OR_CLASSREP * cls_rep, OR_CLASSREP * subcls_re
   er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
   return NULL;
 }
+
+/*
+ * stats_gather_column_statistics () - gather the statistics of the column values of a class from a sample of its heap
+ *   return: error code
+ *   class_id_p(in): class identifier
+ *   hfid_p(in): heap file of the class
+ *   disk_repr_p(in/out): last disk representation of the class; column statistics of its attributes are replaced
+ *   n_objects(in): estimated number of objects of the class
+ *   with_fullscan(in): true iff WITH FULLSCAN
+ *
+ * Note: Whole sectors of heap pages are picked at random (block sampling), so the number of pages read does not
+ *       depend on the size of the class, unless WITH FULLSCAN is used. The rows of the sampled pages are sampled
+ *       again into a reservoir of STATS_SAMPLING_ROWS_MAX rows, from which the number of distinct values, the null
+ *       fraction and an equi-depth histogram are computed for each attribute.
+ */
+static int
+stats_gather_column_statistics (THREAD_ENTRY * thread_p, OID * class_id_p, HFID * hfid_p, DISK_REPR * disk_repr_p,
+				int n_objects, bool with_fullscan)
+{
+  HEAP_CACHE_ATTRINFO attr_info;
+  bool attr_info_started = false;
+  STATS_COLUMN_SAMPLE *samples = NULL;
+  DISK_ATTR *disk_attr_p;
+  VPID *vpids = NULL;
+  int n_vpids = 0, npages_max, n_attrs, n_rows;
+  INT64 n_rows_seen = 0;
+  bool continue_checking = true;
+  int i;
+  int error_code = NO_ERROR;
+
+  n_attrs = disk_repr_p->n_fixed + disk_repr_p->n_variable;
+  if (n_attrs == 0 || HFID_IS_NULL (hfid_p))
+    {
+      return NO_ERROR;
+    }
+
+  samples = (STATS_COLUMN_SAMPLE *) db_private_alloc (thread_p, n_attrs * sizeof (STATS_COLUMN_SAMPLE));
+  if (samples == NULL)
+    {
+      error_code = ER_OUT_OF_VIRTUAL_MEMORY;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error_code, 1, n_attrs * sizeof (STATS_COLUMN_SAMPLE));
+      return error_code;
+    }
+  memset (samples, 0, n_attrs * sizeof (STATS_COLUMN_SAMPLE));
+
+  for (i = 0; i < n_attrs; i++)
+    {
+      disk_attr_p = (i < disk_repr_p->n_fixed) ? disk_repr_p->fixed + i : disk_repr_p->variable + (i -
+												 disk_repr_p->n_fixed);
+
+      samples[i].id = disk_attr_p->id;
+      samples[i].kind = stats_get_sample_kind (disk_attr_p->type);
+      samples[i].is_null = (bool *) db_private_alloc (thread_p, STATS_SAMPLING_ROWS_MAX * sizeof (bool));
+      if (samples[i].is_null == NULL)
+	{
+	  error_code = ER_OUT_OF_VIRTUAL_MEMORY;
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error_code, 1, STATS_SAMPLING_ROWS_MAX * sizeof (bool));
+	  goto end;
+	}
+      if (samples[i].kind != STATS_SAMPLE_NONE)
+	{
+	  samples[i].values = (double *) db_private_alloc (thread_p, STATS_SAMPLING_ROWS_MAX * sizeof (double));
+	  if (samples[i].values == NULL)
+	    {
+	      error_code = ER_OUT_OF_VIRTUAL_MEMORY;
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error_code, 1, STATS_SAMPLING_ROWS_MAX * sizeof (double));
+	      goto end;
+	    }
+	}
+    }
+
+  npages_max = STATS_SAMPLING_HEAP_PAGES;
+  if (with_fullscan)
+    {
+      error_code = file_get_num_user_pages (thread_p, &hfid_p->vfid, &npages_max);
+      if (error_code != NO_ERROR)
+	{
+	  goto end;
+	}
+      npages_max = MAX (npages_max, 1);
+    }
+
+  error_code = file_sample_user_pages (thread_p, &hfid_p->vfid, npages_max, &vpids, &n_vpids);
+  if (error_code != NO_ERROR)
+    {
+      goto end;
+    }
+
+  error_code = heap_attrinfo_start (thread_p, class_id_p, -1, NULL, &attr_info);
+  if (error_code != NO_ERROR)
+    {
+      goto end;
+    }
+  attr_info_started = true;
+
+  for (i = 0; i < n_vpids; i++)
+    {
+      if (logtb_is_interrupted (thread_p, true, &continue_checking))
+	{
+	  error_code = ER_INTERRUPTED;
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error_code, 0);
+	  goto end;
+	}
+
+      error_code = stats_sample_heap_page (thread_p, &vpids[i], &attr_info, samples, n_attrs, &n_rows_seen);
+      if (error_code != NO_ERROR)
+	{
+	  goto end;
+	}
+    }
+
+  /* the sampled pages give a lower bound of the number of objects */
+  n_rows = (int) MIN (n_rows_seen, STATS_SAMPLING_ROWS_MAX);
+  for (i = 0; i < n_attrs; i++)
+    {
+      disk_attr_p = (i < disk_repr_p->n_fixed) ? disk_repr_p->fixed + i : disk_repr_p->variable + (i -
+												 disk_repr_p->n_fixed);
+      stats_compute_column_statistics (thread_p, &samples[i], n_rows, (double) MAX (n_objects, n_rows_seen),
+				       &disk_attr_p->col_stats);
+    }
+
+end:
+  if (attr_info_started)
+    {
+      heap_attrinfo_end (thread_p, &attr_info);
+    }
+  if (vpids != NULL)
+    {
+      db_private_free_and_init (thread_p, vpids);
+    }
+  for (i = 0; i < n_attrs; i++)
+    {
+      if (samples[i].values != NULL)
+	{
+	  db_private_free_and_init (thread_p, samples[i].values);
+	}
+      if (samples[i].is_null != NULL)
+	{
+	  db_private_free_and_init (thread_p, samples[i].is_null);
+	}
+    }
+  db_private_free_and_init (thread_p, samples);
+
+  return error_code;
+}
+
+/*
+ * stats_sample_heap_page () - add the rows of a heap page to the sample
+ *   return: error code
+ *   vpid(in): heap page
+ *   attr_info(in): attribute information of the class
+ *   samples(in/out): sample of each attribute
+ *   n_samples(in): number of attributes
+ *   n_rows_seen_p(in/out): number of rows seen so far
+ *
+ * Note: Rows are kept by reservoir sampling, so the rows of all sampled pages have the same chance to be in the
+ *       sample. Rows which are not kept are not even read. Relocated and big records are sampled where their data
+ *       lives or not at all, respectively; deleted records that are not vacuumed yet are skipped.
+ */
+static int
+stats_sample_heap_page (THREAD_ENTRY * thread_p, const VPID * vpid, HEAP_CACHE_ATTRINFO * attr_info,
+			STATS_COLUMN_SAMPLE * samples, int n_samples, INT64 * n_rows_seen_p)
+{
+  PAGE_PTR pgptr = NULL;
+  RECDES recdes = RECDES_INITIALIZER;
+  MVCC_REC_HEADER mvcc_header;
+  PGSLOTID slotid;
+  OID oid;
+  INT16 record_type;
+  INT64 row;
+  DB_VALUE *value;
+  double key;
+  int i;
+  int error_code = NO_ERROR;
+
+  error_code = pgbuf_fix_if_not_deallocated (thread_p, vpid, PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH, &pgptr);
+  if (error_code != NO_ERROR || pgptr == NULL)
+    {
+      /* page was deallocated since it was sampled */
+      return error_code;
+    }
+
+  if (pgbuf_get_page_ptype (thread_p, pgptr) != PAGE_HEAP)
+    {
+      /* page was reused by another file since it was sampled */
+      goto end;
+    }
+
+  oid.volid = vpid->volid;
+  oid.pageid = vpid->pageid;
+
+  slotid = HEAP_HEADER_AND_CHAIN_SLOTID;
+  while (spage_next_record (pgptr, &slotid, &recdes, PEEK) == S_SUCCESS)
+    {
+      if (slotid == HEAP_HEADER_AND_CHAIN_SLOTID)
+	{
+	  continue;
+	}
+
+      record_type = spage_get_record_type (pgptr, slotid);
+      if (record_type != REC_HOME && record_type != REC_NEWHOME)
+	{
+	  continue;
+	}
+
+      if (or_mvcc_get_header (&recdes, &mvcc_header) != NO_ERROR || MVCC_IS_HEADER_DELID_VALID (&mvcc_header))
+	{
+	  continue;
+	}
+
+      if (*n_rows_seen_p < STATS_SAMPLING_ROWS_MAX)
+	{
+	  row = *n_rows_seen_p;
+	}
+      else
+	{
+	  row = (INT64) (drand48 () * (*n_rows_seen_p + 1));
+	}
+      (*n_rows_seen_p)++;
+
+      if (row >= STATS_SAMPLING_ROWS_MAX)
+	{
+	  continue;
+	}
+
+      oid.slotid = slotid;
+      error_code = heap_attrinfo_read_dbvalues (thread_p, &oid, &recdes, NULL, attr_info);
+      if (error_code != NO_ERROR)
+	{
+	  goto end;
+	}
+
+      for (i = 0; i < n_samples; i++)
+	{
+	  value = heap_attrinfo_access (samples[i].id, attr_info);
+
+	  samples[i].is_null[row] = (value == NULL || DB_IS_NULL (value));
+	  if (samples[i].is_null[row])
+	    {
+	      continue;
+	    }
+
+	  switch (samples[i].kind)
+	    {
+	    case STATS_SAMPLE_KEY:
+	      if (stats_value_to_key (value, &key))
+		{
+		  samples[i].values[row] = key;
+		}
+	      else
+		{
+		  assert (false);
+		  samples[i].values[row] = 0;
+		}
+	      break;
+
+	    case STATS_SAMPLE_HASH:
+	      samples[i].values[row] = (double) mht_valhash (value, UINT_MAX);
+	      break;
+
+	    default:
+	      break;
+	    }
+	}
+    }
+
+end:
+  pgbuf_unfix_and_init (thread_p, pgptr);
+
+  return error_code;
+}
+
+/*
+ * stats_compute_column_statistics () - compute the statistics of a column from its sample
+ *   return: void
+ *   sample(in/out): sample of the column; values are sorted
+ *   n_rows(in): number of sampled rows
+ *   n_objects(in): estimated number of objects of the class
+ *   col_stats_p(out): column statistics
+ *
+ * Note: The number of distinct values of the class is estimated from the sample with the Duj1 estimator of Haas and
+ *       Stokes, n * d / (n - f1 + f1 * n / N), where n is the number of sampled values, d the number of distinct
+ *       sampled values, f1 the number of sampled values that were seen exactly once and N the number of values of
+ *       the class.
+ */
+static void
+stats_compute_column_statistics (THREAD_ENTRY * thread_p, STATS_COLUMN_SAMPLE * sample, int n_rows, double n_objects,
+				 COLUMN_STATS * col_stats_p)
+{
+  int n_values, n_distinct, n_singles, run;
+  double n_class_values, ndv;
+  int i, j;
+
+  if (col_stats_p->bounds != NULL)
+    {
+      db_private_free_and_init (thread_p, col_stats_p->bounds);
+    }
+  col_stats_p->ndv = 0;
+  col_stats_p->null_frac = 0;
+  col_stats_p->n_bounds = 0;
+
+  if (n_rows == 0)
+    {
+      return;
+    }
+
+  /* move the values that are not null to the front */
+  n_values = 0;
+  for (i = 0; i < n_rows; i++)
+    {
+      if (!sample->is_null[i])
+	{
+	  if (sample->values != NULL)
+	    {
+	      sample->values[n_values] = sample->values[i];
+	    }
+	  n_values++;
+	}
+    }
+
+  col_stats_p->null_frac = (double) (n_rows - n_values) / n_rows;
+
+  if (sample->kind == STATS_SAMPLE_NONE || n_values == 0)
+    {
+      return;
+    }
+
+  qsort (sample->values, n_values, sizeof (double), stats_compare_sample_values);
+
+  /* count distinct values and values seen once */
+  n_distinct = n_singles = 0;
+  for (i = 0; i < n_values; i += run)
+    {
+      for (run = 1; i + run < n_values && sample->values[i + run] == sample->values[i]; run++)
+	{
+	  ;
+	}
+      n_distinct++;
+      if (run == 1)
+	{
+	  n_singles++;
+	}
+    }
+
+  n_class_values = MAX (n_objects * (1 - col_stats_p->null_frac), n_values);
+  if (n_values >= n_class_values)
+    {
+      /* the sample holds all values */
+      ndv = n_distinct;
+    }
+  else
+    {
+      ndv = (n_values * n_distinct) / (n_values - n_singles + n_singles * n_values / n_class_values);
+    }
+  ndv = MAX (ndv, n_distinct);
+  ndv = MIN (ndv, n_class_values);
+  col_stats_p->ndv = (int) MIN (ndv, (double) INT_MAX);
+
+  if (sample->kind != STATS_SAMPLE_KEY || n_values < 2)
+    {
+      return;
+    }
+
+  /* equi-depth histogram; the bounds are the quantiles of the sample */
+  col_stats_p->bounds = (double *) db_private_alloc (thread_p, STATS_HISTOGRAM_BOUNDS_MAX * sizeof (double));
+  if (col_stats_p->bounds == NULL)
+    {
+      /* the histogram is only a hint for the optimizer */
+      er_clear ();
+      return;
+    }
+
+  for (j = 0; j < STATS_HISTOGRAM_BOUNDS_MAX; j++)
+    {
+      col_stats_p->bounds[j] = sample->values[(INT64) j * (n_values - 1) / STATS_HISTOGRAM_BUCKETS];
+    }
+  col_stats_p->n_bounds = STATS_HISTOGRAM_BOUNDS_MAX;
+}
+
+/*
+ * stats_get_sample_kind () - how the values of a type are sampled
+ *   return: STATS_SAMPLE_KIND
+ *   type(in): type of the attribute
+ */
+static STATS_SAMPLE_KIND
+stats_get_sample_kind (DB_TYPE type)
+{
+  switch (type)
+    {
+    case DB_TYPE_SHORT:
+    case DB_TYPE_INTEGER:
+    case DB_TYPE_BIGINT:
+    case DB_TYPE_FLOAT:
+    case DB_TYPE_DOUBLE:
+    case DB_TYPE_NUMERIC:
+    case DB_TYPE_MONETARY:
+    case DB_TYPE_DATE:
+    case DB_TYPE_TIME:
+    case DB_TYPE_TIMESTAMP:
+    case DB_TYPE_TIMESTAMPLTZ:
+    case DB_TYPE_TIMESTAMPTZ:
+    case DB_TYPE_DATETIME:
+    case DB_TYPE_DATETIMELTZ:
+    case DB_TYPE_DATETIMETZ:
+      return STATS_SAMPLE_KEY;
+
+    case DB_TYPE_CHAR:
+    case DB_TYPE_VARCHAR:
+    case DB_TYPE_NCHAR:
+    case DB_TYPE_VARNCHAR:
+    case DB_TYPE_BIT:
+    case DB_TYPE_VARBIT:
+    case DB_TYPE_OID:
+    case DB_TYPE_OBJECT:
+      return STATS_SAMPLE_HASH;
+
+    default:
+      return STATS_SAMPLE_NONE;
+    }
+}
+
+/*
+ * stats_compare_sample_values () - qsort compare function of sampled values
+ *   return: -1, 0 or 1
+ *   first(in):
+ *   second(in):
+ */
+static int
+stats_compare_sample_values (const void *first, const void *second)
+{
+  double value1 = *(const double *) first;
+  double value2 = *(const double *) second;
+
+  return (value1 < value2) ? -1 : ((value1 > value2) ? 1 : 0);
+}
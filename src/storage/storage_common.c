@@ -37,6 +37,8 @@
 #include "tz_support.h"
 #include "db_date.h"
 #include "dbtype.h"
+#include "numeric_opfunc.h"
+#include "statistics.h"
 
 
 /* RESERVED_SIZE_IN_PAGE should be aligned */
@@ -338,6 +340,91 @@ db_print_data (DB_TYPE type, DB_DATA * data, FILE * fd)
     }
 }
 
+/*
+ * stats_value_to_key () - map a value to the key used by column histograms
+ *   return: true if the value can be mapped, false otherwise
+ *   value(in): value to map
+ *   key_p(out): key of the value
+ *
+ * Note: the keys keep the order of the values of a type, so that the fraction of the values lower than a constant can
+ *       be interpolated from the histogram bounds. Both the server (when statistics are gathered) and the optimizer
+ *       (when constants are looked up) must use this function.
+ */
+bool
+stats_value_to_key (const DB_VALUE * value, double *key_p)
+{
+  DB_DATETIME *datetime;
+
+  if (value == NULL || DB_IS_NULL (value))
+    {
+      return false;
+    }
+
+  switch (DB_VALUE_TYPE (value))
+    {
+    case DB_TYPE_SHORT:
+      *key_p = (double) db_get_short (value);
+      break;
+
+    case DB_TYPE_INTEGER:
+      *key_p = (double) db_get_int (value);
+      break;
+
+    case DB_TYPE_BIGINT:
+      *key_p = (double) db_get_bigint (value);
+      break;
+
+    case DB_TYPE_FLOAT:
+      *key_p = (double) db_get_float (value);
+      break;
+
+    case DB_TYPE_DOUBLE:
+      *key_p = db_get_double (value);
+      break;
+
+    case DB_TYPE_NUMERIC:
+      numeric_coerce_num_to_double (db_get_numeric (value), DB_VALUE_SCALE (value), key_p);
+      break;
+
+    case DB_TYPE_MONETARY:
+      *key_p = db_get_monetary (value)->amount;
+      break;
+
+    case DB_TYPE_DATE:
+      *key_p = (double) *db_get_date (value);
+      break;
+
+    case DB_TYPE_TIME:
+      *key_p = (double) *db_get_time (value);
+      break;
+
+    case DB_TYPE_TIMESTAMP:
+    case DB_TYPE_TIMESTAMPLTZ:
+      *key_p = (double) *db_get_timestamp (value);
+      break;
+
+    case DB_TYPE_TIMESTAMPTZ:
+      *key_p = (double) db_get_timestamptz (value)->timestamp;
+      break;
+
+    case DB_TYPE_DATETIME:
+    case DB_TYPE_DATETIMELTZ:
+      datetime = db_get_datetime (value);
+      *key_p = (double) datetime->date * MILLISECONDS_OF_ONE_DAY + (double) datetime->time;
+      break;
+
+    case DB_TYPE_DATETIMETZ:
+      datetime = &db_get_datetimetz (value)->datetime;
+      *key_p = (double) datetime->date * MILLISECONDS_OF_ONE_DAY + (double) datetime->time;
+      break;
+
+    default:
+      return false;
+    }
+
+  return true;
+}
+
 int
 recdes_allocate_data_area (RECDES * rec, int size)
 {
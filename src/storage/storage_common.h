@@ -141,6 +141,15 @@ struct btree_node_split_info
 
 typedef char *PAGE_PTR;		/* Pointer to a page */
 
+/* Read-ahead state of a scan that follows a chain of pages. See pgbuf_read_ahead (). */
+typedef struct page_read_ahead PAGE_READ_AHEAD;
+struct page_read_ahead
+{
+  VPID expected_vpid;		/* next page of the last page visited by the scan */
+  int seq_pages;		/* number of pages visited in chain order */
+  int pages_ahead;		/* number of pages requested ahead of the scan */
+};
+
 /* TODO - PAGE_TYPE is used for debugging */
 typedef enum
 {
@@ -180,6 +189,7 @@ typedef enum
   (MAX (ISCAN_OID_BUFFER_MIN_CAPACITY, ISCAN_OID_BUFFER_SIZE))
 
 typedef UINT64 MVCCID;		/* MVCC ID */
+typedef UINT64 MVCC_CSN;	/* MVCC commit sequence number */
 
 
 
@@ -325,6 +335,9 @@ typedef int TRANID;		/* Transaction identifier */
 #define MVCCID_ALL_VISIBLE    ((MVCCID) 3)	/* visible for all transactions */
 #define MVCCID_FIRST	      ((MVCCID) 4)
 
+#define MVCC_CSN_NULL ((MVCC_CSN) 0)	/* snapshot of the active transaction bit area */
+#define MVCC_CSN_FIRST ((MVCC_CSN) 1)
+
 /* is MVCC ID valid? */
 #define MVCCID_IS_VALID(id)	  ((id) != MVCCID_NULL)
 /* is MVCC ID normal? */
@@ -1054,6 +1067,7 @@ typedef enum
   SHOWSTMT_TRAN_TABLES,
   SHOWSTMT_THREADS,
   SHOWSTMT_PAGE_BUFFER_STATUS,
+  SHOWSTMT_LATENCY_HISTOGRAMS,
 
   /* append the new show statement types in here */
 
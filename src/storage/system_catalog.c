@@ -111,8 +111,16 @@ static int rv;
 #define CATALOG_DISK_ATTR_POSITION_OFF   16
 #define CATALOG_DISK_ATTR_CLASSOID_OFF   20
 #define CATALOG_DISK_ATTR_N_BTSTATS_OFF  28
+#define CATALOG_DISK_ATTR_COL_STATS_OFF  32	/* CATALOG_COL_STATS_MAGIC if the column statistics are stored */
+#define CATALOG_DISK_ATTR_NDV_OFF        36
+#define CATALOG_DISK_ATTR_NULL_FRAC_OFF  40
+#define CATALOG_DISK_ATTR_N_BOUNDS_OFF   48
 #define CATALOG_DISK_ATTR_SIZE           80
 
+/* The space of column statistics was reserved and was not initialized by older versions; the magic number tells the
+   statistics were stored. The histogram bounds follow the value of the attribute. */
+#define CATALOG_COL_STATS_MAGIC          0x43535431	/* "CST1" */
+
 #define CATALOG_BT_STATS_BTID_OFF        0
 #define CATALOG_BT_STATS_LEAFS_OFF       OR_BTID_ALIGNED_SIZE
 #define CATALOG_BT_STATS_PAGES_OFF       16
@@ -315,12 +323,16 @@ static int catalog_store_disk_attribute (THREAD_ENTRY * thread_p, DISK_ATTR * di
 					 PGSLOTID * remembered_slotid);
 static int catalog_store_attribute_value (THREAD_ENTRY * thread_p, void *value, int length, CATALOG_RECORD * ct_recordp,
 					  PGSLOTID * remembered_slotid);
+static int catalog_store_column_histogram (THREAD_ENTRY * thread_p, COLUMN_STATS * col_stats_p,
+					   CATALOG_RECORD * ct_recordp, PGSLOTID * remembered_slotid);
 static int catalog_store_btree_statistics (THREAD_ENTRY * thread_p, BTREE_STATS * bt_statsp,
 					   CATALOG_RECORD * ct_recordp, PGSLOTID * remembered_slotid);
 static int catalog_get_record_from_page (THREAD_ENTRY * thread_p, CATALOG_RECORD * ct_recordp);
 static int catalog_fetch_disk_representation (THREAD_ENTRY * thread_p, DISK_REPR * disk_reprp,
 					      CATALOG_RECORD * ct_recordp);
 static int catalog_fetch_disk_attribute (THREAD_ENTRY * thread_p, DISK_ATTR * disk_attrp, CATALOG_RECORD * ct_recordp);
+static int catalog_fetch_column_histogram (THREAD_ENTRY * thread_p, COLUMN_STATS * col_stats_p,
+					   CATALOG_RECORD * ct_recordp);
 static int catalog_fetch_attribute_value (THREAD_ENTRY * thread_p, void *value, int length,
 					  CATALOG_RECORD * ct_recordp);
 static int catalog_fetch_btree_statistics (THREAD_ENTRY * thread_p, BTREE_STATS * bt_statsp,
@@ -431,6 +443,18 @@ catalog_get_disk_attribute (DISK_ATTR * attr_p, char *rec_p)
   OR_GET_OID (rec_p + CATALOG_DISK_ATTR_CLASSOID_OFF, &attr_p->classoid);
   attr_p->n_btstats = OR_GET_INT (rec_p + CATALOG_DISK_ATTR_N_BTSTATS_OFF);
   attr_p->bt_stats = NULL;
+
+  attr_p->col_stats.ndv = 0;
+  attr_p->col_stats.null_frac = 0;
+  attr_p->col_stats.n_bounds = 0;
+  attr_p->col_stats.bounds = NULL;
+  if (OR_GET_INT (rec_p + CATALOG_DISK_ATTR_COL_STATS_OFF) == CATALOG_COL_STATS_MAGIC)
+    {
+      attr_p->col_stats.ndv = OR_GET_INT (rec_p + CATALOG_DISK_ATTR_NDV_OFF);
+      OR_GET_DOUBLE (rec_p + CATALOG_DISK_ATTR_NULL_FRAC_OFF, &attr_p->col_stats.null_frac);
+      attr_p->col_stats.n_bounds = OR_GET_INT (rec_p + CATALOG_DISK_ATTR_N_BOUNDS_OFF);
+      assert (attr_p->col_stats.n_bounds >= 0 && attr_p->col_stats.n_bounds <= STATS_HISTOGRAM_BOUNDS_MAX);
+    }
 }
 
 static void
@@ -468,6 +492,11 @@ catalog_put_disk_attribute (char *rec_p, DISK_ATTR * attr_p)
 
   OR_PUT_OID (rec_p + CATALOG_DISK_ATTR_CLASSOID_OFF, &attr_p->classoid);
   OR_PUT_INT (rec_p + CATALOG_DISK_ATTR_N_BTSTATS_OFF, attr_p->n_btstats);
+
+  OR_PUT_INT (rec_p + CATALOG_DISK_ATTR_COL_STATS_OFF, CATALOG_COL_STATS_MAGIC);
+  OR_PUT_INT (rec_p + CATALOG_DISK_ATTR_NDV_OFF, attr_p->col_stats.ndv);
+  OR_PUT_DOUBLE (rec_p + CATALOG_DISK_ATTR_NULL_FRAC_OFF, attr_p->col_stats.null_frac);
+  OR_PUT_INT (rec_p + CATALOG_DISK_ATTR_N_BOUNDS_OFF, attr_p->col_stats.n_bounds);
 }
 
 static void
@@ -857,6 +886,11 @@ catalog_free_representation (DISK_REPR * repr_p)
 		}
 	      db_private_free_and_init (NULL, attr_p->bt_stats);
 	    }
+
+	  if (attr_p->col_stats.bounds != NULL)
+	    {
+	      db_private_free_and_init (NULL, attr_p->col_stats.bounds);
+	    }
 	}
 
       if (repr_p->fixed != NULL)
@@ -1281,6 +1315,37 @@ catalog_store_attribute_value (THREAD_ENTRY * thread_p, void *value, int length,
   return NO_ERROR;
 }
 
+/*
+ * catalog_store_column_histogram () -
+ *   return: NO_ERROR or ER_FAILED
+ *   col_stats_p(in): pointer to COLUMN_STATS structure (disk representation)
+ *   ct_recordp(in): pointer to CATALOG_RECORD structure (catalog record)
+ *   remembered_slotid(in):
+ *
+ * Note: Store the histogram bounds of the column statistics into catalog record. They follow the attribute value.
+ */
+static int
+catalog_store_column_histogram (THREAD_ENTRY * thread_p, COLUMN_STATS * col_stats_p, CATALOG_RECORD * catalog_record_p,
+				PGSLOTID * remembered_slot_id_p)
+{
+  char packed_bounds[STATS_HISTOGRAM_BOUNDS_MAX * OR_DOUBLE_SIZE];
+  int i;
+
+  assert (col_stats_p->n_bounds >= 0 && col_stats_p->n_bounds <= STATS_HISTOGRAM_BOUNDS_MAX);
+  if (col_stats_p->n_bounds == 0)
+    {
+      return NO_ERROR;
+    }
+
+  for (i = 0; i < col_stats_p->n_bounds; i++)
+    {
+      OR_PUT_DOUBLE (packed_bounds + (OR_DOUBLE_SIZE * i), col_stats_p->bounds[i]);
+    }
+
+  return catalog_store_attribute_value (thread_p, packed_bounds, col_stats_p->n_bounds * OR_DOUBLE_SIZE,
+					catalog_record_p, remembered_slot_id_p);
+}
+
 /*
  * catalog_store_btree_statistics () -
  *   return: NO_ERROR or ER_FAILED
@@ -1478,6 +1543,46 @@ catalog_fetch_attribute_value (THREAD_ENTRY * thread_p, void *value, int length,
   return NO_ERROR;
 }
 
+/*
+ * catalog_fetch_column_histogram () -
+ *   return: NO_ERROR or ER_FAILED
+ *   col_stats_p(in/out): pointer to COLUMN_STATS structure (disk representation)
+ *   ct_recordp(in): pointer to CATALOG_RECORD structure (catalog record)
+ *
+ * Note: Fetch the histogram bounds of the column statistics from catalog record.
+ */
+static int
+catalog_fetch_column_histogram (THREAD_ENTRY * thread_p, COLUMN_STATS * col_stats_p, CATALOG_RECORD * catalog_record_p)
+{
+  char packed_bounds[STATS_HISTOGRAM_BOUNDS_MAX * OR_DOUBLE_SIZE];
+  int i;
+
+  if (col_stats_p->n_bounds <= 0 || col_stats_p->n_bounds > STATS_HISTOGRAM_BOUNDS_MAX)
+    {
+      col_stats_p->n_bounds = 0;
+      return NO_ERROR;
+    }
+
+  if (catalog_fetch_attribute_value (thread_p, packed_bounds, col_stats_p->n_bounds * OR_DOUBLE_SIZE,
+				     catalog_record_p) != NO_ERROR)
+    {
+      return ER_FAILED;
+    }
+
+  col_stats_p->bounds = (double *) db_private_alloc (thread_p, col_stats_p->n_bounds * sizeof (double));
+  if (col_stats_p->bounds == NULL)
+    {
+      return ER_FAILED;
+    }
+
+  for (i = 0; i < col_stats_p->n_bounds; i++)
+    {
+      OR_GET_DOUBLE (packed_bounds + (OR_DOUBLE_SIZE * i), &col_stats_p->bounds[i]);
+    }
+
+  return NO_ERROR;
+}
+
 /*
  * catalog_fetch_btree_statistics () -
  *   return: NO_ERROR or ER_FAILED
@@ -2513,6 +2618,26 @@ catalog_copy_disk_attributes (DISK_ATTR * new_attrs_p, int new_attr_count, DISK_
 
 	  catalog_copy_btree_statistic (new_attr_p->bt_stats, new_attr_p->n_btstats, pre_attr_p->bt_stats,
 					pre_attr_p->n_btstats);
+
+	  if (new_attr_p->type != pre_attr_p->type || new_attr_p->col_stats.bounds != NULL)
+	    {
+	      /* histogram keys of the previous type are meaningless */
+	      continue;
+	    }
+
+	  new_attr_p->col_stats.ndv = pre_attr_p->col_stats.ndv;
+	  new_attr_p->col_stats.null_frac = pre_attr_p->col_stats.null_frac;
+	  if (pre_attr_p->col_stats.n_bounds > 0)
+	    {
+	      new_attr_p->col_stats.bounds =
+		(double *) db_private_alloc (NULL, pre_attr_p->col_stats.n_bounds * sizeof (double));
+	      if (new_attr_p->col_stats.bounds != NULL)
+		{
+		  memcpy (new_attr_p->col_stats.bounds, pre_attr_p->col_stats.bounds,
+			  pre_attr_p->col_stats.n_bounds * sizeof (double));
+		  new_attr_p->col_stats.n_bounds = pre_attr_p->col_stats.n_bounds;
+		}
+	    }
 	}
     }
 }
@@ -2746,6 +2871,7 @@ catalog_sum_disk_attribute_size (DISK_ATTR * attrs_p, int count)
     {
       size += CATALOG_DISK_ATTR_SIZE;
       size += disk_attrp->val_length + (MAX_ALIGNMENT * 2);
+      size += disk_attrp->col_stats.n_bounds * OR_DOUBLE_SIZE;
       for (j = 0; j < disk_attrp->n_btstats; j++)
 	{
 	  size += CATALOG_BT_STATS_SIZE;
@@ -2910,6 +3036,19 @@ catalog_add_representation (THREAD_ENTRY * thread_p, OID * class_id_p, REPR_ID r
 	  return error_code;
 	}
 
+      if (catalog_store_column_histogram (thread_p, &disk_attr_p->col_stats, &catalog_record, &remembered_slot_id)
+	  != NO_ERROR)
+	{
+	  db_private_free_and_init (thread_p, data);
+
+	  ASSERT_ERROR_AND_SET (error_code);
+	  if (do_end_access)
+	    {
+	      catalog_end_access_with_dir_oid (thread_p, catalog_access_info_p, ER_FAILED);
+	    }
+	  return error_code;
+	}
+
       for (j = 0; j < disk_attr_p->n_btstats; j++)
 	{
 	  btree_stats_p = &disk_attr_p->bt_stats[j];
@@ -3780,6 +3919,11 @@ catalog_assign_attribute (THREAD_ENTRY * thread_p, DISK_ATTR * disk_attr_p, CATA
       return ER_FAILED;
     }
 
+  if (catalog_fetch_column_histogram (thread_p, &disk_attr_p->col_stats, catalog_record_p) != NO_ERROR)
+    {
+      return ER_FAILED;
+    }
+
   n_btstats = disk_attr_p->n_btstats;
   if (n_btstats > 0)
     {
@@ -4864,6 +5008,21 @@ catalog_dump_disk_attribute (DISK_ATTR * attr_p)
 	       bt_statsp->height);
     }
 
+  fprintf (stdout, " Column statistics:\n");
+  fprintf (stdout, "    Distinct values: %d , Null fraction: %g\n", attr_p->col_stats.ndv,
+	   attr_p->col_stats.null_frac);
+  if (attr_p->col_stats.n_bounds > 0)
+    {
+      fprintf (stdout, "    Histogram bounds: (");
+      prefix = "";
+      for (i = 0; i < attr_p->col_stats.n_bounds; i++)
+	{
+	  fprintf (stdout, "%s%g", prefix, attr_p->col_stats.bounds[i]);
+	  prefix = ",";
+	}
+      fprintf (stdout, ")\n");
+    }
+
   fprintf (stdout, "\n");
 }
 
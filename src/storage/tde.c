@@ -94,6 +94,57 @@ static int tde_encrypt_internal (const unsigned char *plain_buffer, int length,
 				 const unsigned char *key, const unsigned char *nonce, unsigned char *cipher_buffer);
 static int tde_decrypt_internal (const unsigned char *cipher_buffer, int length, TDE_ALGORITHM tde_algo,
 				 const unsigned char *key, const unsigned char *nonce, unsigned char *plain_buffer);
+static EVP_CIPHER_CTX *tde_get_cipher_ctx (bool is_encrypt, TDE_ALGORITHM tde_algo, const unsigned char *key);
+static int tde_crypt_with_ctx (EVP_CIPHER_CTX * ctx, bool is_encrypt, const unsigned char *in_buffer, int length,
+			       const unsigned char *nonce, unsigned char *out_buffer);
+
+/*
+ * Cipher contexts of a thread, kept with the key already set.
+ *
+ * Creating a context and setting its key (which expands the key schedule) costs more than encrypting a page;
+ * with a context kept for each key, en/decrypting a page only sets the nonce.
+ * All the keys (master key and data keys) are 256 bits long.
+ */
+#define TDE_CTX_CACHE_SIZE 8
+
+// *INDENT-OFF*
+static_assert (TDE_MASTER_KEY_LENGTH == TDE_DATA_KEY_LENGTH, "cached contexts expect keys of one length");
+
+struct tde_ctx_cache_entry
+{
+  EVP_CIPHER_CTX *ctx;
+  bool is_encrypt;
+  TDE_ALGORITHM tde_algo;
+  unsigned char key[TDE_DATA_KEY_LENGTH];
+};
+
+struct tde_ctx_cache
+{
+  tde_ctx_cache_entry entries[TDE_CTX_CACHE_SIZE];
+  int next_victim;
+
+  tde_ctx_cache ()
+    : entries {}
+    , next_victim (0)
+  {
+  }
+
+  ~tde_ctx_cache ()
+  {
+    for (tde_ctx_cache_entry &entry : entries)
+      {
+        if (entry.ctx != NULL)
+          {
+            EVP_CIPHER_CTX_free (entry.ctx);
+            entry.ctx = NULL;
+          }
+        OPENSSL_cleanse (entry.key, sizeof (entry.key));
+      }
+  }
+};
+
+static thread_local tde_ctx_cache tde_Ctx_cache;
+// *INDENT-ON*
 
 /*
  * tde_initialize () - Initialize the tde module, which is called during initializing server.
@@ -1046,82 +1097,85 @@ tde_decrypt_log_page (const LOG_PAGE * logpage_cipher, TDE_ALGORITHM tde_algo, L
 }
 
 /*
- * tde_encrypt_internal () - Gerneral encryption function
+ * tde_encrypt_log_pages () - Encrypt a run of log pages in one pass.
  *
  * return               : Error code
- * plain_buffer (in)    : Data to encrypt
- * length (in)          : The length of data
- * tde_algo (in)        : Encryption algorithm
- * key (in)             : key
- * nonce (in)           : nonce, which has to be unique in time and space
- * cipher_buffer (out)  : Encrypted data
+ * logpages_plain (in)  : Log pages to encrypt
+ * npages (in)          : The number of pages
+ * tde_algo (in)        : Encryption algorithm, the same for all the pages
+ * logpages_cipher (out): Contiguous area of npages log pages, for the encrypted pages
  *
- * plain_buffer and cipher_buffer has more space than length
+ * The pages are laid out in logpages_cipher in order so that they can be written with a single call.
  */
-static int
-tde_encrypt_internal (const unsigned char *plain_buffer, int length, TDE_ALGORITHM tde_algo, const unsigned char *key,
-		      const unsigned char *nonce, unsigned char *cipher_buffer)
+int
+tde_encrypt_log_pages (LOG_PAGE * const *logpages_plain, int npages, TDE_ALGORITHM tde_algo, char *logpages_cipher)
 {
+  unsigned char nonce[TDE_LOG_PAGE_NONCE_LENGTH] = { 0, };
+  const LOG_PAGE *logpage_plain;
+  LOG_PAGE *logpage_cipher;
   EVP_CIPHER_CTX *ctx;
-  const EVP_CIPHER *cipher_type;
-  int len;
-  int cipher_len;
-  int err = ER_TDE_ENCRYPTION_ERROR;
-
-  if ((ctx = EVP_CIPHER_CTX_new ()) == NULL)
-    {
-      goto exit;
-    }
+  int i;
 
-  switch (tde_algo)
+  if (tde_Cipher.is_loaded == false)
     {
-    case TDE_ALGORITHM_AES:
-      cipher_type = EVP_aes_256_ctr ();
-      break;
-    case TDE_ALGORITHM_ARIA:
-      cipher_type = EVP_aria_256_ctr ();
-      break;
-    case TDE_ALGORITHM_NONE:
-    default:
-      assert (false);
-      goto cleanup;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TDE_CIPHER_IS_NOT_LOADED, 0);
+      return ER_TDE_CIPHER_IS_NOT_LOADED;
     }
 
-  if (EVP_EncryptInit_ex (ctx, cipher_type, NULL, key, nonce) != 1)
+  ctx = tde_get_cipher_ctx (true, tde_algo, tde_Cipher.data_keys.log_key);
+  if (ctx == NULL)
     {
-      goto cleanup;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TDE_ENCRYPTION_ERROR, 0);
+      return ER_TDE_ENCRYPTION_ERROR;
     }
 
-  if (EVP_EncryptUpdate (ctx, cipher_buffer, &len, plain_buffer, length) != 1)
+  for (i = 0; i < npages; i++)
     {
-      goto cleanup;
-    }
-  cipher_len = len;
+      logpage_plain = logpages_plain[i];
+      logpage_cipher = (LOG_PAGE *) (logpages_cipher + (size_t) i * LOG_PAGESIZE);
 
-  // Further ciphertext bytes may be written at finalizing (Partial block).
+      memcpy (nonce, &logpage_plain->hdr.logical_pageid, sizeof (logpage_plain->hdr.logical_pageid));
+      memcpy (logpage_cipher, logpage_plain, TDE_LOG_PAGE_ENC_OFFSET);
 
-  if (EVP_EncryptFinal_ex (ctx, cipher_buffer + len, &len) != 1)
-    {
-      goto cleanup;
+      if (tde_crypt_with_ctx (ctx, true, ((const unsigned char *) logpage_plain) + TDE_LOG_PAGE_ENC_OFFSET,
+			      TDE_LOG_PAGE_ENC_LENGTH, nonce,
+			      ((unsigned char *) logpage_cipher) + TDE_LOG_PAGE_ENC_OFFSET) != NO_ERROR)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TDE_ENCRYPTION_ERROR, 0);
+	  return ER_TDE_ENCRYPTION_ERROR;
+	}
     }
 
-  cipher_len += len;
-
-  // CTR_MODE is stream mode so that there is no need to check,
-  // but check it for safe.
-  assert (cipher_len == length);
-
-  err = NO_ERROR;
+  return NO_ERROR;
+}
 
-cleanup:
-  EVP_CIPHER_CTX_free (ctx);
+/*
+ * tde_encrypt_internal () - Gerneral encryption function
+ *
+ * return               : Error code
+ * plain_buffer (in)    : Data to encrypt
+ * length (in)          : The length of data
+ * tde_algo (in)        : Encryption algorithm
+ * key (in)             : key
+ * nonce (in)           : nonce, which has to be unique in time and space
+ * cipher_buffer (out)  : Encrypted data
+ *
+ * plain_buffer and cipher_buffer has more space than length
+ */
+static int
+tde_encrypt_internal (const unsigned char *plain_buffer, int length, TDE_ALGORITHM tde_algo, const unsigned char *key,
+		      const unsigned char *nonce, unsigned char *cipher_buffer)
+{
+  EVP_CIPHER_CTX *ctx;
 
-exit:
-  if (err != NO_ERROR)
+  ctx = tde_get_cipher_ctx (true, tde_algo, key);
+  if (ctx == NULL || tde_crypt_with_ctx (ctx, true, plain_buffer, length, nonce, cipher_buffer) != NO_ERROR)
     {
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TDE_ENCRYPTION_ERROR, 0);
+      return ER_TDE_ENCRYPTION_ERROR;
     }
-  return err;
+
+  return NO_ERROR;
 }
 
 /*
@@ -1142,14 +1196,43 @@ tde_decrypt_internal (const unsigned char *cipher_buffer, int length, TDE_ALGORI
 		      const unsigned char *nonce, unsigned char *plain_buffer)
 {
   EVP_CIPHER_CTX *ctx;
+
+  ctx = tde_get_cipher_ctx (false, tde_algo, key);
+  if (ctx == NULL || tde_crypt_with_ctx (ctx, false, cipher_buffer, length, nonce, plain_buffer) != NO_ERROR)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TDE_DECRYPTION_ERROR, 0);
+      return ER_TDE_DECRYPTION_ERROR;
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * tde_get_cipher_ctx () - Get a cipher context of this thread with the key set
+ *
+ * return               : Cipher context, NULL on failure
+ * is_encrypt (in)      : Whether the context is for encryption or decryption
+ * tde_algo (in)        : Encryption algorithm
+ * key (in)             : key
+ *
+ * The context stays owned by the thread and is only valid until the next call.
+ */
+static EVP_CIPHER_CTX *
+tde_get_cipher_ctx (bool is_encrypt, TDE_ALGORITHM tde_algo, const unsigned char *key)
+{
+  tde_ctx_cache_entry *entry;
   const EVP_CIPHER *cipher_type;
-  int len;
-  int plain_len;
-  int err = ER_TDE_DECRYPTION_ERROR;
+  int i;
+  int res;
 
-  if ((ctx = EVP_CIPHER_CTX_new ()) == NULL)
+  for (i = 0; i < TDE_CTX_CACHE_SIZE; i++)
     {
-      goto exit;
+      entry = &tde_Ctx_cache.entries[i];
+      if (entry->ctx != NULL && entry->is_encrypt == is_encrypt && entry->tde_algo == tde_algo
+	  && memcmp (entry->key, key, TDE_DATA_KEY_LENGTH) == 0)
+	{
+	  return entry->ctx;
+	}
     }
 
   switch (tde_algo)
@@ -1163,42 +1246,115 @@ tde_decrypt_internal (const unsigned char *cipher_buffer, int length, TDE_ALGORI
     case TDE_ALGORITHM_NONE:
     default:
       assert (false);
-      goto cleanup;
+      return NULL;
     }
 
-  if (EVP_DecryptInit_ex (ctx, cipher_type, NULL, key, nonce) != 1)
+  /* replace the entries in turn */
+  entry = &tde_Ctx_cache.entries[tde_Ctx_cache.next_victim];
+  tde_Ctx_cache.next_victim = (tde_Ctx_cache.next_victim + 1) % TDE_CTX_CACHE_SIZE;
+
+  if (entry->ctx == NULL)
+    {
+      entry->ctx = EVP_CIPHER_CTX_new ();
+      if (entry->ctx == NULL)
+	{
+	  return NULL;
+	}
+    }
+  else
     {
-      goto cleanup;
+      EVP_CIPHER_CTX_reset (entry->ctx);
     }
 
-  if (EVP_DecryptUpdate (ctx, plain_buffer, &len, cipher_buffer, length) != 1)
+  if (is_encrypt)
     {
-      goto cleanup;
+      res = EVP_EncryptInit_ex (entry->ctx, cipher_type, NULL, key, NULL);
+    }
+  else
+    {
+      res = EVP_DecryptInit_ex (entry->ctx, cipher_type, NULL, key, NULL);
     }
-  plain_len = len;
 
-  // Further plaintext bytes may be written at finalizing (Partial block).
-  if (EVP_DecryptFinal_ex (ctx, plain_buffer + len, &len) != 1)
+  if (res != 1)
     {
-      goto cleanup;
+      EVP_CIPHER_CTX_free (entry->ctx);
+      entry->ctx = NULL;
+      OPENSSL_cleanse (entry->key, sizeof (entry->key));
+      return NULL;
     }
-  plain_len += len;
 
-  // CTR_MODE is stream mode so that there is no need to check,
-  // but check it for safe.
-  assert (plain_len == length);
+  entry->is_encrypt = is_encrypt;
+  entry->tde_algo = tde_algo;
+  memcpy (entry->key, key, TDE_DATA_KEY_LENGTH);
 
-  err = NO_ERROR;
+  return entry->ctx;
+}
 
-cleanup:
-  EVP_CIPHER_CTX_free (ctx);
+/*
+ * tde_crypt_with_ctx () - En/decrypt data with a context which has the key already set
+ *
+ * return               : NO_ERROR or ER_FAILED
+ * ctx (in)             : Cipher context from tde_get_cipher_ctx ()
+ * is_encrypt (in)      : Whether ctx is for encryption or decryption
+ * in_buffer (in)       : Data to en/decrypt
+ * length (in)          : The length of data
+ * nonce (in)           : nonce
+ * out_buffer (out)     : En/decrypted data
+ */
+static int
+tde_crypt_with_ctx (EVP_CIPHER_CTX * ctx, bool is_encrypt, const unsigned char *in_buffer, int length,
+		    const unsigned char *nonce, unsigned char *out_buffer)
+{
+  int len;
+  int out_len;
 
-exit:
-  if (err != NO_ERROR)
+  if (is_encrypt)
     {
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TDE_DECRYPTION_ERROR, 0);
+      /* Only the nonce is set, which also resets the counter. */
+      if (EVP_EncryptInit_ex (ctx, NULL, NULL, NULL, nonce) != 1)
+	{
+	  return ER_FAILED;
+	}
+
+      if (EVP_EncryptUpdate (ctx, out_buffer, &len, in_buffer, length) != 1)
+	{
+	  return ER_FAILED;
+	}
+      out_len = len;
+
+      // Further ciphertext bytes may be written at finalizing (Partial block).
+      if (EVP_EncryptFinal_ex (ctx, out_buffer + len, &len) != 1)
+	{
+	  return ER_FAILED;
+	}
+      out_len += len;
     }
-  return err;
+  else
+    {
+      if (EVP_DecryptInit_ex (ctx, NULL, NULL, NULL, nonce) != 1)
+	{
+	  return ER_FAILED;
+	}
+
+      if (EVP_DecryptUpdate (ctx, out_buffer, &len, in_buffer, length) != 1)
+	{
+	  return ER_FAILED;
+	}
+      out_len = len;
+
+      // Further plaintext bytes may be written at finalizing (Partial block).
+      if (EVP_DecryptFinal_ex (ctx, out_buffer + len, &len) != 1)
+	{
+	  return ER_FAILED;
+	}
+      out_len += len;
+    }
+
+  // CTR_MODE is stream mode so that there is no need to check,
+  // but check it for safe.
+  assert (out_len == length);
+
+  return NO_ERROR;
 }
 
 /*
@@ -194,6 +194,8 @@ extern int tde_decrypt_data_page (const FILEIO_PAGE * iopage_cipher, TDE_ALGORIT
  */
 extern int tde_encrypt_log_page (const LOG_PAGE * logpage_plain, TDE_ALGORITHM tde_algo, LOG_PAGE * logpage_cipher);
 extern int tde_decrypt_log_page (const LOG_PAGE * logpage_cipher, TDE_ALGORITHM tde_algo, LOG_PAGE * logpage_plain);
+extern int tde_encrypt_log_pages (LOG_PAGE * const *logpages_plain, int npages, TDE_ALGORITHM tde_algo,
+				  char *logpages_cipher);
 
 #endif /* !CS_MODE */
 
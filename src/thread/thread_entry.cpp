@@ -88,6 +88,7 @@ namespace cubthread
     , th_entry_lock ()
     , wakeup_cond ()
     , private_heap_id (0)
+    , private_arena ()
     , cnv_adj_buffer ()
     , conn_entry (NULL)
     , xasl_unpack_info_ptr (NULL)
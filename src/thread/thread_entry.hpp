@@ -29,6 +29,7 @@
 
 #include "error_context.hpp"
 #include "lockfree_transaction_def.hpp"
+#include "memory_arena.hpp"
 #include "porting.h"        // for pthread_mutex_t, drand48_data
 #include "system.h"         // for UINTPTR, INT64, HL_HEAPID
 
@@ -222,6 +223,7 @@ namespace cubthread
       pthread_cond_t wakeup_cond;	/* wakeup condition */
 
       HL_HEAPID private_heap_id;	/* id of thread private memory allocator */
+      cubmem::arena private_arena;	/* execution scoped private allocations; see db_private_arena_push */
       adj_array *cnv_adj_buffer[3];	/* conversion buffer */
 
       css_conn_entry *conn_entry;	/* conn entry ptr */
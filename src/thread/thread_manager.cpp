@@ -37,6 +37,7 @@
 #include "log_impl.h"
 #include "lock_free.h"
 #include "lockfree_transaction_system.hpp"
+#include "page_buffer.h"
 #include "resource_shared_pool.hpp"
 #include "system_parameter.h"
 
@@ -416,6 +417,12 @@ namespace cubthread
     std::size_t max_active_workers = NUM_NON_SYSTEM_TRANS;  // one per each connection
     std::size_t max_conn_workers = NUM_NON_SYSTEM_TRANS;    // one per each connection
     std::size_t max_vacuum_workers = prm_get_integer_value (PRM_ID_VACUUM_WORKER_COUNT);
+    std::size_t max_parallel_scan_workers = prm_get_integer_value (PRM_ID_PARALLEL_HEAP_SCAN_WORKER_COUNT);
+    std::size_t max_sort_workers = prm_get_integer_value (PRM_ID_SORT_PARALLEL_COUNT);
+    std::size_t max_index_load_workers = prm_get_integer_value (PRM_ID_INDEX_LOAD_WORKER_COUNT);
+    std::size_t max_conn_event_loops = prm_get_integer_value (PRM_ID_CSS_EVENT_LOOP_COUNT);
+    std::size_t max_recovery_workers = prm_get_integer_value (PRM_ID_RECOVERY_PARALLEL_COUNT);
+    std::size_t max_read_ahead_workers = PGBUF_READ_AHEAD_WORKER_COUNT;
     std::size_t max_daemons = 128;  // magic number to cover predictable requirements; not cool
 
     // note: thread entry initialization is slow, that is why we keep a static pool initialized from the beginning to
@@ -423,7 +430,9 @@ namespace cubthread
     //       generated at "runtime" (after thread starts its task). however, with current thread entry design, that is
     //       rather unlikely.
 
-    m_max_threads = max_active_workers + max_conn_workers + max_vacuum_workers + max_daemons;
+    m_max_threads = max_active_workers + max_conn_workers + max_vacuum_workers + max_parallel_scan_workers
+		    + max_sort_workers + max_index_load_workers + max_conn_event_loops + max_recovery_workers
+		    + max_read_ahead_workers + max_daemons;
   }
 
   void
@@ -71,6 +71,7 @@
 #include "xserver_interface.h"
 #include "session.h"
 #include "event_log.h"
+#include "external_sort.h"
 #include "tz_support.h"
 #include "filter_pred_cache.h"
 #include "scan_manager.h"
@@ -78,6 +79,7 @@
 #include "thread_manager.hpp"
 #include "double_write_buffer.h"
 #include "xasl_cache.h"
+#include "query_executor.h"
 #include "log_volids.hpp"
 #include "vacuum.h"
 #include "tde.h"
@@ -2495,6 +2497,8 @@ boot_restart_server (THREAD_ENTRY * thread_p, bool print_restart, const char *db
 #if defined(SERVER_MODE)
   pgbuf_daemons_init ();
   dwb_daemons_init ();
+  qexec_parallel_scan_workers_init ();
+  sort_workers_init ();
 #endif /* SERVER_MODE */
 
   // after recovery we can boot vacuum
@@ -2806,6 +2810,8 @@ error:
   vacuum_stop_master (thread_p);
 
 #if defined(SERVER_MODE)
+  qexec_parallel_scan_workers_destroy ();
+  sort_workers_destroy ();
   pgbuf_daemons_destroy ();
   dwb_daemons_destroy ();
 #endif
@@ -3113,6 +3119,8 @@ xboot_shutdown_server (REFPTR (THREAD_ENTRY, thread_p), ER_FINAL_CODE is_er_fina
   vacuum_stop_master (thread_p);
 
 #if defined(SERVER_MODE)
+  qexec_parallel_scan_workers_destroy ();
+  sort_workers_destroy ();
   pgbuf_daemons_destroy ();
 #endif
 
@@ -13709,21 +13709,480 @@ xlocator_demote_class_lock (THREAD_ENTRY * thread_p, const OID * class_oid, LOCK
 }
 
 // *INDENT-OFF*
+/*
+ * locator_deferred_index - keys of a batch of records for one index, inserted after the records of the batch are
+ *                          inserted in heap (see locator_multi_insert_force)
+ */
+struct locator_deferred_index
+{
+  struct key_entry
+  {
+    DB_VALUE key;
+    size_t record;		/* position of the record in the batch */
+  };
+
+  TP_DOMAIN *key_type;
+  std::vector<key_entry> keys;	/* in key order, null keys first */
+};
+
+/*
+ * locator_is_null_index_key () - is the index key null, that is, not stored in the index
+ *
+ * return : true if key is null
+ * key (in) : index key
+ */
+static bool
+locator_is_null_index_key (DB_VALUE * key)
+{
+  return DB_IS_NULL (key) || btree_multicol_key_is_null (key);
+}
+
+/*
+ * locator_clear_deferred_indexes () - free the keys of the deferred indexes
+ *
+ * return : void
+ * indexes (in/out) : deferred indexes
+ */
+static void
+locator_clear_deferred_indexes (std::vector<locator_deferred_index> &indexes)
+{
+  for (locator_deferred_index &index : indexes)
+    {
+      for (locator_deferred_index::key_entry &entry : index.keys)
+	{
+	  pr_clear_value (&entry.key);
+	}
+      index.keys.clear ();
+    }
+}
+
+/*
+ * locator_generate_deferred_index_keys () - generate the keys of every index for a batch of records not yet inserted
+ *                                           in heap, and sort the keys of each index
+ *
+ * return : error code
+ * thread_p (in)       : thread entry
+ * class_oid (in)      : class identifier
+ * recdes (in)         : records of the batch
+ * index_attrinfo (in) : attribute information started with the indexes of the class
+ * idx_info (in)       : index information of the class
+ * func_preds (in)     : cached function index expressions
+ * indexes (out)       : keys of each index
+ */
+static int
+locator_generate_deferred_index_keys (THREAD_ENTRY * thread_p, OID * class_oid,
+				      const std::vector<record_descriptor> &recdes, HEAP_CACHE_ATTRINFO * index_attrinfo,
+				      HEAP_IDX_ELEMENTS_INFO * idx_info, FUNC_PRED_UNPACK_INFO * func_preds,
+				      std::vector<locator_deferred_index> &indexes)
+{
+  OID oid = oid_Null_oid;	/* the records are not in heap yet */
+  OID *oid_p = &oid;
+  BTID btid;
+  DB_VALUE dbvalue, *key_dbvalue;
+  char buf[DBVAL_BUFSIZE + MAX_ALIGNMENT], *aligned_buf;
+  OR_INDEX *index;
+  OR_PREDICATE *or_pred;
+  DB_LOGICAL ev_res;
+  int i;
+  int error_code = NO_ERROR;
+
+  db_make_null (&dbvalue);
+  aligned_buf = PTR_ALIGN (buf, MAX_ALIGNMENT);
+
+  indexes.resize (idx_info->num_btids);
+
+  for (size_t r = 0; r < recdes.size (); r++)
+    {
+      RECDES record = recdes[r].get_recdes ();
+      RECDES *record_p = &record;
+
+      if (idx_info->has_single_col)
+	{
+	  error_code = heap_attrinfo_read_dbvalues (thread_p, &oid, &record, NULL, index_attrinfo);
+	  if (error_code != NO_ERROR)
+	    {
+	      return error_code;
+	    }
+	}
+
+      for (i = 0; i < idx_info->num_btids; i++)
+	{
+	  index = &index_attrinfo->last_classrepr->indexes[i];
+	  if (i >= 1 && locator_was_index_already_applied (index_attrinfo, &index->btid, i))
+	    {
+	      continue;
+	    }
+
+	  or_pred = index->filter_predicate;
+	  if (or_pred && or_pred->pred_stream)
+	    {
+	      error_code =
+		locator_eval_filter_predicate (thread_p, &index->btid, or_pred, class_oid, &oid_p, 1, &record_p,
+					       &ev_res);
+	      if (error_code == ER_FAILED)
+		{
+		  return error_code;
+		}
+	      else if (ev_res != V_TRUE)
+		{
+		  continue;
+		}
+	    }
+
+	  key_dbvalue =
+	    heap_attrvalue_get_key (thread_p, i, index_attrinfo, &record, &btid, &dbvalue, aligned_buf,
+				    (func_preds ? &func_preds[i] : NULL), NULL);
+	  if (key_dbvalue == NULL)
+	    {
+	      return ER_FAILED;
+	    }
+
+	  locator_deferred_index::key_entry entry;
+	  entry.record = r;
+	  error_code = pr_clone_value (key_dbvalue, &entry.key);
+	  if (key_dbvalue == &dbvalue)
+	    {
+	      pr_clear_value (&dbvalue);
+	    }
+	  if (error_code != NO_ERROR)
+	    {
+	      return error_code;
+	    }
+	  indexes[i].keys.push_back (entry);
+	}
+    }
+
+  for (i = 0; i < idx_info->num_btids; i++)
+    {
+      if (indexes[i].keys.empty ())
+	{
+	  continue;
+	}
+
+      TP_DOMAIN *key_type = btree_read_key_type (thread_p, &index_attrinfo->last_classrepr->indexes[i].btid);
+      if (key_type == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error_code);
+	  return error_code;
+	}
+      indexes[i].key_type = key_type;
+
+      std::stable_sort (indexes[i].keys.begin (), indexes[i].keys.end (),
+			[key_type] (const locator_deferred_index::key_entry & a,
+				    const locator_deferred_index::key_entry & b)
+	{
+	  DB_VALUE *a_key = const_cast<DB_VALUE *> (&a.key);
+	  DB_VALUE *b_key = const_cast<DB_VALUE *> (&b.key);
+	  bool a_is_null = locator_is_null_index_key (a_key);
+	  bool b_is_null = locator_is_null_index_key (b_key);
+
+	  if (a_is_null || b_is_null)
+	    {
+	      return a_is_null && !b_is_null;
+	    }
+	  return btree_compare_key (a_key, b_key, key_type, 1, 1, NULL) == DB_LT;
+	});
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * locator_reject_unique_violations () - find the records of a batch whose key of a unique index is already used
+ *
+ * return : error code
+ * thread_p (in)       : thread entry
+ * class_oid (in)      : class identifier
+ * index_attrinfo (in) : attribute information started with the indexes of the class
+ * indexes (in)        : sorted keys of each index of the batch
+ * is_rejected (in/out): records of the batch that must not be inserted
+ * violations (out)    : report of the rejected records
+ *
+ * Note: Of the records of the batch that have the same key, the first one is kept, unless the key is already in the
+ *       index. A record rejected for one index does not use its keys of the indexes checked after it.
+ */
+static int
+locator_reject_unique_violations (THREAD_ENTRY * thread_p, OID * class_oid, HEAP_CACHE_ATTRINFO * index_attrinfo,
+				  std::vector<locator_deferred_index> &indexes, std::vector<bool> &is_rejected,
+				  std::vector<locator_unique_violation> &violations)
+{
+  OR_INDEX *index;
+  DB_VALUE *group_key;
+  OID found_oid;
+  BTREE_SEARCH search;
+  bool is_used = false;
+  int error_code = NO_ERROR;
+
+  for (size_t i = 0; i < indexes.size (); i++)
+    {
+      index = &index_attrinfo->last_classrepr->indexes[i];
+      if (!btree_is_unique_type (index->type) || indexes[i].keys.empty ())
+	{
+	  continue;
+	}
+
+      group_key = NULL;
+      for (locator_deferred_index::key_entry &entry : indexes[i].keys)
+	{
+	  if (locator_is_null_index_key (&entry.key) || is_rejected[entry.record])
+	    {
+	      continue;
+	    }
+
+	  if (group_key == NULL || btree_compare_key (&entry.key, group_key, indexes[i].key_type, 1, 1, NULL) != DB_EQ)
+	    {
+	      /* first record of the batch with this key */
+	      group_key = &entry.key;
+	      search = xbtree_find_unique (thread_p, &index->btid, S_SELECT, &entry.key, class_oid, &found_oid, true);
+	      if (search == BTREE_ERROR_OCCURRED)
+		{
+		  ASSERT_ERROR_AND_SET (error_code);
+		  return error_code;
+		}
+	      is_used = (search == BTREE_KEY_FOUND);
+	    }
+
+	  if (is_used)
+	    {
+	      char *key_string = pr_valstring (&entry.key);
+
+	      is_rejected[entry.record] = true;
+	      violations.push_back ({ entry.record, index->btname != NULL ? index->btname : "",
+				      key_string != NULL ? key_string : "" });
+	      if (key_string != NULL)
+		{
+		  db_private_free (thread_p, key_string);
+		}
+	    }
+
+	  /* the next records with this key conflict with this one or with the index */
+	  is_used = true;
+	}
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * locator_insert_deferred_index_keys () - insert the index keys of a batch whose records are inserted in heap
+ *
+ * return : error code
+ * thread_p (in)       : thread entry
+ * class_oid (in)      : class identifier
+ * index_attrinfo (in) : attribute information started with the indexes of the class
+ * indexes (in)        : sorted keys of each index of the batch
+ * oids (in)           : object identifier of each record of the batch; null if the record was rejected
+ * op_type (in)        : operation type
+ * scan_cache (in)     : scan cache used to insert the records
+ * has_BU_lock (in)    : true if the class is locked for bulk update
+ *
+ * Note: The keys of an index are inserted one after another and in key order, so consecutive inserts land on the same
+ *       or on neighbouring leaves. When the class is locked for bulk update and an index is still empty, the index is
+ *       built bottom-up from the keys by btree_load_sorted_keys instead.
+ */
+static int
+locator_insert_deferred_index_keys (THREAD_ENTRY * thread_p, OID * class_oid, HEAP_CACHE_ATTRINFO * index_attrinfo,
+				    std::vector<locator_deferred_index> &indexes, const std::vector<OID> &oids,
+				    int op_type, HEAP_SCANCACHE * scan_cache, bool has_BU_lock)
+{
+  BTID btid;
+  OR_INDEX *index;
+  btree_unique_stats *unique_stat_info;
+  int unique_pk;
+  bool is_loaded;
+  bool use_mvcc = false;
+  MVCCID mvccid;
+  MVCC_REC_HEADER mvcc_rec_header[2];
+  MVCC_REC_HEADER *p_mvcc_rec_header = NULL;
+  int error_code = NO_ERROR;
+
+#if defined(SERVER_MODE)
+  if (!mvcc_is_mvcc_disabled_class (class_oid) && !has_BU_lock)
+    {
+      use_mvcc = true;
+      mvccid = logtb_get_current_mvccid (thread_p);
+    }
+#endif /* SERVER_MODE */
+
+  for (size_t i = 0; i < indexes.size (); i++)
+    {
+      if (indexes[i].keys.empty ())
+	{
+	  continue;
+	}
+
+      index = &index_attrinfo->last_classrepr->indexes[i];
+      btid = index->btid;
+
+      if (scan_cache != NULL
+	  && (op_type == MULTI_ROW_UPDATE || op_type == MULTI_ROW_INSERT || op_type == MULTI_ROW_DELETE))
+	{
+	  assert (scan_cache->m_index_stats != NULL);
+	  unique_stat_info = &scan_cache->m_index_stats->get_stats_of (btid);
+	}
+      else
+	{
+	  unique_stat_info = NULL;
+	}
+
+      unique_pk = 0;
+      if (index->type == BTREE_UNIQUE || index->type == BTREE_REVERSE_UNIQUE)
+	{
+	  unique_pk = BTREE_CONSTRAINT_UNIQUE;
+	}
+      else if (index->type == BTREE_PRIMARY_KEY)
+	{
+	  unique_pk = BTREE_CONSTRAINT_UNIQUE | BTREE_CONSTRAINT_PRIMARY_KEY;
+	}
+
+      is_loaded = false;
+      if (has_BU_lock && index->index_status != OR_ONLINE_INDEX_BUILDING_IN_PROGRESS)
+	{
+	  std::vector<DB_VALUE> load_keys;
+	  std::vector<OID> load_oids;
+	  btree_unique_stats incr;
+
+	  for (locator_deferred_index::key_entry &entry : indexes[i].keys)
+	    {
+	      if (OID_ISNULL (&oids[entry.record]))
+		{
+		  continue;
+		}
+	      if (locator_is_null_index_key (&entry.key))
+		{
+		  incr.insert_null_and_row ();
+		  continue;
+		}
+	      load_keys.push_back (entry.key);
+	      load_oids.push_back (oids[entry.record]);
+	      incr.insert_key_and_row ();
+	    }
+
+	  if (!BTREE_IS_UNIQUE (unique_pk))
+	    {
+	      /* objects of the same key are kept in OID order in the overflow pages */
+	      size_t run_end;
+	      for (size_t run_start = 0; run_start < load_keys.size (); run_start = run_end)
+		{
+		  run_end = run_start + 1;
+		  while (run_end < load_keys.size ()
+			 && btree_compare_key (&load_keys[run_end], &load_keys[run_start], indexes[i].key_type, 1, 1,
+					       NULL) == DB_EQ)
+		    {
+		      run_end++;
+		    }
+		  std::sort (load_oids.begin () + run_start, load_oids.begin () + run_end, [] (const OID & a, const OID & b)
+		    {
+		      return OID_LT (&a, &b);
+		    });
+		}
+	    }
+
+	  if (!load_keys.empty ())
+	    {
+	      error_code = btree_load_sorted_keys (thread_p, &btid, index->btname, class_oid, load_keys.data (),
+						   load_oids.data (), (int) load_keys.size (), &is_loaded);
+	      if (error_code != NO_ERROR)
+		{
+		  ASSERT_ERROR ();
+		  return error_code;
+		}
+	    }
+
+	  if (is_loaded && BTREE_IS_UNIQUE (unique_pk))
+	    {
+	      /* count the loaded keys as btree_insert counts inserted keys */
+	      if (unique_stat_info != NULL)
+		{
+		  *unique_stat_info += incr;
+		}
+	      else
+		{
+		  error_code = logtb_tran_update_unique_stats (thread_p, btid, incr, true);
+		  if (error_code != NO_ERROR)
+		    {
+		      ASSERT_ERROR ();
+		      return error_code;
+		    }
+		}
+	    }
+	}
+
+      for (locator_deferred_index::key_entry &entry : indexes[i].keys)
+	{
+	  OID oid = oids[entry.record];
+
+	  if (OID_ISNULL (&oid))
+	    {
+	      continue;
+	    }
+
+	  if (!is_loaded)
+	    {
+	      if (use_mvcc)
+		{
+		  btree_set_mvcc_header_ids_for_update (thread_p, false, true, &mvccid, mvcc_rec_header);
+		  p_mvcc_rec_header = mvcc_rec_header;
+		}
+
+	      if (index->index_status == OR_ONLINE_INDEX_BUILDING_IN_PROGRESS)
+		{
+		  /* Online index is currently loading. */
+		  error_code =
+		    btree_online_index_dispatcher (thread_p, &btid, &entry.key, class_oid, &oid, unique_pk,
+						   BTREE_OP_ONLINE_INDEX_TRAN_INSERT, NULL);
+		}
+	      else
+		{
+		  error_code =
+		    btree_insert (thread_p, &btid, &entry.key, class_oid, &oid, op_type, unique_stat_info, &unique_pk,
+				  p_mvcc_rec_header);
+		}
+	    }
+
+	  if (error_code == NO_ERROR && index->type == BTREE_PRIMARY_KEY && !LOG_CHECK_LOG_APPLIER (thread_p)
+	      && log_does_allow_replication () == true)
+	    {
+	      error_code =
+		repl_log_insert (thread_p, class_oid, &oid, LOG_REPLICATION_DATA, RVREPL_DATA_INSERT, &entry.key,
+				 REPL_INFO_TYPE_RBR_NORMAL);
+	    }
+	  if (error_code != NO_ERROR)
+	    {
+	      /* a unique violation here comes from a record inserted since the batch was checked */
+	      ASSERT_ERROR ();
+	      return error_code;
+	    }
+	}
+    }
+
+  return NO_ERROR;
+}
+
 int
 locator_multi_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oid,
 			    const std::vector<record_descriptor> &recdes, int has_index, int op_type,
 			    HEAP_SCANCACHE * scan_cache, int *force_count, int pruning_type, PRUNING_CONTEXT * pcontext,
-			    FUNC_PRED_UNPACK_INFO * func_preds, UPDATE_INPLACE_STYLE force_in_place, bool dont_check_fk)
+			    FUNC_PRED_UNPACK_INFO * func_preds, UPDATE_INPLACE_STYLE force_in_place, bool dont_check_fk,
+			    bool defer_index, std::vector<locator_unique_violation> *unique_violations)
 {
   int error_code = NO_ERROR;
   size_t accumulated_records_size = 0;
   size_t heap_max_page_size;
-  OID dummy_oid;
+  OID inserted_oid;
   std::vector<RECDES> recdes_array;
+  std::vector<size_t> recdes_array_positions;
   std::vector<VPID> heap_pages_array;
   RECDES local_record;
   bool has_BU_lock = lock_has_lock_on_object (class_oid, oid_Root_class_oid, BU_LOCK);
   size_t record_overhead = spage_slot_size ();
+  int record_has_index = has_index;
+  HEAP_CACHE_ATTRINFO index_attrinfo;
+  HEAP_IDX_ELEMENTS_INFO idx_info;
+  bool is_index_attrinfo_started = false;
+  std::vector<locator_deferred_index> deferred_indexes;
+  std::vector<bool> is_rejected;
+  std::vector<OID> inserted_oids;
 
   // Early-out
   if (recdes.size () == 0)
@@ -13734,11 +14193,62 @@ locator_multi_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oi
 
   *force_count = 0;
 
+  // Index keys can be inserted after the heap records only if nothing else needs them per record: foreign keys are
+  // not checked and all records go to the same class.
+  if (defer_index && has_index && dont_check_fk && pruning_type == DB_NOT_PARTITIONED_CLASS)
+    {
+      int num_found;
+
+      assert (unique_violations != NULL);
+
+      num_found = heap_attrinfo_start_with_index (thread_p, class_oid, NULL, &index_attrinfo, &idx_info);
+      if (num_found < 0)
+	{
+	  ASSERT_ERROR_AND_SET (error_code);
+	  return error_code;
+	}
+      is_index_attrinfo_started = true;
+
+      if (num_found > 0)
+	{
+	  record_has_index = false;
+	  is_rejected.assign (recdes.size (), false);
+	  inserted_oids.assign (recdes.size (), oid_Null_oid);
+
+	  // Records that would violate a unique index are left out and reported instead of failing the batch.
+	  error_code = locator_generate_deferred_index_keys (thread_p, class_oid, recdes, &index_attrinfo, &idx_info,
+							     func_preds, deferred_indexes);
+	  if (error_code == NO_ERROR)
+	    {
+	      error_code = locator_reject_unique_violations (thread_p, class_oid, &index_attrinfo, deferred_indexes,
+							     is_rejected, *unique_violations);
+	    }
+	  if (error_code != NO_ERROR)
+	    {
+	      ASSERT_ERROR ();
+	      goto end;
+	    }
+	}
+      else
+	{
+	  defer_index = false;
+	}
+    }
+  else
+    {
+      defer_index = false;
+    }
+
   // Take into account the unfill factor of the heap file.
   heap_max_page_size = heap_nonheader_page_capacity () * (1.0f - prm_get_float_value (PRM_ID_HF_UNFILL_FACTOR));
 
   for (size_t i = 0; i < recdes.size (); i++)
     {
+      if (defer_index && is_rejected[i])
+	{
+	  continue;
+	}
+
       local_record = recdes[i].get_recdes ();
       // Loop until we insert all records.
 
@@ -13746,13 +14256,18 @@ locator_multi_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oi
 	{
 	  scan_cache->cache_last_fix_page = false;
 	  // We insert other records normally.
-	  error_code = locator_insert_force (thread_p, hfid, class_oid, &dummy_oid, &local_record, has_index,
+	  error_code = locator_insert_force (thread_p, hfid, class_oid, &inserted_oid, &local_record, record_has_index,
 					     op_type, scan_cache, force_count, pruning_type, pcontext, func_preds,
 					     force_in_place, NULL, has_BU_lock, dont_check_fk, false);
 	  if (error_code != NO_ERROR)
 	    {
 	      ASSERT_ERROR ();
-	      return error_code;
+	      goto end;
+	    }
+
+	  if (defer_index)
+	    {
+	      inserted_oids[i] = inserted_oid;
 	    }
 	}
       else
@@ -13772,14 +14287,14 @@ locator_multi_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oi
 	      if (error_code != NO_ERROR)
 		{
 		  ASSERT_ERROR ();
-		  return error_code;
+		  goto end;
 		}
 
 	      for (size_t j = 0; j < recdes_array.size (); j++)
 		{
-		  error_code = locator_insert_force (thread_p, hfid, class_oid, &dummy_oid, &recdes_array[j], has_index,
-						     op_type, scan_cache, force_count, pruning_type, pcontext,
-						     func_preds, force_in_place, &home_hint_p, has_BU_lock,
+		  error_code = locator_insert_force (thread_p, hfid, class_oid, &inserted_oid, &recdes_array[j],
+						     record_has_index, op_type, scan_cache, force_count, pruning_type,
+						     pcontext, func_preds, force_in_place, &home_hint_p, has_BU_lock,
 						     dont_check_fk, true);
 		  if (error_code != NO_ERROR)
 		    {
@@ -13798,10 +14313,15 @@ locator_multi_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oi
 
 		      assert (!pgbuf_is_page_fixed_by_thread (thread_p, &new_page_vpid));
 
-		      return error_code;
+		      goto end;
 		    }
 
 		  pgbuf_replace_watcher (thread_p, &scan_cache->page_watcher, &home_hint_p);
+
+		  if (defer_index)
+		    {
+		      inserted_oids[recdes_array_positions[j]] = inserted_oid;
+		    }
 		}
 
 	      // Now log the whole page.
@@ -13813,6 +14333,7 @@ locator_multi_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oi
 
 	      // Clear the recdes array.
 	      recdes_array.clear ();
+	      recdes_array_positions.clear ();
 	      accumulated_records_size = 0;
 
 	      // Unfix the page.
@@ -13823,6 +14344,7 @@ locator_multi_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oi
 
 	  // Add this record to the recdes array and increase the accumulated size.
 	  recdes_array.push_back (local_record);
+	  recdes_array_positions.push_back (i);
 	  accumulated_records_size += DB_ALIGN (local_record.length, HEAP_MAX_ALIGN);
 	  accumulated_records_size += record_overhead;	// Add the slot overhead for the record.
 	}
@@ -13832,20 +14354,43 @@ locator_multi_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oi
   for (size_t i = 0; i < recdes_array.size (); i++)
     {
       scan_cache->cache_last_fix_page = false;
-      error_code = locator_insert_force (thread_p, hfid, class_oid, &dummy_oid, &recdes_array[i], has_index, op_type,
-					 scan_cache, force_count, pruning_type, pcontext, func_preds, force_in_place,
-					 NULL, has_BU_lock, dont_check_fk, false);
+      error_code = locator_insert_force (thread_p, hfid, class_oid, &inserted_oid, &recdes_array[i],
+					 record_has_index, op_type, scan_cache, force_count, pruning_type, pcontext,
+					 func_preds, force_in_place, NULL, has_BU_lock, dont_check_fk, false);
       if (error_code != NO_ERROR)
 	{
 	  ASSERT_ERROR ();
-	  return error_code;
+	  goto end;
+	}
+
+      if (defer_index)
+	{
+	  inserted_oids[recdes_array_positions[i]] = inserted_oid;
+	}
+    }
+
+  if (defer_index)
+    {
+      error_code = locator_insert_deferred_index_keys (thread_p, class_oid, &index_attrinfo, deferred_indexes,
+						       inserted_oids, op_type, scan_cache, has_BU_lock);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  goto end;
 	}
     }
 
   // Log the postpone operation
   heap_log_postpone_heap_append_pages (thread_p, hfid, class_oid, heap_pages_array);
 
-  return NO_ERROR;
+end:
+  locator_clear_deferred_indexes (deferred_indexes);
+  if (is_index_attrinfo_started)
+    {
+      heap_attrinfo_end (thread_p, &index_attrinfo);
+    }
+
+  return error_code;
 }
 
 bool
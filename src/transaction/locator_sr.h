@@ -44,6 +44,8 @@
 #include "storage_common.h"
 #include "thread_compat.hpp"
 
+#include <string>
+
 // forward definitions
 // *INDENT-OFF*
 namespace cubquery
@@ -134,11 +136,21 @@ extern int locator_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * cla
 				 bool dont_check_fk, bool use_bulk_logging = false);
 
  // *INDENT-OFF*
+// A record given to locator_multi_insert_force with defer_index that was not inserted, because its key of a unique
+// index is already used by an object of the class or by an earlier record of the batch.
+struct locator_unique_violation
+{
+  size_t record_index;		// position of the record in the batch
+  std::string index_name;
+  std::string key;
+};
+
 extern int locator_multi_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oid,
 				       const std::vector<record_descriptor> &recdes, int has_index, int op_type,
 				       HEAP_SCANCACHE * scan_cache, int *force_count, int pruning_type,
 				       PRUNING_CONTEXT * pcontext, FUNC_PRED_UNPACK_INFO * func_preds,
-				       UPDATE_INPLACE_STYLE force_in_place, bool dont_check_fk);
+				       UPDATE_INPLACE_STYLE force_in_place, bool dont_check_fk, bool defer_index,
+				       std::vector<locator_unique_violation> *unique_violations);
 extern bool has_errors_filtered_for_insert (std::vector<int> error_filter_array);
 // *INDENT-ON*
 
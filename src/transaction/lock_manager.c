@@ -307,6 +307,26 @@ struct lk_res_block
   int count;			/* # of entries in lock res block */
 };
 
+/*
+ * Fast path intention locks
+ *
+ * IS and IX locks on classes are compatible with each other, so a transaction can record them in its own slots
+ * instead of the holder list of the class resource. A request that conflicts with IS or IX (S, SIX, X, SCH-M, ...)
+ * marks the partition of the class as strong and moves the fast path locks of the class to the lock table before it
+ * is processed; while a partition is strong, intention locks on its classes take the regular way.
+ */
+#define LK_FAST_PATH_LOCK_COUNT 16
+#define LK_FAST_PATH_PARTITION_COUNT 1024
+
+typedef struct lk_fast_path_lock LK_FAST_PATH_LOCK;
+struct lk_fast_path_lock
+{
+  OID oid;			/* class or root class */
+  LOCK granted_mode;		/* IS_LOCK or IX_LOCK; NULL_LOCK if the slot is free */
+  int count;			/* number of lock requests */
+  int ngranules;		/* number of instance locks requested under the fast path lock */
+};
+
 /*
  * Transaction Lock Entry Structure
  */
@@ -335,6 +355,12 @@ struct lk_tran_lock
 
   /* locking on manual duration */
   bool is_instant_duration;
+
+  /* fast path intention locks */
+  pthread_mutex_t fast_path_mutex;	/* mutex for fast path locks */
+  LK_FAST_PATH_LOCK fast_path_locks[LK_FAST_PATH_LOCK_COUNT];
+  volatile int fast_path_lock_count;	/* # of used fast path locks */
+  unsigned char fast_path_strong_partitions[LK_FAST_PATH_PARTITION_COUNT / 8];	/* partitions made strong */
 };
 /* Max size of transaction local pool of lock entries. */
 #define LOCK_TRAN_LOCAL_POOL_MAX_SIZE 10
@@ -379,6 +405,10 @@ struct lk_global_data
   bool dump_level;
 #endif				/* LK_DUMP */
 
+  /* fast path intention locks */
+  bool fast_path_enabled;
+  volatile int fast_path_strong_count[LK_FAST_PATH_PARTITION_COUNT];	/* # of transactions with strong requests */
+
   // *INDENT-OFF*
   lk_global_data ()
     : max_obj_locks (0)
@@ -399,6 +429,8 @@ struct lk_global_data
 #if defined(LK_DUMP)
     , dump_level (0)
 #endif
+    , fast_path_enabled (false)
+    , fast_path_strong_count ()
   {
   }
   // *INDENT-ON*
@@ -535,6 +567,18 @@ static void lock_increment_class_granules (LK_ENTRY * class_entry);
 
 static void lock_decrement_class_granules (LK_ENTRY * class_entry);
 static LK_ENTRY *lock_find_class_entry (int tran_index, const OID * class_oid);
+static bool lock_fast_path_is_strong (LOCK lock);
+static bool lock_fast_path_lock (THREAD_ENTRY * thread_p, int tran_index, const OID * class_oid, LOCK lock);
+static bool lock_fast_path_unlock (int tran_index, const OID * class_oid, bool release_flag);
+static void lock_fast_path_unlock_all (int tran_index);
+static int lock_fast_path_add_granule (THREAD_ENTRY * thread_p, int tran_index, const OID * class_oid,
+				       bool * is_moved);
+static LOCK lock_fast_path_get_lock (int tran_index, const OID * class_oid);
+static int lock_fast_path_transfer (THREAD_ENTRY * thread_p, int tran_index, const OID * class_oid);
+static int lock_fast_path_transfer_tran (THREAD_ENTRY * thread_p, int tran_index, const OID * class_oid);
+static int lock_fast_path_move_to_lock_table (THREAD_ENTRY * thread_p, int tran_index, LK_FAST_PATH_LOCK * fast_lock);
+static void lock_fast_path_link_granules (LK_ENTRY * class_entry, int tran_index);
+static void lock_fast_path_dump (FILE * outfp);
 
 static void lock_event_log_tran_locks (THREAD_ENTRY * thread_p, FILE * log_fp, int tran_index);
 static void lock_event_log_blocked_lock (THREAD_ENTRY * thread_p, FILE * log_fp, LK_ENTRY * entry);
@@ -1065,6 +1109,12 @@ lock_initialize_tran_lock_table (void)
       tran_lock = &lk_Gl.tran_lock_table[i];
       pthread_mutex_init (&tran_lock->hold_mutex, NULL);
       pthread_mutex_init (&tran_lock->non2pl_mutex, NULL);
+      pthread_mutex_init (&tran_lock->fast_path_mutex, NULL);
+      for (j = 0; j < LK_FAST_PATH_LOCK_COUNT; j++)
+	{
+	  OID_SET_NULL (&tran_lock->fast_path_locks[j].oid);
+	  tran_lock->fast_path_locks[j].granted_mode = NULL_LOCK;
+	}
 
       for (j = 0; j < LOCK_TRAN_LOCAL_POOL_MAX_SIZE; j++)
 	{
@@ -1599,6 +1649,580 @@ lock_find_class_entry (int tran_index, const OID * class_oid)
 }
 #endif /* SERVER_MODE */
 
+/*
+ *  Private Functions Group: fast path intention locks
+ *   - lock_fast_path_lock()
+ *   - lock_fast_path_unlock()
+ *   - lock_fast_path_transfer()
+ */
+
+#if defined(SERVER_MODE)
+/*
+ * lock_fast_path_is_strong - Is the class lock incompatible with the fast path intention locks?
+ *
+ * return: true if the lock conflicts with IS_LOCK or IX_LOCK
+ *
+ *   lock(in): class lock mode
+ */
+static bool
+lock_fast_path_is_strong (LOCK lock)
+{
+  assert (lock >= NULL_LOCK);
+
+  /* everything that conflicts with IS_LOCK also conflicts with IX_LOCK */
+  return lock_Comp[lock][IX_LOCK] != LOCK_COMPAT_YES;
+}
+
+/*
+ * lock_fast_path_lock - Acquire an intention lock on a class without the lock table
+ *
+ * return: true if the lock is granted on the fast path, false if it must be requested in the lock table
+ *
+ *   tran_index(in):
+ *   class_oid(in): class or root class
+ *   lock(in): requested lock mode
+ *
+ * Note: The lock is granted on the fast path if it is IS_LOCK or IX_LOCK, no strong request was made on the
+ *     partition of the class and the transaction does not hold the class lock in the lock table.
+ */
+static bool
+lock_fast_path_lock (THREAD_ENTRY * thread_p, int tran_index, const OID * class_oid, LOCK lock)
+{
+  LK_TRAN_LOCK *tran_lock;
+  LK_FAST_PATH_LOCK *fast_lock, *free_lock = NULL;
+  int partition;
+  int i;
+
+  if (!lk_Gl.fast_path_enabled || (lock != IS_LOCK && lock != IX_LOCK))
+    {
+      return false;
+    }
+
+  tran_lock = &lk_Gl.tran_lock_table[tran_index];
+  if (tran_lock->is_instant_duration)
+    {
+      /* instant locks are counted on lock entries */
+      return false;
+    }
+
+  pthread_mutex_lock (&tran_lock->fast_path_mutex);
+
+  for (i = 0; i < LK_FAST_PATH_LOCK_COUNT; i++)
+    {
+      fast_lock = &tran_lock->fast_path_locks[i];
+      if (fast_lock->granted_mode == NULL_LOCK)
+	{
+	  if (free_lock == NULL)
+	    {
+	      free_lock = fast_lock;
+	    }
+	}
+      else if (OID_EQ (&fast_lock->oid, class_oid))
+	{
+	  fast_lock->granted_mode = lock_Conv[lock][fast_lock->granted_mode];
+	  assert (fast_lock->granted_mode == IS_LOCK || fast_lock->granted_mode == IX_LOCK);
+	  fast_lock->count++;
+	  pthread_mutex_unlock (&tran_lock->fast_path_mutex);
+
+	  perfmon_inc_stat (thread_p, PSTAT_LK_NUM_RE_REQUESTED_ON_OBJECTS);
+	  return true;
+	}
+    }
+
+  if (free_lock == NULL || lock_find_class_entry (tran_index, class_oid) != NULL)
+    {
+      /* no room, or the lock is converted in the lock table */
+      pthread_mutex_unlock (&tran_lock->fast_path_mutex);
+      return false;
+    }
+
+  /* A strong requester increments the partition counter and then checks fast_path_lock_count. Doing it the other way
+   * around here makes sure that either the requester sees this lock or this lock is not granted. */
+  (void) ATOMIC_INC (&tran_lock->fast_path_lock_count, 1);
+  partition = lock_get_hash_value (class_oid, LK_FAST_PATH_PARTITION_COUNT);
+  if (ATOMIC_LOAD (&lk_Gl.fast_path_strong_count[partition]) != 0)
+    {
+      (void) ATOMIC_INC (&tran_lock->fast_path_lock_count, -1);
+      pthread_mutex_unlock (&tran_lock->fast_path_mutex);
+      return false;
+    }
+
+  COPY_OID (&free_lock->oid, class_oid);
+  free_lock->granted_mode = lock;
+  free_lock->count = 1;
+  free_lock->ngranules = 0;
+  pthread_mutex_unlock (&tran_lock->fast_path_mutex);
+
+  perfmon_inc_stat (thread_p, PSTAT_LK_NUM_ACQUIRED_ON_OBJECTS);
+  return true;
+}
+
+/*
+ * lock_fast_path_unlock - Release an intention lock held on the fast path
+ *
+ * return: true if the transaction held the lock on the fast path
+ *
+ *   tran_index(in):
+ *   class_oid(in): class or root class
+ *   release_flag(in): release the lock regardless of the request count
+ */
+static bool
+lock_fast_path_unlock (int tran_index, const OID * class_oid, bool release_flag)
+{
+  LK_TRAN_LOCK *tran_lock = &lk_Gl.tran_lock_table[tran_index];
+  LK_FAST_PATH_LOCK *fast_lock;
+  int i;
+
+  /* only the transaction adds fast path locks */
+  if (ATOMIC_LOAD (&tran_lock->fast_path_lock_count) == 0)
+    {
+      return false;
+    }
+
+  pthread_mutex_lock (&tran_lock->fast_path_mutex);
+  for (i = 0; i < LK_FAST_PATH_LOCK_COUNT; i++)
+    {
+      fast_lock = &tran_lock->fast_path_locks[i];
+      if (fast_lock->granted_mode != NULL_LOCK && OID_EQ (&fast_lock->oid, class_oid))
+	{
+	  fast_lock->count--;
+	  if (release_flag || fast_lock->count <= 0)
+	    {
+	      OID_SET_NULL (&fast_lock->oid);
+	      fast_lock->granted_mode = NULL_LOCK;
+	      fast_lock->count = 0;
+	      fast_lock->ngranules = 0;
+	      (void) ATOMIC_INC (&tran_lock->fast_path_lock_count, -1);
+	    }
+	  pthread_mutex_unlock (&tran_lock->fast_path_mutex);
+	  return true;
+	}
+    }
+  pthread_mutex_unlock (&tran_lock->fast_path_mutex);
+
+  return false;
+}
+
+/*
+ * lock_fast_path_unlock_all - Release all fast path locks of the transaction and its strong partitions
+ *
+ * return: nothing
+ *
+ *   tran_index(in):
+ */
+static void
+lock_fast_path_unlock_all (int tran_index)
+{
+  LK_TRAN_LOCK *tran_lock = &lk_Gl.tran_lock_table[tran_index];
+  int i, partition;
+
+  pthread_mutex_lock (&tran_lock->fast_path_mutex);
+
+  for (i = 0; i < LK_FAST_PATH_LOCK_COUNT; i++)
+    {
+      OID_SET_NULL (&tran_lock->fast_path_locks[i].oid);
+      tran_lock->fast_path_locks[i].granted_mode = NULL_LOCK;
+      tran_lock->fast_path_locks[i].count = 0;
+      tran_lock->fast_path_locks[i].ngranules = 0;
+    }
+  ATOMIC_STORE (&tran_lock->fast_path_lock_count, 0);
+
+  /* the strong locks of the transaction are released now */
+  for (i = 0; i < LK_FAST_PATH_PARTITION_COUNT / 8; i++)
+    {
+      if (tran_lock->fast_path_strong_partitions[i] == 0)
+	{
+	  continue;
+	}
+      for (partition = i * 8; partition < (i + 1) * 8; partition++)
+	{
+	  if (tran_lock->fast_path_strong_partitions[i] & (1 << (partition % 8)))
+	    {
+	      (void) ATOMIC_INC (&lk_Gl.fast_path_strong_count[partition], -1);
+	      assert (lk_Gl.fast_path_strong_count[partition] >= 0);
+	    }
+	}
+      tran_lock->fast_path_strong_partitions[i] = 0;
+    }
+
+  pthread_mutex_unlock (&tran_lock->fast_path_mutex);
+}
+
+/*
+ * lock_fast_path_add_granule - Count an instance lock requested under the fast path lock of its class
+ *
+ * return: error code
+ *
+ *   tran_index(in):
+ *   class_oid(in): class of the instance
+ *   is_moved(out): true if the class lock was moved to the lock table
+ *
+ * Note: The instance locks of a class locked on the fast path have no class entry. When they reach the lock escalation
+ *     threshold, the class lock is moved to the lock table with its request count, and the instance locks become the
+ *     granules of its class entry; the next instance lock request is escalated as if the class had never been on the
+ *     fast path.
+ */
+static int
+lock_fast_path_add_granule (THREAD_ENTRY * thread_p, int tran_index, const OID * class_oid, bool * is_moved)
+{
+  LK_TRAN_LOCK *tran_lock = &lk_Gl.tran_lock_table[tran_index];
+  LK_FAST_PATH_LOCK *fast_lock;
+  int i;
+  int error_code = NO_ERROR;
+
+  *is_moved = false;
+
+  if (ATOMIC_LOAD (&tran_lock->fast_path_lock_count) == 0)
+    {
+      return NO_ERROR;
+    }
+
+  pthread_mutex_lock (&tran_lock->fast_path_mutex);
+  for (i = 0; i < LK_FAST_PATH_LOCK_COUNT; i++)
+    {
+      fast_lock = &tran_lock->fast_path_locks[i];
+      if (fast_lock->granted_mode == NULL_LOCK || !OID_EQ (&fast_lock->oid, class_oid))
+	{
+	  continue;
+	}
+
+      fast_lock->ngranules++;
+      if (fast_lock->ngranules >= prm_get_integer_value (PRM_ID_LK_ESCALATION_AT))
+	{
+	  error_code = lock_fast_path_move_to_lock_table (thread_p, tran_index, fast_lock);
+	  if (error_code == NO_ERROR)
+	    {
+	      OID_SET_NULL (&fast_lock->oid);
+	      fast_lock->granted_mode = NULL_LOCK;
+	      fast_lock->count = 0;
+	      fast_lock->ngranules = 0;
+	      (void) ATOMIC_INC (&tran_lock->fast_path_lock_count, -1);
+	      *is_moved = true;
+	    }
+	}
+      break;
+    }
+  pthread_mutex_unlock (&tran_lock->fast_path_mutex);
+
+  return error_code;
+}
+
+/*
+ * lock_fast_path_get_lock - Get the intention lock that the transaction holds on the fast path
+ *
+ * return: IS_LOCK, IX_LOCK or NULL_LOCK
+ *
+ *   tran_index(in):
+ *   class_oid(in): class or root class
+ */
+static LOCK
+lock_fast_path_get_lock (int tran_index, const OID * class_oid)
+{
+  LK_TRAN_LOCK *tran_lock = &lk_Gl.tran_lock_table[tran_index];
+  LOCK lock = NULL_LOCK;
+  int i;
+
+  if (ATOMIC_LOAD (&tran_lock->fast_path_lock_count) == 0)
+    {
+      return NULL_LOCK;
+    }
+
+  pthread_mutex_lock (&tran_lock->fast_path_mutex);
+  for (i = 0; i < LK_FAST_PATH_LOCK_COUNT; i++)
+    {
+      if (tran_lock->fast_path_locks[i].granted_mode != NULL_LOCK
+	  && OID_EQ (&tran_lock->fast_path_locks[i].oid, class_oid))
+	{
+	  lock = tran_lock->fast_path_locks[i].granted_mode;
+	  break;
+	}
+    }
+  pthread_mutex_unlock (&tran_lock->fast_path_mutex);
+
+  return lock;
+}
+
+/*
+ * lock_fast_path_transfer - Prepare a strong class lock request
+ *
+ * return: error code
+ *
+ *   tran_index(in): transaction of the strong request
+ *   class_oid(in): class or root class
+ *
+ * Note: The partition of the class stays strong until the transaction ends, so that no new fast path lock is granted
+ *     on the class. The fast path locks already granted on the class, by any transaction, are moved to the lock table;
+ *     the strong request then waits for them, and the deadlock detection sees them, like for any other holder.
+ */
+static int
+lock_fast_path_transfer (THREAD_ENTRY * thread_p, int tran_index, const OID * class_oid)
+{
+  LK_TRAN_LOCK *tran_lock = &lk_Gl.tran_lock_table[tran_index];
+  int partition;
+  int i;
+  int error_code;
+
+  if (!lk_Gl.fast_path_enabled)
+    {
+      return NO_ERROR;
+    }
+
+  partition = lock_get_hash_value (class_oid, LK_FAST_PATH_PARTITION_COUNT);
+
+  pthread_mutex_lock (&tran_lock->fast_path_mutex);
+  if ((tran_lock->fast_path_strong_partitions[partition / 8] & (1 << (partition % 8))) == 0)
+    {
+      tran_lock->fast_path_strong_partitions[partition / 8] |= (1 << (partition % 8));
+      (void) ATOMIC_INC (&lk_Gl.fast_path_strong_count[partition], 1);
+    }
+  pthread_mutex_unlock (&tran_lock->fast_path_mutex);
+
+  for (i = 0; i < lk_Gl.num_trans; i++)
+    {
+      error_code = lock_fast_path_transfer_tran (thread_p, i, class_oid);
+      if (error_code != NO_ERROR)
+	{
+	  return error_code;
+	}
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * lock_fast_path_transfer_tran - Move fast path locks of a transaction to the lock table
+ *
+ * return: error code
+ *
+ *   tran_index(in): owner of the fast path locks
+ *   class_oid(in): class or root class; NULL to move all fast path locks
+ */
+static int
+lock_fast_path_transfer_tran (THREAD_ENTRY * thread_p, int tran_index, const OID * class_oid)
+{
+  LK_TRAN_LOCK *tran_lock = &lk_Gl.tran_lock_table[tran_index];
+  LK_FAST_PATH_LOCK *fast_lock;
+  int i;
+  int error_code = NO_ERROR;
+
+  if (ATOMIC_LOAD (&tran_lock->fast_path_lock_count) == 0)
+    {
+      return NO_ERROR;
+    }
+
+  pthread_mutex_lock (&tran_lock->fast_path_mutex);
+  for (i = 0; i < LK_FAST_PATH_LOCK_COUNT; i++)
+    {
+      fast_lock = &tran_lock->fast_path_locks[i];
+      if (fast_lock->granted_mode == NULL_LOCK || (class_oid != NULL && !OID_EQ (&fast_lock->oid, class_oid)))
+	{
+	  continue;
+	}
+
+      error_code = lock_fast_path_move_to_lock_table (thread_p, tran_index, fast_lock);
+      if (error_code != NO_ERROR)
+	{
+	  break;
+	}
+      OID_SET_NULL (&fast_lock->oid);
+      fast_lock->granted_mode = NULL_LOCK;
+      fast_lock->count = 0;
+      fast_lock->ngranules = 0;
+      (void) ATOMIC_INC (&tran_lock->fast_path_lock_count, -1);
+    }
+  pthread_mutex_unlock (&tran_lock->fast_path_mutex);
+
+  return error_code;
+}
+
+/*
+ * lock_fast_path_move_to_lock_table - Add a fast path lock to the holders of the class resource
+ *
+ * return: error code
+ *
+ *   tran_index(in): owner of the fast path lock
+ *   fast_lock(in): fast path lock
+ *
+ * Note: The caller holds the fast path mutex of the owner. The lock was granted when it was compatible with all the
+ *     other locks on the class, so it is added as a granted holder, with its request count. The locks taken under it
+ *     are then linked to the holder entry; see lock_fast_path_link_granules.
+ */
+static int
+lock_fast_path_move_to_lock_table (THREAD_ENTRY * thread_p, int tran_index, LK_FAST_PATH_LOCK * fast_lock)
+{
+  LF_TRAN_ENTRY *t_entry = thread_get_tran_entry (thread_p, THREAD_TS_OBJ_LOCK_ENT);
+  LK_RES_KEY search_key;
+  LK_RES *res_ptr;
+  LK_ENTRY *entry_ptr, *prev;
+  LOCK old_mode;
+
+  search_key = lock_create_search_key (&fast_lock->oid, NULL);
+  (void) lk_Gl.m_obj_hash_table.find_or_insert (thread_p, search_key, res_ptr);
+  if (res_ptr == NULL)
+    {
+      assert (false);
+      return ER_FAILED;
+    }
+
+  if (res_ptr->holder == NULL && res_ptr->waiter == NULL && res_ptr->non2pl == NULL)
+    {
+      lock_initialize_resource_as_allocated (res_ptr, NULL_LOCK);
+    }
+
+  prev = NULL;
+  for (entry_ptr = res_ptr->holder; entry_ptr != NULL; entry_ptr = entry_ptr->next)
+    {
+      if (entry_ptr->tran_index == tran_index)
+	{
+	  break;
+	}
+      prev = entry_ptr;
+    }
+
+  if (entry_ptr != NULL)
+    {
+      /* the transaction also holds the lock in the lock table */
+      old_mode = entry_ptr->granted_mode;
+      entry_ptr->granted_mode = lock_Conv[fast_lock->granted_mode][entry_ptr->granted_mode];
+      assert (entry_ptr->granted_mode != NA_LOCK);
+      entry_ptr->count += fast_lock->count;
+
+      if (entry_ptr->granted_mode != old_mode)
+	{
+	  /* the position of a holder depends on its granted mode (UPR) */
+	  if (prev == NULL)
+	    {
+	      res_ptr->holder = entry_ptr->next;
+	    }
+	  else
+	    {
+	      prev->next = entry_ptr->next;
+	    }
+	  lock_position_holder_entry (res_ptr, entry_ptr);
+	}
+    }
+  else
+    {
+      /* the entry comes from the pool of the current transaction; the owner frees it to its own pool */
+      entry_ptr = lock_get_new_entry (LOG_FIND_THREAD_TRAN_INDEX (thread_p), t_entry, &lk_Gl.obj_free_entry_list);
+      if (entry_ptr == NULL)
+	{
+	  pthread_mutex_unlock (&res_ptr->res_mutex);
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LK_ALLOC_RESOURCE, 1, "lock heap entry");
+	  return ER_LK_ALLOC_RESOURCE;
+	}
+
+      lock_initialize_entry_as_granted (entry_ptr, tran_index, res_ptr, fast_lock->granted_mode);
+      entry_ptr->count = fast_lock->count;
+
+      lock_position_holder_entry (res_ptr, entry_ptr);
+      lock_insert_into_tran_hold_list (entry_ptr, tran_index);
+    }
+
+  assert (res_ptr->total_holders_mode >= NULL_LOCK);
+  res_ptr->total_holders_mode = lock_Conv[fast_lock->granted_mode][res_ptr->total_holders_mode];
+  assert (res_ptr->total_holders_mode != NA_LOCK);
+
+  lock_fast_path_link_granules (entry_ptr, tran_index);
+
+  pthread_mutex_unlock (&res_ptr->res_mutex);
+
+  return NO_ERROR;
+}
+
+/*
+ * lock_fast_path_link_granules - Link the locks taken under a fast path lock to its entry in the lock table
+ *
+ * return: nothing
+ *
+ *   class_entry(in): entry of the class or root class lock moved from the fast path
+ *   tran_index(in): owner of the lock
+ *
+ * Note: The class locks taken under a fast path lock on the root class, and the instance locks taken under a fast
+ *     path lock on a class, have no class entry. They are linked to class_entry like the locks requested under a class
+ *     entry, so that the granules of the class are counted for lock escalation and released with the instances.
+ *     A moved class lock is linked to the root class lock of the owner if that one is in the lock table already.
+ *     The caller holds the resource mutex of class_entry.
+ */
+static void
+lock_fast_path_link_granules (LK_ENTRY * class_entry, int tran_index)
+{
+  LK_TRAN_LOCK *tran_lock = &lk_Gl.tran_lock_table[tran_index];
+  LK_ENTRY *entry_ptr;
+
+  pthread_mutex_lock (&tran_lock->hold_mutex);
+
+  if (class_entry->res_head->key.type == LOCK_RESOURCE_ROOT_CLASS)
+    {
+      for (entry_ptr = tran_lock->class_hold_list; entry_ptr != NULL; entry_ptr = entry_ptr->tran_next)
+	{
+	  if (entry_ptr->class_entry == NULL)
+	    {
+	      entry_ptr->class_entry = class_entry;
+	    }
+	}
+    }
+  else
+    {
+      if (class_entry->class_entry == NULL)
+	{
+	  class_entry->class_entry = tran_lock->root_class_hold;
+	}
+
+      for (entry_ptr = tran_lock->inst_hold_list; entry_ptr != NULL; entry_ptr = entry_ptr->tran_next)
+	{
+	  if (entry_ptr->class_entry == NULL
+	      && OID_EQ (&entry_ptr->res_head->key.class_oid, &class_entry->res_head->key.oid))
+	    {
+	      entry_ptr->class_entry = class_entry;
+	      lock_increment_class_granules (class_entry);
+	    }
+	}
+    }
+
+  pthread_mutex_unlock (&tran_lock->hold_mutex);
+}
+
+/*
+ * lock_fast_path_dump - Dump the fast path intention locks
+ *
+ * return: nothing
+ *
+ *   outfp(in): FILE stream where to dump the fast path locks
+ */
+static void
+lock_fast_path_dump (FILE * outfp)
+{
+  LK_TRAN_LOCK *tran_lock;
+  LK_FAST_PATH_LOCK *fast_lock;
+  int tran_index, i;
+
+  fprintf (outfp, "Fast Path Intention Locks:\n");
+  for (tran_index = 0; tran_index < lk_Gl.num_trans; tran_index++)
+    {
+      tran_lock = &lk_Gl.tran_lock_table[tran_index];
+      if (ATOMIC_LOAD (&tran_lock->fast_path_lock_count) == 0)
+	{
+	  continue;
+	}
+
+      pthread_mutex_lock (&tran_lock->fast_path_mutex);
+      for (i = 0; i < LK_FAST_PATH_LOCK_COUNT; i++)
+	{
+	  fast_lock = &tran_lock->fast_path_locks[i];
+	  if (fast_lock->granted_mode != NULL_LOCK)
+	    {
+	      fprintf (outfp, "\tTran_index = %3d, OID = %d|%d|%d, Granted_mode = %s, Count = %d\n", tran_index,
+		       fast_lock->oid.volid, fast_lock->oid.pageid, fast_lock->oid.slotid,
+		       LOCK_TO_LOCKMODE_STRING (fast_lock->granted_mode), fast_lock->count);
+	    }
+	}
+      pthread_mutex_unlock (&tran_lock->fast_path_mutex);
+    }
+  fprintf (outfp, "\n");
+}
+#endif /* SERVER_MODE */
+
 #if defined(SERVER_MODE)
 /*
  * lock_add_non2pl_lock - Add a release lock which has never been acquired
@@ -2901,6 +3525,12 @@ lock_check_escalate (THREAD_ENTRY * thread_p, LK_ENTRY * class_entry, LK_TRAN_LO
 {
   LK_ENTRY *superclass_entry = NULL;
 
+  /* It cannot do lock escalation if class_entry is NULL */
+  if (class_entry == NULL)
+    {
+      return false;
+    }
+
   if (class_entry->granted_mode == BU_LOCK)
     {
       // disallow lock escalation for bulk updates
@@ -2914,12 +3544,6 @@ lock_check_escalate (THREAD_ENTRY * thread_p, LK_ENTRY * class_entry, LK_TRAN_LO
       return false;
     }
 
-  /* It cannot do lock escalation if class_entry is NULL */
-  if (class_entry == NULL)
-    {
-      return false;
-    }
-
   superclass_entry = class_entry->class_entry;
 
   /* check if the lock escalation is needed. */
@@ -3235,6 +3859,7 @@ lock_internal_perform_lock_object (THREAD_ENTRY * thread_p, int tran_index, cons
   TSC_TICKS start_tick, end_tick;
   TSCTIMEVAL tv_diff;
   UINT64 lock_wait_time;
+  bool is_perf_tracking;
 
 #if defined(ENABLE_SYSTEMTAP)
   const OID *class_oid_for_marker_p;
@@ -3327,6 +3952,22 @@ start:
   else
     {
       /* Class lock request. */
+      /* A strong lock waits for the fast path intention locks of all transactions; any other lock is merged with the
+       * fast path lock of this transaction. Both need the fast path locks in the lock table. */
+      if (lock_fast_path_is_strong (lock))
+	{
+	  ret_val = lock_fast_path_transfer (thread_p, tran_index, oid);
+	}
+      else
+	{
+	  ret_val = lock_fast_path_transfer_tran (thread_p, tran_index, oid);
+	}
+      if (ret_val != NO_ERROR)
+	{
+	  ret_val = LK_NOTGRANTED_DUE_ERROR;
+	  goto end;
+	}
+
       /* Try to find class lock entry if it already exists to avoid using the expensive resource mutex. */
       entry_ptr = lock_find_class_entry (tran_index, oid);
       if (entry_ptr != NULL)
@@ -3816,7 +4457,8 @@ lock_tran_lk_entry:
 
 blocked:
 
-  if (perfmon_is_perf_tracking_and_active (PERFMON_ACTIVATION_FLAG_LOCK_OBJECT))
+  is_perf_tracking = perfmon_is_perf_tracking ();
+  if (is_perf_tracking)
     {
       tsc_getticks (&start_tick);
     }
@@ -3834,12 +4476,16 @@ blocked:
     }
   ret_val = lock_suspend (thread_p, entry_ptr, wait_msecs);
 
-  if (perfmon_is_perf_tracking_and_active (PERFMON_ACTIVATION_FLAG_LOCK_OBJECT))
+  if (is_perf_tracking)
     {
       tsc_getticks (&end_tick);
       tsc_elapsed_time_usec (&tv_diff, end_tick, start_tick);
       lock_wait_time = tv_diff.tv_sec * 1000000LL + tv_diff.tv_usec;
-      perfmon_lk_waited_time_on_objects (thread_p, lock, lock_wait_time);
+      perfmon_add_latency (PERFMON_LATENCY_LOCK_WAIT, lock_wait_time);
+      if (perfmon_is_perf_tracking_and_active (PERFMON_ACTIVATION_FLAG_LOCK_OBJECT))
+	{
+	  perfmon_lk_waited_time_on_objects (thread_p, lock, lock_wait_time);
+	}
     }
 
   if (ret_val != LOCK_RESUMED)
@@ -5628,6 +6274,9 @@ lock_initialize (void)
     }
 
   /* initialize some parameters */
+  lk_Gl.fast_path_enabled = prm_get_bool_value (PRM_ID_LK_FAST_PATH_INTENTION_LOCKS);
+  memset ((void *) lk_Gl.fast_path_strong_count, 0, sizeof (lk_Gl.fast_path_strong_count));
+
 #if defined(CUBRID_DEBUG)
   lk_Gl.verbose_mode = true;
   lk_Gl.no_victim_case_count = 0;
@@ -5820,6 +6469,7 @@ lock_finalize (void)
 	  tran_lock = &lk_Gl.tran_lock_table[i];
 	  pthread_mutex_destroy (&tran_lock->hold_mutex);
 	  pthread_mutex_destroy (&tran_lock->non2pl_mutex);
+	  pthread_mutex_destroy (&tran_lock->fast_path_mutex);
 	  while (tran_lock->lk_entry_pool != NULL)
 	    {
 	      LK_ENTRY *entry = tran_lock->lk_entry_pool;
@@ -5916,6 +6566,8 @@ lock_object (THREAD_ENTRY * thread_p, const OID * oid, const OID * class_oid, LO
   LK_ENTRY *root_class_entry = NULL;
   LK_ENTRY *class_entry = NULL, *superclass_entry = NULL;
   LK_ENTRY *inst_entry = NULL;
+  LOCK fast_class_lock;
+  bool is_moved;
 #if defined (EnableThreadMonitoring)
   TSC_TICKS start_tick, end_tick;
   TSCTIMEVAL elapsed_time;
@@ -6014,13 +6666,15 @@ lock_object (THREAD_ENTRY * thread_p, const OID * oid, const OID * class_oid, LO
     }
 
   /* Check if current transaction has already held the class lock. If the class lock is not held, hold the class lock,
-   * now. */
+   * now. The fast path lock is read first; if it is moved to the lock table meanwhile, the class entry is found. */
+  fast_class_lock = lock_fast_path_get_lock (tran_index, class_oid);
   class_entry = lock_get_class_lock (thread_p, class_oid);
-  old_class_lock = (class_entry) ? class_entry->granted_mode : NULL_LOCK;
+  old_class_lock = (class_entry) ? class_entry->granted_mode : fast_class_lock;
 
   if (OID_IS_ROOTOID (class_oid))
     {
-      if (old_class_lock < new_class_lock)
+      if (old_class_lock < new_class_lock
+	  && !lock_fast_path_lock (thread_p, tran_index, class_oid, new_class_lock))
 	{
 	  granted = lock_internal_perform_lock_object (thread_p, tran_index, class_oid, NULL, new_class_lock,
 						       wait_msecs, &root_class_entry, NULL);
@@ -6031,6 +6685,11 @@ lock_object (THREAD_ENTRY * thread_p, const OID * oid, const OID * class_oid, LO
 	}
       /* case 2 : resource type is LOCK_RESOURCE_CLASS */
       /* acquire a lock on the given class object */
+      if (lock_fast_path_lock (thread_p, tran_index, oid, lock))
+	{
+	  granted = LK_GRANTED;
+	  goto end;
+	}
 
       /* NOTE that in case of acquiring a lock on a class object, the higher lock granule of the class object must not
        * be given. */
@@ -6040,7 +6699,7 @@ lock_object (THREAD_ENTRY * thread_p, const OID * oid, const OID * class_oid, LO
     }
   else
     {
-      if (old_class_lock < new_class_lock)
+      if (old_class_lock < new_class_lock && !lock_fast_path_lock (thread_p, tran_index, class_oid, new_class_lock))
 	{
 	  if (class_entry != NULL && class_entry->class_entry != NULL
 	      && !OID_IS_ROOTOID (&class_entry->class_entry->res_head->key.oid))
@@ -6072,6 +6731,20 @@ lock_object (THREAD_ENTRY * thread_p, const OID * oid, const OID * class_oid, LO
 	}
       /* acquire a lock on the given instance oid */
 
+      if (class_entry == NULL)
+	{
+	  /* the class is locked on the fast path */
+	  if (lock_fast_path_add_granule (thread_p, tran_index, class_oid, &is_moved) != NO_ERROR)
+	    {
+	      granted = LK_NOTGRANTED_DUE_ERROR;
+	      goto end;
+	    }
+	  if (is_moved)
+	    {
+	      class_entry = lock_get_class_lock (thread_p, class_oid);
+	    }
+	}
+
       /* NOTE that in case of acquiring a lock on an instance object, the class oid of the instance object must be
        * given. */
       granted = lock_internal_perform_lock_object (thread_p, tran_index, oid, class_oid, lock, wait_msecs, &inst_entry,
@@ -6307,6 +6980,11 @@ lock_scan (THREAD_ENTRY * thread_p, const OID * class_oid, int cond_flag, LOCK c
   isolation = logtb_find_isolation (tran_index);
 
   /* acquire the lock on the class */
+  if (lock_fast_path_lock (thread_p, tran_index, class_oid, class_lock))
+    {
+      return LK_GRANTED;
+    }
+
   /* NOTE that in case of acquiring a lock on a class object, the higher lock granule of the class object is not given. */
   root_class_entry = lock_get_class_lock (thread_p, oid_Root_class_oid);
   granted = lock_internal_perform_lock_object (thread_p, tran_index, class_oid, NULL, class_lock, wait_msecs,
@@ -6562,6 +7240,11 @@ lock_unlock_object_lock_internal (THREAD_ENTRY * thread_p, const OID * oid, cons
 
   /* get transaction table index */
   tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
+  if (is_class && lock_fast_path_unlock (tran_index, oid, release_flag))
+    {
+      return;
+    }
+
   entry_ptr = lock_find_tran_hold_entry (thread_p, tran_index, oid, is_class);
 
   if (entry_ptr != NULL)
@@ -6645,7 +7328,14 @@ lock_unlock_object (THREAD_ENTRY * thread_p, const OID * oid, const OID * class_
       CUBRID_LOCK_RELEASE_START (oid, class_oid, lock);
 #endif /* ENABLE_SYSTEMTAP */
 
-      entry_ptr = lock_find_tran_hold_entry (thread_p, tran_index, oid, is_class);
+      if (is_class && lock_fast_path_unlock (tran_index, oid, false))
+	{
+	  entry_ptr = NULL;
+	}
+      else
+	{
+	  entry_ptr = lock_find_tran_hold_entry (thread_p, tran_index, oid, is_class);
+	}
 
       if (entry_ptr != NULL)
 	{
@@ -6878,6 +7568,9 @@ lock_unlock_all (THREAD_ENTRY * thread_p)
       lock_internal_perform_unlock_object (thread_p, entry_ptr, true, false);
     }
 
+  /* remove fast path locks; the strong class locks are released, so are their partitions */
+  lock_fast_path_unlock_all (tran_index);
+
   /* remove non2pl locks */
   while (tran_lock->non2pl_list != NULL)
     {
@@ -6998,10 +7691,11 @@ lock_get_object_lock (const OID * oid, const OID * class_oid)
   /* get the granted lock mode acquired on the root class oid */
   if (OID_EQ (oid, oid_Root_class_oid))
     {
+      lock_mode = lock_fast_path_get_lock (tran_index, oid);
       rv = pthread_mutex_lock (&tran_lock->hold_mutex);
       if (tran_lock->root_class_hold != NULL)
 	{
-	  lock_mode = tran_lock->root_class_hold->granted_mode;
+	  lock_mode = lock_Conv[lock_mode][tran_lock->root_class_hold->granted_mode];
 	}
       pthread_mutex_unlock (&tran_lock->hold_mutex);
       return lock_mode;		/* might be NULL_LOCK */
@@ -7013,18 +7707,20 @@ lock_get_object_lock (const OID * oid, const OID * class_oid)
   /* get the granted lock mode acquired on the given class oid */
   if (class_oid == NULL || OID_EQ (class_oid, oid_Root_class_oid))
     {
+      lock_mode = lock_fast_path_get_lock (tran_index, oid);
       entry_ptr = lock_find_tran_hold_entry (thread_p, tran_index, oid, true);
       if (entry_ptr != NULL)
 	{
-	  lock_mode = entry_ptr->granted_mode;
+	  lock_mode = lock_Conv[lock_mode][entry_ptr->granted_mode];
 	}
       return lock_mode;		/* might be NULL_LOCK */
     }
 
+  lock_mode = lock_fast_path_get_lock (tran_index, class_oid);
   entry_ptr = lock_find_tran_hold_entry (thread_p, tran_index, class_oid, true);
   if (entry_ptr != NULL)
     {
-      lock_mode = entry_ptr->granted_mode;
+      lock_mode = lock_Conv[lock_mode][entry_ptr->granted_mode];
     }
 
   /* If the class lock mode is one of S_LOCK, X_LOCK or SCH_M_LOCK, the lock is held on the instance implicitly. In
@@ -7121,10 +7817,11 @@ lock_has_lock_on_object (const OID * oid, const OID * class_oid, LOCK lock)
   /* get the granted lock mode acquired on the root class oid */
   if (OID_EQ (oid, oid_Root_class_oid))
     {
+      granted_lock_mode = lock_fast_path_get_lock (tran_index, oid);
       rv = pthread_mutex_lock (&tran_lock->hold_mutex);
       if (tran_lock->root_class_hold != NULL)
 	{
-	  granted_lock_mode = tran_lock->root_class_hold->granted_mode;
+	  granted_lock_mode = lock_Conv[granted_lock_mode][tran_lock->root_class_hold->granted_mode];
 	}
       pthread_mutex_unlock (&tran_lock->hold_mutex);
       return (lock_Conv[lock][granted_lock_mode] == granted_lock_mode);
@@ -7136,22 +7833,24 @@ lock_has_lock_on_object (const OID * oid, const OID * class_oid, LOCK lock)
   /* get the granted lock mode acquired on the given class oid */
   if (class_oid == NULL || OID_EQ (class_oid, oid_Root_class_oid))
     {
+      granted_lock_mode = lock_fast_path_get_lock (tran_index, oid);
       entry_ptr = lock_find_tran_hold_entry (thread_p, tran_index, oid, true);
       if (entry_ptr != NULL)
 	{
-	  granted_lock_mode = entry_ptr->granted_mode;
+	  granted_lock_mode = lock_Conv[granted_lock_mode][entry_ptr->granted_mode];
 	}
       return (lock_Conv[lock][granted_lock_mode] == granted_lock_mode);
     }
 
+  granted_lock_mode = lock_fast_path_get_lock (tran_index, class_oid);
   entry_ptr = lock_find_tran_hold_entry (thread_p, tran_index, class_oid, true);
   if (entry_ptr != NULL)
     {
-      granted_lock_mode = entry_ptr->granted_mode;
-      if (lock_Conv[lock][granted_lock_mode] == granted_lock_mode)
-	{
-	  return 1;
-	}
+      granted_lock_mode = lock_Conv[granted_lock_mode][entry_ptr->granted_mode];
+    }
+  if (granted_lock_mode != NULL_LOCK && lock_Conv[lock][granted_lock_mode] == granted_lock_mode)
+    {
+      return 1;
     }
 
   /*
@@ -7187,7 +7886,7 @@ lock_has_xlock (THREAD_ENTRY * thread_p)
   LK_TRAN_LOCK *tran_lock;
   LOCK lock_mode;
   LK_ENTRY *entry_ptr;
-  int rv;
+  int rv, i;
 
   /*
    * Exclusive locks in this context mean IX_LOCK, SIX_LOCK, X_LOCK and
@@ -7196,6 +7895,22 @@ lock_has_xlock (THREAD_ENTRY * thread_p)
    */
   tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
   tran_lock = &lk_Gl.tran_lock_table[tran_index];
+
+  /* 0. check fast path locks */
+  if (ATOMIC_LOAD (&tran_lock->fast_path_lock_count) > 0)
+    {
+      rv = pthread_mutex_lock (&tran_lock->fast_path_mutex);
+      for (i = 0; i < LK_FAST_PATH_LOCK_COUNT; i++)
+	{
+	  if (tran_lock->fast_path_locks[i].granted_mode == IX_LOCK)
+	    {
+	      pthread_mutex_unlock (&tran_lock->fast_path_mutex);
+	      return true;
+	    }
+	}
+      pthread_mutex_unlock (&tran_lock->fast_path_mutex);
+    }
+
   rv = pthread_mutex_lock (&tran_lock->hold_mutex);
 
   /* 1. check root class lock */
@@ -8302,6 +9017,12 @@ lock_unlock_all_shared_get_all_exclusive (THREAD_ENTRY * thread_p, LK_ACQUIRED_L
   /* some preparation */
   tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
 
+  /* the acquired locks are taken from the lock table */
+  if (lock_fast_path_transfer_tran (thread_p, tran_index, NULL) != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+    }
+
   /************************************/
   /* phase 1: unlock all shared locks */
   /************************************/
@@ -8517,6 +9238,8 @@ xlock_dump (THREAD_ENTRY * thread_p, FILE * outfp)
       lock_dump_resource (thread_p, outfp, res_ptr);
     }
 
+  lock_fast_path_dump (outfp);
+
   /* Reset the wait back to the way it was */
   (void) xlogtb_reset_wait_msecs (thread_p, old_wait_msecs);
 #endif /* !SERVER_MODE */
@@ -902,6 +902,8 @@ extern void logpb_set_tde_algorithm (THREAD_ENTRY * thread_p, LOG_PAGE * log_pgp
 
 
 extern void log_recovery (THREAD_ENTRY * thread_p, int ismedia_crash, time_t * stopat);
+extern void log_rv_redo_page_record (THREAD_ENTRY * thread_p, const VPID * rcv_vpid, LOG_RCVINDEX rcvindex,
+				     bool is_compensate, LOG_RCV * rcv, const LOG_LSA * rcv_lsa);
 extern LOG_LSA *log_startof_nxrec (THREAD_ENTRY * thread_p, LOG_LSA * lsa, bool canuse_forwaddr);
 
 extern void *logtb_realloc_topops_stack (LOG_TDES * tdes, int num_elms);
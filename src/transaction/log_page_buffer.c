@@ -125,6 +125,9 @@ static int rv;
 
 #define LOGPB_FIND_BUFPTR(bufid) &log_Pb.buffers[(bufid)]
 
+/* Maximum number of tde-encrypted log pages encrypted in one pass and written at once */
+#define LOGPB_TDE_ENCRYPT_NPAGES 32
+
 
 /* PAGES OF ACTIVE LOG PORTION */
 #define LOGPB_HEADER_PAGE_ID             (-9)	/* The first log page in the infinite log sequence. It is always kept
@@ -242,6 +245,8 @@ struct log_pb_global_data
   int num_buffers;		/* Number of log buffers */
 
   LOGPB_PARTIAL_APPEND partial_append;
+
+  char *tde_encrypt_area;	/* LOGPB_TDE_ENCRYPT_NPAGES encrypted pages to write. Flushes are serialized. */
 };
 
 typedef struct arv_page_info
@@ -293,6 +298,7 @@ static void logpb_dump_to_flush_page (FILE * out_fp);
 static void logpb_dump_pages (FILE * out_fp);
 static void logpb_initialize_backup_info (LOG_HEADER * loghdr);
 static LOG_PAGE **logpb_writev_append_pages (THREAD_ENTRY * thread_p, LOG_PAGE ** to_flush, DKNPAGES npages);
+static int logpb_tde_encrypt_run (LOG_PAGE ** to_flush, DKNPAGES npages);
 static int logpb_get_guess_archive_num (THREAD_ENTRY * thread_p, LOG_PAGEID pageid);
 static void logpb_set_unavailable_archive (THREAD_ENTRY * thread_p, int arv_num);
 static void logpb_dismount_log_archive (THREAD_ENTRY * thread_p);
@@ -694,6 +700,7 @@ logpb_finalize_pool (THREAD_ENTRY * thread_p)
   free_and_init (log_Pb.buffers);
   free_and_init (log_Pb.pages_area);
   free_and_init (log_Pb.header_page);
+  free_and_init (log_Pb.tde_encrypt_area);
   log_Pb.num_buffers = 0;
   logpb_Initialized = false;
   logpb_finalize_flush_info ();
@@ -2740,6 +2747,7 @@ logpb_next_append_page (THREAD_ENTRY * thread_p, LOG_SETDIRTY current_setdirty)
  *   npages(in): Number of pages to flush
  *
  * NOTE:Flush to disk a set of log contiguous pages.
+ *      Successive tde-encrypted pages are encrypted in one pass and written with a single call.
  */
 static LOG_PAGE **
 logpb_writev_append_pages (THREAD_ENTRY * thread_p, LOG_PAGE ** to_flush, DKNPAGES npages)
@@ -2747,6 +2755,7 @@ logpb_writev_append_pages (THREAD_ENTRY * thread_p, LOG_PAGE ** to_flush, DKNPAG
   LOG_BUFFER *bufptr;
   LOG_PHY_PAGEID phy_pageid;
   int i;
+  int nrun;
   FILEIO_WRITE_MODE write_mode = FILEIO_WRITE_DEFAULT_WRITE;
   char enc_pgbuf[IO_MAX_PAGE_SIZE + MAX_ALIGNMENT];
   LOG_PAGE *log_pgptr = NULL;
@@ -2775,14 +2784,28 @@ logpb_writev_append_pages (THREAD_ENTRY * thread_p, LOG_PAGE ** to_flush, DKNPAG
 	      return NULL;
 	    }
 	}
-      for (i = 0; i < npages; i++)
+      for (i = 0; i < npages; i += nrun)
 	{
 	  log_pgptr = to_flush[i];
+	  nrun = 1;
 
 	  logpb_log ("logpb_writev_append_pages: The page (%lld) is being tde-encrypted: %d\n",
 		     (long long int) log_pgptr->hdr.logical_pageid, LOG_IS_PAGE_TDE_ENCRYPTED (log_pgptr));
 	  if (LOG_IS_PAGE_TDE_ENCRYPTED (log_pgptr))
 	    {
+	      nrun = logpb_tde_encrypt_run (&to_flush[i], npages - i);
+	      if (nrun > 0)
+		{
+		  if (fileio_write_pages (thread_p, log_Gl.append.vdes, log_Pb.tde_encrypt_area, phy_pageid + i, nrun,
+					  LOG_PAGESIZE, write_mode) == NULL)
+		    {
+		      goto error;
+		    }
+		  continue;
+		}
+
+	      /* encrypt it alone */
+	      nrun = 1;
 	      if (tde_encrypt_log_page (log_pgptr, logpb_get_tde_algorithm (log_pgptr), enc_pgptr) != NO_ERROR)
 		{
 		  /* 
@@ -2801,23 +2824,72 @@ logpb_writev_append_pages (THREAD_ENTRY * thread_p, LOG_PAGE ** to_flush, DKNPAG
 
 	  if (fileio_write (thread_p, log_Gl.append.vdes, log_pgptr, phy_pageid + i, LOG_PAGESIZE, write_mode) == NULL)
 	    {
-	      if (er_errid () == ER_IO_WRITE_OUT_OF_SPACE)
-		{
-		  er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, ER_LOG_WRITE_OUT_OF_SPACE, 4, bufptr->pageid,
-			  phy_pageid, log_Name_active, log_Gl.hdr.db_logpagesize);
-		}
-	      else
-		{
-		  er_set_with_oserror (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, ER_LOG_WRITE, 3, bufptr->pageid,
-				       phy_pageid, log_Name_active);
-		}
-	      to_flush = NULL;
-	      break;
+	      goto error;
 	    }
 	}
     }
 
   return to_flush;
+
+error:
+  if (er_errid () == ER_IO_WRITE_OUT_OF_SPACE)
+    {
+      er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, ER_LOG_WRITE_OUT_OF_SPACE, 4, bufptr->pageid, phy_pageid,
+	      log_Name_active, log_Gl.hdr.db_logpagesize);
+    }
+  else
+    {
+      er_set_with_oserror (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, ER_LOG_WRITE, 3, bufptr->pageid, phy_pageid,
+			   log_Name_active);
+    }
+  return NULL;
+}
+
+/*
+ * logpb_tde_encrypt_run - Encrypt a run of tde-encrypted pages in one pass
+ *
+ * return: number of pages encrypted into log_Pb.tde_encrypt_area, 0 if they have to be encrypted one by one
+ *
+ *   to_flush(in): Pages to flush, the first one is tde-encrypted
+ *   npages(in): Number of pages in to_flush
+ *
+ * NOTE: The run ends at the first page with another algorithm, or at LOGPB_TDE_ENCRYPT_NPAGES pages.
+ */
+static int
+logpb_tde_encrypt_run (LOG_PAGE ** to_flush, DKNPAGES npages)
+{
+  TDE_ALGORITHM tde_algo;
+  int nrun;
+
+  assert (npages > 0 && LOG_IS_PAGE_TDE_ENCRYPTED (to_flush[0]));
+
+  if (log_Pb.tde_encrypt_area == NULL)
+    {
+      log_Pb.tde_encrypt_area = (char *) malloc ((size_t) LOGPB_TDE_ENCRYPT_NPAGES * LOG_PAGESIZE);
+      if (log_Pb.tde_encrypt_area == NULL)
+	{
+	  /* not an error, the pages are encrypted one by one */
+	  return 0;
+	}
+    }
+
+  tde_algo = logpb_get_tde_algorithm (to_flush[0]);
+  for (nrun = 1; nrun < npages && nrun < LOGPB_TDE_ENCRYPT_NPAGES; nrun++)
+    {
+      if (logpb_get_tde_algorithm (to_flush[nrun]) != tde_algo)
+	{
+	  break;
+	}
+    }
+
+  if (tde_encrypt_log_pages (to_flush, nrun, tde_algo, log_Pb.tde_encrypt_area) != NO_ERROR)
+    {
+      /* the pages are encrypted again one by one, and the ones that fail are written without encryption */
+      er_clear ();
+      return 0;
+    }
+
+  return nrun;
 }
 
 /*
@@ -37,6 +37,7 @@
 #include "log_lsa.hpp"
 #include "log_manager.h"
 #include "log_record.hpp"
+#include "log_recovery_redo_parallel.hpp"
 #include "log_system_tran.hpp"
 #include "log_volids.hpp"
 #include "recovery.h"
@@ -57,9 +58,19 @@
 static void log_rv_undo_record (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_page_p,
 				LOG_RCVINDEX rcvindex, const VPID * rcv_vpid, LOG_RCV * rcv,
 				const LOG_LSA * rcv_lsa_ptr, LOG_TDES * tdes, LOG_ZIP * undo_unzip_ptr);
+static void log_rv_redo_read_data (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_page_p, LOG_RCV * rcv,
+				   int undo_length, char *undo_data, LOG_ZIP * redo_unzip_ptr, char **area);
+static void log_rv_redo_apply (THREAD_ENTRY * thread_p, int (*redofun) (THREAD_ENTRY * thread_p, LOG_RCV *),
+			       LOG_RCV * rcv, const LOG_LSA * rcv_lsa_ptr);
 static void log_rv_redo_record (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_page_p,
 				int (*redofun) (THREAD_ENTRY * thread_p, LOG_RCV *), LOG_RCV * rcv,
 				LOG_LSA * rcv_lsa_ptr, int undo_length, char *undo_data, LOG_ZIP * redo_unzip_ptr);
+static void log_rv_redo_record_parallel (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_page_p,
+					 cublog::redo_parallel & redo_parallel, const VPID * rcv_vpid,
+					 LOG_RCVINDEX rcvindex, bool is_compensate, LOG_RCV * rcv,
+					 const LOG_LSA * rcv_lsa_ptr, int undo_length, char *undo_data,
+					 LOG_ZIP * redo_unzip_ptr);
+static bool log_rv_redo_can_run_in_parallel (const VPID * rcv_vpid, LOG_RCVINDEX rcvindex);
 static bool log_rv_find_checkpoint (THREAD_ENTRY * thread_p, VOLID volid, LOG_LSA * rcv_lsa);
 static bool log_rv_get_unzip_log_data (THREAD_ENTRY * thread_p, int length, LOG_LSA * log_lsa, LOG_PAGE * log_page_p,
 				       LOG_ZIP * undo_unzip_ptr);
@@ -409,34 +420,28 @@ end:
 }
 
 /*
- * log_rv_redo_record - EXECUTE A REDO RECORD
+ * log_rv_redo_read_data - READ THE DATA OF A REDO RECORD
  *
  * return: nothing
  *
  *   log_lsa(in/out): Log address identifier containing the log record
  *   log_page_p(in/out): Pointer to page where data starts (Set as a side
  *               effect to the page where data ends)
- *   redofun(in): Function to invoke to redo the data
- *   rcv(in/out): Recovery structure for recovery function(Set as a side
- *               effect)
- *   rcv_lsa_ptr(in): Reset data page (rcv->pgptr) to this LSA
- *   ignore_redofunc(in):
+ *   rcv(in/out): Recovery structure; data and length are set as a side effect
  *   undo_length(in):
  *   undo_data(in):
  *   redo_unzip_ptr(in):
+ *   area(out): Allocated area holding the data, if it did not fit in the log page. Caller must free it.
  *
- * NOTE: Execute a redo log record.
+ * NOTE: Get the redo data of a log record, unzipping it and applying the diff with undo data when needed.
  */
 static void
-log_rv_redo_record (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_page_p,
-		    int (*redofun) (THREAD_ENTRY * thread_p, LOG_RCV *), LOG_RCV * rcv, LOG_LSA * rcv_lsa_ptr,
-		    int undo_length, char *undo_data, LOG_ZIP * redo_unzip_ptr)
+log_rv_redo_read_data (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_page_p, LOG_RCV * rcv,
+		       int undo_length, char *undo_data, LOG_ZIP * redo_unzip_ptr, char **area)
 {
-  char *area = NULL;
   bool is_zip = false;
-  int error_code;
 
-  /* Note the the data page rcv->pgptr has been fetched by the caller */
+  *area = NULL;
 
   /*
    * If data is contained in only one buffer, pass pointer directly.
@@ -457,15 +462,15 @@ log_rv_redo_record (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_p
     }
   else
     {
-      area = (char *) malloc (rcv->length);
-      if (area == NULL)
+      *area = (char *) malloc (rcv->length);
+      if (*area == NULL)
 	{
 	  logpb_fatal_error (thread_p, true, ARG_FILE_LINE, "log_rvredo_rec");
 	  return;
 	}
       /* Copy the data */
-      logpb_copy_from_log (thread_p, area, rcv->length, log_lsa, log_page_p);
-      rcv->data = area;
+      logpb_copy_from_log (thread_p, *area, rcv->length, log_lsa, log_page_p);
+      rcv->data = *area;
     }
 
   if (is_zip)
@@ -489,6 +494,24 @@ log_rv_redo_record (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_p
 	  logpb_fatal_error (thread_p, true, ARG_FILE_LINE, "log_rvredo_rec");
 	}
     }
+}
+
+/*
+ * log_rv_redo_apply - APPLY A REDO RECORD
+ *
+ * return: nothing
+ *
+ *   redofun(in): Function to invoke to redo the data
+ *   rcv(in/out): Recovery structure for recovery function
+ *   rcv_lsa_ptr(in): Reset data page (rcv->pgptr) to this LSA
+ *
+ * NOTE: Invoke the redo function and set the LSA of the page. The data page rcv->pgptr has been fetched by the caller.
+ */
+static void
+log_rv_redo_apply (THREAD_ENTRY * thread_p, int (*redofun) (THREAD_ENTRY * thread_p, LOG_RCV *), LOG_RCV * rcv,
+		   const LOG_LSA * rcv_lsa_ptr)
+{
+  int error_code;
 
   if (redofun != NULL)
     {
@@ -524,6 +547,39 @@ log_rv_redo_record (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_p
     {
       (void) pgbuf_set_lsa (thread_p, rcv->pgptr, rcv_lsa_ptr);
     }
+}
+
+/*
+ * log_rv_redo_record - EXECUTE A REDO RECORD
+ *
+ * return: nothing
+ *
+ *   log_lsa(in/out): Log address identifier containing the log record
+ *   log_page_p(in/out): Pointer to page where data starts (Set as a side
+ *               effect to the page where data ends)
+ *   redofun(in): Function to invoke to redo the data
+ *   rcv(in/out): Recovery structure for recovery function(Set as a side
+ *               effect)
+ *   rcv_lsa_ptr(in): Reset data page (rcv->pgptr) to this LSA
+ *   ignore_redofunc(in):
+ *   undo_length(in):
+ *   undo_data(in):
+ *   redo_unzip_ptr(in):
+ *
+ * NOTE: Execute a redo log record.
+ */
+static void
+log_rv_redo_record (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_page_p,
+		    int (*redofun) (THREAD_ENTRY * thread_p, LOG_RCV *), LOG_RCV * rcv, LOG_LSA * rcv_lsa_ptr,
+		    int undo_length, char *undo_data, LOG_ZIP * redo_unzip_ptr)
+{
+  char *area = NULL;
+
+  /* Note the the data page rcv->pgptr has been fetched by the caller */
+
+  log_rv_redo_read_data (thread_p, log_lsa, log_page_p, rcv, undo_length, undo_data, redo_unzip_ptr, &area);
+
+  log_rv_redo_apply (thread_p, redofun, rcv, rcv_lsa_ptr);
 
   if (area != NULL)
     {
@@ -531,6 +587,120 @@ log_rv_redo_record (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_p
     }
 }
 
+/*
+ * log_rv_redo_record_parallel - DISPATCH A REDO RECORD OF A DATA PAGE
+ *
+ * return: nothing
+ *
+ *   log_lsa(in/out): Log address identifier containing the log record
+ *   log_page_p(in/out): Pointer to page where data starts (Set as a side
+ *               effect to the page where data ends)
+ *   redo_parallel(in): Parallel redo
+ *   rcv_vpid(in): Page to redo
+ *   rcvindex(in): Recovery index
+ *   is_compensate(in): true to use the undo function of rcvindex
+ *   rcv(in/out): Recovery structure for recovery function
+ *   rcv_lsa_ptr(in): LSA of the log record
+ *   undo_length(in):
+ *   undo_data(in):
+ *   redo_unzip_ptr(in):
+ *
+ * NOTE: Same as log_rv_redo_record, but the data page is fixed and redone by a recovery worker.
+ *       See log_rv_redo_page_record.
+ */
+static void
+log_rv_redo_record_parallel (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_page_p,
+			     cublog::redo_parallel & redo_parallel, const VPID * rcv_vpid, LOG_RCVINDEX rcvindex,
+			     bool is_compensate, LOG_RCV * rcv, const LOG_LSA * rcv_lsa_ptr, int undo_length,
+			     char *undo_data, LOG_ZIP * redo_unzip_ptr)
+{
+  char *area = NULL;
+
+  assert (rcv->pgptr == NULL);
+
+  log_rv_redo_read_data (thread_p, log_lsa, log_page_p, rcv, undo_length, undo_data, redo_unzip_ptr, &area);
+
+  /* data is copied */
+  redo_parallel.add (*rcv_vpid, rcvindex, is_compensate, *rcv_lsa_ptr, *rcv);
+
+  if (area != NULL)
+    {
+      free_and_init (area);
+    }
+}
+
+/*
+ * log_rv_redo_page_record - EXECUTE A REDO RECORD OF A DATA PAGE
+ *
+ * return: nothing
+ *
+ *   rcv_vpid(in): Page to redo
+ *   rcvindex(in): Recovery index
+ *   is_compensate(in): true to use the undo function of rcvindex
+ *   rcv(in/out): Recovery structure for recovery function, with the data already read
+ *   rcv_lsa(in): LSA of the log record
+ *
+ * NOTE: Fix the data page, check if the redo is already reflected and execute the redo record if not.
+ *       Used by the recovery workers of parallel redo.
+ */
+void
+log_rv_redo_page_record (THREAD_ENTRY * thread_p, const VPID * rcv_vpid, LOG_RCVINDEX rcvindex, bool is_compensate,
+			 LOG_RCV * rcv, const LOG_LSA * rcv_lsa)
+{
+  rcv->pgptr = log_rv_redo_fix_page (thread_p, rcv_vpid, rcvindex);
+  if (rcv->pgptr == NULL)
+    {
+      /* deallocated */
+      return;
+    }
+
+  if (LSA_LE (rcv_lsa, pgbuf_get_lsa (rcv->pgptr)))
+    {
+      /* It is already done */
+      pgbuf_unfix_and_init (thread_p, rcv->pgptr);
+      return;
+    }
+
+  log_rv_redo_apply (thread_p, is_compensate ? RV_fun[rcvindex].undofun : RV_fun[rcvindex].redofun, rcv, rcv_lsa);
+
+  pgbuf_unfix_and_init (thread_p, rcv->pgptr);
+}
+
+/*
+ * log_rv_redo_can_run_in_parallel - CAN A REDO RECORD BE APPLIED BY A RECOVERY WORKER?
+ *
+ * return: true if the record only changes its own page
+ *
+ *   rcv_vpid(in): Page to redo
+ *   rcvindex(in): Recovery index
+ *
+ * NOTE: Disk records change the sector tables that are checked when pages are fixed during redo, and vacuum data
+ *       records change the state of vacuum. They are applied in log order, after all dispatched records.
+ */
+static bool
+log_rv_redo_can_run_in_parallel (const VPID * rcv_vpid, LOG_RCVINDEX rcvindex)
+{
+  if (rcv_vpid->pageid == NULL_PAGEID || rcv_vpid->volid == NULL_VOLID)
+    {
+      /* logical redo */
+      return false;
+    }
+
+  if (rcvindex <= RVDK_VOLHEAD_EXPAND)
+    {
+      /* disk manager */
+      return false;
+    }
+
+  if (rcvindex >= RVVAC_COMPLETE && rcvindex <= RVVAC_DROPPED_FILE_REPLACE)
+    {
+      /* vacuum data and dropped files */
+      return false;
+    }
+
+  return true;
+}
+
 /*
  * log_rv_find_checkpoint - FIND RECOVERY CHECKPOINT
  *
@@ -3081,6 +3251,8 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
   LOG_ZIP *redo_unzip_ptr = NULL;
   bool is_diff_rec;
   bool is_mvcc_op = false;
+  cublog::redo_parallel *redo_parallel = NULL;
+  bool is_parallel_redo = false;
 
   aligned_log_pgbuf = PTR_ALIGN (log_pgbuf, MAX_ALIGNMENT);
 
@@ -3122,6 +3294,15 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
       return;
     }
 
+  /* Redo of data pages is dispatched to recovery workers, partitioned by page. Everything else is done by this thread,
+   * after waiting for the workers to apply all dispatched records. */
+  redo_parallel = new cublog::redo_parallel (prm_get_integer_value (PRM_ID_RECOVERY_PARALLEL_COUNT));
+  if (!redo_parallel->is_running ())
+    {
+      delete redo_parallel;
+      redo_parallel = NULL;
+    }
+
   while (!LSA_ISNULL (&lsa))
     {
       /* Fetch the page where the LSA record to undo is located */
@@ -3294,8 +3475,14 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 
 	      rcv.pgptr = NULL;
 	      rcvindex = undoredo->data.rcvindex;
+	      is_parallel_redo = (redo_parallel != NULL && log_rv_redo_can_run_in_parallel (&rcv_vpid, rcvindex));
+	      if (redo_parallel != NULL && !is_parallel_redo)
+		{
+		  /* redone by this thread, after all dispatched records */
+		  redo_parallel->wait_for_idle ();
+		}
 	      /* If the page does not exit, there is nothing to redo */
-	      if (rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
+	      if (!is_parallel_redo && rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
 		{
 		  rcv.pgptr = log_rv_redo_fix_page (thread_p, &rcv_vpid, rcvindex);
 		  if (rcv.pgptr == NULL)
@@ -3404,7 +3591,13 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 		}
 #endif /* !NDEBUG */
 
-	      if (is_diff_rec)
+	      if (is_parallel_redo)
+		{
+		  log_rv_redo_record_parallel (thread_p, &log_lsa, log_pgptr, *redo_parallel, &rcv_vpid, rcvindex, false,
+					       &rcv, &rcv_lsa, is_diff_rec ? (int) undo_unzip_ptr->data_length : 0,
+					       is_diff_rec ? (char *) undo_unzip_ptr->log_data : NULL, redo_unzip_ptr);
+		}
+	      else if (is_diff_rec)
 		{
 		  /* XOR Process */
 		  log_rv_redo_record (thread_p, &log_lsa, log_pgptr, RV_fun[rcvindex].redofun, &rcv, &rcv_lsa,
@@ -3480,8 +3673,14 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 
 	      rcv.pgptr = NULL;
 	      rcvindex = redo->data.rcvindex;
+	      is_parallel_redo = (redo_parallel != NULL && log_rv_redo_can_run_in_parallel (&rcv_vpid, rcvindex));
+	      if (redo_parallel != NULL && !is_parallel_redo)
+		{
+		  /* redone by this thread, after all dispatched records */
+		  redo_parallel->wait_for_idle ();
+		}
 	      /* If the page does not exit, there is nothing to redo */
-	      if (rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
+	      if (!is_parallel_redo && rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
 		{
 		  rcv.pgptr = log_rv_redo_fix_page (thread_p, &rcv_vpid, rcvindex);
 		  if (rcv.pgptr == NULL)
@@ -3537,8 +3736,16 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 		}
 #endif /* !NDEBUG */
 
-	      log_rv_redo_record (thread_p, &log_lsa, log_pgptr, RV_fun[rcvindex].redofun, &rcv, &rcv_lsa, 0, NULL,
-				  redo_unzip_ptr);
+	      if (is_parallel_redo)
+		{
+		  log_rv_redo_record_parallel (thread_p, &log_lsa, log_pgptr, *redo_parallel, &rcv_vpid, rcvindex, false,
+					       &rcv, &rcv_lsa, 0, NULL, redo_unzip_ptr);
+		}
+	      else
+		{
+		  log_rv_redo_record (thread_p, &log_lsa, log_pgptr, RV_fun[rcvindex].redofun, &rcv, &rcv_lsa, 0, NULL,
+				      redo_unzip_ptr);
+		}
 
 	      if (rcv.pgptr != NULL)
 		{
@@ -3576,6 +3783,10 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 
 	      if (!log_recovery_needs_skip_logical_redo (thread_p, tran_id, log_rtype, rcvindex, &rcv_lsa))
 		{
+		  if (redo_parallel != NULL)
+		    {
+		      redo_parallel->wait_for_idle ();
+		    }
 		  log_rv_redo_record (thread_p, &log_lsa, log_pgptr, RV_fun[rcvindex].redofun, &rcv, &rcv_lsa, 0, NULL,
 				      NULL);
 		}
@@ -3602,8 +3813,14 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 
 	      rcv.pgptr = NULL;
 	      rcvindex = run_posp->data.rcvindex;
+	      is_parallel_redo = (redo_parallel != NULL && log_rv_redo_can_run_in_parallel (&rcv_vpid, rcvindex));
+	      if (redo_parallel != NULL && !is_parallel_redo)
+		{
+		  /* redone by this thread, after all dispatched records */
+		  redo_parallel->wait_for_idle ();
+		}
 	      /* If the page does not exit, there is nothing to redo */
-	      if (rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
+	      if (!is_parallel_redo && rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
 		{
 		  rcv.pgptr = log_rv_redo_fix_page (thread_p, &rcv_vpid, rcvindex);
 		  if (rcv.pgptr == NULL)
@@ -3660,8 +3877,16 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 		}
 #endif /* !NDEBUG */
 
-	      log_rv_redo_record (thread_p, &log_lsa, log_pgptr, RV_fun[rcvindex].redofun, &rcv, &rcv_lsa, 0, NULL,
-				  NULL);
+	      if (is_parallel_redo)
+		{
+		  log_rv_redo_record_parallel (thread_p, &log_lsa, log_pgptr, *redo_parallel, &rcv_vpid, rcvindex, false,
+					       &rcv, &rcv_lsa, 0, NULL, NULL);
+		}
+	      else
+		{
+		  log_rv_redo_record (thread_p, &log_lsa, log_pgptr, RV_fun[rcvindex].redofun, &rcv, &rcv_lsa, 0, NULL,
+				      NULL);
+		}
 
 	      if (rcv.pgptr != NULL)
 		{
@@ -3689,8 +3914,14 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 
 	      rcv.pgptr = NULL;
 	      rcvindex = compensate->data.rcvindex;
+	      is_parallel_redo = (redo_parallel != NULL && log_rv_redo_can_run_in_parallel (&rcv_vpid, rcvindex));
+	      if (redo_parallel != NULL && !is_parallel_redo)
+		{
+		  /* redone by this thread, after all dispatched records */
+		  redo_parallel->wait_for_idle ();
+		}
 	      /* If the page does not exit, there is nothing to redo */
-	      if (rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
+	      if (!is_parallel_redo && rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
 		{
 		  rcv.pgptr = log_rv_redo_fix_page (thread_p, &rcv_vpid, rcvindex);
 		  if (rcv.pgptr == NULL)
@@ -3746,8 +3977,16 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 		}
 #endif /* !NDEBUG */
 
-	      log_rv_redo_record (thread_p, &log_lsa, log_pgptr, RV_fun[rcvindex].undofun, &rcv, &rcv_lsa, 0, NULL,
-				  NULL);
+	      if (is_parallel_redo)
+		{
+		  log_rv_redo_record_parallel (thread_p, &log_lsa, log_pgptr, *redo_parallel, &rcv_vpid, rcvindex, true,
+					       &rcv, &rcv_lsa, 0, NULL, NULL);
+		}
+	      else
+		{
+		  log_rv_redo_record (thread_p, &log_lsa, log_pgptr, RV_fun[rcvindex].undofun, &rcv, &rcv_lsa, 0, NULL,
+				      NULL);
+		}
 	      if (rcv.pgptr != NULL)
 		{
 		  pgbuf_unfix (thread_p, rcv.pgptr);
@@ -4040,6 +4279,13 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 	}
     }
 
+  if (redo_parallel != NULL)
+    {
+      /* wait for the workers to redo all dispatched pages */
+      delete redo_parallel;
+      redo_parallel = NULL;
+    }
+
   log_zip_free (undo_unzip_ptr);
   log_zip_free (redo_unzip_ptr);
 
@@ -4058,6 +4304,11 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
   (void) pgbuf_flush_all (thread_p, NULL_VOLID);
 
 exit:
+  if (redo_parallel != NULL)
+    {
+      delete redo_parallel;
+    }
+
   LSA_SET_NULL (&log_Gl.unique_stats_table.curr_rcv_rec_lsa);
 
   return;
@@ -0,0 +1,276 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * log_recovery_redo_parallel.cpp - apply redo log records of data pages in parallel during recovery
+ */
+
+#include "log_recovery_redo_parallel.hpp"
+
+#include "log_impl.h"
+#include "memory_alloc.h"
+#include "thread_entry.hpp"
+#include "thread_entry_task.hpp"
+#include "thread_worker_pool.hpp"
+
+#include <cstring>
+
+namespace cublog
+{
+  //
+  // redo_context - worker thread entries act as system transaction workers
+  //
+  class redo_parallel::redo_context : public cubthread::entry_manager
+  {
+    protected:
+      void on_create (context_type &context) override
+      {
+	context.claim_system_worker ();
+      }
+
+      void on_retire (context_type &context) override
+      {
+	context.retire_system_worker ();
+      }
+
+      void on_recycle (context_type &context) override
+      {
+	context.tran_index = LOG_SYSTEM_TRAN_INDEX;
+      }
+  };
+
+  //
+  // redo_task - a batch of redo records of the same partition, applied in the order they were added
+  //
+  class redo_parallel::redo_task : public cubthread::entry_task
+  {
+    public:
+      explicit redo_task (redo_parallel &parent)
+	: m_parent (parent)
+	, m_records ()
+	, m_data ()
+      {
+	m_records.reserve (BATCH_MAX_RECORDS);
+      }
+
+      void add (const VPID &vpid, LOG_RCVINDEX rcvindex, bool is_compensate, const log_lsa &rcv_lsa,
+		const LOG_RCV &rcv)
+      {
+	record rec;
+
+	rec.m_vpid = vpid;
+	rec.m_rcvindex = rcvindex;
+	rec.m_is_compensate = is_compensate;
+	rec.m_rcv_lsa = rcv_lsa;
+	rec.m_mvcc_id = rcv.mvcc_id;
+	rec.m_offset = rcv.offset;
+	rec.m_length = rcv.length;
+	rec.m_reference_lsa = rcv.reference_lsa;
+
+	// keep data aligned like it is in log pages; recovery functions may read structures from it
+	rec.m_data_offset = DB_ALIGN (m_data.size (), MAX_ALIGNMENT);
+	if (rcv.length > 0)
+	  {
+	    m_data.resize (rec.m_data_offset + rcv.length);
+	    std::memcpy (m_data.data () + rec.m_data_offset, rcv.data, rcv.length);
+	  }
+
+	m_records.push_back (rec);
+      }
+
+      bool is_empty () const
+      {
+	return m_records.empty ();
+      }
+
+      bool is_full () const
+      {
+	return m_records.size () >= BATCH_MAX_RECORDS || m_data.size () >= BATCH_MAX_DATA_SIZE;
+      }
+
+      void execute (context_type &thread_ref) override
+      {
+	LOG_RCV rcv;
+
+	for (const record &rec : m_records)
+	  {
+	    rcv.mvcc_id = rec.m_mvcc_id;
+	    rcv.pgptr = NULL;
+	    rcv.offset = rec.m_offset;
+	    rcv.length = rec.m_length;
+	    rcv.data = rec.m_length > 0 ? m_data.data () + rec.m_data_offset : NULL;
+	    rcv.reference_lsa = rec.m_reference_lsa;
+
+	    log_rv_redo_page_record (&thread_ref, &rec.m_vpid, rec.m_rcvindex, rec.m_is_compensate, &rcv,
+				     &rec.m_rcv_lsa);
+	  }
+
+	m_parent.end_task ();
+      }
+
+    private:
+      struct record
+      {
+	VPID m_vpid;
+	LOG_RCVINDEX m_rcvindex;
+	bool m_is_compensate;
+	log_lsa m_rcv_lsa;
+	MVCCID m_mvcc_id;
+	PGLENGTH m_offset;
+	int m_length;
+	log_lsa m_reference_lsa;
+	std::size_t m_data_offset;
+      };
+
+      redo_parallel &m_parent;
+      std::vector<record> m_records;
+      std::vector<char> m_data;
+  };
+
+  redo_parallel::redo_parallel (std::size_t worker_count)
+    : m_worker_count (worker_count)
+    , m_context (NULL)
+    , m_worker_pool (NULL)
+    , m_batches ()
+    , m_mutex ()
+    , m_idle_cv ()
+    , m_space_cv ()
+    , m_tasks_in_progress (0)
+    , m_max_tasks_in_progress (worker_count * MAX_TASKS_PER_WORKER)
+  {
+    if (m_worker_count <= 1)
+      {
+	// no point in dispatching records to a single worker
+	return;
+      }
+
+    m_context = new redo_context ();
+
+    // one worker per core; a partition always goes to the same core, thus to the same worker
+    m_worker_pool = cubthread::get_manager ()->create_worker_pool (m_worker_count, m_worker_count, "recovery redo",
+		    m_context, m_worker_count, false);
+    if (m_worker_pool == NULL)
+      {
+	// not enough thread entries or SA_MODE
+	delete m_context;
+	m_context = NULL;
+	return;
+      }
+
+    m_batches.resize (m_worker_count, NULL);
+  }
+
+  redo_parallel::~redo_parallel ()
+  {
+    if (m_worker_pool != NULL)
+      {
+	wait_for_idle ();
+	cubthread::get_manager ()->destroy_worker_pool (m_worker_pool);
+      }
+
+    for (redo_task *batch : m_batches)
+      {
+	delete batch;
+      }
+
+    delete m_context;
+  }
+
+  bool
+  redo_parallel::is_running () const
+  {
+    return m_worker_pool != NULL;
+  }
+
+  void
+  redo_parallel::add (const VPID &vpid, LOG_RCVINDEX rcvindex, bool is_compensate, const log_lsa &rcv_lsa,
+		      const LOG_RCV &rcv)
+  {
+    assert (is_running ());
+    assert (!VPID_ISNULL (&vpid));
+
+    std::size_t partition = ((std::size_t) vpid.volid * 31 + (std::size_t) vpid.pageid) % m_worker_count;
+
+    if (m_batches[partition] == NULL)
+      {
+	m_batches[partition] = new redo_task (*this);
+      }
+    m_batches[partition]->add (vpid, rcvindex, is_compensate, rcv_lsa, rcv);
+
+    if (m_batches[partition]->is_full ())
+      {
+	push_task (partition);
+      }
+  }
+
+  void
+  redo_parallel::wait_for_idle ()
+  {
+    assert (is_running ());
+
+    for (std::size_t partition = 0; partition < m_worker_count; partition++)
+      {
+	if (m_batches[partition] != NULL)
+	  {
+	    push_task (partition);
+	  }
+      }
+
+    std::unique_lock<std::mutex> ulock (m_mutex);
+    m_idle_cv.wait (ulock, [this] { return m_tasks_in_progress == 0; });
+  }
+
+  void
+  redo_parallel::push_task (std::size_t partition)
+  {
+    redo_task *batch = m_batches[partition];
+
+    m_batches[partition] = NULL;
+    if (batch->is_empty ())
+      {
+	delete batch;
+	return;
+      }
+
+    {
+      // backpressure: wait for the workers to catch up rather than queue an unbounded amount of records
+      std::unique_lock<std::mutex> ulock (m_mutex);
+      m_space_cv.wait (ulock, [this] { return m_tasks_in_progress < m_max_tasks_in_progress; });
+      m_tasks_in_progress++;
+    }
+
+    // the core is chosen by partition, so batches of a partition are executed one after another, in push order
+    cubthread::get_manager ()->push_task_on_core (m_worker_pool, batch, partition);
+  }
+
+  void
+  redo_parallel::end_task ()
+  {
+    std::lock_guard<std::mutex> lockg (m_mutex);
+
+    assert (m_tasks_in_progress > 0);
+    if (--m_tasks_in_progress == 0)
+      {
+	m_idle_cv.notify_all ();
+      }
+    if (m_tasks_in_progress + 1 == m_max_tasks_in_progress)
+      {
+	m_space_cv.notify_all ();
+      }
+  }
+} // namespace cublog
@@ -0,0 +1,114 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * log_recovery_redo_parallel.hpp - apply redo log records of data pages in parallel during recovery
+ */
+
+#ifndef _LOG_RECOVERY_REDO_PARALLEL_HPP_
+#define _LOG_RECOVERY_REDO_PARALLEL_HPP_
+
+#if !defined (SERVER_MODE) && !defined (SA_MODE)
+#error Wrong module
+#endif // not SERVER_MODE and not SA_MODE
+
+#include "log_lsa.hpp"
+#include "recovery.h"
+#include "storage_common.h"
+#include "thread_manager.hpp"
+
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace cublog
+{
+  // redo_parallel - dispatch redo of data page log records to a pool of workers
+  //
+  //  how it works:
+  //    records are partitioned by the VPID of the page they change. each partition is served by a single worker (the
+  //    worker pool has one worker per core and each partition is pushed on its own core), so all records of a page are
+  //    applied in the order they were added, which is LSA order. records of different pages are applied concurrently.
+  //
+  //    the records are not pushed one by one; they are collected into one batch per partition and a batch is pushed
+  //    once it is full, or when wait_for_idle is called.
+  //
+  //    the number of pushed batches that are not yet applied is limited to MAX_TASKS_PER_WORKER per worker. once the
+  //    limit is reached, add blocks until the workers catch up, so a log that is read faster than it is redone does
+  //    not keep all its records in memory.
+  //
+  //    records that are not limited to one page (logical records, or records that change volume or vacuum state) must
+  //    not be dispatched; the caller applies them itself after calling wait_for_idle.
+  //
+  //  how to use:
+  //    redo_parallel redo (worker_count);
+  //    if (redo.is_running ())
+  //      {
+  //        redo.add (vpid, rcvindex, is_compensate, rcv_lsa, rcv);   // rcv.data is copied
+  //        ...
+  //        redo.wait_for_idle ();                                   // before anything that depends on redone pages
+  //      }
+  //
+  class redo_parallel
+  {
+    public:
+      redo_parallel () = delete;
+      explicit redo_parallel (std::size_t worker_count);
+      redo_parallel (const redo_parallel &) = delete;
+      redo_parallel (redo_parallel &&) = delete;
+
+      ~redo_parallel ();
+
+      redo_parallel &operator= (const redo_parallel &) = delete;
+      redo_parallel &operator= (redo_parallel &&) = delete;
+
+      // false if the worker pool could not be created (e.g. SA_MODE); the caller must redo serially
+      bool is_running () const;
+
+      // add a redo record of the page vpid; uses undo function of rcvindex if is_compensate is true
+      void add (const VPID &vpid, LOG_RCVINDEX rcvindex, bool is_compensate, const log_lsa &rcv_lsa,
+		const LOG_RCV &rcv);
+      // push all collected records and wait until all of them are applied
+      void wait_for_idle ();
+
+    private:
+      class redo_task;
+      class redo_context;
+
+      void push_task (std::size_t partition);
+      void end_task ();
+
+      static const std::size_t BATCH_MAX_RECORDS = 64;
+      static const std::size_t BATCH_MAX_DATA_SIZE = 64 * 1024;
+      static const std::size_t MAX_TASKS_PER_WORKER = 4;
+
+      std::size_t m_worker_count;
+      redo_context *m_context;
+      cubthread::entry_workpool *m_worker_pool;
+      std::vector<redo_task *> m_batches;	// one batch being collected per partition
+
+      std::mutex m_mutex;
+      std::condition_variable m_idle_cv;	// notified when all tasks are finished
+      std::condition_variable m_space_cv;	// notified when a task can be pushed again
+      std::size_t m_tasks_in_progress;		// pushed, but not yet finished
+      std::size_t m_max_tasks_in_progress;
+  };
+} // namespace cublog
+
+#endif // _LOG_RECOVERY_REDO_PARALLEL_HPP_
@@ -4584,6 +4584,12 @@ logtb_complete_sub_mvcc (THREAD_ENTRY * thread_p, LOG_TDES * tdes)
     {
       /* adjust snapshot to reflect committed sub-transaction, since the parent transaction didn't finished yet */
       MVCC_SNAPSHOT *snapshot = &tdes->mvccinfo.snapshot;
+      if (snapshot->csn != MVCC_CSN_NULL)
+	{
+	  /* the sub-transaction has a commit sequence number after the snapshot */
+	  snapshot->m_completed_sub_mvccids.push_back (mvcc_sub_id);
+	  return;
+	}
       if (mvcc_sub_id >= snapshot->highest_completed_mvccid)
 	{
 	  snapshot->highest_completed_mvccid = mvcc_sub_id;
@@ -31,6 +31,8 @@
 #include "porting_inline.hpp"
 #include "vacuum.h"
 
+#include <algorithm>
+
 #define MVCC_IS_REC_INSERTER_ACTIVE(thread_p, rec_header_p) \
   (mvcc_is_active_id (thread_p, (rec_header_p)->mvcc_ins_id))
 
@@ -86,6 +88,18 @@ mvcc_is_id_in_snapshot (THREAD_ENTRY * thread_p, MVCCID mvcc_id, MVCC_SNAPSHOT *
       return false;
     }
 
+  if (snapshot->csn != MVCC_CSN_NULL)
+    {
+      if (log_Gl.mvcc_table.is_completed_in_csn_snapshot (mvcc_id, snapshot->csn))
+	{
+	  return false;
+	}
+      /* active, unless it is a sub-transaction of the snapshot owner */
+      return (snapshot->m_completed_sub_mvccids.empty ()
+	      || std::find (snapshot->m_completed_sub_mvccids.begin (), snapshot->m_completed_sub_mvccids.end (),
+			    mvcc_id) == snapshot->m_completed_sub_mvccids.end ());
+    }
+
   if (MVCC_ID_FOLLOW_OR_EQUAL (mvcc_id, snapshot->highest_completed_mvccid))
     {
       /* MVCC id is active */
@@ -644,6 +658,8 @@ mvcc_snapshot::mvcc_snapshot ()
   : lowest_active_mvccid (MVCCID_NULL)
   , highest_completed_mvccid (MVCCID_NULL)
   , m_active_mvccs ()
+  , csn (MVCC_CSN_NULL)
+  , m_completed_sub_mvccids ()
   , snapshot_fnc (NULL)
   , valid (false)
 {
@@ -657,6 +673,8 @@ mvcc_snapshot::reset ()
   highest_completed_mvccid = MVCCID_NULL;
 
   m_active_mvccs.reset ();
+  csn = MVCC_CSN_NULL;
+  m_completed_sub_mvccids.clear ();
 
   valid = false;
 }
@@ -669,6 +687,8 @@ mvcc_snapshot::copy_to (mvcc_snapshot & dest) const
 
   dest.lowest_active_mvccid = lowest_active_mvccid;
   dest.highest_completed_mvccid = highest_completed_mvccid;
+  dest.csn = csn;
+  dest.m_completed_sub_mvccids = m_completed_sub_mvccids;
   dest.snapshot_fnc = snapshot_fnc;
   dest.valid = valid;
 }
@@ -173,6 +173,11 @@ struct mvcc_snapshot
 
   mvcc_active_tran m_active_mvccs;
 
+  MVCC_CSN csn;			/* commit sequence number of the snapshot, MVCC_CSN_NULL if m_active_mvccs is used */
+  // *INDENT-OFF*
+  std::vector<MVCCID> m_completed_sub_mvccids;	/* sub-transactions of the owner completed after the csn snapshot */
+  // *INDENT-ON*
+
   MVCC_SNAPSHOT_FUNC snapshot_fnc;	/* the snapshot function */
 
   bool valid;			/* true, if the snapshot is valid */
@@ -26,9 +26,11 @@
 #include "log_impl.h"
 #include "mvcc.h"
 #include "perf_monitor.h"
+#include "system_parameter.h"
 #include "thread_manager.hpp"
 
 #include <cassert>
+#include <thread>
 
 // help debugging oldest active by following all changes
 struct oldest_active_event
@@ -170,6 +172,12 @@ mvcctable::mvcctable ()
   , m_active_trans_mutex ()
   , m_oldest_visible (MVCCID_NULL)
   , m_ov_lock_count (0)
+  , m_csn_enabled (false)
+  , m_last_csn (MVCC_CSN_NULL)
+  , m_csn_map (NULL)
+  , m_csn_overflow ()
+  , m_csn_overflow_mutex ()
+  , m_csn_last_unrecorded (MVCCID_NULL)
 {
 }
 
@@ -177,6 +185,7 @@ mvcctable::~mvcctable ()
 {
   delete [] m_transaction_lowest_visible_mvccids;
   delete [] m_trans_status_history;
+  delete [] m_csn_map;
 }
 
 void
@@ -192,6 +201,20 @@ mvcctable::initialize ()
   m_current_status_lowest_active_mvccid = MVCCID_FIRST;
 
   alloc_transaction_lowest_active ();
+
+#if defined (SERVER_MODE)
+  // slots are reused only when vacuum advances the oldest visible MVCCID
+  m_csn_enabled = prm_get_bool_value (PRM_ID_MVCC_CSN_SNAPSHOT) && !prm_get_bool_value (PRM_ID_DISABLE_VACUUM);
+#else
+  m_csn_enabled = false;
+#endif
+  m_last_csn = MVCC_CSN_FIRST;
+  m_csn_last_unrecorded = MVCCID_NULL;
+  if (m_csn_enabled && m_csn_map == NULL)
+    {
+      m_csn_map = new csn_slot[CSN_MAP_SIZE] ();
+      // all are 0 = MVCCID_NULL
+    }
 }
 
 void
@@ -218,6 +241,11 @@ mvcctable::finalize ()
   delete [] m_transaction_lowest_visible_mvccids;
   m_transaction_lowest_visible_mvccids = NULL;
   m_transaction_lowest_visible_mvccids_size = 0;
+
+  delete [] m_csn_map;
+  m_csn_map = NULL;
+  m_csn_overflow.clear ();
+  m_csn_enabled = false;
 }
 
 void
@@ -229,6 +257,7 @@ mvcctable::build_mvcc_info (log_tdes &tdes)
   mvcc_trans_status::version_type trans_status_version;
 
   MVCCID highest_completed_mvccid;
+  MVCC_CSN snapshot_csn = MVCC_CSN_NULL;
 
   bool is_perf_tracking = perfmon_is_perf_tracking ();
   TSC_TICKS start_tick, end_tick;
@@ -289,6 +318,16 @@ mvcctable::build_mvcc_info (log_tdes &tdes)
 				     oldest_active_event::BUILD_MVCC_INFO);
 	}
 
+      if (m_csn_enabled)
+	{
+	  snapshot_csn = get_csn_snapshot (crt_status_lowest_active);
+	  if (snapshot_csn != MVCC_CSN_NULL)
+	    {
+	      break;
+	    }
+	  // some MVCCIDs have no commit sequence number; copy the bit area until they precede the lowest active
+	}
+
       index = m_trans_status_history_position.load ();
       assert (index < HISTORY_MAX_SIZE);
 
@@ -320,11 +359,22 @@ mvcctable::build_mvcc_info (log_tdes &tdes)
 	}
     }
 
-  // tdes.mvccinfo.snapshot.m_active_mvccs was not checked because it was not safe; now it is
-  tdes.mvccinfo.snapshot.m_active_mvccs.check_valid ();
+  if (snapshot_csn != MVCC_CSN_NULL)
+    {
+      // active MVCCIDs are found with is_completed_in_csn_snapshot
+      highest_completed_mvccid = MVCCID_NULL;
+      tdes.mvccinfo.snapshot.csn = snapshot_csn;
+      tdes.mvccinfo.snapshot.m_completed_sub_mvccids.clear ();
+    }
+  else
+    {
+      // tdes.mvccinfo.snapshot.m_active_mvccs was not checked because it was not safe; now it is
+      tdes.mvccinfo.snapshot.m_active_mvccs.check_valid ();
 
-  highest_completed_mvccid = tdes.mvccinfo.snapshot.m_active_mvccs.compute_highest_completed_mvccid ();
-  MVCCID_FORWARD (highest_completed_mvccid);
+      highest_completed_mvccid = tdes.mvccinfo.snapshot.m_active_mvccs.compute_highest_completed_mvccid ();
+      MVCCID_FORWARD (highest_completed_mvccid);
+      tdes.mvccinfo.snapshot.csn = MVCC_CSN_NULL;
+    }
 
   /* update lowest active mvccid computed for the most recent snapshot */
   tdes.mvccinfo.recent_snapshot_lowest_active_mvccid = crt_status_lowest_active;
@@ -480,6 +530,11 @@ mvcctable::complete_mvcc (int tran_index, MVCCID mvccid, bool committed)
       assert (false);
     }
 
+  if (m_csn_enabled)
+    {
+      csn_complete_mvccid (mvccid);
+    }
+
   // update current trans status
   m_current_trans_status.m_active_mvccs.set_inactive_mvccid (mvccid);
   m_current_trans_status.m_last_completed_mvccid = mvccid;
@@ -550,6 +605,11 @@ mvcctable::complete_sub_mvcc (MVCCID mvccid)
   size_t next_index;
   mvcc_trans_status &next_status = next_trans_status_start (next_version, next_index);
 
+  if (m_csn_enabled)
+    {
+      csn_complete_mvccid (mvccid);
+    }
+
   // update current trans status
   m_current_trans_status.m_active_mvccs.set_inactive_mvccid (mvccid);
   m_current_trans_status.m_last_completed_mvccid = mvccid;
@@ -571,6 +631,10 @@ mvcctable::get_new_mvccid ()
   m_new_mvccid_lock.lock ();
   id = log_Gl.hdr.mvcc_next_id;
   MVCCID_FORWARD (log_Gl.hdr.mvcc_next_id);
+  if (m_csn_enabled)
+    {
+      csn_register_mvccid (id);
+    }
   m_new_mvccid_lock.unlock ();
 
   return id;
@@ -587,6 +651,12 @@ mvcctable::get_two_new_mvccid (MVCCID &first, MVCCID &second)
   second = log_Gl.hdr.mvcc_next_id;
   MVCCID_FORWARD (log_Gl.hdr.mvcc_next_id);
 
+  if (m_csn_enabled)
+    {
+      csn_register_mvccid (first);
+      csn_register_mvccid (second);
+    }
+
   m_new_mvccid_lock.unlock ();
 }
 
@@ -624,6 +694,10 @@ mvcctable::update_global_oldest_visible ()
 	{
 	  assert (m_oldest_visible.load () <= oldest_visible);
 	  m_oldest_visible.store (oldest_visible);
+	  if (m_csn_enabled)
+	    {
+	      csn_remove_old_overflow (oldest_visible);
+	    }
 	}
     }
   return m_oldest_visible.load ();
@@ -647,3 +721,150 @@ mvcctable::is_global_oldest_visible_locked () const
 {
   return m_ov_lock_count != 0;
 }
+
+bool
+mvcctable::is_csn_enabled () const
+{
+  return m_csn_enabled;
+}
+
+//
+// get_csn_snapshot () - commit sequence number of a snapshot; MVCC_CSN_NULL if the bit area must be copied instead
+//
+//  note: lowest_active must be read before; every MVCCID that precedes it has a commit sequence number in the snapshot.
+//
+MVCC_CSN
+mvcctable::get_csn_snapshot (MVCCID lowest_active) const
+{
+  assert (m_csn_enabled);
+
+  MVCC_CSN csn = m_last_csn.load ();
+
+  // read after the commit sequence number; an MVCCID completed in the snapshot was registered before it completed
+  MVCCID last_unrecorded = m_csn_last_unrecorded.load ();
+  if (last_unrecorded != MVCCID_NULL && !MVCC_ID_PRECEDES (last_unrecorded, lowest_active))
+    {
+      // an MVCCID without a commit sequence number may be completed in the snapshot
+      return MVCC_CSN_NULL;
+    }
+
+  return csn;
+}
+
+//
+// is_completed_in_csn_snapshot () - true if the transaction with mvccid was completed when the snapshot was taken
+//
+//  note: mvccid must not precede the lowest active MVCCID of the snapshot; the oldest visible MVCCID cannot advance
+//        past it while the snapshot is used, so the slot of mvccid is not reused meanwhile.
+//
+//        an MVCCID that is found neither in its slot nor in overflow either precedes the oldest visible MVCCID or
+//        was not recorded. get_csn_snapshot does not return a commit sequence number while an MVCCID that was not
+//        recorded may be looked for, so only snapshots taken before it was registered look for it.
+//
+bool
+mvcctable::is_completed_in_csn_snapshot (MVCCID mvccid, MVCC_CSN snapshot_csn) const
+{
+  assert (m_csn_enabled);
+
+  const csn_slot &slot = m_csn_map[mvccid & CSN_MAP_INDEX_MASK];
+  MVCC_CSN csn;
+
+  if (slot.m_mvccid.load () == mvccid)
+    {
+      // a committer holds CSN_COMMITTING only for the increment of the commit sequence number
+      while ((csn = slot.m_csn.load ()) == CSN_COMMITTING)
+	{
+	  std::this_thread::yield ();
+	}
+      return csn <= snapshot_csn;
+    }
+
+  std::unique_lock<std::mutex> ulock (m_csn_overflow_mutex);
+  std::unordered_map<MVCCID, MVCC_CSN>::const_iterator it = m_csn_overflow.find (mvccid);
+  if (it == m_csn_overflow.end ())
+    {
+      // completed long ago if older than the oldest visible MVCCID; otherwise registered after the snapshot
+      return MVCC_ID_PRECEDES (mvccid, m_oldest_visible.load ());
+    }
+  return it->second <= snapshot_csn;
+}
+
+//
+// csn_register_mvccid () - mark new MVCCID as in progress; called with m_new_mvccid_lock
+//
+void
+mvcctable::csn_register_mvccid (MVCCID mvccid)
+{
+  csn_slot &slot = m_csn_map[mvccid & CSN_MAP_INDEX_MASK];
+  MVCCID slot_mvccid = slot.m_mvccid.load ();
+
+  if (slot_mvccid == MVCCID_NULL || MVCC_ID_PRECEDES (slot_mvccid, m_oldest_visible.load ()))
+    {
+      // nobody can look for slot_mvccid anymore; the state must be set before the slot is given to mvccid
+      slot.m_csn.store (CSN_IN_PROGRESS);
+      slot.m_mvccid.store (mvccid);
+    }
+  else
+    {
+      // the slot is still in use by a transaction that is visible to someone
+      std::unique_lock<std::mutex> ulock (m_csn_overflow_mutex);
+      if (m_csn_overflow.size () < CSN_OVERFLOW_MAX_SIZE)
+	{
+	  m_csn_overflow[mvccid] = CSN_IN_PROGRESS;
+	}
+      else
+	{
+	  // a long transaction keeps the ring saturated; snapshots copy the bit area until mvccid is old enough
+	  m_csn_last_unrecorded.store (mvccid);
+	}
+    }
+}
+
+//
+// csn_complete_mvccid () - give the next commit sequence number to a completed MVCCID; called with m_active_trans_mutex
+//
+//  note: a rolled back transaction gets a number too; its changes are never read, since they are undone.
+//
+void
+mvcctable::csn_complete_mvccid (MVCCID mvccid)
+{
+  csn_slot &slot = m_csn_map[mvccid & CSN_MAP_INDEX_MASK];
+
+  if (slot.m_mvccid.load () == mvccid)
+    {
+      // a snapshot that reads CSN_IN_PROGRESS before this store precedes the new number
+      slot.m_csn.store (CSN_COMMITTING);
+      slot.m_csn.store (++m_last_csn);
+    }
+  else
+    {
+      std::unique_lock<std::mutex> ulock (m_csn_overflow_mutex);
+      MVCC_CSN csn = ++m_last_csn;
+      std::unordered_map<MVCCID, MVCC_CSN>::iterator it = m_csn_overflow.find (mvccid);
+      if (it != m_csn_overflow.end ())
+	{
+	  it->second = csn;
+	}
+    }
+}
+
+//
+// csn_remove_old_overflow () - remove MVCCIDs that are no longer looked for from overflow
+//
+void
+mvcctable::csn_remove_old_overflow (MVCCID oldest_visible)
+{
+  std::unique_lock<std::mutex> ulock (m_csn_overflow_mutex);
+
+  for (std::unordered_map<MVCCID, MVCC_CSN>::iterator it = m_csn_overflow.begin (); it != m_csn_overflow.end ();)
+    {
+      if (MVCC_ID_PRECEDES (it->first, oldest_visible))
+	{
+	  it = m_csn_overflow.erase (it);
+	}
+      else
+	{
+	  ++it;
+	}
+    }
+}
@@ -32,6 +32,7 @@
 
 #include <atomic>
 #include <mutex>
+#include <unordered_map>
 
 // forward declarations
 struct log_tdes;
@@ -84,6 +85,14 @@ class mvcctable
 
     bool is_active (MVCCID mvccid) const;
 
+    // commit sequence number snapshots (mvcc_csn_snapshot parameter)
+    static const size_t CSN_MAP_SIZE = 256 * 1024;  // must be a power of 2
+    static const size_t CSN_OVERFLOW_MAX_SIZE = 16 * 1024;
+
+    bool is_csn_enabled () const;
+    MVCC_CSN get_csn_snapshot (MVCCID lowest_active) const;
+    bool is_completed_in_csn_snapshot (MVCCID mvccid, MVCC_CSN snapshot_csn) const;
+
     void reset_start_mvccid ();     // not thread safe
 
     MVCCID get_global_oldest_visible () const;
@@ -97,6 +106,18 @@ class mvcctable
     static const size_t HISTORY_MAX_SIZE = 2048;  // must be a power of 2
     static const size_t HISTORY_INDEX_MASK = HISTORY_MAX_SIZE - 1;
 
+    static const size_t CSN_MAP_INDEX_MASK = CSN_MAP_SIZE - 1;
+    // both follow any commit sequence number, so a transaction that is not yet committed is never in a snapshot
+    static const MVCC_CSN CSN_IN_PROGRESS = (MVCC_CSN) -1;
+    static const MVCC_CSN CSN_COMMITTING = (MVCC_CSN) -2;
+
+    // MVCCID => commit sequence number, for transactions that are not older than the oldest visible MVCCID
+    struct csn_slot
+    {
+      std::atomic<MVCCID> m_mvccid;
+      std::atomic<MVCC_CSN> m_csn;
+    };
+
     /* lowest active MVCCIDs - array of size NUM_TOTAL_TRAN_INDICES */
     lowest_active_mvccid_type *m_transaction_lowest_visible_mvccids;
     size_t m_transaction_lowest_visible_mvccids_size;
@@ -118,10 +139,25 @@ class mvcctable
     std::atomic<MVCCID> m_oldest_visible;
     std::atomic<size_t> m_ov_lock_count;
 
+    /* commit sequence number snapshots */
+    bool m_csn_enabled;
+    /* last commit sequence number */
+    std::atomic<MVCC_CSN> m_last_csn;
+    /* slots indexed by MVCCID; a slot is reused when its MVCCID becomes older than the oldest visible */
+    csn_slot *m_csn_map;
+    /* MVCCIDs that could not get a slot, because the slot was still in use; at most CSN_OVERFLOW_MAX_SIZE */
+    std::unordered_map<MVCCID, MVCC_CSN> m_csn_overflow;
+    mutable std::mutex m_csn_overflow_mutex;
+    /* last MVCCID that got neither a slot nor an overflow entry */
+    std::atomic<MVCCID> m_csn_last_unrecorded;
+
     mvcc_trans_status &next_trans_status_start (mvcc_trans_status::version_type &next_version, size_t &next_index);
     void next_tran_status_finish (mvcc_trans_status &next_trans_status, size_t next_index);
     void advance_oldest_active (MVCCID next_oldest_active);
     MVCCID compute_oldest_visible_mvccid () const;
+    void csn_register_mvccid (MVCCID mvccid);
+    void csn_complete_mvccid (MVCCID mvccid);
+    void csn_remove_old_overflow (MVCCID oldest_visible);
 };
 
 #endif // !_MVCC_TABLE_H_
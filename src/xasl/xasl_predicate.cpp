@@ -61,7 +61,8 @@ namespace cubxasl
 	    free_regu_not_null (pe.m_eval_term.et.et_rlike.pattern);
 	    free_regu_not_null (pe.m_eval_term.et.et_rlike.case_sensitive);
 		// *INDENT-OFF*
-	    cubregex::clear (pe.m_eval_term.et.et_rlike.compiled_regex, pe.m_eval_term.et.et_rlike.compiled_pattern);
+	    cubregex::clear (pe.m_eval_term.et.et_rlike.compiled_regex, pe.m_eval_term.et.et_rlike.compiled_pattern,
+			     pe.m_eval_term.et.et_rlike.compiled_dfa);
 		// *INDENT-ON*
 	    break;
 	  }
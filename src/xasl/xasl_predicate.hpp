@@ -134,6 +134,7 @@ namespace cubxasl
     regu_variable_node *case_sensitive;
     mutable cub_regex_object *compiled_regex;
     mutable char *compiled_pattern;
+    mutable cub_regex_dfa *compiled_dfa;
   };
 
   struct eval_term
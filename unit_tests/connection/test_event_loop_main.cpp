@@ -0,0 +1,157 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * test_event_loop_main.cpp - check that the epoll event loop of client connections stays idle on a stalled client.
+ *
+ *  usage:
+ *      test_event_loop
+ *
+ *  the test adds one end of a socket pair to an event loop as a client connection and runs the loop for a while from
+ *  the main thread, counting its executions. each execution that has nothing to do waits for events for
+ *  css_event_loop_task::WAIT_MSEC. it checks that the loop waits:
+ *    - while the connection is idle;
+ *    - while the connection has sent only part of a packet header.
+ *
+ *  no packet is completed, so no connection worker is needed. the process exits with 1 if any check fails.
+ */
+
+#include "connection_event_loop.hpp"
+#include "connection_sr.h"
+#include "error_manager.h"
+#include "thread_entry.hpp"
+#include "thread_manager.hpp"
+
+#include <chrono>
+#include <iostream>
+
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+static const int RUN_MSEC = 1000;
+// an execution without events waits WAIT_MSEC; a check of connections may arm a stalled connection, which wakes the
+// next execution at once. allow some more for slow machines; a busy loop runs thousands of times.
+static const int MAX_EXECUTIONS = 4 * RUN_MSEC / css_event_loop_task::WAIT_MSEC;
+
+static bool
+check (bool condition, const char *what)
+{
+  if (!condition)
+    {
+      std::cout << "    check failed: " << what << std::endl;
+    }
+  return condition;
+}
+
+static int
+run_loop (THREAD_ENTRY &thread_ref, css_event_loop_task &event_loop)
+{
+  auto start = std::chrono::steady_clock::now ();
+  int executions = 0;
+
+  while (std::chrono::steady_clock::now () - start < std::chrono::milliseconds (RUN_MSEC))
+    {
+      event_loop.execute (thread_ref);
+      executions++;
+    }
+  return executions;
+}
+
+static bool
+test_stalled_header (THREAD_ENTRY &thread_ref)
+{
+  int fds[2];
+  CSS_CONN_ENTRY *conn;
+  bool success = true;
+  int executions;
+
+  if (socketpair (AF_UNIX, SOCK_STREAM, 0, fds) != 0)
+    {
+      std::cout << "    cannot create socket pair" << std::endl;
+      return false;
+    }
+
+  conn = css_make_conn (fds[0]);
+  if (conn == NULL)
+    {
+      std::cout << "    cannot make connection" << std::endl;
+      close (fds[0]);
+      close (fds[1]);
+      return false;
+    }
+
+  {
+    css_event_loop_task event_loop (epoll_create1 (EPOLL_CLOEXEC));
+
+    success = check (event_loop.add (*conn) == NO_ERROR, "connection is added") && success;
+
+    executions = run_loop (thread_ref, event_loop);
+    std::cout << "    idle connection: " << executions << " executions" << std::endl;
+    success = check (executions <= MAX_EXECUTIONS, "the loop waits while the connection is idle") && success;
+
+    // a truncated NET_HEADER; the client stalls before sending the rest
+    char partial_header[sizeof (NET_HEADER) / 2] = { 0 };
+    success = check (send (fds[1], partial_header, sizeof (partial_header), 0) == (ssize_t) sizeof (partial_header),
+		     "part of a header is sent") && success;
+
+    executions = run_loop (thread_ref, event_loop);
+    std::cout << "    stalled header: " << executions << " executions" << std::endl;
+    success = check (executions <= MAX_EXECUTIONS, "the loop waits while the packet header is incomplete")
+	      && success;
+  }
+
+  close (fds[1]);
+  css_free_conn (conn);
+
+  return success;
+}
+
+int
+main (int argc, char **argv)
+{
+  THREAD_ENTRY *thread_p = NULL;
+  int failed = 0;
+
+  er_init (NULL, ER_NEVER_EXIT);
+  cubthread::initialize (thread_p);
+  if (cubthread::initialize_thread_entries () != NO_ERROR)
+    {
+      std::cout << "cannot initialize thread entries" << std::endl;
+      return 1;
+    }
+  if (css_init_conn_list () != NO_ERROR)
+    {
+      std::cout << "cannot initialize connection list" << std::endl;
+      return 1;
+    }
+
+  std::cout << "stalled packet header" << std::endl;
+  if (!test_stalled_header (*thread_p))
+    {
+      failed++;
+    }
+
+  if (failed > 0)
+    {
+      std::cout << "test failed" << std::endl;
+      return 1;
+    }
+  std::cout << "test successful" << std::endl;
+  return 0;
+}
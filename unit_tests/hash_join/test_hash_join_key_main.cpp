@@ -0,0 +1,187 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * test_hash_join_key_main.cpp - check the hash keys a hash join builds for join columns of different domains.
+ *
+ *  Joins NUMERIC(10,2) outer values to NUMERIC(12,4) inner values: equal values must hash alike and compare equal
+ *  once the inner value is coerced, and an inner value that can not be coerced must not match instead of failing.
+ */
+
+#include "dbtype.h"
+#include "language_support.h"
+#include "object_domain.h"
+#include "object_primitive.h"
+#include "object_representation.h"
+#include "query_list.h"
+#include "query_opfunc.h"
+#include "query_hash_scan.h"
+
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#define CHECK(cond) \
+  do \
+    { \
+      if (!(cond)) \
+	{ \
+	  std::cout << "    check failed at line " << __LINE__ << ": " #cond << std::endl; \
+	  return false; \
+	} \
+    } \
+  while (0)
+
+/* a list file tuple with a single column */
+class one_column_tuple
+{
+  public:
+    one_column_tuple ()
+      : m_buffer (DB_PAGESIZE)
+    {
+    }
+
+    bool set (const char *value_str, TP_DOMAIN *domain)
+    {
+      DB_VALUE str_value, value;
+      int val_size = 0;
+
+      db_make_string (&str_value, value_str);
+      db_make_null (&value);
+      if (tp_value_coerce (&str_value, &value, domain) != DOMAIN_COMPATIBLE)
+	{
+	  return false;
+	}
+
+      if (qdata_copy_db_value_to_tuple_value (&value, true, get () + QFILE_TUPLE_LENGTH_SIZE, &val_size) != NO_ERROR)
+	{
+	  pr_clear_value (&value);
+	  return false;
+	}
+      pr_clear_value (&value);
+
+      QFILE_PUT_TUPLE_LENGTH (get (), QFILE_TUPLE_LENGTH_SIZE + val_size);
+      QFILE_PUT_PREV_TUPLE_LENGTH (get (), 0);
+      return true;
+    }
+
+    QFILE_TUPLE get ()
+    {
+      return m_buffer.data ();
+    }
+
+  private:
+    std::vector<char> m_buffer;
+};
+
+/* a single column hash key which owns its value */
+class one_column_key
+{
+  public:
+    one_column_key ()
+    {
+      db_make_null (&m_value);
+      m_values[0] = &m_value;
+      m_key.val_count = 1;
+      m_key.free_values = false;
+      m_key.values = m_values;
+    }
+
+    ~one_column_key ()
+    {
+      pr_clear_value (&m_value);
+    }
+
+    HASH_SCAN_KEY *get ()
+    {
+      return &m_key;
+    }
+
+  private:
+    DB_VALUE m_value;
+    DB_VALUE *m_values[1];
+    HASH_SCAN_KEY m_key;
+};
+
+static const unsigned int HT_SIZE = 1024;
+
+static bool
+test_numeric_scale (void)
+{
+  TP_DOMAIN *outer_domp = tp_domain_resolve (DB_TYPE_NUMERIC, NULL, 10, 2, NULL, 0);
+  TP_DOMAIN *inner_domp = tp_domain_resolve (DB_TYPE_NUMERIC, NULL, 12, 4, NULL, 0);
+  TP_DOMAIN *coerce_domp[1];
+  int col_ind[1] = { 0 };
+  one_column_tuple outer_tpl, inner_tpl;
+  one_column_key outer_key, inner_key;
+  bool is_unmatched;
+
+  CHECK (outer_domp != NULL && inner_domp != NULL);
+
+  /* the types are the same, but the scales are not, so the inner values must be coerced */
+  CHECK (TP_DOMAIN_TYPE (outer_domp) == TP_DOMAIN_TYPE (inner_domp));
+  CHECK (!tp_domain_match (outer_domp, inner_domp, TP_EXACT_MATCH));
+  coerce_domp[0] = outer_domp;
+
+  CHECK (outer_tpl.set ("1.50", outer_domp));
+  CHECK (qdata_build_hscan_key_from_tuple (outer_tpl.get (), col_ind, &outer_domp, NULL, outer_key.get (),
+	 &is_unmatched) == NO_ERROR);
+  CHECK (!is_unmatched);
+
+  /* equal value, other scale */
+  CHECK (inner_tpl.set ("1.5000", inner_domp));
+  CHECK (qdata_build_hscan_key_from_tuple (inner_tpl.get (), col_ind, &inner_domp, coerce_domp, inner_key.get (),
+	 &is_unmatched) == NO_ERROR);
+  CHECK (!is_unmatched);
+  CHECK (qdata_hash_scan_key (outer_key.get (), HT_SIZE) == qdata_hash_scan_key (inner_key.get (), HT_SIZE));
+  CHECK (qdata_hscan_key_eq (outer_key.get (), inner_key.get ()));
+
+  /* different value */
+  CHECK (inner_tpl.set ("2.2500", inner_domp));
+  CHECK (qdata_build_hscan_key_from_tuple (inner_tpl.get (), col_ind, &inner_domp, coerce_domp, inner_key.get (),
+	 &is_unmatched) == NO_ERROR);
+  CHECK (!is_unmatched);
+  CHECK (!qdata_hscan_key_eq (outer_key.get (), inner_key.get ()));
+
+  /* the value rounds to 100000000.00, which does not fit NUMERIC(10,2): no match, and no error */
+  CHECK (inner_tpl.set ("99999999.9999", inner_domp));
+  CHECK (qdata_build_hscan_key_from_tuple (inner_tpl.get (), col_ind, &inner_domp, coerce_domp, inner_key.get (),
+	 &is_unmatched) == NO_ERROR);
+  CHECK (is_unmatched);
+
+  return true;
+}
+
+int
+main (int, char **)
+{
+  int failed = 0;
+
+  lang_init ();
+  tp_init ();
+  lang_set_charset_lang ("en_US.iso88591");
+
+  std::cout << "  NUMERIC(10,2) joined to NUMERIC(12,4)" << std::endl;
+  if (!test_numeric_scale ())
+    {
+      failed++;
+    }
+
+  std::cout << (failed == 0 ? "  passed" : "  failed") << std::endl;
+  return failed == 0 ? 0 : 1;
+}
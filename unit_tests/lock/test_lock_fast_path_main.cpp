@@ -0,0 +1,294 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * test_lock_fast_path_main.cpp - check the fast path intention locks of the lock manager.
+ *
+ *  usage:
+ *      test_lock_fast_path
+ *
+ *  the test defines a transaction table, which initializes the real lock manager and its deadlock detection daemon, and
+ *  assigns two transactions. no volume is needed; locks are requested on made up OIDs. it checks that:
+ *    - a strong class lock request conflicts with an intention lock held on the fast path by another transaction;
+ *    - the strong request moves that lock to the lock table with its request count and its instance locks;
+ *    - instance locks taken under a fast path class lock are escalated at the lock escalation threshold;
+ *    - a deadlock between fast path holders is detected and one of them is chosen as victim.
+ *
+ *  the process exits with 1 if any check fails.
+ */
+
+#include "critical_section.h"
+#include "error_manager.h"
+#include "lock_manager.h"
+#include "log_impl.h"
+#include "oid.h"
+#include "page_buffer.h"
+#include "system_parameter.h"
+#include "thread_entry.hpp"
+#include "thread_entry_task.hpp"
+#include "thread_manager.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+static const int ESCALATION_AT = 8;
+static const int DEADLOCK_WAIT_SECONDS = 60;
+
+static OID test_Root_oid = { 10, 0, 0 };
+
+static bool
+check (bool condition, const char *what)
+{
+  if (!condition)
+    {
+      std::cout << "    check failed: " << what << std::endl;
+    }
+  return condition;
+}
+
+static OID
+make_oid (int pageid, int slotid)
+{
+  OID oid;
+
+  oid.volid = 0;
+  oid.pageid = pageid;
+  oid.slotid = slotid;
+  return oid;
+}
+
+// lock an instance with X_LOCK; its class gets IX_LOCK
+static int
+lock_instance (THREAD_ENTRY *thread_p, int tran_index, const OID &class_oid, int slotid)
+{
+  OID inst_oid = make_oid (class_oid.pageid + 1, slotid);
+
+  LOG_SET_CURRENT_TRAN_INDEX (thread_p, tran_index);
+  return lock_object (thread_p, &inst_oid, &class_oid, X_LOCK, LK_UNCOND_LOCK);
+}
+
+static void
+unlock_tran (THREAD_ENTRY *thread_p, int tran_index)
+{
+  LOG_SET_CURRENT_TRAN_INDEX (thread_p, tran_index);
+  lock_unlock_all (thread_p);
+}
+
+static bool
+test_strong_conflict (THREAD_ENTRY *thread_p, int tran1, int tran2)
+{
+  OID class_oid = make_oid (100, 1);
+  LK_ENTRY *class_entry;
+  bool success = true;
+
+  success = check (lock_instance (thread_p, tran1, class_oid, 1) == LK_GRANTED, "tran1 locks an instance") && success;
+  success = check (lock_instance (thread_p, tran1, class_oid, 2) == LK_GRANTED, "tran1 locks an instance") && success;
+  success = check (lock_get_class_lock (thread_p, &class_oid) == NULL, "the class lock is on the fast path")
+	    && success;
+  success = check (lock_get_object_lock (&class_oid, oid_Root_class_oid) == IX_LOCK, "tran1 holds IX_LOCK")
+	    && success;
+
+  // S_LOCK conflicts with IX_LOCK; it moves the lock of tran1 to the lock table and does not wait
+  LOG_SET_CURRENT_TRAN_INDEX (thread_p, tran2);
+  success = check (lock_object (thread_p, &class_oid, oid_Root_class_oid, S_LOCK, LK_COND_LOCK) != LK_GRANTED,
+		   "S_LOCK of tran2 conflicts with the fast path IX_LOCK") && success;
+
+  LOG_SET_CURRENT_TRAN_INDEX (thread_p, tran1);
+  class_entry = lock_get_class_lock (thread_p, &class_oid);
+  success = check (class_entry != NULL, "the lock of tran1 was moved to the lock table") && success;
+  if (class_entry != NULL)
+    {
+      success = check (class_entry->granted_mode == IX_LOCK, "moved lock: IX_LOCK") && success;
+      success = check (class_entry->count == 2, "moved lock: request count") && success;
+      success = check (class_entry->ngranules == 2, "moved lock: instance locks are its granules") && success;
+    }
+
+  // the class lock of tran1 stays in the lock table; the next instance lock is counted on it
+  success = check (lock_instance (thread_p, tran1, class_oid, 3) == LK_GRANTED, "tran1 locks one more instance")
+	    && success;
+  class_entry = lock_get_class_lock (thread_p, &class_oid);
+  success = check (class_entry != NULL && class_entry->ngranules == 3, "moved lock: granules are counted")
+	    && success;
+
+  unlock_tran (thread_p, tran1);
+
+  LOG_SET_CURRENT_TRAN_INDEX (thread_p, tran2);
+  success = check (lock_object (thread_p, &class_oid, oid_Root_class_oid, S_LOCK, LK_COND_LOCK) == LK_GRANTED,
+		   "S_LOCK of tran2 is granted once tran1 released its locks") && success;
+  unlock_tran (thread_p, tran2);
+
+  return success;
+}
+
+static bool
+test_escalation (THREAD_ENTRY *thread_p, int tran1)
+{
+  OID class_oid = make_oid (200, 1);
+  bool success = true;
+  int slotid;
+
+  // the class lock leaves the fast path at the threshold; the request after it is escalated
+  for (slotid = 1; slotid <= ESCALATION_AT + 1 && success; slotid++)
+    {
+      success = check (lock_instance (thread_p, tran1, class_oid, slotid) == LK_GRANTED, "tran1 locks an instance");
+    }
+
+  LOG_SET_CURRENT_TRAN_INDEX (thread_p, tran1);
+  success = check (lock_get_object_lock (&class_oid, oid_Root_class_oid) == X_LOCK, "instance locks are escalated")
+	    && success;
+
+  unlock_tran (thread_p, tran1);
+  return success;
+}
+
+static bool
+test_deadlock (THREAD_ENTRY *thread_p, int tran1, int tran2)
+{
+  OID class1_oid = make_oid (300, 1);
+  OID class2_oid = make_oid (400, 1);
+  std::atomic<int> granted_count (0);
+  std::atomic<int> aborted_count (0);
+  std::atomic<int> done_count (0);
+  bool success = true;
+
+  // each transaction holds IX_LOCK on the fast path on one class and requests S_LOCK on the other
+  success = check (lock_instance (thread_p, tran1, class1_oid, 1) == LK_GRANTED, "tran1 locks an instance") && success;
+  success = check (lock_instance (thread_p, tran2, class2_oid, 1) == LK_GRANTED, "tran2 locks an instance") && success;
+  if (!success)
+    {
+      unlock_tran (thread_p, tran1);
+      unlock_tran (thread_p, tran2);
+      return false;
+    }
+
+  cubthread::entry_workpool *workpool =
+	  cubthread::get_manager ()->create_worker_pool (2, 2, "lock fast path test", NULL, 1, false);
+  if (workpool == NULL)
+    {
+      std::cout << "    cannot create worker pool" << std::endl;
+      unlock_tran (thread_p, tran1);
+      unlock_tran (thread_p, tran2);
+      return false;
+    }
+
+  auto request_strong = [&] (cubthread::entry &context, int tran_index, const OID &class_oid)
+  {
+    LOG_SET_CURRENT_TRAN_INDEX (&context, tran_index);
+    int granted = lock_object (&context, &class_oid, oid_Root_class_oid, S_LOCK, LK_UNCOND_LOCK);
+    if (granted == LK_GRANTED)
+      {
+	++granted_count;
+      }
+    else if (granted == LK_NOTGRANTED_DUE_ABORTED)
+      {
+	++aborted_count;
+      }
+    // the victim releases its locks, so the other request is granted
+    lock_unlock_all (&context);
+    ++done_count;
+  };
+
+  cubthread::get_manager ()->push_task (workpool, new cubthread::entry_callable_task (
+      std::bind (request_strong, std::placeholders::_1, tran1, class2_oid)));
+  cubthread::get_manager ()->push_task (workpool, new cubthread::entry_callable_task (
+      std::bind (request_strong, std::placeholders::_1, tran2, class1_oid)));
+
+  for (int i = 0; i < DEADLOCK_WAIT_SECONDS * 10 && done_count < 2; i++)
+    {
+      std::this_thread::sleep_for (std::chrono::milliseconds (100));
+    }
+
+  success = check (done_count == 2, "the deadlock is resolved") && success;
+  if (done_count == 2)
+    {
+      success = check (aborted_count == 1, "one transaction is the deadlock victim") && success;
+      success = check (granted_count == 1, "the other transaction is granted") && success;
+      cubthread::get_manager ()->destroy_worker_pool (workpool);
+      lock_clear_deadlock_victim (tran1);
+      lock_clear_deadlock_victim (tran2);
+    }
+  // else the workers are still blocked; the worker pool cannot be destroyed
+
+  return success;
+}
+
+int
+main (int argc, char **argv)
+{
+  THREAD_ENTRY *thread_p = NULL;
+  int tran1, tran2;
+  int failed = 0;
+
+  er_init (NULL, ER_NEVER_EXIT);
+  cubthread::initialize (thread_p);
+  if (cubthread::initialize_thread_entries () != NO_ERROR)
+    {
+      std::cout << "cannot initialize thread entries" << std::endl;
+      return 1;
+    }
+  if (csect_initialize_static_critical_sections () != NO_ERROR)
+    {
+      std::cout << "cannot initialize critical sections" << std::endl;
+      return 1;
+    }
+
+  oid_set_root (&test_Root_oid);
+  prm_set_bool_value (PRM_ID_LK_FAST_PATH_INTENTION_LOCKS, true);
+  prm_set_integer_value (PRM_ID_LK_ESCALATION_AT, ESCALATION_AT);
+  // pages are not read; do not ask the disk manager whether they are allocated
+  prm_set_integer_value (PRM_ID_PB_DEBUG_PAGE_VALIDATION_LEVEL, PGBUF_DEBUG_NO_PAGE_VALIDATION);
+
+  // also initializes the lock manager
+  logtb_define_trantable (thread_p, 4, 0);
+
+  tran1 = logtb_assign_tran_index (thread_p, NULL_TRANID, TRAN_ACTIVE, NULL, NULL, TRAN_LOCK_INFINITE_WAIT,
+				   TRAN_REP_READ);
+  tran2 = logtb_assign_tran_index (thread_p, NULL_TRANID, TRAN_ACTIVE, NULL, NULL, TRAN_LOCK_INFINITE_WAIT,
+				   TRAN_REP_READ);
+  if (tran1 == NULL_TRAN_INDEX || tran2 == NULL_TRAN_INDEX)
+    {
+      std::cout << "cannot assign transactions" << std::endl;
+      return 1;
+    }
+
+  std::cout << "strong lock conflict" << std::endl;
+  if (!test_strong_conflict (thread_p, tran1, tran2))
+    {
+      failed++;
+    }
+  std::cout << "lock escalation from the fast path" << std::endl;
+  if (!test_escalation (thread_p, tran1))
+    {
+      failed++;
+    }
+  std::cout << "deadlock between fast path holders" << std::endl;
+  if (!test_deadlock (thread_p, tran1, tran2))
+    {
+      failed++;
+    }
+
+  if (failed > 0)
+    {
+      std::cout << "test failed" << std::endl;
+      return 1;
+    }
+  std::cout << "test successful" << std::endl;
+  return 0;
+}
@@ -0,0 +1,299 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * test_query_arena.cpp - check the arena of the private allocator and measure the share of the allocator in the
+ *                        execution of short queries, with and without the arena.
+ *
+ *  a short query is modelled by the allocations of a primary key lookup: the scan is opened (attribute info, value
+ *  arrays, key and record buffers), each fetched row allocates values that are cleared before the next row, and
+ *  everything left is freed when the XASL is cleared. "no allocator" runs the same steps on memory that was carved
+ *  beforehand; the difference to it is the time spent in the allocator.
+ */
+
+#include "test_query_arena.hpp"
+
+#include "test_memory_alloc_helper.hpp"
+#include "test_timers.hpp"
+
+#include "memory_alloc.h"
+#include "memory_arena.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+namespace test_memalloc
+{
+  static const std::size_t OPEN_SIZES[] = { 24, 40, 48, 64, 64, 96, 128, 128, 160, 256, 256, 512, 1024, 2048 };
+  static const std::size_t ROW_SIZES[] = { 16, 24, 32, 40, 48, 64, 96, 128 };
+  static const std::size_t OPEN_COUNT = sizeof (OPEN_SIZES) / sizeof (OPEN_SIZES[0]);
+  static const std::size_t ROW_COUNT = sizeof (ROW_SIZES) / sizeof (ROW_SIZES[0]);
+  static const std::size_t ROWS_PER_QUERY = 4;
+  static const std::size_t QUERY_ARENA_SIZE = 1024 * 1024;
+
+#define ARENA_CHECK(cond) \
+  do { \
+    if (!(cond)) \
+      { \
+	std::cout << "    check failed at line " << __LINE__ << ": " << #cond << std::endl; \
+	return 1; \
+      } \
+  } while (false)
+
+  static bool
+  is_aligned (const void *ptr)
+  {
+    return ((std::uintptr_t) ptr % cubmem::arena::ALIGNMENT) == 0;
+  }
+
+  /* check the arena by itself */
+  static int
+  test_arena_frames (void)
+  {
+    cubmem::arena arena;
+    const std::size_t limit = 256 * 1024;
+    char *p1, *p2, *p3, *p4;
+
+    arena.push_frame (limit);
+
+    p1 = (char *) arena.allocate (100);
+    p2 = (char *) arena.allocate (10);
+    ARENA_CHECK (p1 != NULL && p2 != NULL && is_aligned (p1) && is_aligned (p2));
+    ARENA_CHECK (p2 >= p1 + 100 && arena.contains (p1) && arena.contains (p2));
+    ARENA_CHECK (!arena.contains (&arena));
+
+    /* only the most recent allocation is given back */
+    arena.deallocate (p1);
+    arena.deallocate (p2);
+    p3 = (char *) arena.allocate (10);
+    ARENA_CHECK (p3 == p2);
+
+    /* the most recent allocation grows in place; another one is copied */
+    std::memset (p3, 'a', 10);
+    ARENA_CHECK (arena.reallocate (p3, 1000) == p3);
+    std::memset (p1, 'b', 100);
+    p4 = (char *) arena.reallocate (p1, 2000);
+    ARENA_CHECK (p4 != NULL && p4 != p1 && p4[0] == 'b' && p4[99] == 'b');
+
+    /* large requests are left to the caller */
+    ARENA_CHECK (arena.allocate (cubmem::arena::MAX_ALLOCATION_SIZE + 1) == NULL);
+
+    /* a nested frame gives back only its own memory */
+    arena.push_frame (0);
+    for (int i = 0; i < 20; i++)
+      {
+	ARENA_CHECK (arena.allocate (cubmem::arena::MAX_ALLOCATION_SIZE) != NULL);
+      }
+    ARENA_CHECK (arena.get_reserved_size () > cubmem::arena::FIRST_CHUNK_SIZE);
+    arena.pop_frame ();
+    ARENA_CHECK (arena.contains (p4) && arena.get_reserved_size () == cubmem::arena::FIRST_CHUNK_SIZE);
+    ARENA_CHECK (arena.allocate (10) == p4 + 2000);
+
+    /* never more than the limit */
+    while (arena.allocate (1000) != NULL)
+      {
+      }
+    ARENA_CHECK (arena.get_reserved_size () <= limit);
+
+    arena.pop_frame ();
+    ARENA_CHECK (!arena.has_frame () && arena.get_reserved_size () == cubmem::arena::FIRST_CHUNK_SIZE);
+
+    return 0;
+  }
+
+  /* check db_private_alloc with the thread arena */
+  static int
+  test_private_arena (void)
+  {
+    custom_thread_entry cte;
+    THREAD_ENTRY *thread_p = cte.get_thread_entry ();
+    char *before, *small, *moved, *large;
+
+    ARENA_CHECK (!db_private_arena_push (thread_p, 0));
+
+    before = (char *) db_private_alloc (thread_p, 64);
+    ARENA_CHECK (before != NULL);
+
+    ARENA_CHECK (db_private_arena_push (thread_p, QUERY_ARENA_SIZE));
+
+    small = (char *) db_private_alloc (thread_p, 64);
+    large = (char *) db_private_alloc (thread_p, 64 * 1024);
+    ARENA_CHECK (small != NULL && thread_p->private_arena.contains (small));
+    ARENA_CHECK (large != NULL && !thread_p->private_arena.contains (large));
+
+    /* memory allocated before the frame still belongs to the private heap */
+    ARENA_CHECK (!thread_p->private_arena.contains (before));
+    db_private_free_and_init (thread_p, before);
+
+    /* growing beyond what the arena takes moves the memory to the private heap */
+    std::memset (small, 'c', 64);
+    moved = (char *) db_private_realloc (thread_p, small, 64 * 1024);
+    ARENA_CHECK (moved != NULL && !thread_p->private_arena.contains (moved) && moved[0] == 'c' && moved[63] == 'c');
+
+    small = (char *) db_private_alloc (thread_p, 128);
+    db_private_free (thread_p, small);
+
+    db_private_free (thread_p, moved);
+    db_private_free (thread_p, large);
+
+    db_private_arena_pop (thread_p);
+    ARENA_CHECK (!thread_p->private_arena.has_frame ());
+
+    return 0;
+  }
+
+  /* model of a short query; alloc_f and free_f are the allocator */
+  template <typename AllocFunc, typename FreeFunc>
+  static void
+  run_short_query (AllocFunc &&alloc_f, FreeFunc &&free_f)
+  {
+    char *open_ptrs[OPEN_COUNT];
+    char *row_ptrs[ROW_COUNT];
+
+    /* open the scan */
+    for (std::size_t i = 0; i < OPEN_COUNT; i++)
+      {
+	open_ptrs[i] = alloc_f (OPEN_SIZES[i]);
+	std::memset (open_ptrs[i], 0, OPEN_SIZES[i]);
+      }
+
+    /* fetch and evaluate the rows; values are cleared before the next row */
+    for (std::size_t row = 0; row < ROWS_PER_QUERY; row++)
+      {
+	for (std::size_t i = 0; i < ROW_COUNT; i++)
+	  {
+	    row_ptrs[i] = alloc_f (ROW_SIZES[i]);
+	    std::memcpy (row_ptrs[i], open_ptrs[OPEN_COUNT - 1], ROW_SIZES[i]);
+	  }
+	for (std::size_t i = 0; i < ROW_COUNT; i++)
+	  {
+	    free_f (row_ptrs[i]);
+	  }
+      }
+
+    /* clear the XASL */
+    for (std::size_t i = 0; i < OPEN_COUNT; i++)
+      {
+	free_f (open_ptrs[i]);
+      }
+  }
+
+  static void
+  print_time (const char *name, std::size_t query_count, long long usec, long long base_usec)
+  {
+    double per_query = (double) usec * 1000 / query_count;
+    double share = usec > 0 ? (double) (usec - base_usec) * 100 / usec : 0;
+
+    std::cout << "    " << std::left << std::setw (16) << name << std::right << std::setw (10) << std::fixed
+	      << std::setprecision (1) << per_query << " nsec/query";
+    if (usec != base_usec)
+      {
+	std::cout << ", allocator " << std::setw (5) << std::setprecision (1) << share << "%";
+      }
+    std::cout << std::endl;
+  }
+
+  /* measure the allocator time of short queries with the private heap alone and with the arena */
+  static int
+  test_short_query_performance (std::size_t query_count)
+  {
+    custom_thread_entry cte;
+    THREAD_ENTRY *thread_p = cte.get_thread_entry ();
+    test_common::us_timer timer;
+    long long base_usec, heap_usec, arena_usec;
+    std::vector<char> carved (QUERY_ARENA_SIZE);
+    std::size_t carved_top;
+
+    auto private_alloc = [thread_p] (std::size_t size)
+    {
+      return (char *) db_private_alloc (thread_p, size);
+    };
+    auto private_free = [thread_p] (char *ptr)
+    {
+      db_private_free (thread_p, ptr);
+    };
+
+    std::cout << "    " << query_count << " queries of " << OPEN_COUNT << " + " << ROWS_PER_QUERY << " x "
+	      << ROW_COUNT << " allocations" << std::endl;
+
+    /* no allocator: same steps on memory carved beforehand */
+    timer.reset ();
+    for (std::size_t q = 0; q < query_count; q++)
+      {
+	carved_top = 0;
+	run_short_query ([&carved, &carved_top] (std::size_t size)
+	{
+	  char *ptr = carved.data () + carved_top;
+	  carved_top += size;
+	  return ptr;
+	}, [] (char *)
+	{
+	});
+      }
+    base_usec = timer.time_and_reset ().count ();
+
+    /* private heap alone */
+    for (std::size_t q = 0; q < query_count; q++)
+      {
+	run_short_query (private_alloc, private_free);
+      }
+    heap_usec = timer.time_and_reset ().count ();
+
+    /* private heap with the arena, pushed and popped for each query like qexec_execute_query does */
+    for (std::size_t q = 0; q < query_count; q++)
+      {
+	(void) db_private_arena_push (thread_p, QUERY_ARENA_SIZE);
+	run_short_query (private_alloc, private_free);
+	db_private_arena_pop (thread_p);
+      }
+    arena_usec = timer.time_and_reset ().count ();
+
+    print_time ("no allocator", query_count, base_usec, base_usec);
+    print_time ("private heap", query_count, heap_usec, base_usec);
+    print_time ("query arena", query_count, arena_usec, base_usec);
+
+    if (arena_usec > heap_usec)
+      {
+	std::cout << "    warning: the arena was slower than the private heap" << std::endl;
+      }
+
+    return 0;
+  }
+
+  /* main for test_query_arena function */
+  int
+  test_query_arena ()
+  {
+    std::cout << PORTABLE_FUNC_NAME << std::endl;
+
+    int global_err = 0;
+
+    run_test (global_err, test_arena_frames);
+    run_test (global_err, test_private_arena);
+    run_test (global_err, test_short_query_performance, SIZE_ONE_K * 100);
+
+    std::cout << std::endl;
+
+    return global_err;
+  }
+
+#undef ARENA_CHECK
+}  // namespace test_memalloc
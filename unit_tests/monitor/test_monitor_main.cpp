@@ -17,6 +17,7 @@
  */
 
 #include "monitor_collect.hpp"
+#include "monitor_histogram.hpp"
 #include "monitor_registration.hpp"
 #include "monitor_transaction.hpp"
 #include "thread_manager.hpp"
@@ -29,6 +30,7 @@
 
 static void test_single_statistics_no_concurrency (void);
 static void test_multithread_accumulation (void);
+static void test_histogram (void);
 static void test_transaction (void);
 static void test_registration (void);
 static void test_collect (void);
@@ -39,6 +41,7 @@ main (int, char **)
 {
   test_single_statistics_no_concurrency ();
   test_multithread_accumulation ();
+  test_histogram ();
   test_transaction ();
   test_registration ();
   test_collect ();
@@ -288,6 +291,75 @@ test_multithread_accumulation (void)
   std::cout << "test_multithread_accumulation passed" << std::endl;
 }
 
+//////////////////////////////////////////////////////////////////////////
+// test_histogram
+//////////////////////////////////////////////////////////////////////////
+
+static void
+test_histogram_task (cubmonitor::histogram_atomic_statistic &histo)
+{
+  using namespace cubmonitor;
+  for (amount_rep amount = 1; amount <= 1000; amount++)
+    {
+      histo.collect (amount);
+    }
+}
+
+static void
+test_histogram (void)
+{
+  using namespace cubmonitor;
+  using histogram_type = histogram_atomic_statistic;
+
+  // every value is in a bucket that represents it with an error of at most 1 / SUB_BUCKET_COUNT
+  std::size_t prev_index = 0;
+  for (amount_rep value = 0; value < 1000000; value++)
+    {
+      std::size_t index = histogram_type::get_bucket_index (value);
+      amount_rep bucket_value = histogram_type::get_bucket_value (index);
+
+      assert (index < histogram_type::BUCKET_COUNT);
+      assert (index == prev_index || index == prev_index + 1);
+      assert (bucket_value >= value);
+      assert ((bucket_value - value) * histogram_type::SUB_BUCKET_COUNT <= value);
+      prev_index = index;
+    }
+  assert (histogram_type::get_bucket_index (histogram_type::MAX_VALUE) == histogram_type::BUCKET_COUNT - 1);
+  assert (histogram_type::get_bucket_index (histogram_type::MAX_VALUE + 1) == histogram_type::BUCKET_COUNT - 1);
+  assert (histogram_type::get_bucket_value (histogram_type::BUCKET_COUNT - 1) == histogram_type::MAX_VALUE);
+
+  const std::size_t THREAD_COUNT = 20;
+  histogram_type *histo = new histogram_type ();
+  statistic_value *buckets = new statistic_value[histogram_type::BUCKET_COUNT];
+
+  histo->fetch (buckets);
+  assert (histogram_type::get_total_count (buckets) == 0);
+  assert (histogram_type::get_percentile (buckets, 99.0) == 0);
+
+  execute_multi_thread (THREAD_COUNT, test_histogram_task, std::ref (*histo));
+
+  // every thread collected values 1 to 1000
+  histo->fetch (buckets);
+  assert (histogram_type::get_total_count (buckets) == THREAD_COUNT * 1000);
+  assert (histo->get_max () == 1000);
+
+  amount_rep p50 = histogram_type::get_percentile (buckets, 50.0);
+  amount_rep p99 = histogram_type::get_percentile (buckets, 99.0);
+  assert (p50 >= 500 && p50 <= 500 + 500 / histogram_type::SUB_BUCKET_COUNT);
+  assert (p99 >= 990 && p99 <= 990 + 990 / histogram_type::SUB_BUCKET_COUNT);
+  assert (histogram_type::get_percentile (buckets, 100.0) >= 1000);
+  assert (histogram_type::get_percentile (buckets, 0.0) == 1);
+
+  // time is collected as microseconds
+  histo->collect (std::chrono::milliseconds (5));
+  assert (histo->get_max () == 5000);
+
+  delete [] buckets;
+  delete histo;
+
+  std::cout << "test_histogram passed" << std::endl;
+}
+
 //////////////////////////////////////////////////////////////////////////
 // test_transaction
 //////////////////////////////////////////////////////////////////////////
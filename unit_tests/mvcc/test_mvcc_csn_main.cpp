@@ -0,0 +1,219 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * test_mvcc_csn_main.cpp - check the commit sequence number ring of the MVCC table.
+ *
+ *  usage:
+ *      test_mvcc_csn
+ *
+ *  the test runs a real mvcctable with mvcc_csn_snapshot=yes. a first MVCCID is kept active, so that the oldest
+ *  visible MVCCID cannot advance and the slots of the ring are not reused. it checks that:
+ *    - MVCCIDs whose slot is still in use wrap around into overflow and are seen the same as the ones in the ring;
+ *    - slots are reused once the oldest visible MVCCID advances;
+ *    - when overflow is full too, snapshots copy the bit area, and older snapshots still see MVCCIDs without a commit
+ *      sequence number as active.
+ *
+ *  the process exits with 1 if any check fails.
+ */
+
+#include "error_manager.h"
+#include "log_impl.h"
+#include "mvcc_table.hpp"
+#include "system_parameter.h"
+#include "thread_entry.hpp"
+#include "thread_manager.hpp"
+
+#include <iostream>
+
+static const int TRAN_INDEX = 0;
+
+static bool
+check (bool condition, const char *what)
+{
+  if (!condition)
+    {
+      std::cout << "    check failed: " << what << std::endl;
+    }
+  return condition;
+}
+
+static MVCCID
+complete_new_mvccids (mvcctable &table, size_t count)
+{
+  MVCCID mvccid = MVCCID_NULL;
+
+  for (size_t i = 0; i < count; i++)
+    {
+      mvccid = table.get_new_mvccid ();
+      table.complete_mvcc (TRAN_INDEX, mvccid, false);
+    }
+  return mvccid;
+}
+
+static void
+start_table (mvcctable &table)
+{
+  log_Gl.hdr.mvcc_next_id = MVCCID_FIRST;
+  table.initialize ();
+}
+
+static bool
+test_wrap_around ()
+{
+  mvcctable table;
+  bool success = true;
+
+  start_table (table);
+  success = check (table.is_csn_enabled (), "csn snapshots are enabled") && success;
+  if (!success)
+    {
+      table.finalize ();
+      return false;
+    }
+
+  MVCCID old_mvccid = table.get_new_mvccid ();
+  table.update_global_oldest_visible ();
+  MVCC_CSN first_csn = table.get_csn_snapshot (old_mvccid);
+
+  // all slots but the one of old_mvccid
+  MVCCID first_in_ring = table.get_new_mvccid ();
+  table.complete_mvcc (TRAN_INDEX, first_in_ring, false);
+  complete_new_mvccids (table, mvcctable::CSN_MAP_SIZE - 2);
+  MVCC_CSN ring_csn = table.get_csn_snapshot (old_mvccid);
+
+  success = check (first_csn != MVCC_CSN_NULL && ring_csn != MVCC_CSN_NULL, "snapshots have a csn") && success;
+  success = check (!table.is_completed_in_csn_snapshot (first_in_ring, first_csn), "ring: active in older snapshot")
+	    && success;
+  success = check (table.is_completed_in_csn_snapshot (first_in_ring, ring_csn), "ring: completed in snapshot")
+	    && success;
+  success = check (!table.is_completed_in_csn_snapshot (old_mvccid, ring_csn), "ring: active transaction")
+	    && success;
+
+  // the slot of old_mvccid is in use; the next MVCCID goes to overflow
+  MVCCID wrapped = table.get_new_mvccid ();
+  success = check (!table.is_completed_in_csn_snapshot (wrapped, ring_csn), "overflow: active before completion")
+	    && success;
+  table.complete_mvcc (TRAN_INDEX, wrapped, false);
+  MVCC_CSN wrapped_csn = table.get_csn_snapshot (old_mvccid);
+  success = check (!table.is_completed_in_csn_snapshot (wrapped, ring_csn), "overflow: active in older snapshot")
+	    && success;
+  success = check (table.is_completed_in_csn_snapshot (wrapped, wrapped_csn), "overflow: completed in snapshot")
+	    && success;
+  success = check (!table.is_completed_in_csn_snapshot (old_mvccid, wrapped_csn), "overflow: active transaction")
+	    && success;
+
+  // once old_mvccid completes, the oldest visible MVCCID advances and slots are reused
+  table.complete_mvcc (TRAN_INDEX, old_mvccid, false);
+  MVCCID oldest_visible = table.update_global_oldest_visible ();
+  success = check (MVCC_ID_PRECEDES (wrapped, oldest_visible), "oldest visible advanced") && success;
+
+  MVCC_CSN reuse_csn = table.get_csn_snapshot (oldest_visible);
+  MVCCID reused = table.get_new_mvccid ();
+  success = check (!table.is_completed_in_csn_snapshot (reused, reuse_csn), "reused slot: active before completion")
+	    && success;
+  table.complete_mvcc (TRAN_INDEX, reused, false);
+  success = check (!table.is_completed_in_csn_snapshot (reused, reuse_csn), "reused slot: active in older snapshot")
+	    && success;
+  success = check (table.is_completed_in_csn_snapshot (reused, table.get_csn_snapshot (oldest_visible)),
+		   "reused slot: completed in snapshot") && success;
+  success = check (table.is_completed_in_csn_snapshot (wrapped, reuse_csn), "pruned overflow: completed long ago")
+	    && success;
+
+  table.finalize ();
+  return success;
+}
+
+static bool
+test_overflow_full ()
+{
+  mvcctable table;
+  bool success = true;
+
+  start_table (table);
+
+  MVCCID old_mvccid = table.get_new_mvccid ();
+  table.update_global_oldest_visible ();
+
+  // fill the ring, then overflow
+  complete_new_mvccids (table, mvcctable::CSN_MAP_SIZE - 1 + mvcctable::CSN_OVERFLOW_MAX_SIZE);
+  MVCC_CSN full_csn = table.get_csn_snapshot (old_mvccid);
+  success = check (full_csn != MVCC_CSN_NULL, "full overflow: snapshot has a csn") && success;
+
+  MVCCID unrecorded = table.get_new_mvccid ();
+  success = check (table.get_csn_snapshot (old_mvccid) == MVCC_CSN_NULL, "unrecorded: bit area snapshot")
+	    && success;
+  table.complete_mvcc (TRAN_INDEX, unrecorded, false);
+  success = check (table.get_csn_snapshot (old_mvccid) == MVCC_CSN_NULL, "unrecorded: bit area snapshot after "
+		   "completion") && success;
+  success = check (!table.is_completed_in_csn_snapshot (unrecorded, full_csn), "unrecorded: active in older snapshot")
+	    && success;
+
+  // csn snapshots are taken again once the MVCCIDs without a commit sequence number precede the lowest active
+  table.complete_mvcc (TRAN_INDEX, old_mvccid, false);
+  MVCCID oldest_visible = table.update_global_oldest_visible ();
+  MVCC_CSN after_csn = table.get_csn_snapshot (oldest_visible);
+  success = check (MVCC_ID_PRECEDES (unrecorded, oldest_visible), "oldest visible advanced") && success;
+  success = check (after_csn != MVCC_CSN_NULL, "csn snapshot after the saturation") && success;
+  success = check (table.is_completed_in_csn_snapshot (unrecorded, after_csn), "unrecorded: completed long ago")
+	    && success;
+
+  table.finalize ();
+  return success;
+}
+
+int
+main (int argc, char **argv)
+{
+  THREAD_ENTRY *thread_p = NULL;
+  int failed = 0;
+
+  er_init (NULL, ER_NEVER_EXIT);
+  cubthread::initialize (thread_p);
+  if (cubthread::initialize_thread_entries () != NO_ERROR)
+    {
+      std::cout << "cannot initialize thread entries" << std::endl;
+      return 1;
+    }
+
+  // one transaction index is enough; all MVCCIDs are completed by it
+  log_Gl.trantable.num_total_indices = 1;
+  prm_set_bool_value (PRM_ID_MVCC_CSN_SNAPSHOT, true);
+  prm_set_bool_value (PRM_ID_DISABLE_VACUUM, false);
+
+  std::cout << "csn ring wrap around" << std::endl;
+  if (!test_wrap_around ())
+    {
+      failed++;
+    }
+  std::cout << "csn overflow full" << std::endl;
+  if (!test_overflow_full ())
+    {
+      failed++;
+    }
+
+  cubthread::finalize ();
+
+  if (failed > 0)
+    {
+      std::cout << "test failed" << std::endl;
+      return 1;
+    }
+  std::cout << "test successful" << std::endl;
+  return 0;
+}
@@ -0,0 +1,201 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * test_page_replacement_main.cpp - check page buffer victim selection under each page replacement policy.
+ *
+ *  usage:
+ *      test_page_replacement [buffer_pages]
+ *
+ *  the test runs the real page buffer (pgbuf_initialize, pgbuf_fix, pgbuf_unfix) once for each value of
+ *  data_buffer_replacement_policy. no volume is needed: a page that is not in buffer is fixed as NEW_PAGE, so each miss
+ *  claims a bcb and, once the buffer is full, makes page buffer choose a victim.
+ *
+ *  for each policy it checks that:
+ *    - pages hit repeatedly survive a scan four times the size of the buffer, whose pages are fixed twice in a row;
+ *    - the pages of that scan are the ones replaced.
+ *
+ *  the process exits with 1 if any check fails.
+ */
+
+#include "error_manager.h"
+#include "page_buffer.h"
+#include "system_parameter.h"
+#include "thread_entry.hpp"
+#include "thread_manager.hpp"
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+static const int HOT_PASSES = 3;
+static const double MIN_HOT_RETAINED_RATIO = 0.9;
+static const double MIN_SCAN_REPLACED_RATIO = 0.9;
+
+// fix page vpid for read if it is in buffer, otherwise fix it as a new page; returns false on error
+static bool
+access_page (THREAD_ENTRY *thread_p, int pageid, bool &is_hit)
+{
+  VPID vpid;
+  PAGE_PTR page;
+
+  vpid.volid = 0;
+  vpid.pageid = pageid;
+
+  page = pgbuf_fix (thread_p, &vpid, OLD_PAGE_IF_IN_BUFFER, PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH);
+  is_hit = page != NULL;
+  if (page == NULL)
+    {
+      page = pgbuf_fix (thread_p, &vpid, NEW_PAGE, PGBUF_LATCH_WRITE, PGBUF_UNCONDITIONAL_LATCH);
+      if (page == NULL)
+	{
+	  return false;
+	}
+    }
+
+  pgbuf_unfix (thread_p, page);
+  return true;
+}
+
+// count pages of [first_pageid, first_pageid + count) that are in buffer
+static bool
+count_in_buffer (THREAD_ENTRY *thread_p, int first_pageid, int count, int &in_buffer)
+{
+  bool is_hit;
+
+  in_buffer = 0;
+  for (int pageid = first_pageid; pageid < first_pageid + count; pageid++)
+    {
+      if (!access_page (thread_p, pageid, is_hit))
+	{
+	  return false;
+	}
+      in_buffer += is_hit ? 1 : 0;
+    }
+  return true;
+}
+
+static bool
+test_policy (THREAD_ENTRY *thread_p, int policy, int buffer_pages)
+{
+  // hot pages fit in lru zone 1 of each policy; scan pages follow them and are never read again
+  const int hot_count = buffer_pages / 8;
+  const int hot_first = 1;
+  const int scan_count = buffer_pages * 4;
+  const int scan_first = hot_first + hot_count;
+  int hot_retained = 0;
+  int scan_retained = 0;
+  int scan_checked = buffer_pages / 2;
+  bool is_hit;
+  bool success = true;
+
+  prm_set_integer_value (PRM_ID_PB_REPLACEMENT_POLICY, policy);
+  if (pgbuf_initialize () != NO_ERROR)
+    {
+      std::cout << "    pgbuf_initialize failed" << std::endl;
+      return false;
+    }
+
+  for (int pass = 0; pass < HOT_PASSES && success; pass++)
+    {
+      for (int pageid = hot_first; pageid < hot_first + hot_count && success; pageid++)
+	{
+	  success = access_page (thread_p, pageid, is_hit);
+	}
+    }
+
+  // a scan reads each page, and usually fixes it again right away; that second fix must not promote the page
+  for (int pageid = scan_first; pageid < scan_first + scan_count && success; pageid++)
+    {
+      success = access_page (thread_p, pageid, is_hit) && access_page (thread_p, pageid, is_hit);
+    }
+
+  // check the scan pages first; absent pages are not brought back by the check
+  success = success && count_in_buffer (thread_p, scan_first, scan_checked, scan_retained);
+  success = success && count_in_buffer (thread_p, hot_first, hot_count, hot_retained);
+
+  pgbuf_finalize ();
+
+  if (!success)
+    {
+      std::cout << "    failed to fix a page" << std::endl;
+      return false;
+    }
+
+  double hot_retained_ratio = (double) hot_retained / hot_count;
+  double scan_replaced_ratio = 1.0 - (double) scan_retained / scan_checked;
+
+  std::cout << "    policy " << policy << ": hot pages retained " << std::fixed << std::setprecision (3)
+	    << hot_retained_ratio << ", first scan pages replaced " << scan_replaced_ratio << std::endl;
+
+  if (hot_retained_ratio < MIN_HOT_RETAINED_RATIO)
+    {
+      std::cout << "    check failed: the scan replaced hot pages" << std::endl;
+      success = false;
+    }
+  if (scan_replaced_ratio < MIN_SCAN_REPLACED_RATIO)
+    {
+      std::cout << "    check failed: the first scan pages were not replaced" << std::endl;
+      success = false;
+    }
+  return success;
+}
+
+int
+main (int argc, char **argv)
+{
+  THREAD_ENTRY *thread_p = NULL;
+  int buffer_pages = 4096;
+  int failed = 0;
+
+  if (argc > 1)
+    {
+      buffer_pages = std::stoi (argv[1]);
+    }
+
+  er_init (NULL, ER_NEVER_EXIT);
+  cubthread::initialize (thread_p);
+  if (cubthread::initialize_thread_entries () != NO_ERROR)
+    {
+      std::cout << "cannot initialize thread entries" << std::endl;
+      return 1;
+    }
+
+  // pages are fixed without volumes; do not ask the disk manager whether they are allocated
+  prm_set_integer_value (PRM_ID_PB_DEBUG_PAGE_VALIDATION_LEVEL, PGBUF_DEBUG_NO_PAGE_VALIDATION);
+  prm_set_integer_value (PRM_ID_PB_NBUFFERS, buffer_pages);
+
+  std::cout << "page replacement with " << buffer_pages << " buffers" << std::endl;
+  for (int policy = 0; policy <= 1; policy++)
+    {
+      if (!test_policy (thread_p, policy, buffer_pages))
+	{
+	  failed++;
+	}
+    }
+
+  cubthread::finalize ();
+
+  if (failed > 0)
+    {
+      std::cout << "test failed" << std::endl;
+      return 1;
+    }
+  std::cout << "test successful" << std::endl;
+  return 0;
+}
@@ -0,0 +1,354 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * test_regex_dfa_main.cpp - check the results of cubregex::dfa_matcher against std::regex and compare their speed
+ *                           on log search patterns.
+ *
+ *  usage:
+ *      test_regex_dfa [line_count]
+ *
+ *  std::regex is used the way RLIKE uses it: the string is converted to a wide string and searched with
+ *  ECMAScript | nosubs (| icase).
+ */
+
+#include "string_regex_dfa.hpp"
+#include "test_timers.hpp"
+
+#include <cassert>
+#include <codecvt>
+#include <iomanip>
+#include <iostream>
+#include <locale>
+#include <memory>
+#include <random>
+#include <regex>
+#include <string>
+#include <vector>
+
+struct pattern_case
+{
+  std::string m_pattern;
+  bool m_icase;
+  bool m_expect_supported;
+};
+
+static std::locale
+get_utf8_locale ()
+{
+  const char *names[] = { "en_US.UTF-8", "en_US.utf8", "C.UTF-8" };
+
+  for (const char *name : names)
+    {
+      try
+	{
+	  return std::locale (name);
+	}
+      catch (std::runtime_error &)
+	{
+	  // try the next one
+	}
+    }
+  return std::locale::classic ();
+}
+
+static bool
+to_wstring (const std::string &str, std::wstring &wstr)
+{
+  try
+    {
+      wstr = std::wstring_convert<std::codecvt_utf8<wchar_t>, wchar_t> {}.from_bytes (str);
+      return true;
+    }
+  catch (const std::range_error &)
+    {
+      return false;
+    }
+}
+
+static std::regex_constants::syntax_option_type
+get_flags (bool icase)
+{
+  std::regex_constants::syntax_option_type flags = std::regex_constants::ECMAScript | std::regex_constants::nosubs;
+  return icase ? flags | std::regex_constants::icase : flags;
+}
+
+static bool
+std_search (const std::wregex &reg, const std::string &str)
+{
+  std::wstring wstr;
+  return to_wstring (str, wstr) && std::regex_search (wstr, reg);
+}
+
+static std::vector<std::string>
+make_log_lines (std::size_t count)
+{
+  const char *levels[] = { "INFO", "DEBUG", "WARN", "ERROR" };
+  const char *components[] = { "broker", "cub_server", "cub_master", "loaddb", "vacuum" };
+  const char *messages[] =
+  {
+    "connection accepted from 192.168.10.21:33000",
+    "query executed in 12 ms, 100 rows",
+    "lock wait timeout on object 0|512|7",
+    "transaction 4123 aborted: deadlock detected",
+    "checkpoint finished, 2048 pages flushed",
+    "user 'dba' logged in",
+    "request id=87123 status=200 elapsed=0.031s",
+    "r\xc3\xa9plication d\xc3\xa9lai 5 s",
+  };
+  std::mt19937 gen (7);
+  std::vector<std::string> lines;
+
+  lines.reserve (count);
+  for (std::size_t i = 0; i < count; i++)
+    {
+      std::string line = "2021-06-";
+      line += std::to_string (10 + gen () % 20) + " 1" + std::to_string (gen () % 10) + ":"
+	      + std::to_string (10 + gen () % 50) + ":" + std::to_string (10 + gen () % 50) + "."
+	      + std::to_string (100 + gen () % 900) + " ";
+      line += levels[gen () % 4];
+      line += " [";
+      line += components[gen () % 5];
+      line += "] ";
+      line += messages[gen () % 8];
+      lines.push_back (line);
+    }
+  return lines;
+}
+
+static const std::vector<pattern_case> &
+get_log_patterns ()
+{
+  static const std::vector<pattern_case> patterns =
+  {
+    { "ERROR", false, true },
+    { "error", true, true },
+    { "^2021-06-1[0-9] ", false, true },
+    { "(WARN|ERROR) \\[cub_server\\]", false, true },
+    { "deadlock|timeout", false, true },
+    { "\\d+\\.\\d+\\.\\d+\\.\\d+:\\d{2,5}", false, true },
+    { "status=(4|5)\\d\\d", false, true },
+    { "elapsed=[0-9]*\\.[0-9]{3}s$", false, true },
+    { "user '[a-z_]+' logged", true, true },
+    { ".*flushed$", false, true },
+    { "d\xc3\xa9lai [0-9]+ s", false, true },
+    { "transaction [0-9]+ (aborted|committed)", false, true },
+  };
+  return patterns;
+}
+
+// patterns that are checked for correctness only
+static const std::vector<pattern_case> &
+get_syntax_patterns ()
+{
+  static const std::vector<pattern_case> patterns =
+  {
+    { "a", false, true },
+    { "^$", false, true },
+    { "$^", false, true },
+    { "^a|b$", false, true },
+    { "a*", false, true },
+    { "(a|ab)(c|bcd)(d*)", false, true },
+    { "[^a-c]+x", false, true },
+    { "[a-]b", false, true },
+    { "[-a]b", false, true },
+    { "[\\]]", false, true },
+    { "[\\d.]+", false, true },
+    { "[^\\s]+@", false, true },
+    { "\\W", false, true },
+    { "x{2}", false, true },
+    { "x{2,}", false, true },
+    { "x{1,3}y", false, true },
+    { "(?:ab)+c", false, true },
+    { "a+?b", false, true },
+    { "\\x41\\u00e9", false, true },
+    { "[A-Z]b", true, true },
+    { "[^a]", true, true },
+    { "\\.\\*\\\\", false, true },
+    { ".\xc3\xa9.", false, true },
+    { "(a|)+b", false, true },
+    { "((a*)*)*c", false, true },
+    { "(a)\\1", false, false },
+    { "a(?=b)", false, false },
+    { "\\bword\\b", false, false },
+    { "[[:alpha:]]+", false, false },
+    { "\xc3\xa9", true, false },
+    { "a{2,1}", false, false },
+    { "a**", false, false },
+    { "(ab", false, false },
+  };
+  return patterns;
+}
+
+static const std::vector<std::string> &
+get_syntax_subjects ()
+{
+  static const std::vector<std::string> subjects =
+  {
+    "", "a", "b", "ab", "abcd", "xxx", "xy", "xxxxy", "ababc", "aab", "aaac", "c", "A", "Ab", "zzx", "dx",
+    "a-b", "-b", "]", "1.2.3", "foo bar@x", " ", "\n", "\r", "x\n", "A\xc3\xa9", "\xc3\xa9t\xc3\xa9",
+    "a\xc3\xa9" "b", ".*\\", "...", "word", "\xff" "a", "a\xed\xa0\x80", "\x1c", "\xe2\x80\x83" "x",
+  };
+  return subjects;
+}
+
+static bool
+check_pattern (const pattern_case &pc, const std::vector<std::string> &subjects, const std::locale &loc)
+{
+  std::unique_ptr<cubregex::dfa_matcher> matcher (cubregex::dfa_matcher::compile (pc.m_pattern.c_str (),
+      pc.m_pattern.size (), pc.m_icase));
+  if ((matcher != NULL) != pc.m_expect_supported)
+    {
+      std::cerr << "pattern " << pc.m_pattern << (pc.m_expect_supported ? " is not supported" : " is supported")
+		<< std::endl;
+      return false;
+    }
+  if (matcher == NULL)
+    {
+      return true;
+    }
+
+  std::wregex reg;
+  std::wstring wpattern;
+  if (!to_wstring (pc.m_pattern, wpattern))
+    {
+      return false;
+    }
+  reg.imbue (loc);
+  reg.assign (wpattern, get_flags (pc.m_icase));
+
+  for (const std::string &subject : subjects)
+    {
+      cubregex::dfa_matcher::search_result result = matcher->search (subject.c_str (), subject.size ());
+      if (result == cubregex::dfa_matcher::NEED_FALLBACK)
+	{
+	  continue;
+	}
+      if ((result == cubregex::dfa_matcher::MATCH) != std_search (reg, subject))
+	{
+	  std::cerr << "pattern " << pc.m_pattern << (pc.m_icase ? " (icase)" : "") << " on \"" << subject
+		    << "\": dfa " << (result == cubregex::dfa_matcher::MATCH) << ", std::regex " << !result << std::endl;
+	  return false;
+	}
+    }
+  return true;
+}
+
+static void
+compare_speed (const pattern_case &pc, const std::vector<std::string> &lines, const std::locale &loc)
+{
+  test_common::us_timer timer;
+  std::size_t dfa_matches = 0;
+  std::size_t std_matches = 0;
+
+  std::unique_ptr<cubregex::dfa_matcher> matcher (cubregex::dfa_matcher::compile (pc.m_pattern.c_str (),
+      pc.m_pattern.size (), pc.m_icase));
+  assert (matcher != NULL);
+  for (const std::string &line : lines)
+    {
+      cubregex::dfa_matcher::search_result result = matcher->search (line.c_str (), line.size ());
+      dfa_matches += (result == cubregex::dfa_matcher::MATCH) ? 1 : 0;
+    }
+  std::chrono::microseconds dfa_time = timer.time_and_reset ();
+
+  std::wregex reg;
+  std::wstring wpattern;
+  to_wstring (pc.m_pattern, wpattern);
+  reg.imbue (loc);
+  reg.assign (wpattern, get_flags (pc.m_icase));
+  for (const std::string &line : lines)
+    {
+      std_matches += std_search (reg, line) ? 1 : 0;
+    }
+  std::chrono::microseconds std_time = timer.time_and_reset ();
+
+  std::cout << "    " << std::left << std::setw (44) << pc.m_pattern << std::right << std::setw (8) << dfa_matches
+	    << " matches  dfa " << std::setw (9) << dfa_time.count () << " us  std::regex " << std::setw (9)
+	    << std_time.count () << " us" << std::endl;
+
+  // lines with non-ASCII characters go to std::regex for locale sensitive patterns
+  assert (dfa_matches <= std_matches);
+}
+
+static void
+compare_pathological (const std::locale &loc)
+{
+  // catastrophic backtracking for std::regex, a single pass for the dfa
+  pattern_case pc { "(a|aa)*c", false, true };
+  std::string subject (24, 'a');
+  test_common::us_timer timer;
+
+  std::unique_ptr<cubregex::dfa_matcher> matcher (cubregex::dfa_matcher::compile (pc.m_pattern.c_str (),
+      pc.m_pattern.size (), pc.m_icase));
+  assert (matcher != NULL);
+  bool dfa_matched = matcher->search (subject.c_str (), subject.size ()) == cubregex::dfa_matcher::MATCH;
+  std::chrono::microseconds dfa_time = timer.time_and_reset ();
+
+  std::wregex reg;
+  std::wstring wpattern;
+  to_wstring (pc.m_pattern, wpattern);
+  reg.imbue (loc);
+  reg.assign (wpattern, get_flags (pc.m_icase));
+  bool std_matched = std_search (reg, subject);
+  std::chrono::microseconds std_time = timer.time_and_reset ();
+
+  std::cout << "    " << std::left << std::setw (44) << (pc.m_pattern + " on a{24}") << std::right
+	    << "  dfa " << std::setw (9) << dfa_time.count () << " us  std::regex " << std::setw (9)
+	    << std_time.count () << " us" << std::endl;
+  assert (!dfa_matched && !std_matched);
+}
+
+int
+main (int argc, char **argv)
+{
+  std::size_t line_count = 20000;
+  std::locale loc = get_utf8_locale ();
+  bool success = true;
+
+  if (argc > 1)
+    {
+      line_count = (std::size_t) std::stoul (argv[1]);
+    }
+
+  std::vector<std::string> lines = make_log_lines (line_count);
+  std::vector<std::string> check_lines (lines.begin (), lines.begin () + std::min<std::size_t> (lines.size (), 500));
+
+  for (const pattern_case &pc : get_syntax_patterns ())
+    {
+      success = check_pattern (pc, get_syntax_subjects (), loc) && success;
+    }
+  for (const pattern_case &pc : get_log_patterns ())
+    {
+      success = check_pattern (pc, check_lines, loc) && success;
+    }
+  if (!success)
+    {
+      std::cerr << "test failed" << std::endl;
+      return 1;
+    }
+
+  std::cout << "log search on " << line_count << " lines" << std::endl;
+  for (const pattern_case &pc : get_log_patterns ())
+    {
+      compare_speed (pc, lines, loc);
+    }
+  compare_pathological (loc);
+
+  std::cout << "test successful" << std::endl;
+  return 0;
+}
@@ -0,0 +1,248 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * test_tde_main.cpp - check that TDE pages decrypt back to the original and measure the pages/sec of the flush path
+ *                     with and without TDE.
+ *
+ *  usage:
+ *      test_tde [page_count]
+ *
+ *  "no tde" copies the page, which is what a flush does for a page that is not encrypted.
+ */
+
+#include "log_storage.hpp"
+#include "storage_common.h"
+#include "tde.h"
+#include "test_timers.hpp"
+
+#include <openssl/rand.h>
+
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+static const std::size_t ALIGNMENT = 16;
+
+class page_area
+{
+  public:
+    page_area (std::size_t page_count, std::size_t page_size)
+      : m_buffer (page_count * page_size + ALIGNMENT)
+      , m_page_size (page_size)
+    {
+      m_pages = (char *) PTR_ALIGN (m_buffer.data (), ALIGNMENT);
+    }
+
+    char *get (std::size_t index)
+    {
+      return m_pages + index * m_page_size;
+    }
+
+    char *data ()
+    {
+      return m_pages;
+    }
+
+  private:
+    std::vector<char> m_buffer;
+    char *m_pages;
+    std::size_t m_page_size;
+};
+
+static void
+print_rate (const char *name, std::size_t page_count, std::chrono::microseconds elapsed)
+{
+  double seconds = (double) elapsed.count () / 1000000;
+  double rate = seconds > 0 ? page_count / seconds : 0;
+
+  std::cout << "    " << std::left << std::setw (36) << name << std::right << std::setw (12) << std::fixed
+	    << std::setprecision (0) << rate << " pages/sec" << std::endl;
+}
+
+static bool
+test_data_pages (std::size_t page_count, TDE_ALGORITHM tde_algo, bool is_temp)
+{
+  page_area plain (page_count, IO_PAGESIZE);
+  page_area cipher (page_count, IO_PAGESIZE);
+  page_area decrypted (page_count, IO_PAGESIZE);
+  test_common::us_timer timer;
+
+  RAND_bytes ((unsigned char *) plain.data (), (int) (page_count * IO_PAGESIZE));
+  for (std::size_t i = 0; i < page_count; i++)
+    {
+      FILEIO_PAGE *iopage = (FILEIO_PAGE *) plain.get (i);
+      iopage->prv.lsa.pageid = 1000 + i;
+      iopage->prv.lsa.offset = 0;
+    }
+
+  timer.reset ();
+  for (std::size_t i = 0; i < page_count; i++)
+    {
+      std::memcpy (cipher.get (i), plain.get (i), IO_PAGESIZE);
+    }
+  print_rate ("data page, no tde", page_count, timer.time_and_reset ());
+
+  for (std::size_t i = 0; i < page_count; i++)
+    {
+      if (tde_encrypt_data_page ((FILEIO_PAGE *) plain.get (i), tde_algo, is_temp, (FILEIO_PAGE *) cipher.get (i))
+	  != NO_ERROR)
+	{
+	  std::cerr << "encrypting data page " << i << " failed" << std::endl;
+	  return false;
+	}
+    }
+  print_rate (is_temp ? "temp data page, tde" : "data page, tde", page_count, timer.time_and_reset ());
+
+  for (std::size_t i = 0; i < page_count; i++)
+    {
+      if (tde_decrypt_data_page ((FILEIO_PAGE *) cipher.get (i), tde_algo, is_temp, (FILEIO_PAGE *) decrypted.get (i))
+	  != NO_ERROR)
+	{
+	  std::cerr << "decrypting data page " << i << " failed" << std::endl;
+	  return false;
+	}
+    }
+  print_rate ("data page, tde decrypt", page_count, timer.time_and_reset ());
+
+  for (std::size_t i = 0; i < page_count; i++)
+    {
+      FILEIO_PAGE *plain_page = (FILEIO_PAGE *) plain.get (i);
+      FILEIO_PAGE *decrypted_page = (FILEIO_PAGE *) decrypted.get (i);
+
+      /* only the nonce in the reserved area changes */
+      if (std::memcmp (plain_page->page, decrypted_page->page, DB_PAGESIZE) != 0
+	  || std::memcmp (cipher.get (i) + TDE_DATA_PAGE_ENC_OFFSET, plain.get (i) + TDE_DATA_PAGE_ENC_OFFSET,
+			  DB_PAGESIZE) == 0)
+	{
+	  std::cerr << "data page " << i << " does not decrypt to the original" << std::endl;
+	  return false;
+	}
+    }
+  return true;
+}
+
+static bool
+test_log_pages (std::size_t page_count, TDE_ALGORITHM tde_algo)
+{
+  page_area plain (page_count, LOG_PAGESIZE);
+  page_area cipher_single (page_count, LOG_PAGESIZE);
+  page_area cipher_batch (page_count, LOG_PAGESIZE);
+  page_area decrypted (page_count, LOG_PAGESIZE);
+  std::vector<LOG_PAGE *> to_flush (page_count);
+  const std::size_t batch_npages = 32;
+  test_common::us_timer timer;
+
+  RAND_bytes ((unsigned char *) plain.data (), (int) (page_count * LOG_PAGESIZE));
+  for (std::size_t i = 0; i < page_count; i++)
+    {
+      to_flush[i] = (LOG_PAGE *) plain.get (i);
+      to_flush[i]->hdr.logical_pageid = 5000 + i;
+      to_flush[i]->hdr.flags = tde_algo == TDE_ALGORITHM_AES ? LOG_HDRPAGE_FLAG_ENCRYPTED_AES
+			       : LOG_HDRPAGE_FLAG_ENCRYPTED_ARIA;
+    }
+
+  timer.reset ();
+  for (std::size_t i = 0; i < page_count; i++)
+    {
+      std::memcpy (cipher_single.get (i), plain.get (i), LOG_PAGESIZE);
+    }
+  print_rate ("log page, no tde", page_count, timer.time_and_reset ());
+
+  for (std::size_t i = 0; i < page_count; i++)
+    {
+      if (tde_encrypt_log_page (to_flush[i], tde_algo, (LOG_PAGE *) cipher_single.get (i)) != NO_ERROR)
+	{
+	  std::cerr << "encrypting log page " << i << " failed" << std::endl;
+	  return false;
+	}
+    }
+  print_rate ("log page, tde page by page", page_count, timer.time_and_reset ());
+
+  for (std::size_t i = 0; i < page_count; i += batch_npages)
+    {
+      int npages = (int) std::min (batch_npages, page_count - i);
+      if (tde_encrypt_log_pages (&to_flush[i], npages, tde_algo, cipher_batch.get (i)) != NO_ERROR)
+	{
+	  std::cerr << "encrypting log pages from " << i << " failed" << std::endl;
+	  return false;
+	}
+    }
+  print_rate ("log page, tde in runs of 32", page_count, timer.time_and_reset ());
+
+  if (std::memcmp (cipher_single.data (), cipher_batch.data (), page_count * LOG_PAGESIZE) != 0)
+    {
+      std::cerr << "log pages encrypted in runs differ from log pages encrypted one by one" << std::endl;
+      return false;
+    }
+
+  for (std::size_t i = 0; i < page_count; i++)
+    {
+      if (tde_decrypt_log_page ((LOG_PAGE *) cipher_batch.get (i), tde_algo, (LOG_PAGE *) decrypted.get (i))
+	  != NO_ERROR)
+	{
+	  std::cerr << "decrypting log page " << i << " failed" << std::endl;
+	  return false;
+	}
+    }
+  if (std::memcmp (plain.data (), decrypted.data (), page_count * LOG_PAGESIZE) != 0)
+    {
+      std::cerr << "log pages do not decrypt to the original" << std::endl;
+      return false;
+    }
+  return true;
+}
+
+int
+main (int argc, char **argv)
+{
+  std::size_t page_count = 4096;
+  TDE_ALGORITHM algorithms[] = { TDE_ALGORITHM_AES, TDE_ALGORITHM_ARIA };
+  bool success = true;
+
+  if (argc > 1)
+    {
+      page_count = (std::size_t) std::stoul (argv[1]);
+    }
+
+  db_set_page_size (IO_DEFAULT_PAGE_SIZE, IO_DEFAULT_PAGE_SIZE);
+
+  RAND_bytes (tde_Cipher.data_keys.perm_key, TDE_DATA_KEY_LENGTH);
+  RAND_bytes (tde_Cipher.data_keys.temp_key, TDE_DATA_KEY_LENGTH);
+  RAND_bytes (tde_Cipher.data_keys.log_key, TDE_DATA_KEY_LENGTH);
+  tde_Cipher.temp_write_counter = 0;
+  tde_Cipher.is_loaded = true;
+
+  for (TDE_ALGORITHM tde_algo : algorithms)
+    {
+      std::cout << tde_get_algorithm_name (tde_algo) << ", " << page_count << " pages of " << IO_PAGESIZE
+		<< " bytes" << std::endl;
+      success = test_data_pages (page_count, tde_algo, false) && success;
+      success = test_data_pages (page_count, tde_algo, true) && success;
+      success = test_log_pages (page_count, tde_algo) && success;
+    }
+
+  if (!success)
+    {
+      std::cerr << "test failed" << std::endl;
+      return 1;
+    }
+  std::cout << "test successful" << std::endl;
+  return 0;
+}